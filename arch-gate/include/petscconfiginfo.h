@@ -0,0 +1 @@
+static const char *petscconfigureoptions = "PETSC_ARCH=arch-gate --with-cc=mpicc --with-cxx=0 --with-fc=0 --with-debugging=1 --with-blaslapack-lib=\"-llapack -lblas\" --with-x=0 --with-openmp=1 --with-shared-libraries=1";
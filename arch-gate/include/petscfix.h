@@ -0,0 +1,9 @@
+#if !defined(INCLUDED_PETSCFIX_H)
+#define INCLUDED_PETSCFIX_H
+
+#if defined(__cplusplus)
+extern "C" {
+}
+#else
+#endif
+#endif
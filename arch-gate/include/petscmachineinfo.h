@@ -0,0 +1,17 @@
+static const char *petscmachineinfo = "\n"
+"-----------------------------------------\n"
+"Libraries compiled on 2026-10-18 04:13:29 on vm \n"
+"Machine characteristics: Linux-6.18.44-fc-v139-x86_64-with-glibc2.34\n"
+"Using PETSc directory: /root/repo\n"
+"Using PETSc arch: arch-gate\n"
+"-----------------------------------------\n";
+static const char *petsccompilerinfo = "\n"
+"Using C compiler: mpicc  -fPIC -Wall -Wwrite-strings -Wno-strict-aliasing -Wno-unknown-pragmas -fstack-protector -fvisibility=hidden -g3 -fopenmp  \n"
+"-----------------------------------------\n";
+static const char *petsccompilerflagsinfo = "\n"
+"Using include paths: -I/root/repo/include -I/root/repo/arch-gate/include\n"
+"-----------------------------------------\n";
+static const char *petsclinkerinfo = "\n"
+"Using C linker: mpicc\n"
+"Using libraries: -Wl,-rpath,/root/repo/arch-gate/lib -L/root/repo/arch-gate/lib -lpetsc -llapack -lblas -lm -lquadmath -ldl\n"
+"-----------------------------------------\n";
@@ -0,0 +1,18 @@
+#!/root/.pyenv/versions/3.8.18/bin/python3
+if __name__ == '__main__':
+  import sys
+  import os
+  sys.path.insert(0, os.path.abspath('config'))
+  import configure
+  configure_options = [
+    '--with-blaslapack-lib=-llapack -lblas',
+    '--with-cc=mpicc',
+    '--with-cxx=0',
+    '--with-debugging=1',
+    '--with-fc=0',
+    '--with-openmp=1',
+    '--with-shared-libraries=1',
+    '--with-x=0',
+    'PETSC_ARCH=arch-gate',
+  ]
+  configure.petsc_configure(configure_options)
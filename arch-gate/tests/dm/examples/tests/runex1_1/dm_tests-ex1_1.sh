@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex1 -nox  > ex1_1.tmp 2> runex1_1.err
@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex21 -mx 30 -my 30 -mz 30 -periodic 0 -da_processors_x 5  > ex21_1.tmp 2> runex21_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex21_10.out ex21_10.tmp > diff-runex21_10.out 2> diff-runex21_10.out
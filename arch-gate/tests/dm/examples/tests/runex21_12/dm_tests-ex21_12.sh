@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex21 -mx 30 -my 30 -mz 29 -periodic 3 -da_processors_z 5  > ex21_12.tmp 2> runex21_12.err
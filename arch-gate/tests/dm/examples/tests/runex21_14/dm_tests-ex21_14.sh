@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex21 -mx 29 -my 30 -mz 30 -periodic 1  > ex21_14.tmp 2> runex21_14.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex21_16.out ex21_16.tmp > diff-runex21_16.out 2> diff-runex21_16.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex21_3.out ex21_3.tmp > diff-runex21_3.out 2> diff-runex21_3.out
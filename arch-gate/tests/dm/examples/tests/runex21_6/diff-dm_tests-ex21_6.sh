@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex21_6.out ex21_6.tmp > diff-runex21_6.out 2> diff-runex21_6.out
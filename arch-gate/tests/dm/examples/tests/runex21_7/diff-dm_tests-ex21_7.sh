@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex21_7.out ex21_7.tmp > diff-runex21_7.out 2> diff-runex21_7.out
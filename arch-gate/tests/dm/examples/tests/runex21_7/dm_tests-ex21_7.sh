@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex21 -mx 30 -my 29 -mz 30 -periodic 2 -da_processors_y 5  > ex21_7.tmp 2> runex21_7.err
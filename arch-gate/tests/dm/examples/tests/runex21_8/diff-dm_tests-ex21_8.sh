@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex21_8.out ex21_8.tmp > diff-runex21_8.out 2> diff-runex21_8.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex23 -one  -dof 1 -stencil_type 1 > ex23_1.tmp 2> runex23_1.err
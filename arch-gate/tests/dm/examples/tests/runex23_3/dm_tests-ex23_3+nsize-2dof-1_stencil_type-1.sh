@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex23 -two  -dof 1 -stencil_type 1 > ex23_3.tmp 2> runex23_3.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex23 -three  -dof 3 -stencil_type 1 > ex23_4.tmp 2> runex23_4.err
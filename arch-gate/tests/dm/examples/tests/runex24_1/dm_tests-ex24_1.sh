@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex24   > ex24_1.tmp 2> runex24_1.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex24   > ex24_2.tmp 2> runex24_2.err
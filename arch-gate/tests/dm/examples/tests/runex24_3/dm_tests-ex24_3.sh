@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex24   > ex24_3.tmp 2> runex24_3.err
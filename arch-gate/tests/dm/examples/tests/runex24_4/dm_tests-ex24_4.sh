@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex24   > ex24_4.tmp 2> runex24_4.err
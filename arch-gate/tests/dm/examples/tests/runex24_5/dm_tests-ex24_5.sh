@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex24   > ex24_5.tmp 2> runex24_5.err
@@ -0,0 +1 @@
+mpiexec  -n 6 ../ex24   > ex24_6.tmp 2> runex24_6.err
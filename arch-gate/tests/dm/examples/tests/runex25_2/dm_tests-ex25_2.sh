@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex25   > ex25_2.tmp 2> runex25_2.err
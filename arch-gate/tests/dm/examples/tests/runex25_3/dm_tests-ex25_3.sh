@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex25   > ex25_3.tmp 2> runex25_3.err
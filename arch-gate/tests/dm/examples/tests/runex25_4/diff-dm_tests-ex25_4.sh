@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v -i Process' /root/repo/src/dm/examples/tests/output/ex25_2.out ex25_4.tmp > diff-runex25_4.out 2> diff-runex25_4.out
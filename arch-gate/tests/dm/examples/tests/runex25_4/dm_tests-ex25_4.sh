@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex25   > ex25_4.tmp 2> runex25_4.err
@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex25   > ex25_5.tmp 2> runex25_5.err
@@ -0,0 +1 @@
+mpiexec  -n 6 ../ex25   > ex25_6.tmp 2> runex25_6.err
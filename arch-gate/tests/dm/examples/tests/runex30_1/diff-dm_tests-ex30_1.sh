@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex30_1.out ex30_1.tmp > diff-runex30_1.out 2> diff-runex30_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex30 -bs 2 -block 1 -sliced_mat_type aij -alpha 10 -u0 0.1  > ex30_2.tmp 2> runex30_2.err
@@ -0,0 +1 @@
+mpiexec  -n 12 ../ex34 -dm_view -dim 3 -da_grid_x 11 -da_grid_y 5 -da_grid_z 7  > ex34_1.tmp 2> runex34_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex36_1d.out ex36_1d.tmp > diff-runex36_1d.out 2> diff-runex36_1d.out
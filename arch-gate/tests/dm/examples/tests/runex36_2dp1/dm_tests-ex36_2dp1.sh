@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex36 -mx 10 -my 10 -nl 4 -dim 2 -cmap 3 -da_refine_x 3 -da_refine_y 4  > ex36_2dp1.tmp 2> runex36_2dp1.err
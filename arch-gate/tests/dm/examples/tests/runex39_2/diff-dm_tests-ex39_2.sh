@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "Vec Object"' /root/repo/src/dm/examples/tests/output/ex39_2.out ex39_2.tmp > diff-runex39_2.out 2> diff-runex39_2.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex39   > ex39_2.tmp 2> runex39_2.err
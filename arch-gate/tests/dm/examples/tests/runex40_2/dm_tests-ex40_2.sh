@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex40   > ex40_2.tmp 2> runex40_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex41_1.out ex41_1.tmp > diff-runex41.out 2> diff-runex41.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex41   > ex41_2.tmp 2> runex41_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex42   > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex44   > ex44_1.tmp 2> runex44_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex44 -overlap  > ex44_overlap.tmp 2> runex44_overlap.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex44_1.out ex44_sf.tmp > diff-runex44_sf.out 2> diff-runex44_sf.out
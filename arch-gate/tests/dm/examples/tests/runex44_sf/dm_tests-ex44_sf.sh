@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex44 -vecscatter_type sf  > ex44_sf.tmp 2> runex44_sf.err
@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex45   > ex45_1.tmp 2> runex45_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex46   > ex46_1.tmp 2> runex46_1.err
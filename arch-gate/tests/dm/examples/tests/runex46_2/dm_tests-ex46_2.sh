@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex46 distribute -m 1 -n 1 -p 3 -NZ 20  > ex46_2.tmp 2> runex46_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex47   > ex47_1.tmp 2> runex47_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex48_4.out ex48_4.tmp > diff-runex48_4.out 2> diff-runex48_4.out
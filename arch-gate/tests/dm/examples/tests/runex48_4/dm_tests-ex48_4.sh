@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex48 -dof 2 -namefields  > ex48_4.tmp 2> runex48_4.err
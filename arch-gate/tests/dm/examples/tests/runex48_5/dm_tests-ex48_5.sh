@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex48 -dof 4 -namefields  > ex48_5.tmp 2> runex48_5.err
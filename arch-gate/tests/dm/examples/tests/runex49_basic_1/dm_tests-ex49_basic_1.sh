@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex49   > ex49_basic_1.tmp 2> runex49_basic_1.err
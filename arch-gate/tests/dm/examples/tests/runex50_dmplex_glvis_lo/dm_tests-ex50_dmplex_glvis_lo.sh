@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex50 -view glvis: -ho 0  > ex50_dmplex_glvis_lo.tmp 2> runex50_dmplex_glvis_lo.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex52   > ex52_1.tmp 2> runex52.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex53_1.out ex53_1.tmp > diff-runex53_1.out 2> diff-runex53_1.out
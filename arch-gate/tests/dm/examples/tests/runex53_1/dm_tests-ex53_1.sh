@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex53   > ex53_1.tmp 2> runex53_1.err
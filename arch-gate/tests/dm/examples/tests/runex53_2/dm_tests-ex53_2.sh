@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex53 -s 2 -dof 3  > ex53_2.tmp 2> runex53_2.err
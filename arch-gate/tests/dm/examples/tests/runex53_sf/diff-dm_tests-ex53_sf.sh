@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex53_1.out ex53_sf.tmp > diff-runex53_sf.out 2> diff-runex53_sf.out
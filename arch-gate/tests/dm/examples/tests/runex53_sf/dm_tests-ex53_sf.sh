@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex53 -vecscatter_type sf  > ex53_sf.tmp 2> runex53_sf.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -dm_mat_type baij -dim 2  > ex5_2.tmp 2> runex5_2.err
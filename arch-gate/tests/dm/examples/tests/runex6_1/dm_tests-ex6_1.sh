@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex6 -testorder -nox  > ex6_1.tmp 2> runex6_1.err
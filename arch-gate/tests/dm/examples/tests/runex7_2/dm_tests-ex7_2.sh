@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex7 -dof 3 -stencil_width 2 -M 50 -N 50 -periodic -grid2d  > ex7_2.tmp 2> runex7_2.err
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex7 -dof 3 -stencil_width 2 -M 50 -N 50 -periodic -grid3d  > ex7_3.tmp 2> runex7_3.err
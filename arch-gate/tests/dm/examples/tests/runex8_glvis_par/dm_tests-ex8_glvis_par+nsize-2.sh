@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex8 -dm_view glvis: -vec_view glvis:  > ex8_glvis_par.tmp 2> runex8_glvis_par.err
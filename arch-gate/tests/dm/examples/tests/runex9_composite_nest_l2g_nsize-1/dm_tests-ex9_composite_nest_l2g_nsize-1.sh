@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex9   > ex9_composite_nest_l2g_nsize-1.tmp 2> runex9_composite_nest_l2g_nsize-1.err
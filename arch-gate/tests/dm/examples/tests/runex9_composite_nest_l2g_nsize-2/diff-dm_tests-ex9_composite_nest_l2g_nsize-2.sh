@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/dm/examples/tests/output/ex9_composite_nest_l2g_nsize-2.out ex9_composite_nest_l2g_nsize-2.tmp > diff-runex9_composite_nest_l2g_nsize-2.out 2> diff-runex9_composite_nest_l2g_nsize-2.out
@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex18'
+testname='runex18_4_tet_test_orient'
+label='dm_impls_plex_tests-ex18_4_tet_test_orient'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-dim 3 -distribute 0 -dm_plex_check_all'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2}
+rotate_interface_0_in=${rotate_interface_0:-0 1 2 11 12 13}
+rotate_interface_1_in=${rotate_interface_1:-0 1 2 11 12 13}
+
+
+for nsize in ${nsize_in}; do
+   for rotate_interface_0 in ${rotate_interface_0_in}; do
+      for rotate_interface_1 in ${rotate_interface_1_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -rotate_interface_0 ${rotate_interface_0} -rotate_interface_1 ${rotate_interface_1}" ex18_4_tet_test_orient.tmp ${testname}.err "${label}+rotate_interface_0-${rotate_interface_0}_rotate_interface_1-${rotate_interface_1}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/dm/impls/plex/examples/tests/output/ex18_4_tet_test_orient.out ex18_4_tet_test_orient.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+rotate_interface_0-${rotate_interface_0}_rotate_interface_1-${rotate_interface_1} ""
+         else
+            petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1,71 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex31'
+testname='runex31_0'
+label='dm_impls_plex_tests-ex31_0'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-interpolate -use_initial_guess FALSE'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    petsc_report_tapoutput "" "${label}" "SKIP PETSC_HAVE_PARMETIS requirement not met"
+    total=1; skip=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+nsize_in=${nsize:-2 3 4}
+faces_in=${faces:-2,3,4  5,4,3  7,11,5}
+entity_depth_in=${entity_depth:-0 1}
+parallel_in=${parallel:-FALSE TRUE}
+
+
+for nsize in ${nsize_in}; do
+   for faces in ${faces_in}; do
+      for entity_depth in ${entity_depth_in}; do
+         for parallel in ${parallel_in}; do
+
+            petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -faces ${faces} -entity_depth ${entity_depth} -parallel ${parallel}" ex31_0.tmp ${testname}.err "${label}+nsize-${nsize}faces-${faces}_entity_depth-${entity_depth}_parallel-${parallel}" 
+            res=$?
+
+            if test $res = 0; then
+               petsc_testrun "${diff_exe} /root/repo/src/dm/impls/plex/examples/tests/output/ex31_0.out ex31_0.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+nsize-${nsize}faces-${faces}_entity_depth-${entity_depth}_parallel-${parallel} ""
+            else
+               petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+            fi
+
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
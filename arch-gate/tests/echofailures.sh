@@ -0,0 +1 @@
+echo dm_tests-ex53_2
\ No newline at end of file
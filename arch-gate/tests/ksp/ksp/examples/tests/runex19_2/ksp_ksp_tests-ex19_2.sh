@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex19 -ksp_monitor_short  > ex19_2.tmp 2> runex19_2.err
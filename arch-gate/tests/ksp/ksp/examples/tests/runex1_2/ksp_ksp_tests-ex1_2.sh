@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex1 -pc_type jacobi -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex1_2.tmp 2> runex1_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex1 -pc_type eisenstat -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex1_5.tmp 2> runex1_5.err
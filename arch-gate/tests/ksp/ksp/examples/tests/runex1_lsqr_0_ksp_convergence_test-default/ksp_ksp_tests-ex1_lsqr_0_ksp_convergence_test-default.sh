@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex1 -test_lsqr -ksp{,1,2}_view -pc_type jacobi -ksp_convergence_test default  > ex1_lsqr_0_ksp_convergence_test-default.tmp 2> runex1_lsqr_0_ksp_convergence_test-default.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -E "(^  type:|preconditioning|norm type|convergence test:)"' /root/repo/src/ksp/ksp/examples/tests/output/ex1_lsqr_0_ksp_convergence_test-skip.out ex1_lsqr_0_ksp_convergence_test-skip.tmp > diff-runex1_lsqr_0_ksp_convergence_test-skip.out 2> diff-runex1_lsqr_0_ksp_convergence_test-skip.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex1 -test_lsqr -ksp{,1,2}_view -pc_type jacobi -ksp_type lsqr  > ex1_lsqr_2.tmp 2> runex1_lsqr_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex21 -mat_schur_complement_ainv_type blockdiag  > ex21_blockdiag_2.tmp 2> runex21_blockdiag_2.err
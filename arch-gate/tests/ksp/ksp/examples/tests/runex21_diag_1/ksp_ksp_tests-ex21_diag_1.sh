@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex21 -mat_schur_complement_ainv_type diag  > ex21_diag_1.tmp 2> runex21_diag_1.err
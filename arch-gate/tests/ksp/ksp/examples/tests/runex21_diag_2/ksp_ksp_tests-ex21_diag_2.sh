@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex21 -mat_schur_complement_ainv_type diag  > ex21_diag_2.tmp 2> runex21_diag_2.err
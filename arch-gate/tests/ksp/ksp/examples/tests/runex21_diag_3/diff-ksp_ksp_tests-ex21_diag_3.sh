@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex21_diag_3.out ex21_diag_3.tmp > diff-runex21_diag_3.out 2> diff-runex21_diag_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex22_2.out ex22_2.tmp > diff-runex22_2.out 2> diff-runex22_2.out
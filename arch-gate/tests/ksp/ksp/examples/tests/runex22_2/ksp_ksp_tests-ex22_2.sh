@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex22   > ex22_2.tmp 2> runex22_2.err
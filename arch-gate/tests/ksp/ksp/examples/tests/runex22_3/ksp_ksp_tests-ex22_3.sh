@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex22 -ksp_monitor_short -ksp_type bicg  > ex22_3.tmp 2> runex22_3.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex26 -ksp_monitor_short  > ex26_1.tmp 2> runex26_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex28_2.out ex28_2.tmp > diff-runex28_2.out 2> diff-runex28_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex32_1.out ex32_1.tmp > diff-runex32_1.out 2> diff-runex32_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex33 -sigma 2.0  > ex33_1.tmp 2> runex33_1.err
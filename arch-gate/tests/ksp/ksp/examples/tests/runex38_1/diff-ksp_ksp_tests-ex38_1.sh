@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex38_1.out ex38_1.tmp > diff-runex38_1.out 2> diff-runex38_1.out
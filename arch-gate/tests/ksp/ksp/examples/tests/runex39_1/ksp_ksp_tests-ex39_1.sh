@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex39 -ksp_type fbcgs -ksp_rtol 1.e-6 -sub_ksp_type bcgs -sub_ksp_rtol 1.e-3 -pc_type bjacobi -ksp_converged_reason -n1 32 -n2 32 -n3 32  > ex39_1.tmp 2> runex39_1.err
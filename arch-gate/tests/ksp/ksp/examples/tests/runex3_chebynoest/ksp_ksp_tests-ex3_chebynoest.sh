@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -ksp_est_view -ksp_type chebyshev -ksp_chebyshev_eigenvalues 0.1,1.0  > ex3_chebynoest.tmp 2> runex3_chebynoest.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -ksp_est_view  > ex3_nocheby.tmp 2> runex3_nocheby.err
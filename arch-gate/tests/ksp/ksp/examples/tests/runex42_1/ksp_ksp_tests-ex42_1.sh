@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex42 -ksp_type minres -pc_type none -ksp_converged_reason  > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex42 -ksp_type minres -pc_type none -ksp_converged_reason  > ex42_2.tmp 2> runex42_2.err
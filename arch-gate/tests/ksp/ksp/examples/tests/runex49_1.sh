@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex49'
+testname='runex49_1'
+label='ksp_ksp_tests-ex49_1'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-pc_type cholesky -herm 0'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-1}
+mat_type_in=${mat_type:-aij baij sbaij}
+bs_in=${bs:-1 2 3 4 5 6 7 8 9 10 11 12}
+conv_in=${conv:-0 1}
+
+
+for nsize in ${nsize_in}; do
+   for mat_type in ${mat_type_in}; do
+      for bs in ${bs_in}; do
+         for conv in ${conv_in}; do
+
+            petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -mat_type ${mat_type} -bs ${bs} -conv ${conv}" ex49_1.tmp ${testname}.err "${label}+mat_type-${mat_type}_bs-${bs}_conv-${conv}" 
+            res=$?
+
+            if test $res = 0; then
+               petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex49_1.out ex49_1.tmp > diff-${testname}-0.out 2> diff-${testname}-0.out || ${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex49_1_alt.out ex49_1.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+mat_type-${mat_type}_bs-${bs}_conv-${conv} ""
+            else
+               petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+            fi
+
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
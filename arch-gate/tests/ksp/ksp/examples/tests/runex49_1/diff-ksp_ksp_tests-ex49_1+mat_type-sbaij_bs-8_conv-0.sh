@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex49_1.out ex49_1.tmp > diff-runex49_1-0.out 2> diff-runex49_1-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex49_1_alt.out ex49_1.tmp > diff-runex49_1.out 2> diff-runex49_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex49 -pc_type cholesky -herm 0  -mat_type sbaij -bs 6 -conv 0 > ex49_1.tmp 2> runex49_1.err
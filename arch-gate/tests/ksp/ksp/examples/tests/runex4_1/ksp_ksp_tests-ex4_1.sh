@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex4 -ksp_monitor_short -m 5 -pc_type jacobi -ksp_gmres_cgs_refinement_type refine_always  > ex4_1.tmp 2> runex4_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex50 -pc_type pbjacobi  -bs 4 > ex50_1.tmp 2> runex50_1.err
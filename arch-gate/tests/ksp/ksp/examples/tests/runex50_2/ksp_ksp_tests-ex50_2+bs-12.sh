@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex50 -pc_type ilu  -bs 12 > ex50_2.tmp 2> runex50_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex51 -reverse  > ex51_1.tmp 2> runex51_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex51_2.out ex51_2.tmp > diff-runex51_2-0.out 2> diff-runex51_2-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex51_2_alt.out ex51_2.tmp > diff-runex51_2-1.out 2> diff-runex51_2-1.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex51_2_alt_2.out ex51_2.tmp > diff-runex51_2.out 2> diff-runex51_2.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex53 -method 1  > ex53_1.tmp 2> runex53_1.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex53 -method 2  > ex53_2.tmp 2> runex53_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex54_2.out ex54_2.tmp > diff-runex54_2-0.out 2> diff-runex54_2-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex54_2_alt.out ex54_2.tmp > diff-runex54_2.out 2> diff-runex54_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex54_4.out ex54_4.tmp > diff-runex54_4-0.out 2> diff-runex54_4-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex54_4_alt.out ex54_4.tmp > diff-runex54_4.out 2> diff-runex54_4.out
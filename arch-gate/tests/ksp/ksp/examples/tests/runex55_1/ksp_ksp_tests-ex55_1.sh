@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex55 -ksp_monitor -pc_composite_type multiplicative  > ex55_1.tmp 2> runex55_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex60 -ksp_view  > ex60_0.tmp 2> runex60_0.err
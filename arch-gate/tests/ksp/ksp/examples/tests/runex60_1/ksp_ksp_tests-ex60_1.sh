@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex60 -ksp_view  > ex60_1.tmp 2> runex60_1.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex60 -user_subdomains -ksp_view ${ARGS}  > ex60_2.tmp 2> runex60_2.err
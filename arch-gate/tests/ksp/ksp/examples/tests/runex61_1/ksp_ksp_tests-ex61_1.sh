@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex61   > ex61_1.tmp 2> runex61_1.err
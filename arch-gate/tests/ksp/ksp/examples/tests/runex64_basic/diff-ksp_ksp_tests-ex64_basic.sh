@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex64_1.out ex64_basic.tmp > diff-runex64_basic.out 2> diff-runex64_basic.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex64 -ksp_type bcgs -pc_type sor  > ex64_basic.tmp 2> runex64_basic.err
@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex64'
+testname='runex64_cg'
+label='ksp_ksp_tests-ex64_cg'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-ksp_type cg'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2}
+pc_type_in=${pc_type:-jacobi bjacobi}
+duplicate_in=${duplicate:-0 1}
+
+
+for nsize in ${nsize_in}; do
+   for pc_type in ${pc_type_in}; do
+      for duplicate in ${duplicate_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -pc_type ${pc_type} -duplicate ${duplicate}" ex64_cg.tmp ${testname}.err "${label}+pc_type-${pc_type}_duplicate-${duplicate}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex64_1.out ex64_cg.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+pc_type-${pc_type}_duplicate-${duplicate} ""
+         else
+            petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
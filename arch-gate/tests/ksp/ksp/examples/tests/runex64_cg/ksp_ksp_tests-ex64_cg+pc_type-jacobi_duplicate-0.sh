@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex64 -ksp_type cg  -pc_type jacobi -duplicate 0 > ex64_cg.tmp 2> runex64_cg.err
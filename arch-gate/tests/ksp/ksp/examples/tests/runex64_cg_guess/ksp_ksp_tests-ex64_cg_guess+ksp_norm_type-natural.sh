@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex64 -ksp_type cg -pc_type ilu -nonzero_guess  -ksp_norm_type natural > ex64_cg_guess.tmp 2> runex64_cg_guess.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex64 -ksp_type cg -pc_type sor  -pc_sor_omega 1.2 > ex64_cg_sor.tmp 2> runex64_cg_sor.err
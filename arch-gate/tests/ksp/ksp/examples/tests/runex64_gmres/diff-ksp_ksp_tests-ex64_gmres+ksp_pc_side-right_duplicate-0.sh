@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex64_1.out ex64_gmres.tmp > diff-runex64_gmres.out 2> diff-runex64_gmres.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex64 -ksp_type gmres -ksp_gmres_restart 4 -pc_type bjacobi  -ksp_pc_side right -duplicate 1 > ex64_gmres.tmp 2> runex64_gmres.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex64_preonly.out ex64_preonly.tmp > diff-runex64_preonly.out 2> diff-runex64_preonly.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex64 -ksp_type preonly  -pc_type lu > ex64_preonly.tmp 2> runex64_preonly.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex65 -ksp_type gcrodr -pc_type none -nsteps 8  -ksp_pc_side right > ex65_gcrodr.tmp 2> runex65_gcrodr.err
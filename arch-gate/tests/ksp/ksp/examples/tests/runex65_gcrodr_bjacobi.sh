@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex65'
+testname='runex65_gcrodr_bjacobi'
+label='ksp_ksp_tests-ex65_gcrodr_bjacobi'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-ksp_type gcrodr -pc_type bjacobi -ksp_gmres_restart 20 -ksp_gcrodr_recycle 5'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2}
+ksp_pc_side_in=${ksp_pc_side:-left right}
+
+
+for nsize in ${nsize_in}; do
+   for ksp_pc_side in ${ksp_pc_side_in}; do
+
+      petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -ksp_pc_side ${ksp_pc_side}" ex65_gcrodr_bjacobi.tmp ${testname}.err "${label}+ksp_pc_side-${ksp_pc_side}" 
+      res=$?
+
+      if test $res = 0; then
+         petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tests/output/ex65_gcrodr_bjacobi.out ex65_gcrodr_bjacobi.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+ksp_pc_side-${ksp_pc_side} ""
+      else
+         petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+      fi
+
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
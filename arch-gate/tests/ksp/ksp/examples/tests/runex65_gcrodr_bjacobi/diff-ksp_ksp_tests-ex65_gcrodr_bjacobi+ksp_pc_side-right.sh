@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex65_gcrodr_bjacobi.out ex65_gcrodr_bjacobi.tmp > diff-runex65_gcrodr_bjacobi.out 2> diff-runex65_gcrodr_bjacobi.out
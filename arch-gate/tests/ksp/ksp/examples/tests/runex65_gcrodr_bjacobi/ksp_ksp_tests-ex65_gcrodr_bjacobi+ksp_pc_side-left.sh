@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex65 -ksp_type gcrodr -pc_type bjacobi -ksp_gmres_restart 20 -ksp_gcrodr_recycle 5  -ksp_pc_side left > ex65_gcrodr_bjacobi.tmp 2> runex65_gcrodr_bjacobi.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex65_gmres.out ex65_gmres.tmp > diff-runex65_gmres.out 2> diff-runex65_gmres.out
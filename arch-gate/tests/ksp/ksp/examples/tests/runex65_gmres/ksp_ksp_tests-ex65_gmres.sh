@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex65 -ksp_type gmres -pc_type none -nsteps 8  > ex65_gmres.tmp 2> runex65_gmres.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex65 -ksp_type ir -ir_pc_type ilu -nsteps 8  > ex65_ir.tmp 2> runex65_ir.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex65_ir.out ex65_ir_mpi.tmp > diff-runex65_ir_mpi.out 2> diff-runex65_ir_mpi.out
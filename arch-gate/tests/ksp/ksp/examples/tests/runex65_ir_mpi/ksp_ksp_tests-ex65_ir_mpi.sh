@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex65 -ksp_type ir -ir_pc_type bjacobi -nsteps 8  > ex65_ir_mpi.tmp 2> runex65_ir_mpi.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tests/output/ex66_1.out ex66_1.tmp > diff-runex66_1.out 2> diff-runex66_1.out
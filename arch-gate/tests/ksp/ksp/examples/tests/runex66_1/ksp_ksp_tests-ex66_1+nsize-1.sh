@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex66   > ex66_1.tmp 2> runex66_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex66   > ex66_1.tmp 2> runex66_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -o -e "Reusing the eigenvalue estimates" -e "Estimating the eigenvalues again" | sort | uniq -c' /root/repo/src/ksp/ksp/examples/tests/output/ex66_mg.out ex66_mg.tmp > diff-runex66_mg.out 2> diff-runex66_mg.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex66 -ksp_type cg -pc_type gamg -pc_gamg_reuse_interpolation -pc_gamg_use_sa_esteig 0 -mg_levels_ksp_chebyshev_esteig_reuse_rtol 0.05 -info -info_exclude null,vec,mat,pc,sys  > ex66_mg.tmp 2> runex66_mg.err
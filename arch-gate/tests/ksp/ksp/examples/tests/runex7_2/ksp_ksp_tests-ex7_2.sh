@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex7 -ksp_monitor_short -ksp_max_it 10  > ex7_2.tmp 2> runex7_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex8 -sameA  > ex8_2.tmp 2> runex8_2.err
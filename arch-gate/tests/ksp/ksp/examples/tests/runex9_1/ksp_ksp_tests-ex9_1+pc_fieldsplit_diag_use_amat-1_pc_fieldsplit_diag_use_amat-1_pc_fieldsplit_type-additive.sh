@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex9 -ksp_converged_reason -ksp_error_if_not_converged  -pc_fieldsplit_diag_use_amat 1 -pc_fieldsplit_diag_use_amat 1 -pc_fieldsplit_type additive > ex9_1.tmp 2> runex9_1.err
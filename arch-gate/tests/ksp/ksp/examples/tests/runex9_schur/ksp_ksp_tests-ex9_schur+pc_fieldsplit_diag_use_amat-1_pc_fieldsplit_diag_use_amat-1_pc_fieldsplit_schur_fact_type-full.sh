@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex9 -pc_fieldsplit_type schur -pc_fieldsplit_schur_scale 1.0 -ksp_converged_reason -ksp_error_if_not_converged  -pc_fieldsplit_diag_use_amat 1 -pc_fieldsplit_diag_use_amat 1 -pc_fieldsplit_schur_fact_type full > ex9_schur.tmp 2> runex9_schur.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/network/output/ex1_nest.out ex1_nest.tmp > diff-runex1_nest.out 2> diff-runex1_nest.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/network/output/ex2_graphindex.out ex2_graphindex.tmp > diff-runex2_graphindex.out 2> diff-runex2_graphindex.out
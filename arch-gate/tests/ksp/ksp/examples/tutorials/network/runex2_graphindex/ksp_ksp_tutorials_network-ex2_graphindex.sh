@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -n 20 -vertex_global_section_view -edge_global_section_view  > ex2_graphindex.tmp 2> runex2_graphindex.err
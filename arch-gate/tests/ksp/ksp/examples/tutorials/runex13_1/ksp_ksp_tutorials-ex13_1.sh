@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex13 -m 19 -n 20 -ksp_gmres_cgs_refinement_type refine_always  > ex13_1.tmp 2> runex13_1.err
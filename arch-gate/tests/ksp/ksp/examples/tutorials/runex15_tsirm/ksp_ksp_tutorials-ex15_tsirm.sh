@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex15 -m 60 -n 60 -ksp_type tsirm -pc_type ksp -ksp_monitor_short -ksp_ksp_type fgmres -ksp_ksp_rtol 1e-10 -ksp_pc_type mg -ksp_ksp_max_it 30  > ex15_tsirm.tmp 2> runex15_tsirm.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex18_3.out ex18_3.tmp > diff-runex18_3.out 2> diff-runex18_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex23_2.out ex23_2.tmp > diff-runex23_2.out 2> diff-runex23_2.out
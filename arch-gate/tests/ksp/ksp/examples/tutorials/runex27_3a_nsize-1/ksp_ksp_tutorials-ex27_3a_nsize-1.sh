@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex27 -ksp_type cg -ksp_view -ksp_converged_reason -ksp_monitor_short -ksp_max_it 10 -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/tiny_system -f_x0 NONEXISTING_FILE  > ex27_3a_nsize-1.tmp 2> runex27_3a_nsize-1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex28 -ksp_monitor_short -pc_type mg -pc_mg_type full -ksp_type fgmres -da_refine 2 -mg_levels_ksp_type gmres -mg_levels_ksp_max_it 1 -mg_levels_pc_type ilu  > ex28_1.tmp 2> runex28_1.err
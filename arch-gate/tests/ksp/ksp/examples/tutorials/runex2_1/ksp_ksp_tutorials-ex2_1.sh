@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always  > ex2_1.tmp 2> runex2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_aijmixed_gamg.out ex2_aijmixed_gamg.tmp > diff-runex2_aijmixed_gamg.out 2> diff-runex2_aijmixed_gamg.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -mat_type aijmixed -pc_type gamg -m 20 -n 20  > ex2_aijmixed_gamg.tmp 2> runex2_aijmixed_gamg.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex2 -pc_type bjacobi -pc_bjacobi_blocks 4 -ksp_monitor_short -sub_pc_type jacobi -sub_ksp_type gmres  > ex2_bjacobi_3.tmp 2> runex2_bjacobi_3.err
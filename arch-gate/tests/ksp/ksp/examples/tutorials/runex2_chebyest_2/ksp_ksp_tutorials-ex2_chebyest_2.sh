@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -m 80 -n 80 -ksp_pc_side right -pc_type ksp -ksp_ksp_type chebyshev -ksp_ksp_max_it 5 -ksp_ksp_chebyshev_esteig 0.9,0,0,1.1 -ksp_esteig_ksp_type cg -ksp_monitor_short  > ex2_chebyest_2.tmp 2> runex2_chebyest_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_chowilu.out ex2_chowilu.tmp > diff-runex2_chowilu.out 2> diff-runex2_chowilu.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -pc_type chowilu -ksp_gmres_cgs_refinement_type refine_always  -mat_seqaij_num_threads 1 > ex2_chowilu.tmp 2> runex2_chowilu.err
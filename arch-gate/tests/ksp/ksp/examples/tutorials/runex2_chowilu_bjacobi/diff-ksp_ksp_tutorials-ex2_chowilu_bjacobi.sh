@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_chowilu_bjacobi.out ex2_chowilu_bjacobi.tmp > diff-runex2_chowilu_bjacobi.out 2> diff-runex2_chowilu_bjacobi.out
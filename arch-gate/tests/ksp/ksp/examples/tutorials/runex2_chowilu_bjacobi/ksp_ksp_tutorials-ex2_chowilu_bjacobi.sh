@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -sub_pc_type chowilu -sub_pc_chowilu_levels 1 -sub_pc_chowilu_solve_iterations 0 -ksp_gmres_cgs_refinement_type refine_always  > ex2_chowilu_bjacobi.tmp 2> runex2_chowilu_bjacobi.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_type dgmres -ksp_gmres_restart 6 -ksp_dgmres_eigen 2 -ksp_gmres_lowsyncgramschmidt  > ex2_dgmres_lowsync.tmp 2> runex2_dgmres_lowsync.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_type fgmres -ksp_gmres_lowsyncgramschmidt -pc_type ksp -ksp_ksp_type gmres -ksp_ksp_gmres_lowsyncgramschmidt -ksp_ksp_max_it 3 -ksp_ksp_norm_type unpreconditioned  > ex2_fgmres_ksp_lowsync.tmp 2> runex2_fgmres_ksp_lowsync.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_type fgmres -ksp_gmres_lowsyncgramschmidt  > ex2_fgmres_lowsync.tmp 2> runex2_fgmres_lowsync.err
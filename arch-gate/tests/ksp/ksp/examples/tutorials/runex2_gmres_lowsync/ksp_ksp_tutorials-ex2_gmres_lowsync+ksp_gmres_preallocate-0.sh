@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_gmres_lowsyncgramschmidt  -ksp_gmres_preallocate 0 > ex2_gmres_lowsync.tmp 2> runex2_gmres_lowsync.err
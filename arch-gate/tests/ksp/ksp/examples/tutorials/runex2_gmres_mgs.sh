@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex2'
+testname='runex2_gmres_mgs'
+label='ksp_ksp_tutorials-ex2_gmres_mgs'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-ksp_monitor_short -m 5 -n 5 -ksp_gmres_modifiedgramschmidt'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2}
+ksp_gmres_preallocate_in=${ksp_gmres_preallocate:-0 1}
+
+
+for nsize in ${nsize_in}; do
+   for ksp_gmres_preallocate in ${ksp_gmres_preallocate_in}; do
+
+      petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -ksp_gmres_preallocate ${ksp_gmres_preallocate}" ex2_gmres_mgs.tmp ${testname}.err "${label}+ksp_gmres_preallocate-${ksp_gmres_preallocate}" 
+      res=$?
+
+      if test $res = 0; then
+         petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_gmres_mgs.out ex2_gmres_mgs.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+ksp_gmres_preallocate-${ksp_gmres_preallocate} ""
+      else
+         petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+      fi
+
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
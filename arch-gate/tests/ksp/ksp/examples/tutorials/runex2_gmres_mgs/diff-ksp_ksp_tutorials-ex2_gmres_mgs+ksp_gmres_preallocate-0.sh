@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_gmres_mgs.out ex2_gmres_mgs.tmp > diff-runex2_gmres_mgs.out 2> diff-runex2_gmres_mgs.out
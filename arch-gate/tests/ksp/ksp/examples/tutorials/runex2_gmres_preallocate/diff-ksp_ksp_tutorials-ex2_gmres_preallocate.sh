@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_gmres_preallocate.out ex2_gmres_preallocate.tmp > diff-runex2_gmres_preallocate.out 2> diff-runex2_gmres_preallocate.out
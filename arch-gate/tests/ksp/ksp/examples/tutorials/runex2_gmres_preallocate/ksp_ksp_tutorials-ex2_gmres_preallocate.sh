@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always -ksp_gmres_preallocate  > ex2_gmres_preallocate.tmp 2> runex2_gmres_preallocate.err
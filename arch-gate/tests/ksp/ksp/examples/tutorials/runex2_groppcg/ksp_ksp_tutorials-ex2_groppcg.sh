@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -ksp_type groppcg -m 9 -n 9  > ex2_groppcg.tmp 2> runex2_groppcg.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_icc_levels.out ex2_icc_levels.tmp > diff-runex2_icc_levels.out 2> diff-runex2_icc_levels.out
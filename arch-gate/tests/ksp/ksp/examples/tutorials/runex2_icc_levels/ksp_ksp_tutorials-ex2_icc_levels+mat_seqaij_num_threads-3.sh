@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -ksp_type cg -pc_type icc -pc_factor_levels 1  -mat_seqaij_num_threads 3 > ex2_icc_levels.tmp 2> runex2_icc_levels.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_ilu_levels.out ex2_ilu_levels.tmp > diff-runex2_ilu_levels.out 2> diff-runex2_ilu_levels.out
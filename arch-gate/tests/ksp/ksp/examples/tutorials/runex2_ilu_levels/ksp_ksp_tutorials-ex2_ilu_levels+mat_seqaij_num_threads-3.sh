@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -pc_type ilu -pc_factor_levels 1 -ksp_gmres_cgs_refinement_type refine_always  -mat_seqaij_num_threads 3 > ex2_ilu_levels.tmp 2> runex2_ilu_levels.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_ir_bjacobi.out ex2_ir_bjacobi.tmp > diff-runex2_ir_bjacobi.out 2> diff-runex2_ir_bjacobi.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -ksp_type ir -ksp_rtol 1.e-10 -ir_ksp_type cg -ir_pc_type bjacobi -m 9 -n 9 -ksp_view  > ex2_ir_bjacobi.tmp 2> runex2_ir_bjacobi.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -ksp_type ir -ksp_rtol 1.e-10 -ir_ksp_type cg -ir_pc_type gamg -ksp_ir_demote -m 20 -n 20  > ex2_ir_gamg.tmp 2> runex2_ir_gamg.err
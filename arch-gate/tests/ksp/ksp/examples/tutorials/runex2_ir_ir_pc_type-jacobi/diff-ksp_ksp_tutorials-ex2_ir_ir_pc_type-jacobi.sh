@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_ir_ir_pc_type-jacobi.out ex2_ir_ir_pc_type-jacobi.tmp > diff-runex2_ir_ir_pc_type-jacobi.out 2> diff-runex2_ir_ir_pc_type-jacobi.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -ksp_type ir -ksp_rtol 1.e-10 -m 9 -n 9 -ir_pc_type jacobi  > ex2_ir_ir_pc_type-jacobi.tmp 2> runex2_ir_ir_pc_type-jacobi.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_ir_ir_pc_type-sor.out ex2_ir_ir_pc_type-sor.tmp > diff-runex2_ir_ir_pc_type-sor.out 2> diff-runex2_ir_ir_pc_type-sor.out
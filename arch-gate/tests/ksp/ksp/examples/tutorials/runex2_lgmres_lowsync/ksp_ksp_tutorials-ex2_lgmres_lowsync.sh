@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -m 5 -n 5 -ksp_type lgmres -ksp_gmres_restart 6 -ksp_lgmres_augment 2 -ksp_gmres_lowsyncgramschmidt  > ex2_lgmres_lowsync.tmp 2> runex2_lgmres_lowsync.err
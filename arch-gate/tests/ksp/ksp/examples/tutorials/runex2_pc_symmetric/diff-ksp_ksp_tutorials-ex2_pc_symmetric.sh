@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pc_symmetric.out ex2_pc_symmetric.tmp > diff-runex2_pc_symmetric.out 2> diff-runex2_pc_symmetric.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -m 10 -n 9 -ksp_converged_reason -ksp_type gmres -ksp_pc_side symmetric -pc_type cholesky  > ex2_pc_symmetric.tmp 2> runex2_pc_symmetric.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pipebcgs.out ex2_pipebcgs.tmp > diff-runex2_pipebcgs.out 2> diff-runex2_pipebcgs.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -ksp_type pipecgrr -m 9 -n 9  > ex2_pipecgrr.tmp 2> runex2_pipecgrr.err
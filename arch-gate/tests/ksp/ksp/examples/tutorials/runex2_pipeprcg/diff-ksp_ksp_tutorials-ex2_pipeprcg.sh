@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_pipeprcg.out ex2_pipeprcg.tmp > diff-runex2_pipeprcg.out 2> diff-runex2_pipeprcg.out
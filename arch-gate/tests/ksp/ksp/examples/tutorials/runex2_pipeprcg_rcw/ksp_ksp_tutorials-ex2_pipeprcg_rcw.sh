@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_monitor_short -ksp_type pipeprcg -recompute_w false -m 9 -n 9  > ex2_pipeprcg_rcw.tmp 2> runex2_pipeprcg_rcw.err
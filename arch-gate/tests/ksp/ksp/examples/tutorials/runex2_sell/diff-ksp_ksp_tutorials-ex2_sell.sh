@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_sell.out ex2_sell.tmp > diff-runex2_sell.out 2> diff-runex2_sell.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_sstep_matrix_powers_ksp_type-sstepcg.out ex2_sstep_matrix_powers_ksp_type-sstepcg.tmp > diff-runex2_sstep_matrix_powers_ksp_type-sstepcg.out 2> diff-runex2_sstep_matrix_powers_ksp_type-sstepcg.out
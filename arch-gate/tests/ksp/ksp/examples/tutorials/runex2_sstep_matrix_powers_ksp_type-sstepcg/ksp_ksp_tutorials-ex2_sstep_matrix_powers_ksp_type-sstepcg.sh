@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex2 -ksp_monitor_short -pc_type none -ksp_max_it 16 -m 20 -n 20 -ksp_type sstepcg  > ex2_sstep_matrix_powers_ksp_type-sstepcg.tmp 2> runex2_sstep_matrix_powers_ksp_type-sstepcg.err
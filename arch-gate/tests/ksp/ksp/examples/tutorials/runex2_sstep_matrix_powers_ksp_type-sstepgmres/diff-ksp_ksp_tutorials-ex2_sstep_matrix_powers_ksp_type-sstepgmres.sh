@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_sstep_matrix_powers_ksp_type-sstepgmres.out ex2_sstep_matrix_powers_ksp_type-sstepgmres.tmp > diff-runex2_sstep_matrix_powers_ksp_type-sstepgmres.out 2> diff-runex2_sstep_matrix_powers_ksp_type-sstepgmres.out
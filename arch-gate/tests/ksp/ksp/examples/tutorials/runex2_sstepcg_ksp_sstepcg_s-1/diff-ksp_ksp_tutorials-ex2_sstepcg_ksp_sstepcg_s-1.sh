@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_sstepcg_ksp_sstepcg_s-1.out ex2_sstepcg_ksp_sstepcg_s-1.tmp > diff-runex2_sstepcg_ksp_sstepcg_s-1.out 2> diff-runex2_sstepcg_ksp_sstepcg_s-1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -ksp_type sstepcg -m 9 -n 9 -ksp_sstepcg_s 1  > ex2_sstepcg_ksp_sstepcg_s-1.tmp 2> runex2_sstepcg_ksp_sstepcg_s-1.err
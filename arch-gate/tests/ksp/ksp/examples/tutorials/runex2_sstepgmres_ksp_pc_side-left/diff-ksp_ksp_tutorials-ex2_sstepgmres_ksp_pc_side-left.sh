@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_sstepgmres_ksp_pc_side-left.out ex2_sstepgmres_ksp_pc_side-left.tmp > diff-runex2_sstepgmres_ksp_pc_side-left.out 2> diff-runex2_sstepgmres_ksp_pc_side-left.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex2_sstepgmres_ksp_pc_side-right.out ex2_sstepgmres_ksp_pc_side-right.tmp > diff-runex2_sstepgmres_ksp_pc_side-right.out 2> diff-runex2_sstepgmres_ksp_pc_side-right.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -ksp_monitor_short -ksp_type sstepgmres -ksp_sstepgmres_s 3 -ksp_sstepgmres_restart 5 -m 9 -n 9 -ksp_pc_side right  > ex2_sstepgmres_ksp_pc_side-right.tmp 2> runex2_sstepgmres_ksp_pc_side-right.err
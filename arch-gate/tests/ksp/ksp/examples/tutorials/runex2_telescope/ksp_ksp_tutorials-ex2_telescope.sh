@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex2 -m 100 -n 100 -ksp_converged_reason -pc_type telescope -pc_telescope_reduction_factor 4 -telescope_pc_type bjacobi  > ex2_telescope.tmp 2> runex2_telescope.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex32 -pc_type mg -pc_mg_type full -ksp_type fgmres -ksp_monitor_short -pc_mg_levels 3 -mg_coarse_pc_factor_shift_type nonzero  > ex32_1.tmp 2> runex32_1.err
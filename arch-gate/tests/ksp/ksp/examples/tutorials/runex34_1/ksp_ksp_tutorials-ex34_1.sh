@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex34 -pc_type mg -pc_mg_type full -ksp_type fgmres -ksp_monitor_short -pc_mg_levels 3 -mg_coarse_pc_factor_shift_type nonzero -ksp_view  > ex34_1.tmp 2> runex34_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex34_2.out ex34_2.tmp > diff-runex34_2.out 2> diff-runex34_2.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex42 -stokes_ksp_monitor_short -stokes_ksp_converged_reason -stokes_pc_type lu  > ex42_1.tmp 2> runex42_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex42_3.out ex42_3.tmp > diff-runex42_3.out 2> diff-runex42_3.out
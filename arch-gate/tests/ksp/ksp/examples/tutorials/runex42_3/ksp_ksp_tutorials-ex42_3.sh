@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex42 -stokes_ksp_converged_reason -stokes_pc_type fieldsplit -resolve  > ex42_3.tmp 2> runex42_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_3.out ex43_3.tmp > diff-runex43_3.out 2> diff-runex43_3.out
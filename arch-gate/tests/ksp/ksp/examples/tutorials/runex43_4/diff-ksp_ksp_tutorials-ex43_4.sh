@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_4.out ex43_4.tmp > diff-runex43_4.out 2> diff-runex43_4.out
@@ -0,0 +1 @@
+mpiexec  -n 9 ../ex43 -c_str 4 -jump_magnitude 3 -stokes_ksp_monitor_short -stokes_ksp_converged_reason -stokes_pc_type bddc -dm_mat_type is -stokes_pc_bddc_coarse_redundant_pc_type svd -stokes_pc_bddc_use_deluxe_scaling -stokes_sub_schurs_posdef 0 -stokes_sub_schurs_symmetric -stokes_sub_schurs_mat_solver_type petsc  > ex43_bddc_stokes_subdomainjump_deluxe.tmp 2> runex43_bddc_stokes_subdomainjump_deluxe.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex43 -stokes_ksp_rtol 1.e-4 -stokes_pc_type bjacobi -stokes_pc_bjacobi_blocks 2 -dm_mat_type baij -stokes_ksp_converged_reason  > ex43_bjacobi_baij.tmp 2> runex43_bjacobi_baij.err
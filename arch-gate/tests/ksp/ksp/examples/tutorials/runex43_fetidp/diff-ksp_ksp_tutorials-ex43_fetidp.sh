@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_fetidp.out ex43_fetidp.tmp > diff-runex43_fetidp.out 2> diff-runex43_fetidp.out
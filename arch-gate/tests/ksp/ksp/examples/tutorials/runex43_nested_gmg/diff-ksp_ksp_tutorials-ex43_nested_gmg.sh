@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex43_nested_gmg.out ex43_nested_gmg.tmp > diff-runex43_nested_gmg.out 2> diff-runex43_nested_gmg.out
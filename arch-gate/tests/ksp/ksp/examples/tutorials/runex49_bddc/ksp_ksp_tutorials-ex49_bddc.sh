@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex49 -elas_ksp_monitor_short -no_view -elas_ksp_converged_reason -elas_ksp_type cg -elas_ksp_norm_type natural -mx 22 -my 22 -dm_mat_type is -elas_pc_type bddc -elas_pc_bddc_monolithic  > ex49_bddc.tmp 2> runex49_bddc.err
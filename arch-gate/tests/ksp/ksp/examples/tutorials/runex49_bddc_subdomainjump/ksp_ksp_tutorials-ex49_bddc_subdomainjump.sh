@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex49 -mx 40 -my 40 -elas_ksp_monitor_short -no_view -c_str 2 -brick_E 1,1000 -brick_nu 0.4,0.2 -brick_span 20 -elas_ksp_type cg -elas_pc_type bddc -elas_pc_bddc_monolithic -dm_mat_type is -elas_pc_is_use_stiffness_scaling -elas_ksp_norm_type natural  > ex49_bddc_subdomainjump.tmp 2> runex49_bddc_subdomainjump.err
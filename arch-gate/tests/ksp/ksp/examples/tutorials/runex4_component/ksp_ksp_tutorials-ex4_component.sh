@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex4 -ksp_monitor -ksp_rtol 1e-6 -pc_type hmg -pc_hmg_coarsening_component 2 -pc_hmg_use_subspace_coarsening 1 -bs 4 -hmg_inner_pc_type gamg  > ex4_component.tmp 2> runex4_component.err
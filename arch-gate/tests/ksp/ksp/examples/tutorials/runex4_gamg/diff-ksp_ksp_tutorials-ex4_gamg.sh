@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex4_gamg.out ex4_gamg.tmp > diff-runex4_gamg.out 2> diff-runex4_gamg.out
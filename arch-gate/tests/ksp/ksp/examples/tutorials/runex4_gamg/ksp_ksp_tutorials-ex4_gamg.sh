@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex4 -ksp_monitor -pc_type hmg -ksp_rtol 1e-6 -hmg_inner_pc_type gamg  > ex4_gamg.tmp 2> runex4_gamg.err
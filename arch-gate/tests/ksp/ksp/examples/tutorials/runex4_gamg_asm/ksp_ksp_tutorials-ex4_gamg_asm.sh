@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex4 -ksp_monitor -pc_type hmg -ksp_rtol 1e-6 -hmg_inner_pc_type gamg -bs 4 -pc_hmg_use_subspace_coarsening 1 -mg_levels_1_pc_type asm  > ex4_gamg_asm.tmp 2> runex4_gamg_asm.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex4_gamg_bs4.out ex4_gamg_bs4.tmp > diff-runex4_gamg_bs4.out 2> diff-runex4_gamg_bs4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex4_reuse.out ex4_reuse.tmp > diff-runex4_reuse.out 2> diff-runex4_reuse.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex4 -ksp_monitor -ksp_rtol 1e-6 -pc_type hmg -pc_hmg_reuse_interpolation 1 -test_reuse_interpolation 1 -hmg_inner_pc_type gamg  > ex4_reuse.tmp 2> runex4_reuse.err
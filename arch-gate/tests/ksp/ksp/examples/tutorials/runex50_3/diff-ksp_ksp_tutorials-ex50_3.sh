@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex50_3.out ex50_3.tmp > diff-runex50_3.out 2> diff-runex50_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex50_tut_3.out ex50_tut_3.tmp > diff-runex50_tut_3.out 2> diff-runex50_tut_3.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex51 -ksp_monitor_short  > ex51_1.tmp 2> runex51_1.err
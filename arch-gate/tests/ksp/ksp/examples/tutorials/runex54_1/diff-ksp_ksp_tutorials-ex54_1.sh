@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex54_1.out ex54_1.tmp > diff-runex54_1.out 2> diff-runex54_1.out
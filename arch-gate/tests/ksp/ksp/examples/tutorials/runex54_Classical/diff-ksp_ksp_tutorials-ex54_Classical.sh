@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex54_classical.out ex54_Classical.tmp > diff-runex54_Classical.out 2> diff-runex54_Classical.out
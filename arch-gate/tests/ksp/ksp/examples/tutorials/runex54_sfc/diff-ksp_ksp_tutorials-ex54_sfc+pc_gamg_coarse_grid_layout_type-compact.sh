@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex54_sfc.out ex54_sfc.tmp > diff-runex54_sfc.out 2> diff-runex54_sfc.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex55_sa.out ex55_1.tmp > diff-runex55_1.out 2> diff-runex55_1.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex55 -ne 29 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_type classical -mg_levels_ksp_max_it 5 -ksp_converged_reason -mg_levels_esteig_ksp_type cg  > ex55_Classical.tmp 2> runex55_Classical.err
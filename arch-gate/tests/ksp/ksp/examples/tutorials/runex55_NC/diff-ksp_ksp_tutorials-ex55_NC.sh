@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex55_NC.out ex55_NC.tmp > diff-runex55_NC.out 2> diff-runex55_NC.out
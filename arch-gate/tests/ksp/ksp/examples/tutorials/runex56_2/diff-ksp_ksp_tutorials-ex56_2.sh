@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v variant' /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_2.out ex56_2.tmp > diff-runex56_2-0.out 2> diff-runex56_2-0.out || /root/repo/lib/petsc/bin/petscdiff  -F $'grep -v variant' /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_2_alt.out ex56_2.tmp > diff-runex56_2.out 2> diff-runex56_2.out
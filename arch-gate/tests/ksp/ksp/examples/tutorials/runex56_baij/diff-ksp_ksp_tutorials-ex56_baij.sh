@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_baij.out ex56_baij.tmp > diff-runex56_baij.out 2> diff-runex56_baij.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_baij_repartition.out ex56_baij_repartition.tmp > diff-runex56_baij_repartition.out 2> diff-runex56_baij_repartition.out
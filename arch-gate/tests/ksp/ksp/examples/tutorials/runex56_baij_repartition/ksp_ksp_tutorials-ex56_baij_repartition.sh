@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex56 -ne 11 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -mg_levels_ksp_type chebyshev -mg_levels_pc_type jacobi -mg_levels_esteig_ksp_type cg -pc_gamg_coarse_eq_limit 200 -pc_gamg_process_eq_limit 200 -pc_gamg_repartition -pc_gamg_mat_partitioning_type average -mat_type baij  > ex56_baij_repartition.tmp 2> runex56_baij_repartition.err
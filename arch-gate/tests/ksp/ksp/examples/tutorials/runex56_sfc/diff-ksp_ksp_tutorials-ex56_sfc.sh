@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex56_sfc.out ex56_sfc.tmp > diff-runex56_sfc.out 2> diff-runex56_sfc.out
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex56 -ne 13 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -pc_gamg_square_graph 1 -mg_levels_ksp_type chebyshev -mg_levels_pc_type jacobi -mg_levels_esteig_ksp_type cg -pc_gamg_coarse_eq_limit 200 -pc_gamg_process_eq_limit 200 -pc_gamg_repartition -pc_gamg_repartition_sfc -pc_gamg_coarse_grid_layout_type compact -pc_gamg_use_parallel_coarse_grid_solver -mg_coarse_pc_type jacobi -mg_coarse_ksp_type cg  > ex56_sfc.tmp 2> runex56_sfc.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex59 -nex 7 -physical_pc_bddc_coarse_eqs_per_proc 3 -physical_pc_bddc_switch_static  > ex59_bddc_fetidp_1.tmp 2> runex59_bddc_fetidp_1.err
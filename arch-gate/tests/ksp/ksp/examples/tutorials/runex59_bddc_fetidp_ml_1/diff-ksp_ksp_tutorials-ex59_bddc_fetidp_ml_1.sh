@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"' /root/repo/src/ksp/ksp/examples/tutorials/output/ex59_bddc_fetidp_ml_1.out ex59_bddc_fetidp_ml_1.tmp > diff-runex59_bddc_fetidp_ml_1.out 2> diff-runex59_bddc_fetidp_ml_1.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex59 -npx 2 -npy 2 -nex 6 -ney 6 -fluxes_ksp_max_it 10 -physical_ksp_max_it 10 -physical_ksp_view -physical_pc_bddc_levels 1 -physical_pc_bddc_coarsening_ratio 1  > ex59_bddc_fetidp_ml_1.tmp 2> runex59_bddc_fetidp_ml_1.err
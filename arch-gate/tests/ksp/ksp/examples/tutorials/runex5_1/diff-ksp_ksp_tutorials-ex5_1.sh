@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex5_1.out ex5_1.tmp > diff-runex5_1.out 2> diff-runex5_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -pc_type jacobi -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always  > ex5_1.tmp 2> runex5_1.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex5 -pc_type jacobi -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always -ksp_rtol .000001  > ex5_2.tmp 2> runex5_2.err
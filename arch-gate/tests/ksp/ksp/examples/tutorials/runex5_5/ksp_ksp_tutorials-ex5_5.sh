@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex5 -ksp_gmres_cgs_refinement_type refine_always -ksp_monitor_lg_residualnorm -ksp_monitor_lg_true_residualnorm  > ex5_5.tmp 2> runex5_5.err
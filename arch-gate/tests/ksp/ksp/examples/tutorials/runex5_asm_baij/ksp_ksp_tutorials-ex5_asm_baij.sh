@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex5 -pc_type asm -mat_type baij  > ex5_asm_baij.tmp 2> runex5_asm_baij.err
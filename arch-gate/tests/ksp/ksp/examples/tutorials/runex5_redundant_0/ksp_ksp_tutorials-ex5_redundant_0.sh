@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -m 1000 -pc_type redundant -pc_redundant_number 1 -redundant_ksp_type gmres -redundant_pc_type jacobi  > ex5_redundant_0.tmp 2> runex5_redundant_0.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex5_redundant_3.out ex5_redundant_3.tmp > diff-runex5_redundant_3.out 2> diff-runex5_redundant_3.out
@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex5 -pc_type redundant -pc_redundant_number 5 -redundant_ksp_type gmres -redundant_pc_type jacobi  > ex5_redundant_3.tmp 2> runex5_redundant_3.err
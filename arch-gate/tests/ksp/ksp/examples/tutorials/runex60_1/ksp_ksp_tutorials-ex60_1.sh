@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex60 -ksp_monitor_short -ksp_rtol 1e-6 -diagfunc 1 -ksp_type fcg -ksp_fcg_mmax 1 -eta 0.1  > ex60_1.tmp 2> runex60_1.err
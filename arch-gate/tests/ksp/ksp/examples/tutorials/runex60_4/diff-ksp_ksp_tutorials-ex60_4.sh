@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex60_4.out ex60_4.tmp > diff-runex60_4.out 2> diff-runex60_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex60_5.out ex60_5.tmp > diff-runex60_5.out 2> diff-runex60_5.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex66 -pc_type mg -pc_mg_type full -ksp_monitor_short -da_refine 3 -mg_coarse_pc_type svd -ksp_view  > ex66_1.tmp 2> runex66_1.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex66 -pc_type mg -pc_mg_type full -ksp_monitor_short -da_refine 3 -mg_coarse_pc_type redundant -mg_coarse_redundant_pc_type svd -ksp_view  > ex66_2.tmp 2> runex66_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed s/ATOL/RTOL/g' /root/repo/src/ksp/ksp/examples/tutorials/output/ex67_nonsymmetric_left.out ex67_nonsymmetric_left.tmp > diff-runex67_nonsymmetric_left.out 2> diff-runex67_nonsymmetric_left.out
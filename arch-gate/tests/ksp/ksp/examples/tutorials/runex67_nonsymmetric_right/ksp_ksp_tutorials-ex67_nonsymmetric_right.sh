@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex67 -symmetric false -ksp_view -ksp_converged_reason -pc_type jacobi -mat_no_inode -ksp_monitor_true_residual -ksp_rtol 1.e-14 -ksp_max_it 12 -ksp_pc_side right  > ex67_nonsymmetric_right.tmp 2> runex67_nonsymmetric_right.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed s/ATOL/RTOL/g' /root/repo/src/ksp/ksp/examples/tutorials/output/ex67_symmetric_right.out ex67_symmetric_right.tmp > diff-runex67_symmetric_right.out 2> diff-runex67_symmetric_right.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed s/ATOL/RTOL/g' /root/repo/src/ksp/ksp/examples/tutorials/output/ex67_transpose_asm.out ex67_transpose_asm.tmp > diff-runex67_transpose_asm.out 2> diff-runex67_transpose_asm.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex67 -symmetric false -ksp_monitor -ksp_view -pc_type asm -sub_pc_type lu -sub_pc_factor_zeropivot 1.e-33 -ksp_converged_reason  > ex67_transpose_asm.tmp 2> runex67_transpose_asm.err
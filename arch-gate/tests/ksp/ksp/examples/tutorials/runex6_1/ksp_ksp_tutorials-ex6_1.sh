@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex6 -num_numfac 2 -pc_type lu  > ex6_1.tmp 2> runex6_1.err
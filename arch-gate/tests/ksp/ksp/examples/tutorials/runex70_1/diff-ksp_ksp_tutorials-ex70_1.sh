@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v atomic' -f $'grep -v atomic' /root/repo/src/ksp/ksp/examples/tutorials/output/ex70_1.out ex70_1.tmp > diff-runex70_1.out 2> diff-runex70_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex70 -no_view  > ex70_1.tmp 2> runex70_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex70 -no_view -dm_mat_type is  > ex70_1_matis.tmp 2> runex70_1_matis.err
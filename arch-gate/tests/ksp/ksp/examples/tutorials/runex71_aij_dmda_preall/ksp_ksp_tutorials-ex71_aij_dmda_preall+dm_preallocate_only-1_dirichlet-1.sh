@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex71 -pde_type Poisson -dim 1 -cells 6 -pc_type none -ksp_converged_reason -dm_mat_type aij  -dm_preallocate_only 1 -dirichlet 1 > ex71_aij_dmda_preall.tmp 2> runex71_aij_dmda_preall.err
@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex71'
+testname='runex71_aijviennacl_dmda_preall'
+label='ksp_ksp_tutorials-ex71_aijviennacl_dmda_preall'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter='sed -e "s/CONVERGED_RTOL iterations 7/CONVERGED_RTOL iterations 6/g"'
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-pde_type Poisson -dim 1 -cells 6 -pc_type none -ksp_converged_reason -dm_mat_type aijviennacl'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    petsc_report_tapoutput "" "${label}" "SKIP PETSC_HAVE_VIENNACL requirement not met"
+    total=1; skip=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+nsize_in=${nsize:-2}
+dm_preallocate_only_in=${dm_preallocate_only:-0 1}
+dirichlet_in=${dirichlet:-0 1}
+
+
+for nsize in ${nsize_in}; do
+   for dm_preallocate_only in ${dm_preallocate_only_in}; do
+      for dirichlet in ${dirichlet_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -dm_preallocate_only ${dm_preallocate_only} -dirichlet ${dirichlet}" ex71_aijviennacl_dmda_preall.tmp ${testname}.err "${label}+dm_preallocate_only-${dm_preallocate_only}_dirichlet-${dirichlet}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_aij_dmda_preall.out ex71_aijviennacl_dmda_preall.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+dm_preallocate_only-${dm_preallocate_only}_dirichlet-${dirichlet} ""
+         else
+            petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex71 -pde_type Elasticity -cells 7,9,8 -dim 3 -ksp_view -pc_bddc_coarse_redundant_pc_type svd -ksp_error_if_not_converged -pc_bddc_monolithic  > ex71_bddc_elast.tmp 2> runex71_bddc_elast.err
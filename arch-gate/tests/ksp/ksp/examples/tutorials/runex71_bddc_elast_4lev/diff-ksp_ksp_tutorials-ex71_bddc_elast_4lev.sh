@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"' /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_bddc_elast_4lev.out ex71_bddc_elast_4lev.tmp > diff-runex71_bddc_elast_4lev.out 2> diff-runex71_bddc_elast_4lev.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN" | sed -e "s/iterations 1[0-9]/iterations 10/g"' /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_bddc_elast_neu_approx.out ex71_bddc_elast_neu_approx.tmp > diff-runex71_bddc_elast_neu_approx.out 2> diff-runex71_bddc_elast_neu_approx.out
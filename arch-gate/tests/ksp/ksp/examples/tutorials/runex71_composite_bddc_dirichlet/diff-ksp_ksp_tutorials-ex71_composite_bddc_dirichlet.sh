@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_composite_bddc_dirichlet.out ex71_composite_bddc_dirichlet.tmp > diff-runex71_composite_bddc_dirichlet.out 2> diff-runex71_composite_bddc_dirichlet.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_composite_bddc_lumped.out ex71_composite_bddc_lumped.tmp > diff-runex71_composite_bddc_lumped-0.out 2> diff-runex71_composite_bddc_lumped-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_composite_bddc_lumped_alt.out ex71_composite_bddc_lumped.tmp > diff-runex71_composite_bddc_lumped.out 2> diff-runex71_composite_bddc_lumped.out
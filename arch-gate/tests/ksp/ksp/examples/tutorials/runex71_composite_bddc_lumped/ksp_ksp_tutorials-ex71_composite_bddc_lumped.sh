@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex71 -dim 2 -cells 16,16 -periodicity 1,1 -random_initial_guess -random_real -sub_0_pc_bddc_switch_static -use_composite_pc -ksp_monitor -ksp_converged_reason -ksp_type gmres -ksp_view_singularvalues -ksp_view_eigenvalues -sub_0_pc_bddc_use_edges 0 -sub_0_pc_bddc_coarse_pc_type svd -sub_1_ksp_ksp_max_it 1 -sub_1_ksp_ksp_richardson_scale 2.3 -sub_0_pc_bddc_interface_ext_type lump  > ex71_composite_bddc_lumped.tmp 2> runex71_composite_bddc_lumped.err
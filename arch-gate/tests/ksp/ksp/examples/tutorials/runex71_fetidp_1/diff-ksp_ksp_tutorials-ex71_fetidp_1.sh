@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "variant HERMITIAN"' /root/repo/src/ksp/ksp/examples/tutorials/output/ex71_fetidp_1.out ex71_fetidp_1.tmp > diff-runex71_fetidp_1.out 2> diff-runex71_fetidp_1.out
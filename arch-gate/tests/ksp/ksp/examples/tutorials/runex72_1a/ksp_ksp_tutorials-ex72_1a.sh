@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex72 -f0 ${wPETSC_DIR}/share/petsc/datafiles/matrices/spd-real-int32-float64  > ex72_1a.tmp 2> runex72_1a.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex73_basic_dirichlet.out ex73_basic_dirichlet.tmp > diff-runex73_basic_dirichlet.out 2> diff-runex73_basic_dirichlet.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex73_mg_2lv_2mg.out ex73_mg_2lv_2mg.tmp > diff-runex73_mg_2lv_2mg-0.out 2> diff-runex73_mg_2lv_2mg-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex73_mg_2lv_2mg_alt.out ex73_mg_2lv_2mg.tmp > diff-runex73_mg_2lv_2mg.out 2> diff-runex73_mg_2lv_2mg.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_1.out ex74_1.tmp > diff-runex74_1-0.out 2> diff-runex74_1-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_1_alt.out ex74_1.tmp > diff-runex74_1-1.out 2> diff-runex74_1-1.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_1_alt_2.out ex74_1.tmp > diff-runex74_1-2.out 2> diff-runex74_1-2.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_1_alt_3.out ex74_1.tmp > diff-runex74_1-3.out 2> diff-runex74_1-3.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_1_alt_4.out ex74_1.tmp > diff-runex74_1.out 2> diff-runex74_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex74 -a 0.1 -dt .125 -niter 5 -imax 40 -ksp_monitor_short -pc_type pbjacobi -ksp_atol 1e-6 -irk_type gauss -irk_nstages 4 -ksp_gmres_restart 100  > ex74_2.tmp 2> runex74_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_3.out ex74_3.tmp > diff-runex74_3-0.out 2> diff-runex74_3-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_3_alt.out ex74_3.tmp > diff-runex74_3-1.out 2> diff-runex74_3-1.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_3_alt_2.out ex74_3.tmp > diff-runex74_3-2.out 2> diff-runex74_3-2.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/ksp/examples/tutorials/output/ex74_3_alt_3.out ex74_3.tmp > diff-runex74_3.out 2> diff-runex74_3.out
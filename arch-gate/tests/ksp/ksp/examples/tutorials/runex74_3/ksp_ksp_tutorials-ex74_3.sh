@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex74 -a 1 -dt .33 -niter 3 -imax 40 -ksp_monitor_short -pc_type pbjacobi -ksp_atol 1e-6 -irk_type gauss -irk_nstages 4 -ksp_gmres_restart 100 -physics_type advection  > ex74_3.tmp 2> runex74_3.err
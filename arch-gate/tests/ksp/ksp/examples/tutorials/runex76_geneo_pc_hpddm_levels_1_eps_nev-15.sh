@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex76'
+testname='runex76_geneo_pc_hpddm_levels_1_eps_nev-15'
+label='ksp_ksp_tutorials-ex76_geneo_pc_hpddm_levels_1_eps_nev-15'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-ksp_converged_reason -pc_type hpddm -pc_hpddm_levels_1_sub_pc_type cholesky -pc_hpddm_levels_1_st_pc_type cholesky -pc_hpddm_coarse_pc_type redundant -load_dir ${DATAFILESPATH}/matrices/hpddm/GENEO -pc_hpddm_levels_1_eps_nev 15'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    petsc_report_tapoutput "" "${label}" "SKIP PETSC_HAVE_HPDDM requirement not met, PETSC_HAVE_SLEPC requirement not met, Requires DATAFILESPATH"
+    total=1; skip=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+nsize_in=${nsize:-4}
+pc_hpddm_coarse_p_in=${pc_hpddm_coarse_p:-1 2}
+mat_type_in=${mat_type:-aij baij sbaij}
+
+
+for nsize in ${nsize_in}; do
+   for pc_hpddm_coarse_p in ${pc_hpddm_coarse_p_in}; do
+      for mat_type in ${mat_type_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -pc_hpddm_coarse_p ${pc_hpddm_coarse_p} -mat_type ${mat_type}" ex76_geneo_pc_hpddm_levels_1_eps_nev-15.tmp ${testname}.err "${label}+pc_hpddm_coarse_p-${pc_hpddm_coarse_p}_mat_type-${mat_type}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/ksp/ksp/examples/tutorials/output/ex76_geneo_pc_hpddm_levels_1_eps_nev-15.out ex76_geneo_pc_hpddm_levels_1_eps_nev-15.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+pc_hpddm_coarse_p-${pc_hpddm_coarse_p}_mat_type-${mat_type} ""
+         else
+            petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
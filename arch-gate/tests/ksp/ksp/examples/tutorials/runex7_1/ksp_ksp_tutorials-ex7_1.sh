@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex7 -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always> ex7_1.tmp 2>&1  > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex10   > ex10_1.tmp 2> runex10.err
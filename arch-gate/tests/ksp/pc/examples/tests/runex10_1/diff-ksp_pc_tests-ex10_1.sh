@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/pc/examples/tests/output/ex1_1.out ex10_1.tmp > diff-runex10_1.out 2> diff-runex10_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex10 -nblocks 3  > ex10_2.tmp 2> runex10_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/ksp/pc/examples/tests/output/ex2_1.out ex2_1.tmp > diff-runex2_1.out 2> diff-runex2_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -ksp_type cg -ksp_monitor_short  > ex2_1.tmp 2> runex2_1.err
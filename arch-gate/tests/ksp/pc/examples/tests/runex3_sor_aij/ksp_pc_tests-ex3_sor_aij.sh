@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -ksp_type gmres -ksp_monitor_short -pc_type sor -pc_sor_symmetric  > ex3_sor_aij.tmp 2> runex3_sor_aij.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex8 -ksp_rtol 1.e-10 -ptap_ksp_rtol 1.e-10 -ptap_pc_gamg_load_ptap  > ex8_1.tmp 2> runex8_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex8 -bs 2 -m 20 -ksp_rtol 1.e-10 -ptap_ksp_rtol 1.e-10 -ptap_pc_gamg_load_ptap -pc_gamg_threshold 0.01 -ptap_pc_gamg_threshold 0.01  > ex8_2.tmp 2> runex8_2.err
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex3 -n 100 -ksp_type cg -pc_type bjacobi -sub_pc_type icc -ksp_rtol 1.e-8  > ex3_1.tmp 2> runex3_1.err
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex3 -n 100 -ksp_type preonly -pc_type redistribute -redistribute_ksp_type cg -redistribute_pc_type bjacobi -redistribute_sub_pc_type icc -redistribute_ksp_rtol 1.e-8  > ex3_2.tmp 2> runex3_2.err
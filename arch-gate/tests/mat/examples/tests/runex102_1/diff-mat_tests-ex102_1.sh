@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex102_1.out ex102_1.tmp > diff-runex102_1.out 2> diff-runex102_1.out
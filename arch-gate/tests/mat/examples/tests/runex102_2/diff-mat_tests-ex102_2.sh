@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex102_2.out ex102_2.tmp > diff-runex102_2.out 2> diff-runex102_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex102_3.out ex102_3.tmp > diff-runex102_3.out 2> diff-runex102_3.out
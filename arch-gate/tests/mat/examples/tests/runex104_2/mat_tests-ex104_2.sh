@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex104   > ex104_2.tmp 2> runex104_2.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex104 -M 23 -N 31  > ex104_3.tmp 2> runex104_3.err
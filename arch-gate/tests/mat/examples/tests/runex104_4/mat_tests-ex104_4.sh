@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex104 -M 23 -N 31 -matmattransmult_mpidense_mpidense_via cyclic  > ex104_4.tmp 2> runex104_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex104.out ex104_5.tmp > diff-runex104_5.out 2> diff-runex104_5.out
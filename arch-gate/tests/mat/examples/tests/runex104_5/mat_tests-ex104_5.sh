@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex104 -M 23 -N 31 -matmattransmult_mpidense_mpidense_via allgatherv  > ex104_5.tmp 2> runex104_5.err
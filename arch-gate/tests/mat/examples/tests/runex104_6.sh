@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex104'
+testname='runex104_6'
+label='mat_tests-ex104_6'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter=''
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-M 23 -N 31'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-2 3}
+matmatmult_mpidense_mpidense_via_in=${matmatmult_mpidense_mpidense_via:-summa allgatherv}
+
+
+for nsize in ${nsize_in}; do
+   for matmatmult_mpidense_mpidense_via in ${matmatmult_mpidense_mpidense_via_in}; do
+
+      petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -matmatmult_mpidense_mpidense_via ${matmatmult_mpidense_mpidense_via}" ex104_6.tmp ${testname}.err "${label}+nsize-${nsize}matmatmult_mpidense_mpidense_via-${matmatmult_mpidense_mpidense_via}" 
+      res=$?
+
+      if test $res = 0; then
+         petsc_testrun "${diff_exe} /root/repo/src/mat/examples/tests/output/ex104.out ex104_6.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+nsize-${nsize}matmatmult_mpidense_mpidense_via-${matmatmult_mpidense_mpidense_via} ""
+      else
+         petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+      fi
+
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
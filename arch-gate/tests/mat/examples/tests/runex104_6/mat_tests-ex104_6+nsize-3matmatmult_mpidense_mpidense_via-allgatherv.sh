@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex104 -M 23 -N 31  -matmatmult_mpidense_mpidense_via allgatherv > ex104_6.tmp 2> runex104_6.err
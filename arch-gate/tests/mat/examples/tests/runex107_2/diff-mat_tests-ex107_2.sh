@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex107_2.out ex107_2.tmp > diff-runex107_2.out 2> diff-runex107_2.out
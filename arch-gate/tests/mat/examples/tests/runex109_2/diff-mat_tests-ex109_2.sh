@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex109.out ex109_2.tmp > diff-runex109_2.out 2> diff-runex109_2.out
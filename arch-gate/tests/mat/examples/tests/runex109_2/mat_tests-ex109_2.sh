@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex109   > ex109_2.tmp 2> runex109_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex11   > ex11_1.tmp 2> runex11.err
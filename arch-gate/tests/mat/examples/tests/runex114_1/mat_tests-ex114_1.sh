@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex114   > ex114_1.tmp 2> runex114_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex11_3.out ex11_3.tmp > diff-runex11_3.out 2> diff-runex11_3.out
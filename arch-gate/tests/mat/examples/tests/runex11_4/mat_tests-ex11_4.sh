@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex11 -keep_nonzero_pattern -mat_type seqbaij -mat_block_size 5  > ex11_4.tmp 2> runex11_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex122.out ex122_1.tmp > diff-runex122_1.out 2> diff-runex122_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex122   > ex122_1.tmp 2> runex122_1.err
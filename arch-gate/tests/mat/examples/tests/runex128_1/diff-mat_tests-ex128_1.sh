@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex128.out ex128_1.tmp > diff-runex128_1.out 2> diff-runex128_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex128_2.out ex128_2.tmp > diff-runex128_2.out 2> diff-runex128_2.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex128 -cholesky -triangular_solve  > ex128_2.tmp 2> runex128_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex129 -dm_mat_type aij -dof 1  > ex129_1.tmp 2> runex129_1.err
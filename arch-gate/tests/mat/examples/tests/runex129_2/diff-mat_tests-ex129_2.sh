@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex129.out ex129_2.tmp > diff-runex129_2.out 2> diff-runex129_2.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex12   > ex12_1.tmp 2> runex12_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "MPI processes"' /root/repo/src/mat/examples/tests/output/ex12_2.out ex12_2.tmp > diff-runex12_2.out 2> diff-runex12_2.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex12 -mat_type mpibaij -mat_block_size 3  > ex12_2.tmp 2> runex12_2.err
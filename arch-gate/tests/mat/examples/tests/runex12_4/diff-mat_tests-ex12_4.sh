@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "MPI processes"' /root/repo/src/mat/examples/tests/output/ex12_4.out ex12_4.tmp > diff-runex12_4.out 2> diff-runex12_4.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex132_1.out ex132_1.tmp > diff-runex132_1.out 2> diff-runex132_1.out
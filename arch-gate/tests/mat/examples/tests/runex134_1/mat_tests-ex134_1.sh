@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex134 -mat_ignore_lower_triangular -vecscatter_type sf  > ex134_1.tmp 2> runex134_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex135_1.out ex135_1.tmp > diff-runex135_1.out 2> diff-runex135_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex139   -blocked 1 -mat_type baij > ex139_1.tmp 2> runex139_1.err
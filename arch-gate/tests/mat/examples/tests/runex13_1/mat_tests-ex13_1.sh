@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex13   > ex13_1.tmp 2> runex13_1.err
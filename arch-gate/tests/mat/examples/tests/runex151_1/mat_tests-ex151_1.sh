@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex151 -view_sparse  > ex151_1.tmp 2> runex151_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex151_3.out ex151_3.tmp > diff-runex151_3.out 2> diff-runex151_3.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex159_1.out ex159_1.tmp > diff-runex159_1.out 2> diff-runex159_1.out
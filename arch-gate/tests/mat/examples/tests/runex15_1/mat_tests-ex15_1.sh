@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex15   > ex15_1.tmp 2> runex15_1.err
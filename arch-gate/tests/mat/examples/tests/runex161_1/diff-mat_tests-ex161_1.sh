@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex161.out ex161_1.tmp > diff-runex161_1.out 2> diff-runex161_1.out
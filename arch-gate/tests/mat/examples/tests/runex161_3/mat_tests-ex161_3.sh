@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex161 -matmattransmult_color -mat_no_inode -matden2sp_brows 3  > ex161_3.tmp 2> runex161_3.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex161 -matmattransmult_color -mat_no_inode -A_matrart_via matmattransposemult  > ex161_4.tmp 2> runex161_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex172.out ex172_1.tmp > diff-runex172_1.out 2> diff-runex172_1.out
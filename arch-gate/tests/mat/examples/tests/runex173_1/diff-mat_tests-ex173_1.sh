@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex173_1.out ex173_1.tmp > diff-runex173_1.out 2> diff-runex173_1.out
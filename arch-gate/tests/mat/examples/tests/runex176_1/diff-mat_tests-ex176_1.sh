@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex176_1.out ex176_1.tmp > diff-runex176_1.out 2> diff-runex176_1.out
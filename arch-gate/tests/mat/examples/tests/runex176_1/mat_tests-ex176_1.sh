@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex176   > ex176_1.tmp 2> runex176_1.err
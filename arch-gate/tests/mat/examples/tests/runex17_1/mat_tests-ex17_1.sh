@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex17   > ex17_1.tmp 2> runex17_1.err
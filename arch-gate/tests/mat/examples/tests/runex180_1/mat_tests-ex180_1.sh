@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex180 -mat_type aij -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -malloc_dump  > ex180_1.tmp 2> runex180_1.err
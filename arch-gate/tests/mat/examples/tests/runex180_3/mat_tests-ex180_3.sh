@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex180 -mat_type baij -f ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64 -malloc_dump  > ex180_3.tmp 2> runex180_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "Mat Object"' /root/repo/src/mat/examples/tests/output/ex181_1.out ex181_1.tmp > diff-runex181_1.out 2> diff-runex181_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex181   > ex181_1.tmp 2> runex181_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex181 -detect_bug  > ex181_2.tmp 2> runex181_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex182 -info  > ex182_1.tmp 2> runex182_1.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex182 -info ex182info  > ex182_2.tmp 2> runex182_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex182 -info -mat_type baij  > ex182_3.tmp 2> runex182_3.err
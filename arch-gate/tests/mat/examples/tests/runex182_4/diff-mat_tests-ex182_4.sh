@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -h malloc "ex182info.1" | sort -b' /root/repo/src/mat/examples/tests/output/ex182_4.out ex182_4.tmp > diff-runex182_4.out 2> diff-runex182_4.out
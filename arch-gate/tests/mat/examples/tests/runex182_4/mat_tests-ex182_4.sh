@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex182 -info ex182info -mat_type baij  > ex182_4.tmp 2> runex182_4.err
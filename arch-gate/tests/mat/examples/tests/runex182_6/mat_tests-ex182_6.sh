@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex182 -info ex182info -mat_type sbaij  > ex182_6.tmp 2> runex182_6.err
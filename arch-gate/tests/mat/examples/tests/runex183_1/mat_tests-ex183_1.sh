@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex183 -total_subdomains 1  > ex183_1.tmp 2> runex183_1.err
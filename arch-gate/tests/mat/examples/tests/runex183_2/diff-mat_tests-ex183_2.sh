@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex183_3_2.out ex183_2.tmp > diff-runex183_2.out 2> diff-runex183_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex183_4_2.out ex183_3.tmp > diff-runex183_3.out 2> diff-runex183_3.out
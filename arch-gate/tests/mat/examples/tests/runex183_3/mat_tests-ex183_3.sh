@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex183 -total_subdomains 2  > ex183_3.tmp 2> runex183_3.err
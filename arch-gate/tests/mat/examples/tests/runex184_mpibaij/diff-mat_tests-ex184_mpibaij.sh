@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex184_mpibaij.out ex184_mpibaij.tmp > diff-runex184_mpibaij.out 2> diff-runex184_mpibaij.out
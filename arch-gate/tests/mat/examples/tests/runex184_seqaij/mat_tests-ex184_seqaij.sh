@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex184 -mat_type seqaij -mat_size 12 -mat_block_size 3  > ex184_seqaij.tmp 2> runex184_seqaij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex185_1.out ex185_1.tmp > diff-runex185_1-0.out 2> diff-runex185_1-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex185_1_alt.out ex185_1.tmp > diff-runex185_1.out 2> diff-runex185_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex185   > ex185_1.tmp 2> runex185_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex18   > ex18_0.tmp 2> runex18_0.err
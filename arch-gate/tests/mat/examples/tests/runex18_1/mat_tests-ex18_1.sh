@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex18   > ex18_1.tmp 2> runex18_1.err
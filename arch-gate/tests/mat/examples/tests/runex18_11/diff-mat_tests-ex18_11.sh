@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_11.out ex18_11.tmp > diff-runex18_11.out 2> diff-runex18_11.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_14.out ex18_14.tmp > diff-runex18_14.out 2> diff-runex18_14.out
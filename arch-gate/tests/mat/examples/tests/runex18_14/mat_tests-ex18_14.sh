@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex18 -bs 2 -nonlocal_bc -mat_type baij  > ex18_14.tmp 2> runex18_14.err
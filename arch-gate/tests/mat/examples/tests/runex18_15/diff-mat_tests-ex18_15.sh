@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_15.out ex18_15.tmp > diff-runex18_15.out 2> diff-runex18_15.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_16.out ex18_16.tmp > diff-runex18_16.out 2> diff-runex18_16.out
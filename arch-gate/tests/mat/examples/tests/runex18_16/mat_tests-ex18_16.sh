@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex18 -bs 2 -nonlocal_bc -convname shell  > ex18_16.tmp 2> runex18_16.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_17.out ex18_17.tmp > diff-runex18_17.out 2> diff-runex18_17.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex18 -bs 2 -nonlocal_bc -convname dense  > ex18_17.tmp 2> runex18_17.err
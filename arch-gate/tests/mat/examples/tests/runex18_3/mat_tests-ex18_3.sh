@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex18 -mat_type baij  > ex18_3.tmp 2> runex18_3.err
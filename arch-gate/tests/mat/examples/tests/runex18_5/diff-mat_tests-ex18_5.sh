@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_5.out ex18_5.tmp > diff-runex18_5.out 2> diff-runex18_5.out
@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex18 -mat_type baij  > ex18_5.tmp 2> runex18_5.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_8.out ex18_8.tmp > diff-runex18_8.out 2> diff-runex18_8.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_full_nsize-1_diag--0.13_convname-aij.out ex18_full_nsize-1_diag--0.13_convname-aij.tmp > diff-runex18_full_nsize-1_diag--0.13_convname-aij.out 2> diff-runex18_full_nsize-1_diag--0.13_convname-aij.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex18 -zerorhs 0 -diag -0.13 -convname aij  > ex18_full_nsize-1_diag--0.13_convname-aij.tmp 2> runex18_full_nsize-1_diag--0.13_convname-aij.err
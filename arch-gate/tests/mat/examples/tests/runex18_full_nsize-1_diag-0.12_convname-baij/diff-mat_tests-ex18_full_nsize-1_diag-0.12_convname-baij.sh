@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex18_full_nsize-1_diag-0.12_convname-baij.out ex18_full_nsize-1_diag-0.12_convname-baij.tmp > diff-runex18_full_nsize-1_diag-0.12_convname-baij.out 2> diff-runex18_full_nsize-1_diag-0.12_convname-baij.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex18 -zerorhs 0 -diag -0.13 -convname shell  > ex18_full_nsize-3_diag--0.13_convname-shell.tmp 2> runex18_full_nsize-3_diag--0.13_convname-shell.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex18 -zerorhs 0 -diag 0.12 -convname aij  > ex18_full_nsize-3_diag-0.12_convname-aij.tmp 2> runex18_full_nsize-3_diag-0.12_convname-aij.err
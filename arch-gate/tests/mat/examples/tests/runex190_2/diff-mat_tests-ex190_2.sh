@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex190_2.out ex190_2.tmp > diff-runex190_2.out 2> diff-runex190_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v alloced' /root/repo/src/mat/examples/tests/output/ex191_1.out ex191_1.tmp > diff-runex191_1.out 2> diff-runex191_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex191 -vecscatter_type sf  > ex191_1.tmp 2> runex191_1.err
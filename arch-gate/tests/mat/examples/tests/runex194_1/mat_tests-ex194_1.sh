@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex194   > ex194_1.tmp 2> runex194_1.err
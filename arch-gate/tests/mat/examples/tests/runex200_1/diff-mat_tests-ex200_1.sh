@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex200_1.out ex200_1.tmp > diff-runex200_1.out 2> diff-runex200_1.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex202_1.out ex202_1.tmp > diff-runex202_1.out 2> diff-runex202_1.out
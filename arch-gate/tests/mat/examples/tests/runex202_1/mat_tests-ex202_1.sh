@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex202 -malloc_dump  > ex202_1.tmp 2> runex202_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex203 -malloc_dump  > ex203_1.tmp 2> runex203_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex205 -malloc_dump  > ex205_1.tmp 2> runex205_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex208_2.out ex208_2.tmp > diff-runex208_2.out 2> diff-runex208_2.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex208   > ex208_2.tmp 2> runex208_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex208 -mat_type baij  > ex208_baij.tmp 2> runex208_baij.err
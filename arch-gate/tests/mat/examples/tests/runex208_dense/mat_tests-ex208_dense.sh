@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex208 -mat_type dense  > ex208_dense.tmp 2> runex208_dense.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex208 -mat_type dense  > ex208_dense_2.tmp 2> runex208_dense_2.err
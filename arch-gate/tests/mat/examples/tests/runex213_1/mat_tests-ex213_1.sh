@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex213   > ex213_1.tmp 2> runex213_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex215 -hermitian_solve  > ex215_herm.tmp 2> runex215_herm.err
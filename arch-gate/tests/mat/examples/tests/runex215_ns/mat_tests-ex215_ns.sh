@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex215   > ex215_ns.tmp 2> runex215_ns.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex215 -symmetric_solve  > ex215_sym.tmp 2> runex215_sym.err
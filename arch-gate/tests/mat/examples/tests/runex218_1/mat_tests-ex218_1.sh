@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex218 -mat_shell_test_mult_view -mat_shell_test_mult_transpose_view  > ex218_1.tmp 2> runex218_1.err
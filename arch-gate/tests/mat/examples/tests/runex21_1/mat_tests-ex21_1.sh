@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex21 -mat_type seqaij  > ex21_1.tmp 2> runex21_1.err
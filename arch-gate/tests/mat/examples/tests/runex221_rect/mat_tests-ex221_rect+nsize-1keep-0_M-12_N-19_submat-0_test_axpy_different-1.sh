@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex221 -loop 3  -keep 0 -M 12 -N 19 -submat 0 -test_axpy_different 1 > ex221_rect.tmp 2> runex221_rect.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex221 -loop 3  -keep 0 -M 19 -N 12 -submat 1 -test_axpy_different 0 > ex221_rect.tmp 2> runex221_rect.err
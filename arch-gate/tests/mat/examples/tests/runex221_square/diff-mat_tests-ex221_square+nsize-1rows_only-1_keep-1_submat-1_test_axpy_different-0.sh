@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex221_1.out ex221_square.tmp > diff-runex221_square.out 2> diff-runex221_square.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex221 -M 21 -N 21 -loop 4  -rows_only 1 -keep 1 -submat 1 -test_axpy_different 0 > ex221_square.tmp 2> runex221_square.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex222   > ex222_1.tmp 2> runex222_1.err
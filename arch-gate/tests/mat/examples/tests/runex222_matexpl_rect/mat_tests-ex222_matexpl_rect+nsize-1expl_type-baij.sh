@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex222   -expl_type baij > ex222_matexpl_rect.tmp 2> runex222_matexpl_rect.err
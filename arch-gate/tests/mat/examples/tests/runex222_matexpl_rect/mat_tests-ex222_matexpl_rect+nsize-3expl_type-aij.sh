@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex222   -expl_type aij > ex222_matexpl_rect.tmp 2> runex222_matexpl_rect.err
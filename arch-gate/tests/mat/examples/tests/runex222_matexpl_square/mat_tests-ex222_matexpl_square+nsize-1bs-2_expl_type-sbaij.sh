@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex222 -M 36 -N 36  -bs 2 -expl_type sbaij > ex222_matexpl_square.tmp 2> runex222_matexpl_square.err
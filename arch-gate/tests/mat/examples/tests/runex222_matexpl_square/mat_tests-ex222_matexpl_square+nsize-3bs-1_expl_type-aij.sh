@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex222 -M 36 -N 36  -bs 1 -expl_type aij > ex222_matexpl_square.tmp 2> runex222_matexpl_square.err
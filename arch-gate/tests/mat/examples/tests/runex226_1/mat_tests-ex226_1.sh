@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex226 -m 8 -n 8 -stencil 2d5point -matmatmult_via combined  > ex226_1.tmp 2> runex226_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex226_2.out ex226_2.tmp > diff-runex226_2.out 2> diff-runex226_2.out
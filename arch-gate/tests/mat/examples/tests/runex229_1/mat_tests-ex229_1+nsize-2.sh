@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex229   > ex229_1.tmp 2> runex229_1.err
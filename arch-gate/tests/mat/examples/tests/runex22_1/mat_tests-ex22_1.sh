@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex22   > ex22_1.tmp 2> runex22_1.err
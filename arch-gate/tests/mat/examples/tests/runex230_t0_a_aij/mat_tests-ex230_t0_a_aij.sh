@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex230 -test_id 0 -mat_type aij  > ex230_t0_a_aij.tmp 2> runex230_t0_a_aij.err
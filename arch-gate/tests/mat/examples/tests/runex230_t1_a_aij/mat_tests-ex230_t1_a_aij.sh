@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex230 -test_id 1 -mat_type aij  > ex230_t1_a_aij.tmp 2> runex230_t1_a_aij.err
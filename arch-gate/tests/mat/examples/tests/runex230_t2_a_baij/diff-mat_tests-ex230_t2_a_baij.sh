@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex230_t2_a_baij.out ex230_t2_a_baij.tmp > diff-runex230_t2_a_baij.out 2> diff-runex230_t2_a_baij.out
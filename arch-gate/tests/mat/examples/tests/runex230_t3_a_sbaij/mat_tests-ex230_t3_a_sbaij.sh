@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex230 -test_id 1 -mat_type sbaij  > ex230_t3_a_sbaij.tmp 2> runex230_t3_a_sbaij.err
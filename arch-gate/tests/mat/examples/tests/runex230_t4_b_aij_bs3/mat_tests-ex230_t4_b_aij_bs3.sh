@@ -0,0 +1 @@
+mpiexec  -n 6 ../ex230 -test_id 1 -mat_type aij -block_size 3  > ex230_t4_b_aij_bs3.tmp 2> runex230_t4_b_aij_bs3.err
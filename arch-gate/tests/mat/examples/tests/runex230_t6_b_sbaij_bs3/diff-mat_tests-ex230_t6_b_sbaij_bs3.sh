@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v Mat_' /root/repo/src/mat/examples/tests/output/ex230_t6_b_sbaij_bs3.out ex230_t6_b_sbaij_bs3.tmp > diff-runex230_t6_b_sbaij_bs3.out 2> diff-runex230_t6_b_sbaij_bs3.out
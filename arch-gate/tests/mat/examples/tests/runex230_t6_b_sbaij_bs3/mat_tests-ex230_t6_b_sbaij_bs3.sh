@@ -0,0 +1 @@
+mpiexec  -n 6 ../ex230 -test_id 1 -mat_type sbaij -block_size 3  > ex230_t6_b_sbaij_bs3.tmp 2> runex230_t6_b_sbaij_bs3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed "s?\.??g"' /root/repo/src/mat/examples/tests/output/ex232_1.out ex232_1.tmp > diff-runex232_1.out 2> diff-runex232_1.out
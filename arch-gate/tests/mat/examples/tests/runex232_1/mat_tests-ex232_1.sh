@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex232   > ex232_1.tmp 2> runex232_1.err
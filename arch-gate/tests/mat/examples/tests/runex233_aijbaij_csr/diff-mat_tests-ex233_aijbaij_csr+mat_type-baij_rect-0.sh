@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type | sed -e "s/\.//g"' /root/repo/src/mat/examples/tests/output/ex233_aijbaij_csr.out ex233_aijbaij_csr.tmp > diff-runex233_aijbaij_csr.out 2> diff-runex233_aijbaij_csr.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex233 -view  -mat_type aij -rect 1 > ex233_aijbaij_csr.tmp 2> runex233_aijbaij_csr.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex233 -mat_type sbaij -view  -rect 1 > ex233_sbaij_csr.tmp 2> runex233_sbaij_csr.err
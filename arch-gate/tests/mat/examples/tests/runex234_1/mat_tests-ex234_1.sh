@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex234   > ex234_1.tmp 2> runex234_1.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex235   > ex235_1.tmp 2> runex235_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex236 -mat_type aij  > ex236_1.tmp 2> runex236_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex236_1.out ex236_2.tmp > diff-runex236_2.out 2> diff-runex236_2.out
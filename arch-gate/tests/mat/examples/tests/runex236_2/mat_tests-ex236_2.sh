@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex236 -mat_type baij  > ex236_2.tmp 2> runex236_2.err
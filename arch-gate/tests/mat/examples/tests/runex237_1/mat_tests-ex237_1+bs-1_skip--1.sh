@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex237   -bs 1 -skip -1 > ex237_1.tmp 2> runex237_1.err
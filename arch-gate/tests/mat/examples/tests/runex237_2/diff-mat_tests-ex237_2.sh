@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex237_1.out ex237_2.tmp > diff-runex237_2.out 2> diff-runex237_2.out
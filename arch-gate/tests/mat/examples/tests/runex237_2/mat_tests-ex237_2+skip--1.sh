@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex237 -mat_no_inode -bs 2 -nthreads 4  -skip -1 > ex237_2.tmp 2> runex237_2.err
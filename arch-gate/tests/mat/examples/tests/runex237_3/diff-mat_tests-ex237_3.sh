@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex237_1.out ex237_3.tmp > diff-runex237_3.out 2> diff-runex237_3.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex237 -mat_seqaij_num_threads 2 -nthreads 5 -n 7  > ex237_3.tmp 2> runex237_3.err
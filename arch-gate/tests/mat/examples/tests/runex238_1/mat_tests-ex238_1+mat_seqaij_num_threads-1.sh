@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex238   -mat_seqaij_num_threads 1 > ex238_1.tmp 2> runex238_1.err
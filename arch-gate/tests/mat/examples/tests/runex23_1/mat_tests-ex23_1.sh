@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex23 -test_trans  > ex23_1.tmp 2> runex23_1.err
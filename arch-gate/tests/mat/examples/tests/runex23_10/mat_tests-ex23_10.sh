@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex23 -m 12 -n 12 -test_trans -nr 2 -nc 3 -diffmap -permmap  > ex23_10.tmp 2> runex23_10.err
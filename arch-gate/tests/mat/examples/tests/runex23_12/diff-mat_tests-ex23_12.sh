@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex23_12.out ex23_12.tmp > diff-runex23_12.out 2> diff-runex23_12.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex23 -m 12 -n 12 -symmetric -matis_localmat_type sbaij -test_trans -nr 2 -nc 3  > ex23_12.tmp 2> runex23_12.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex23 -matis_convert_local_nest -nr 3 -nc 4  > ex23_2.tmp 2> runex23_2.err
@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex23 -m 11 -n 10 -matis_convert_local_nest -nr 2 -nc 1  > ex23_3.tmp 2> runex23_3.err
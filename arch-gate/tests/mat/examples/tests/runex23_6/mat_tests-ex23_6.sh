@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex23 -m 12 -n 12 -test_trans -nr 2 -nc 3 -diffmap  > ex23_6.tmp 2> runex23_6.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex23 -m 12 -n 17 -test_trans -nr 2 -nc 3 -permmap  > ex23_8.tmp 2> runex23_8.err
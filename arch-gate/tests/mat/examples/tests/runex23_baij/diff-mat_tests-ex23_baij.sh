@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type:"' /root/repo/src/mat/examples/tests/output/ex23_13.out ex23_baij.tmp > diff-runex23_baij.out 2> diff-runex23_baij.out
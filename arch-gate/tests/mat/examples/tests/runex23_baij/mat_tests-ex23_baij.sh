@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex23 -m 12 -n 17 -test_trans -nr 2 -nc 3 -diffmap -permmap -matis_localmat_type baij  > ex23_baij.tmp 2> runex23_baij.err
@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex23 -m 12 -n 17 -test_trans -nr 2 -nc 3 -permmap  > ex23_vscat_default.tmp 2> runex23_vscat_default.err
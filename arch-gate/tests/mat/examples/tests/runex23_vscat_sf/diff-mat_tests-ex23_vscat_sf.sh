@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex23_11.out ex23_vscat_sf.tmp > diff-runex23_vscat_sf.out 2> diff-runex23_vscat_sf.out
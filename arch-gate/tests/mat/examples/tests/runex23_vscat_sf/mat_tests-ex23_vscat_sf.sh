@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex23 -m 12 -n 17 -test_trans -nr 2 -nc 3 -permmap -vecscatter_type sf  > ex23_vscat_sf.tmp 2> runex23_vscat_sf.err
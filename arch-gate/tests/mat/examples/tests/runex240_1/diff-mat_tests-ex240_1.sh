@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex240_1.out ex240_1.tmp > diff-runex240_1.out 2> diff-runex240_1.out
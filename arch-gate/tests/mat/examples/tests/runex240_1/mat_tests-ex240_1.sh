@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex240   > ex240_1.tmp 2> runex240_1.err
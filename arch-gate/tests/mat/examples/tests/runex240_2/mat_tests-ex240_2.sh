@@ -0,0 +1 @@
+mpiexec  -n 5 ../ex240   > ex240_2.tmp 2> runex240_2.err
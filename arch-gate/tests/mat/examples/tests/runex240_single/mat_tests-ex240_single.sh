@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex240 -single_block  > ex240_single.tmp 2> runex240_single.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex240 -two_block  > ex240_two.tmp 2> runex240_two.err
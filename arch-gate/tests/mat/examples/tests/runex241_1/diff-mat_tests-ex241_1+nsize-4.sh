@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex241_1.out ex241_1.tmp > diff-runex241_1.out 2> diff-runex241_1.out
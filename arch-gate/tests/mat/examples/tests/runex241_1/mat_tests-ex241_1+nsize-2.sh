@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex241   > ex241_1.tmp 2> runex241_1.err
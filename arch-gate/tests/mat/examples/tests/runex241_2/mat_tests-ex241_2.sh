@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex241 -M 13 -N 9  > ex241_2.tmp 2> runex241_2.err
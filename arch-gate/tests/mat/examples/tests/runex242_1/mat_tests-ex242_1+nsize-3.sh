@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex242   > ex242_1.tmp 2> runex242_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex242_1.out ex242_2.tmp > diff-runex242_2.out 2> diff-runex242_2.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex242 -M 13 -N 9  > ex242_2.tmp 2> runex242_2.err
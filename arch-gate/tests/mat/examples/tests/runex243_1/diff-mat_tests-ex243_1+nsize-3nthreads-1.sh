@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex243_1.out ex243_1.tmp > diff-runex243_1.out 2> diff-runex243_1.out
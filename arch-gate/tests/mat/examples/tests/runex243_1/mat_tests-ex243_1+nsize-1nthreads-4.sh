@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex243   -nthreads 4 > ex243_1.tmp 2> runex243_1.err
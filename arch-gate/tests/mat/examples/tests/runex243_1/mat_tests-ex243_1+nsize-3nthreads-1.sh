@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex243   -nthreads 1 > ex243_1.tmp 2> runex243_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex243 -m 33  -matptap_via nonscalable > ex243_2.tmp 2> runex243_2.err
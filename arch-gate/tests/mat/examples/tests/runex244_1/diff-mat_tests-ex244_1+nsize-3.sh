@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex244_1.out ex244_1.tmp > diff-runex244_1.out 2> diff-runex244_1.out
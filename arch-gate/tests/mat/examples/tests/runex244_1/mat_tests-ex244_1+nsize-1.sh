@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex244   > ex244_1.tmp 2> runex244_1.err
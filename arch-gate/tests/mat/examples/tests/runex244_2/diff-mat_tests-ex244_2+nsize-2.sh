@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex244_2.out ex244_2.tmp > diff-runex244_2.out 2> diff-runex244_2.out
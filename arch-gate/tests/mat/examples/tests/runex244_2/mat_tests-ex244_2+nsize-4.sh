@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex244 -bs 2 -cbs 3 -m 10  > ex244_2.tmp 2> runex244_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex24 -mat_coloring_type sl  > ex24_sl.tmp 2> runex24_sl.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex26_1.out ex26_1.tmp > diff-runex26.out 2> diff-runex26.out
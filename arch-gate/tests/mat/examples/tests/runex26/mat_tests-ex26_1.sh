@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex26   > ex26_1.tmp 2> runex26.err
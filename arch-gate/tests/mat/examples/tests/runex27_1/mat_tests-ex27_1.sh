@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex27   > ex27_1.tmp 2> runex27_1.err
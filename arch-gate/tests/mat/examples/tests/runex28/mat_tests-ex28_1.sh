@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex28   > ex28_1.tmp 2> runex28.err
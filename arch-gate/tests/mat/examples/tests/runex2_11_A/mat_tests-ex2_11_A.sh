@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -mat_type seqaij -rectA  > ex2_11_A.tmp 2> runex2_11_A.err
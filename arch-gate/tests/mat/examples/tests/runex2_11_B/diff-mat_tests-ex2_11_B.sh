@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "Mat Object"' /root/repo/src/mat/examples/tests/output/ex2_11_B.out ex2_11_B.tmp > diff-runex2_11_B.out 2> diff-runex2_11_B.out
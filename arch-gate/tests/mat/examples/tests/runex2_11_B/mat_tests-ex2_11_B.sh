@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -mat_type seqaij -rectB  > ex2_11_B.tmp 2> runex2_11_B.err
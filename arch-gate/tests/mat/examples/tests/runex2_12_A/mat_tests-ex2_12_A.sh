@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2 -mat_type seqdense -rectA  > ex2_12_A.tmp 2> runex2_12_A.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex2 -mat_type mpiaij  > ex2_23.tmp 2> runex2_23.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex2 -mat_type mpidense  > ex2_24.tmp 2> runex2_24.err
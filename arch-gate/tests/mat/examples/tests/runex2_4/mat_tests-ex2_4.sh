@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -mat_type mpidense -rectA  > ex2_4.tmp 2> runex2_4.err
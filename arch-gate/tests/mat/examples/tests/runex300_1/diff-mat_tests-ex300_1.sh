@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex300_1.out ex300_1.tmp > diff-runex300_1.out 2> diff-runex300_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex300   > ex300_1.tmp 2> runex300_1.err
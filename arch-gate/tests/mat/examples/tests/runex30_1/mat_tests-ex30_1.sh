@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex30 -mat_ordering -display_matrices -nox  > ex30_1.tmp 2> runex30_1.err
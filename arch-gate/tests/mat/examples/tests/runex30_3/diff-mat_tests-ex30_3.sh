@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex30_3.out ex30_3.tmp > diff-runex30_3.out 2> diff-runex30_3.out
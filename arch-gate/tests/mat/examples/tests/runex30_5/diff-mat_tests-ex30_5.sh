@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex30_5.out ex30_5.tmp > diff-runex30_5.out 2> diff-runex30_5.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex30 -lu  > ex30_5.tmp 2> runex30_5.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex30 -lu -triangular_solve  > ex30_6.tmp 2> runex30_6.err
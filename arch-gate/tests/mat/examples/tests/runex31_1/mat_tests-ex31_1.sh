@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex31   > ex31_1.tmp 2> runex31_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex33.out ex33_1.tmp > diff-runex33_1.out 2> diff-runex33_1.out
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex33   > ex33_2.tmp 2> runex33_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex33 -test_mpiderivedtype  > ex33_3.tmp 2> runex33_3.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex34   > ex34_1.tmp 2> runex34_1.err
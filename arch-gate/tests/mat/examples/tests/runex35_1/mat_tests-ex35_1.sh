@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex35   > ex35_1.tmp 2> runex35_1.err
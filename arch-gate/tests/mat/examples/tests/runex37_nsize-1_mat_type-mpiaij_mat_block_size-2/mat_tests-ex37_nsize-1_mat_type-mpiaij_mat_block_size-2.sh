@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex37 -view ::ascii_info -mat_type mpiaij -mat_block_size 2  > ex37_nsize-1_mat_type-mpiaij_mat_block_size-2.tmp 2> runex37_nsize-1_mat_type-mpiaij_mat_block_size-2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex37 -view ::ascii_info -mat_type baij -mat_block_size 1  > ex37_nsize-2_mat_type-baij_mat_block_size-1.tmp 2> runex37_nsize-2_mat_type-baij_mat_block_size-1.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex37 -view ::ascii_info -mat_type mpisbaij -mat_block_size 2  > ex37_nsize-2_mat_type-mpisbaij_mat_block_size-2.tmp 2> runex37_nsize-2_mat_type-mpisbaij_mat_block_size-2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex48   -mat_block_size 6 > ex48_1.tmp 2> runex48_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex49_r1.out ex49_r1_inplace.tmp > diff-runex49_r1_inplace.out 2> diff-runex49_r1_inplace.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex4 -mat_type aij  > ex4_3.tmp 2> runex4_3.err
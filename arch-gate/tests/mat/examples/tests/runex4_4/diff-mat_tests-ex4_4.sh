@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex4_4.out ex4_4.tmp > diff-runex4_4.out 2> diff-runex4_4.out
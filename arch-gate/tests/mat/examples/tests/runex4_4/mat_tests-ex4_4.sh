@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex4 -mat_type dense  > ex4_4.tmp 2> runex4_4.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex4 -mat_type aij -test_all  > ex4_5.tmp 2> runex4_5.err
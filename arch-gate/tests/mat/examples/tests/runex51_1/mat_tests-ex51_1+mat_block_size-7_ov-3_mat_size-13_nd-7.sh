@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex51   -mat_block_size 7 -ov 3 -mat_size 13 -nd 7 > ex51_1.tmp 2> runex51_1.err
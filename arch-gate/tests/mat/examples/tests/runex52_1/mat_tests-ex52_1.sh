@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex52 -mat_block_size 2 -test_setvaluesblocked  > ex52_1.tmp 2> runex52_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex52 -mat_block_size 1 -test_setvaluesblocked  > ex52_3.tmp 2> runex52_3.err
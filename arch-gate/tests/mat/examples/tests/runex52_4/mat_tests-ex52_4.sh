@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex52 -mat_block_size 1 -test_setvaluesblocked -column_oriented  > ex52_4.tmp 2> runex52_4.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex54   -mat_block_size 6 -ov 1 -mat_size 11 -nd 7 > ex54_1.tmp 2> runex54_1.err
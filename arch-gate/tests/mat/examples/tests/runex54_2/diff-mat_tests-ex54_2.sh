@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex54.out ex54_2.tmp > diff-runex54_2.out 2> diff-runex54_2.out
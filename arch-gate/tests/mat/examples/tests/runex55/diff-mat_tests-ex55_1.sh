@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex55_1.out ex55_1.tmp > diff-runex55.out 2> diff-runex55.out
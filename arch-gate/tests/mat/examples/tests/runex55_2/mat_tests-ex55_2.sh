@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex55   > ex55_2.tmp 2> runex55_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex56   > ex56_1.tmp 2> runex56_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex56 -ass_extern  > ex56_4.tmp 2> runex56_4.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex56 -ass_extern -zero_rows  > ex56_5.tmp 2> runex56_5.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex58   > ex58_1.tmp 2> runex58.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex58   > ex58_2.tmp 2> runex58_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex59_1.out ex59_1.tmp > diff-runex59.out 2> diff-runex59.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex59   > ex59_2.tmp 2> runex59_2.err
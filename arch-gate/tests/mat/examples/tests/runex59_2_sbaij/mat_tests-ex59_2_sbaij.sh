@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex59 -mat_type sbaij  > ex59_2_sbaij.tmp 2> runex59_2_sbaij.err
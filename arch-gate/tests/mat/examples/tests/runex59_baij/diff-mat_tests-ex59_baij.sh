@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex59_1_baij.out ex59_baij.tmp > diff-runex59_baij.out 2> diff-runex59_baij.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex59 -mat_type baij  > ex59_baij.tmp 2> runex59_baij.err
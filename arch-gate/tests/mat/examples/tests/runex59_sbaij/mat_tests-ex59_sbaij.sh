@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex59 -mat_type sbaij  > ex59_sbaij.tmp 2> runex59_sbaij.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type seqaij -rectB  > ex5_11_B.tmp 2> runex5_11_B.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type seqdense -rectA  > ex5_12_A.tmp 2> runex5_12_A.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex5_12_B.out ex5_12_B.tmp > diff-runex5_12_B.out 2> diff-runex5_12_B.out
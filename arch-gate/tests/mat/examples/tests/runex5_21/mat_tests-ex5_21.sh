@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type mpiaij  > ex5_21.tmp 2> runex5_21.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex5_22.out ex5_22.tmp > diff-runex5_22.out 2> diff-runex5_22.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type mpidense  > ex5_22.tmp 2> runex5_22.err
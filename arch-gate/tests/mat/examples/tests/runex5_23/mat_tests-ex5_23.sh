@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex5 -mat_type mpiaij  > ex5_23.tmp 2> runex5_23.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type mpiaij -test_diagonalscale  > ex5_31.tmp 2> runex5_31.err
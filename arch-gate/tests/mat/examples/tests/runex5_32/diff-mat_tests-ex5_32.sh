@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v Mat_' /root/repo/src/mat/examples/tests/output/ex5_32.out ex5_32.tmp > diff-runex5_32.out 2> diff-runex5_32.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type mpibaij -test_diagonalscale  > ex5_32.tmp 2> runex5_32.err
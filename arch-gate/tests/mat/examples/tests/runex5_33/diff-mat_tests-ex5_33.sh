@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v type' /root/repo/src/mat/examples/tests/output/ex5_33.out ex5_33.tmp > diff-runex5_33.out 2> diff-runex5_33.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v Mat_' /root/repo/src/mat/examples/tests/output/ex5_34.out ex5_34.tmp > diff-runex5_34.out 2> diff-runex5_34.out
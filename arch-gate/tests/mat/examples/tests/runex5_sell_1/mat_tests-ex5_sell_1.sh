@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -mat_type sell  > ex5_sell_1.tmp 2> runex5_sell_1.err
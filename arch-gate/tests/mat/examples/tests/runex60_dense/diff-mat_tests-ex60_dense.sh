@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex60_dense.out ex60_dense.tmp > diff-runex60_dense.out 2> diff-runex60_dense.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex60 -col 7 -mat_type dense  > ex60_dense.tmp 2> runex60_dense.err
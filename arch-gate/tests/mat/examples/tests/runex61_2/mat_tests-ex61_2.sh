@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex61 -baij  > ex61_2.tmp 2> runex61_2.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex65   > ex65_1.tmp 2> runex65_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex72_3.out ex72_3.tmp > diff-runex72_3.out 2> diff-runex72_3.out
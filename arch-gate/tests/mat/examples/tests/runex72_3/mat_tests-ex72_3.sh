@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex72 -fin ${wPETSC_DIR}/share/petsc/datafiles/matrices/m_05_05_crk.mtx -fout petscmat2.aij  > ex72_3.tmp 2> runex72_3.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex74   -bs 4 > ex74_1.tmp 2> runex74_1.err
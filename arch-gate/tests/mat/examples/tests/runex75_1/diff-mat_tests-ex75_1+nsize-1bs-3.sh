@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex75_1.out ex75_1.tmp > diff-runex75_1.out 2> diff-runex75_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex77   -bs 4 > ex77_1.tmp 2> runex77_1.err
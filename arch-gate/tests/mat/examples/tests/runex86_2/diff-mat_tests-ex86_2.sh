@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex86_2.out ex86_2.tmp > diff-runex86_2.out 2> diff-runex86_2.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex86_3.out ex86_3.tmp > diff-runex86_3.out 2> diff-runex86_3.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex86 -mat_type baij -bs 2  > ex86_3.tmp 2> runex86_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex88_1.out ex88_1.tmp > diff-runex88_1.out 2> diff-runex88_1.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex89 -M 10 -N 10 -Z 10  > ex89_1.tmp 2> runex89_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex89_1.out ex89_allatonce.tmp > diff-runex89_allatonce.out 2> diff-runex89_allatonce.out
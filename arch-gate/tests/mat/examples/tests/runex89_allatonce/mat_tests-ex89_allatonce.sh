@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex89 -M 10 -N 10 -Z 10 -matmaijptap_via allatonce  > ex89_allatonce.tmp 2> runex89_allatonce.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex89 -M 10 -M 5 -M 10 -test_3D 1 -matmaijptap_via allatonce  > ex89_allatonce_3D.tmp 2> runex89_allatonce_3D.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex96_1.out ex89_allatonce_merged_3D.tmp > diff-runex89_allatonce_merged_3D.out 2> diff-runex89_allatonce_merged_3D.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex90 -matptap_via allatonce  > ex90_1.tmp 2> runex90_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex90_1.out ex90_merged.tmp > diff-runex90_merged.out 2> diff-runex90_merged.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex90 -matptap_via allatonce_merged  > ex90_merged.tmp 2> runex90_merged.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex92 -test_overlap -test_submat  -ov 1 -mat_block_size 2 > ex92_2.tmp 2> runex92_2.err
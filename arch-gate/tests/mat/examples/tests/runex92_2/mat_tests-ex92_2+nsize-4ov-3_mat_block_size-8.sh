@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex92 -test_overlap -test_submat  -ov 3 -mat_block_size 8 > ex92_2.tmp 2> runex92_2.err
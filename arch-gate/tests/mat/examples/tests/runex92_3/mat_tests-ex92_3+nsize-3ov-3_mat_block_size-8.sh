@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex92 -test_overlap -test_allcols  -ov 3 -mat_block_size 8 > ex92_3.tmp 2> runex92_3.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex92 -test_overlap -test_allcols -test_sorted  -ov 1 -mat_block_size 2 > ex92_3_sorted.tmp 2> runex92_3_sorted.err
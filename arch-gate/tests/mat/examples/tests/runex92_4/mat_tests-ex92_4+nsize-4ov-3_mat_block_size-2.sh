@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex92 -test_submat -test_allcols  -ov 3 -mat_block_size 2 > ex92_4.tmp 2> runex92_4.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex93   > ex93_1.tmp 2> runex93.err
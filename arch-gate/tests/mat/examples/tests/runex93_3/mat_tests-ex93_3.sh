@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex93   > ex93_3.tmp 2> runex93_3.err
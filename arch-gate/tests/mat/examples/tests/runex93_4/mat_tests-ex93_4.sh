@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex93 -A_matptap_via scalable  > ex93_4.tmp 2> runex93_4.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex93 -B_matmatmult_via btheap  > ex93_btheap.tmp 2> runex93_btheap.err
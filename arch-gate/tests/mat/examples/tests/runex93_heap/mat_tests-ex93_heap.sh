@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex93 -B_matmatmult_via heap  > ex93_heap.tmp 2> runex93_heap.err
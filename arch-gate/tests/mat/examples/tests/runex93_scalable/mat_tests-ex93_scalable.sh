@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex93 -B_matmatmult_via scalable  > ex93_scalable.tmp 2> runex93_scalable.err
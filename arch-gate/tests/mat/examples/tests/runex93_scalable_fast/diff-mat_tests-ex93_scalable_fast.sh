@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex93_1.out ex93_scalable_fast.tmp > diff-runex93_scalable_fast.out 2> diff-runex93_scalable_fast.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex95   > ex95_1.tmp 2> runex95_1.err
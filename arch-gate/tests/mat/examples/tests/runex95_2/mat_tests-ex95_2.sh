@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex95   > ex95_2.tmp 2> runex95_2.err
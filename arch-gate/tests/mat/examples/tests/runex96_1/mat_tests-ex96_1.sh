@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex96 -Mx 10 -My 5 -Mz 10  > ex96_1.tmp 2> runex96_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex96_1.out ex96_scalable.tmp > diff-runex96_scalable.out 2> diff-runex96_scalable.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex96 -Mx 10 -My 5 -Mz 10 -matmatmult_via scalable -matptap_via scalable  > ex96_scalable.tmp 2> runex96_scalable.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex96 -Mx 10 -My 5 -Mz 10 -matmatmult_via scalable -matptap_via scalable -inner_diag_matmatmult_via btheap -inner_offdiag_matmatmult_via btheap  > ex96_seq_btheap.tmp 2> runex96_seq_btheap.err
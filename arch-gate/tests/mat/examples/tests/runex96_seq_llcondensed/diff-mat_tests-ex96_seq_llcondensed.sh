@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex96_1.out ex96_seq_llcondensed.tmp > diff-runex96_seq_llcondensed.out 2> diff-runex96_seq_llcondensed.out
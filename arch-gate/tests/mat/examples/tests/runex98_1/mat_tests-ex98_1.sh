@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex98   > ex98_1.tmp 2> runex98_1.err
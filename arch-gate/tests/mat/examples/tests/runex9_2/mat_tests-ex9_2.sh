@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex9 -nsubcomms 2 -view_mat -psubcomm_type interlaced  > ex9_2.tmp 2> runex9_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex9_3_baij.out ex9_3_baij.tmp > diff-runex9_3_baij.out 2> diff-runex9_3_baij.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex9 -mat_type baij -nsubcomms 2 -view_mat  > ex9_3_baij.tmp 2> runex9_3_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tests/output/ex9_3_sbaij.out ex9_3_sbaij.tmp > diff-runex9_3_sbaij.out 2> diff-runex9_3_sbaij.out
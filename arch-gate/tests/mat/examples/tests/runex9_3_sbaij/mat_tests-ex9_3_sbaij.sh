@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex9 -mat_type sbaij -nsubcomms 2 -view_mat  > ex9_3_sbaij.tmp 2> runex9_3_sbaij.err
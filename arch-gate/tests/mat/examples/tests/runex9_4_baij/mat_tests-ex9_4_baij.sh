@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex9 -mat_type baij -nsubcomms 2 -view_mat -psubcomm_type interlaced  > ex9_4_baij.tmp 2> runex9_4_baij.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tutorials/output/ex12_1.out ex12_1.tmp > diff-runex12_1.out 2> diff-runex12_1.out
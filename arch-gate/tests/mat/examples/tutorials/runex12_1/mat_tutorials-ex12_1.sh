@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex12 -f0 ${wPETSC_DIR}/share/petsc/datafiles/matrices/ns-real-int32-float64  > ex12_1.tmp 2> runex12_1.err
@@ -0,0 +1 @@
+mpiexec  -n 8 ../ex17 -emptyranks 0,2,4 -bigranks 1,3,7 -mat_partitioning_type average  > ex17_1.tmp 2> runex17_1.err
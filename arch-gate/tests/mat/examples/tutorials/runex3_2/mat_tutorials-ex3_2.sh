@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex3   > ex3_2.tmp 2> runex3_2.err
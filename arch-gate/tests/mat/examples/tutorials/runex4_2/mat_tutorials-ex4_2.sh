@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex4   > ex4_2.tmp 2> runex4_2.err
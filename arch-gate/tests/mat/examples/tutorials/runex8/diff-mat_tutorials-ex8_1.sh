@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/mat/examples/tutorials/output/ex8_1.out ex8_1.tmp > diff-runex8.out 2> diff-runex8.out
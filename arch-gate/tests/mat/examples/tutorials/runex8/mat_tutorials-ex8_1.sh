@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex8   > ex8_1.tmp 2> runex8.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex8   > ex8_2.tmp 2> runex8_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tests/output/ex5_transpose_only.out ex5_transpose_only.tmp > diff-runex5_transpose_only.out 2> diff-runex5_transpose_only.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -snes_monitor_short -snes_view -ksp_monitor -snes_type ksptransposeonly -pc_type ilu -snes_test_jacobian -snes_test_jacobian_view -ksp_view_rhs -ksp_view_solution -ksp_view_mat_explicit -ksp_view_preconditioned_operator_explicit  > ex5_transpose_only.tmp 2> runex5_transpose_only.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex22 -da_grid_x 10 -snes_converged_reason -ksp_converged_reason -snes_view  > ex22_1.tmp 2> runex22_1.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex28 -u_da_grid_x 20 -snes_converged_reason -snes_monitor_short -ksp_monitor_short -problem_type 2 -snes_mf_operator -pc_type fieldsplit -pc_fieldsplit_dm_splits -pc_fieldsplit_type additive -fieldsplit_u_ksp_type gmres -fieldsplit_k_pc_type jacobi  -pack_dm_mat_type aij > ex28_3.tmp 2> runex28_3.err
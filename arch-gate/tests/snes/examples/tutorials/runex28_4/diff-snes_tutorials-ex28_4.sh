@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex28_4.out ex28_4.tmp > diff-runex28_4-0.out 2> diff-runex28_4-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/snes/examples/tutorials/output/ex28_4_alt.out ex28_4.tmp > diff-runex28_4.out 2> diff-runex28_4.out
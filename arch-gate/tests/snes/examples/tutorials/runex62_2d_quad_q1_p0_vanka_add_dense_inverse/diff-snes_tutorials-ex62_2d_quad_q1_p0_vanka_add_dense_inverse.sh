@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/linear solver iterations=[0-9][0-9]*""/linear solver iterations=49/g" -e "s/Linear solve converged due to CONVERGED_RTOL iterations [0-9][0-9]*""/Linear solve converged due to CONVERGED_RTOL iterations 49/g"' /root/repo/src/snes/examples/tutorials/output/ex62_2d_quad_q1_p0_vanka_add_dense_inverse.out ex62_2d_quad_q1_p0_vanka_add_dense_inverse.tmp > diff-runex62_2d_quad_q1_p0_vanka_add_dense_inverse.out 2> diff-runex62_2d_quad_q1_p0_vanka_add_dense_inverse.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex62 -run_type full -bc_type dirichlet -simplex 0 -dm_refine 1 -interpolate 1 -vel_petscspace_degree 1 -pres_petscspace_degree 0 -petscds_jac_pre 0 -snes_rtol 1.0e-4 -snes_error_if_not_converged -snes_view -snes_monitor -snes_converged_reason -ksp_type gmres -ksp_rtol 1.0e-5 -ksp_error_if_not_converged -ksp_converged_reason -pc_type patch -pc_patch_partition_of_unity 0 -pc_patch_construct_codim 0 -pc_patch_construct_type vanka -pc_patch_dense_inverse -pc_patch_sub_mat_type seqdense  > ex62_2d_quad_q1_p0_vanka_add_dense_inverse.tmp 2> runex62_2d_quad_q1_p0_vanka_add_dense_inverse.err
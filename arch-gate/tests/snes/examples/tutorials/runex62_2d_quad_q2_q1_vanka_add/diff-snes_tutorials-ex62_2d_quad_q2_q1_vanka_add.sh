@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/linear solver iterations=[0-9][0-9][0-9]*""/linear solver iterations=489/g"' /root/repo/src/snes/examples/tutorials/output/ex62_2d_quad_q2_q1_vanka_add.out ex62_2d_quad_q2_q1_vanka_add.tmp > diff-runex62_2d_quad_q2_q1_vanka_add.out 2> diff-runex62_2d_quad_q2_q1_vanka_add.out
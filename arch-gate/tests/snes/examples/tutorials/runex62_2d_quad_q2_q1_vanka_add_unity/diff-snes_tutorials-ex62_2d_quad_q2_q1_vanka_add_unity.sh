@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/linear solver iterations=[0-9][0-9][0-9]*""/linear solver iterations=795/g"' /root/repo/src/snes/examples/tutorials/output/ex62_2d_quad_q2_q1_vanka_add_unity.out ex62_2d_quad_q2_q1_vanka_add_unity.tmp > diff-runex62_2d_quad_q2_q1_vanka_add_unity.out 2> diff-runex62_2d_quad_q2_q1_vanka_add_unity.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex1   > ex1_basic_3.tmp 2> runex1_basic_3.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex1 -user_sf_type window -sf_type window  -sf_window_flavor dynamic -sf_window_sync active > ex1_window_nsize-1.tmp 2> runex1_window_nsize-1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tests/output/ex1_window_nsize-2.out ex1_window_nsize-2.tmp > diff-runex1_window_nsize-2.out 2> diff-runex1_window_nsize-2.out
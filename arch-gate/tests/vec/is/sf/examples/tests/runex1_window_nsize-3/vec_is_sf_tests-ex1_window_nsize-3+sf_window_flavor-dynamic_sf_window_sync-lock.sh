@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex1 -user_sf_type window -sf_type window  -sf_window_flavor dynamic -sf_window_sync lock > ex1_window_nsize-3.tmp 2> runex1_window_nsize-3.err
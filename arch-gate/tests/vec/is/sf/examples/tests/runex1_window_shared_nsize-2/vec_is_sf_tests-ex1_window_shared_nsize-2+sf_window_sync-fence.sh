@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex1 -user_sf_type window -sf_type window -sf_window_flavor shared  -sf_window_sync fence > ex1_window_shared_nsize-2.tmp 2> runex1_window_shared_nsize-2.err
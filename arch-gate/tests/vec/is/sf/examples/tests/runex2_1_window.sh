@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex2'
+testname='runex2_1_window'
+label='vec_is_sf_tests-ex2_1_window'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter='grep -v "type" | grep -v "sort"'
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-sf_type window -sf_view ::ascii_info_detail -esf_view ::ascii_info_detail'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+if ! $force; then
+    petsc_report_tapoutput "" "${label}" "SKIP PETSC_HAVE_MPI requirement not met"
+    total=1; skip=1
+    petsc_testend "/root/repo/arch-gate/tests" 
+    exit
+fi
+
+
+nsize_in=${nsize:-2}
+sf_window_sync_in=${sf_window_sync:-fence lock active}
+sf_window_flavor_in=${sf_window_flavor:-create dynamic allocate}
+
+
+for nsize in ${nsize_in}; do
+   for sf_window_sync in ${sf_window_sync_in}; do
+      for sf_window_flavor in ${sf_window_flavor_in}; do
+
+         petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -sf_window_sync ${sf_window_sync} -sf_window_flavor ${sf_window_flavor}" ex2_1_window.tmp ${testname}.err "${label}+sf_window_sync-${sf_window_sync}_sf_window_flavor-${sf_window_flavor}" 
+         res=$?
+
+         if test $res = 0; then
+            petsc_testrun "${diff_exe} /root/repo/src/vec/is/sf/examples/tests/output/ex2_1_window.out ex2_1_window.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+sf_window_sync-${sf_window_sync}_sf_window_flavor-${sf_window_flavor} ""
+         else
+            petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+         fi
+
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tests/output/ex3_1.out ex3_1.tmp > diff-runex3_1.out 2> diff-runex3_1.out
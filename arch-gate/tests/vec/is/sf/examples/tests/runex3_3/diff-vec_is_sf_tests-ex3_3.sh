@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tests/output/ex3_3.out ex3_3.tmp > diff-runex3_3.out 2> diff-runex3_3.out
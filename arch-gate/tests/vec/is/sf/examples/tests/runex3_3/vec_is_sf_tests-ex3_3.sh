@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex3 -op replace  > ex3_3.tmp 2> runex3_3.err
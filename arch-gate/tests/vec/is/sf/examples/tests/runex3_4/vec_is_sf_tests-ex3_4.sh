@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex3 -op sum  > ex3_4.tmp 2> runex3_4.err
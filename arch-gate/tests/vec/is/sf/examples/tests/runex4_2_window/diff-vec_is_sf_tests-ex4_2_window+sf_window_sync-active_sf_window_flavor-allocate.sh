@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type" | grep -v "sort"' /root/repo/src/vec/is/sf/examples/tests/output/ex4_2.out ex4_2_window.tmp > diff-runex4_2_window.out 2> diff-runex4_2_window.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex4 -sparse_sfB -sf_type window  -sf_window_sync active -sf_window_flavor dynamic > ex4_2_window.tmp 2> runex4_2_window.err
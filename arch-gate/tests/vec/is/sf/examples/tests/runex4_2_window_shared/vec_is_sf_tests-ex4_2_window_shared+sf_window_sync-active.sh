@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex4 -sparse_sfB -sf_type window -sf_window_flavor shared  -sf_window_sync active > ex4_2_window_shared.tmp 2> runex4_2_window_shared.err
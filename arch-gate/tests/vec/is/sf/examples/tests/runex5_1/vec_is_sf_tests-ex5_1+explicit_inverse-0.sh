@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex5 -view  -explicit_inverse 0 > ex5_1.tmp 2> runex5_1.err
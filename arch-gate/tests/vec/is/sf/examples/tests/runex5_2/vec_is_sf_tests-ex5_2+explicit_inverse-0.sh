@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex5 -view -nl 5  -explicit_inverse 0 > ex5_2.tmp 2> runex5_2.err
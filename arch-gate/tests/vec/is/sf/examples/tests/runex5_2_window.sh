@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# This script was created by gmakegentest.py
+
+
+
+# PATH for DLLs on windows
+PATH="$PATH":"/root/repo/arch-gate/lib"
+
+exec='../ex5'
+testname='runex5_2_window'
+label='vec_is_sf_tests-ex5_2_window'
+runfiles=''
+wPETSC_DIR='/root/repo'
+petsc_dir='/root/repo'
+petsc_arch='arch-gate'
+# Must be consistent with gmakefile.test
+testlogtapfile=/root/repo/arch-gate/tests/test_${petsc_arch}_tap.log
+testlogerrfile=/root/repo/arch-gate/tests/test_${petsc_arch}_err.log
+config_dir='/root/repo/config'
+filter='grep -v "type" | grep -v "sort"'
+filter_output=''
+petsc_bindir='/root/repo/lib/petsc/bin'
+DATAFILESPATH=${DATAFILESPATH:-""}
+args='-view -nl 5 -sf_type window'
+timeoutfactor=1
+
+mpiexec=${PETSCMPIEXEC:-"mpiexec"}
+diffexec=${PETSCDIFF:-"${petsc_bindir}/petscdiff"}
+
+. "${config_dir}/petsc_harness.sh"
+
+# The diff flags come from script arguments
+diff_exe="${diffexec} ${diff_flags}"
+mpiexec="${mpiexec} ${mpiexec_flags}"
+
+
+
+
+
+nsize_in=${nsize:-7}
+explicit_inverse_in=${explicit_inverse:-0 1}
+sf_window_sync_in=${sf_window_sync:-fence lock active}
+sf_window_flavor_in=${sf_window_flavor:-create allocate}
+
+
+for nsize in ${nsize_in}; do
+   for explicit_inverse in ${explicit_inverse_in}; do
+      for sf_window_sync in ${sf_window_sync_in}; do
+         for sf_window_flavor in ${sf_window_flavor_in}; do
+
+            petsc_testrun "${mpiexec} -n ${nsize} ${exec} ${args}  -explicit_inverse ${explicit_inverse} -sf_window_sync ${sf_window_sync} -sf_window_flavor ${sf_window_flavor}" ex5_2_window.tmp ${testname}.err "${label}+explicit_inverse-${explicit_inverse}_sf_window_sync-${sf_window_sync}_sf_window_flavor-${sf_window_flavor}" 
+            res=$?
+
+            if test $res = 0; then
+               petsc_testrun "${diff_exe} /root/repo/src/vec/is/sf/examples/tests/output/ex5_2.out ex5_2_window.tmp" diff-${testname}.out diff-${testname}.out diff-${label}+explicit_inverse-${explicit_inverse}_sf_window_sync-${sf_window_sync}_sf_window_flavor-${sf_window_flavor} ""
+            else
+               petsc_report_tapoutput "" ${label} "SKIP Command failed so no diff"
+            fi
+
+         done
+      done
+   done
+done
+
+petsc_testend "/root/repo/arch-gate/tests" 
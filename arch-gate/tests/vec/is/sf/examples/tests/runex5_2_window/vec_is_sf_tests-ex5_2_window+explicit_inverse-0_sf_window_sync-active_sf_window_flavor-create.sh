@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex5 -view -nl 5 -sf_type window  -explicit_inverse 0 -sf_window_sync active -sf_window_flavor create > ex5_2_window.tmp 2> runex5_2_window.err
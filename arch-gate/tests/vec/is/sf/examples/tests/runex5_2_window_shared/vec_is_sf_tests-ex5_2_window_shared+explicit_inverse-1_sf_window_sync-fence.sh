@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex5 -view -nl 5 -sf_type window -sf_window_flavor shared  -explicit_inverse 1 -sf_window_sync fence > ex5_2_window_shared.tmp 2> runex5_2_window_shared.err
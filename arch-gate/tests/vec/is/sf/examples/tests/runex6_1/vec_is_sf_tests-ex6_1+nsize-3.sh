@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex6 -sf_type basic  > ex6_1.tmp 2> runex6_1.err
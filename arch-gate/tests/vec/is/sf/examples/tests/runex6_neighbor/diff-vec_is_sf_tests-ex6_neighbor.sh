@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tests/output/ex6_1.out ex6_neighbor.tmp > diff-runex6_neighbor.out 2> diff-runex6_neighbor.out
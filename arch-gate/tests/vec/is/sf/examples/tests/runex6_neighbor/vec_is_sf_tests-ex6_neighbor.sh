@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex6 -sf_type neighbor  > ex6_neighbor.tmp 2> runex6_neighbor.err
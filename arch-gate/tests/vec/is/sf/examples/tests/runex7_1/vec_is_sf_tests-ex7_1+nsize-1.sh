@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex7 -thr_sf_num_threads 2  > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tests/output/ex7_1.out ex7_neighbor.tmp > diff-runex7_neighbor.out 2> diff-runex7_neighbor.out
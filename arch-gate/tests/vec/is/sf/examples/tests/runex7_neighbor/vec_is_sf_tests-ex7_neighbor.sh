@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex7 -sf_type neighbor -thr_sf_num_threads 2  > ex7_neighbor.tmp 2> runex7_neighbor.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type" | grep -v "sort"' /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_1.out ex1_1.tmp > diff-runex1_1.out 2> diff-runex1_1.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_bcast -sf_type window  -sf_window_sync fence -sf_window_flavor create > ex1_1.tmp 2> runex1_1.err
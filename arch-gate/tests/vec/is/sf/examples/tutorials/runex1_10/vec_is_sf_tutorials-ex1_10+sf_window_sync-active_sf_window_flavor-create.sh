@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -sf_type window -test_all -test_bcastop 0 -test_fetchandop 0  -sf_window_sync active -sf_window_flavor create > ex1_10.tmp 2> runex1_10.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -sf_type basic -test_all -test_bcastop 0 -test_fetchandop 0  > ex1_10_basic.tmp 2> runex1_10_basic.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -sf_type basic -sf_basic_prepost -test_all -test_bcastop 0 -test_fetchandop 0  > ex1_10_prepost.tmp 2> runex1_10_prepost.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type" | grep -v "sort"' /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_10.out ex1_10_shared.tmp > diff-runex1_10_shared.out 2> diff-runex1_10_shared.out
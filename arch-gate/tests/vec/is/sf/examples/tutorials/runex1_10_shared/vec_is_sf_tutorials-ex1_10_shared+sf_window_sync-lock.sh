@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -sf_type window -sf_window_flavor shared -test_all -test_bcastop 0 -test_fetchandop 0  -sf_window_sync lock > ex1_10_shared.tmp 2> runex1_10_shared.err
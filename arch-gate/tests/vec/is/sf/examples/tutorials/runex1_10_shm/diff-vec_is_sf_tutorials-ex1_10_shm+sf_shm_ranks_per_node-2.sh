@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'sed -e "s/type: shm/type: basic/"' /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_10_basic.out ex1_10_shm.tmp > diff-runex1_10_shm.out 2> diff-runex1_10_shm.out
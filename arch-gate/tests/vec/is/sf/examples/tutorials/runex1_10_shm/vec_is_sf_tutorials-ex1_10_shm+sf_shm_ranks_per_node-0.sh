@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -sf_type shm -test_all -test_bcastop 0 -test_fetchandop 0  -sf_shm_ranks_per_node 0 > ex1_10_shm.tmp 2> runex1_10_shm.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_reduce -sf_type window  -sf_window_sync fence -sf_window_flavor create > ex1_2.tmp 2> runex1_2.err
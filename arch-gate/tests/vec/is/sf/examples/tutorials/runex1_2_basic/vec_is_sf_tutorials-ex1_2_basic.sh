@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_reduce -sf_type basic  > ex1_2_basic.tmp 2> runex1_2_basic.err
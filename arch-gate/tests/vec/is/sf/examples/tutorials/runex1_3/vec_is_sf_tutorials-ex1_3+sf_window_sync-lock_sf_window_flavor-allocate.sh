@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_degree -sf_type window  -sf_window_sync lock -sf_window_flavor allocate > ex1_3.tmp 2> runex1_3.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_degree -sf_type basic  > ex1_3_basic.tmp 2> runex1_3_basic.err
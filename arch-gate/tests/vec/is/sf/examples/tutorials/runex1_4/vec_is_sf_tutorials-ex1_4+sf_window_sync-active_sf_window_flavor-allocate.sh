@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_gather -sf_type window  -sf_window_sync active -sf_window_flavor allocate > ex1_4.tmp 2> runex1_4.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_gather -sf_type basic  > ex1_4_basic.tmp 2> runex1_4_basic.err
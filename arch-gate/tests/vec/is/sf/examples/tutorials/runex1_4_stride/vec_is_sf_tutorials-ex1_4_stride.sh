@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_gather -sf_type basic -stride 2  > ex1_4_stride.tmp 2> runex1_4_stride.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_scatter -sf_type basic  > ex1_5_basic.tmp 2> runex1_5_basic.err
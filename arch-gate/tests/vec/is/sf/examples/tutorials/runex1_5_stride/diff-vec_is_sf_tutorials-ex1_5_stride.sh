@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_5_stride.out ex1_5_stride.tmp > diff-runex1_5_stride.out 2> diff-runex1_5_stride.out
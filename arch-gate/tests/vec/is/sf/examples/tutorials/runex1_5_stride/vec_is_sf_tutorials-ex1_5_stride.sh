@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_scatter -sf_type basic -stride 2  > ex1_5_stride.tmp 2> runex1_5_stride.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_embed -sf_type window  -sf_window_sync lock -sf_window_flavor dynamic > ex1_6.tmp 2> runex1_6.err
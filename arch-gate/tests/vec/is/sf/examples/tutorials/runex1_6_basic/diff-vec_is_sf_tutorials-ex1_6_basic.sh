@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_6_basic.out ex1_6_basic.tmp > diff-runex1_6_basic-0.out 2> diff-runex1_6_basic-0.out || /root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_6_basic_alt.out ex1_6_basic.tmp > diff-runex1_6_basic.out 2> diff-runex1_6_basic.out
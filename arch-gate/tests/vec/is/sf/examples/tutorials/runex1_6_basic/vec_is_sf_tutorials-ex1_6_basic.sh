@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_embed -sf_type basic  > ex1_6_basic.tmp 2> runex1_6_basic.err
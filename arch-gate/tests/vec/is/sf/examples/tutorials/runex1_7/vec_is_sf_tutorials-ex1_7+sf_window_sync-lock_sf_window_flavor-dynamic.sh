@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_invert -sf_type window  -sf_window_sync lock -sf_window_flavor dynamic > ex1_7.tmp 2> runex1_7.err
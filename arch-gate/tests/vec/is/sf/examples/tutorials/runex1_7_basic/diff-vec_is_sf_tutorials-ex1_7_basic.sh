@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_7_basic.out ex1_7_basic.tmp > diff-runex1_7_basic.out 2> diff-runex1_7_basic.out
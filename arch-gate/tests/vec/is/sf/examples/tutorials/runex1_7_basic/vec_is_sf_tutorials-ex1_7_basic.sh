@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_invert -sf_type basic  > ex1_7_basic.tmp 2> runex1_7_basic.err
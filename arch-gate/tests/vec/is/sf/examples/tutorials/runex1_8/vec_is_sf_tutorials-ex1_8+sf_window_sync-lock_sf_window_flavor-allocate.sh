@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex1 -test_bcast -test_sf_distribute -sf_type window  -sf_window_sync lock -sf_window_flavor allocate > ex1_8.tmp 2> runex1_8.err
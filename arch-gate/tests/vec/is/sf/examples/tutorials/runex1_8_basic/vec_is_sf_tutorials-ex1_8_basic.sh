@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex1 -test_bcast -test_sf_distribute -sf_type basic  > ex1_8_basic.tmp 2> runex1_8_basic.err
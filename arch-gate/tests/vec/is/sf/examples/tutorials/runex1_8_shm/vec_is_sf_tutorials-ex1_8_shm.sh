@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex1 -test_bcast -test_sf_distribute -sf_type shm -sf_shm_ranks_per_node 2  > ex1_8_shm.tmp 2> runex1_8_shm.err
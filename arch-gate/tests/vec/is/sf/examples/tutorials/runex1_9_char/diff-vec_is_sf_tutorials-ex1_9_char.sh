@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tutorials/output/ex1_9_char.out ex1_9_char.tmp > diff-runex1_9_char.out 2> diff-runex1_9_char.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -sf_type basic -test_bcast -test_reduce -test_op max -test_char  > ex1_9_char.tmp 2> runex1_9_char.err
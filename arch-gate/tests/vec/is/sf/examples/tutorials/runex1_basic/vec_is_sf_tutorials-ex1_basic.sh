@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_bcast -sf_type basic  > ex1_basic.tmp 2> runex1_basic.err
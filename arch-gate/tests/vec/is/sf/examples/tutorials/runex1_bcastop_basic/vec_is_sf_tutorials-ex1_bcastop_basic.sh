@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -test_bcastop -sf_type basic  > ex1_bcastop_basic.tmp 2> runex1_bcastop_basic.err
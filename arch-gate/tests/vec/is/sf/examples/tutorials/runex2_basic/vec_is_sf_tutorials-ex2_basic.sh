@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -sf_type basic  > ex2_basic.tmp 2> runex2_basic.err
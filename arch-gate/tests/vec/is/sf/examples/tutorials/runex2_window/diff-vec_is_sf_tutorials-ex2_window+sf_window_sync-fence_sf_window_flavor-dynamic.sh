@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type" | grep -v "sort"' /root/repo/src/vec/is/sf/examples/tutorials/output/ex2_basic.out ex2_window.tmp > diff-runex2_window.out 2> diff-runex2_window.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -sf_type window  -sf_window_sync fence -sf_window_flavor allocate > ex2_window.tmp 2> runex2_window.err
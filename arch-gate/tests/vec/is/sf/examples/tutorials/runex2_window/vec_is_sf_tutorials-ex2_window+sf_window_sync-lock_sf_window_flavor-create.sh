@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -sf_type window  -sf_window_sync lock -sf_window_flavor create > ex2_window.tmp 2> runex2_window.err
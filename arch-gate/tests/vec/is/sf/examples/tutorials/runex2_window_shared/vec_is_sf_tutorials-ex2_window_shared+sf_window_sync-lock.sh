@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -sf_type window -sf_window_flavor shared  -sf_window_sync lock > ex2_window_shared.tmp 2> runex2_window_shared.err
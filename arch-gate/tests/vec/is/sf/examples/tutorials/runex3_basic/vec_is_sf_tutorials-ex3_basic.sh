@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -sf_type basic  > ex3_basic.tmp 2> runex3_basic.err
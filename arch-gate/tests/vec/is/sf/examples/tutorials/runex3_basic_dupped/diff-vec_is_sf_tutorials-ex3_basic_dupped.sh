@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/is/sf/examples/tutorials/output/ex3_basic_dupped.out ex3_basic_dupped.tmp > diff-runex3_basic_dupped.out 2> diff-runex3_basic_dupped.out
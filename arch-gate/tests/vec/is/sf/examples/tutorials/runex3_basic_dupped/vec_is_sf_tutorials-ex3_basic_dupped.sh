@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -test_dupped_type -sf_type basic  > ex3_basic_dupped.tmp 2> runex3_basic_dupped.err
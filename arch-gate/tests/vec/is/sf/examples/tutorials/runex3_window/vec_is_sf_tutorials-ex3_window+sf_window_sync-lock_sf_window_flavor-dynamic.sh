@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -sf_type window  -sf_window_sync lock -sf_window_flavor dynamic > ex3_window.tmp 2> runex3_window.err
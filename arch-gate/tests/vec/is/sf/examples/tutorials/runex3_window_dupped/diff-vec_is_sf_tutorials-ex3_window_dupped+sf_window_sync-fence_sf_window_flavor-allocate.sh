@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type" | grep -v "sort"' /root/repo/src/vec/is/sf/examples/tutorials/output/ex3_window_dupped.out ex3_window_dupped.tmp > diff-runex3_window_dupped.out 2> diff-runex3_window_dupped.out
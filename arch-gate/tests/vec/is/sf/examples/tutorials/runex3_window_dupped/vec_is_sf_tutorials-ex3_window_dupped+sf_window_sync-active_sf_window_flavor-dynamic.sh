@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -test_dupped_type -sf_type window  -sf_window_sync active -sf_window_flavor dynamic > ex3_window_dupped.tmp 2> runex3_window_dupped.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex3 -test_dupped_type -sf_type window -sf_window_flavor shared  -sf_window_sync fence > ex3_window_dupped_shared.tmp 2> runex3_window_dupped_shared.err
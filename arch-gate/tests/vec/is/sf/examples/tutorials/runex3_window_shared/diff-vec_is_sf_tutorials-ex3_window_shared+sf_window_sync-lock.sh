@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type" | grep -v "sort"' /root/repo/src/vec/is/sf/examples/tutorials/output/ex3_window.out ex3_window_shared.tmp > diff-runex3_window_shared.out 2> diff-runex3_window_shared.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex11   > ex11_1.tmp 2> runex11_1.err
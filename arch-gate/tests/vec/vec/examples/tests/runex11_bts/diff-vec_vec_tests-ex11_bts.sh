@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex11_1.out ex11_bts.tmp > diff-runex11_bts.out 2> diff-runex11_bts.out
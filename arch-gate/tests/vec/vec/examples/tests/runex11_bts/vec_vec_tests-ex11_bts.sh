@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex11 -vec_assembly_legacy  > ex11_bts.tmp 2> runex11_bts.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex13_1.out ex13_1.tmp > diff-runex13_1.out 2> diff-runex13_1.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex14   > ex14_1.tmp 2> runex14_1.err
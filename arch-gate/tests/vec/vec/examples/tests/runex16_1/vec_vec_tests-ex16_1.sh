@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex16   > ex16_1.tmp 2> runex16_1.err
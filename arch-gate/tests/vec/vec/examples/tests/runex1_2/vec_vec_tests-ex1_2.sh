@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex1   > ex1_2.tmp 2> runex1_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex21_1.out ex21_1.tmp > diff-runex21.out 2> diff-runex21.out
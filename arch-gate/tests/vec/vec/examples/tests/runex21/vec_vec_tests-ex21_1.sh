@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex21   > ex21_1.tmp 2> runex21.err
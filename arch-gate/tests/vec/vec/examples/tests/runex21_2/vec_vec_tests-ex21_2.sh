@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex21   > ex21_2.tmp 2> runex21_2.err
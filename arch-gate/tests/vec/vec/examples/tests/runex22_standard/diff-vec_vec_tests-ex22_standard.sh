@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "  type:"' /root/repo/src/vec/vec/examples/tests/output/ex22_1.out ex22_standard.tmp > diff-runex22_standard.out 2> diff-runex22_standard.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex22 -vec_type standard  > ex22_standard.tmp 2> runex22_standard.err
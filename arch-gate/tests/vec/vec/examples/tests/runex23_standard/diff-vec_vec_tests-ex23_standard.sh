@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "  type:"' /root/repo/src/vec/vec/examples/tests/output/ex23_1.out ex23_standard.tmp > diff-runex23_standard.out 2> diff-runex23_standard.out
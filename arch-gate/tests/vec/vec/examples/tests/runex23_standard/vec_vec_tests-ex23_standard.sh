@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex23 -vec_type standard  > ex23_standard.tmp 2> runex23_standard.err
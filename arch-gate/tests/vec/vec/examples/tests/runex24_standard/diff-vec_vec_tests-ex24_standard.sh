@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "  type:"' /root/repo/src/vec/vec/examples/tests/output/ex24_1.out ex24_standard.tmp > diff-runex24_standard.out 2> diff-runex24_standard.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex24 -vec_type standard  > ex24_standard.tmp 2> runex24_standard.err
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex28 -splitreduction_async  > ex28_2.tmp 2> runex28_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex29_1.out ex29_1.tmp > diff-runex29_1.out 2> diff-runex29_1.out
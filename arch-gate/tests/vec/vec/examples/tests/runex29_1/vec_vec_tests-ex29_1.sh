@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex29 -n 126  > ex29_1.tmp 2> runex29_1.err
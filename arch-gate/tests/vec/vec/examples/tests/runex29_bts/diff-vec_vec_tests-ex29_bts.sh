@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex29_1.out ex29_bts.tmp > diff-runex29_bts.out 2> diff-runex29_bts.out
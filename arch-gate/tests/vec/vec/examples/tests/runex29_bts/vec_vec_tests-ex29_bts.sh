@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex29 -n 126 -vec_assembly_legacy  > ex29_bts.tmp 2> runex29_bts.err
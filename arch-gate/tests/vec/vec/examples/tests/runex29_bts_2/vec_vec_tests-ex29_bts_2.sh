@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex29 -n 126 -vec_assembly_legacy -repeat 2  > ex29_bts_2.tmp 2> runex29_bts_2.err
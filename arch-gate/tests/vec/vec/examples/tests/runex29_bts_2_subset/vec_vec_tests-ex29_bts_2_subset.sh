@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex29 -n 126 -vec_assembly_legacy -repeat 2 -subset  > ex29_bts_2_subset.tmp 2> runex29_bts_2_subset.err
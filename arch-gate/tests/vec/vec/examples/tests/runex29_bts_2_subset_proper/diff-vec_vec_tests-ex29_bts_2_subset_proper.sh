@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex29_1.out ex29_bts_2_subset_proper.tmp > diff-runex29_bts_2_subset_proper.out 2> diff-runex29_bts_2_subset_proper.out
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex29_test_inv_error.out ex29_bts_test_inv_error.tmp > diff-runex29_bts_test_inv_error.out 2> diff-runex29_bts_test_inv_error.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex29 -n 4 -invert -bs 2  > ex29_bts_test_inv_error.tmp 2> runex29_bts_test_inv_error.err
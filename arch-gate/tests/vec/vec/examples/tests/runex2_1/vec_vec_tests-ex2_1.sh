@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex2   > ex2_1.tmp 2> runex2_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex33_1.out ex33_1.tmp > diff-runex33_1.out 2> diff-runex33_1.out
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex33   > ex33_1.tmp 2> runex33_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex34_1.out ex34_standard.tmp > diff-runex34_standard.out 2> diff-runex34_standard.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex34   > ex34_standard.tmp 2> runex34_standard.err
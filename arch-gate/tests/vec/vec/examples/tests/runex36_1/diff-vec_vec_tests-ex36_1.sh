@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex36_1.out ex36_1.tmp > diff-runex36_1.out 2> diff-runex36_1.out
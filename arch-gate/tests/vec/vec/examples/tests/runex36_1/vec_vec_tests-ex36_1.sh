@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex36 -set_option_negidx -set_values_negidx -get_values_negidx  > ex36_1.tmp 2> runex36_1.err
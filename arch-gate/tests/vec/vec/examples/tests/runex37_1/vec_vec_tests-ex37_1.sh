@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex37 -explicit_is 0  > ex37_1.tmp 2> runex37_1.err
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex37 -explicit_is 1  > ex37_2.tmp 2> runex37_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex37_3.out ex37_3.tmp > diff-runex37_3.out 2> diff-runex37_3.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex37 -explicit_is 0  > ex37_3.tmp 2> runex37_3.err
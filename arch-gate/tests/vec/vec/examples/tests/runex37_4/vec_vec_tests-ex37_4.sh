@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex37 -explicit_is 1  > ex37_4.tmp 2> runex37_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "  type:"' /root/repo/src/vec/vec/examples/tests/output/ex38_1.out ex38_standard.tmp > diff-runex38_standard.out 2> diff-runex38_standard.out
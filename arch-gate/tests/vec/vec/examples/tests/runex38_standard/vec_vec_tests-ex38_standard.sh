@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex38 -vec_type standard  > ex38_standard.tmp 2> runex38_standard.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex3   > ex3_1.tmp 2> runex3_1.err
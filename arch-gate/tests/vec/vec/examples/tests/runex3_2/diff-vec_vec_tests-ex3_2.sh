@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex3_2.out ex3_2.tmp > diff-runex3_2.out 2> diff-runex3_2.out
@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex41   > ex41_1.tmp 2> runex41_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex43_1.out ex43_1.tmp > diff-runex43.out 2> diff-runex43.out
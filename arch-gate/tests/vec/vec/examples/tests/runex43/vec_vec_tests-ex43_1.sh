@@ -0,0 +1 @@
+mpiexec  -n 1 ../ex43   > ex43_1.tmp 2> runex43.err
@@ -0,0 +1 @@
+mpiexec  -n 6 ../ex46   > ex46_2.tmp 2> runex46_2.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex46_1_p12.out ex46_3.tmp > diff-runex46_3.out 2> diff-runex46_3.out
@@ -0,0 +1 @@
+mpiexec  -n 12 ../ex46   > ex46_3.tmp 2> runex46_3.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vec/examples/tests/output/ex46_2_p6.out ex46_mpiio.tmp > diff-runex46_mpiio.out 2> diff-runex46_mpiio.out
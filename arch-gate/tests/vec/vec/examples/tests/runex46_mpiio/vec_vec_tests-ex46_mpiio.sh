@@ -0,0 +1 @@
+mpiexec  -n 6 ../ex46 -usempiio  > ex46_mpiio.tmp 2> runex46_mpiio.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex49   > ex49_1.tmp 2> runex49_1.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex49 -save_comm  > ex49_1_save.tmp 2> runex49_1_save.err
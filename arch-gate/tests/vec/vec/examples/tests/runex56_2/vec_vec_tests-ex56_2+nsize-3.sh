@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex56 -n 10 -k 6  > ex56_2.tmp 2> runex56_2.err
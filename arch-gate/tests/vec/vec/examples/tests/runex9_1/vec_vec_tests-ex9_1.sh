@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex9   > ex9_1.tmp 2> runex9_1.err
@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex1 -vecscatter_type mpi3node  > ex1_2.tmp 2> runex1_2.err
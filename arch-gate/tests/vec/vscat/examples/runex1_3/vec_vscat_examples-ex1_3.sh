@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex1 -bs 2 -vecscatter_type mpi3node  > ex1_3.tmp 2> runex1_3.err
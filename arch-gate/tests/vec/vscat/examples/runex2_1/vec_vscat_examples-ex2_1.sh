@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -vecscatter_type mpi3node  > ex2_1.tmp 2> runex2_1.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -vecscatter_type mpi3  > ex2_2.tmp 2> runex2_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -bs 3 -vecscatter_type mpi3node  > ex2_3.tmp 2> runex2_3.err
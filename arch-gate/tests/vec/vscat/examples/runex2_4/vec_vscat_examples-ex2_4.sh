@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex2 -bs 3 -vecscatter_type mpi3  > ex2_4.tmp 2> runex2_4.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vscat/examples/output/ex2_5.out ex2_5.tmp > diff-runex2_5.out 2> diff-runex2_5.out
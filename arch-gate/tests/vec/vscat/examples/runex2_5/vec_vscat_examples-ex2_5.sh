@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex2 -vecscatter_type mpi3  > ex2_5.tmp 2> runex2_5.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex3 -vecscatter_type mpi3node  > ex3_1.tmp 2> runex3_1.err
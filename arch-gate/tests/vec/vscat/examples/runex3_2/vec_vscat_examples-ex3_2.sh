@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex3 -vecscatter_type mpi3  > ex3_2.tmp 2> runex3_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex3 -bs 2 -vecscatter_type mpi3node  > ex3_3.tmp 2> runex3_3.err
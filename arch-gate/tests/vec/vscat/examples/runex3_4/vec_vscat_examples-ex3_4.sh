@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex3 -bs 2 -vecscatter_type mpi3  > ex3_4.tmp 2> runex3_4.err
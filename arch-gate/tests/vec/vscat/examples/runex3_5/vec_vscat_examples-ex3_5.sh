@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex3 -vecscatter_type mpi3  > ex3_5.tmp 2> runex3_5.err
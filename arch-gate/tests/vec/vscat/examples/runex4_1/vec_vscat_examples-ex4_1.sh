@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex4   > ex4_1.tmp 2> runex4_1.err
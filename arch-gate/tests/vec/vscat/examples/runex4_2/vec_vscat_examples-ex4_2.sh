@@ -0,0 +1 @@
+mpiexec  -n 4 ../ex4 -vecscatter_type mpi3  > ex4_2.tmp 2> runex4_2.err
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex7   > ex7_1.tmp 2> runex7_1.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type"' /root/repo/src/vec/vscat/examples/output/ex8_1.out ex8_1_standard.tmp > diff-runex8_1_standard.out 2> diff-runex8_1_standard.out
@@ -0,0 +1 @@
+mpiexec  -n 2 ../ex8   > ex8_1_standard.tmp 2> runex8_1_standard.err
@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  -F $'grep -v "type"' /root/repo/src/vec/vscat/examples/output/ex8_2.out ex8_2_2_standard.tmp > diff-runex8_2_2_standard.out 2> diff-runex8_2_2_standard.out
@@ -0,0 +1 @@
+mpiexec  -n 3 ../ex8   > ex8_2_2_standard.tmp 2> runex8_2_2_standard.err
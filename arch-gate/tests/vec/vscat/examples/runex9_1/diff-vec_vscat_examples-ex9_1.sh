@@ -0,0 +1 @@
+/root/repo/lib/petsc/bin/petscdiff  /root/repo/src/vec/vscat/examples/output/ex9_1.out ex9_1.tmp > diff-runex9_1.out 2> diff-runex9_1.out
@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex9 -world2sub  > ex9_1.tmp 2> runex9_1.err
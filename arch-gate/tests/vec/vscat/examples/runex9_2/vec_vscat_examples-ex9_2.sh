@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex9 -sub2sub  > ex9_2.tmp 2> runex9_2.err
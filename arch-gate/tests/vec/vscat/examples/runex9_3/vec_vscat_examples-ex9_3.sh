@@ -0,0 +1 @@
+mpiexec  -n 7 ../ex9 -world2subs  > ex9_3.tmp 2> runex9_3.err
@@ -28,6 +28,7 @@
 #define KSPPIPECG 'pipecg'
 #define KSPPIPECGRR 'pipecgrr'
 #define KSPPIPELCG 'pipelcg'
+#define KSPSSTEPCG 'sstepcg'
 #define KSPCGNE 'cgne'
 #define KSPNASH 'nash'
 #define KSPSTCG 'stcg'
@@ -36,10 +37,12 @@
 #define KSPPIPEFCG 'pipefcg'
 #define KSPGMRES 'gmres'
 #define KSPPIPEFGMRES 'pipefgmres'
+#define KSPSSTEPGMRES 'sstepgmres'
 #define KSPFGMRES 'fgmres'
 #define KSPLGMRES 'lgmres'
 #define KSPDGMRES 'dgmres'
 #define KSPPGMRES 'pgmres'
+#define KSPGCRODR 'gcrodr'
 #define KSPTCQMR 'tcqmr'
 #define KSPBCGS 'bcgs'
 #define KSPIBCGS 'ibcgs'
@@ -65,6 +68,7 @@
 #define KSPCGLS 'cgls'
 #define KSPFETIDP 'fetidp'
 #define KSPHPDDM 'hpddm'
+#define KSPIR 'ir'
 !
 !  Various Initial guesses for Krylov subspace methods
 !
@@ -96,6 +96,9 @@
 #define MATAIJSELL         'aijsell'
 #define MATSEQAIJSELL      'seqaijsell'
 #define MATMPIAIJSELL      'mpiaijsell'
+#define MATAIJMIXED        'aijmixed'
+#define MATSEQAIJMIXED     'seqaijmixed'
+#define MATMPIAIJMIXED     'mpiaijmixed'
 #define MATAIJMKL          'aijmkl'
 #define MATSEQAIJMKL       'seqaijmkl'
 #define MATMPIAIJMKL       'mpiaijmkl'
@@ -82,6 +82,7 @@
 #define PCSAVIENNACL 'saviennacl'
 #define PCBDDC 'bddc'
 #define PCKACZMARZ 'kaczmarz'
+#define PCCHOWILU 'chowilu'
 #define PCTELESCOPE 'telescope'
 #define PCPATCH 'patch'
 #define PCLMVM 'lmvm'
@@ -49,6 +49,7 @@ struct _DMOps {
   PetscErrorCode (*localtoglobalend)(DM,Vec,InsertMode,Vec);
   PetscErrorCode (*localtolocalbegin)(DM,Vec,InsertMode,Vec);
   PetscErrorCode (*localtolocalend)(DM,Vec,InsertMode,Vec);
+  PetscErrorCode (*getglobaltolocalsf)(DM,PetscSF*,MPI_Datatype*); /* the star forest doing INSERT_VALUES global to local, if any */
 
   PetscErrorCode (*destroy)(DM);
 
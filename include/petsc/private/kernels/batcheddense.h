@@ -0,0 +1,23 @@
+#if !defined(_BATCHEDDENSE_H)
+#define _BATCHEDDENSE_H
+
+#include <petscsys.h>
+
+/*
+   Many small dense blocks of possibly different sizes, with the blocks of equal size grouped in batches of
+   PETSC_BATCHED_DENSE_WIDTH blocks stored interleaved, entry (i,j) of the blocks of a batch contiguous, so that the
+   factorization, the solves and the products run across the blocks of a batch in the innermost loop.
+*/
+#define PETSC_BATCHED_DENSE_WIDTH 8
+
+typedef struct _n_PetscBatchedDense *PetscBatchedDense;
+
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseCreate(PetscInt,const PetscInt[],PetscBatchedDense*);
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseDestroy(PetscBatchedDense*);
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseSetBlock(PetscBatchedDense,PetscInt,const PetscScalar[],PetscInt);
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseLUFactor(PetscBatchedDense,PetscBool,PetscBool*);
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseLUSolve(PetscBatchedDense,const PetscScalar[],PetscScalar[]);
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseLUSolveBlock(PetscBatchedDense,PetscInt,const PetscScalar[],PetscScalar[]);
+PETSC_EXTERN PetscErrorCode PetscBatchedDenseMult(PetscBatchedDense,const PetscScalar[],PetscScalar[]);
+
+#endif
@@ -20,6 +20,7 @@ struct _KSPOps {
                                                           calculates the residual in a
                                                           user-provided area.  */
   PetscErrorCode (*solve)(KSP);                        /* actual solver */
+  PetscErrorCode (*matsolve)(KSP,Mat,Mat);             /* solver for a block of right hand sides, see KSPMatSolve() */
   PetscErrorCode (*setup)(KSP);
   PetscErrorCode (*setfromoptions)(PetscOptionItems*,KSP);
   PetscErrorCode (*publishoptions)(KSP);
@@ -188,6 +189,21 @@ PETSC_INTERN PetscErrorCode KSPSetUpNorms_Private(KSP,PetscBool,KSPNormType*,PCS
 
 PETSC_INTERN PetscErrorCode KSPPlotEigenContours_Private(KSP,PetscInt,const PetscReal*,const PetscReal*);
 
+/* kernels on the dense blocks of vectors of KSPMatSolve(); the inner products are local, so that several of them
+   can be summed with a single reduction */
+PETSC_INTERN PetscErrorCode KSPMatMatMult_Private(Mat,Mat,Mat*);
+PETSC_INTERN PetscErrorCode KSPDenseTransposeMultLocal_Private(Mat,Mat,PetscScalar*,PetscInt);
+PETSC_INTERN PetscErrorCode KSPDenseMultAdd_Private(Mat,const PetscScalar*,PetscInt,PetscScalar,Mat);
+PETSC_INTERN PetscErrorCode KSPDenseColumnNormsLocal_Private(Mat,PetscScalar*);
+PETSC_INTERN PetscErrorCode KSPDenseCholesky_Private(PetscInt,const PetscScalar*,PetscScalar*,PetscScalar*,PetscInt*,PetscBool*);
+PETSC_INTERN PetscErrorCode KSPMatSolve_Basic(KSP,Mat,Mat);
+
+/* matrix powers kernel of the s-step methods, computes A x, ..., A^s x with one ghost exchange */
+typedef struct _n_KSPMatPowers *KSPMatPowers;
+PETSC_INTERN PetscErrorCode KSPMatPowersSetUp_Private(KSP,PetscInt,KSPMatPowers*);
+PETSC_INTERN PetscErrorCode KSPMatPowersApply_Private(KSPMatPowers,Vec,PetscInt,Vec*);
+PETSC_INTERN PetscErrorCode KSPMatPowersDestroy_Private(KSPMatPowers*);
+
 typedef struct _p_DMKSP *DMKSP;
 typedef struct _DMKSPOps *DMKSPOps;
 struct _DMKSPOps {
@@ -330,6 +346,7 @@ PETSC_STATIC_INLINE PetscErrorCode KSP_PCApplyBAorABTranspose(KSP ksp,Vec x,Vec
 PETSC_EXTERN PetscLogEvent KSP_GMRESOrthogonalization;
 PETSC_EXTERN PetscLogEvent KSP_SetUp;
 PETSC_EXTERN PetscLogEvent KSP_Solve;
+PETSC_EXTERN PetscLogEvent KSP_MatSolve;
 PETSC_EXTERN PetscLogEvent KSP_Solve_FS_0;
 PETSC_EXTERN PetscLogEvent KSP_Solve_FS_1;
 PETSC_EXTERN PetscLogEvent KSP_Solve_FS_2;
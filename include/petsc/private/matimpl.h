@@ -1721,6 +1721,10 @@ PETSC_EXTERN PetscLogEvent MATMFFD_Mult;
 PETSC_EXTERN PetscLogEvent MAT_GetMultiProcBlock;
 PETSC_EXTERN PetscLogEvent MAT_CUSPARSECopyToGPU;
 PETSC_EXTERN PetscLogEvent MAT_SetValuesBatch;
+PETSC_EXTERN PetscLogEvent MAT_PreallCOO;
+PETSC_EXTERN PetscLogEvent MAT_SetValuesCOO;
+PETSC_EXTERN PetscLogEvent MAT_LevelSets;
+PETSC_EXTERN PetscLogEvent MAT_SolveLevels;
 PETSC_EXTERN PetscLogEvent MAT_ViennaCLCopyToGPU;
 PETSC_EXTERN PetscLogEvent MAT_DenseCopyToGPU;
 PETSC_EXTERN PetscLogEvent MAT_DenseCopyFromGPU;
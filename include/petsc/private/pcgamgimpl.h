@@ -42,6 +42,18 @@ typedef struct gamg_TAG {
   PetscReal *data;          /* [data_sz] blocked vector of vertex data on fine grid (coordinates/nullspace) */
   PetscReal *orig_data;          /* cache data */
 
+  /* coordinates for the space filling curve repartitioning */
+  PetscBool repart_sfc;
+  PetscInt  coords_dim;
+  PetscInt  coords_nloc;
+  PetscReal *coords;        /* [coords_nloc][coords_dim] coordinates of the fine grid vertices */
+  Vec       crs_coords;     /* coordinates of the vertices of the current grid during setup */
+
+  /* hierarchy read with PCLoad(), used by the next PCSetUp() */
+  PetscInt  load_nlevels;
+  Mat       *load_P,*load_A; /* [load_nlevels] prolongators to and operators of the coarse levels, from level 1 */
+  PetscBool load_ptap;       /* recompute the coarse operators */
+
   struct _PCGAMGOps *ops;
   char      *gamg_type_name;
 
@@ -66,6 +78,9 @@ PetscErrorCode PCDestroy_GAMG(PC);
 PetscErrorCode PCGAMGCreateGraph(Mat, Mat*);
 PetscErrorCode PCGAMGFilterGraph(Mat*, PetscReal, PetscBool);
 PetscErrorCode PCGAMGGetDataWithGhosts(Mat, PetscInt, PetscReal[],PetscInt*, PetscReal **);
+PETSC_INTERN PetscErrorCode PCGAMGGetGraphNumThreads(Mat,PetscInt*);
+PETSC_INTERN PetscErrorCode PCGAMGSetCoordinates_Private(PC,PetscInt,PetscInt,const PetscReal[]);
+PETSC_INTERN PetscErrorCode PCGAMGSetGraphNumThreads(Mat,PetscInt);
 
 #if defined PETSC_USE_LOG
 #define PETSC_GAMG_USE_LOG
@@ -7,6 +7,7 @@
 #include <petsc/private/hashseti.h>
 #include <petsc/private/hashmapi.h>
 #include <petscksp.h>
+#include <petsc/private/kernels/batcheddense.h>
 
 typedef struct {
   /* Topology */
@@ -98,8 +99,9 @@ typedef struct {
   IS                   iterationSet;       /* Index set specifying how we iterate over patches */
   PetscInt             currentPatch;       /* The current patch number when iterating */
   PetscObject         *solver;             /* Solvers for each patch TODO Do we need a new KSP for each patch? */
-  PetscBool            denseinverse;       /* Should the patch inverse by applied by computing the inverse and a matmult? (Skips KSP/PC etc...) */
-  PetscErrorCode      (*densesolve)(Mat, Vec, Vec); /* Matmult for dense solve (used with denseinverse) */
+  PetscBool            denseinverse;       /* Should the patch inverse by applied by factoring the dense patch matrices directly? (Skips KSP/PC etc...) */
+  PetscBatchedDense    densebatch;         /* LU factors of the patch matrices, several patches of the same size at a time (used with denseinverse) */
+  PetscScalar         *denseWork;          /* Right hand sides of all patches, ordered as gtol (used with denseinverse) */
   PetscErrorCode     (*setupsolver)(PC);
   PetscErrorCode     (*applysolver)(PC, PetscInt, Vec, Vec);
   PetscErrorCode     (*resetsolver)(PC);
@@ -23,6 +23,9 @@ PETSC_EXTERN PetscLogEvent PETSCSF_EmbedSF;
 PETSC_EXTERN PetscLogEvent PETSCSF_DistSect;
 PETSC_EXTERN PetscLogEvent PETSCSF_SectSF;
 PETSC_EXTERN PetscLogEvent PETSCSF_RemoteOff;
+PETSC_EXTERN PetscLogEvent PETSCSF_ReqsInit;
+PETSC_EXTERN PetscLogEvent PETSCSF_BatchBegin;
+PETSC_EXTERN PetscLogEvent PETSCSF_BatchEnd;
 
 typedef enum {PETSCSF_LEAF2ROOT_REDUCE=0, PETSCSF_ROOT2LEAF_BCAST=1} PetscSFDirection;
 typedef enum {PETSC_MEMTYPE_HOST=0, PETSC_MEMTYPE_DEVICE=1} PetscMemType;
@@ -84,6 +87,7 @@ struct _p_PetscSF {
   PetscSFPattern  pattern;         /* Pattern of the graph */
   PetscLayout     map;             /* Layout of leaves over all processes when building a patterned graph */
   PetscBool       use_pinned_buf;  /* Whether use pinned (i.e., non-pagable) host memory for send/recv buffers */
+  PetscInt        nthreads;        /* Number of OpenMP threads of the host pack/unpack routines */
 #if defined(PETSC_HAVE_CUDA)
   PetscInt        *rmine_d;        /* A copy of rmine in device memory */
   PetscInt        maxResidentThreadsPerGPU;
@@ -288,6 +288,7 @@ PETSC_EXTERN PetscErrorCode VecScatterGetRemote_Private(VecScatter,PetscBool,Pet
 PETSC_EXTERN PetscErrorCode VecScatterGetRemoteOrdered_Private(VecScatter,PetscBool,PetscInt*,const PetscInt**,const PetscInt**,const PetscMPIInt**,PetscInt*);
 PETSC_EXTERN PetscErrorCode VecScatterRestoreRemote_Private(VecScatter,PetscBool,PetscInt*,const PetscInt**,const PetscInt**,const PetscMPIInt**,PetscInt*);
 PETSC_EXTERN PetscErrorCode VecScatterRestoreRemoteOrdered_Private(VecScatter,PetscBool,PetscInt*,const PetscInt**,const PetscInt**,const PetscMPIInt**,PetscInt*);
+PETSC_EXTERN PetscErrorCode VecScatterGetSF_Private(VecScatter,PetscSF*,MPI_Datatype*);
 
 typedef struct _VecScatterOps *VecScatterOps;
 struct _VecScatterOps {
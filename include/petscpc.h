@@ -44,6 +44,7 @@ PETSC_EXTERN PetscErrorCode PCGetFailedReason(PC,PCFailedReason*);
 PETSC_DEPRECATED_FUNCTION("Use PCGetFailedReason() (since version 3.11)") PETSC_STATIC_INLINE PetscErrorCode PCGetSetUpFailedReason(PC pc,PCFailedReason *reason) {return PCGetFailedReason(pc,reason);}
 PETSC_EXTERN PetscErrorCode PCSetUpOnBlocks(PC);
 PETSC_EXTERN PetscErrorCode PCApply(PC,Vec,Vec);
+PETSC_EXTERN PetscErrorCode PCMatApply(PC,Mat,Mat);
 PETSC_EXTERN PetscErrorCode PCApplySymmetricLeft(PC,Vec,Vec);
 PETSC_EXTERN PetscErrorCode PCApplySymmetricRight(PC,Vec,Vec);
 PETSC_EXTERN PetscErrorCode PCApplyBAorAB(PC,PCSide,Vec,Vec,Vec);
@@ -294,6 +295,7 @@ PETSC_EXTERN PetscErrorCode PCGAMGGetType( PC,PCGAMGType*);
 PETSC_EXTERN PetscErrorCode PCGAMGSetProcEqLim(PC,PetscInt);
 
 PETSC_EXTERN PetscErrorCode PCGAMGSetRepartition(PC,PetscBool);
+PETSC_EXTERN PetscErrorCode PCGAMGSetRepartitionSFC(PC,PetscBool);
 PETSC_EXTERN PetscErrorCode PCGAMGSetUseSAEstEig(PC,PetscBool);
 PETSC_EXTERN PetscErrorCode PCGAMGSetEstEigKSPMaxIt(PC,PetscInt);
 PETSC_EXTERN PetscErrorCode PCGAMGSetEstEigKSPType(PC,char[]);
@@ -65,6 +65,7 @@ typedef const char* PCType;
 #define PCSAVIENNACL      "saviennacl"
 #define PCBDDC            "bddc"
 #define PCKACZMARZ        "kaczmarz"
+#define PCCHOWILU         "chowilu"
 #define PCTELESCOPE       "telescope"
 #define PCPATCH           "patch"
 #define PCLMVM            "lmvm"
@@ -25,6 +25,7 @@ typedef const char *PetscSFType;
 #define PETSCSFGATHER     "gather"
 #define PETSCSFALLTOALL   "alltoall"
 #define PETSCSFWINDOW     "window"
+#define PETSCSFSHM        "shm"
 
 /*E
    PetscSFPattern - Pattern of the PetscSF graph
@@ -150,6 +151,16 @@ PETSC_EXTERN PetscErrorCode PetscSFScatterBegin(PetscSF,MPI_Datatype,const void*
 PETSC_EXTERN PetscErrorCode PetscSFScatterEnd(PetscSF,MPI_Datatype,const void*,void*)
   PetscAttrMPIPointerWithType(3,2) PetscAttrMPIPointerWithType(4,2);
 
+/* Group several broadcasts and reductions into one exchange */
+PETSC_EXTERN PetscErrorCode PetscSFBatchCreate(MPI_Comm,PetscSFBatch*);
+PETSC_EXTERN PetscErrorCode PetscSFBatchDestroy(PetscSFBatch*);
+PETSC_EXTERN PetscErrorCode PetscSFBatchAddBcastAndOp(PetscSFBatch,PetscSF,MPI_Datatype,const void*,void*,MPI_Op)
+  PetscAttrMPIPointerWithType(4,3) PetscAttrMPIPointerWithType(5,3);
+PETSC_EXTERN PetscErrorCode PetscSFBatchAddReduce(PetscSFBatch,PetscSF,MPI_Datatype,const void*,void*,MPI_Op)
+  PetscAttrMPIPointerWithType(4,3) PetscAttrMPIPointerWithType(5,3);
+PETSC_EXTERN PetscErrorCode PetscSFBatchBegin(PetscSFBatch);
+PETSC_EXTERN PetscErrorCode PetscSFBatchEnd(PetscSFBatch);
+
 PETSC_EXTERN PetscErrorCode PetscSFCompose(PetscSF,PetscSF,PetscSF*);
 PETSC_EXTERN PetscErrorCode PetscSFComposeInverse(PetscSF,PetscSF,PetscSF*);
 
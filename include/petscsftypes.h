@@ -14,6 +14,16 @@
 S*/
 typedef struct _p_PetscSF* PetscSF;
 
+/*S
+   PetscSFBatch - a queue of PetscSF broadcasts and reductions, possibly on different star forests and with different units, that are
+   communicated together with one message per pair of neighbors
+
+   Level: advanced
+
+.seealso: PetscSFBatchCreate(), PetscSFBatchAddBcastAndOp(), PetscSFBatchAddReduce(), PetscSFBatchBegin(), PetscSFBatchEnd()
+S*/
+typedef struct _n_PetscSFBatch* PetscSFBatch;
+
 /*S
    PetscSFNode - specifier of owner and index
 
@@ -13,8 +13,11 @@ int main(int argc,char **argv)
   Vec                    local,global,globals[2],buffer;
   PetscScalar            value;
   PetscViewer            viewer;
+  PetscBool              overlap = PETSC_FALSE;
+  PetscReal              norm;
 
   ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetBool(NULL,NULL,"-overlap",&overlap,NULL);CHKERRQ(ierr);
 
   ierr = DMCompositeCreate(PETSC_COMM_WORLD,&packer);CHKERRQ(ierr);
   ierr = DMDACreate1d(PETSC_COMM_WORLD,DM_BOUNDARY_NONE,8,1,1,NULL,&da1);CHKERRQ(ierr);
@@ -42,8 +45,25 @@ int main(int argc,char **argv)
   ierr = DMCompositeRestoreAccessArray(packer,global,2,NULL,globals);CHKERRQ(ierr);
 
   /* Test GlobalToLocal in insert mode */
-  ierr = DMGlobalToLocalBegin(packer,global,INSERT_VALUES,local);CHKERRQ(ierr);
-  ierr = DMGlobalToLocalEnd(packer,global,INSERT_VALUES,local);CHKERRQ(ierr);
+  if (overlap) {
+    /* a second GlobalToLocal started before the first one ends, ended in the reverse order */
+    Vec global2;
+
+    ierr = VecDuplicate(global,&global2);CHKERRQ(ierr);
+    ierr = VecCopy(global,global2);CHKERRQ(ierr);
+    ierr = VecScale(global2,2.0);CHKERRQ(ierr);
+    ierr = DMGlobalToLocalBegin(packer,global,INSERT_VALUES,local);CHKERRQ(ierr);
+    ierr = DMGlobalToLocalBegin(packer,global2,INSERT_VALUES,buffer);CHKERRQ(ierr);
+    ierr = DMGlobalToLocalEnd(packer,global2,INSERT_VALUES,buffer);CHKERRQ(ierr);
+    ierr = DMGlobalToLocalEnd(packer,global,INSERT_VALUES,local);CHKERRQ(ierr);
+    ierr = VecAXPY(buffer,-2.0,local);CHKERRQ(ierr);
+    ierr = VecNorm(buffer,NORM_INFINITY,&norm);CHKERRQ(ierr);
+    if (norm > 0.0) {ierr = PetscPrintf(PETSC_COMM_SELF,"[%d] Wrong local values of the overlapping GlobalToLocal: %g\n",rank,(double)norm);CHKERRQ(ierr);}
+    ierr = VecDestroy(&global2);CHKERRQ(ierr);
+  } else {
+    ierr = DMGlobalToLocalBegin(packer,global,INSERT_VALUES,local);CHKERRQ(ierr);
+    ierr = DMGlobalToLocalEnd(packer,global,INSERT_VALUES,local);CHKERRQ(ierr);
+  }
 
   ierr = PetscViewerASCIIPushSynchronized(PETSC_VIEWER_STDOUT_WORLD);CHKERRQ(ierr);
   ierr = PetscViewerASCIISynchronizedPrintf(PETSC_VIEWER_STDOUT_WORLD,"\nLocal Vector: processor %d\n",rank);CHKERRQ(ierr);
@@ -89,4 +109,10 @@ int main(int argc,char **argv)
    test:
       nsize: 3
 
+   test:
+      suffix: overlap
+      nsize: 3
+      output_file: output/ex44_1.out
+      args: -overlap
+
 TEST*/
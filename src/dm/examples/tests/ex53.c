@@ -0,0 +1,63 @@
+static char help[] = "Tests DMGlobalToLocal() and DMLocalToGlobal() with ADD_VALUES on a 3D DMDA, whose ghost exchanges are boxes of strided runs.\n\n";
+
+#include <petscdm.h>
+#include <petscdmda.h>
+
+int main(int argc,char **argv)
+{
+  DM             da;
+  Vec            local,global;
+  PetscScalar    ****g,****l,sum;
+  PetscInt       M = 12,N = 11,P = 10,dof = 2,s = 1,i,j,k,c,xs,ys,zs,xm,ym,zm,gxs,gys,gzs,gxm,gym,gzm,nerr = 0,tnerr;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-dof",&dof,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-s",&s,NULL);CHKERRQ(ierr);
+  ierr = DMDACreate3d(PETSC_COMM_WORLD,DM_BOUNDARY_NONE,DM_BOUNDARY_NONE,DM_BOUNDARY_NONE,DMDA_STENCIL_BOX,M,N,P,PETSC_DECIDE,PETSC_DECIDE,PETSC_DECIDE,dof,s,NULL,NULL,NULL,&da);CHKERRQ(ierr);
+  ierr = DMSetFromOptions(da);CHKERRQ(ierr);
+  ierr = DMSetUp(da);CHKERRQ(ierr);
+  ierr = DMCreateGlobalVector(da,&global);CHKERRQ(ierr);
+  ierr = DMCreateLocalVector(da,&local);CHKERRQ(ierr);
+  ierr = DMDAGetCorners(da,&xs,&ys,&zs,&xm,&ym,&zm);CHKERRQ(ierr);
+  ierr = DMDAGetGhostCorners(da,&gxs,&gys,&gzs,&gxm,&gym,&gzm);CHKERRQ(ierr);
+
+  /* each entry holds its natural index, so every ghost received can be checked */
+  ierr = DMDAVecGetArrayDOF(da,global,&g);CHKERRQ(ierr);
+  for (k=zs; k<zs+zm; k++) for (j=ys; j<ys+ym; j++) for (i=xs; i<xs+xm; i++) for (c=0; c<dof; c++) g[k][j][i][c] = c + dof*(i + M*(j + N*k));
+  ierr = DMDAVecRestoreArrayDOF(da,global,&g);CHKERRQ(ierr);
+  ierr = VecSet(local,-1.0);CHKERRQ(ierr);
+  ierr = DMGlobalToLocalBegin(da,global,INSERT_VALUES,local);CHKERRQ(ierr);
+  ierr = DMGlobalToLocalEnd(da,global,INSERT_VALUES,local);CHKERRQ(ierr);
+  ierr = DMDAVecGetArrayDOF(da,local,&l);CHKERRQ(ierr);
+  for (k=gzs; k<gzs+gzm; k++) for (j=gys; j<gys+gym; j++) for (i=gxs; i<gxs+gxm; i++) for (c=0; c<dof; c++) {
+    if (l[k][j][i][c] != (PetscScalar)(c + dof*(i + M*(j + N*k)))) nerr++;
+  }
+  ierr = MPIU_Allreduce(&nerr,&tnerr,1,MPIU_INT,MPI_SUM,PETSC_COMM_WORLD);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"Wrong ghost values after DMGlobalToLocal(): %D\n",tnerr);CHKERRQ(ierr);
+
+  /* every copy of an entry, ghost or not, contributes its natural index to the sum */
+  ierr = VecSet(global,0.0);CHKERRQ(ierr);
+  ierr = DMLocalToGlobalBegin(da,local,ADD_VALUES,global);CHKERRQ(ierr);
+  ierr = DMLocalToGlobalEnd(da,local,ADD_VALUES,global);CHKERRQ(ierr);
+  ierr = VecSum(global,&sum);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"Sum after DMLocalToGlobal() with ADD_VALUES: %D\n",(PetscInt)PetscRealPart(sum));CHKERRQ(ierr);
+
+  ierr = VecDestroy(&local);CHKERRQ(ierr);
+  ierr = VecDestroy(&global);CHKERRQ(ierr);
+  ierr = DMDestroy(&da);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      nsize: 8
+
+   test:
+      suffix: 2
+      nsize: 8
+      args: -s 2 -dof 3
+
+TEST*/
@@ -52,6 +52,7 @@ PetscErrorCode  DMDestroy_Composite(DM dm)
     ierr = PetscFree(prev->grstarts);CHKERRQ(ierr);
     ierr = PetscFree(prev);CHKERRQ(ierr);
   }
+  ierr = PetscSFBatchDestroy(&com->batch);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)dm,"DMSetUpGLVisViewer_C",NULL);CHKERRQ(ierr);
   /* This was originally freed in DMDestroy(), but that prevents reference counting of backend objects */
   ierr = PetscFree(com);CHKERRQ(ierr);
@@ -1618,6 +1619,8 @@ PetscErrorCode  DMGlobalToLocalBegin_Composite(DM dm,Vec gvec,InsertMode mode,Ve
   struct DMCompositeLink *next;
   PetscScalar            *garray,*larray;
   DM_Composite           *com = (DM_Composite*)dm->data;
+  PetscBool              usebatch;
+  PetscInt               nbatched = 0;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(dm,DM_CLASSID,1);
@@ -1629,12 +1632,32 @@ PetscErrorCode  DMGlobalToLocalBegin_Composite(DM dm,Vec gvec,InsertMode mode,Ve
 
   ierr = VecGetArray(gvec,&garray);CHKERRQ(ierr);
   ierr = VecGetArray(lvec,&larray);CHKERRQ(ierr);
+  /* while another DMGlobalToLocal() of this DM is in progress in the batch, this one is done DM by DM */
+  usebatch = (mode == INSERT_VALUES && !com->batchlvec) ? PETSC_TRUE : PETSC_FALSE;
+  if (usebatch && !com->batch) {ierr = PetscSFBatchCreate(PetscObjectComm((PetscObject)dm),&com->batch);CHKERRQ(ierr);}
 
   /* loop over packed objects, handling one at at time */
   next = com->next;
   while (next) {
-    Vec      local,global;
-    PetscInt N;
+    Vec          local,global;
+    PetscInt     N;
+    PetscSF      sf = NULL;
+    MPI_Datatype unit;
+    PetscMPIInt  flag;
+
+    /* the packed objects whose scatter is a star forest are exchanged together in DMGlobalToLocalEnd_Composite() */
+    if (usebatch && !next->dm->gtolhook && next->dm->ops->getglobaltolocalsf) {
+      ierr = MPI_Comm_compare(PetscObjectComm((PetscObject)dm),PetscObjectComm((PetscObject)next->dm),&flag);CHKERRQ(ierr);
+      if (flag == MPI_IDENT || flag == MPI_CONGRUENT) {ierr = (*next->dm->ops->getglobaltolocalsf)(next->dm,&sf,&unit);CHKERRQ(ierr);}
+    }
+    if (sf) {
+      ierr    = PetscSFBatchAddBcastAndOp(com->batch,sf,unit,garray,larray,MPIU_REPLACE);CHKERRQ(ierr);
+      nbatched++;
+      larray += next->nlocal;
+      garray += next->n;
+      next    = next->next;
+      continue;
+    }
 
     ierr = DMGetGlobalVector(next->dm,&global);CHKERRQ(ierr);
     ierr = VecGetLocalSize(global,&N);CHKERRQ(ierr);
@@ -1652,6 +1675,10 @@ PetscErrorCode  DMGlobalToLocalBegin_Composite(DM dm,Vec gvec,InsertMode mode,Ve
     garray += next->n;
     next    = next->next;
   }
+  if (nbatched) {
+    ierr           = PetscSFBatchBegin(com->batch);CHKERRQ(ierr);
+    com->batchlvec = lvec;
+  }
 
   ierr = VecRestoreArray(gvec,NULL);CHKERRQ(ierr);
   ierr = VecRestoreArray(lvec,NULL);CHKERRQ(ierr);
@@ -1660,10 +1687,22 @@ PetscErrorCode  DMGlobalToLocalBegin_Composite(DM dm,Vec gvec,InsertMode mode,Ve
 
 PetscErrorCode  DMGlobalToLocalEnd_Composite(DM dm,Vec gvec,InsertMode mode,Vec lvec)
 {
+  PetscErrorCode ierr;
+  PetscScalar    *larray;
+  DM_Composite   *com = (DM_Composite*)dm->data;
+
   PetscFunctionBegin;
   PetscValidHeaderSpecific(dm,DM_CLASSID,1);
   PetscValidHeaderSpecific(gvec,VEC_CLASSID,2);
   PetscValidHeaderSpecific(lvec,VEC_CLASSID,4);
+  /* nothing to do unless DMGlobalToLocalBegin_Composite() started the batch for lvec */
+  if (lvec == com->batchlvec) {
+    /* the batch writes into the array of lvec it was given in DMGlobalToLocalBegin_Composite() */
+    ierr           = VecGetArray(lvec,&larray);CHKERRQ(ierr);
+    ierr           = PetscSFBatchEnd(com->batch);CHKERRQ(ierr);
+    ierr           = VecRestoreArray(lvec,&larray);CHKERRQ(ierr);
+    com->batchlvec = NULL;
+  }
   PetscFunctionReturn(0);
 }
 
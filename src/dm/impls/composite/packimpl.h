@@ -3,6 +3,7 @@
 
 #include <petscdmcomposite.h>    /*I "petscdmcomposite.h" I*/
 #include <petsc/private/dmimpl.h>      /*I      "petscdm.h"     I*/
+#include <petscsf.h>
 
 /*
    rstart is where an array/subvector starts in the global parallel vector, so arrays
@@ -27,6 +28,8 @@ typedef struct {
   PetscInt               nDM,nmine;            /* how many DM's and separate redundant arrays used to build DM(nmine is ones on this process) */
   PetscBool              setup;                /* after this is set, cannot add new links to the DM*/
   struct DMCompositeLink *next;
+  PetscSFBatch           batch;                /* groups the global to local star forests of the DMs in one exchange */
+  Vec                    batchlvec;            /* local vector of the DMGlobalToLocal() in progress in batch, NULL if batch is not in use */
 
   PetscErrorCode (*FormCoupleLocations)(DM,Mat,PetscInt*,PetscInt*,PetscInt,PetscInt,PetscInt,PetscInt);
 } DM_Composite;
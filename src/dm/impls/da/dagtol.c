@@ -3,6 +3,7 @@
 */
 
 #include <petsc/private/dmdaimpl.h>    /*I   "petscdmda.h"   I*/
+#include <petsc/private/vecscatterimpl.h>
 
 PetscErrorCode  DMGlobalToLocalBegin_DA(DM da,Vec g,InsertMode mode,Vec l)
 {
@@ -30,6 +31,18 @@ PetscErrorCode  DMGlobalToLocalEnd_DA(DM da,Vec g,InsertMode mode,Vec l)
   PetscFunctionReturn(0);
 }
 
+/* The star forest of the global to local scatter, when it has one, so that DMComposite can batch it with others */
+PetscErrorCode  DMGlobalToLocalGetSF_DA(DM da,PetscSF *sf,MPI_Datatype *unit)
+{
+  PetscErrorCode ierr;
+  DM_DA          *dd = (DM_DA*)da->data;
+
+  PetscFunctionBegin;
+  *sf = NULL;
+  if (dd->gtol) {ierr = VecScatterGetSF_Private(dd->gtol,sf,unit);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode  DMLocalToGlobalBegin_DA(DM da,Vec l,InsertMode mode,Vec g)
 {
   PetscErrorCode ierr;
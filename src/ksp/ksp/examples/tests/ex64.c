@@ -0,0 +1,158 @@
+static char help[] = "Tests KSPMatSolve() with a block of right-hand sides against KSPSolve() with each column.\n\n\
+  -m <m>       : grid size in each direction of the 2d Laplacian\n\
+  -N <N>       : number of right-hand sides\n\
+  -duplicate   : the last right-hand side is a copy of the first one\n\
+  -nonzero_guess : use the right-hand sides as initial guesses\n\n";
+
+#include <petscksp.h>
+
+int main(int argc,char **argv)
+{
+  KSP                ksp;
+  Mat                A,B,X,Y;
+  Vec                b,x,y;
+  PetscInt           m = 8,N = 4,i,j,k,Istart,Iend,ldb,ldx,ldy;
+  PetscScalar        v,*ba,*xa,*ya;
+  PetscReal          norm,bnorm,err = 0.0,res = 0.0,rtol;
+  PetscBool          duplicate = PETSC_FALSE,nonzero_guess = PETSC_FALSE;
+  KSPConvergedReason reason;
+  PetscErrorCode     ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-N",&N,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetBool(NULL,NULL,"-duplicate",&duplicate,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetBool(NULL,NULL,"-nonzero_guess",&nonzero_guess,NULL);CHKERRQ(ierr);
+
+  ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,m*m,m*m);CHKERRQ(ierr);
+  ierr = MatSetFromOptions(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(A,5,NULL);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation(A,5,NULL,5,NULL);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(A,&Istart,&Iend);CHKERRQ(ierr);
+  for (k=Istart; k<Iend; k++) {
+    i = k/m; j = k - i*m;
+    if (i>0)   {ierr = MatSetValue(A,k,k-m,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (i<m-1) {ierr = MatSetValue(A,k,k+m,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (j>0)   {ierr = MatSetValue(A,k,k-1,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (j<m-1) {ierr = MatSetValue(A,k,k+1,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    ierr = MatSetValue(A,k,k,4.0+0.1*j,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+  /* right-hand sides with different smooth and oscillating components */
+  ierr = MatCreateDense(PETSC_COMM_WORLD,Iend-Istart,PETSC_DECIDE,m*m,N,NULL,&B);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(B,&ba);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(B,&ldb);CHKERRQ(ierr);
+  for (j=0; j<N; j++) {
+    for (k=Istart; k<Iend; k++) {
+      v = PetscSinReal((PetscReal)(j+1)*(k+1)/(m*m)) + (PetscReal)((k*(j+3))%7)/7.0;
+      if (duplicate && j == N-1) v = PetscSinReal((PetscReal)(k+1)/(m*m)) + (PetscReal)((k*3)%7)/7.0;
+      ba[k-Istart+j*ldb] = v;
+    }
+  }
+  ierr = MatDenseRestoreArray(B,&ba);CHKERRQ(ierr);
+  ierr = MatAssemblyBegin(B,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(B,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&X);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&Y);CHKERRQ(ierr);
+  if (nonzero_guess) {
+    ierr = MatCopy(B,X,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+    ierr = MatCopy(B,Y,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+  }
+
+  ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);CHKERRQ(ierr);
+  ierr = KSPSetOperators(ksp,A,A);CHKERRQ(ierr);
+  ierr = KSPSetTolerances(ksp,1.e-10,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT);CHKERRQ(ierr);
+  ierr = KSPSetInitialGuessNonzero(ksp,nonzero_guess);CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ksp);CHKERRQ(ierr);
+  ierr = KSPGetTolerances(ksp,&rtol,NULL,NULL,NULL);CHKERRQ(ierr);
+
+  ierr = KSPMatSolve(ksp,B,X);CHKERRQ(ierr);
+  ierr = KSPGetConvergedReason(ksp,&reason);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"KSPMatSolve() with %D right-hand sides: %s\n",N,KSPConvergedReasons[reason]);CHKERRQ(ierr);
+
+  /* compare with the solutions of the individual systems and check the true residuals */
+  ierr = MatCreateVecs(A,&x,&b);CHKERRQ(ierr);
+  ierr = VecDuplicate(x,&y);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Y,&ldy);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(B,&ba);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(Y,&ya);CHKERRQ(ierr);
+  for (j=0; j<N; j++) {
+    ierr = VecPlaceArray(b,ba+j*ldb);CHKERRQ(ierr);
+    ierr = VecPlaceArray(x,xa+j*ldx);CHKERRQ(ierr);
+    ierr = VecPlaceArray(y,ya+j*ldy);CHKERRQ(ierr);
+    ierr = KSPSolve(ksp,b,y);CHKERRQ(ierr);
+    ierr = VecNorm(b,NORM_2,&bnorm);CHKERRQ(ierr);
+    ierr = VecAXPY(y,-1.0,x);CHKERRQ(ierr);
+    ierr = VecNorm(y,NORM_2,&norm);CHKERRQ(ierr);
+    err  = PetscMax(err,norm/bnorm);
+    ierr = MatMult(A,x,y);CHKERRQ(ierr);
+    ierr = VecAXPY(y,-1.0,b);CHKERRQ(ierr);
+    ierr = VecNorm(y,NORM_2,&norm);CHKERRQ(ierr);
+    res  = PetscMax(res,norm/bnorm);
+    ierr = VecResetArray(b);CHKERRQ(ierr);
+    ierr = VecResetArray(x);CHKERRQ(ierr);
+    ierr = VecResetArray(y);CHKERRQ(ierr);
+  }
+  ierr = MatDenseRestoreArray(B,&ba);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(Y,&ya);CHKERRQ(ierr);
+  if (res > 1.e3*rtol) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Largest relative residual %g\n",(double)res);CHKERRQ(ierr);
+  }
+  if (err > 1.e3*rtol) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Largest relative difference with KSPSolve() %g\n",(double)err);CHKERRQ(ierr);
+  }
+
+  ierr = VecDestroy(&b);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = MatDestroy(&X);CHKERRQ(ierr);
+  ierr = MatDestroy(&Y);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      suffix: cg
+      nsize: 2
+      args: -ksp_type cg -pc_type {{jacobi bjacobi}} -duplicate {{0 1}}
+      output_file: output/ex64_1.out
+
+   test:
+      suffix: cg_guess
+      args: -ksp_type cg -pc_type ilu -nonzero_guess -ksp_norm_type {{preconditioned unpreconditioned natural}}
+      output_file: output/ex64_1.out
+
+   test:
+      suffix: gmres
+      nsize: 2
+      args: -ksp_type gmres -ksp_pc_side {{left right}} -ksp_gmres_restart 4 -pc_type bjacobi -duplicate {{0 1}}
+      output_file: output/ex64_1.out
+
+   test:
+      suffix: preonly
+      args: -ksp_type preonly -pc_type {{lu cholesky}}
+      output_file: output/ex64_preonly.out
+
+   test:
+      suffix: cg_sor
+      nsize: {{1 2}}
+      args: -ksp_type cg -pc_type sor -pc_sor_omega {{1 1.2}}
+      output_file: output/ex64_1.out
+
+   test:
+      suffix: basic
+      args: -ksp_type bcgs -pc_type sor
+      output_file: output/ex64_1.out
+
+TEST*/
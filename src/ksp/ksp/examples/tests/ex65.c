@@ -0,0 +1,111 @@
+static char help[] = "Solves a sequence of slowly varying convection-diffusion systems with the same KSP, as in a time stepping loop.\n\
+Used to test the recycling of subspaces between solves in KSPGCRODR.\n\n\
+  -m <m>       : grid size in each direction\n\
+  -nsteps <n>  : number of systems in the sequence\n\n";
+
+#include <petscksp.h>
+
+int main(int argc,char **argv)
+{
+  KSP                ksp;
+  Mat                A;
+  Vec                b,x,r;
+  PetscInt           m = 24,nsteps = 5,i,j,k,s,Istart,Iend,its,total = 0;
+  PetscReal          h,dt,norm,bnorm,rtol;
+  PetscScalar        v;
+  KSPConvergedReason reason;
+  PetscErrorCode     ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-nsteps",&nsteps,NULL);CHKERRQ(ierr);
+  h    = 1.0/(m+1);
+
+  ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,m*m,m*m);CHKERRQ(ierr);
+  ierr = MatSetFromOptions(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(A,5,NULL);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation(A,5,NULL,5,NULL);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(A,&Istart,&Iend);CHKERRQ(ierr);
+  ierr = MatCreateVecs(A,&x,&b);CHKERRQ(ierr);
+  ierr = VecDuplicate(b,&r);CHKERRQ(ierr);
+
+  ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);CHKERRQ(ierr);
+  ierr = KSPSetOperators(ksp,A,A);CHKERRQ(ierr);
+  ierr = KSPSetTolerances(ksp,1.e-8,PETSC_DEFAULT,PETSC_DEFAULT,1000);CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ksp);CHKERRQ(ierr);
+  ierr = KSPGetTolerances(ksp,&rtol,NULL,NULL,NULL);CHKERRQ(ierr);
+
+  for (s=0; s<nsteps; s++) {
+    /* the time step and the right-hand side change slightly from one system to the next */
+    dt = 0.5 + 0.05*s;
+    for (k=Istart; k<Iend; k++) {
+      i = k/m; j = k - i*m;
+      if (i>0)   {ierr = MatSetValue(A,k,k-m,-1.0-5.0*h,INSERT_VALUES);CHKERRQ(ierr);}
+      if (i<m-1) {ierr = MatSetValue(A,k,k+m,-1.0+5.0*h,INSERT_VALUES);CHKERRQ(ierr);}
+      if (j>0)   {ierr = MatSetValue(A,k,k-1,-1.0-10.0*h,INSERT_VALUES);CHKERRQ(ierr);}
+      if (j<m-1) {ierr = MatSetValue(A,k,k+1,-1.0+10.0*h,INSERT_VALUES);CHKERRQ(ierr);}
+      ierr = MatSetValue(A,k,k,4.0+h*h/dt,INSERT_VALUES);CHKERRQ(ierr);
+      v    = PetscSinReal(PETSC_PI*(i+1)*h)*PetscSinReal(PETSC_PI*(j+1)*h)*(1.0+0.1*s) + 0.1*PetscCosReal(0.3*s+k*h);
+      ierr = VecSetValue(b,k,v,INSERT_VALUES);CHKERRQ(ierr);
+    }
+    ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+    ierr = VecAssemblyBegin(b);CHKERRQ(ierr);
+    ierr = VecAssemblyEnd(b);CHKERRQ(ierr);
+
+    ierr = KSPSolve(ksp,b,x);CHKERRQ(ierr);
+    ierr = KSPGetConvergedReason(ksp,&reason);CHKERRQ(ierr);
+    ierr = KSPGetIterationNumber(ksp,&its);CHKERRQ(ierr);
+    total += its;
+
+    /* check the true residual */
+    ierr = MatMult(A,x,r);CHKERRQ(ierr);
+    ierr = VecAXPY(r,-1.0,b);CHKERRQ(ierr);
+    ierr = VecNorm(r,NORM_2,&norm);CHKERRQ(ierr);
+    ierr = VecNorm(b,NORM_2,&bnorm);CHKERRQ(ierr);
+    if (reason < 0 || norm > 1.e3*rtol*bnorm) {
+      ierr = PetscPrintf(PETSC_COMM_WORLD,"System %D: %s, relative residual %g\n",s,KSPConvergedReasons[reason],(double)(norm/bnorm));CHKERRQ(ierr);
+    }
+  }
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"Average number of iterations %D\n",total/nsteps);CHKERRQ(ierr);
+
+  ierr = VecDestroy(&b);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&r);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      suffix: gmres
+      args: -ksp_type gmres -pc_type none -nsteps 8
+
+   test:
+      suffix: gcrodr
+      args: -ksp_type gcrodr -pc_type none -nsteps 8 -ksp_pc_side {{left right}}
+      output_file: output/ex65_gcrodr.out
+
+   test:
+      suffix: gcrodr_bjacobi
+      nsize: 2
+      args: -ksp_type gcrodr -pc_type bjacobi -ksp_gmres_restart 20 -ksp_gcrodr_recycle 5 -ksp_pc_side {{left right}}
+      output_file: output/ex65_gcrodr_bjacobi.out
+
+   test:
+      suffix: ir
+      requires: !complex !single
+      args: -ksp_type ir -ir_pc_type ilu -nsteps 8
+
+   test:
+      suffix: ir_mpi
+      nsize: 3
+      requires: !complex !single
+      args: -ksp_type ir -ir_pc_type bjacobi -nsteps 8
+      output_file: output/ex65_ir.out
+
+TEST*/
@@ -0,0 +1,93 @@
+static char help[] = "Tests KSPChebyshevEstEigSetReuse(): the eigenvalues are estimated again only when the operator changes enough.\n\n";
+
+#include <petscksp.h>
+
+static PetscErrorCode CountEstimates(KSP kspest,PetscInt it,PetscReal rnorm,void *ctx)
+{
+  PetscInt *count = (PetscInt*)ctx;
+
+  PetscFunctionBegin;
+  if (!it) (*count)++;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode SolveAndReport(KSP ksp,Vec b,Vec x,PetscInt *count,const char *change)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = KSPSolve(ksp,b,x);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"%s: eigenvalues estimated %D times\n",change,*count);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+int main(int argc,char **argv)
+{
+  KSP            ksp,kspest;
+  PC             pc;
+  Mat            A;
+  Vec            b,x;
+  PetscInt       m = 20,i,j,k,Istart,Iend,count = 0;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL);CHKERRQ(ierr);
+  ierr = MatCreateAIJ(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,m*m,m*m,5,NULL,5,NULL,&A);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(A,&Istart,&Iend);CHKERRQ(ierr);
+  for (k=Istart; k<Iend; k++) {
+    i = k/m; j = k - i*m;
+    if (i>0)   {ierr = MatSetValue(A,k,k-m,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (i<m-1) {ierr = MatSetValue(A,k,k+m,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (j>0)   {ierr = MatSetValue(A,k,k-1,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (j<m-1) {ierr = MatSetValue(A,k,k+1,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    ierr = MatSetValue(A,k,k,4.0,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatCreateVecs(A,&x,&b);CHKERRQ(ierr);
+  ierr = VecSet(b,1.0);CHKERRQ(ierr);
+
+  ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);CHKERRQ(ierr);
+  ierr = KSPSetOperators(ksp,A,A);CHKERRQ(ierr);
+  ierr = KSPSetType(ksp,KSPCHEBYSHEV);CHKERRQ(ierr);
+  ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
+  ierr = PCSetType(pc,PCJACOBI);CHKERRQ(ierr);
+  ierr = KSPSetTolerances(ksp,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT,5);CHKERRQ(ierr);
+  ierr = KSPChebyshevEstEigSetReuse(ksp,0.05);CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ksp);CHKERRQ(ierr);
+  ierr = KSPChebyshevEstEigGetKSP(ksp,&kspest);CHKERRQ(ierr);
+  if (kspest) {ierr = KSPMonitorSet(kspest,CountEstimates,&count,NULL);CHKERRQ(ierr);}
+
+  ierr = SolveAndReport(ksp,b,x,&count,"Initial operator");CHKERRQ(ierr);
+  /* the preconditioned operator does not change */
+  ierr = MatScale(A,1.5);CHKERRQ(ierr);
+  ierr = SolveAndReport(ksp,b,x,&count,"Scaled operator");CHKERRQ(ierr);
+  /* a small change of the spectrum */
+  ierr = MatShift(A,0.03);CHKERRQ(ierr);
+  ierr = SolveAndReport(ksp,b,x,&count,"Slightly shifted operator");CHKERRQ(ierr);
+  /* a large change of the spectrum, the warm started estimator runs again */
+  ierr = MatShift(A,6.0);CHKERRQ(ierr);
+  ierr = SolveAndReport(ksp,b,x,&count,"Shifted operator");CHKERRQ(ierr);
+  ierr = SolveAndReport(ksp,b,x,&count,"Same operator");CHKERRQ(ierr);
+
+  ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&b);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      nsize: {{1 3}}
+      output_file: output/ex66_1.out
+
+   test:
+      suffix: mg
+      nsize: 2
+      args: -ksp_type cg -pc_type gamg -pc_gamg_reuse_interpolation -pc_gamg_use_sa_esteig 0 -mg_levels_ksp_chebyshev_esteig_reuse_rtol 0.05 -info -info_exclude null,vec,mat,pc,sys
+      filter: grep -o -e "Reusing the eigenvalue estimates" -e "Estimating the eigenvalues again" | sort | uniq -c
+
+TEST*/
@@ -224,6 +224,43 @@ int main(int argc,char **args)
       nsize: 2
       args: -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always
 
+   test:
+      suffix: gmres_preallocate
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_gmres_cgs_refinement_type refine_always -ksp_gmres_preallocate
+
+   test:
+      suffix: gmres_mgs
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_gmres_modifiedgramschmidt -ksp_gmres_preallocate {{0 1}}
+      output_file: output/ex2_gmres_mgs.out
+
+   test:
+      suffix: gmres_lowsync
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_gmres_lowsyncgramschmidt -ksp_gmres_preallocate {{0 1}}
+      output_file: output/ex2_2.out
+
+   test:
+      suffix: fgmres_lowsync
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_type fgmres -ksp_gmres_lowsyncgramschmidt
+
+   test:
+      suffix: lgmres_lowsync
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_type lgmres -ksp_gmres_restart 6 -ksp_lgmres_augment 2 -ksp_gmres_lowsyncgramschmidt
+
+   test:
+      suffix: dgmres_lowsync
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_type dgmres -ksp_gmres_restart 6 -ksp_dgmres_eigen 2 -ksp_gmres_lowsyncgramschmidt
+
+   test:
+      suffix: fgmres_ksp_lowsync
+      nsize: 2
+      args: -ksp_monitor_short -m 5 -n 5 -ksp_type fgmres -ksp_gmres_lowsyncgramschmidt -pc_type ksp -ksp_ksp_type gmres -ksp_ksp_gmres_lowsyncgramschmidt -ksp_ksp_max_it 3 -ksp_ksp_norm_type unpreconditioned
+
    test:
       suffix: 3
       args: -pc_type sor -pc_sor_symmetric -ksp_monitor_short -ksp_gmres_cgs_refinement_type refine_always
@@ -262,6 +299,26 @@ int main(int argc,char **args)
       nsize: 3
       args: -ksp_type fbcgsr -pc_type bjacobi
 
+   test:
+      suffix: ilu_levels
+      args: -ksp_monitor_short -pc_type ilu -pc_factor_levels 1 -mat_seqaij_num_threads {{1 3}} -ksp_gmres_cgs_refinement_type refine_always
+      output_file: output/ex2_ilu_levels.out
+
+   test:
+      suffix: icc_levels
+      args: -ksp_monitor_short -ksp_type cg -pc_type icc -pc_factor_levels 1 -mat_seqaij_num_threads {{1 3}}
+      output_file: output/ex2_icc_levels.out
+
+   test:
+      suffix: chowilu
+      args: -ksp_monitor_short -pc_type chowilu -mat_seqaij_num_threads {{1 3}} -ksp_gmres_cgs_refinement_type refine_always
+      output_file: output/ex2_chowilu.out
+
+   test:
+      suffix: chowilu_bjacobi
+      nsize: 2
+      args: -ksp_monitor_short -sub_pc_type chowilu -sub_pc_chowilu_levels 1 -sub_pc_chowilu_solve_iterations 0 -ksp_gmres_cgs_refinement_type refine_always
+
    test:
       suffix: groppcg
       args: -ksp_monitor_short -ksp_type groppcg -m 9 -n 9
@@ -327,4 +384,42 @@ int main(int argc,char **args)
    test:
       suffix: pipeprcg_rcw
       args: -ksp_monitor_short -ksp_type pipeprcg -recompute_w false -m 9 -n 9
+
+   test:
+      suffix: sstepcg
+      nsize: 2
+      args: -ksp_monitor_short -ksp_type sstepcg -ksp_sstepcg_s {{1 3}separate output} -m 9 -n 9
+
+   test:
+      suffix: sstepgmres
+      nsize: 2
+      args: -ksp_monitor_short -ksp_type sstepgmres -ksp_sstepgmres_s 3 -ksp_sstepgmres_restart 5 -ksp_pc_side {{left right}separate output} -m 9 -n 9
+
+   test:
+      suffix: sstep_matrix_powers
+      nsize: 3
+      args: -ksp_monitor_short -ksp_type {{sstepcg sstepgmres}separate output} -pc_type none -ksp_max_it 16 -m 20 -n 20
+
+   test:
+      suffix: ir
+      requires: !complex !single
+      args: -ksp_monitor_short -ksp_type ir -ksp_rtol 1.e-10 -ir_pc_type {{jacobi sor ilu}separate output} -m 9 -n 9
+
+   test:
+      suffix: ir_bjacobi
+      nsize: 2
+      requires: !complex !single
+      args: -ksp_monitor_short -ksp_type ir -ksp_rtol 1.e-10 -ir_ksp_type cg -ir_pc_type bjacobi -m 9 -n 9 -ksp_view
+
+   test:
+      suffix: ir_gamg
+      nsize: 2
+      requires: !complex !single
+      args: -ksp_monitor_short -ksp_type ir -ksp_rtol 1.e-10 -ir_ksp_type cg -ir_pc_type gamg -ksp_ir_demote -m 20 -n 20
+
+   test:
+      suffix: aijmixed_gamg
+      nsize: 2
+      requires: !complex !single
+      args: -ksp_monitor_short -mat_type aijmixed -pc_type gamg -m 20 -n 20
  TEST*/
@@ -231,6 +231,12 @@ int main(int argc,char **args)
       args: -ne 49 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_type classical -mg_levels_ksp_chebyshev_esteig 0,0.05,0,1.05 -ksp_converged_reason -mg_levels_esteig_ksp_type cg
       output_file: output/ex54_classical.out
 
+   test:
+      suffix: sfc
+      nsize: 4
+      args: -ne 99 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -mg_levels_ksp_chebyshev_esteig 0,0.05,0,1.1 -mg_levels_esteig_ksp_type cg -mg_levels_esteig_ksp_max_it 10 -mg_levels_pc_type sor -pc_gamg_repartition -pc_gamg_repartition_sfc -pc_gamg_process_eq_limit 300 -pc_gamg_use_parallel_coarse_grid_solver -pc_gamg_coarse_grid_layout_type {{compact spread}}
+      output_file: output/ex54_sfc.out
+
    test:
       suffix: geo
       nsize: 4
@@ -114,6 +114,8 @@ int main(int argc,char **args)
     ierr = MatSetFromOptions(Amat);CHKERRQ(ierr);
     ierr = MatSeqAIJSetPreallocation(Amat,0,d_nnz);CHKERRQ(ierr);
     ierr = MatMPIAIJSetPreallocation(Amat,0,d_nnz,0,o_nnz);CHKERRQ(ierr);
+    ierr = MatSeqBAIJSetPreallocation(Amat,3,27,NULL);CHKERRQ(ierr);
+    ierr = MatMPIBAIJSetPreallocation(Amat,3,27,NULL,19,NULL);CHKERRQ(ierr);
 
     ierr = PetscFree(d_nnz);CHKERRQ(ierr);
     ierr = PetscFree(o_nnz);CHKERRQ(ierr);
@@ -984,6 +986,25 @@ PetscErrorCode elem_3d_elast_v_25(PetscScalar *dd)
       suffix: nns
       args: -ne 9 -alpha 1.e-3 -ksp_converged_reason -ksp_type cg -ksp_max_it 50 -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -pc_gamg_coarse_eq_limit 1000 -mg_levels_ksp_type chebyshev -mg_levels_pc_type sor -pc_gamg_reuse_interpolation true -two_solves -use_mat_nearnullspace -mg_levels_esteig_ksp_type cg -mg_levels_esteig_ksp_max_it 10
 
+   test:
+      suffix: nns_threads
+      args: -ne 9 -alpha 1.e-3 -ksp_converged_reason -ksp_type cg -ksp_max_it 50 -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -pc_gamg_coarse_eq_limit 1000 -mg_levels_ksp_type chebyshev -mg_levels_pc_type sor -pc_gamg_reuse_interpolation true -two_solves -use_mat_nearnullspace -mg_levels_esteig_ksp_type cg -mg_levels_esteig_ksp_max_it 10 -mat_seqaij_num_threads 3
+      output_file: output/ex56_nns.out
+
+   test:
+      suffix: baij
+      args: -ne 9 -alpha 1.e-3 -ksp_converged_reason -ksp_type cg -ksp_max_it 50 -pc_type gamg -pc_gamg_type agg -pc_gamg_agg_nsmooths 1 -pc_gamg_coarse_eq_limit 1000 -mg_levels_ksp_type chebyshev -mg_levels_pc_type sor -pc_gamg_reuse_interpolation true -two_solves -use_mat_nearnullspace -mg_levels_esteig_ksp_type cg -mg_levels_esteig_ksp_max_it 10 -mat_type baij
+
+   test:
+      suffix: sfc
+      nsize: 8
+      args: -ne 13 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -pc_gamg_square_graph 1 -mg_levels_ksp_type chebyshev -mg_levels_pc_type jacobi -mg_levels_esteig_ksp_type cg -pc_gamg_coarse_eq_limit 200 -pc_gamg_process_eq_limit 200 -pc_gamg_repartition -pc_gamg_repartition_sfc -pc_gamg_coarse_grid_layout_type compact -pc_gamg_use_parallel_coarse_grid_solver -mg_coarse_pc_type jacobi -mg_coarse_ksp_type cg
+
+   test:
+      suffix: baij_repartition
+      nsize: 8
+      args: -ne 11 -alpha 1.e-3 -ksp_type cg -pc_type gamg -pc_gamg_agg_nsmooths 1 -ksp_converged_reason -mg_levels_ksp_type chebyshev -mg_levels_pc_type jacobi -mg_levels_esteig_ksp_type cg -pc_gamg_coarse_eq_limit 200 -pc_gamg_process_eq_limit 200 -pc_gamg_repartition -pc_gamg_mat_partitioning_type average -mat_type baij
+
    test:
       suffix: nns_telescope
       nsize: 2
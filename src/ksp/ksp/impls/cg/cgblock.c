@@ -0,0 +1,204 @@
+/*
+    Block conjugate gradient method for a block of right-hand sides, used by KSPMatSolve() with KSPCG.
+
+    Reference: D. P. O'Leary, The block conjugate gradient algorithm and related methods, 1980.
+
+    The search directions P are A-orthonormalized with the Cholesky factor of P^H A P. Directions that become
+    linearly dependent, for example because some right-hand sides have converged, are deflated by the truncated
+    Cholesky factorization of KSPDenseCholesky_Private() instead of breaking down, and are replaced by the new
+    preconditioned residuals at the next iteration. The products with A and with the preconditioner read the block
+    at once and the inner products of all the columns are merged in two reductions per iteration.
+*/
+#include <../src/ksp/ksp/impls/cg/cgimpl.h>       /*I "petscksp.h" I*/
+
+/* contribution of the local rows to the real parts of the column dot products R(:,j)^H Z(:,j) */
+static PetscErrorCode KSPCGBlockColumnDotsLocal(Mat R,Mat Z,PetscScalar *dots)
+{
+  PetscErrorCode    ierr;
+  const PetscScalar *ra,*za;
+  PetscInt          m,n,ldr,ldz,i,j;
+  PetscReal         sum;
+
+  PetscFunctionBegin;
+  ierr = MatGetLocalSize(R,&m,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(R,NULL,&n);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(R,&ldr);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Z,&ldz);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(R,&ra);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(Z,&za);CHKERRQ(ierr);
+  for (j=0; j<n; j++) {
+    sum = 0.0;
+    for (i=0; i<m; i++) sum += PetscRealPart(PetscConj(ra[i+j*ldr])*za[i+j*ldz]);
+    dots[j] = sum;
+  }
+  ierr = MatDenseRestoreArrayRead(R,&ra);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArrayRead(Z,&za);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*m*n);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* computes into nrm the contribution of the local rows to the squared column norms of type ksp->normtype */
+static PetscErrorCode KSPCGBlockNormsLocal(KSP ksp,Mat R,Mat Z,PetscScalar *nrm)
+{
+  PetscErrorCode ierr;
+  PetscInt       n,j;
+
+  PetscFunctionBegin;
+  switch (ksp->normtype) {
+  case KSP_NORM_PRECONDITIONED:
+    ierr = KSPDenseColumnNormsLocal_Private(Z,nrm);CHKERRQ(ierr);
+    break;
+  case KSP_NORM_UNPRECONDITIONED:
+    ierr = KSPDenseColumnNormsLocal_Private(R,nrm);CHKERRQ(ierr);
+    break;
+  case KSP_NORM_NATURAL:
+    ierr = KSPCGBlockColumnDotsLocal(R,Z,nrm);CHKERRQ(ierr);
+    break;
+  default:
+    ierr = MatGetSize(R,NULL,&n);CHKERRQ(ierr);
+    for (j=0; j<n; j++) nrm[j] = 0.0;
+  }
+  PetscFunctionReturn(0);
+}
+
+/* the residual norm of the block is the largest over the columns */
+static PetscReal KSPCGBlockNorm(PetscInt n,const PetscScalar *nrm)
+{
+  PetscInt  j;
+  PetscReal dp = 0.0;
+
+  for (j=0; j<n; j++) dp = PetscMax(dp,PetscAbsScalar(nrm[j]));
+  return PetscSqrtReal(dp);
+}
+
+/* S = T T^H, the pseudo-inverse of P^H A P, for the upper triangular T of order n */
+static void KSPCGBlockInverse(PetscInt n,const PetscScalar *T,PetscScalar *S)
+{
+  PetscInt    i,j,k;
+  PetscScalar sum;
+
+  for (j=0; j<n; j++) {
+    for (i=0; i<n; i++) {
+      sum = 0.0;
+      for (k=PetscMax(i,j); k<n; k++) sum += T[i+k*n]*PetscConj(T[j+k*n]);
+      S[i+j*n] = sum;
+    }
+  }
+}
+
+/* C = -S G for the square matrices S and G of order n */
+static void KSPCGBlockCoefficients(PetscInt n,const PetscScalar *S,const PetscScalar *G,PetscScalar *C)
+{
+  PetscInt    i,j,k;
+  PetscScalar sum;
+
+  for (j=0; j<n; j++) {
+    for (i=0; i<n; i++) {
+      sum = 0.0;
+      for (k=0; k<n; k++) sum += S[i+k*n]*G[k+j*n];
+      C[i+j*n] = -sum;
+    }
+  }
+}
+
+PetscErrorCode KSPMatSolve_CG(KSP ksp,Mat B,Mat X)
+{
+  PetscErrorCode ierr;
+  Mat            Amat,R,P,W,AP = NULL,tmp;
+  MPI_Comm       comm;
+  PetscInt       n,n2,i,j,rank;
+  PetscScalar    *lbuf,*gbuf,*L,*T,*S,*C;
+  PetscReal      dp;
+  PetscBool      diagonalscale,indef,guess_zero = ksp->guess_zero;
+
+  PetscFunctionBegin;
+  ierr = PCGetDiagonalScale(ksp->pc,&diagonalscale);CHKERRQ(ierr);
+  if (diagonalscale) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_SUP,"Krylov method %s does not support diagonal scaling",((PetscObject)ksp)->type_name);
+#if defined(PETSC_USE_COMPLEX)
+  if (((KSP_CG*)ksp->data)->type == KSP_CG_SYMMETRIC) {
+    /* the block method relies on the Hermitian inner product */
+    ierr = KSPMatSolve_Basic(ksp,B,X);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+#endif
+  comm = PetscObjectComm((PetscObject)ksp);
+  ierr = PCGetOperators(ksp->pc,&Amat,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(B,NULL,&n);CHKERRQ(ierr);
+  n2   = n*n;
+  ierr = PetscMalloc6(2*n2+n,&lbuf,2*n2+n,&gbuf,n2,&L,n2,&T,n2,&S,n2,&C);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&R);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&P);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&W);CHKERRQ(ierr);
+
+  ksp->its = 0;
+  ierr = MatCopy(B,R,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+  if (!ksp->guess_zero) {
+    ierr = KSPMatMatMult_Private(Amat,X,&AP);CHKERRQ(ierr);        /*   R <- B - A X   */
+    ierr = MatAXPY(R,-1.0,AP,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+  }
+  ierr = PCMatApply(ksp->pc,R,W);CHKERRQ(ierr);                    /*   W <- M R       */
+  ierr = KSPCGBlockNormsLocal(ksp,R,W,lbuf);CHKERRQ(ierr);
+  ierr = MPIU_Allreduce(lbuf,gbuf,n,MPIU_SCALAR,MPIU_SUM,comm);CHKERRQ(ierr);
+  dp   = KSPCGBlockNorm(n,gbuf);
+  ierr       = KSPLogResidualHistory(ksp,dp);CHKERRQ(ierr);
+  ierr       = KSPMonitor(ksp,0,dp);CHKERRQ(ierr);
+  ksp->rnorm = dp;
+  /* the tolerances are relative to the initial residual of the block */
+  ksp->guess_zero = PETSC_TRUE;
+  ierr = (*ksp->converged)(ksp,0,dp,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+  ksp->guess_zero = guess_zero;
+  if (PetscIsInfOrNanReal(dp)) ksp->reason = KSP_DIVERGED_NANORINF;
+
+  tmp = P; P = W; W = tmp;                                         /*   P <- M R       */
+  i = 0;
+  while (!ksp->reason) {
+    if (i >= ksp->max_it) {
+      ksp->reason = KSP_DIVERGED_ITS;
+      break;
+    }
+    ksp->its = i+1;
+    ierr = KSPMatMatMult_Private(Amat,P,&AP);CHKERRQ(ierr);        /*   AP <- A P      */
+    ierr = KSPDenseTransposeMultLocal_Private(P,AP,lbuf,n);CHKERRQ(ierr);
+    ierr = KSPDenseTransposeMultLocal_Private(P,R,lbuf+n2,n);CHKERRQ(ierr);
+    ierr = MPIU_Allreduce(lbuf,gbuf,2*n2,MPIU_SCALAR,MPIU_SUM,comm);CHKERRQ(ierr);
+    ierr = KSPDenseCholesky_Private(n,gbuf,L,T,&rank,&indef);CHKERRQ(ierr);
+    if (indef) {
+      if (ksp->errorifnotconverged) SETERRQ(comm,PETSC_ERR_NOT_CONVERGED,"Diverged due to indefinite matrix");
+      ksp->reason = KSP_DIVERGED_INDEFINITE_MAT;
+      ierr        = PetscInfo(ksp,"diverging due to indefinite or negative definite matrix\n");CHKERRQ(ierr);
+      break;
+    }
+    if (!rank) {
+      ksp->reason = KSP_DIVERGED_BREAKDOWN;
+      ierr        = PetscInfo(ksp,"breakdown: all the search directions are linearly dependent\n");CHKERRQ(ierr);
+      break;
+    }
+    if (rank < n) {ierr = PetscInfo2(ksp,"deflating %D of the %D search directions\n",n-rank,n);CHKERRQ(ierr);}
+    KSPCGBlockInverse(n,T,S);
+    KSPCGBlockCoefficients(n,S,gbuf+n2,C);                         /*   C <- -(P^H A P)^+ P^H R */
+    ierr = KSPDenseMultAdd_Private(AP,C,n,1.0,R);CHKERRQ(ierr);    /*   R <- R + AP C  */
+    for (j=0; j<n2; j++) C[j] = -C[j];
+    ierr = KSPDenseMultAdd_Private(P,C,n,1.0,X);CHKERRQ(ierr);     /*   X <- X + P C   */
+    ierr = PCMatApply(ksp->pc,R,W);CHKERRQ(ierr);                  /*   W <- M R       */
+    ierr = KSPDenseTransposeMultLocal_Private(AP,W,lbuf,n);CHKERRQ(ierr);
+    ierr = KSPCGBlockNormsLocal(ksp,R,W,lbuf+n2);CHKERRQ(ierr);
+    ierr = MPIU_Allreduce(lbuf,gbuf,n2+n,MPIU_SCALAR,MPIU_SUM,comm);CHKERRQ(ierr);
+    dp   = KSPCGBlockNorm(n,gbuf+n2);
+    ksp->rnorm = dp;
+    ierr = KSPLogResidualHistory(ksp,dp);CHKERRQ(ierr);
+    ierr = KSPMonitor(ksp,i+1,dp);CHKERRQ(ierr);
+    ierr = (*ksp->converged)(ksp,i+1,dp,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+    if (PetscIsInfOrNanReal(dp)) ksp->reason = KSP_DIVERGED_NANORINF;
+    if (ksp->reason) break;
+    KSPCGBlockCoefficients(n,S,gbuf,C);                            /*   C <- -(P^H A P)^+ (A P)^H M R */
+    ierr = KSPDenseMultAdd_Private(P,C,n,1.0,W);CHKERRQ(ierr);     /*   P <- M R + P C */
+    tmp = P; P = W; W = tmp;
+    i++;
+  }
+  ierr = MatDestroy(&AP);CHKERRQ(ierr);
+  ierr = MatDestroy(&W);CHKERRQ(ierr);
+  ierr = MatDestroy(&P);CHKERRQ(ierr);
+  ierr = MatDestroy(&R);CHKERRQ(ierr);
+  ierr = PetscFree6(lbuf,gbuf,L,T,S,C);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
@@ -0,0 +1,372 @@
+#include <petsc/private/kspimpl.h>
+
+/*
+   The s-step conjugate gradient method of Chronopoulos and Gear. Each outer step builds the
+   monomial basis R = [z, BAz, ..., (BA)^{s-1} z] of the preconditioned residual z = Br together
+   with AR, makes it A-conjugate to the previous block of directions P and minimizes the energy
+   norm of the error over the new block. All the inner products of the outer step are computed in
+   one split-phase reduction:
+
+     G1 = (AP)^H R,  G2 = (AR)^H R,  g = R^H r,  and the residual norm used in the convergence test
+
+   from which, with W = P^H A P kept from the previous step,
+
+     B = W^{-1} G1,  P <- R - P B,  AP <- AR - AP B,  W <- G2 - G1^H B,  x <- x + P W^{-1} g,  r <- r - AP W^{-1} g
+*/
+typedef struct {
+  PetscInt    s;          /* number of directions per outer step */
+  Vec         *R,*AR;     /* basis of the current step and its image under A */
+  Vec         *P,*AP;     /* directions of the previous step and their image under A */
+  PetscInt    np;         /* number of directions kept in P */
+  PetscScalar *G1,*G2,*g; /* results of the reduction */
+  PetscScalar *L,*Lp;     /* Cholesky factors of P^H A P for the current and the previous step */
+  PetscScalar *B,*a;
+  PetscBool   matpowers;  /* build the basis with the matrix powers kernel when it applies */
+  KSPMatPowers mp;
+} KSP_SSTEPCG;
+
+/*
+   Cholesky factorization W = L L^H of the leading n x n block of W (leading dimension ld) that is
+   numerically positive definite, its size is returned in m
+*/
+static PetscErrorCode KSPSSTEPCGCholesky_Private(PetscInt ld,PetscInt n,const PetscScalar *W,PetscScalar *L,PetscInt *m)
+{
+  PetscErrorCode ierr;
+  PetscInt       i,j,k;
+  PetscScalar    d;
+
+  PetscFunctionBegin;
+  for (k=0; k<n; k++) {
+    d = W[k+k*ld];
+    for (i=0; i<k; i++) d -= L[k+i*ld]*PetscConj(L[k+i*ld]);
+    if (PetscRealPart(W[k+k*ld]) <= 0.0 || PetscRealPart(d) <= PETSC_SQRT_MACHINE_EPSILON*PetscRealPart(W[k+k*ld])) break;
+    L[k+k*ld] = PetscSqrtReal(PetscRealPart(d));
+    for (j=k+1; j<n; j++) {
+      d = W[j+k*ld];
+      for (i=0; i<k; i++) d -= L[j+i*ld]*PetscConj(L[k+i*ld]);
+      L[j+k*ld] = d/L[k+k*ld];
+    }
+  }
+  *m   = k;
+  ierr = PetscLogFlops(k*k*k/3.0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Solves L L^H x = b in place for the m x m factor L with leading dimension ld */
+static PetscErrorCode KSPSSTEPCGCholeskySolve_Private(PetscInt ld,PetscInt m,const PetscScalar *L,PetscScalar *x)
+{
+  PetscInt i,j;
+
+  PetscFunctionBegin;
+  for (i=0; i<m; i++) {
+    for (j=0; j<i; j++) x[i] -= L[i+j*ld]*x[j];
+    x[i] /= L[i+i*ld];
+  }
+  for (i=m-1; i>=0; i--) {
+    for (j=i+1; j<m; j++) x[i] -= PetscConj(L[j+i*ld])*x[j];
+    x[i] /= L[i+i*ld];
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSetUp_SSTEPCG(KSP ksp)
+{
+  KSP_SSTEPCG    *cg = (KSP_SSTEPCG*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       s = cg->s;
+
+  PetscFunctionBegin;
+  ierr = KSPSetWorkVecs(ksp,1);CHKERRQ(ierr);
+  ierr = VecDuplicateVecs(ksp->work[0],s,&cg->R);CHKERRQ(ierr);
+  ierr = VecDuplicateVecs(ksp->work[0],s,&cg->AR);CHKERRQ(ierr);
+  ierr = VecDuplicateVecs(ksp->work[0],s,&cg->P);CHKERRQ(ierr);
+  ierr = VecDuplicateVecs(ksp->work[0],s,&cg->AP);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,s,cg->R);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,s,cg->AR);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,s,cg->P);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,s,cg->AP);CHKERRQ(ierr);
+  ierr = PetscMalloc7(s*s,&cg->G1,s*s,&cg->G2,s,&cg->g,s*s,&cg->L,s*s,&cg->Lp,s*s,&cg->B,s,&cg->a);CHKERRQ(ierr);
+  ierr = PetscLogObjectMemory((PetscObject)ksp,(5*s*s+2*s)*sizeof(PetscScalar));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSolve_SSTEPCG(KSP ksp)
+{
+  KSP_SSTEPCG    *cg = (KSP_SSTEPCG*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       ld = cg->s,s = cg->s,i,j,k,m;
+  PetscScalar    *G1 = cg->G1,*G2 = cg->G2,*g = cg->g,*L = cg->L,*B = cg->B,*a = cg->a;
+  PetscReal      dp = 0.0;
+  Vec            X,Bv,R,*tmp;
+  Mat            Amat,Pmat;
+  MPI_Comm       comm;
+  PetscBool      diagonalscale;
+
+  PetscFunctionBegin;
+  ierr = PCGetDiagonalScale(ksp->pc,&diagonalscale);CHKERRQ(ierr);
+  if (diagonalscale) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_SUP,"Krylov method %s does not support diagonal scaling",((PetscObject)ksp)->type_name);
+
+  comm = PetscObjectComm((PetscObject)ksp);
+  X    = ksp->vec_sol;
+  Bv   = ksp->vec_rhs;
+  R    = ksp->work[0];
+  ierr = PCGetOperators(ksp->pc,&Amat,&Pmat);CHKERRQ(ierr);
+
+  ksp->its = 0;
+  if (!ksp->guess_zero) {
+    ierr = KSP_MatMult(ksp,Amat,X,R);CHKERRQ(ierr);            /*    r <- b - Ax       */
+    ierr = VecAYPX(R,-1.0,Bv);CHKERRQ(ierr);
+  } else {
+    ierr = VecCopy(Bv,R);CHKERRQ(ierr);                         /*    r <- b (x is 0)   */
+  }
+  cg->np = 0;
+  if (cg->matpowers) {ierr = KSPMatPowersSetUp_Private(ksp,ld,&cg->mp);CHKERRQ(ierr);}
+
+  while (1) {
+    /* the s basis vectors need s products with the operator and s applications of the preconditioner, but no reduction */
+    ierr = KSP_PCApply(ksp,R,cg->R[0]);CHKERRQ(ierr);           /*    R_0 <- Br         */
+    if (cg->mp) {
+      /* without preconditioner AR = [AR_0, ..., A^s R_0] with a single ghost exchange and R_{j+1} = AR_j */
+      ierr = KSPMatPowersApply_Private(cg->mp,cg->R[0],s,cg->AR);CHKERRQ(ierr);
+      for (j=0; j<s-1; j++) {ierr = VecCopy(cg->AR[j],cg->R[j+1]);CHKERRQ(ierr);}
+    } else {
+      for (j=0; j<s; j++) {
+        ierr = KSP_MatMult(ksp,Amat,cg->R[j],cg->AR[j]);CHKERRQ(ierr);
+        if (j < s-1) {ierr = KSP_PCApply(ksp,cg->AR[j],cg->R[j+1]);CHKERRQ(ierr);}
+      }
+    }
+
+    /* one reduction for the Gram matrices and the residual norm */
+    for (j=0; j<s; j++) {
+      if (cg->np) {ierr = VecMDotBegin(cg->R[j],cg->np,cg->AP,G1+j*ld);CHKERRQ(ierr);}
+      ierr = VecMDotBegin(cg->R[j],s,cg->AR,G2+j*ld);CHKERRQ(ierr);
+      ierr = VecDotBegin(R,cg->R[j],g+j);CHKERRQ(ierr);
+    }
+    if (ksp->normtype == KSP_NORM_PRECONDITIONED) {
+      ierr = VecNormBegin(cg->R[0],NORM_2,&dp);CHKERRQ(ierr);
+    } else if (ksp->normtype == KSP_NORM_UNPRECONDITIONED) {
+      ierr = VecNormBegin(R,NORM_2,&dp);CHKERRQ(ierr);
+    }
+    ierr = PetscCommSplitReductionBegin(comm);CHKERRQ(ierr);
+    for (j=0; j<s; j++) {
+      if (cg->np) {ierr = VecMDotEnd(cg->R[j],cg->np,cg->AP,G1+j*ld);CHKERRQ(ierr);}
+      ierr = VecMDotEnd(cg->R[j],s,cg->AR,G2+j*ld);CHKERRQ(ierr);
+      ierr = VecDotEnd(R,cg->R[j],g+j);CHKERRQ(ierr);
+    }
+    if (ksp->normtype == KSP_NORM_PRECONDITIONED) {
+      ierr = VecNormEnd(cg->R[0],NORM_2,&dp);CHKERRQ(ierr);
+    } else if (ksp->normtype == KSP_NORM_UNPRECONDITIONED) {
+      ierr = VecNormEnd(R,NORM_2,&dp);CHKERRQ(ierr);
+    } else if (ksp->normtype == KSP_NORM_NATURAL) {
+      dp = PetscSqrtReal(PetscAbsScalar(g[0]));                 /*    dp <- r'*B*r      */
+    } else dp = 0.0;
+    KSPCheckNorm(ksp,dp);
+    KSPCheckDot(ksp,g[0]);
+
+    ierr       = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+    ksp->rnorm = dp;
+    ierr       = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+    ierr       = KSPLogResidualHistory(ksp,dp);CHKERRQ(ierr);
+    ierr       = KSPMonitor(ksp,ksp->its,dp);CHKERRQ(ierr);
+    ierr       = (*ksp->converged)(ksp,ksp->its,dp,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+    if (ksp->reason) break;
+    if (ksp->its >= ksp->max_it) {
+      ksp->reason = KSP_DIVERGED_ITS;
+      break;
+    }
+    if (g[0] == 0.0) {
+      ksp->reason = KSP_CONVERGED_ATOL;
+      ierr        = PetscInfo(ksp,"converged due to r'*B*r = 0\n");CHKERRQ(ierr);
+      break;
+    } else if (PetscRealPart(g[0]) < 0.0) {
+      if (ksp->errorifnotconverged) SETERRQ1(comm,PETSC_ERR_NOT_CONVERGED,"Diverged due to indefinite preconditioner, r'*B*r %g",(double)PetscRealPart(g[0]));
+      ksp->reason = KSP_DIVERGED_INDEFINITE_PC;
+      ierr        = PetscInfo(ksp,"diverging due to indefinite preconditioner\n");CHKERRQ(ierr);
+      break;
+    }
+
+    /* B = W^{-1} G1 and W <- G2 - G1^H B, stored in G2 */
+    for (j=0; j<s; j++) {
+      for (i=0; i<cg->np; i++) B[i+j*ld] = G1[i+j*ld];
+      ierr = KSPSSTEPCGCholeskySolve_Private(ld,cg->np,cg->Lp,B+j*ld);CHKERRQ(ierr);
+      for (i=0; i<s; i++) {
+        for (k=0; k<cg->np; k++) G2[i+j*ld] -= PetscConj(G1[k+i*ld])*B[k+j*ld];
+      }
+    }
+    ierr = PetscLogFlops(2.0*s*s*cg->np);CHKERRQ(ierr);
+
+    /* keep the directions that are numerically A-conjugate; the block size cannot grow afterwards since the
+       A-conjugacy to the older blocks relies on the new block being not larger than the previous one */
+    ierr = KSPSSTEPCGCholesky_Private(ld,PetscMin(s,ksp->max_it-ksp->its),G2,L,&m);CHKERRQ(ierr);
+    if (!m) {
+      if (PetscRealPart(G2[0]) <= 0.0) {
+        if (ksp->errorifnotconverged) SETERRQ(comm,PETSC_ERR_NOT_CONVERGED,"Diverged due to indefinite matrix");
+        ksp->reason = KSP_DIVERGED_INDEFINITE_MAT;
+        ierr        = PetscInfo(ksp,"diverging due to indefinite or negative definite matrix\n");CHKERRQ(ierr);
+      } else {
+        ksp->reason = KSP_DIVERGED_BREAKDOWN;
+        ierr        = PetscInfo(ksp,"breakdown, no new A-conjugate direction\n");CHKERRQ(ierr);
+      }
+      break;
+    }
+    if (m < s) {
+      ierr = PetscInfo2(ksp,"Using %D of the %D directions of the outer step\n",m,s);CHKERRQ(ierr);
+      s    = m;
+    }
+
+    /* P <- R - P B and AP <- AR - AP B, built in place in R and AR */
+    for (j=0; j<s; j++) {
+      if (cg->np) {
+        for (i=0; i<cg->np; i++) B[i+j*ld] = -B[i+j*ld];
+        ierr = VecMAXPY(cg->R[j],cg->np,B+j*ld,cg->P);CHKERRQ(ierr);
+        ierr = VecMAXPY(cg->AR[j],cg->np,B+j*ld,cg->AP);CHKERRQ(ierr);
+      }
+      a[j] = g[j];
+    }
+    tmp = cg->P; cg->P = cg->R; cg->R = tmp;
+    tmp = cg->AP; cg->AP = cg->AR; cg->AR = tmp;
+    cg->np = s;
+    for (j=0; j<ld*ld; j++) cg->Lp[j] = L[j];
+
+    /* x <- x + P W^{-1} g and r <- r - AP W^{-1} g */
+    ierr = KSPSSTEPCGCholeskySolve_Private(ld,s,cg->Lp,a);CHKERRQ(ierr);
+    ierr = VecMAXPY(X,s,a,cg->P);CHKERRQ(ierr);
+    for (j=0; j<s; j++) a[j] = -a[j];
+    ierr = VecMAXPY(R,s,a,cg->AP);CHKERRQ(ierr);
+    ierr = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+    ksp->its += s;
+    ierr = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPReset_SSTEPCG(KSP ksp)
+{
+  KSP_SSTEPCG    *cg = (KSP_SSTEPCG*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = VecDestroyVecs(cg->s,&cg->R);CHKERRQ(ierr);
+  ierr = VecDestroyVecs(cg->s,&cg->AR);CHKERRQ(ierr);
+  ierr = VecDestroyVecs(cg->s,&cg->P);CHKERRQ(ierr);
+  ierr = VecDestroyVecs(cg->s,&cg->AP);CHKERRQ(ierr);
+  ierr = PetscFree7(cg->G1,cg->G2,cg->g,cg->L,cg->Lp,cg->B,cg->a);CHKERRQ(ierr);
+  ierr = KSPMatPowersDestroy_Private(&cg->mp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPDestroy_SSTEPCG(KSP ksp)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = KSPReset_SSTEPCG(ksp);CHKERRQ(ierr);
+  ierr = KSPDestroyDefault(ksp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSetFromOptions_SSTEPCG(PetscOptionItems *PetscOptionsObject,KSP ksp)
+{
+  KSP_SSTEPCG    *cg = (KSP_SSTEPCG*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       s = cg->s;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  ierr = PetscOptionsHead(PetscOptionsObject,"KSP SSTEPCG options");CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-ksp_sstepcg_s","Number of directions per outer step","",s,&s,&flg);CHKERRQ(ierr);
+  if (flg) {
+    if (s < 1) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_OUTOFRANGE,"The number of directions per outer step must be positive");
+    if (s != cg->s) {
+      ierr  = KSPReset_SSTEPCG(ksp);CHKERRQ(ierr);
+      cg->s = s;
+      ksp->setupstage = KSP_SETUP_NEW;
+    }
+  }
+  ierr = PetscOptionsBool("-ksp_sstepcg_matrix_powers","Use the matrix powers kernel without preconditioner on MATMPIAIJ","",cg->matpowers,&cg->matpowers,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsTail();CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPView_SSTEPCG(KSP ksp,PetscViewer viewer)
+{
+  KSP_SSTEPCG    *cg = (KSP_SSTEPCG*)ksp->data;
+  PetscErrorCode ierr;
+  PetscBool      iascii,isstring;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&iascii);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERSTRING,&isstring);CHKERRQ(ierr);
+  if (iascii) {
+    ierr = PetscViewerASCIIPrintf(viewer,"  directions per outer step: %D\n",cg->s);CHKERRQ(ierr);
+    if (cg->mp) {ierr = PetscViewerASCIIPrintf(viewer,"  basis computed with the matrix powers kernel\n");CHKERRQ(ierr);}
+  } else if (isstring) {
+    ierr = PetscViewerStringSPrintf(viewer,"  directions per outer step: %D\n",cg->s);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/*MC
+    KSPSSTEPCG - The s-step (communication avoiding) preconditioned conjugate gradient method. Each outer step
+    computes s directions with s matrix-vector products and s preconditioner applications and needs a single
+    global reduction, compared with 2 s blocking reductions for s iterations of KSPCG.
+
+    Options Database Keys:
++   -ksp_sstepcg_s <s> - number of directions per outer step (default 4)
+.   -ksp_sstepcg_matrix_powers <true,false> - use the matrix powers kernel when it applies (default true)
+-   see KSPSolve() for additional options
+
+    Level: advanced
+
+    Notes:
+    The iteration count is increased by s after each outer step, and the convergence test and monitors are only
+    called at the start of each outer step, with the norm selected by KSPSetNormType() for the current residual.
+
+    The directions of an outer step are obtained from the monomial basis z, BAz, ..., (BA)^{s-1} z of the preconditioned
+    residual z, whose conditioning degrades quickly with s, so s should remain small (up to about 5). When the
+    directions of an outer step are numerically dependent the method keeps the leading directions that are not and
+    continues with that smaller s.
+
+    With PCNONE and a MATMPIAIJ operator the basis of an outer step is computed by a matrix powers kernel: each
+    process gathers once the entries of the vector within graph distance s of its rows and then computes the s
+    products locally on the rows of A within that distance, instead of s products with one neighbor exchange each.
+    With other preconditioners or matrix types the basis is computed with one product per vector.
+
+    This method is intended for latency bound problems, e.g. coarse problems
+    solved on many processes, where the cost of the reductions dominates.
+
+    Only symmetric positive definite operators and preconditioners (left preconditioning) are supported.
+
+    References:
+.   1. - A. T. Chronopoulos and C. W. Gear, "s-step iterative methods for symmetric linear systems",
+    J. Comput. Appl. Math. 25 (1989).
+
+.seealso: KSPCreate(), KSPSetType(), KSPType (for list of available types), KSP, KSPCG, KSPPIPECG, KSPPIPELCG,
+          KSPSSTEPGMRES
+M*/
+PETSC_EXTERN PetscErrorCode KSPCreate_SSTEPCG(KSP ksp)
+{
+  KSP_SSTEPCG    *cg;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr      = PetscNewLog(ksp,&cg);CHKERRQ(ierr);
+  cg->s         = 4;
+  cg->matpowers = PETSC_TRUE;
+  ksp->data     = (void*)cg;
+
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_PRECONDITIONED,PC_LEFT,3);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_UNPRECONDITIONED,PC_LEFT,2);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_NATURAL,PC_LEFT,2);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_NONE,PC_LEFT,1);CHKERRQ(ierr);
+
+  ksp->ops->setup          = KSPSetUp_SSTEPCG;
+  ksp->ops->solve          = KSPSolve_SSTEPCG;
+  ksp->ops->reset          = KSPReset_SSTEPCG;
+  ksp->ops->destroy        = KSPDestroy_SSTEPCG;
+  ksp->ops->view           = KSPView_SSTEPCG;
+  ksp->ops->setfromoptions = KSPSetFromOptions_SSTEPCG;
+  ksp->ops->buildsolution  = KSPBuildSolutionDefault;
+  ksp->ops->buildresidual  = KSPBuildResidualDefault;
+  PetscFunctionReturn(0);
+}
@@ -8,6 +8,7 @@ static PetscErrorCode KSPReset_Chebyshev(KSP ksp)
 
   PetscFunctionBegin;
   ierr = KSPReset(cheb->kspest);CHKERRQ(ierr);
+  ierr = VecDestroy(&cheb->eigvec);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
@@ -84,6 +85,16 @@ static PetscErrorCode KSPChebyshevEstEigSetUseNoisy_Chebyshev(KSP ksp,PetscBool
   PetscFunctionReturn(0);
 }
 
+static PetscErrorCode KSPChebyshevEstEigSetReuse_Chebyshev(KSP ksp,PetscReal rtol)
+{
+  KSP_Chebyshev  *cheb = (KSP_Chebyshev*)ksp->data;
+
+  PetscFunctionBegin;
+  if (rtol < 0.0) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_OUTOFRANGE,"Tolerance %g must be nonnegative",(double)rtol);
+  cheb->reusertol = rtol;
+  PetscFunctionReturn(0);
+}
+
 /*@
    KSPChebyshevSetEigenvalues - Sets estimates for the extreme eigenvalues
    of the preconditioned problem.
@@ -191,6 +202,42 @@ PetscErrorCode KSPChebyshevEstEigSetUseNoisy(KSP ksp,PetscBool use)
   PetscFunctionReturn(0);
 }
 
+/*@
+   KSPChebyshevEstEigSetReuse - reuse the eigenvalue estimates when the operator changes, as long as a Rayleigh quotient
+   indicates that the spectrum has not moved by more than a relative tolerance
+
+   Logically Collective
+
+   Input Arguments:
++  ksp - linear solver context
+-  rtol - relative change of the Rayleigh quotient that triggers a new estimate, 0.0 (the default) to estimate every time the operator changes
+
+   Options Database:
+.  -ksp_chebyshev_esteig_reuse_rtol <rtol>
+
+   Notes:
+   After each estimate a vector rich in the eigenvectors of the largest eigenvalues of the preconditioned operator is
+   kept, with its Rayleigh quotient. When the operator changes, for example with a lagged Jacobian in a Newton method
+   or with PCMG on the next PCSetUp(), the Rayleigh quotient of that vector is computed with one multiplication and
+   one application of the preconditioner. If it has changed by less than rtol the estimates are scaled by the ratio
+   of the Rayleigh quotients and reused; otherwise the eigenvalues are estimated again, starting the Krylov method
+   from that vector instead of from a noisy or the given right hand side.
+
+   Level: intermediate
+
+.seealso: KSPChebyshevEstEigSet(), KSPChebyshevEstEigSetUseNoisy()
+@*/
+PetscErrorCode KSPChebyshevEstEigSetReuse(KSP ksp,PetscReal rtol)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp,KSP_CLASSID,1);
+  PetscValidLogicalCollectiveReal(ksp,rtol,2);
+  ierr = PetscTryMethod(ksp,"KSPChebyshevEstEigSetReuse_C",(KSP,PetscReal),(ksp,rtol));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 /*@
   KSPChebyshevEstEigGetKSP - Get the Krylov method context used to estimate eigenvalues for the Chebyshev method.  If
   a Krylov method is not being used for this purpose, NULL is returned.  The reference count of the returned KSP is
@@ -266,6 +313,7 @@ static PetscErrorCode KSPSetFromOptions_Chebyshev(PetscOptionItems *PetscOptions
 
   if (cheb->kspest) {
     ierr = PetscOptionsBool("-ksp_chebyshev_esteig_noisy","Use noisy right hand side for estimate","KSPChebyshevEstEigSetUseNoisy",cheb->usenoisy,&cheb->usenoisy,NULL);CHKERRQ(ierr);
+    ierr = PetscOptionsReal("-ksp_chebyshev_esteig_reuse_rtol","Reuse the estimates while the Rayleigh quotient changes less than this","KSPChebyshevEstEigSetReuse",cheb->reusertol,&cheb->reusertol,NULL);CHKERRQ(ierr);
     ierr = KSPSetFromOptions(cheb->kspest);CHKERRQ(ierr);
   }
   ierr = PetscOptionsTail();CHKERRQ(ierr);
@@ -297,6 +345,23 @@ static PetscErrorCode KSPChebyshevComputeExtremeEigenvalues_Private(KSP kspest,P
   PetscFunctionReturn(0);
 }
 
+/*
+   Rayleigh quotient (B^{-1} A v, v)/(v, v) of the preconditioned operator, with w = B^{-1} A v on output
+*/
+static PetscErrorCode KSPChebyshevRayleighQuotient_Private(KSP ksp,Mat Amat,Vec v,Vec t,Vec w,PetscReal *rq)
+{
+  PetscErrorCode ierr;
+  PetscReal      vw,vv;
+
+  PetscFunctionBegin;
+  ierr = KSP_MatMult(ksp,Amat,v,t);CHKERRQ(ierr);
+  ierr = KSP_PCApply(ksp,t,w);CHKERRQ(ierr);
+  ierr = VecDotRealPart(w,v,&vw);CHKERRQ(ierr);
+  ierr = VecDotRealPart(v,v,&vv);CHKERRQ(ierr);
+  *rq  = vv > 0.0 ? vw/vv : 0.0;
+  PetscFunctionReturn(0);
+}
+
 PETSC_STATIC_INLINE PetscScalar chebyhash(PetscInt xx)
 {
   unsigned int x = xx;
@@ -331,67 +396,97 @@ static PetscErrorCode KSPSolve_Chebyshev(KSP ksp)
     ierr = PetscObjectStateGet((PetscObject)Amat,&amatstate);CHKERRQ(ierr);
     ierr = PetscObjectStateGet((PetscObject)Pmat,&pmatstate);CHKERRQ(ierr);
     if (amatid != cheb->amatid || pmatid != cheb->pmatid || amatstate != cheb->amatstate || pmatstate != cheb->pmatstate) {
-      PetscReal          max=0.0,min=0.0;
+      PetscReal          max=0.0,min=0.0,rq = 0.0;
       Vec                B;
       KSPConvergedReason reason;
+      PetscInt           nv,nw;
+      PetscBool          estimate = PETSC_TRUE;
 
-      if (cheb->usenoisy) {
-        B  = ksp->work[1];
-        {
-          PetscErrorCode ierr;
-          PetscInt       n,i,istart;
-          PetscScalar    *xx;
-          ierr = VecGetOwnershipRange(B,&istart,NULL);CHKERRQ(ierr);
-          ierr = VecGetLocalSize(B,&n);CHKERRQ(ierr);
-          ierr = VecGetArrayWrite(B,&xx);CHKERRQ(ierr);
-          for (i=0; i<n; i++) {
-            PetscScalar v = chebyhash(i+istart);
-            xx[i] = v;
-          }
-          ierr = VecRestoreArrayWrite(B,&xx);CHKERRQ(ierr);
-        }
-      } else {
-        PC        pc;
-        PetscBool change;
-
-        ierr = KSPGetPC(cheb->kspest,&pc);CHKERRQ(ierr);
-        ierr = PCPreSolveChangeRHS(pc,&change);CHKERRQ(ierr);
-        if (change) {
-          B = ksp->work[1];
-          ierr = VecCopy(ksp->vec_rhs,B);CHKERRQ(ierr);
+      if (cheb->eigvec) {
+        ierr = VecGetLocalSize(cheb->eigvec,&nv);CHKERRQ(ierr);
+        ierr = VecGetLocalSize(ksp->work[0],&nw);CHKERRQ(ierr);
+        if (nv != nw || !cheb->reusertol) {ierr = VecDestroy(&cheb->eigvec);CHKERRQ(ierr);}
+      }
+      if (cheb->eigvec) { /* cheap check of the change of the spectrum since the last estimate */
+        ierr = KSPChebyshevRayleighQuotient_Private(ksp,Amat,cheb->eigvec,ksp->work[2],ksp->work[0],&rq);CHKERRQ(ierr);
+        if (cheb->rq > 0.0 && PetscAbsReal(rq - cheb->rq) <= cheb->reusertol*cheb->rq) {
+          ierr = PetscInfo2(ksp,"Reusing the eigenvalue estimates, Rayleigh quotient %g was %g\n",(double)rq,(double)cheb->rq);CHKERRQ(ierr);
+          cheb->emin = (cheb->tform[0]*cheb->emin_computed + cheb->tform[1]*cheb->emax_computed)*rq/cheb->rq;
+          cheb->emax = (cheb->tform[2]*cheb->emin_computed + cheb->tform[3]*cheb->emax_computed)*rq/cheb->rq;
+          estimate   = PETSC_FALSE;
         } else {
-          B = ksp->vec_rhs;
+          ierr = PetscInfo2(ksp,"Estimating the eigenvalues again, Rayleigh quotient %g was %g\n",(double)rq,(double)cheb->rq);CHKERRQ(ierr);
         }
       }
-      ierr = KSPSolve(cheb->kspest,B,ksp->work[0]);CHKERRQ(ierr);
-      ierr = KSPGetConvergedReason(cheb->kspest,&reason);CHKERRQ(ierr);
-      if (reason == KSP_DIVERGED_ITS) {
-          ierr = PetscInfo(ksp,"Eigen estimator ran for prescribed number of iterations\n");CHKERRQ(ierr);
-      } else if (reason == KSP_DIVERGED_PC_FAILED) {
-          PetscInt       its;
-          PCFailedReason pcreason;
-          PC             pc;
-
-          ierr = KSPGetIterationNumber(cheb->kspest,&its);CHKERRQ(ierr);
-          ierr = KSPGetPC(cheb->kspest,&pc);CHKERRQ(ierr);
-          ierr = PCGetFailedReason(pc,&pcreason);CHKERRQ(ierr);
-          if (!pcreason) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_PLIB,"KSP has KSP_DIVERGED_PC_FAILED but PC has no error flag");
-          ksp->reason = KSP_DIVERGED_PC_FAILED;
-          ierr = VecSetInf(ksp->vec_sol);CHKERRQ(ierr);
-          ierr = PetscInfo3(ksp,"Eigen estimator failed: %s %s at iteration %D",KSPConvergedReasons[reason],PCFailedReasons[pcreason],its);CHKERRQ(ierr);
-          PetscFunctionReturn(0);
-      } else if (reason==KSP_CONVERGED_RTOL ||reason==KSP_CONVERGED_ATOL) {
-        ierr = PetscInfo(ksp,"Eigen estimator converged prematurely. Should not happen except for small or low rank problem\n");CHKERRQ(ierr);
-      } else if (reason < 0) {
-        ierr = PetscInfo1(ksp,"Eigen estimator failed %s, using estimates anyway\n",KSPConvergedReasons[reason]);CHKERRQ(ierr);
-      }
+      if (estimate) {
+        if (cheb->eigvec) { /* warm start from the vector of the last estimate */
+          B    = ksp->work[1];
+          ierr = VecCopy(cheb->eigvec,B);CHKERRQ(ierr);
+        } else if (cheb->usenoisy) {
+          B  = ksp->work[1];
+          {
+            PetscErrorCode ierr;
+            PetscInt       n,i,istart;
+            PetscScalar    *xx;
+            ierr = VecGetOwnershipRange(B,&istart,NULL);CHKERRQ(ierr);
+            ierr = VecGetLocalSize(B,&n);CHKERRQ(ierr);
+            ierr = VecGetArrayWrite(B,&xx);CHKERRQ(ierr);
+            for (i=0; i<n; i++) {
+              PetscScalar v = chebyhash(i+istart);
+              xx[i] = v;
+            }
+            ierr = VecRestoreArrayWrite(B,&xx);CHKERRQ(ierr);
+          }
+        } else {
+          PC        pc;
+          PetscBool change;
 
-      ierr = KSPChebyshevComputeExtremeEigenvalues_Private(cheb->kspest,&min,&max);CHKERRQ(ierr);
+          ierr = KSPGetPC(cheb->kspest,&pc);CHKERRQ(ierr);
+          ierr = PCPreSolveChangeRHS(pc,&change);CHKERRQ(ierr);
+          if (change) {
+            B = ksp->work[1];
+            ierr = VecCopy(ksp->vec_rhs,B);CHKERRQ(ierr);
+          } else {
+            B = ksp->vec_rhs;
+          }
+        }
+        ierr = KSPSolve(cheb->kspest,B,ksp->work[0]);CHKERRQ(ierr);
+        ierr = KSPGetConvergedReason(cheb->kspest,&reason);CHKERRQ(ierr);
+        if (reason == KSP_DIVERGED_ITS) {
+            ierr = PetscInfo(ksp,"Eigen estimator ran for prescribed number of iterations\n");CHKERRQ(ierr);
+        } else if (reason == KSP_DIVERGED_PC_FAILED) {
+            PetscInt       its;
+            PCFailedReason pcreason;
+            PC             pc;
+
+            ierr = KSPGetIterationNumber(cheb->kspest,&its);CHKERRQ(ierr);
+            ierr = KSPGetPC(cheb->kspest,&pc);CHKERRQ(ierr);
+            ierr = PCGetFailedReason(pc,&pcreason);CHKERRQ(ierr);
+            if (!pcreason) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_PLIB,"KSP has KSP_DIVERGED_PC_FAILED but PC has no error flag");
+            ksp->reason = KSP_DIVERGED_PC_FAILED;
+            ierr = VecSetInf(ksp->vec_sol);CHKERRQ(ierr);
+            ierr = PetscInfo3(ksp,"Eigen estimator failed: %s %s at iteration %D",KSPConvergedReasons[reason],PCFailedReasons[pcreason],its);CHKERRQ(ierr);
+            PetscFunctionReturn(0);
+        } else if (reason==KSP_CONVERGED_RTOL ||reason==KSP_CONVERGED_ATOL) {
+          ierr = PetscInfo(ksp,"Eigen estimator converged prematurely. Should not happen except for small or low rank problem\n");CHKERRQ(ierr);
+        } else if (reason < 0) {
+          ierr = PetscInfo1(ksp,"Eigen estimator failed %s, using estimates anyway\n",KSPConvergedReasons[reason]);CHKERRQ(ierr);
+        }
 
-      cheb->emin_computed = min;
-      cheb->emax_computed = max;
-      cheb->emin = cheb->tform[0]*min + cheb->tform[1]*max;
-      cheb->emax = cheb->tform[2]*min + cheb->tform[3]*max;
+        ierr = KSPChebyshevComputeExtremeEigenvalues_Private(cheb->kspest,&min,&max);CHKERRQ(ierr);
+
+        cheb->emin_computed = min;
+        cheb->emax_computed = max;
+        cheb->emin = cheb->tform[0]*min + cheb->tform[1]*max;
+        cheb->emax = cheb->tform[2]*min + cheb->tform[3]*max;
+        if (cheb->reusertol) {
+          /* one power iteration from the right hand side of the estimate gives the vector of the next check */
+          if (!cheb->eigvec) {ierr = VecDuplicate(ksp->work[0],&cheb->eigvec);CHKERRQ(ierr);}
+          ierr = KSPChebyshevRayleighQuotient_Private(ksp,Amat,B,ksp->work[2],cheb->eigvec,&rq);CHKERRQ(ierr);
+          ierr = VecNormalize(cheb->eigvec,NULL);CHKERRQ(ierr);
+          ierr = KSPChebyshevRayleighQuotient_Private(ksp,Amat,cheb->eigvec,ksp->work[2],ksp->work[0],&cheb->rq);CHKERRQ(ierr);
+        }
+      }
 
       cheb->amatid    = amatid;
       cheb->pmatid    = pmatid;
@@ -575,6 +670,9 @@ static  PetscErrorCode KSPView_Chebyshev(KSP ksp,PetscViewer viewer)
       if (cheb->usenoisy) {
         ierr = PetscViewerASCIIPrintf(viewer,"  estimating eigenvalues using noisy right hand side\n");CHKERRQ(ierr);
       }
+      if (cheb->reusertol) {
+        ierr = PetscViewerASCIIPrintf(viewer,"  reusing the estimates while the Rayleigh quotient changes less than %g\n",(double)cheb->reusertol);CHKERRQ(ierr);
+      }
     }
   }
   PetscFunctionReturn(0);
@@ -590,6 +688,7 @@ static PetscErrorCode KSPDestroy_Chebyshev(KSP ksp)
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevSetEigenvalues_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigSet_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigSetUseNoisy_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigSetReuse_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigGetKSP_C",NULL);CHKERRQ(ierr);
   ierr = KSPDestroyDefault(ksp);CHKERRQ(ierr);
   PetscFunctionReturn(0);
@@ -604,7 +703,8 @@ static PetscErrorCode KSPDestroy_Chebyshev(KSP ksp)
 .   -ksp_chebyshev_esteig <a,b,c,d> - estimate eigenvalues using a Krylov method, then use this
                          transform for Chebyshev eigenvalue bounds (KSPChebyshevEstEigSet())
 .   -ksp_chebyshev_esteig_steps - number of estimation steps
--   -ksp_chebyshev_esteig_noisy - use noisy number generator to create right hand side for eigenvalue estimator
+.   -ksp_chebyshev_esteig_noisy - use noisy number generator to create right hand side for eigenvalue estimator
+-   -ksp_chebyshev_esteig_reuse_rtol <rtol> - reuse the estimates when the operator changes while a Rayleigh quotient changes less than rtol (KSPChebyshevEstEigSetReuse())
 
    Level: beginner
 
@@ -617,7 +717,7 @@ static PetscErrorCode KSPDestroy_Chebyshev(KSP ksp)
           The user should call KSPChebyshevSetEigenvalues() if they have eigenvalue estimates.
 
 .seealso:  KSPCreate(), KSPSetType(), KSPType (for list of available types), KSP,
-           KSPChebyshevSetEigenvalues(), KSPChebyshevEstEigSet(), KSPChebyshevEstEigSetUseNoisy()
+           KSPChebyshevSetEigenvalues(), KSPChebyshevEstEigSet(), KSPChebyshevEstEigSetUseNoisy(), KSPChebyshevEstEigSetReuse()
            KSPRICHARDSON, KSPCG, PCMG
 
 M*/
@@ -658,6 +758,7 @@ PETSC_EXTERN PetscErrorCode KSPCreate_Chebyshev(KSP ksp)
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevSetEigenvalues_C",KSPChebyshevSetEigenvalues_Chebyshev);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigSet_C",KSPChebyshevEstEigSet_Chebyshev);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigSetUseNoisy_C",KSPChebyshevEstEigSetUseNoisy_Chebyshev);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigSetReuse_C",KSPChebyshevEstEigSetReuse_Chebyshev);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPChebyshevEstEigGetKSP_C",KSPChebyshevEstEigGetKSP_Chebyshev);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -14,6 +14,9 @@ typedef struct {
   PetscReal        tform[4];     /* transform from Krylov estimates to Chebyshev bounds */
   PetscInt         eststeps;     /* number of kspest steps in KSP used to estimate eigenvalues */
   PetscBool        usenoisy;    /* use noisy right hand side vector to estimate eigenvalues */
+  PetscReal        reusertol;    /* reuse the estimates while the Rayleigh quotient of eigvec changes less than this, 0 to always estimate */
+  Vec              eigvec;       /* vector from the last estimate, rich in the eigenvectors of the largest eigenvalues */
+  PetscReal        rq;           /* Rayleigh quotient of eigvec when the eigenvalues were estimated */
   /* For tracking when to update the eigenvalue estimates */
   PetscObjectId    amatid,    pmatid;
   PetscObjectState amatstate, pmatstate;
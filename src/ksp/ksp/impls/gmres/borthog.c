@@ -7,6 +7,7 @@
     given for correct computation of inner products.
 */
 #include <../src/ksp/ksp/impls/gmres/gmresimpl.h>
+#include <petscblaslapack.h>
 
 /*@C
      KSPGMRESModifiedGramSchmidtOrthogonalization -  This is the basic orthogonalization routine
@@ -30,14 +31,37 @@ PetscErrorCode  KSPGMRESModifiedGramSchmidtOrthogonalization(KSP ksp,PetscInt it
 {
   KSP_GMRES      *gmres = (KSP_GMRES*)(ksp->data);
   PetscErrorCode ierr;
-  PetscInt       j;
-  PetscScalar    *hh,*hes;
+  PetscInt       j,nloc;
+  PetscScalar    *hh,*hes,*x,*v,alpha;
+  PetscBLASInt   bn,one = 1;
 
   PetscFunctionBegin;
   ierr = PetscLogEventBegin(KSP_GMRESOrthogonalization,ksp,0,0,0);CHKERRQ(ierr);
   /* update Hessenberg matrix and do Gram-Schmidt */
   hh  = HH(0,it);
   hes = HES(0,it);
+  ierr = KSPGMRESBasisGetArray(ksp,it,&v);CHKERRQ(ierr);
+  if (v) {
+    /* the directions are stored in chunks: the same sweep on their arrays, one reduction per direction */
+    ierr = VecGetLocalSize(VEC_VV(it+1),&nloc);CHKERRQ(ierr);
+    ierr = PetscBLASIntCast(nloc,&bn);CHKERRQ(ierr);
+    ierr = VecGetArray(VEC_VV(it+1),&x);CHKERRQ(ierr);
+    for (j=0; j<=it; j++) {
+      ierr = KSPGMRESBasisGetArray(ksp,j,&v);CHKERRQ(ierr);
+      /* (vv(it+1), vv(j)) */
+      *hh  = nloc ? BLASdot_(&bn,v,&one,x,&one) : 0.0;
+      ierr = MPIU_Allreduce(MPI_IN_PLACE,hh,1,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)ksp));CHKERRQ(ierr);
+      *hes++ = *hh;
+      /* vv(it+1) <- vv(it+1) - hh[it+1][j] vv(j) */
+      alpha = -(*hh++);
+      if (nloc) PetscStackCallBLAS("BLASaxpy",BLASaxpy_(&bn,&alpha,v,&one,x,&one));
+    }
+    ierr = VecRestoreArray(VEC_VV(it+1),&x);CHKERRQ(ierr);
+    ierr = PetscLogFlops((it+1)*4.0*nloc);CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(KSP_GMRESOrthogonalization,ksp,0,0,0);CHKERRQ(ierr);
+    for (j=0; j<=it; j++) KSPCheckDot(ksp,*HH(j,it));
+    PetscFunctionReturn(0);
+  }
   for (j=0; j<=it; j++) {
     /* (vv(it+1), vv(j)) */
     ierr   = VecDot(VEC_VV(it+1),VEC_VV(j),hh);CHKERRQ(ierr);
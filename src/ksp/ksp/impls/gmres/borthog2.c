@@ -7,6 +7,7 @@
     given for correct computation of inner products.
 */
 #include <../src/ksp/ksp/impls/gmres/gmresimpl.h>
+#include <petscblaslapack.h>
 
 /*@C
      KSPGMRESClassicalGramSchmidtOrthogonalization -  This is the basic orthogonalization routine
@@ -60,9 +61,9 @@ PetscErrorCode  KSPGMRESClassicalGramSchmidtOrthogonalization(KSP ksp,PetscInt i
 
   /*
      This is really a matrix-vector product, with the matrix stored
-     as pointer to rows
+     as pointer to rows, or as one column major array when the basis is preallocated
   */
-  ierr = VecMDot(VEC_VV(it+1),it+1,&(VEC_VV(0)),lhh);CHKERRQ(ierr); /* <v,vnew> */
+  ierr = KSPGMRESBasisMDot(ksp,VEC_VV(it+1),it+1,lhh);CHKERRQ(ierr); /* <v,vnew> */
   for (j=0; j<=it; j++) {
     KSPCheckDot(ksp,lhh[j]);
     lhh[j] = -lhh[j];
@@ -72,7 +73,7 @@ PetscErrorCode  KSPGMRESClassicalGramSchmidtOrthogonalization(KSP ksp,PetscInt i
          This is really a matrix vector product:
          [h[0],h[1],...]*[ v[0]; v[1]; ...] subtracted from v[it+1].
   */
-  ierr = VecMAXPY(VEC_VV(it+1),it+1,lhh,&VEC_VV(0));CHKERRQ(ierr);
+  ierr = KSPGMRESBasisMAXPY(ksp,VEC_VV(it+1),it+1,lhh);CHKERRQ(ierr);
   /* note lhh[j] is -<v,vnew> , hence the subtraction */
   for (j=0; j<=it; j++) {
     hh[j]  -= lhh[j];     /* hh += <v,vnew> */
@@ -96,9 +97,9 @@ PetscErrorCode  KSPGMRESClassicalGramSchmidtOrthogonalization(KSP ksp,PetscInt i
   }
 
   if (refine) {
-    ierr = VecMDot(VEC_VV(it+1),it+1,&(VEC_VV(0)),lhh);CHKERRQ(ierr); /* <v,vnew> */
+    ierr = KSPGMRESBasisMDot(ksp,VEC_VV(it+1),it+1,lhh);CHKERRQ(ierr); /* <v,vnew> */
     for (j=0; j<=it; j++) lhh[j] = -lhh[j];
-    ierr = VecMAXPY(VEC_VV(it+1),it+1,lhh,&VEC_VV(0));CHKERRQ(ierr);
+    ierr = KSPGMRESBasisMAXPY(ksp,VEC_VV(it+1),it+1,lhh);CHKERRQ(ierr);
     /* note lhh[j] is -<v,vnew> , hence the subtraction */
     for (j=0; j<=it; j++) {
       hh[j]  -= lhh[j];     /* hh += <v,vnew> */
@@ -109,10 +110,139 @@ PetscErrorCode  KSPGMRESClassicalGramSchmidtOrthogonalization(KSP ksp,PetscInt i
   PetscFunctionReturn(0);
 }
 
+/*
+   Starts the reduction of the squared norm of w with a request of its own, so that the operator and the preconditioner
+   applied before KSPGMRESLowSyncNormEnd_Private() can use VecNormBegin() and PetscCommSplitReductionBegin() themselves
+*/
+static PetscErrorCode KSPGMRESLowSyncNormBegin_Private(KSP ksp,Vec w)
+{
+  KSP_GMRES         *gmres = (KSP_GMRES*)(ksp->data);
+  PetscErrorCode    ierr;
+  const PetscScalar *x;
+  PetscInt          n;
+  PetscBLASInt      bn,one = 1;
+  MPI_Comm          comm = PetscObjectComm((PetscObject)w);
+
+  PetscFunctionBegin;
+  ierr = VecGetLocalSize(w,&n);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(n,&bn);CHKERRQ(ierr);
+  ierr = VecGetArrayRead(w,&x);CHKERRQ(ierr);
+  gmres->orthognrm[0] = PetscRealPart(BLASdot_(&bn,x,&one,x,&one));
+  ierr = VecRestoreArrayRead(w,&x);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_MPI_IALLREDUCE)
+  ierr = MPI_Iallreduce(gmres->orthognrm,gmres->orthognrm+1,1,MPIU_REAL,MPIU_SUM,comm,&gmres->orthogreq);CHKERRQ(ierr);
+#elif defined(PETSC_HAVE_MPIX_IALLREDUCE)
+  ierr = MPIX_Iallreduce(gmres->orthognrm,gmres->orthognrm+1,1,MPIU_REAL,MPIU_SUM,comm,&gmres->orthogreq);CHKERRQ(ierr);
+#else
+  ierr = MPIU_Allreduce(gmres->orthognrm,gmres->orthognrm+1,1,MPIU_REAL,MPIU_SUM,comm);CHKERRQ(ierr);
+  gmres->orthogreq = MPI_REQUEST_NULL;
+#endif
+  ierr = PetscLogFlops(2.0*n);CHKERRQ(ierr);
+  gmres->orthognorm = PETSC_TRUE;
+  PetscFunctionReturn(0);
+}
 
+/*@C
+     KSPGMRESLowSyncGramSchmidtOrthogonalization - Classical Gram-Schmidt orthogonalization with a single blocking global
+                reduction per iteration, the reduction for the norm of the new direction is overlapped with the next
+                application of the operator
 
+     Collective on ksp
 
+  Input Parameters:
++   ksp - KSP object, must be associated with GMRES, FGMRES, LGMRES, DGMRES or GCRODR Krylov method
+-   its - one less then the current GMRES restart iteration, i.e. the size of the Krylov space
 
+   Options Database Keys:
+.   -ksp_gmres_lowsyncgramschmidt - Activates KSPGMRESLowSyncGramSchmidtOrthogonalization()
 
+    Notes:
+    The inner products (w,v_j) and the norm of the new direction w are started together with VecMDotBegin() and
+    VecNormBegin() so they are combined in one MPI reduction. The norm of the orthogonalized direction is then only
+    started, with a nonblocking MPI reduction whose request belongs to the KSP; the Krylov method applies the operator
+    (and the preconditioner) to the direction before it is normalized and waits for that request afterwards, scaling both
+    vectors by the norm (lagged normalization). The operator and the preconditioner may do their own reductions, including
+    with VecNormBegin() and VecNormEnd(), meanwhile. The only reduction the iteration waits for is thus the one for the inner products, while
+    KSPGMRESClassicalGramSchmidtOrthogonalization() waits for two (or four with refinement). When the method stops at
+    this iteration, because it converged or restarts, the operator is applied once more than needed.
+
+    The difference ||w||^2 - sum_j |h_j|^2 estimates the squared norm of the orthogonalized direction. When it is small
+    compared with ||w||^2 the direction has lost its orthogonality to rounding and it is orthogonalized a second time,
+    which is the only case with another blocking reduction. KSPGMRESSetCGSRefinementType() is ignored.
+
+    KSPFGMRES only applies the preconditioner early when no KSPFGMRESSetModifyPC() routine is set, since that routine
+    receives the residual norm of the iteration. KSPLGMRES does not for its augmentation steps. KSPPGMRES and
+    KSPPIPEFGMRES use their own pipelined orthogonalization and ignore this routine.
 
+   Level: intermediate
 
+.seealso:  KSPGMRESSetOrthogonalization(), KSPGMRESClassicalGramSchmidtOrthogonalization(), KSPGMRESModifiedGramSchmidtOrthogonalization(),
+           KSPGMRESGetOrthogonalization(), VecMDotBegin(), PetscCommSplitReductionBegin(), KSPPGMRES
+
+@*/
+PetscErrorCode  KSPGMRESLowSyncGramSchmidtOrthogonalization(KSP ksp,PetscInt it)
+{
+  KSP_GMRES      *gmres = (KSP_GMRES*)(ksp->data);
+  PetscErrorCode ierr;
+  PetscInt       j;
+  PetscScalar    *hh,*hes,*lhh;
+  PetscReal      hnrm = 0.0,wnrm;
+  Vec            w = VEC_VV(it+1);
+
+  PetscFunctionBegin;
+  ierr = PetscLogEventBegin(KSP_GMRESOrthogonalization,ksp,0,0,0);CHKERRQ(ierr);
+  if (!gmres->orthogwork) {
+    ierr = PetscMalloc1(gmres->max_k + 2,&gmres->orthogwork);CHKERRQ(ierr);
+  }
+  lhh = gmres->orthogwork;
+  hh  = HH(0,it);
+  hes = HES(0,it);
+
+  /* <v,vnew> and ||vnew|| in one reduction */
+  ierr = VecMDotBegin(w,it+1,&(VEC_VV(0)),lhh);CHKERRQ(ierr);
+  ierr = VecNormBegin(w,NORM_2,&wnrm);CHKERRQ(ierr);
+  ierr = PetscCommSplitReductionBegin(PetscObjectComm((PetscObject)w));CHKERRQ(ierr);
+  ierr = VecMDotEnd(w,it+1,&(VEC_VV(0)),lhh);CHKERRQ(ierr);
+  ierr = VecNormEnd(w,NORM_2,&wnrm);CHKERRQ(ierr);
+  for (j=0; j<=it; j++) {
+    KSPCheckDot(ksp,lhh[j]);
+    hh[j]   = lhh[j];
+    hes[j]  = lhh[j];
+    hnrm   += PetscRealPart(lhh[j] * PetscConj(lhh[j]));
+    lhh[j]  = -lhh[j];
+  }
+  ierr = KSPGMRESBasisMAXPY(ksp,w,it+1,lhh);CHKERRQ(ierr);
+
+  if (wnrm*wnrm - hnrm <= PETSC_SQRT_MACHINE_EPSILON*wnrm*wnrm) {
+    ierr = PetscInfo2(ksp,"Performing iterative refinement wnorm %g hnorm %g\n",(double)wnrm,(double)PetscSqrtReal(hnrm));CHKERRQ(ierr);
+    ierr = KSPGMRESBasisMDot(ksp,w,it+1,lhh);CHKERRQ(ierr);
+    for (j=0; j<=it; j++) lhh[j] = -lhh[j];
+    ierr = KSPGMRESBasisMAXPY(ksp,w,it+1,lhh);CHKERRQ(ierr);
+    for (j=0; j<=it; j++) {
+      hh[j]  -= lhh[j];
+      hes[j] -= lhh[j];
+    }
+  }
+
+  /* the Krylov method ends this reduction with KSPGMRESLowSyncNormEnd_Private() once it has applied the operator to w */
+  ierr = KSPGMRESLowSyncNormBegin_Private(ksp,w);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(KSP_GMRESOrthogonalization,ksp,0,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   KSPGMRESLowSyncNormEnd_Private - Waits for the reduction of the norm of the new direction started by
+   KSPGMRESLowSyncGramSchmidtOrthogonalization(), if any; nrm may be NULL to only complete it
+*/
+PetscErrorCode KSPGMRESLowSyncNormEnd_Private(KSP ksp,PetscReal *nrm)
+{
+  KSP_GMRES      *gmres = (KSP_GMRES*)(ksp->data);
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!gmres->orthognorm) PetscFunctionReturn(0);
+  gmres->orthognorm = PETSC_FALSE;
+  ierr = MPI_Wait(&gmres->orthogreq,MPI_STATUS_IGNORE);CHKERRQ(ierr);
+  if (nrm) *nrm = PetscSqrtReal(gmres->orthognrm[1]);
+  PetscFunctionReturn(0);
+}
@@ -116,6 +116,30 @@ PetscErrorCode  KSPSetUp_DGMRES(KSP ksp)
   PetscFunctionReturn(0);
 }
 
+/* y <- the deflated and preconditioned operator applied to x */
+static PetscErrorCode KSPDGMRESApplyOperator_Private(KSP ksp,Vec x,Vec y)
+{
+  KSP_DGMRES     *dgmres = (KSP_DGMRES*)(ksp->data);
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (dgmres->r > 0) {
+    if (ksp->pc_side == PC_LEFT) {
+      /* Apply the first preconditioner */
+      ierr = KSP_PCApplyBAorAB(ksp,x,VEC_TEMP,VEC_TEMP_MATOP);CHKERRQ(ierr);
+      /* Then apply Deflation as a preconditioner */
+      ierr = KSPDGMRESApplyDeflation(ksp,VEC_TEMP,y);CHKERRQ(ierr);
+    } else if (ksp->pc_side == PC_RIGHT) {
+      ierr = KSPDGMRESApplyDeflation(ksp,x,VEC_TEMP);CHKERRQ(ierr);
+      ierr = KSP_PCApplyBAorAB(ksp,VEC_TEMP,y,VEC_TEMP_MATOP);CHKERRQ(ierr);
+    }
+  } else {
+    ierr = KSP_PCApplyBAorAB(ksp,x,y,VEC_TEMP_MATOP);CHKERRQ(ierr);
+  }
+  dgmres->matvecs += 1;
+  PetscFunctionReturn(0);
+}
+
 /*
  Run GMRES, possibly with restart.  Return residual history if requested.
  input parameters:
@@ -140,7 +164,7 @@ PetscErrorCode KSPDGMRESCycle(PetscInt *itcount,KSP ksp)
   PetscErrorCode ierr;
   PetscInt       it     = 0;
   PetscInt       max_k  = dgmres->max_k;
-  PetscBool      hapend = PETSC_FALSE;
+  PetscBool      hapend = PETSC_FALSE,applied = PETSC_FALSE;
   PetscReal      res_old;
   PetscInt       test = 0;
 
@@ -176,25 +200,31 @@ PetscErrorCode KSPDGMRESCycle(PetscInt *itcount,KSP ksp)
     if (dgmres->vv_allocated <= it + VEC_OFFSET + 1) {
       ierr = KSPDGMRESGetNewVectors(ksp,it+1);CHKERRQ(ierr);
     }
-    if (dgmres->r > 0) {
-      if (ksp->pc_side == PC_LEFT) {
-        /* Apply the first preconditioner */
-        ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(it), VEC_TEMP,VEC_TEMP_MATOP);CHKERRQ(ierr);
-        /* Then apply Deflation as a preconditioner */
-        ierr = KSPDGMRESApplyDeflation(ksp, VEC_TEMP, VEC_VV(1+it));CHKERRQ(ierr);
-      } else if (ksp->pc_side == PC_RIGHT) {
-        ierr = KSPDGMRESApplyDeflation(ksp, VEC_VV(it), VEC_TEMP);CHKERRQ(ierr);
-        ierr = KSP_PCApplyBAorAB(ksp, VEC_TEMP, VEC_VV(1+it), VEC_TEMP_MATOP);CHKERRQ(ierr);
-      }
-    } else {
-      ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(it),VEC_VV(1+it),VEC_TEMP_MATOP);CHKERRQ(ierr);
+    if (!applied) {
+      ierr = KSPDGMRESApplyOperator_Private(ksp,VEC_VV(it),VEC_VV(1+it));CHKERRQ(ierr);
     }
-    dgmres->matvecs += 1;
+    applied = PETSC_FALSE;
     /* update hessenberg matrix and do Gram-Schmidt */
     ierr = (*dgmres->orthog)(ksp,it);CHKERRQ(ierr);
 
     /* vv(i+1) . vv(i+1) */
-    ierr = VecNormalize(VEC_VV(it+1),&tt);CHKERRQ(ierr);
+    if (dgmres->orthognorm) {
+      /* apply the operator of the next iteration to the unnormalized direction while its norm is being reduced */
+      if (it+1 < max_k && ksp->its+1 < ksp->max_it) {
+        if (dgmres->vv_allocated <= it + VEC_OFFSET + 2) {
+          ierr = KSPDGMRESGetNewVectors(ksp,it+2);CHKERRQ(ierr);
+        }
+        ierr    = KSPDGMRESApplyOperator_Private(ksp,VEC_VV(it+1),VEC_VV(it+2));CHKERRQ(ierr);
+        applied = PETSC_TRUE;
+      }
+      ierr = KSPGMRESLowSyncNormEnd_Private(ksp,&tt);CHKERRQ(ierr);
+      if (tt != 0.0) {
+        ierr = VecScale(VEC_VV(it+1),1.0/tt);CHKERRQ(ierr);
+        if (applied) {ierr = VecScale(VEC_VV(it+2),1.0/tt);CHKERRQ(ierr);}
+      }
+    } else {
+      ierr = VecNormalize(VEC_VV(it+1),&tt);CHKERRQ(ierr);
+    }
     /* save the magnitude */
     *HH(it+1,it)  = tt;
     *HES(it+1,it) = tt;
@@ -1114,6 +1144,7 @@ static PetscErrorCode  KSPDGMRESImproveEig_DGMRES(KSP ksp, PetscInt neig)
                              vectors are allocated as needed)
 .   -ksp_gmres_classicalgramschmidt - use classical (unmodified) Gram-Schmidt to orthogonalize against the Krylov space (fast) (the default)
 .   -ksp_gmres_modifiedgramschmidt - use modified Gram-Schmidt in the orthogonalization (more stable, but slower)
+.   -ksp_gmres_lowsyncgramschmidt - use classical Gram-Schmidt with a single blocking global reduction per iteration, see KSPGMRESLowSyncGramSchmidtOrthogonalization()
 .   -ksp_gmres_cgs_refinement_type <refine_never,refine_ifneeded,refine_always> - determine if iterative refinement is used to increase the
                                    stability of the classical Gram-Schmidt  orthogonalization.
 -   -ksp_gmres_krylov_monitor - plot the Krylov space generated
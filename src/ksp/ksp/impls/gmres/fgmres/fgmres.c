@@ -100,6 +100,7 @@ PetscErrorCode KSPFGMRESCycle(PetscInt *itcount,KSP ksp)
   PetscReal      res_norm;
   PetscReal      hapbnd,tt;
   PetscBool      hapend = PETSC_FALSE;  /* indicates happy breakdown ending */
+  PetscBool      applied = PETSC_FALSE; /* the next direction was already preconditioned and multiplied by the operator */
   PetscErrorCode ierr;
   PetscInt       loc_it;                /* local count of # of dir. in Krylov space */
   PetscInt       max_k = fgmres->max_k; /* max # of directions Krylov space */
@@ -155,19 +156,22 @@ PetscErrorCode KSPFGMRESCycle(PetscInt *itcount,KSP ksp)
          be allocated */
     }
 
-    /* CHANGE THE PRECONDITIONER? */
-    /* ModifyPC is the callback function that can be used to
-       change the PC or its attributes before its applied */
-    (*fgmres->modifypc)(ksp,ksp->its,loc_it,res_norm,fgmres->modifyctx);
+    ierr = PCGetOperators(ksp->pc,&Amat,&Pmat);CHKERRQ(ierr);
+    if (!applied) {
+      /* CHANGE THE PRECONDITIONER? */
+      /* ModifyPC is the callback function that can be used to
+         change the PC or its attributes before its applied */
+      (*fgmres->modifypc)(ksp,ksp->its,loc_it,res_norm,fgmres->modifyctx);
 
 
-    /* apply PRECONDITIONER to direction vector and store with
-       preconditioned vectors in prevec */
-    ierr = KSP_PCApply(ksp,VEC_VV(loc_it),PREVEC(loc_it));CHKERRQ(ierr);
+      /* apply PRECONDITIONER to direction vector and store with
+         preconditioned vectors in prevec */
+      ierr = KSP_PCApply(ksp,VEC_VV(loc_it),PREVEC(loc_it));CHKERRQ(ierr);
 
-    ierr = PCGetOperators(ksp->pc,&Amat,&Pmat);CHKERRQ(ierr);
-    /* Multiply preconditioned vector by operator - put in VEC_VV(loc_it+1) */
-    ierr = KSP_MatMult(ksp,Amat,PREVEC(loc_it),VEC_VV(1+loc_it));CHKERRQ(ierr);
+      /* Multiply preconditioned vector by operator - put in VEC_VV(loc_it+1) */
+      ierr = KSP_MatMult(ksp,Amat,PREVEC(loc_it),VEC_VV(1+loc_it));CHKERRQ(ierr);
+    }
+    applied = PETSC_FALSE;
 
 
     /* update hessenberg matrix and do Gram-Schmidt - new direction is in
@@ -175,7 +179,25 @@ PetscErrorCode KSPFGMRESCycle(PetscInt *itcount,KSP ksp)
     ierr = (*fgmres->orthog)(ksp,loc_it);CHKERRQ(ierr);
 
     /* new entry in hessenburg is the 2-norm of our new direction */
-    ierr = VecNorm(VEC_VV(loc_it+1),NORM_2,&tt);CHKERRQ(ierr);
+    if (fgmres->orthognorm) {
+      /* precondition and multiply the unnormalized direction while its norm is being reduced, unless ModifyPC
+         needs the residual norm of this iteration first */
+      if (fgmres->modifypc == KSPFGMRESModifyPCNoChange && loc_it+1 < max_k && ksp->its+1 < ksp->max_it) {
+        if (fgmres->vv_allocated <= loc_it + VEC_OFFSET + 2) {
+          ierr = KSPFGMRESGetNewVectors(ksp,loc_it+2);CHKERRQ(ierr);
+        }
+        ierr    = KSP_PCApply(ksp,VEC_VV(loc_it+1),PREVEC(loc_it+1));CHKERRQ(ierr);
+        ierr    = KSP_MatMult(ksp,Amat,PREVEC(loc_it+1),VEC_VV(loc_it+2));CHKERRQ(ierr);
+        applied = PETSC_TRUE;
+      }
+      ierr = KSPGMRESLowSyncNormEnd_Private(ksp,&tt);CHKERRQ(ierr);
+      if (applied && tt != 0.0) {
+        ierr = VecScale(PREVEC(loc_it+1),1.0/tt);CHKERRQ(ierr);
+        ierr = VecScale(VEC_VV(loc_it+2),1.0/tt);CHKERRQ(ierr);
+      }
+    } else {
+      ierr = VecNorm(VEC_VV(loc_it+1),NORM_2,&tt);CHKERRQ(ierr);
+    }
 
     *HH(loc_it+1,loc_it)  = tt;
     *HES(loc_it+1,loc_it) = tt;
@@ -640,6 +662,7 @@ PetscErrorCode  KSPGMRESGetRestart_FGMRES(KSP ksp,PetscInt *max_k)
                              vectors are allocated as needed)
 .   -ksp_gmres_classicalgramschmidt - use classical (unmodified) Gram-Schmidt to orthogonalize against the Krylov space (fast) (the default)
 .   -ksp_gmres_modifiedgramschmidt - use modified Gram-Schmidt in the orthogonalization (more stable, but slower)
+.   -ksp_gmres_lowsyncgramschmidt - use classical Gram-Schmidt with a single blocking global reduction per iteration, see KSPGMRESLowSyncGramSchmidtOrthogonalization()
 .   -ksp_gmres_cgs_refinement_type <refine_never,refine_ifneeded,refine_always> - determine if iterative refinement is used to increase the
                                    stability of the classical Gram-Schmidt  orthogonalization.
 .   -ksp_gmres_krylov_monitor - plot the Krylov space generated
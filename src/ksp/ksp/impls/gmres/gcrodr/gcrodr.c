@@ -0,0 +1,820 @@
+/*
+    This file implements GCRO-DR, GMRES with deflated restarting that recycles a subspace between
+    successive calls to KSPSolve().
+
+    Reference: Parks, de Sturler, Mackey, Johnson, Maiti, Recycling Krylov subspaces for sequences
+    of linear systems, SIAM J. Sci. Comput. 28(5), 2006.
+
+    A subspace U, together with its image C = Op U whose columns are orthonormal, is kept in the
+    KSP. Each cycle first removes the component of the residual in the range of C (which updates
+    the solution with U C^H r), and then runs Arnoldi with the operator (I - C C^H) Op, so that
+
+       Op V_m = C B_m + V_{m+1} H_m,   B_m = C^H Op V_m
+
+    The correction minimizing the residual over the range of [U V_m] is V_m y - U B_m y where y
+    solves the usual GMRES least squares problem with H_m. At the end of each cycle U and C are
+    replaced by the harmonic Ritz vectors of Op with respect to the range of [U V_m] whose
+    harmonic Ritz values are the smallest in magnitude. When the operator changes between two
+    solves, C is recomputed from U, which costs one application of the operator per vector.
+*/
+
+#include <../src/ksp/ksp/impls/gmres/gcrodr/gcrodrimpl.h>       /*I  "petscksp.h"  I*/
+#include <petscblaslapack.h>
+#define GCRODR_DELTA_DIRECTIONS 10
+#define GCRODR_DEFAULT_MAXK     30
+#define GCRODR_DEFAULT_RECYCLE  10
+static PetscErrorCode KSPGCRODRUpdateHessenberg(KSP,PetscInt,PetscBool,PetscReal*);
+static PetscErrorCode KSPGCRODRBuildSoln(PetscScalar*,Vec,Vec,KSP,PetscInt);
+
+static PetscErrorCode KSPSetUp_GCRODR(KSP ksp)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscInt       k = gcrodr->recycle+1;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+#if defined(PETSC_HAVE_ESSL)
+  SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_SUP,"GCRODR requires the LAPACK calling sequence of geev(), not the ESSL one");
+#endif
+  if (gcrodr->recycle >= gcrodr->max_k) SETERRQ2(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_OUTOFRANGE,"The dimension of the recycled subspace %D must be smaller than the restart %D",gcrodr->recycle,gcrodr->max_k);
+  ierr = KSPSetUp_GMRES(ksp);CHKERRQ(ierr);
+
+  /* U and Unew (C and Cnew) share one array so that their vectors can be swapped one by one */
+  ierr = KSPCreateVecs(ksp,2*k,&gcrodr->U,2*k,&gcrodr->C);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,2*k,gcrodr->U);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,2*k,gcrodr->C);CHKERRQ(ierr);
+  gcrodr->Unew      = gcrodr->U+k;
+  gcrodr->Cnew      = gcrodr->C+k;
+  gcrodr->nrecycled = 0;
+  ierr = PetscMalloc2(k*gcrodr->max_k,&gcrodr->B,k,&gcrodr->coef);CHKERRQ(ierr);
+  ierr = PetscLogObjectMemory((PetscObject)ksp,k*(gcrodr->max_k+1)*sizeof(PetscScalar));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+    KSPGCRODRUpdateImage - Recomputes C = Op U when the operator or the preconditioner changed since
+    C was computed, and orthonormalizes C by applying the same transformation to U. Vectors of U whose
+    image is numerically dependent on the previous ones are discarded.
+*/
+static PetscErrorCode KSPGCRODRUpdateImage(KSP ksp)
+{
+  KSP_GCRODR       *gcrodr = (KSP_GCRODR*)ksp->data;
+  Mat              Amat,Pmat;
+  PetscObjectId    amatid,pmatid;
+  PetscObjectState amatstate,pmatstate;
+  PetscReal        nrm0,nrm;
+  PetscInt         i,j,l,pass,k = gcrodr->nrecycled;
+  Vec              t;
+  PetscErrorCode   ierr;
+
+  PetscFunctionBegin;
+  ierr = PCGetOperators(ksp->pc,&Amat,&Pmat);CHKERRQ(ierr);
+  ierr = PetscObjectGetId((PetscObject)Amat,&amatid);CHKERRQ(ierr);
+  ierr = PetscObjectGetId((PetscObject)Pmat,&pmatid);CHKERRQ(ierr);
+  ierr = PetscObjectStateGet((PetscObject)Amat,&amatstate);CHKERRQ(ierr);
+  ierr = PetscObjectStateGet((PetscObject)Pmat,&pmatstate);CHKERRQ(ierr);
+  if (k && (amatid != gcrodr->amatid || pmatid != gcrodr->pmatid || amatstate != gcrodr->amatstate || pmatstate != gcrodr->pmatstate || ksp->pc_side != gcrodr->pcside)) {
+    ierr = PetscInfo1(ksp,"Operator changed, recomputing the image of the %D recycled vectors\n",k);CHKERRQ(ierr);
+    for (i=0; i<k; i++) {
+      ierr = KSP_PCApplyBAorAB(ksp,gcrodr->U[i],gcrodr->C[i],VEC_TEMP_MATOP);CHKERRQ(ierr);
+    }
+    /* two passes of classical Gram-Schmidt on C, the same combinations are applied to U */
+    for (i=0,j=0; i<k; i++) {
+      if (i != j) {
+        t = gcrodr->U[j]; gcrodr->U[j] = gcrodr->U[i]; gcrodr->U[i] = t;
+        t = gcrodr->C[j]; gcrodr->C[j] = gcrodr->C[i]; gcrodr->C[i] = t;
+      }
+      ierr = VecNorm(gcrodr->C[j],NORM_2,&nrm0);CHKERRQ(ierr);
+      for (pass=0; pass<2 && j; pass++) {
+        ierr = VecMDot(gcrodr->C[j],j,gcrodr->C,gcrodr->coef);CHKERRQ(ierr);
+        for (l=0; l<j; l++) gcrodr->coef[l] = -gcrodr->coef[l];
+        ierr = VecMAXPY(gcrodr->C[j],j,gcrodr->coef,gcrodr->C);CHKERRQ(ierr);
+        ierr = VecMAXPY(gcrodr->U[j],j,gcrodr->coef,gcrodr->U);CHKERRQ(ierr);
+      }
+      ierr = VecNorm(gcrodr->C[j],NORM_2,&nrm);CHKERRQ(ierr);
+      if (nrm <= PETSC_SQRT_MACHINE_EPSILON*nrm0) {
+        ierr = PetscInfo1(ksp,"Discarding recycled vector %D, its image is dependent on the previous ones\n",i);CHKERRQ(ierr);
+        continue;
+      }
+      ierr = VecScale(gcrodr->C[j],1.0/nrm);CHKERRQ(ierr);
+      ierr = VecScale(gcrodr->U[j],1.0/nrm);CHKERRQ(ierr);
+      j++;
+    }
+    gcrodr->nrecycled = j;
+  }
+  gcrodr->amatid    = amatid;
+  gcrodr->pmatid    = pmatid;
+  gcrodr->amatstate = amatstate;
+  gcrodr->pmatstate = pmatstate;
+  gcrodr->pcside    = ksp->pc_side;
+  PetscFunctionReturn(0);
+}
+
+/*
+    KSPGCRODRProject - Removes from the residual in VEC_VV(0) its component in the range of C and
+    updates the solution accordingly: x = x + U C^H r, r = r - C C^H r
+*/
+static PetscErrorCode KSPGCRODRProject(KSP ksp)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscInt       i,k = gcrodr->nrecycled;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!k) PetscFunctionReturn(0);
+  ierr = VecMDot(VEC_VV(0),k,gcrodr->C,gcrodr->coef);CHKERRQ(ierr);
+  ierr = VecSet(VEC_TEMP,0.0);CHKERRQ(ierr);
+  ierr = VecMAXPY(VEC_TEMP,k,gcrodr->coef,gcrodr->U);CHKERRQ(ierr);
+  ierr = KSPUnwindPreconditioner(ksp,VEC_TEMP,VEC_TEMP_MATOP);CHKERRQ(ierr);
+  ierr = VecAXPY(ksp->vec_sol,1.0,VEC_TEMP);CHKERRQ(ierr);
+  for (i=0; i<k; i++) gcrodr->coef[i] = -gcrodr->coef[i];
+  ierr = VecMAXPY(VEC_VV(0),k,gcrodr->coef,gcrodr->C);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+    KSPGCRODRUpdateRecycle - Replaces U and C with the harmonic Ritz vectors of the cycle of m steps
+    that just ended.
+
+    With Vh = [U V_m] and Wh = [C V_{m+1}] the Arnoldi relation reads Op Vh = Wh G where
+
+        G = [ I  B_m ]
+            [ 0  H_m ]
+
+    and the harmonic Ritz pairs (theta,Vh z) of Op with respect to the range of Vh are the solutions of
+    G^H G z = theta G^H Wh^H Vh z. These are computed as the eigenpairs (1/theta,z) of
+    K = (G^H G)^{-1} G^H Wh^H Vh, the largest in magnitude being kept in P. With the QR factorization
+    G P = Q R, the new recycled subspace U = Vh P R^{-1} has the orthonormal image C = Op U = Wh Q.
+*/
+static PetscErrorCode KSPGCRODRUpdateRecycle(KSP ksp,PetscInt m)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscInt       k = gcrodr->nrecycled,n = k+m,n1 = n+1,nk,i,j,l,*perm,*sel;
+  PetscScalar    *G,*W,*GG,*VR,*K,*tau,*work,*Y,one = 1.0,zero = 0.0,sdummy = 0.0;
+  PetscReal      *modul,rmax = 0.0;
+  PetscBLASInt   bn,bn1,bnk,lwork,info,idummy = 1,*ipiv;
+  Vec            t;
+#if defined(PETSC_USE_COMPLEX)
+  PetscScalar    *eig;
+  PetscReal      *rwork;
+#else
+  PetscReal      *wr,*wi;
+  PetscBool      found;
+#endif
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!m) PetscFunctionReturn(0);
+  ierr = PetscBLASIntCast(n,&bn);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(n1,&bn1);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(5*n1,&lwork);CHKERRQ(ierr);
+  ierr = PetscCalloc7(n1*n,&G,n1*n,&W,n*n,&GG,n*n,&VR,n*n,&K,n1,&tau,lwork,&work);CHKERRQ(ierr);
+#if defined(PETSC_USE_COMPLEX)
+  ierr = PetscMalloc6(n,&modul,n,&perm,n+1,&sel,n,&ipiv,n,&eig,2*n,&rwork);CHKERRQ(ierr);
+#else
+  ierr = PetscMalloc6(n,&modul,n,&perm,n+1,&sel,n,&ipiv,n,&wr,n,&wi);CHKERRQ(ierr);
+#endif
+
+  /* G and Wh^H Vh = [C^H U 0; V_{m+1}^H U [I; 0]] */
+  for (i=0; i<k; i++) G[i+i*n1] = 1.0;
+  for (j=0; j<m; j++) {
+    for (i=0; i<k; i++) G[i+(k+j)*n1] = *BB(i,j);
+    for (i=0; i<=j+1; i++) G[k+i+(k+j)*n1] = *HES(i,j);
+    W[k+j+(k+j)*n1] = 1.0;
+  }
+  for (j=0; j<k; j++) {
+    ierr = VecMDot(gcrodr->U[j],k,gcrodr->C,W+j*n1);CHKERRQ(ierr);
+    ierr = KSPGMRESBasisMDot(ksp,gcrodr->U[j],m+1,W+k+j*n1);CHKERRQ(ierr);
+  }
+
+  /* K = (G^H G)^{-1} G^H Wh^H Vh */
+  PetscStackCallBLAS("BLASgemm",BLASgemm_("C","N",&bn,&bn,&bn1,&one,G,&bn1,G,&bn1,&zero,GG,&bn));
+  PetscStackCallBLAS("BLASgemm",BLASgemm_("C","N",&bn,&bn,&bn1,&one,G,&bn1,W,&bn1,&zero,K,&bn));
+  PetscStackCallBLAS("LAPACKgesv",LAPACKgesv_(&bn,&bn,GG,&bn,ipiv,K,&bn,&info));
+  if (info) {
+    ierr = PetscInfo1(ksp,"Singular projected problem (gesv info %d), keeping the recycled subspace\n",(int)info);CHKERRQ(ierr);
+    goto finally;
+  }
+  ierr = PetscFPTrapPush(PETSC_FP_TRAP_OFF);CHKERRQ(ierr);
+#if defined(PETSC_USE_COMPLEX)
+  PetscStackCallBLAS("LAPACKgeev",LAPACKgeev_("N","V",&bn,K,&bn,eig,&sdummy,&idummy,VR,&bn,work,&lwork,rwork,&info));
+  for (i=0; i<n; i++) modul[i] = -PetscAbsScalar(eig[i]);
+#else
+  PetscStackCallBLAS("LAPACKgeev",LAPACKgeev_("N","V",&bn,K,&bn,wr,wi,&sdummy,&idummy,VR,&bn,work,&lwork,&info));
+  for (i=0; i<n; i++) modul[i] = -PetscSqrtReal(wr[i]*wr[i]+wi[i]*wi[i]);
+#endif
+  ierr = PetscFPTrapPop();CHKERRQ(ierr);
+  if (info) {
+    ierr = PetscInfo1(ksp,"Failure in the harmonic Ritz problem (geev info %d), keeping the recycled subspace\n",(int)info);CHKERRQ(ierr);
+    goto finally;
+  }
+
+  /* select the largest eigenvalues of K, that is the smallest harmonic Ritz values */
+  for (i=0; i<n; i++) perm[i] = i;
+  ierr = PetscSortRealWithPermutation(n,modul,perm);CHKERRQ(ierr);
+  nk   = PetscMin(gcrodr->recycle,n);
+  for (i=0; i<nk; i++) sel[i] = perm[i];
+#if !defined(PETSC_USE_COMPLEX)
+  /* the real and imaginary parts of a complex conjugate pair are stored in consecutive columns of VR, keep both */
+  l = sel[nk-1];
+  if (wi[l] != 0.0) {
+    l     = wi[l] > 0.0 ? l+1 : l-1;
+    found = PETSC_FALSE;
+    for (i=0; i<nk; i++) if (sel[i] == l) found = PETSC_TRUE;
+    if (!found) sel[nk++] = l;
+  }
+#endif
+  ierr = PetscBLASIntCast(nk,&bnk);CHKERRQ(ierr);
+
+  /* Y = P, G P = Q R, Y = P R^{-1} */
+  Y = GG;
+  for (j=0; j<nk; j++) {ierr = PetscArraycpy(Y+j*n,VR+sel[j]*n,n);CHKERRQ(ierr);}
+  PetscStackCallBLAS("BLASgemm",BLASgemm_("N","N",&bn1,&bnk,&bn,&one,G,&bn1,Y,&bn,&zero,W,&bn1));
+  PetscStackCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&bn1,&bnk,W,&bn1,tau,work,&lwork,&info));
+  if (info) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in LAPACK routine geqrf %d",(int)info);
+  for (j=0; j<nk; j++) rmax = PetscMax(rmax,PetscAbsScalar(W[j+j*n1]));
+  for (j=0; j<nk; j++) {
+    if (PetscAbsScalar(W[j+j*n1]) <= PETSC_SQRT_MACHINE_EPSILON*rmax) {
+      ierr = PetscInfo(ksp,"Dependent harmonic Ritz vectors, keeping the recycled subspace\n");CHKERRQ(ierr);
+      goto finally;
+    }
+    for (l=0; l<j; l++) {
+      for (i=0; i<n; i++) Y[i+j*n] -= Y[i+l*n]*W[l+j*n1];
+    }
+    for (i=0; i<n; i++) Y[i+j*n] /= W[j+j*n1];
+  }
+  PetscStackCallBLAS("LAPACKorgqr",LAPACKorgqr_(&bn1,&bnk,&bnk,W,&bn1,tau,work,&lwork,&info));
+  if (info) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in LAPACK routine orgqr %d",(int)info);
+
+  /* C = Wh Q and U = Vh Y */
+  for (j=0; j<nk; j++) {
+    ierr = VecSet(gcrodr->Cnew[j],0.0);CHKERRQ(ierr);
+    ierr = VecSet(gcrodr->Unew[j],0.0);CHKERRQ(ierr);
+    if (k) {
+      ierr = VecMAXPY(gcrodr->Cnew[j],k,W+j*n1,gcrodr->C);CHKERRQ(ierr);
+      ierr = VecMAXPY(gcrodr->Unew[j],k,Y+j*n,gcrodr->U);CHKERRQ(ierr);
+    }
+    ierr = KSPGMRESBasisMAXPY(ksp,gcrodr->Cnew[j],m+1,W+k+j*n1);CHKERRQ(ierr);
+    ierr = KSPGMRESBasisMAXPY(ksp,gcrodr->Unew[j],m,Y+k+j*n);CHKERRQ(ierr);
+  }
+  for (j=0; j<nk; j++) {
+    t = gcrodr->U[j]; gcrodr->U[j] = gcrodr->Unew[j]; gcrodr->Unew[j] = t;
+    t = gcrodr->C[j]; gcrodr->C[j] = gcrodr->Cnew[j]; gcrodr->Cnew[j] = t;
+  }
+  gcrodr->nrecycled = nk;
+
+finally:
+  ierr = PetscFree7(G,W,GG,VR,K,tau,work);CHKERRQ(ierr);
+#if defined(PETSC_USE_COMPLEX)
+  ierr = PetscFree6(modul,perm,sel,ipiv,eig,rwork);CHKERRQ(ierr);
+#else
+  ierr = PetscFree6(modul,perm,sel,ipiv,wr,wi);CHKERRQ(ierr);
+#endif
+  PetscFunctionReturn(0);
+}
+
+/*
+    KSPGCRODRCycle - Runs one cycle of GCRO-DR and updates the recycled subspace.
+
+    On entry, the residual in VEC_VV(0) must be orthogonal to C.
+ */
+static PetscErrorCode KSPGCRODRCycle(PetscInt *itcount,KSP ksp)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)(ksp->data);
+  PetscReal      res,hapbnd,tt;
+  PetscErrorCode ierr;
+  PetscInt       i,it = 0,k = gcrodr->nrecycled,max_k = gcrodr->max_k;
+  PetscBool      hapend = PETSC_FALSE,applied = PETSC_FALSE;
+
+  PetscFunctionBegin;
+  if (itcount) *itcount = 0;
+  ierr    = VecNormalize(VEC_VV(0),&res);CHKERRQ(ierr);
+  KSPCheckNorm(ksp,res);
+  *GRS(0) = res;
+
+  ierr       = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ksp->rnorm = res;
+  ierr       = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+  gcrodr->it = (it - 1);
+  if (!res) {
+    ksp->reason = KSP_CONVERGED_ATOL;
+    ierr        = PetscInfo(ksp,"Converged due to zero residual norm after the projection onto the recycled subspace\n");CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  /* the residual before the projection onto the recycled subspace was already tested by KSPSolve_GCRODR() */
+  if (ksp->its) {
+    ierr = KSPLogResidualHistory(ksp,res);CHKERRQ(ierr);
+    ierr = KSPMonitor(ksp,ksp->its,res);CHKERRQ(ierr);
+    ierr = (*ksp->converged)(ksp,ksp->its,res,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+  }
+  while (!ksp->reason && it < max_k && ksp->its < ksp->max_it) {
+    if (it) {
+      ierr = KSPLogResidualHistory(ksp,res);CHKERRQ(ierr);
+      ierr = KSPMonitor(ksp,ksp->its,res);CHKERRQ(ierr);
+    }
+    gcrodr->it = (it - 1);
+    if (gcrodr->vv_allocated <= it + VEC_OFFSET + 1) {
+      ierr = KSPGMRESGetNewVectors(ksp,it+1);CHKERRQ(ierr);
+    }
+    if (!applied) {
+      ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(it),VEC_VV(1+it),VEC_TEMP_MATOP);CHKERRQ(ierr);
+    }
+    applied = PETSC_FALSE;
+
+    /* orthogonalize against the image of the recycled subspace, B(:,it) = C^H Op v_it */
+    if (k) {
+      ierr = VecMDot(VEC_VV(1+it),k,gcrodr->C,BB(0,it));CHKERRQ(ierr);
+      for (i=0; i<k; i++) gcrodr->coef[i] = -*BB(i,it);
+      ierr = VecMAXPY(VEC_VV(1+it),k,gcrodr->coef,gcrodr->C);CHKERRQ(ierr);
+    }
+
+    /* update hessenberg matrix and do Gram-Schmidt */
+    ierr = (*gcrodr->orthog)(ksp,it);CHKERRQ(ierr);
+    if (ksp->reason) {ierr = KSPGMRESLowSyncNormEnd_Private(ksp,NULL);CHKERRQ(ierr);break;}
+
+    if (gcrodr->orthognorm) {
+      /* apply the operator of the next iteration to the unnormalized direction while its norm is being reduced */
+      if (it+1 < max_k && ksp->its+1 < ksp->max_it) {
+        if (gcrodr->vv_allocated <= it + VEC_OFFSET + 2) {
+          ierr = KSPGMRESGetNewVectors(ksp,it+2);CHKERRQ(ierr);
+        }
+        ierr    = KSP_PCApplyBAorAB(ksp,VEC_VV(it+1),VEC_VV(it+2),VEC_TEMP_MATOP);CHKERRQ(ierr);
+        applied = PETSC_TRUE;
+      }
+      ierr = KSPGMRESLowSyncNormEnd_Private(ksp,&tt);CHKERRQ(ierr);
+      if (tt != 0.0) {
+        ierr = VecScale(VEC_VV(it+1),1.0/tt);CHKERRQ(ierr);
+        if (applied) {ierr = VecScale(VEC_VV(it+2),1.0/tt);CHKERRQ(ierr);}
+      }
+    } else {
+      ierr = VecNormalize(VEC_VV(it+1),&tt);CHKERRQ(ierr);
+    }
+    KSPCheckNorm(ksp,tt);
+
+    /* save the magnitude */
+    *HH(it+1,it)  = tt;
+    *HES(it+1,it) = tt;
+
+    /* check for the happy breakdown */
+    hapbnd = PetscAbsScalar(tt / *GRS(it));
+    if (hapbnd > gcrodr->haptol) hapbnd = gcrodr->haptol;
+    if (tt < hapbnd) {
+      ierr   = PetscInfo2(ksp,"Detected happy breakdown, current hapbnd = %14.12e tt = %14.12e\n",(double)hapbnd,(double)tt);CHKERRQ(ierr);
+      hapend = PETSC_TRUE;
+    }
+    ierr = KSPGCRODRUpdateHessenberg(ksp,it,hapend,&res);CHKERRQ(ierr);
+
+    it++;
+    gcrodr->it = (it-1);   /* For converged */
+    ksp->its++;
+    ksp->rnorm = res;
+    if (ksp->reason) break;
+
+    ierr = (*ksp->converged)(ksp,ksp->its,res,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+
+    /* Catch error in happy breakdown and signal convergence and break from loop */
+    if (hapend) {
+      if (!ksp->reason) {
+        if (ksp->errorifnotconverged) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"You reached the happy break down, but convergence was not indicated. Residual norm = %g",(double)res);
+        else {
+          ksp->reason = KSP_DIVERGED_BREAKDOWN;
+          break;
+        }
+      }
+    }
+  }
+
+  /* Monitor if we know that we will not return for a restart */
+  if (it && (ksp->reason || ksp->its >= ksp->max_it)) {
+    ierr = KSPLogResidualHistory(ksp,res);CHKERRQ(ierr);
+    ierr = KSPMonitor(ksp,ksp->its,res);CHKERRQ(ierr);
+  }
+
+  if (itcount) *itcount = it;
+
+  /* Form the solution (or the solution so far), GRS(0) is used as work space */
+  ierr = KSPGCRODRBuildSoln(GRS(0),ksp->vec_sol,ksp->vec_sol,ksp,it-1);CHKERRQ(ierr);
+  gcrodr->it = -1;
+
+  /* the last basis vector is not normalized after a happy breakdown, the next solve starts from the current recycled subspace */
+  if (!hapend && ksp->reason >= 0) {
+    ierr = KSPGCRODRUpdateRecycle(ksp,it);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSolve_GCRODR(KSP ksp)
+{
+  KSP_GCRODR     *gcrodr    = (KSP_GCRODR*)ksp->data;
+  PetscBool      guess_zero = ksp->guess_zero;
+  PetscInt       its;
+  PetscReal      res;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (ksp->calc_sings && !gcrodr->Rsvd) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ORDER,"Must call KSPSetComputeSingularValues() before KSPSetUp() is called");
+
+  ierr        = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ksp->its    = 0;
+  ksp->reason = KSP_CONVERGED_ITERATING;
+  ierr        = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+  gcrodr->it  = -1;
+
+  /* the convergence test is relative to the residual before the projection onto the recycled subspace */
+  ierr = KSPInitialResidual(ksp,ksp->vec_sol,VEC_TEMP,VEC_TEMP_MATOP,VEC_VV(0),ksp->vec_rhs);CHKERRQ(ierr);
+  ierr = VecNorm(VEC_VV(0),NORM_2,&res);CHKERRQ(ierr);
+  KSPCheckNorm(ksp,res);
+  ierr       = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ksp->rnorm = res;
+  ierr       = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ierr = KSPLogResidualHistory(ksp,res);CHKERRQ(ierr);
+  ierr = KSPMonitor(ksp,0,res);CHKERRQ(ierr);
+  ierr = (*ksp->converged)(ksp,0,res,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+  if (ksp->reason) PetscFunctionReturn(0);
+
+  ierr = KSPGCRODRUpdateImage(ksp);CHKERRQ(ierr);
+  while (!ksp->reason) {
+    ierr = KSPGCRODRProject(ksp);CHKERRQ(ierr);
+    ierr = KSPGCRODRCycle(&its,ksp);CHKERRQ(ierr);
+    if (ksp->reason) break;
+    if (ksp->its >= ksp->max_it) {
+      ksp->reason = KSP_DIVERGED_ITS;
+      break;
+    }
+    ksp->guess_zero = PETSC_FALSE; /* every future call to KSPInitialResidual() will have nonzero guess */
+    ierr = KSPInitialResidual(ksp,ksp->vec_sol,VEC_TEMP,VEC_TEMP_MATOP,VEC_VV(0),ksp->vec_rhs);CHKERRQ(ierr);
+  }
+  ksp->guess_zero = guess_zero; /* restore if user provided nonzero initial guess */
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPReset_GCRODR(KSP ksp)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (gcrodr->U) {
+    ierr = VecDestroyVecs(2*(gcrodr->recycle+1),&gcrodr->U);CHKERRQ(ierr);
+    ierr = VecDestroyVecs(2*(gcrodr->recycle+1),&gcrodr->C);CHKERRQ(ierr);
+  }
+  ierr = PetscFree2(gcrodr->B,gcrodr->coef);CHKERRQ(ierr);
+  gcrodr->Unew      = NULL;
+  gcrodr->Cnew      = NULL;
+  gcrodr->nrecycled = 0;
+  ierr = KSPReset_GMRES(ksp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPDestroy_GCRODR(KSP ksp)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = KSPReset_GCRODR(ksp);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGCRODRSetRecycle_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGCRODRGetRecycle_C",NULL);CHKERRQ(ierr);
+  ierr = KSPDestroy_GMRES(ksp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+    KSPGCRODRBuildSoln - create the solution from the starting vector and the
+                         current iterates, the correction is V y - U B y.
+
+    Input parameters:
+        nrs - work area of size it + 1.
+        vs  - index of initial guess
+        vdest - index of result.  Note that vs may == vdest (replace
+                guess with the solution).
+        it - HH upper triangular part is a block of size (it+1) x (it+1)
+ */
+static PetscErrorCode KSPGCRODRBuildSoln(PetscScalar *nrs,Vec vs,Vec vdest,KSP ksp,PetscInt it)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)(ksp->data);
+  PetscScalar    tt;
+  PetscErrorCode ierr;
+  PetscInt       ii,k,j,nr = gcrodr->nrecycled;
+
+  PetscFunctionBegin;
+  /* If it is < 0, no gcrodr steps have been performed */
+  if (it < 0) {
+    ierr = VecCopy(vs,vdest);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  if (*HH(it,it) != 0.0) {
+    nrs[it] = *GRS(it) / *HH(it,it);
+  } else {
+    if (ksp->errorifnotconverged) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"You reached the break down in GCRODR; HH(it,it) = 0");
+    else ksp->reason = KSP_DIVERGED_BREAKDOWN;
+
+    ierr = PetscInfo2(ksp,"Likely your matrix or preconditioner is singular. HH(it,it) is identically zero; it = %D GRS(it) = %g\n",it,(double)PetscAbsScalar(*GRS(it)));CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  for (ii=1; ii<=it; ii++) {
+    k  = it - ii;
+    tt = *GRS(k);
+    for (j=k+1; j<=it; j++) tt = tt - *HH(k,j) * nrs[j];
+    if (*HH(k,k) == 0.0) {
+      if (ksp->errorifnotconverged) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"Likely your matrix or preconditioner is singular. HH(k,k) is identically zero; k = %D\n",k);
+      else {
+        ksp->reason = KSP_DIVERGED_BREAKDOWN;
+        ierr = PetscInfo1(ksp,"Likely your matrix or preconditioner is singular. HH(k,k) is identically zero; k = %D\n",k);CHKERRQ(ierr);
+        PetscFunctionReturn(0);
+      }
+    }
+    nrs[k] = tt / *HH(k,k);
+  }
+
+  /* Accumulate the correction to the solution of the preconditioned problem in TEMP */
+  ierr = VecSet(VEC_TEMP,0.0);CHKERRQ(ierr);
+  ierr = KSPGMRESBasisMAXPY(ksp,VEC_TEMP,it+1,nrs);CHKERRQ(ierr);
+  if (nr) {
+    for (k=0; k<nr; k++) {
+      tt = 0.0;
+      for (j=0; j<=it; j++) tt += *BB(k,j) * nrs[j];
+      gcrodr->coef[k] = -tt;
+    }
+    ierr = VecMAXPY(VEC_TEMP,nr,gcrodr->coef,gcrodr->U);CHKERRQ(ierr);
+  }
+
+  ierr = KSPUnwindPreconditioner(ksp,VEC_TEMP,VEC_TEMP_MATOP);CHKERRQ(ierr);
+  /* add solution to previous solution */
+  if (vdest != vs) {
+    ierr = VecCopy(vs,vdest);CHKERRQ(ierr);
+  }
+  ierr = VecAXPY(vdest,1.0,VEC_TEMP);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Do the scalar work for the orthogonalization.  Return new residual norm.
+ */
+static PetscErrorCode KSPGCRODRUpdateHessenberg(KSP ksp,PetscInt it,PetscBool hapend,PetscReal *res)
+{
+  PetscScalar *hh,*cc,*ss,tt;
+  PetscInt    j;
+  KSP_GCRODR  *gcrodr = (KSP_GCRODR*)(ksp->data);
+
+  PetscFunctionBegin;
+  hh = HH(0,it);
+  cc = CC(0);
+  ss = SS(0);
+
+  /* Apply all the previously computed plane rotations to the new column
+     of the Hessenberg matrix */
+  for (j=1; j<=it; j++) {
+    tt  = *hh;
+    *hh = PetscConj(*cc) * tt + *ss * *(hh+1);
+    hh++;
+    *hh = *cc++ * *hh - (*ss++ * tt);
+  }
+
+  /*
+    compute the new plane rotation, and apply it to:
+     1) the right-hand-side of the Hessenberg system
+     2) the new column of the Hessenberg matrix
+    thus obtaining the updated value of the residual
+  */
+  if (!hapend) {
+    tt = PetscSqrtScalar(PetscConj(*hh) * *hh + PetscConj(*(hh+1)) * *(hh+1));
+    if (tt == 0.0) {
+      if (ksp->errorifnotconverged) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"tt == 0.0");
+      else {
+        ksp->reason = KSP_DIVERGED_NULL;
+        PetscFunctionReturn(0);
+      }
+    }
+    *cc        = *hh / tt;
+    *ss        = *(hh+1) / tt;
+    *GRS(it+1) = -(*ss * *GRS(it));
+    *GRS(it)   = PetscConj(*cc) * *GRS(it);
+    *hh        = PetscConj(*cc) * *hh + *ss * *(hh+1);
+    *res       = PetscAbsScalar(*GRS(it+1));
+  } else {
+    /* happy breakdown: HH(it+1, it) = 0, the residual is zero */
+    *res = 0.0;
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPBuildSolution_GCRODR(KSP ksp,Vec ptr,Vec *result)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!ptr) {
+    if (!gcrodr->sol_temp) {
+      ierr = VecDuplicate(ksp->vec_sol,&gcrodr->sol_temp);CHKERRQ(ierr);
+      ierr = PetscLogObjectParent((PetscObject)ksp,(PetscObject)gcrodr->sol_temp);CHKERRQ(ierr);
+    }
+    ptr = gcrodr->sol_temp;
+  }
+  if (!gcrodr->nrs) {
+    /* allocate the work area */
+    ierr = PetscMalloc1(gcrodr->max_k,&gcrodr->nrs);CHKERRQ(ierr);
+    ierr = PetscLogObjectMemory((PetscObject)ksp,gcrodr->max_k);CHKERRQ(ierr);
+  }
+
+  ierr = KSPGCRODRBuildSoln(gcrodr->nrs,ksp->vec_sol,ptr,ksp,gcrodr->it);CHKERRQ(ierr);
+  if (result) *result = ptr;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPView_GCRODR(KSP ksp,PetscViewer viewer)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscErrorCode ierr;
+  PetscBool      iascii;
+
+  PetscFunctionBegin;
+  ierr = KSPView_GMRES(ksp,viewer);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&iascii);CHKERRQ(ierr);
+  if (iascii) {
+    ierr = PetscViewerASCIIPrintf(viewer,"  recycled subspace of dimension %D, currently %D\n",gcrodr->recycle,gcrodr->nrecycled);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSetFromOptions_GCRODR(PetscOptionItems *PetscOptionsObject,KSP ksp)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       recycle;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  ierr = KSPSetFromOptions_GMRES(PetscOptionsObject,ksp);CHKERRQ(ierr);
+  ierr = PetscOptionsHead(PetscOptionsObject,"KSP GCRODR Options");CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-ksp_gcrodr_recycle","Dimension of the recycled subspace","KSPGCRODRSetRecycle",gcrodr->recycle,&recycle,&flg);CHKERRQ(ierr);
+  if (flg) {ierr = KSPGCRODRSetRecycle(ksp,recycle);CHKERRQ(ierr);}
+  ierr = PetscOptionsTail();CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPGCRODRSetRecycle_GCRODR(KSP ksp,PetscInt recycle)
+{
+  KSP_GCRODR     *gcrodr = (KSP_GCRODR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (recycle < 1) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_OUTOFRANGE,"The dimension of the recycled subspace must be positive");
+  if (recycle != gcrodr->recycle) {
+    if (ksp->setupstage) {ierr = KSPReset(ksp);CHKERRQ(ierr);}
+    gcrodr->recycle = recycle;
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPGCRODRGetRecycle_GCRODR(KSP ksp,PetscInt *recycle)
+{
+  PetscFunctionBegin;
+  *recycle = ((KSP_GCRODR*)ksp->data)->recycle;
+  PetscFunctionReturn(0);
+}
+
+/*@
+   KSPGCRODRSetRecycle - Sets the dimension of the subspace that GCRODR recycles between solves.
+
+   Logically Collective on ksp
+
+   Input Parameters:
++  ksp - the Krylov space context
+-  recycle - dimension of the recycled subspace
+
+   Options Database:
+.  -ksp_gcrodr_recycle <positive integer>
+
+   Notes:
+   The default value is 10, it must be smaller than the restart set with KSPGMRESSetRestart().
+   Changing the dimension discards the current recycled subspace.
+
+   Level: intermediate
+
+.seealso: KSPGCRODR, KSPGCRODRGetRecycle(), KSPGMRESSetRestart()
+@*/
+PetscErrorCode KSPGCRODRSetRecycle(KSP ksp,PetscInt recycle)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp,KSP_CLASSID,1);
+  PetscValidLogicalCollectiveInt(ksp,recycle,2);
+  ierr = PetscTryMethod(ksp,"KSPGCRODRSetRecycle_C",(KSP,PetscInt),(ksp,recycle));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@
+   KSPGCRODRGetRecycle - Gets the dimension of the subspace that GCRODR recycles between solves.
+
+   Not Collective
+
+   Input Parameter:
+.  ksp - the Krylov space context
+
+   Output Parameter:
+.  recycle - dimension of the recycled subspace
+
+   Level: intermediate
+
+.seealso: KSPGCRODR, KSPGCRODRSetRecycle()
+@*/
+PetscErrorCode KSPGCRODRGetRecycle(KSP ksp,PetscInt *recycle)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp,KSP_CLASSID,1);
+  PetscValidIntPointer(recycle,2);
+  ierr = PetscUseMethod(ksp,"KSPGCRODRGetRecycle_C",(KSP,PetscInt*),(ksp,recycle));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*MC
+     KSPGCRODR - Implements GCRO-DR, the restarted GMRES method with deflated restarting that recycles
+     a subspace between successive calls to KSPSolve() for a sequence of related linear systems.
+
+   Options Database Keys:
++   -ksp_gcrodr_recycle <k> - the dimension of the recycled subspace, default 10
+.   -ksp_gmres_restart <restart> - the number of Krylov directions to orthogonalize against
+.   -ksp_gmres_haptol <tol> - sets the tolerance for "happy ending" (exact convergence)
+.   -ksp_gmres_preallocate - preallocate all the Krylov search directions initially (otherwise groups of
+                             vectors are allocated as needed)
+.   -ksp_gmres_classicalgramschmidt - use classical (unmodified) Gram-Schmidt to orthogonalize against the Krylov space (fast) (the default)
+.   -ksp_gmres_modifiedgramschmidt - use modified Gram-Schmidt in the orthogonalization (more stable, but slower)
+.   -ksp_gmres_lowsyncgramschmidt - use classical Gram-Schmidt with a single blocking global reduction per iteration, see KSPGMRESLowSyncGramSchmidtOrthogonalization()
+-   -ksp_gmres_cgs_refinement_type <refine_never,refine_ifneeded,refine_always> - determine if iterative refinement is used to increase the
+                                   stability of the classical Gram-Schmidt  orthogonalization.
+
+   Level: intermediate
+
+   Notes:
+   The subspace U spanned by the harmonic Ritz vectors associated with the smallest harmonic Ritz values of the
+   (preconditioned) operator is kept in the KSP together with its image C. Every cycle, including the first one of
+   a new solve, starts by removing from the residual its component in the range of C, and the Krylov space is
+   built orthogonally to C. The recycled subspace is updated at the end of every cycle.
+
+   When the operator or the preconditioning matrix changed since the last solve (detected with PetscObjectStateGet()),
+   C is recomputed from U, which costs one application of the preconditioned operator per recycled vector. The
+   recycled subspace is discarded by KSPReset() and KSPGCRODRSetRecycle().
+
+   Only left and right preconditioning are supported.
+
+   Reference:
+   Parks, de Sturler, Mackey, Johnson, Maiti, Recycling Krylov subspaces for sequences of linear systems,
+   SIAM J. Sci. Comput. 28(5), 2006.
+
+   Developer Notes:
+    This object is subclassed off of KSPGMRES
+
+.seealso:  KSPCreate(), KSPSetType(), KSPType (for list of available types), KSP, KSPGMRES, KSPDGMRES, KSPLGMRES,
+           KSPGCRODRSetRecycle(), KSPGMRESSetRestart(), KSPGMRESSetHapTol(), KSPGMRESSetPreAllocateVectors(), KSPGMRESSetOrthogonalization()
+M*/
+
+PETSC_EXTERN PetscErrorCode KSPCreate_GCRODR(KSP ksp)
+{
+  KSP_GCRODR     *gcrodr;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscNewLog(ksp,&gcrodr);CHKERRQ(ierr);
+
+  ksp->data                              = (void*)gcrodr;
+  ksp->ops->buildsolution                = KSPBuildSolution_GCRODR;
+  ksp->ops->setup                        = KSPSetUp_GCRODR;
+  ksp->ops->solve                        = KSPSolve_GCRODR;
+  ksp->ops->reset                        = KSPReset_GCRODR;
+  ksp->ops->destroy                      = KSPDestroy_GCRODR;
+  ksp->ops->view                         = KSPView_GCRODR;
+  ksp->ops->setfromoptions               = KSPSetFromOptions_GCRODR;
+  ksp->ops->computeextremesingularvalues = KSPComputeExtremeSingularValues_GMRES;
+  ksp->ops->computeeigenvalues           = KSPComputeEigenvalues_GMRES;
+
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_PRECONDITIONED,PC_LEFT,3);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_UNPRECONDITIONED,PC_RIGHT,2);CHKERRQ(ierr);
+
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESSetPreAllocateVectors_C",KSPGMRESSetPreAllocateVectors_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESSetOrthogonalization_C",KSPGMRESSetOrthogonalization_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESGetOrthogonalization_C",KSPGMRESGetOrthogonalization_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESSetRestart_C",KSPGMRESSetRestart_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESGetRestart_C",KSPGMRESGetRestart_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESSetHapTol_C",KSPGMRESSetHapTol_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESSetCGSRefinementType_C",KSPGMRESSetCGSRefinementType_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGMRESGetCGSRefinementType_C",KSPGMRESGetCGSRefinementType_GMRES);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGCRODRSetRecycle_C",KSPGCRODRSetRecycle_GCRODR);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPGCRODRGetRecycle_C",KSPGCRODRGetRecycle_GCRODR);CHKERRQ(ierr);
+
+  gcrodr->haptol         = 1.0e-30;
+  gcrodr->q_preallocate  = 0;
+  gcrodr->delta_allocate = GCRODR_DELTA_DIRECTIONS;
+  gcrodr->orthog         = KSPGMRESClassicalGramSchmidtOrthogonalization;
+  gcrodr->nrs            = 0;
+  gcrodr->sol_temp       = 0;
+  gcrodr->max_k          = GCRODR_DEFAULT_MAXK;
+  gcrodr->Rsvd           = 0;
+  gcrodr->cgstype        = KSP_GMRES_CGS_REFINE_NEVER;
+  gcrodr->orthogwork     = 0;
+  gcrodr->recycle        = GCRODR_DEFAULT_RECYCLE;
+  PetscFunctionReturn(0);
+}
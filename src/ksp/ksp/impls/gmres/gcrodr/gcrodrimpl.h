@@ -0,0 +1,41 @@
+#if !defined(__GCRODR)
+#define __GCRODR
+
+#define KSPGMRES_NO_MACROS
+#include <../src/ksp/ksp/impls/gmres/gmresimpl.h>
+
+typedef struct {
+  KSPGMRESHEADER
+
+  /* recycled subspace, kept between calls to KSPSolve() */
+  PetscInt         recycle;       /* requested dimension of the recycled subspace */
+  PetscInt         nrecycled;     /* current dimension of the recycled subspace */
+  Vec              *U;            /* the recycled subspace, recycle+1 vectors */
+  Vec              *C;            /* C = Op U with orthonormal columns, recycle+1 vectors */
+  Vec              *Unew,*Cnew;   /* work space for the update of U and C at the end of a cycle */
+  PetscScalar      *B;            /* C^H Op V, (recycle+1) by max_k */
+  PetscScalar      *coef;         /* work space of length recycle+1 */
+  PetscObjectId    amatid,pmatid; /* operators for which C = Op U was computed */
+  PetscObjectState amatstate,pmatstate;
+  PCSide           pcside;
+} KSP_GCRODR;
+
+#define HH(a,b)  (gcrodr->hh_origin + (b)*(gcrodr->max_k+2)+(a))
+/* HH will be size (max_k+2)*(max_k+1)  -  think of HH as
+   being stored columnwise for access purposes. */
+#define HES(a,b) (gcrodr->hes_origin + (b)*(gcrodr->max_k+1)+(a))
+/* HES will be size (max_k + 1) * (max_k + 1) -
+   again, think of HES as being stored columnwise */
+#define CC(a)    (gcrodr->cc_origin + (a)) /* CC will be length (max_k+1) - cosines */
+#define SS(a)    (gcrodr->ss_origin + (a)) /* SS will be length (max_k+1) - sines */
+#define GRS(a)   (gcrodr->rs_origin + (a)) /* GRS will be length (max_k+2) - rt side */
+#define BB(a,b)  (gcrodr->B + (b)*(gcrodr->recycle+1)+(a))
+/* BB will be size (recycle+1)*max_k, stored columnwise */
+
+/* vector names */
+#define VEC_OFFSET     2
+#define VEC_TEMP       gcrodr->vecs[0]               /* work space */
+#define VEC_TEMP_MATOP gcrodr->vecs[1]               /* work space */
+#define VEC_VV(i)      gcrodr->vecs[VEC_OFFSET+i]    /* use to access
+                                                        othog basis vectors */
+#endif
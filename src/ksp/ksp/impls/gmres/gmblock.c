@@ -0,0 +1,226 @@
+/*
+    Block GMRES method for a block of right-hand sides, used by KSPMatSolve() with KSPGMRES.
+
+    Reference: B. Vital, Etude de quelques methodes de resolution de problemes lineaires de grande taille sur
+    multiprocesseur, 1990, and Y. Saad, Iterative methods for sparse linear systems, section 6.12.
+
+    Each step multiplies a block V_j of the orthonormal basis by the preconditioned operator at once, orthogonalizes
+    the product against the basis with two passes of block classical Gram-Schmidt and orthonormalizes it with the
+    Cholesky factor of its Gram matrix, so that a step needs three global reductions for the whole block. Columns
+    that become linearly dependent are deflated by the truncated Cholesky factorization instead of breaking down.
+    The block upper Hessenberg matrix is reduced to triangular form progressively with Householder reflectors, which
+    give the residual norm of every column at each step. The restart counts block steps.
+*/
+#include <../src/ksp/ksp/impls/gmres/gmresimpl.h>       /*I  "petscksp.h"  I*/
+
+/* V R = W with V orthonormal: stores R (order n, leading dimension ldr) and the largest column norm of W */
+static PetscErrorCode KSPGMRESBlockOrthonormalize(KSP ksp,Mat W,Mat V,PetscScalar *lbuf,PetscScalar *gbuf,PetscScalar *L,PetscScalar *T,PetscScalar *R,PetscInt ldr,PetscInt *rank,PetscReal *nrm)
+{
+  PetscErrorCode ierr;
+  PetscInt       n,i,k;
+  PetscBool      indef;
+
+  PetscFunctionBegin;
+  ierr = MatGetSize(W,NULL,&n);CHKERRQ(ierr);
+  ierr = KSPDenseTransposeMultLocal_Private(W,W,lbuf,n);CHKERRQ(ierr);
+  ierr = MPIU_Allreduce(lbuf,gbuf,n*n,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)ksp));CHKERRQ(ierr);
+  *nrm = 0.0;
+  for (i=0; i<n; i++) *nrm = PetscMax(*nrm,PetscAbsScalar(gbuf[i+i*n]));
+  *nrm = PetscSqrtReal(*nrm);
+  ierr = KSPDenseCholesky_Private(n,gbuf,L,T,rank,&indef);CHKERRQ(ierr);
+  ierr = KSPDenseMultAdd_Private(W,T,n,0.0,V);CHKERRQ(ierr);
+  for (k=0; k<n; k++) {
+    for (i=0; i<=k; i++) R[i+k*ldr] = PetscConj(L[k+i*n]);
+    for (i=k+1; i<n; i++) R[i+k*ldr] = 0.0;
+  }
+  PetscFunctionReturn(0);
+}
+
+/* computes the reflector I - tau v v^H, v = [1; x(1:len-1)], whose conjugate transpose maps x to a multiple of e_1 */
+static void KSPGMRESBlockReflector(PetscInt len,PetscScalar *x,PetscScalar *tau)
+{
+  PetscInt    k;
+  PetscReal   xnorm = 0.0,beta;
+  PetscScalar alpha = x[0],scale;
+
+  for (k=1; k<len; k++) xnorm += PetscRealPart(PetscConj(x[k])*x[k]);
+  if (xnorm == 0.0 && PetscImaginaryPart(alpha) == 0.0) {
+    *tau = 0.0;
+    return;
+  }
+  beta  = PetscSqrtReal(PetscRealPart(PetscConj(alpha)*alpha) + xnorm);
+  if (PetscRealPart(alpha) >= 0.0) beta = -beta;
+  *tau  = (beta - alpha)/beta;
+  scale = 1.0/(alpha - beta);
+  for (k=1; k<len; k++) x[k] *= scale;
+  x[0] = beta;
+}
+
+/* y <- (I - tau v v^H)^H y for the reflector stored in v(1:len-1) */
+static void KSPGMRESBlockApplyReflector(PetscInt len,const PetscScalar *v,PetscScalar tau,PetscScalar *y)
+{
+  PetscInt    k;
+  PetscScalar sum = y[0];
+
+  if (tau == (PetscScalar)0.0) return;
+  for (k=1; k<len; k++) sum += PetscConj(v[k])*y[k];
+  sum *= PetscConj(tau);
+  y[0] -= sum;
+  for (k=1; k<len; k++) y[k] -= sum*v[k];
+}
+
+PetscErrorCode KSPMatSolve_GMRES(KSP ksp,Mat B,Mat X)
+{
+  PetscErrorCode ierr;
+  KSP_GMRES      *gmres = (KSP_GMRES*)ksp->data;
+  Mat            Amat,*V,AV = NULL,Wt,W2,W;
+  MPI_Comm       comm;
+  PetscInt       m = gmres->max_k,n,n2,ldh,i,j,k,c,r,nb,nr,rank;
+  PetscScalar    *hh,*g,*tau,*lbuf,*gbuf,*L,*T,*hcol,s;
+  PetscReal      rnorm,res,dmax;
+  PetscBool      diagonalscale,right = (PetscBool)(ksp->pc_side == PC_RIGHT),guess_zero = ksp->guess_zero;
+
+  PetscFunctionBegin;
+  ierr = PCGetDiagonalScale(ksp->pc,&diagonalscale);CHKERRQ(ierr);
+  if (diagonalscale) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_SUP,"Krylov method %s does not support diagonal scaling",((PetscObject)ksp)->type_name);
+  if (ksp->pc_side == PC_SYMMETRIC) {
+    ierr = KSPMatSolve_Basic(ksp,B,X);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  comm = PetscObjectComm((PetscObject)ksp);
+  ierr = PCGetOperators(ksp->pc,&Amat,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(B,NULL,&n);CHKERRQ(ierr);
+  n2   = n*n;
+  ldh  = (m+1)*n;
+  ierr = PetscMalloc7(ldh*m*n,&hh,ldh*n,&g,m*n,&tau,(m+1)*n2,&lbuf,(m+1)*n2,&gbuf,n2,&L,n2,&T);CHKERRQ(ierr);
+  ierr = PetscCalloc1(m+1,&V);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&Wt);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&W2);CHKERRQ(ierr);
+  ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&V[0]);CHKERRQ(ierr);
+
+  ksp->its = 0;
+  while (!ksp->reason) {
+    /* residual of the block, preconditioned with left preconditioning */
+    ierr = MatCopy(B,Wt,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+    if (ksp->its || !ksp->guess_zero) {
+      ierr = KSPMatMatMult_Private(Amat,X,&AV);CHKERRQ(ierr);
+      ierr = MatAXPY(Wt,-1.0,AV,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+    }
+    if (right) W = Wt;
+    else {
+      ierr = PCMatApply(ksp->pc,Wt,W2);CHKERRQ(ierr);
+      W    = W2;
+    }
+    ierr = PetscArrayzero(g,ldh*n);CHKERRQ(ierr);
+    ierr = KSPGMRESBlockOrthonormalize(ksp,W,V[0],lbuf,gbuf,L,T,g,ldh,&rank,&rnorm);CHKERRQ(ierr);
+    ksp->rnorm = rnorm;
+    ierr = KSPLogResidualHistory(ksp,rnorm);CHKERRQ(ierr);
+    ierr = KSPMonitor(ksp,ksp->its,rnorm);CHKERRQ(ierr);
+    if (!ksp->its) {
+      /* the tolerances are relative to the initial residual of the block */
+      ksp->guess_zero = PETSC_TRUE;
+      ierr = (*ksp->converged)(ksp,0,rnorm,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+      ksp->guess_zero = guess_zero;
+    } else {
+      ierr = (*ksp->converged)(ksp,ksp->its,rnorm,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+    }
+    if (PetscIsInfOrNanReal(rnorm)) ksp->reason = KSP_DIVERGED_NANORINF;
+    if (ksp->reason) break;
+    if (ksp->its >= ksp->max_it) {
+      ksp->reason = KSP_DIVERGED_ITS;
+      break;
+    }
+
+    for (j=0; j<m; j++) {
+      ksp->its++;
+      if (right) {
+        ierr = PCMatApply(ksp->pc,V[j],Wt);CHKERRQ(ierr);
+        ierr = KSPMatMatMult_Private(Amat,Wt,&AV);CHKERRQ(ierr);
+        W    = AV;
+      } else {
+        ierr = KSPMatMatMult_Private(Amat,V[j],&AV);CHKERRQ(ierr);
+        ierr = PCMatApply(ksp->pc,AV,W2);CHKERRQ(ierr);
+        W    = W2;
+      }
+      /* block classical Gram-Schmidt with one reorthogonalization, one reduction per pass */
+      hcol = hh + j*n*ldh;
+      nr   = (j+1)*n;
+      for (c=0; c<n; c++) for (r=0; r<nr; r++) hcol[r+c*ldh] = 0.0;
+      for (k=0; k<2; k++) {
+        for (i=0; i<=j; i++) {ierr = KSPDenseTransposeMultLocal_Private(V[i],W,lbuf+i*n,nr);CHKERRQ(ierr);}
+        ierr = MPIU_Allreduce(lbuf,gbuf,nr*n,MPIU_SCALAR,MPIU_SUM,comm);CHKERRQ(ierr);
+        for (c=0; c<n; c++) {
+          for (r=0; r<nr; r++) {
+            hcol[r+c*ldh] += gbuf[r+c*nr];
+            gbuf[r+c*nr]   = -gbuf[r+c*nr];
+          }
+        }
+        for (i=0; i<=j; i++) {ierr = KSPDenseMultAdd_Private(V[i],gbuf+i*n,nr,1.0,W);CHKERRQ(ierr);}
+      }
+      if (!V[j+1]) {ierr = MatDuplicate(B,MAT_DO_NOT_COPY_VALUES,&V[j+1]);CHKERRQ(ierr);}
+      ierr = KSPGMRESBlockOrthonormalize(ksp,W,V[j+1],lbuf,gbuf,L,T,hcol+nr,ldh,&rank,&res);CHKERRQ(ierr);
+      if (rank < n) {ierr = PetscInfo2(ksp,"deflating %D of the %D new basis vectors\n",n-rank,n);CHKERRQ(ierr);}
+
+      /* apply the reflectors of the previous steps to the new block column, then reduce it to triangular form */
+      for (c=0; c<n; c++) {
+        for (i=0; i<j; i++) {
+          for (k=0; k<n; k++) {
+            r = i*n+k;
+            KSPGMRESBlockApplyReflector((i+2)*n-r,hh+r+r*ldh,tau[r],hcol+r+c*ldh);
+          }
+        }
+      }
+      for (k=0; k<n; k++) {
+        r = j*n+k;
+        KSPGMRESBlockReflector((j+2)*n-r,hcol+r+k*ldh,&tau[r]);
+        for (c=k+1; c<n; c++) KSPGMRESBlockApplyReflector((j+2)*n-r,hcol+r+k*ldh,tau[r],hcol+r+c*ldh);
+        for (c=0; c<n; c++) KSPGMRESBlockApplyReflector((j+2)*n-r,hcol+r+k*ldh,tau[r],g+r+c*ldh);
+      }
+      /* the residual norm of each column is the norm of the last block of its transformed right-hand side */
+      rnorm = 0.0;
+      for (c=0; c<n; c++) {
+        res = 0.0;
+        for (r=(j+1)*n; r<(j+2)*n; r++) res += PetscRealPart(PetscConj(g[r+c*ldh])*g[r+c*ldh]);
+        rnorm = PetscMax(rnorm,res);
+      }
+      rnorm      = PetscSqrtReal(rnorm);
+      ksp->rnorm = rnorm;
+      ierr = KSPLogResidualHistory(ksp,rnorm);CHKERRQ(ierr);
+      ierr = (*ksp->converged)(ksp,ksp->its,rnorm,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+      if (PetscIsInfOrNanReal(rnorm)) ksp->reason = KSP_DIVERGED_NANORINF;
+      /* at a restart the residual is monitored at the beginning of the next cycle */
+      if (ksp->reason || ksp->its >= ksp->max_it || (j < m-1 && rank)) {ierr = KSPMonitor(ksp,ksp->its,rnorm);CHKERRQ(ierr);}
+      if (ksp->reason || ksp->its >= ksp->max_it || !rank) break;
+    }
+    if (ksp->reason == KSP_DIVERGED_NANORINF) break;
+
+    /* solve the triangular system, the directions with a zero pivot do not contribute */
+    nb   = PetscMin(j+1,m)*n;
+    dmax = 0.0;
+    for (r=0; r<nb; r++) dmax = PetscMax(dmax,PetscAbsScalar(hh[r+r*ldh]));
+    for (c=0; c<n; c++) {
+      for (r=nb-1; r>=0; r--) {
+        s = g[r+c*ldh];
+        for (k=r+1; k<nb; k++) s -= hh[r+k*ldh]*g[k+c*ldh];
+        g[r+c*ldh] = PetscAbsScalar(hh[r+r*ldh]) > PETSC_MACHINE_EPSILON*dmax ? s/hh[r+r*ldh] : 0.0;
+      }
+    }
+    ierr = PetscLogFlops(1.0*n*nb*nb);CHKERRQ(ierr);
+    if (right) {
+      ierr = KSPDenseMultAdd_Private(V[0],g,ldh,0.0,Wt);CHKERRQ(ierr);
+      for (i=1; i<nb/n; i++) {ierr = KSPDenseMultAdd_Private(V[i],g+i*n,ldh,1.0,Wt);CHKERRQ(ierr);}
+      ierr = PCMatApply(ksp->pc,Wt,W2);CHKERRQ(ierr);
+      ierr = MatAXPY(X,1.0,W2,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+    } else {
+      for (i=0; i<nb/n; i++) {ierr = KSPDenseMultAdd_Private(V[i],g+i*n,ldh,1.0,X);CHKERRQ(ierr);}
+    }
+    if (!ksp->reason && ksp->its >= ksp->max_it) ksp->reason = KSP_DIVERGED_ITS;
+  }
+  for (i=0; i<=m; i++) {ierr = MatDestroy(&V[i]);CHKERRQ(ierr);}
+  ierr = PetscFree(V);CHKERRQ(ierr);
+  ierr = MatDestroy(&AV);CHKERRQ(ierr);
+  ierr = MatDestroy(&Wt);CHKERRQ(ierr);
+  ierr = MatDestroy(&W2);CHKERRQ(ierr);
+  ierr = PetscFree7(hh,g,tau,lbuf,gbuf,L,T);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
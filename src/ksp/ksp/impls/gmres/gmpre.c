@@ -14,6 +14,12 @@
     Options Database Key:
 .   -ksp_gmres_preallocate - Activates KSPGmresSetPreAllocateVectors()
 
+    Notes:
+    When the work vectors are standard sequential or MPI vectors the Krylov basis is stored in column major arrays,
+    one for each group of directions allocated together; with this option there is only one, so the orthogonalization
+    computes all the inner products with one matrix-vector product (BLAS gemv) and a single reduction, and the update
+    of the solution at restarts is also one gemv.
+
     Level: intermediate
 
 .seealso: KSPGMRESSetRestart(), KSPGMRESSetOrthogonalization(), KSPGMRESGetOrthogonalization()
@@ -29,17 +29,68 @@
  */
 
 #include <../src/ksp/ksp/impls/gmres/gmresimpl.h>       /*I  "petscksp.h"  I*/
+#include <petscblaslapack.h>
+#include <petscdm.h>
 #define GMRES_DELTA_DIRECTIONS 10
 #define GMRES_DEFAULT_MAXK     30
 static PetscErrorCode KSPGMRESUpdateHessenberg(KSP,PetscInt,PetscBool,PetscReal*);
 static PetscErrorCode KSPGMRESBuildSoln(PetscScalar*,Vec,Vec,KSP,PetscInt);
 
+/*
+   Creates the directions VEC_VV(first),...,VEC_VV(first+n-1) of the Krylov basis like the template vector. When it is
+   a standard sequential or MPI vector and the previous directions are stored in chunks, they share a single column
+   major array, a new chunk, so that the orthogonalization and the solution update are one BLAS-2 call per chunk, see
+   KSPGMRESBasisMDot() and KSPGMRESBasisMAXPY()
+*/
+static PetscErrorCode KSPGMRESCreateBasis_Private(KSP ksp,Vec tmpl,PetscInt first,PetscInt n,Vec V[])
+{
+  KSP_GMRES      *gmres = (KSP_GMRES*)ksp->data;
+  PetscErrorCode ierr;
+  Vec            lform;
+  DM             dm;
+  PetscInt       k,bs,nloc,N,c = gmres->vv_nchunks;
+  PetscBool      seq,mpi;
+  PetscScalar    *array;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)tmpl,VECSEQ,&seq);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)tmpl,VECMPI,&mpi);CHKERRQ(ierr);
+  if (mpi) {
+    ierr = VecGhostGetLocalForm(tmpl,&lform);CHKERRQ(ierr);
+    if (lform) mpi = PETSC_FALSE;
+    ierr = VecGhostRestoreLocalForm(tmpl,&lform);CHKERRQ(ierr);
+  }
+  if ((!seq && !mpi) || gmres->vv_first[c] != first) {
+    for (k=0; k<n; k++) {ierr = VecDuplicate(tmpl,&V[k]);CHKERRQ(ierr);}
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetBlockSize(tmpl,&bs);CHKERRQ(ierr);
+  ierr = VecGetLocalSize(tmpl,&nloc);CHKERRQ(ierr);
+  ierr = VecGetSize(tmpl,&N);CHKERRQ(ierr);
+  ierr = VecGetDM(tmpl,&dm);CHKERRQ(ierr);
+  ierr = PetscMalloc1(n*nloc,&array);CHKERRQ(ierr);
+  ierr = PetscLogObjectMemory((PetscObject)ksp,n*nloc*sizeof(PetscScalar));CHKERRQ(ierr);
+  for (k=0; k<n; k++) {
+    if (seq) {
+      ierr = VecCreateSeqWithArray(PetscObjectComm((PetscObject)tmpl),bs,nloc,array+k*nloc,&V[k]);CHKERRQ(ierr);
+    } else {
+      ierr = VecCreateMPIWithArray(PetscObjectComm((PetscObject)tmpl),bs,nloc,N,array+k*nloc,&V[k]);CHKERRQ(ierr);
+    }
+    if (dm) {ierr = VecSetDM(V[k],dm);CHKERRQ(ierr);}
+  }
+  gmres->vv_array[c]   = array;
+  gmres->vv_first[c+1] = first+n;
+  gmres->vv_nchunks++;
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode    KSPSetUp_GMRES(KSP ksp)
 {
   PetscInt       hh,hes,rs,cc;
   PetscErrorCode ierr;
   PetscInt       max_k,k;
   KSP_GMRES      *gmres = (KSP_GMRES*)ksp->data;
+  Vec            *work;
 
   PetscFunctionBegin;
   max_k = gmres->max_k;          /* restart size */
@@ -67,11 +118,19 @@ PetscErrorCode    KSPSetUp_GMRES(KSP ksp)
   ierr = PetscMalloc1(VEC_OFFSET+2+max_k,&gmres->user_work);CHKERRQ(ierr);
   ierr = PetscMalloc1(VEC_OFFSET+2+max_k,&gmres->mwork_alloc);CHKERRQ(ierr);
   ierr = PetscLogObjectMemory((PetscObject)ksp,(VEC_OFFSET+2+max_k)*(sizeof(Vec*)+sizeof(PetscInt)) + gmres->vecs_allocated*sizeof(Vec));CHKERRQ(ierr);
+  ierr = PetscMalloc2(max_k+3,&gmres->vv_first,max_k+2,&gmres->vv_array);CHKERRQ(ierr);
+  ierr = PetscLogObjectMemory((PetscObject)ksp,(max_k+3)*sizeof(PetscInt)+(max_k+2)*sizeof(PetscScalar*));CHKERRQ(ierr);
+  gmres->vv_nchunks  = 0;
+  gmres->vv_first[0] = 0;
 
   if (gmres->q_preallocate) {
     gmres->vv_allocated = VEC_OFFSET + 2 + max_k;
 
-    ierr = KSPCreateVecs(ksp,gmres->vv_allocated,&gmres->user_work[0],0,NULL);CHKERRQ(ierr);
+    ierr = KSPCreateVecs(ksp,VEC_OFFSET,&work,0,NULL);CHKERRQ(ierr);
+    ierr = PetscMalloc1(gmres->vv_allocated,&gmres->user_work[0]);CHKERRQ(ierr);
+    for (k=0; k<VEC_OFFSET; k++) gmres->user_work[0][k] = work[k];
+    ierr = PetscFree(work);CHKERRQ(ierr);
+    ierr = KSPGMRESCreateBasis_Private(ksp,gmres->user_work[0][0],0,max_k+2,gmres->user_work[0]+VEC_OFFSET);CHKERRQ(ierr);
     ierr = PetscLogObjectParents(ksp,gmres->vv_allocated,gmres->user_work[0]);CHKERRQ(ierr);
 
     gmres->mwork_alloc[0] = gmres->vv_allocated;
@@ -82,7 +141,11 @@ PetscErrorCode    KSPSetUp_GMRES(KSP ksp)
   } else {
     gmres->vv_allocated = 5;
 
-    ierr = KSPCreateVecs(ksp,5,&gmres->user_work[0],0,NULL);CHKERRQ(ierr);
+    ierr = KSPCreateVecs(ksp,VEC_OFFSET,&work,0,NULL);CHKERRQ(ierr);
+    ierr = PetscMalloc1(5,&gmres->user_work[0]);CHKERRQ(ierr);
+    for (k=0; k<VEC_OFFSET; k++) gmres->user_work[0][k] = work[k];
+    ierr = PetscFree(work);CHKERRQ(ierr);
+    ierr = KSPGMRESCreateBasis_Private(ksp,gmres->user_work[0][0],0,5-VEC_OFFSET,gmres->user_work[0]+VEC_OFFSET);CHKERRQ(ierr);
     ierr = PetscLogObjectParents(ksp,5,gmres->user_work[0]);CHKERRQ(ierr);
 
     gmres->mwork_alloc[0] = 5;
@@ -117,7 +180,7 @@ PetscErrorCode KSPGMRESCycle(PetscInt *itcount,KSP ksp)
   PetscReal      res_norm,res,hapbnd,tt;
   PetscErrorCode ierr;
   PetscInt       it     = 0, max_k = gmres->max_k;
-  PetscBool      hapend = PETSC_FALSE;
+  PetscBool      hapend = PETSC_FALSE,applied = PETSC_FALSE;
 
   PetscFunctionBegin;
   if (itcount) *itcount = 0;
@@ -149,14 +212,33 @@ PetscErrorCode KSPGMRESCycle(PetscInt *itcount,KSP ksp)
     if (gmres->vv_allocated <= it + VEC_OFFSET + 1) {
       ierr = KSPGMRESGetNewVectors(ksp,it+1);CHKERRQ(ierr);
     }
-    ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(it),VEC_VV(1+it),VEC_TEMP_MATOP);CHKERRQ(ierr);
+    if (!applied) {
+      ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(it),VEC_VV(1+it),VEC_TEMP_MATOP);CHKERRQ(ierr);
+    }
+    applied = PETSC_FALSE;
 
     /* update hessenberg matrix and do Gram-Schmidt */
     ierr = (*gmres->orthog)(ksp,it);CHKERRQ(ierr);
-    if (ksp->reason) break;
+    if (ksp->reason) {ierr = KSPGMRESLowSyncNormEnd_Private(ksp,NULL);CHKERRQ(ierr);break;}
 
     /* vv(i+1) . vv(i+1) */
-    ierr = VecNormalize(VEC_VV(it+1),&tt);CHKERRQ(ierr);
+    if (gmres->orthognorm) {
+      /* apply the operator of the next iteration to the unnormalized direction while its norm is being reduced */
+      if (it+1 < max_k && ksp->its+1 < ksp->max_it) {
+        if (gmres->vv_allocated <= it + VEC_OFFSET + 2) {
+          ierr = KSPGMRESGetNewVectors(ksp,it+2);CHKERRQ(ierr);
+        }
+        ierr    = KSP_PCApplyBAorAB(ksp,VEC_VV(it+1),VEC_VV(it+2),VEC_TEMP_MATOP);CHKERRQ(ierr);
+        applied = PETSC_TRUE;
+      }
+      ierr = KSPGMRESLowSyncNormEnd_Private(ksp,&tt);CHKERRQ(ierr);
+      if (tt != 0.0) {
+        ierr = VecScale(VEC_VV(it+1),1.0/tt);CHKERRQ(ierr);
+        if (applied) {ierr = VecScale(VEC_VV(it+2),1.0/tt);CHKERRQ(ierr);}
+      }
+    } else {
+      ierr = VecNormalize(VEC_VV(it+1),&tt);CHKERRQ(ierr);
+    }
     KSPCheckNorm(ksp,tt);
 
     /* save the magnitude */
@@ -270,6 +352,8 @@ PetscErrorCode KSPReset_GMRES(KSP ksp)
   PetscInt       i;
 
   PetscFunctionBegin;
+  /* a cycle stopped by an error may have left the reduction of the norm of the new direction pending */
+  ierr = KSPGMRESLowSyncNormEnd_Private(ksp,NULL);CHKERRQ(ierr);
   /* Free the Hessenberg matrices */
   ierr = PetscFree6(gmres->hh_origin,gmres->hes_origin,gmres->rs_origin,gmres->cc_origin,gmres->ss_origin,gmres->hes_ritz);CHKERRQ(ierr);
 
@@ -279,6 +363,11 @@ PetscErrorCode KSPReset_GMRES(KSP ksp)
     ierr = VecDestroyVecs(gmres->mwork_alloc[i],&gmres->user_work[i]);CHKERRQ(ierr);
   }
   gmres->nwork_alloc = 0;
+  for (i=0; i<gmres->vv_nchunks; i++) {
+    ierr = PetscFree(gmres->vv_array[i]);CHKERRQ(ierr);
+  }
+  gmres->vv_nchunks = 0;
+  ierr = PetscFree2(gmres->vv_first,gmres->vv_array);CHKERRQ(ierr);
   if (gmres->vecb)  {
     ierr = VecDestroyVecs(gmres->max_k+1,&gmres->vecb);CHKERRQ(ierr);
   }
@@ -369,7 +458,7 @@ static PetscErrorCode KSPGMRESBuildSoln(PetscScalar *nrs,Vec vs,Vec vdest,KSP ks
 
   /* Accumulate the correction to the solution of the preconditioned problem in TEMP */
   ierr = VecSet(VEC_TEMP,0.0);CHKERRQ(ierr);
-  ierr = VecMAXPY(VEC_TEMP,it+1,nrs,&VEC_VV(0));CHKERRQ(ierr);
+  ierr = KSPGMRESBasisMAXPY(ksp,VEC_TEMP,it+1,nrs);CHKERRQ(ierr);
 
   ierr = KSPUnwindPreconditioner(ksp,VEC_TEMP,VEC_TEMP_MATOP);CHKERRQ(ierr);
   /* add solution to previous solution */
@@ -455,7 +544,8 @@ PetscErrorCode KSPGMRESGetNewVectors(KSP ksp,PetscInt it)
 
   gmres->vv_allocated += nalloc;
 
-  ierr = KSPCreateVecs(ksp,nalloc,&gmres->user_work[nwork],0,NULL);CHKERRQ(ierr);
+  ierr = PetscMalloc1(nalloc,&gmres->user_work[nwork]);CHKERRQ(ierr);
+  ierr = KSPGMRESCreateBasis_Private(ksp,gmres->vecs[0],it,nalloc,gmres->user_work[nwork]);CHKERRQ(ierr);
   ierr = PetscLogObjectParents(ksp,nalloc,gmres->user_work[nwork]);CHKERRQ(ierr);
 
   gmres->mwork_alloc[nwork] = nalloc;
@@ -466,6 +556,95 @@ PetscErrorCode KSPGMRESGetNewVectors(KSP ksp,PetscInt it)
   PetscFunctionReturn(0);
 }
 
+/*
+   Computes val[j] = (x,VEC_VV(j)) for j < n, as VecMDot(x,n,&VEC_VV(0),val), with one GEMV per chunk of the basis
+   and one reduction when these directions are stored in chunks.
+ */
+PetscErrorCode KSPGMRESBasisMDot(KSP ksp,Vec x,PetscInt n,PetscScalar *val)
+{
+  KSP_GMRES         *gmres = (KSP_GMRES*)ksp->data;
+  PetscErrorCode    ierr;
+  const PetscScalar *xx;
+  PetscScalar       one = 1.0,zero = 0.0;
+  PetscInt          nloc,j,c;
+  PetscBLASInt      bm,bn,ld,ione = 1;
+
+  PetscFunctionBegin;
+  if (!gmres->vv_nchunks || gmres->vv_first[gmres->vv_nchunks] < n) {
+    ierr = VecMDot(x,n,&VEC_VV(0),val);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetLocalSize(x,&nloc);CHKERRQ(ierr);
+  if (nloc) {
+    ierr = PetscBLASIntCast(nloc,&bm);CHKERRQ(ierr);
+    ld   = bm;
+    ierr = VecGetArrayRead(x,&xx);CHKERRQ(ierr);
+    for (c=0; gmres->vv_first[c] < n; c++) {
+      ierr = PetscBLASIntCast(PetscMin(gmres->vv_first[c+1],n)-gmres->vv_first[c],&bn);CHKERRQ(ierr);
+#if defined(PETSC_USE_COMPLEX)
+      PetscStackCallBLAS("BLASgemv",BLASgemv_("C",&bm,&bn,&one,gmres->vv_array[c],&ld,xx,&ione,&zero,val+gmres->vv_first[c],&ione));
+#else
+      PetscStackCallBLAS("BLASgemv",BLASgemv_("T",&bm,&bn,&one,gmres->vv_array[c],&ld,xx,&ione,&zero,val+gmres->vv_first[c],&ione));
+#endif
+    }
+    ierr = VecRestoreArrayRead(x,&xx);CHKERRQ(ierr);
+    ierr = PetscLogFlops(n*(2.0*nloc-1));CHKERRQ(ierr);
+  } else {
+    for (j=0; j<n; j++) val[j] = 0.0;
+  }
+  ierr = MPIU_Allreduce(MPI_IN_PLACE,val,n,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)x));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Computes y = y + sum_j alpha[j] VEC_VV(j) for j < n, as VecMAXPY(y,n,alpha,&VEC_VV(0)), with one GEMV per chunk
+   of the basis when these directions are stored in chunks.
+ */
+PetscErrorCode KSPGMRESBasisMAXPY(KSP ksp,Vec y,PetscInt n,const PetscScalar *alpha)
+{
+  KSP_GMRES      *gmres = (KSP_GMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscScalar    *yy,one = 1.0;
+  PetscInt       nloc,c;
+  PetscBLASInt   bm,bn,ld,ione = 1;
+
+  PetscFunctionBegin;
+  if (!gmres->vv_nchunks || gmres->vv_first[gmres->vv_nchunks] < n) {
+    ierr = VecMAXPY(y,n,alpha,&VEC_VV(0));CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetLocalSize(y,&nloc);CHKERRQ(ierr);
+  if (!nloc || !n) PetscFunctionReturn(0);
+  ierr = PetscBLASIntCast(nloc,&bm);CHKERRQ(ierr);
+  ld   = bm;
+  ierr = VecGetArray(y,&yy);CHKERRQ(ierr);
+  for (c=0; gmres->vv_first[c] < n; c++) {
+    ierr = PetscBLASIntCast(PetscMin(gmres->vv_first[c+1],n)-gmres->vv_first[c],&bn);CHKERRQ(ierr);
+    PetscStackCallBLAS("BLASgemv",BLASgemv_("N",&bm,&bn,&one,gmres->vv_array[c],&ld,alpha+gmres->vv_first[c],&ione,&one,yy,&ione));
+  }
+  ierr = VecRestoreArray(y,&yy);CHKERRQ(ierr);
+  ierr = PetscLogFlops(n*2.0*nloc);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Gives the local array of VEC_VV(j) when this direction is stored in a chunk of the basis, NULL otherwise
+ */
+PetscErrorCode KSPGMRESBasisGetArray(KSP ksp,PetscInt j,PetscScalar **array)
+{
+  KSP_GMRES      *gmres = (KSP_GMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       c,nloc;
+
+  PetscFunctionBegin;
+  *array = NULL;
+  if (!gmres->vv_nchunks || gmres->vv_first[gmres->vv_nchunks] <= j) PetscFunctionReturn(0);
+  ierr = VecGetLocalSize(VEC_VV(j),&nloc);CHKERRQ(ierr);
+  for (c=0; gmres->vv_first[c+1] <= j; c++) ;
+  *array = gmres->vv_array[c] + (j-gmres->vv_first[c])*nloc;
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode KSPBuildSolution_GMRES(KSP ksp,Vec ptr,Vec *result)
 {
   KSP_GMRES      *gmres = (KSP_GMRES*)ksp->data;
@@ -516,6 +695,8 @@ PetscErrorCode KSPView_GMRES(KSP ksp,PetscViewer viewer)
     }
   } else if (gmres->orthog == KSPGMRESModifiedGramSchmidtOrthogonalization) {
     cstr = "Modified Gram-Schmidt Orthogonalization";
+  } else if (gmres->orthog == KSPGMRESLowSyncGramSchmidtOrthogonalization) {
+    cstr = "Classical (unmodified) Gram-Schmidt Orthogonalization with one blocking reduction per iteration";
   } else {
     cstr = "unknown orthogonalization";
   }
@@ -588,6 +769,8 @@ PetscErrorCode KSPSetFromOptions_GMRES(PetscOptionItems *PetscOptionsObject,KSP
   if (flg) {ierr = KSPGMRESSetPreAllocateVectors(ksp);CHKERRQ(ierr);}
   ierr = PetscOptionsBoolGroupBegin("-ksp_gmres_classicalgramschmidt","Classical (unmodified) Gram-Schmidt (fast)","KSPGMRESSetOrthogonalization",&flg);CHKERRQ(ierr);
   if (flg) {ierr = KSPGMRESSetOrthogonalization(ksp,KSPGMRESClassicalGramSchmidtOrthogonalization);CHKERRQ(ierr);}
+  ierr = PetscOptionsBoolGroup("-ksp_gmres_lowsyncgramschmidt","Classical Gram-Schmidt with one blocking reduction per iteration, the norm is overlapped with the next operator application","KSPGMRESSetOrthogonalization",&flg);CHKERRQ(ierr);
+  if (flg) {ierr = KSPGMRESSetOrthogonalization(ksp,KSPGMRESLowSyncGramSchmidtOrthogonalization);CHKERRQ(ierr);}
   ierr = PetscOptionsBoolGroupEnd("-ksp_gmres_modifiedgramschmidt","Modified Gram-Schmidt (slow,more stable)","KSPGMRESSetOrthogonalization",&flg);CHKERRQ(ierr);
   if (flg) {ierr = KSPGMRESSetOrthogonalization(ksp,KSPGMRESModifiedGramSchmidtOrthogonalization);CHKERRQ(ierr);}
   ierr = PetscOptionsEnum("-ksp_gmres_cgs_refinement_type","Type of iterative refinement for classical (unmodified) Gram-Schmidt","KSPGMRESSetCGSRefinementType",
@@ -839,6 +1022,7 @@ PetscErrorCode  KSPGMRESSetHapTol(KSP ksp,PetscReal tol)
                              vectors are allocated as needed)
 .   -ksp_gmres_classicalgramschmidt - use classical (unmodified) Gram-Schmidt to orthogonalize against the Krylov space (fast) (the default)
 .   -ksp_gmres_modifiedgramschmidt - use modified Gram-Schmidt in the orthogonalization (more stable, but slower)
+.   -ksp_gmres_lowsyncgramschmidt - use classical Gram-Schmidt with a single blocking global reduction per iteration, see KSPGMRESLowSyncGramSchmidtOrthogonalization()
 .   -ksp_gmres_cgs_refinement_type <refine_never,refine_ifneeded,refine_always> - determine if iterative refinement is used to increase the
                                    stability of the classical Gram-Schmidt  orthogonalization.
 -   -ksp_gmres_krylov_monitor - plot the Krylov space generated
@@ -848,6 +1032,10 @@ PetscErrorCode  KSPGMRESSetHapTol(KSP ksp,PetscReal tol)
    Notes:
     Left and right preconditioning are supported, but not symmetric preconditioning.
 
+    When the work vectors are standard sequential or MPI vectors, each group of Krylov directions allocated together
+    (all of them with -ksp_gmres_preallocate) is stored in one column major array. The orthogonalizations then compute
+    the inner products with one BLAS gemv per group and a single reduction, and the solution update is one gemv per group.
+
    References:
 .     1. - YOUCEF SAAD AND MARTIN H. SCHULTZ, GMRES: A GENERALIZED MINIMAL RESIDUAL ALGORITHM FOR SOLVING NONSYMMETRIC LINEAR SYSTEMS.
           SIAM J. ScI. STAT. COMPUT. Vo|. 7, No. 3, July 1986.
@@ -877,6 +1065,7 @@ PETSC_EXTERN PetscErrorCode KSPCreate_GMRES(KSP ksp)
   ksp->ops->buildsolution                = KSPBuildSolution_GMRES;
   ksp->ops->setup                        = KSPSetUp_GMRES;
   ksp->ops->solve                        = KSPSolve_GMRES;
+  ksp->ops->matsolve                     = KSPMatSolve_GMRES;
   ksp->ops->reset                        = KSPReset_GMRES;
   ksp->ops->destroy                      = KSPDestroy_GMRES;
   ksp->ops->view                         = KSPView_GMRES;
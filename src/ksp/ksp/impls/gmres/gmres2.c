@@ -16,17 +16,20 @@ $   it is one minus the number of GMRES iterations since last restart;
 $    i.e. the size of Krylov space minus one
 
    Notes:
-   Two orthogonalization routines are predefined, including
+   Three orthogonalization routines are predefined, including
 
    KSPGMRESModifiedGramSchmidtOrthogonalization()
 
    KSPGMRESClassicalGramSchmidtOrthogonalization() - Default. Use KSPGMRESSetCGSRefinementType() to determine if
      iterative refinement is used to increase stability.
 
+   KSPGMRESLowSyncGramSchmidtOrthogonalization() - a single blocking global reduction per iteration
+
 
    Options Database Keys:
 
 +  -ksp_gmres_classicalgramschmidt - Activates KSPGMRESClassicalGramSchmidtOrthogonalization() (default)
+.  -ksp_gmres_lowsyncgramschmidt - Activates KSPGMRESLowSyncGramSchmidtOrthogonalization()
 -  -ksp_gmres_modifiedgramschmidt - Activates KSPGMRESModifiedGramSchmidtOrthogonalization()
 
    Level: intermediate
@@ -61,17 +64,20 @@ $   it is one minus the number of GMRES iterations since last restart;
 $    i.e. the size of Krylov space minus one
 
    Notes:
-   Two orthogonalization routines are predefined, including
+   Three orthogonalization routines are predefined, including
 
    KSPGMRESModifiedGramSchmidtOrthogonalization()
 
    KSPGMRESClassicalGramSchmidtOrthogonalization() - Default. Use KSPGMRESSetCGSRefinementType() to determine if
      iterative refinement is used to increase stability.
 
+   KSPGMRESLowSyncGramSchmidtOrthogonalization() - a single blocking global reduction per iteration
+
 
    Options Database Keys:
 
 +  -ksp_gmres_classicalgramschmidt - Activates KSPGMRESClassicalGramSchmidtOrthogonalization() (default)
+.  -ksp_gmres_lowsyncgramschmidt - Activates KSPGMRESLowSyncGramSchmidtOrthogonalization()
 -  -ksp_gmres_modifiedgramschmidt - Activates KSPGMRESModifiedGramSchmidtOrthogonalization()
 
    Level: intermediate
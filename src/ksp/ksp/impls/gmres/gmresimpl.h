@@ -29,6 +29,9 @@
   PetscInt  nextra_vecs;                                  /* number of extra vecs needed, e.g. for a pipeline */ \
                                                                         \
   PetscErrorCode (*orthog)(KSP,PetscInt);                    \
+  PetscBool orthognorm;                                   /* orthog() started the reduction of the norm of the new direction, the cycle ends it with KSPGMRESLowSyncNormEnd_Private() */ \
+  MPI_Request orthogreq;                                  /* request of that reduction */ \
+  PetscReal   orthognrm[2];                               /* local and global squared norms of the new direction */ \
   KSPGMRESCGSRefinementType cgstype;                                    \
                                                                         \
   Vec      *vecs;                                        /* the work vectors */ \
@@ -41,6 +44,9 @@
   Vec      **user_work;                                              \
   PetscInt *mwork_alloc;       /* Number of work vectors allocated as part of  a work-vector chunck */ \
   PetscInt nwork_alloc;        /* Number of work vector chunks allocated */ \
+  PetscInt    vv_nchunks;      /* number of chunks of consecutive directions VEC_VV(vv_first[c]),...,VEC_VV(vv_first[c+1]-1) stored in one column major array */ \
+  PetscInt    *vv_first;       /* vv_first[c] is the first direction of chunk c, vv_first[vv_nchunks] the number of directions stored in chunks */ \
+  PetscScalar **vv_array;      /* vv_array[c] is the column major storage of chunk c */ \
                                                                         \
   /* Information for building solution */                               \
   PetscInt    it;              /* Current iteration: inside restart */  \
@@ -60,7 +66,12 @@ PETSC_INTERN PetscErrorCode KSPComputeEigenvalues_GMRES(KSP,PetscInt,PetscReal*,
 PETSC_INTERN PetscErrorCode KSPComputeRitz_GMRES(KSP,PetscBool,PetscBool,PetscInt*,Vec[],PetscReal*,PetscReal*);
 PETSC_INTERN PetscErrorCode KSPReset_GMRES(KSP);
 PETSC_INTERN PetscErrorCode KSPDestroy_GMRES(KSP);
+PETSC_INTERN PetscErrorCode KSPMatSolve_GMRES(KSP,Mat,Mat);
 PETSC_INTERN PetscErrorCode KSPGMRESGetNewVectors(KSP,PetscInt);
+PETSC_INTERN PetscErrorCode KSPGMRESBasisMDot(KSP,Vec,PetscInt,PetscScalar*);
+PETSC_INTERN PetscErrorCode KSPGMRESBasisMAXPY(KSP,Vec,PetscInt,const PetscScalar*);
+PETSC_INTERN PetscErrorCode KSPGMRESBasisGetArray(KSP,PetscInt,PetscScalar**);
+PETSC_INTERN PetscErrorCode KSPGMRESLowSyncNormEnd_Private(KSP,PetscReal*);
 
 typedef PetscErrorCode (*FCN)(KSP,PetscInt); /* force argument to next function to not be extern C*/
 
@@ -98,6 +98,7 @@ PetscErrorCode KSPLGMRESCycle(PetscInt *itcount,KSP ksp)
   PetscReal      hapbnd, tt;
   PetscScalar    tmp;
   PetscBool      hapend = PETSC_FALSE;  /* indicates happy breakdown ending */
+  PetscBool      applied = PETSC_FALSE; /* the operator was already applied to the next direction */
   PetscErrorCode ierr;
   PetscInt       loc_it;                /* local count of # of dir. in Krylov space */
   PetscInt       max_k  = lgmres->max_k; /* max approx space size */
@@ -178,7 +179,10 @@ PetscErrorCode KSPLGMRESCycle(PetscInt *itcount,KSP ksp)
 
     /*LGMRES_MOD: decide whether this is an arnoldi step or an aug step */
     if (loc_it < it_arnoldi) { /* Arnoldi */
-      ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(loc_it),VEC_VV(1+loc_it),VEC_TEMP_MATOP);CHKERRQ(ierr);
+      if (!applied) {
+        ierr = KSP_PCApplyBAorAB(ksp,VEC_VV(loc_it),VEC_VV(1+loc_it),VEC_TEMP_MATOP);CHKERRQ(ierr);
+      }
+      applied = PETSC_FALSE;
     } else { /*aug step */
       order = loc_it - it_arnoldi + 1; /* which aug step */
       for (ii=0; ii<aug_dim; ii++) {
@@ -198,7 +202,20 @@ PetscErrorCode KSPLGMRESCycle(PetscInt *itcount,KSP ksp)
     ierr = (*lgmres->orthog)(ksp,loc_it);CHKERRQ(ierr);
 
     /* new entry in hessenburg is the 2-norm of our new direction */
-    ierr = VecNorm(VEC_VV(loc_it+1),NORM_2,&tt);CHKERRQ(ierr);
+    if (lgmres->orthognorm) {
+      /* if the next step is an Arnoldi step apply the operator to the unnormalized direction while its norm is being reduced */
+      if (loc_it+1 < it_arnoldi && ksp->its+1 < max_it) {
+        if (lgmres->vv_allocated <= loc_it + VEC_OFFSET + 2) {
+          ierr = KSPLGMRESGetNewVectors(ksp,loc_it+2);CHKERRQ(ierr);
+        }
+        ierr    = KSP_PCApplyBAorAB(ksp,VEC_VV(loc_it+1),VEC_VV(loc_it+2),VEC_TEMP_MATOP);CHKERRQ(ierr);
+        applied = PETSC_TRUE;
+      }
+      ierr = KSPGMRESLowSyncNormEnd_Private(ksp,&tt);CHKERRQ(ierr);
+      if (applied && tt != 0.0) {ierr = VecScale(VEC_VV(loc_it+2),1.0/tt);CHKERRQ(ierr);}
+    } else {
+      ierr = VecNorm(VEC_VV(loc_it+1),NORM_2,&tt);CHKERRQ(ierr);
+    }
 
     *HH(loc_it+1,loc_it)  = tt;
     *HES(loc_it+1,loc_it) = tt;
@@ -736,6 +753,7 @@ static PetscErrorCode  KSPLGMRESSetAugDim_LGMRES(KSP ksp,PetscInt aug_dim)
                             vectors are allocated as needed)
 .   -ksp_gmres_classicalgramschmidt - use classical (unmodified) Gram-Schmidt to orthogonalize against the Krylov space (fast) (the default)
 .   -ksp_gmres_modifiedgramschmidt - use modified Gram-Schmidt in the orthogonalization (more stable, but slower)
+.   -ksp_gmres_lowsyncgramschmidt - use classical Gram-Schmidt with a single blocking global reduction per iteration, see KSPGMRESLowSyncGramSchmidtOrthogonalization()
 .   -ksp_gmres_cgs_refinement_type <refine_never,refine_ifneeded,refine_always> - determine if iterative refinement is used to increase the
                                   stability of the classical Gram-Schmidt  orthogonalization.
 .   -ksp_gmres_krylov_monitor - plot the Krylov space generated
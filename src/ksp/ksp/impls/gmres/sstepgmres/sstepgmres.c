@@ -0,0 +1,407 @@
+#include <petsc/private/kspimpl.h>
+
+/*
+   The s-step (communication avoiding) GMRES method. Each outer step applies the operator s times to the last
+   basis vector q_k, giving the monomial block W = [Op q_k, ..., Op^s q_k], and computes with one split-phase
+   reduction
+
+     C = Q^H W  and  G = W^H W
+
+   from which the block is orthogonalized against the basis Q = [q_0, ..., q_k] and within itself with the
+   Cholesky factorization G - C^H C = R^H R, i.e., W = Q C + Qn R. The s new columns of the Hessenberg matrix H
+   follow from Op [q_k, W_1, ..., W_{s-1}] = W, that is Op [Q Qn] X_s = [Q Qn] [C; R] with X_s = [e_k, [C; R]],
+   giving with the split of X_s in the rows of q_0, ..., q_{k-1} (X_o) and the remaining upper triangular rows (X_t)
+
+     H(:,k:k+s-1) = ([C; R] - H(:,0:k-1) X_o) X_t^{-1}
+*/
+typedef struct {
+  PetscInt    s;            /* number of basis vectors per outer step */
+  PetscInt    max_k;        /* restart */
+  Vec         *Q;           /* the orthonormal basis, max_k+1 vectors */
+  Vec         *W;           /* the monomial block of the outer step */
+  PetscScalar *H;           /* the Hessenberg matrix, max_k+1 by max_k */
+  PetscScalar *Hr;          /* the Hessenberg matrix reduced to upper triangular form by the plane rotations */
+  PetscScalar *C,*G,*X;     /* results of the reduction and the coordinates of [q_k W] in the new basis */
+  PetscScalar *cc,*ss,*grs; /* plane rotations and the right hand side of the least squares problem */
+  PetscScalar *coef;
+  PetscReal   *d;           /* squared norms of the vectors of the block */
+  PetscBool   matpowers;    /* build the block with the matrix powers kernel when it applies */
+  KSPMatPowers mp;
+} KSP_SSTEPGMRES;
+
+static PetscErrorCode KSPSetUp_SSTEPGMRES(KSP ksp)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       s = gm->s,ld = gm->max_k+1;
+
+  PetscFunctionBegin;
+  ierr = KSPSetWorkVecs(ksp,2);CHKERRQ(ierr);
+  ierr = KSPCreateVecs(ksp,ld,&gm->Q,s,&gm->W);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,ld,gm->Q);CHKERRQ(ierr);
+  ierr = PetscLogObjectParents(ksp,s,gm->W);CHKERRQ(ierr);
+  ierr = PetscCalloc7(ld*ld,&gm->H,ld*ld,&gm->Hr,ld*s,&gm->C,s*s,&gm->G,ld*(s+1),&gm->X,3*ld,&gm->cc,ld,&gm->coef);CHKERRQ(ierr);
+  ierr = PetscMalloc1(s,&gm->d);CHKERRQ(ierr);
+  gm->ss  = gm->cc+ld;
+  gm->grs = gm->ss+ld;
+  ierr = PetscLogObjectMemory((PetscObject)ksp,(2*ld*ld+ld*(2*s+1)+s*s+4*ld)*sizeof(PetscScalar)+s*sizeof(PetscReal));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Cholesky factorization R^H R of the leading block of the n x n matrix M (upper triangle referenced) whose
+   pivots are not negligible relative to d, the size of that block is returned in m
+*/
+static PetscErrorCode KSPSSTEPGMRESCholesky_Private(PetscInt n,PetscInt ldm,const PetscScalar *M,const PetscReal *d,PetscInt ldr,PetscScalar *R,PetscInt *m)
+{
+  PetscErrorCode ierr;
+  PetscInt       i,j,k;
+  PetscScalar    t;
+
+  PetscFunctionBegin;
+  for (k=0; k<n; k++) {
+    t = M[k+k*ldm];
+    for (i=0; i<k; i++) t -= PetscConj(R[i+k*ldr])*R[i+k*ldr];
+    if (PetscRealPart(t) <= PETSC_SQRT_MACHINE_EPSILON*d[k]) break;
+    R[k+k*ldr] = PetscSqrtReal(PetscRealPart(t));
+    for (j=k+1; j<n; j++) {
+      t = M[k+j*ldm];
+      for (i=0; i<k; i++) t -= PetscConj(R[i+k*ldr])*R[i+j*ldr];
+      R[k+j*ldr] = t/R[k+k*ldr];
+    }
+  }
+  *m   = k;
+  ierr = PetscLogFlops(k*k*k/3.0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Reduces the column c of the Hessenberg matrix with the previous plane rotations and a new one */
+static PetscErrorCode KSPSSTEPGMRESUpdateHessenberg_Private(KSP ksp,PetscInt c,PetscReal *res)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscInt       ld = gm->max_k+1,j;
+  PetscScalar    *hh = gm->Hr+c*ld,tt;
+
+  PetscFunctionBegin;
+  for (j=0; j<=c+1; j++) hh[j] = gm->H[j+c*ld];
+  for (j=0; j<c; j++) {
+    tt      = hh[j];
+    hh[j]   = PetscConj(gm->cc[j])*tt + gm->ss[j]*hh[j+1];
+    hh[j+1] = gm->cc[j]*hh[j+1] - gm->ss[j]*tt;
+  }
+  tt = PetscSqrtScalar(PetscConj(hh[c])*hh[c] + PetscConj(hh[c+1])*hh[c+1]);
+  if (tt == 0.0) {
+    if (ksp->errorifnotconverged) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"tt == 0.0");
+    ksp->reason = KSP_DIVERGED_NULL;
+    PetscFunctionReturn(0);
+  }
+  gm->cc[c]    = hh[c]/tt;
+  gm->ss[c]    = hh[c+1]/tt;
+  gm->grs[c+1] = -(gm->ss[c]*gm->grs[c]);
+  gm->grs[c]   = PetscConj(gm->cc[c])*gm->grs[c];
+  hh[c]        = PetscConj(gm->cc[c])*hh[c] + gm->ss[c]*hh[c+1];
+  hh[c+1]      = 0.0;
+  *res         = PetscAbsScalar(gm->grs[c+1]);
+  PetscFunctionReturn(0);
+}
+
+/* Adds to the solution the minimizer of the residual over the first n basis vectors */
+static PetscErrorCode KSPSSTEPGMRESBuildSoln_Private(KSP ksp,PetscInt n)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       ld = gm->max_k+1,i,j;
+  PetscScalar    *y = gm->coef;
+
+  PetscFunctionBegin;
+  if (!n) PetscFunctionReturn(0);
+  for (i=n-1; i>=0; i--) {
+    if (gm->Hr[i+i*ld] == 0.0) {
+      if (ksp->errorifnotconverged) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"Likely your matrix or preconditioner is singular. H(k,k) is identically zero; k = %D",i);
+      ksp->reason = KSP_DIVERGED_BREAKDOWN;
+      ierr = PetscInfo1(ksp,"Likely your matrix or preconditioner is singular. H(k,k) is identically zero; k = %D\n",i);CHKERRQ(ierr);
+      PetscFunctionReturn(0);
+    }
+    y[i] = gm->grs[i];
+    for (j=i+1; j<n; j++) y[i] -= gm->Hr[i+j*ld]*y[j];
+    y[i] /= gm->Hr[i+i*ld];
+  }
+  ierr = VecSet(ksp->work[0],0.0);CHKERRQ(ierr);
+  ierr = VecMAXPY(ksp->work[0],n,y,gm->Q);CHKERRQ(ierr);
+  ierr = KSPUnwindPreconditioner(ksp,ksp->work[0],ksp->work[1]);CHKERRQ(ierr);
+  ierr = VecAXPY(ksp->vec_sol,1.0,ksp->work[0]);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSSTEPGMRESCycle_Private(KSP ksp)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       ld = gm->max_k+1,k = 0,n,m,nc,i,j,l;
+  PetscScalar    *H = gm->H,*C = gm->C,*G = gm->G,*X = gm->X,*coef = gm->coef;
+  PetscReal      res;
+  MPI_Comm       comm = PetscObjectComm((PetscObject)ksp);
+
+  PetscFunctionBegin;
+  ierr = VecNormalize(gm->Q[0],&res);CHKERRQ(ierr);
+  KSPCheckNorm(ksp,res);
+  gm->grs[0] = res;
+  ierr       = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ksp->rnorm = res;
+  ierr       = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ierr       = KSPLogResidualHistory(ksp,res);CHKERRQ(ierr);
+  ierr       = KSPMonitor(ksp,ksp->its,res);CHKERRQ(ierr);
+  if (!res) {
+    ksp->reason = KSP_CONVERGED_ATOL;
+    ierr        = PetscInfo(ksp,"Converged due to zero residual norm on entry\n");CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = (*ksp->converged)(ksp,ksp->its,res,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+
+  while (!ksp->reason && k < gm->max_k && ksp->its < ksp->max_it) {
+    n = PetscMin(gm->s,PetscMin(gm->max_k-k,ksp->max_it-ksp->its));
+
+    /* the monomial block needs n applications of the operator but no reduction */
+    if (gm->mp) {
+      ierr = KSPMatPowersApply_Private(gm->mp,gm->Q[k],n,gm->W);CHKERRQ(ierr);
+    } else {
+      ierr = KSP_PCApplyBAorAB(ksp,gm->Q[k],gm->W[0],ksp->work[1]);CHKERRQ(ierr);
+      for (j=1; j<n; j++) {
+        ierr = KSP_PCApplyBAorAB(ksp,gm->W[j-1],gm->W[j],ksp->work[1]);CHKERRQ(ierr);
+      }
+    }
+
+    /* one reduction for C = Q^H W and the upper triangle of G = W^H W */
+    for (j=0; j<n; j++) {
+      ierr = VecMDotBegin(gm->W[j],k+1,gm->Q,C+j*ld);CHKERRQ(ierr);
+      ierr = VecMDotBegin(gm->W[j],j+1,gm->W,G+j*gm->s);CHKERRQ(ierr);
+    }
+    ierr = PetscCommSplitReductionBegin(comm);CHKERRQ(ierr);
+    for (j=0; j<n; j++) {
+      ierr = VecMDotEnd(gm->W[j],k+1,gm->Q,C+j*ld);CHKERRQ(ierr);
+      ierr = VecMDotEnd(gm->W[j],j+1,gm->W,G+j*gm->s);CHKERRQ(ierr);
+    }
+
+    /* R^H R = G - C^H C, stored in the rows k+1, ..., k+n of C; only the leading m columns of W are kept when
+       the block is numerically rank deficient, m = 0 is the happy breakdown */
+    for (j=0; j<n; j++) {
+      gm->d[j] = PetscRealPart(G[j+j*gm->s]);
+      for (i=0; i<=j; i++) {
+        for (l=0; l<=k; l++) G[i+j*gm->s] -= PetscConj(C[l+i*ld])*C[l+j*ld];
+      }
+    }
+    ierr = PetscLogFlops(4.0*(k+1)*n*(n+1)/2);CHKERRQ(ierr);
+    ierr = KSPSSTEPGMRESCholesky_Private(n,gm->s,G,gm->d,ld,C+k+1,&m);CHKERRQ(ierr);
+    if (m < n) {
+      ierr = PetscInfo3(ksp,"Using %D of the %D basis vectors of the outer step starting at %D\n",m,n,k);CHKERRQ(ierr);
+    }
+    nc = m ? m : 1;
+    for (j=0; j<nc; j++) {
+      for (i=m ? j+1 : 0; i<nc; i++) C[k+1+i+j*ld] = 0.0;
+    }
+
+    /* the new basis vectors Q_{k+1+j} = (W_j - Q C(:,j) - sum_{i<j} Q_{k+1+i} R(i,j))/R(j,j) */
+    for (j=0; j<m; j++) {
+      for (i=0; i<=k+j; i++) coef[i] = -C[i+j*ld];
+      ierr = VecCopy(gm->W[j],gm->Q[k+1+j]);CHKERRQ(ierr);
+      ierr = VecMAXPY(gm->Q[k+1+j],k+1+j,coef,gm->Q);CHKERRQ(ierr);
+      ierr = VecScale(gm->Q[k+1+j],1.0/C[k+1+j+j*ld]);CHKERRQ(ierr);
+    }
+
+    /* X = [e_k, C] on the rows 0, ..., k+nc and the columns k, ..., k+nc-1 of H */
+    for (j=0; j<=nc; j++) {
+      for (i=0; i<=k+nc; i++) X[i+j*ld] = j ? C[i+(j-1)*ld] : (i == k ? 1.0 : 0.0);
+    }
+    for (j=0; j<nc; j++) {
+      PetscScalar *h = H+(k+j)*ld;
+
+      for (i=0; i<=k+j+1; i++) {
+        h[i] = X[i+(j+1)*ld];
+        for (l=PetscMax(i-1,0); l<k; l++) h[i] -= H[i+l*ld]*X[l+j*ld];
+        for (l=0; l<j; l++) h[i] -= H[i+(k+l)*ld]*X[k+l+j*ld];
+        h[i] /= X[k+j+j*ld];
+      }
+      for (i=k+j+2; i<ld; i++) h[i] = 0.0;
+    }
+    ierr = PetscLogFlops(2.0*nc*(k+nc)*(k+nc));CHKERRQ(ierr);
+
+    /* the plane rotations give the residual norm of every new column */
+    for (j=0; j<nc; j++) {
+      ierr = KSPSSTEPGMRESUpdateHessenberg_Private(ksp,k,&res);CHKERRQ(ierr);
+      if (ksp->reason) break;
+      k++;
+      ierr       = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+      ksp->its++;
+      ksp->rnorm = res;
+      ierr       = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+      ierr       = (*ksp->converged)(ksp,ksp->its,res,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+      /* at a restart the residual norm is monitored at the start of the next cycle */
+      if (ksp->reason || k < gm->max_k || ksp->its >= ksp->max_it) {
+        ierr = KSPLogResidualHistory(ksp,res);CHKERRQ(ierr);
+        ierr = KSPMonitor(ksp,ksp->its,res);CHKERRQ(ierr);
+      }
+      if (ksp->reason) break;
+    }
+    if (!m && !ksp->reason) {
+      if (ksp->normtype == KSP_NORM_NONE) ksp->reason = KSP_CONVERGED_HAPPY_BREAKDOWN;
+      else {
+        if (ksp->errorifnotconverged) SETERRQ1(comm,PETSC_ERR_NOT_CONVERGED,"You reached the happy break down, but convergence was not indicated. Residual norm = %g",(double)res);
+        ksp->reason = KSP_DIVERGED_BREAKDOWN;
+      }
+    }
+  }
+  ierr = KSPSSTEPGMRESBuildSoln_Private(ksp,k);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSolve_SSTEPGMRES(KSP ksp)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscBool      guess_zero = ksp->guess_zero;
+
+  PetscFunctionBegin;
+  ierr        = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ksp->its    = 0;
+  ierr        = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+  ksp->reason = KSP_CONVERGED_ITERATING;
+  if (gm->matpowers) {ierr = KSPMatPowersSetUp_Private(ksp,gm->s,&gm->mp);CHKERRQ(ierr);}
+  while (!ksp->reason) {
+    ierr = KSPInitialResidual(ksp,ksp->vec_sol,ksp->work[0],ksp->work[1],gm->Q[0],ksp->vec_rhs);CHKERRQ(ierr);
+    ierr = KSPSSTEPGMRESCycle_Private(ksp);CHKERRQ(ierr);
+    if (!ksp->reason && ksp->its >= ksp->max_it) ksp->reason = KSP_DIVERGED_ITS;
+    ksp->guess_zero = PETSC_FALSE;
+  }
+  ksp->guess_zero = guess_zero;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPReset_SSTEPGMRES(KSP ksp)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = VecDestroyVecs(gm->max_k+1,&gm->Q);CHKERRQ(ierr);
+  ierr = VecDestroyVecs(gm->s,&gm->W);CHKERRQ(ierr);
+  ierr = PetscFree7(gm->H,gm->Hr,gm->C,gm->G,gm->X,gm->cc,gm->coef);CHKERRQ(ierr);
+  ierr = PetscFree(gm->d);CHKERRQ(ierr);
+  ierr = KSPMatPowersDestroy_Private(&gm->mp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPDestroy_SSTEPGMRES(KSP ksp)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = KSPReset_SSTEPGMRES(ksp);CHKERRQ(ierr);
+  ierr = KSPDestroyDefault(ksp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSetFromOptions_SSTEPGMRES(PetscOptionItems *PetscOptionsObject,KSP ksp)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscInt       s = gm->s,max_k = gm->max_k;
+
+  PetscFunctionBegin;
+  ierr = PetscOptionsHead(PetscOptionsObject,"KSP SSTEPGMRES options");CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-ksp_sstepgmres_s","Number of basis vectors per outer step","",s,&s,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-ksp_sstepgmres_restart","Number of basis vectors before a restart","",max_k,&max_k,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsBool("-ksp_sstepgmres_matrix_powers","Use the matrix powers kernel without preconditioner on MATMPIAIJ","",gm->matpowers,&gm->matpowers,NULL);CHKERRQ(ierr);
+  if (s < 1) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_OUTOFRANGE,"The number of basis vectors per outer step must be positive");
+  if (max_k < 1) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_OUTOFRANGE,"The restart must be positive");
+  if (s != gm->s || max_k != gm->max_k) {
+    ierr      = KSPReset_SSTEPGMRES(ksp);CHKERRQ(ierr);
+    gm->s     = s;
+    gm->max_k = max_k;
+    ksp->setupstage = KSP_SETUP_NEW;
+  }
+  ierr = PetscOptionsTail();CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPView_SSTEPGMRES(KSP ksp,PetscViewer viewer)
+{
+  KSP_SSTEPGMRES *gm = (KSP_SSTEPGMRES*)ksp->data;
+  PetscErrorCode ierr;
+  PetscBool      iascii,isstring;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&iascii);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERSTRING,&isstring);CHKERRQ(ierr);
+  if (iascii) {
+    ierr = PetscViewerASCIIPrintf(viewer,"  restart=%D, basis vectors per outer step: %D\n",gm->max_k,gm->s);CHKERRQ(ierr);
+    if (gm->mp) {ierr = PetscViewerASCIIPrintf(viewer,"  basis computed with the matrix powers kernel\n");CHKERRQ(ierr);}
+  } else if (isstring) {
+    ierr = PetscViewerStringSPrintf(viewer,"restart %D s %D",gm->max_k,gm->s);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/*MC
+    KSPSSTEPGMRES - The s-step (communication avoiding) GMRES method. Each outer step builds s basis vectors with
+    s applications of the (preconditioned) operator and orthogonalizes them with a single global reduction,
+    compared with at least s reductions for s iterations of KSPGMRES with classical Gram-Schmidt.
+
+    Options Database Keys:
++   -ksp_sstepgmres_s <s> - number of basis vectors per outer step (default 4)
+.   -ksp_sstepgmres_restart <restart> - number of basis vectors before a restart (default 30)
+.   -ksp_sstepgmres_matrix_powers <true,false> - use the matrix powers kernel when it applies (default true)
+-   see KSPSolve() for additional options
+
+    Level: advanced
+
+    Notes:
+    The basis vectors of an outer step are orthogonalized in a block with one pass of classical Gram-Schmidt against
+    the previous ones and a Cholesky QR factorization, and the Hessenberg matrix is recovered from the coefficients.
+    The convergence test and monitors are called for each basis vector, using the residual norm of the least squares
+    problem, so the iteration counts are comparable with those of KSPGMRES.
+
+    The monomial basis Op q, ..., Op^s q loses linear independence quickly with s, so s should remain small (up
+    to about 5), and the method keeps only the leading vectors of the block that are numerically independent.
+    This method is intended for latency bound problems, e.g. coarse problems solved on many processes, where the
+    cost of the reductions dominates.
+
+    With PCNONE and a MATMPIAIJ operator the block is computed by a matrix powers kernel: each process gathers once
+    the entries of q within graph distance s of its rows and then computes the s products locally on the rows of A
+    within that distance, instead of s products with one neighbor exchange each. With other preconditioners or
+    matrix types the block is computed with one application of the operator per vector.
+
+    Left and right preconditioning are supported.
+
+    References:
+.   1. - M. Hoemmen, "Communication-avoiding Krylov subspace methods", PhD thesis, UC Berkeley (2010).
+
+.seealso: KSPCreate(), KSPSetType(), KSPType (for list of available types), KSP, KSPGMRES, KSPPGMRES,
+          KSPPIPEFGMRES, KSPSSTEPCG, KSPGMRESSetOrthogonalization()
+M*/
+PETSC_EXTERN PetscErrorCode KSPCreate_SSTEPGMRES(KSP ksp)
+{
+  KSP_SSTEPGMRES *gm;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr      = PetscNewLog(ksp,&gm);CHKERRQ(ierr);
+  gm->s         = 4;
+  gm->max_k     = 30;
+  gm->matpowers = PETSC_TRUE;
+  ksp->data     = (void*)gm;
+
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_PRECONDITIONED,PC_LEFT,3);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_UNPRECONDITIONED,PC_RIGHT,2);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_NONE,PC_RIGHT,1);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_NONE,PC_LEFT,1);CHKERRQ(ierr);
+
+  ksp->ops->setup          = KSPSetUp_SSTEPGMRES;
+  ksp->ops->solve          = KSPSolve_SSTEPGMRES;
+  ksp->ops->reset          = KSPReset_SSTEPGMRES;
+  ksp->ops->destroy        = KSPDestroy_SSTEPGMRES;
+  ksp->ops->view           = KSPView_SSTEPGMRES;
+  ksp->ops->setfromoptions = KSPSetFromOptions_SSTEPGMRES;
+  ksp->ops->buildsolution  = KSPBuildSolutionDefault;
+  ksp->ops->buildresidual  = KSPBuildResidualDefault;
+  PetscFunctionReturn(0);
+}
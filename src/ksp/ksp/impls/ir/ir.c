@@ -0,0 +1,362 @@
+/*
+    This implements iterative refinement: the residual and the update of the solution are
+    computed in the working precision while the corrections come from an inner KSP that
+    works with single precision copies of the operators.
+*/
+#include <petsc/private/kspimpl.h>      /*I "petscksp.h" I*/
+#include <../src/mat/impls/aij/seq/aijmixed/aijmixed.h>
+
+typedef struct {
+  KSP              inner;            /* computes the corrections */
+  PetscBool        demote;           /* use single precision copies of the operators in the inner KSP */
+  Mat              Alow,Plow;        /* operators of the inner KSP */
+  PetscObjectId    amatid,pmatid;    /* operators from which Alow and Plow were obtained */
+  PetscObjectState amatstate,pmatstate,amatnzstate,pmatnzstate;
+} KSP_IR;
+
+/*
+   KSPIRDemote_Private - updates low, the operator of the inner KSP obtained from A
+
+   If A is SEQAIJ or MPIAIJ, low is a MATAIJMIXED copy of A that shares the row offsets and column indices of A and
+   only stores its values in single precision; it is created again only when the nonzero structure of A changes and
+   its values are refreshed in place when only the values of A change. Otherwise low is A.
+*/
+static PetscErrorCode KSPIRDemote_Private(Mat A,PetscBool demote,Mat *low,PetscObjectId *id,PetscObjectState *state,PetscObjectState *nzstate)
+{
+  PetscErrorCode   ierr;
+  PetscObjectId    aid;
+  PetscObjectState astate,anzstate;
+  PetscBool        isseq = PETSC_FALSE,ismpi = PETSC_FALSE;
+  MatReuse         reuse;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetId((PetscObject)A,&aid);CHKERRQ(ierr);
+  ierr = PetscObjectStateGet((PetscObject)A,&astate);CHKERRQ(ierr);
+  ierr = MatGetNonzeroState(A,&anzstate);CHKERRQ(ierr);
+  if (*low && aid == *id && astate == *state && anzstate == *nzstate) PetscFunctionReturn(0);
+#if !defined(PETSC_USE_COMPLEX)
+  if (demote) {
+    ierr = PetscObjectTypeCompare((PetscObject)A,MATSEQAIJ,&isseq);CHKERRQ(ierr);
+    ierr = PetscObjectTypeCompare((PetscObject)A,MATMPIAIJ,&ismpi);CHKERRQ(ierr);
+  }
+#endif
+  if (!isseq && !ismpi) {
+    if (demote) {
+      ierr = PetscInfo1(A,"Cannot demote a matrix of type %s, the inner solve uses it as is\n",((PetscObject)A)->type_name);CHKERRQ(ierr);
+    }
+    ierr = PetscObjectReference((PetscObject)A);CHKERRQ(ierr);
+    ierr = MatDestroy(low);CHKERRQ(ierr);
+    *low = A;
+  } else {
+    if (*low && *low != A && aid == *id && anzstate == *nzstate) reuse = MAT_REUSE_MATRIX;
+    else {
+      /* release the structure of the previous operator before the new copy borrows that of A */
+      ierr  = MatDestroy(low);CHKERRQ(ierr);
+      reuse = MAT_INITIAL_MATRIX;
+    }
+    if (isseq) {ierr = MatSeqAIJMixedDemote_Private(A,reuse,low);CHKERRQ(ierr);}
+    else {ierr = MatMPIAIJMixedDemote_Private(A,reuse,low);CHKERRQ(ierr);}
+  }
+  *id      = aid;
+  *state   = astate;
+  *nzstate = anzstate;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSetUp_IR(KSP ksp)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = KSPSetWorkVecs(ksp,2);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSolve_IR(KSP ksp)
+{
+  KSP_IR             *ir = (KSP_IR*)ksp->data;
+  PetscErrorCode     ierr;
+  PetscInt           i;
+  PetscReal          rnorm = 0.0;
+  Mat                Amat,Pmat;
+  Vec                x,b,r,d;
+  PetscBool          diagonalscale;
+  KSPConvergedReason reason;
+
+  PetscFunctionBegin;
+  ierr = PCGetDiagonalScale(ksp->pc,&diagonalscale);CHKERRQ(ierr);
+  if (diagonalscale) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_SUP,"Krylov method %s does not support diagonal scaling",((PetscObject)ksp)->type_name);
+
+  ierr = PCGetOperators(ksp->pc,&Amat,&Pmat);CHKERRQ(ierr);
+  ierr = KSPIRDemote_Private(Amat,ir->demote,&ir->Alow,&ir->amatid,&ir->amatstate,&ir->amatnzstate);CHKERRQ(ierr);
+  if (Pmat == Amat) {
+    ierr = PetscObjectReference((PetscObject)ir->Alow);CHKERRQ(ierr);
+    ierr = MatDestroy(&ir->Plow);CHKERRQ(ierr);
+    ir->Plow = ir->Alow;
+  } else {
+    if (ir->Plow == ir->Alow) {ierr = MatDestroy(&ir->Plow);CHKERRQ(ierr);}
+    ierr = KSPIRDemote_Private(Pmat,ir->demote,&ir->Plow,&ir->pmatid,&ir->pmatstate,&ir->pmatnzstate);CHKERRQ(ierr);
+  }
+  ierr = KSPSetOperators(ir->inner,ir->Alow,ir->Plow);CHKERRQ(ierr);
+
+  x = ksp->vec_sol;
+  b = ksp->vec_rhs;
+  r = ksp->work[0];
+  d = ksp->work[1];
+
+  if (!ksp->guess_zero) {
+    ierr = KSP_MatMult(ksp,Amat,x,r);CHKERRQ(ierr);            /*   r <- b - Ax   */
+    ierr = VecAYPX(r,-1.0,b);CHKERRQ(ierr);
+  } else {
+    ierr = VecCopy(b,r);CHKERRQ(ierr);
+  }
+
+  ksp->its = 0;
+  for (i=0; ; i++) {
+    if (ksp->normtype == KSP_NORM_UNPRECONDITIONED) {
+      ierr = VecNorm(r,NORM_2,&rnorm);CHKERRQ(ierr);
+      KSPCheckNorm(ksp,rnorm);
+    }
+    ierr       = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+    ksp->rnorm = rnorm;
+    ierr       = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+    ierr = KSPLogResidualHistory(ksp,rnorm);CHKERRQ(ierr);
+    ierr = KSPMonitor(ksp,i,rnorm);CHKERRQ(ierr);
+    ierr = (*ksp->converged)(ksp,i,rnorm,&ksp->reason,ksp->cnvP);CHKERRQ(ierr);
+    if (ksp->reason) break;
+    if (i >= ksp->max_it) {
+      ksp->reason = KSP_DIVERGED_ITS;
+      break;
+    }
+
+    ierr = KSPSolve(ir->inner,r,d);CHKERRQ(ierr);              /*   d <- A^{-1} r in low precision */
+    ierr = KSPGetConvergedReason(ir->inner,&reason);CHKERRQ(ierr);
+    if (reason == KSP_DIVERGED_PC_FAILED) {
+      ierr = PetscInfo(ksp,"Inner KSP failed because of a preconditioner failure\n");CHKERRQ(ierr);
+      ksp->reason = KSP_DIVERGED_PC_FAILED;
+      break;
+    }
+    ierr = VecAXPY(x,1.0,d);CHKERRQ(ierr);                     /*   x <- x + d    */
+    ierr = PetscObjectSAWsTakeAccess((PetscObject)ksp);CHKERRQ(ierr);
+    ksp->its++;
+    ierr = PetscObjectSAWsGrantAccess((PetscObject)ksp);CHKERRQ(ierr);
+
+    ierr = KSP_MatMult(ksp,Amat,x,r);CHKERRQ(ierr);            /*   r <- b - Ax   */
+    ierr = VecAYPX(r,-1.0,b);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPReset_IR(KSP ksp)
+{
+  KSP_IR         *ir = (KSP_IR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatDestroy(&ir->Alow);CHKERRQ(ierr);
+  ierr = MatDestroy(&ir->Plow);CHKERRQ(ierr);
+  ierr = KSPReset(ir->inner);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPDestroy_IR(KSP ksp)
+{
+  KSP_IR         *ir = (KSP_IR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = KSPReset_IR(ksp);CHKERRQ(ierr);
+  ierr = KSPDestroy(&ir->inner);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPIRGetInnerKSP_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPIRSetDemote_C",NULL);CHKERRQ(ierr);
+  ierr = KSPDestroyDefault(ksp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPView_IR(KSP ksp,PetscViewer viewer)
+{
+  KSP_IR         *ir = (KSP_IR*)ksp->data;
+  PetscErrorCode ierr;
+  PetscBool      iascii,islow = PETSC_FALSE;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&iascii);CHKERRQ(ierr);
+  if (iascii) {
+    if (ir->Alow) {
+      ierr = PetscObjectTypeCompareAny((PetscObject)ir->Alow,&islow,MATSEQAIJMIXED,MATMPIAIJMIXED,"");CHKERRQ(ierr);
+    }
+    if (islow) {
+      ierr = PetscViewerASCIIPrintf(viewer,"  inner solve with single precision copies of the operators\n");CHKERRQ(ierr);
+    } else if (ir->Alow) {
+      ierr = PetscViewerASCIIPrintf(viewer,"  inner solve with the operators in the working precision\n");CHKERRQ(ierr);
+    } else {
+      ierr = PetscViewerASCIIPrintf(viewer,"  demote the operators of the inner solve: %s\n",PetscBools[ir->demote]);CHKERRQ(ierr);
+    }
+    ierr = PetscViewerASCIIPrintf(viewer,"Inner KSP solver details\n");CHKERRQ(ierr);
+  }
+  ierr = PetscViewerASCIIPushTab(viewer);CHKERRQ(ierr);
+  ierr = KSPView(ir->inner,viewer);CHKERRQ(ierr);
+  ierr = PetscViewerASCIIPopTab(viewer);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPSetFromOptions_IR(PetscOptionItems *PetscOptionsObject,KSP ksp)
+{
+  KSP_IR         *ir = (KSP_IR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  /* set the options prefix of the inner KSP, since the parent prefix will be valid at this point */
+  ierr = KSPSetOptionsPrefix(ir->inner,((PetscObject)ksp)->prefix);CHKERRQ(ierr);
+  ierr = KSPAppendOptionsPrefix(ir->inner,"ir_");CHKERRQ(ierr);
+  ierr = PetscOptionsHead(PetscOptionsObject,"KSP IR options");CHKERRQ(ierr);
+  ierr = PetscOptionsBool("-ksp_ir_demote","Use single precision copies of the operators in the inner solve","KSPIRSetDemote",ir->demote,&ir->demote,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsTail();CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ir->inner);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPIRGetInnerKSP_IR(KSP ksp,KSP *inner)
+{
+  KSP_IR *ir = (KSP_IR*)ksp->data;
+
+  PetscFunctionBegin;
+  *inner = ir->inner;
+  PetscFunctionReturn(0);
+}
+
+/*@
+   KSPIRGetInnerKSP - Gets the KSP that computes the corrections in iterative refinement
+
+   Not Collective
+
+   Input Parameter:
+.  ksp - the KSP of type KSPIR
+
+   Output Parameter:
+.  inner - the inner KSP
+
+   Options Database Keys:
+.  -ir_ - the options prefix of the inner KSP, for example -ir_ksp_type gmres -ir_pc_type ilu
+
+   Level: intermediate
+
+.seealso: KSPIR, KSPIRSetDemote()
+@*/
+PetscErrorCode KSPIRGetInnerKSP(KSP ksp,KSP *inner)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp,KSP_CLASSID,1);
+  PetscValidPointer(inner,2);
+  ierr = PetscUseMethod(ksp,"KSPIRGetInnerKSP_C",(KSP,KSP*),(ksp,inner));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode KSPIRSetDemote_IR(KSP ksp,PetscBool demote)
+{
+  KSP_IR         *ir = (KSP_IR*)ksp->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (demote != ir->demote) {
+    ierr = MatDestroy(&ir->Alow);CHKERRQ(ierr);
+    ierr = MatDestroy(&ir->Plow);CHKERRQ(ierr);
+  }
+  ir->demote = demote;
+  PetscFunctionReturn(0);
+}
+
+/*@
+   KSPIRSetDemote - Sets whether the inner KSP of iterative refinement works with single precision copies of the operators
+
+   Logically Collective on ksp
+
+   Input Parameters:
++  ksp - the KSP of type KSPIR
+-  demote - PETSC_TRUE to use single precision copies of SEQAIJ and MPIAIJ operators
+
+   Options Database Keys:
+.  -ksp_ir_demote <true,false> - demote the operators
+
+   Level: intermediate
+
+   Notes:
+   The default is PETSC_TRUE. The copies are of type MATAIJMIXED; they are not available with complex scalars,
+   in which case, as for operators of other types, the inner KSP uses the operators of the outer KSP.
+
+.seealso: KSPIR, KSPIRGetInnerKSP(), MATAIJMIXED
+@*/
+PetscErrorCode KSPIRSetDemote(KSP ksp,PetscBool demote)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp,KSP_CLASSID,1);
+  PetscValidLogicalCollectiveBool(ksp,demote,2);
+  ierr = PetscTryMethod(ksp,"KSPIRSetDemote_C",(KSP,PetscBool),(ksp,demote));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*MC
+     KSPIR - Iterative refinement: the residual is computed and the solution is updated in the working precision,
+             while the corrections are computed by an inner KSP working with single precision copies of the operators
+
+   Options Database Keys:
++   -ksp_ir_demote <true,false> - use single precision copies of SEQAIJ and MPIAIJ operators in the inner KSP
+-   -ir_ - the options prefix of the inner KSP, for example -ir_ksp_type gmres -ir_ksp_rtol 1e-4 -ir_pc_type ilu
+
+   Level: intermediate
+
+   Notes:
+   The copies of the operators are of type MATAIJMIXED. They share the row offsets and column indices of the operators
+   of the outer KSP and only store the values in single precision, which adds 4 bytes per nonzero to the memory, and
+   the matrix-vector products and the Jacobi, SOR and ILU preconditioners of the inner KSP move about 8 instead of 12
+   bytes per nonzero with 32 bit PetscInt. Their values are refreshed in place when the values of the operators of the
+   outer KSP change. PCGAMG in the inner KSP only uses the copy on the finest level: its coarse grid operators are
+   computed in the working precision and are MATAIJ matrices.
+
+   Each iteration of KSPIR is one inner solve; the inner KSP only needs to reduce the residual by a few orders of magnitude,
+   its default relative tolerance is 1e-4. The outer KSP supports only the unpreconditioned norm and its preconditioner is not used,
+   use -ir_pc_type to set the preconditioner of the inner KSP.
+
+.seealso:  KSPCreate(), KSPSetType(), KSPType (for list of available types), KSP, KSPRICHARDSON, KSPIRGetInnerKSP(), KSPIRSetDemote(), MATAIJMIXED
+M*/
+
+PETSC_EXTERN PetscErrorCode KSPCreate_IR(KSP ksp)
+{
+  PetscErrorCode ierr;
+  KSP_IR         *ir;
+  PC             pc;
+
+  PetscFunctionBegin;
+  ierr = PetscNewLog(ksp,&ir);CHKERRQ(ierr);
+  ir->demote = PETSC_TRUE;
+
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_UNPRECONDITIONED,PC_LEFT,2);CHKERRQ(ierr);
+  ierr = KSPSetSupportedNorm(ksp,KSP_NORM_NONE,PC_LEFT,1);CHKERRQ(ierr);
+
+  ksp->data                = (void*)ir;
+  ksp->ops->setup          = KSPSetUp_IR;
+  ksp->ops->solve          = KSPSolve_IR;
+  ksp->ops->reset          = KSPReset_IR;
+  ksp->ops->destroy        = KSPDestroy_IR;
+  ksp->ops->view           = KSPView_IR;
+  ksp->ops->setfromoptions = KSPSetFromOptions_IR;
+  ksp->ops->buildsolution  = KSPBuildSolutionDefault;
+  ksp->ops->buildresidual  = KSPBuildResidualDefault;
+  ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
+  ierr = PCSetType(pc,PCNONE);CHKERRQ(ierr);
+
+  /* create the inner KSP */
+  ierr = KSPCreate(PetscObjectComm((PetscObject)ksp),&ir->inner);CHKERRQ(ierr);
+  ierr = PetscObjectIncrementTabLevel((PetscObject)ir->inner,(PetscObject)ksp,1);CHKERRQ(ierr);
+  ierr = KSPSetType(ir->inner,KSPGMRES);CHKERRQ(ierr);
+  ierr = KSPSetTolerances(ir->inner,1.e-4,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT);CHKERRQ(ierr);
+  ierr = PetscLogObjectParent((PetscObject)ksp,(PetscObject)ir->inner);CHKERRQ(ierr);
+
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPIRGetInnerKSP_C",KSPIRGetInnerKSP_IR);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)ksp,"KSPIRSetDemote_C",KSPIRSetDemote_IR);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
@@ -39,6 +39,29 @@ static PetscErrorCode  KSPSolve_PREONLY(KSP ksp)
   PetscFunctionReturn(0);
 }
 
+static PetscErrorCode KSPMatSolve_PREONLY(KSP ksp,Mat B,Mat X)
+{
+  PetscErrorCode ierr;
+  PetscBool      diagonalscale;
+  PCFailedReason pcreason;
+
+  PetscFunctionBegin;
+  ierr = PCGetDiagonalScale(ksp->pc,&diagonalscale);CHKERRQ(ierr);
+  if (diagonalscale) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_SUP,"Krylov method %s does not support diagonal scaling",((PetscObject)ksp)->type_name);
+  if (!ksp->guess_zero) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_USER,"Running KSP of preonly doesn't make sense with nonzero initial guess\n\
+               you probably want a KSP type of Richardson");
+  ksp->its = 0;
+  ierr     = PCMatApply(ksp->pc,B,X);CHKERRQ(ierr);
+  ierr     = PCGetFailedReason(ksp->pc,&pcreason);CHKERRQ(ierr);
+  if (pcreason) {
+    ksp->reason = KSP_DIVERGED_PC_FAILED;
+  } else {
+    ksp->its    = 1;
+    ksp->reason = KSP_CONVERGED_ITS;
+  }
+  PetscFunctionReturn(0);
+}
+
 /*MC
      KSPPREONLY - This implements a method that applies ONLY the preconditioner exactly once.
                   This may be used in inner iterations, where it is desired to
@@ -80,6 +103,7 @@ PETSC_EXTERN PetscErrorCode KSPCreate_PREONLY(KSP ksp)
   ksp->data                = NULL;
   ksp->ops->setup          = KSPSetUp_PREONLY;
   ksp->ops->solve          = KSPSolve_PREONLY;
+  ksp->ops->matsolve       = KSPMatSolve_PREONLY;
   ksp->ops->destroy        = KSPDestroyDefault;
   ksp->ops->buildsolution  = KSPBuildSolutionDefault;
   ksp->ops->buildresidual  = KSPBuildResidualDefault;
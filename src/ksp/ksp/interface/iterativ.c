@@ -6,7 +6,11 @@
    files)
  */
 #include <petsc/private/kspimpl.h>   /*I "petscksp.h" I*/
+#include <petsc/private/pcimpl.h>
+#include <petsc/private/matimpl.h>
+#include <petsc/private/dmimpl.h>
 #include <petscdmshell.h>
+#include <petscblaslapack.h>
 
 /*@
    KSPGetResidualNorm - Gets the last (approximate preconditioned)
@@ -1062,7 +1066,6 @@ PetscErrorCode  KSPGetConvergedReason(KSP ksp,KSPConvergedReason *reason)
   PetscFunctionReturn(0);
 }
 
-#include <petsc/private/dmimpl.h>
 /*@
    KSPSetDM - Sets the DM that may be used by some preconditioners
 
@@ -1223,8 +1226,6 @@ PetscErrorCode  KSPGetApplicationContext(KSP ksp,void *usrP)
   PetscFunctionReturn(0);
 }
 
-#include <petsc/private/pcimpl.h>
-
 /*@
    KSPCheckSolve - Checks if the PCSetUp() or KSPSolve() failed and set the error flag for the outer PC. A KSP_DIVERGED_ITS is
          not considered a failure in this context
@@ -1264,3 +1265,196 @@ PetscErrorCode KSPCheckSolve(KSP ksp,PC pc,Vec vec)
   PetscFunctionReturn(0);
 }
  
+
+/*
+   KSPMatMatMult_Private - Computes Y = A X for a dense block of vectors X, with MatMatMult() when it supports the
+   types of A and X and one column at a time with MatMult() otherwise. Y is created on the first call and must be
+   passed back unchanged for products with blocks of the same type and sizes.
+*/
+PetscErrorCode KSPMatMatMult_Private(Mat A,Mat X,Mat *Y)
+{
+  PetscErrorCode ierr;
+  PetscErrorCode (*mult)(Mat,Mat,MatReuse,PetscReal,Mat*) = NULL;
+  char           multname[256];
+  PetscInt       N,i,ldx,ldy;
+  PetscScalar    *xa,*ya;
+  Vec            x,y;
+
+  PetscFunctionBegin;
+  if (A->ops->matmult && A->ops->matmult == X->ops->matmult) mult = A->ops->matmult;
+  else {
+    ierr = PetscStrncpy(multname,"MatMatMult_",sizeof(multname));CHKERRQ(ierr);
+    ierr = PetscStrlcat(multname,((PetscObject)A)->type_name,sizeof(multname));CHKERRQ(ierr);
+    ierr = PetscStrlcat(multname,"_",sizeof(multname));CHKERRQ(ierr);
+    ierr = PetscStrlcat(multname,((PetscObject)X)->type_name,sizeof(multname));CHKERRQ(ierr);
+    ierr = PetscStrlcat(multname,"_C",sizeof(multname));CHKERRQ(ierr);
+    ierr = PetscObjectQueryFunction((PetscObject)X,multname,&mult);CHKERRQ(ierr);
+    if (!mult) {ierr = PetscObjectQueryFunction((PetscObject)A,multname,&mult);CHKERRQ(ierr);}
+  }
+  if (mult) {
+    ierr = MatMatMult(A,X,*Y ? MAT_REUSE_MATRIX : MAT_INITIAL_MATRIX,PETSC_DEFAULT,Y);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  if (!*Y) {ierr = MatDuplicate(X,MAT_DO_NOT_COPY_VALUES,Y);CHKERRQ(ierr);}
+  ierr = MatGetSize(X,NULL,&N);CHKERRQ(ierr);
+  ierr = MatCreateVecs(A,&x,&y);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(*Y,&ldy);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(*Y,&ya);CHKERRQ(ierr);
+  for (i=0; i<N; i++) {
+    ierr = VecPlaceArray(x,xa+i*ldx);CHKERRQ(ierr);
+    ierr = VecPlaceArray(y,ya+i*ldy);CHKERRQ(ierr);
+    ierr = MatMult(A,x,y);CHKERRQ(ierr);
+    ierr = VecResetArray(x);CHKERRQ(ierr);
+    ierr = VecResetArray(y);CHKERRQ(ierr);
+  }
+  ierr = MatDenseRestoreArray(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(*Y,&ya);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   KSPDenseTransposeMultLocal_Private - Computes the contribution of the local rows to C = X^H Y, stored with
+   leading dimension ldc
+*/
+PetscErrorCode KSPDenseTransposeMultLocal_Private(Mat X,Mat Y,PetscScalar *c,PetscInt ldc)
+{
+  PetscErrorCode    ierr;
+  const PetscScalar *xa,*ya;
+  PetscScalar       one = 1.0,zero = 0.0;
+  PetscInt          m,nx,ny,ldx,ldy;
+  PetscBLASInt      bm,bnx,bny,bldx,bldy,bldc;
+
+  PetscFunctionBegin;
+  ierr = MatGetLocalSize(X,&m,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(X,NULL,&nx);CHKERRQ(ierr);
+  ierr = MatGetSize(Y,NULL,&ny);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Y,&ldy);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(m,&bm);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(nx,&bnx);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(ny,&bny);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(PetscMax(ldx,1),&bldx);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(PetscMax(ldy,1),&bldy);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(ldc,&bldc);CHKERRQ(ierr);
+  if (!m) {
+    PetscInt i,j;
+
+    for (j=0; j<ny; j++) for (i=0; i<nx; i++) c[i+j*ldc] = 0.0;
+    PetscFunctionReturn(0);
+  }
+  ierr = MatDenseGetArrayRead(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(Y,&ya);CHKERRQ(ierr);
+  PetscStackCallBLAS("BLASgemm",BLASgemm_("C","N",&bnx,&bny,&bm,&one,xa,&bldx,ya,&bldy,&zero,c,&bldc));
+  ierr = MatDenseRestoreArrayRead(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArrayRead(Y,&ya);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*m*nx*ny);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   KSPDenseMultAdd_Private - Computes Y = beta Y + X C for the small matrix C stored with leading dimension ldc
+*/
+PetscErrorCode KSPDenseMultAdd_Private(Mat X,const PetscScalar *c,PetscInt ldc,PetscScalar beta,Mat Y)
+{
+  PetscErrorCode    ierr;
+  const PetscScalar *xa;
+  PetscScalar       *ya,one = 1.0;
+  PetscInt          m,nx,ny,ldx,ldy;
+  PetscBLASInt      bm,bnx,bny,bldx,bldy,bldc;
+
+  PetscFunctionBegin;
+  ierr = MatGetLocalSize(X,&m,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(X,NULL,&nx);CHKERRQ(ierr);
+  ierr = MatGetSize(Y,NULL,&ny);CHKERRQ(ierr);
+  if (!m) PetscFunctionReturn(0);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Y,&ldy);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(m,&bm);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(nx,&bnx);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(ny,&bny);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(ldx,&bldx);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(ldy,&bldy);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(ldc,&bldc);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(Y,&ya);CHKERRQ(ierr);
+  PetscStackCallBLAS("BLASgemm",BLASgemm_("N","N",&bm,&bny,&bnx,&one,xa,&bldx,c,&bldc,&beta,ya,&bldy));
+  ierr = MatDenseRestoreArrayRead(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(Y,&ya);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*m*nx*ny);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   KSPDenseColumnNormsLocal_Private - Computes the contribution of the local rows to the squared 2-norms of the
+   columns of X, stored in the real part of nrm so that they can be reduced with the inner products
+*/
+PetscErrorCode KSPDenseColumnNormsLocal_Private(Mat X,PetscScalar *nrm)
+{
+  PetscErrorCode    ierr;
+  const PetscScalar *xa;
+  PetscInt          m,n,ldx,i,j;
+  PetscReal         sum;
+
+  PetscFunctionBegin;
+  ierr = MatGetLocalSize(X,&m,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(X,NULL,&n);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(X,&xa);CHKERRQ(ierr);
+  for (j=0; j<n; j++) {
+    sum = 0.0;
+    for (i=0; i<m; i++) sum += PetscRealPart(PetscConj(xa[i+j*ldx])*xa[i+j*ldx]);
+    nrm[j] = sum;
+  }
+  ierr = MatDenseRestoreArrayRead(X,&xa);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*m*n);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   KSPDenseCholesky_Private - Computes the Cholesky factor G = L L^H of a small Hermitian positive semi-definite matrix
+   G of order n, together with T = L^{-H}. Columns whose pivot is small relative to their diagonal entry are linearly
+   dependent on the previous ones: they are dropped, their rows and columns of L and T are set to zero, and rank
+   returns the number of columns kept. This lets the block Krylov methods deflate converged or dependent directions
+   instead of breaking down. indef is set when a negative diagonal entry is found.
+*/
+PetscErrorCode KSPDenseCholesky_Private(PetscInt n,const PetscScalar *G,PetscScalar *L,PetscScalar *T,PetscInt *rank,PetscBool *indef)
+{
+  PetscInt    i,j,k;
+  PetscReal   d,gjj;
+  PetscScalar sum;
+
+  PetscFunctionBegin;
+  *rank  = 0;
+  *indef = PETSC_FALSE;
+  for (j=0; j<n*n; j++) L[j] = T[j] = 0.0;
+  for (j=0; j<n; j++) {
+    gjj = PetscRealPart(G[j+j*n]);
+    if (gjj < 0.0) *indef = PETSC_TRUE;
+    d = gjj;
+    for (k=0; k<j; k++) d -= PetscRealPart(L[j+k*n]*PetscConj(L[j+k*n]));
+    if (gjj <= 0.0 || d <= PETSC_SQRT_MACHINE_EPSILON*gjj) continue;
+    L[j+j*n] = PetscSqrtReal(d);
+    for (i=j+1; i<n; i++) {
+      sum = G[i+j*n];
+      for (k=0; k<j; k++) sum -= L[i+k*n]*PetscConj(L[j+k*n]);
+      L[i+j*n] = sum/L[j+j*n];
+    }
+    (*rank)++;
+  }
+  /* T = L^{-H}: the conjugate transpose of the inverse of L restricted to the columns kept */
+  for (j=0; j<n; j++) {
+    if (L[j+j*n] == (PetscScalar)0.0) continue;
+    T[j+j*n] = 1.0/PetscConj(L[j+j*n]);
+    for (i=j+1; i<n; i++) {
+      if (L[i+i*n] == (PetscScalar)0.0) continue;
+      sum = 0.0;
+      for (k=j; k<i; k++) sum += L[i+k*n]*PetscConj(T[j+k*n]);
+      T[j+i*n] = -PetscConj(sum/L[i+i*n]);
+    }
+  }
+  PetscFunctionReturn(0);
+}
@@ -4,6 +4,7 @@
 */
 
 #include <petsc/private/kspimpl.h>   /*I "petscksp.h" I*/
+#include <petsc/private/pcimpl.h>
 #include <petscdm.h>
 
 PETSC_STATIC_INLINE PetscErrorCode ObjectView(PetscObject obj, PetscViewer viewer, PetscViewerFormat format)
@@ -888,6 +889,122 @@ PetscErrorCode KSPSolveTranspose(KSP ksp,Vec b,Vec x)
   PetscFunctionReturn(0);
 }
 
+/*
+   KSPMatSolve_Basic - Solves with each column of the block of right-hand sides in turn with KSPSolve()
+*/
+PetscErrorCode KSPMatSolve_Basic(KSP ksp,Mat B,Mat X)
+{
+  PetscErrorCode     ierr;
+  Vec                b,x;
+  PetscScalar        *xa;
+  const PetscScalar  *ba;
+  PetscInt           N,i,ldb,ldx,its = 0;
+  KSPConvergedReason reason = KSP_CONVERGED_ITS;
+
+  PetscFunctionBegin;
+  ierr = MatGetSize(B,NULL,&N);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(B,&ldb);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatCreateVecs(B,NULL,&b);CHKERRQ(ierr);
+  ierr = MatCreateVecs(X,NULL,&x);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(B,&ba);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(X,&xa);CHKERRQ(ierr);
+  for (i=0; i<N; i++) {
+    ierr = VecPlaceArray(b,ba+i*ldb);CHKERRQ(ierr);
+    ierr = VecPlaceArray(x,xa+i*ldx);CHKERRQ(ierr);
+    ierr = KSPSolve(ksp,b,x);CHKERRQ(ierr);
+    ierr = VecResetArray(b);CHKERRQ(ierr);
+    ierr = VecResetArray(x);CHKERRQ(ierr);
+    its  = PetscMax(its,ksp->its);
+    if (reason >= 0) reason = ksp->reason;
+  }
+  ierr = MatDenseRestoreArrayRead(B,&ba);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(X,&xa);CHKERRQ(ierr);
+  ierr = VecDestroy(&b);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ksp->its    = its;
+  ksp->reason = reason;
+  PetscFunctionReturn(0);
+}
+
+/*@
+   KSPMatSolve - Solves a linear system with a block of right-hand sides
+
+   Collective on ksp
+
+   Input Parameters:
++  ksp - iterative context obtained from KSPCreate()
+.  B - the right-hand sides, stored as the columns of a MATSEQDENSE or MATMPIDENSE matrix
+-  X - the solutions, a dense matrix with the same layout as B and different from B
+
+   Notes:
+   The Krylov methods that implement this operation natively (KSPCG, KSPGMRES and KSPPREONLY) work on the whole
+   block at once: they apply the operator with MatMatMult(), so that each row of a sparse matrix is read once for all
+   the right-hand sides, the preconditioner with PCMatApply(), and they merge the inner products of all the columns
+   into a few global reductions per iteration. KSPCG then runs the block conjugate gradient method and KSPGMRES the
+   block GMRES method, whose restart counts block iterations. Both search the sum of the Krylov spaces of all the
+   right-hand sides and deflate the directions that become linearly dependent, so they usually need fewer iterations
+   than the individual solves.
+
+   A block method stops when the residual norm of every column satisfies the convergence test, the relative tolerance
+   being relative to the initial residual. KSPGetIterationNumber() and KSPGetConvergedReason() then refer to the whole
+   block.
+
+   Other Krylov methods, and solvers using diagonal scaling, a null space, an initial guess object or pre/post solve
+   hooks, solve with each column in turn with KSPSolve(); the number of iterations is then the largest over the
+   columns and the converged reason the first failure, if any.
+
+   If KSPSetInitialGuessNonzero() has been called the content of X is used as the initial guess.
+
+   Level: intermediate
+
+.seealso: KSPSolve(), KSPCreate(), KSPSetOperators(), PCMatApply(), MatMatMult(), MatMatSolve()
+@*/
+PetscErrorCode KSPMatSolve(KSP ksp,Mat B,Mat X)
+{
+  PetscErrorCode ierr;
+  Mat            mat;
+  MatNullSpace   nullsp = NULL;
+  PetscInt       M1,M2,N1,N2;
+  PetscBool      match;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ksp,KSP_CLASSID,1);
+  PetscValidHeaderSpecific(B,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(X,MAT_CLASSID,3);
+  PetscCheckSameComm(ksp,1,B,2);
+  PetscCheckSameComm(ksp,1,X,3);
+  if (B == X) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_IDN,"B and X must be different matrices");
+  ierr = PetscObjectTypeCompareAny((PetscObject)B,&match,MATSEQDENSE,MATMPIDENSE,"");CHKERRQ(ierr);
+  if (!match) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_WRONG,"Provided block of right-hand sides not stored in a dense Mat");
+  ierr = PetscObjectTypeCompareAny((PetscObject)X,&match,MATSEQDENSE,MATMPIDENSE,"");CHKERRQ(ierr);
+  if (!match) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_WRONG,"Provided block of solutions not stored in a dense Mat");
+  ierr = MatGetLocalSize(B,&M1,NULL);CHKERRQ(ierr);
+  ierr = MatGetLocalSize(X,&M2,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(B,NULL,&N1);CHKERRQ(ierr);
+  ierr = MatGetSize(X,NULL,&N2);CHKERRQ(ierr);
+  if (M1 != M2 || N1 != N2) SETERRQ4(PetscObjectComm((PetscObject)ksp),PETSC_ERR_ARG_SIZ,"Incompatible blocks of right-hand sides (%D x %D) and solutions (%D x %D)",M1,N1,M2,N2);
+  ksp->transpose_solve = PETSC_FALSE;
+
+  ierr = KSPSetUp(ksp);CHKERRQ(ierr);
+  ierr = KSPSetUpOnBlocks(ksp);CHKERRQ(ierr);
+  ierr = PCGetOperators(ksp->pc,&mat,NULL);CHKERRQ(ierr);
+  ierr = MatGetNullSpace(mat,&nullsp);CHKERRQ(ierr);
+  if (ksp->guess_zero) {ierr = MatZeroEntries(X);CHKERRQ(ierr);}
+  ksp->reason = KSP_CONVERGED_ITERATING;
+  if (ksp->ops->matsolve && !ksp->dscale && !nullsp && !ksp->guess && !ksp->presolve && !ksp->postsolve && !ksp->pc->ops->presolve && !ksp->pc->ops->postsolve) {
+    if (ksp->res_hist_reset) ksp->res_hist_len = 0;
+    ierr = PetscLogEventBegin(KSP_MatSolve,ksp,B,X,0);CHKERRQ(ierr);
+    ierr = (*ksp->ops->matsolve)(ksp,B,X);CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(KSP_MatSolve,ksp,B,X,0);CHKERRQ(ierr);
+  } else {
+    ierr = KSPMatSolve_Basic(ksp,B,X);CHKERRQ(ierr);
+  }
+  if (!ksp->reason) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Internal error, solver returned without setting converged reason");
+  if (ksp->errorifnotconverged && ksp->reason < 0 && ksp->reason != KSP_DIVERGED_ITS) SETERRQ1(PetscObjectComm((PetscObject)ksp),PETSC_ERR_NOT_CONVERGED,"KSPMatSolve has not converged, reason %s",KSPConvergedReasons[ksp->reason]);
+  PetscFunctionReturn(0);
+}
+
 /*@
    KSPResetViewers - Resets all the viewers set from the options database during KSPSetFromOptions()
 
@@ -0,0 +1,134 @@
+/*
+   The matrix powers kernel of the s-step Krylov methods: A x, A^2 x, ..., A^s x with a single ghost exchange
+*/
+#include <petsc/private/kspimpl.h>
+
+struct _n_KSPMatPowers {
+  Mat              A;          /* the parallel operator */
+  PetscObjectState state;      /* state of A when Aloc was extracted */
+  PetscObjectState nzstate;    /* nonzero state of A when the ghost region was computed */
+  PetscInt         s;          /* depth of the ghost region */
+  IS               is;         /* the rows within distance s of the local rows, sorted */
+  Mat              *Aloc;      /* A(is,is) */
+  Vec              xloc[2];    /* sequential vectors on the rows of is */
+  VecScatter       scatter;    /* gathers the entries of is from a parallel vector */
+  PetscInt         offset;     /* position of the first local row in is */
+};
+
+/*
+   KSPMatPowersSetUp_Private - Prepares the computation of the first s powers of the operator of the KSP with one
+   ghost exchange of depth s, when that operator is a MATMPIAIJ matrix and the preconditioner is PCNONE
+
+   Input Parameters:
++  ksp - the Krylov solver
+.  s - the largest power
+-  mp - the kernel set up for a previous solve, or NULL
+
+   Output Parameter:
+.  mp - the kernel, NULL when it does not apply and the powers must be computed one product at a time
+
+   Notes:
+   Each process extracts the rows of A within graph distance s of its own rows, A(is,is), and gathers the entries
+   of is of the vector, so that A^j x is available on the rows within distance s-j of its own rows after j local
+   products. This replaces s neighbor exchanges by one with a larger ghost region, at the cost of redundant
+   products on that region. The extracted rows are refreshed when the values of A change and recomputed when its
+   nonzero structure changes.
+*/
+PetscErrorCode KSPMatPowersSetUp_Private(KSP ksp,PetscInt s,KSPMatPowers *mp)
+{
+  PetscErrorCode   ierr;
+  Mat              A,P;
+  PetscBool        ismpiaij,isnone,diagonalscale;
+  PetscObjectState state,nzstate;
+  PetscInt         rstart,rend,n;
+  const PetscInt   *idx;
+  Vec              x;
+
+  PetscFunctionBegin;
+  ierr = PCGetOperators(ksp->pc,&A,&P);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)A,MATMPIAIJ,&ismpiaij);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)ksp->pc,PCNONE,&isnone);CHKERRQ(ierr);
+  ierr = PCGetDiagonalScale(ksp->pc,&diagonalscale);CHKERRQ(ierr);
+  if (s < 2 || !ismpiaij || !isnone || diagonalscale || ksp->transpose_solve) {
+    ierr = KSPMatPowersDestroy_Private(mp);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = PetscObjectStateGet((PetscObject)A,&state);CHKERRQ(ierr);
+  ierr = MatGetNonzeroState(A,&nzstate);CHKERRQ(ierr);
+  if (*mp && ((*mp)->A != A || (*mp)->s != s || (*mp)->nzstate != nzstate)) {
+    ierr = KSPMatPowersDestroy_Private(mp);CHKERRQ(ierr);
+  }
+  if (*mp) {
+    if ((*mp)->state != state) {
+      ierr = MatCreateSubMatrices(A,1,&(*mp)->is,&(*mp)->is,MAT_REUSE_MATRIX,&(*mp)->Aloc);CHKERRQ(ierr);
+      (*mp)->state = state;
+    }
+    PetscFunctionReturn(0);
+  }
+
+  ierr = PetscNew(mp);CHKERRQ(ierr);
+  ierr = PetscObjectReference((PetscObject)A);CHKERRQ(ierr);
+  (*mp)->A       = A;
+  (*mp)->s       = s;
+  (*mp)->state   = state;
+  (*mp)->nzstate = nzstate;
+  ierr = MatGetOwnershipRange(A,&rstart,&rend);CHKERRQ(ierr);
+  ierr = ISCreateStride(PETSC_COMM_SELF,rend-rstart,rstart,1,&(*mp)->is);CHKERRQ(ierr);
+  ierr = MatIncreaseOverlap(A,1,&(*mp)->is,s);CHKERRQ(ierr);
+  ierr = ISSort((*mp)->is);CHKERRQ(ierr);
+  ierr = MatCreateSubMatrices(A,1,&(*mp)->is,&(*mp)->is,MAT_INITIAL_MATRIX,&(*mp)->Aloc);CHKERRQ(ierr);
+
+  ierr = ISGetLocalSize((*mp)->is,&n);CHKERRQ(ierr);
+  ierr = ISGetIndices((*mp)->is,&idx);CHKERRQ(ierr);
+  ierr = PetscFindInt(rstart,n,idx,&(*mp)->offset);CHKERRQ(ierr);
+  ierr = ISRestoreIndices((*mp)->is,&idx);CHKERRQ(ierr);
+  if (rend > rstart && (*mp)->offset < 0) SETERRQ(PetscObjectComm((PetscObject)ksp),PETSC_ERR_PLIB,"The local rows are missing from the ghost region");
+  ierr = MatCreateVecs((*mp)->Aloc[0],&(*mp)->xloc[0],&(*mp)->xloc[1]);CHKERRQ(ierr);
+  ierr = MatCreateVecs(A,&x,NULL);CHKERRQ(ierr);
+  ierr = VecScatterCreate(x,(*mp)->is,(*mp)->xloc[0],NULL,&(*mp)->scatter);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = PetscInfo3(ksp,"Matrix powers kernel of depth %D on %D rows for %D local rows\n",s,n,rend-rstart);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   KSPMatPowersApply_Private - Computes Y[j] = A^{j+1} x for j < n <= s with the kernel of KSPMatPowersSetUp_Private()
+*/
+PetscErrorCode KSPMatPowersApply_Private(KSPMatPowers mp,Vec x,PetscInt n,Vec *Y)
+{
+  PetscErrorCode    ierr;
+  PetscInt          j,nloc;
+  const PetscScalar *y;
+  PetscScalar       *py;
+
+  PetscFunctionBegin;
+  if (n > mp->s) SETERRQ2(PetscObjectComm((PetscObject)x),PETSC_ERR_ARG_OUTOFRANGE,"Power %D larger than the depth %D of the kernel",n,mp->s);
+  ierr = VecScatterBegin(mp->scatter,x,mp->xloc[0],INSERT_VALUES,SCATTER_FORWARD);CHKERRQ(ierr);
+  ierr = VecScatterEnd(mp->scatter,x,mp->xloc[0],INSERT_VALUES,SCATTER_FORWARD);CHKERRQ(ierr);
+  ierr = VecGetLocalSize(x,&nloc);CHKERRQ(ierr);
+  for (j=0; j<n; j++) {
+    ierr = MatMult(mp->Aloc[0],mp->xloc[j%2],mp->xloc[(j+1)%2]);CHKERRQ(ierr);
+    ierr = VecGetArrayRead(mp->xloc[(j+1)%2],&y);CHKERRQ(ierr);
+    ierr = VecGetArray(Y[j],&py);CHKERRQ(ierr);
+    ierr = PetscArraycpy(py,y+mp->offset,nloc);CHKERRQ(ierr);
+    ierr = VecRestoreArray(Y[j],&py);CHKERRQ(ierr);
+    ierr = VecRestoreArrayRead(mp->xloc[(j+1)%2],&y);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode KSPMatPowersDestroy_Private(KSPMatPowers *mp)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!*mp) PetscFunctionReturn(0);
+  ierr = MatDestroy(&(*mp)->A);CHKERRQ(ierr);
+  ierr = ISDestroy(&(*mp)->is);CHKERRQ(ierr);
+  ierr = MatDestroySubMatrices(1,&(*mp)->Aloc);CHKERRQ(ierr);
+  ierr = VecDestroy(&(*mp)->xloc[0]);CHKERRQ(ierr);
+  ierr = VecDestroy(&(*mp)->xloc[1]);CHKERRQ(ierr);
+  ierr = VecScatterDestroy(&(*mp)->scatter);CHKERRQ(ierr);
+  ierr = PetscFree(*mp);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
@@ -0,0 +1,91 @@
+static char help[] = "Tests PCVPBJACOBI with many blocks of mixed sizes, applied in batches of blocks of the same size.\n\n";
+
+#include <petscpc.h>
+
+int main(int argc,char **args)
+{
+  Mat            A;
+  Vec            x,y,z;
+  PC             pc;
+  PetscInt       pattern[] = {1,3,2,3,5,3,1,8,3,2,12,3,7,3,3,4};
+  PetscInt       nblocks = 40,b,i,j,n = 0,row,*bsizes;
+  PetscScalar    v;
+  PetscReal      nrm,nrmx;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&args,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-nblocks",&nblocks,NULL);CHKERRQ(ierr);
+  ierr = PetscMalloc1(nblocks,&bsizes);CHKERRQ(ierr);
+  for (b=0; b<nblocks; b++) {
+    bsizes[b] = pattern[b%16];
+    n        += bsizes[b];
+  }
+
+  /* a block diagonal matrix, so the preconditioner is its inverse */
+  ierr = MatCreateSeqAIJ(PETSC_COMM_SELF,n,n,12,NULL,&A);CHKERRQ(ierr);
+  for (b=0, row=0; b<nblocks; row+=bsizes[b], b++) {
+    for (i=0; i<bsizes[b]; i++) {
+      for (j=0; j<bsizes[b]; j++) {
+        v    = (i == j) ? 0.5 : 1.0/(1.0+i+2*j+b%5);
+        ierr = MatSetValue(A,row+i,row+(j+1)%bsizes[b],v,INSERT_VALUES);CHKERRQ(ierr);
+      }
+    }
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatSetVariableBlockSizes(A,nblocks,bsizes);CHKERRQ(ierr);
+
+  ierr = MatCreateVecs(A,&x,&y);CHKERRQ(ierr);
+  ierr = VecDuplicate(x,&z);CHKERRQ(ierr);
+  for (i=0; i<n; i++) {ierr = VecSetValue(x,i,1.0+i%7,INSERT_VALUES);CHKERRQ(ierr);}
+  ierr = VecAssemblyBegin(x);CHKERRQ(ierr);
+  ierr = VecAssemblyEnd(x);CHKERRQ(ierr);
+
+  ierr = PCCreate(PETSC_COMM_SELF,&pc);CHKERRQ(ierr);
+  ierr = PCSetType(pc,PCVPBJACOBI);CHKERRQ(ierr);
+  ierr = PCSetOperators(pc,A,A);CHKERRQ(ierr);
+  ierr = PCSetFromOptions(pc);CHKERRQ(ierr);
+  ierr = PCSetUp(pc);CHKERRQ(ierr);
+  ierr = PCApply(pc,x,y);CHKERRQ(ierr);
+  ierr = MatMult(A,y,z);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,x);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_2,&nrm);CHKERRQ(ierr);
+  ierr = VecNorm(x,NORM_2,&nrmx);CHKERRQ(ierr);
+  if (nrm > 100.0*PETSC_SMALL*nrmx) {
+    ierr = PetscPrintf(PETSC_COMM_SELF,"Error of the block inverses %g\n",(double)(nrm/nrmx));CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_SELF,"Block inverses of %D blocks to the tolerance\n",nblocks);CHKERRQ(ierr);
+  }
+
+  /* new values with the same block sizes */
+  ierr = MatScale(A,2.0);CHKERRQ(ierr);
+  ierr = PCSetUp(pc);CHKERRQ(ierr);
+  ierr = PCApply(pc,x,y);CHKERRQ(ierr);
+  ierr = MatMult(A,y,z);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,x);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_2,&nrm);CHKERRQ(ierr);
+  if (nrm > 100.0*PETSC_SMALL*nrmx) {
+    ierr = PetscPrintf(PETSC_COMM_SELF,"Error of the block inverses after new values %g\n",(double)(nrm/nrmx));CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_SELF,"Block inverses after new values to the tolerance\n");CHKERRQ(ierr);
+  }
+
+  ierr = PCDestroy(&pc);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  ierr = VecDestroy(&z);CHKERRQ(ierr);
+  ierr = PetscFree(bsizes);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+
+   test:
+      suffix: 2
+      args: -nblocks 3
+
+TEST*/
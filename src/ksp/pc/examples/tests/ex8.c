@@ -0,0 +1,147 @@
+static char help[] = "Tests PCView() of a PCGAMG hierarchy to a binary file and PCLoad() of it.\n\n\
+  -m <m>   : grid size in each direction\n\
+  -bs <bs> : number of fields, with bs = 2 the rigid body modes are the near null space\n\n";
+
+#include <petscksp.h>
+
+static PetscErrorCode Solve(KSP ksp,Vec b,Vec x,PetscInt *its)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = VecSet(x,0.0);CHKERRQ(ierr);
+  ierr = KSPSolve(ksp,b,x);CHKERRQ(ierr);
+  ierr = KSPGetIterationNumber(ksp,its);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+int main(int argc,char **argv)
+{
+  KSP            ksp;
+  PC             pc;
+  Mat            A,B;
+  Vec            b,x,y,coords;
+  MatNullSpace   nullsp;
+  PetscViewer    viewer;
+  PetscScalar    *c;
+  PetscReal      nrm,nrmx;
+  PetscInt       m = 16,bs = 1,i,j,k,f,Istart,Iend,its,its2;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-bs",&bs,NULL);CHKERRQ(ierr);
+
+  /* 5-point Laplacian of each field, with a weak coupling of the fields */
+  ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,m*m*bs,m*m*bs);CHKERRQ(ierr);
+  ierr = MatSetBlockSize(A,bs);CHKERRQ(ierr);
+  ierr = MatSetType(A,MATAIJ);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(A,5*bs,NULL);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation(A,5*bs,NULL,5*bs,NULL);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(A,&Istart,&Iend);CHKERRQ(ierr);
+  for (k=Istart/bs; k<Iend/bs; k++) {
+    i = k/m; j = k - i*m;
+    for (f=0; f<bs; f++) {
+      PetscInt row = k*bs+f;
+      if (i>0)   {ierr = MatSetValue(A,row,row-m*bs,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+      if (i<m-1) {ierr = MatSetValue(A,row,row+m*bs,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+      if (j>0)   {ierr = MatSetValue(A,row,row-bs,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+      if (j<m-1) {ierr = MatSetValue(A,row,row+bs,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+      if (bs > 1) {ierr = MatSetValue(A,row,k*bs+(f+1)%bs,-0.1,INSERT_VALUES);CHKERRQ(ierr);}
+      ierr = MatSetValue(A,row,row,4.0+0.2*(bs>1),INSERT_VALUES);CHKERRQ(ierr);
+    }
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  if (bs == 2) {
+    /* three rigid body modes, so the prolongators have different row and column block sizes */
+    ierr = MatCreateVecs(A,&coords,NULL);CHKERRQ(ierr);
+    ierr = VecGetArray(coords,&c);CHKERRQ(ierr);
+    for (k=Istart/bs; k<Iend/bs; k++) {
+      c[k*bs-Istart]   = (PetscReal)(k%m)/(PetscReal)m;
+      c[k*bs-Istart+1] = (PetscReal)(k/m)/(PetscReal)m;
+    }
+    ierr = VecRestoreArray(coords,&c);CHKERRQ(ierr);
+    ierr = VecSetBlockSize(coords,bs);CHKERRQ(ierr);
+    ierr = MatNullSpaceCreateRigidBody(coords,&nullsp);CHKERRQ(ierr);
+    ierr = MatSetNearNullSpace(A,nullsp);CHKERRQ(ierr);
+    ierr = MatNullSpaceDestroy(&nullsp);CHKERRQ(ierr);
+    ierr = VecDestroy(&coords);CHKERRQ(ierr);
+  }
+  ierr = MatCreateVecs(A,&x,&b);CHKERRQ(ierr);
+  ierr = VecDuplicate(x,&y);CHKERRQ(ierr);
+  ierr = VecSet(b,1.0);CHKERRQ(ierr);
+
+  /* construct the hierarchy and save it */
+  ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);CHKERRQ(ierr);
+  ierr = KSPSetOperators(ksp,A,A);CHKERRQ(ierr);
+  ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
+  ierr = PCSetType(pc,PCGAMG);CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ksp);CHKERRQ(ierr);
+  ierr = Solve(ksp,b,x,&its);CHKERRQ(ierr);
+  ierr = PetscViewerCreate(PETSC_COMM_WORLD,&viewer);CHKERRQ(ierr);
+  ierr = PetscViewerSetType(viewer,PETSCVIEWERBINARY);CHKERRQ(ierr);
+  ierr = PetscViewerBinarySetSkipInfo(viewer,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscViewerFileSetMode(viewer,FILE_MODE_WRITE);CHKERRQ(ierr);
+  ierr = PetscViewerFileSetName(viewer,"gamg.dat");CHKERRQ(ierr);
+  ierr = PCView(pc,viewer);CHKERRQ(ierr);
+  ierr = PetscViewerDestroy(&viewer);CHKERRQ(ierr);
+  ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
+
+  /* load the hierarchy, with the coarse grid operators */
+  ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);CHKERRQ(ierr);
+  ierr = KSPSetOperators(ksp,A,A);CHKERRQ(ierr);
+  ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryOpen(PETSC_COMM_WORLD,"gamg.dat",FILE_MODE_READ,&viewer);CHKERRQ(ierr);
+  ierr = PCLoad(pc,viewer);CHKERRQ(ierr);
+  ierr = PetscViewerDestroy(&viewer);CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ksp);CHKERRQ(ierr);
+  ierr = Solve(ksp,b,y,&its2);CHKERRQ(ierr);
+  ierr = VecAXPY(y,-1.0,x);CHKERRQ(ierr);
+  ierr = VecNorm(y,NORM_2,&nrm);CHKERRQ(ierr);
+  ierr = VecNorm(x,NORM_2,&nrmx);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"Loaded hierarchy: %s iterations, %s solution\n",its2 == its ? "same" : "different",nrm < 100.0*PETSC_SMALL*nrmx ? "same" : "different");CHKERRQ(ierr);
+  ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
+
+  /* load the prolongators only and recompute the coarse grid operators of 2 A */
+  ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  ierr = MatScale(B,2.0);CHKERRQ(ierr);
+  ierr = KSPCreate(PETSC_COMM_WORLD,&ksp);CHKERRQ(ierr);
+  ierr = KSPSetOptionsPrefix(ksp,"ptap_");CHKERRQ(ierr);
+  ierr = KSPSetOperators(ksp,B,B);CHKERRQ(ierr);
+  ierr = KSPGetPC(ksp,&pc);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryOpen(PETSC_COMM_WORLD,"gamg.dat",FILE_MODE_READ,&viewer);CHKERRQ(ierr);
+  ierr = PCLoad(pc,viewer);CHKERRQ(ierr);
+  ierr = PetscViewerDestroy(&viewer);CHKERRQ(ierr);
+  ierr = KSPSetFromOptions(ksp);CHKERRQ(ierr);
+  ierr = Solve(ksp,b,y,&its2);CHKERRQ(ierr);
+  ierr = VecScale(y,2.0);CHKERRQ(ierr);
+  ierr = VecAXPY(y,-1.0,x);CHKERRQ(ierr);
+  ierr = VecNorm(y,NORM_2,&nrm);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"Loaded prolongators: %s iterations, %s solution\n",its2 == its ? "same" : "different",nrm < 100.0*PETSC_SMALL*nrmx ? "same" : "different");CHKERRQ(ierr);
+  ierr = KSPDestroy(&ksp);CHKERRQ(ierr);
+
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  ierr = VecDestroy(&b);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      nsize: {{1 3}}
+      args: -ksp_rtol 1.e-10 -ptap_ksp_rtol 1.e-10 -ptap_pc_gamg_load_ptap
+      output_file: output/ex8_1.out
+
+   test:
+      suffix: 2
+      nsize: {{1 3}}
+      args: -bs 2 -m 20 -ksp_rtol 1.e-10 -ptap_ksp_rtol 1.e-10 -ptap_pc_gamg_load_ptap -pc_gamg_threshold 0.01 -ptap_pc_gamg_threshold 0.01
+      output_file: output/ex8_1.out
+
+TEST*/
@@ -638,6 +638,33 @@ static PetscErrorCode PCApply_BJacobi_Singleblock(PC pc,Vec x,Vec y)
   PetscFunctionReturn(0);
 }
 
+static PetscErrorCode PCMatApply_BJacobi_Singleblock(PC pc,Mat X,Mat Y)
+{
+  PetscErrorCode         ierr;
+  PC_BJacobi             *jac  = (PC_BJacobi*)pc->data;
+  Mat                    sX,sY;
+  PCFailedReason         pcreason;
+  KSPConvergedReason     reason;
+  PC                     subpc;
+
+  PetscFunctionBegin;
+  /* the local part of a MATMPIDENSE matrix is a MATSEQDENSE matrix with all the columns, so the block solver
+     is applied to all the vectors at once */
+  ierr = MatDenseGetLocalMatrix(X,&sX);CHKERRQ(ierr);
+  ierr = MatDenseGetLocalMatrix(Y,&sY);CHKERRQ(ierr);
+  ierr = KSPSetReusePreconditioner(jac->ksp[0],pc->reusepreconditioner);CHKERRQ(ierr);
+  ierr = KSPMatSolve(jac->ksp[0],sX,sY);CHKERRQ(ierr);
+  ierr = KSPGetPC(jac->ksp[0],&subpc);CHKERRQ(ierr);
+  ierr = PCGetFailedReason(subpc,&pcreason);CHKERRQ(ierr);
+  ierr = KSPGetConvergedReason(jac->ksp[0],&reason);CHKERRQ(ierr);
+  if (pcreason || (reason < 0 && reason != KSP_DIVERGED_ITS)) {
+    if (pc->erroriffailure) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_NOT_CONVERGED,"Detected not converged in KSP inner solve: KSP reason %s PC reason %s",KSPConvergedReasons[reason],PCFailedReasons[pcreason]);
+    ierr = PetscInfo2(jac->ksp[0],"Detected not converged in KSP inner solve: KSP reason %s PC reason %s\n",KSPConvergedReasons[reason],PCFailedReasons[pcreason]);CHKERRQ(ierr);
+    pc->failedreason = PC_SUBPC_ERROR;
+  }
+  PetscFunctionReturn(0);
+}
+
 static PetscErrorCode PCApplySymmetricLeft_BJacobi_Singleblock(PC pc,Vec x,Vec y)
 {
   PetscErrorCode         ierr;
@@ -760,6 +787,7 @@ static PetscErrorCode PCSetUp_BJacobi_Singleblock(PC pc,Mat mat,Mat pmat)
       pc->ops->reset               = PCReset_BJacobi_Singleblock;
       pc->ops->destroy             = PCDestroy_BJacobi_Singleblock;
       pc->ops->apply               = PCApply_BJacobi_Singleblock;
+      pc->ops->matapply            = PCMatApply_BJacobi_Singleblock;
       pc->ops->applysymmetricleft  = PCApplySymmetricLeft_BJacobi_Singleblock;
       pc->ops->applysymmetricright = PCApplySymmetricRight_BJacobi_Singleblock;
       pc->ops->applytranspose      = PCApplyTranspose_BJacobi_Singleblock;
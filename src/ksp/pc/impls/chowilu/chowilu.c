@@ -0,0 +1,378 @@
+/*
+   Fine-grained iterative ILU (Chow and Patel) for SeqAIJ matrices. The values of the incomplete factors on the
+   pattern of the symbolic ILU(k) factorization are computed by a fixed number of Jacobi sweeps over the nonzeros of
+   the factors, each of which is independent of the others within a sweep, and the triangular solves are approximated
+   by Jacobi iterations.
+*/
+#include <petsc/private/pcimpl.h>               /*I "petscpc.h" I*/
+#include <../src/mat/impls/aij/seq/aij.h>
+
+typedef struct {
+  PetscInt  levels;        /* levels of fill of the symbolic factorization */
+  PetscInt  sweeps;        /* number of sweeps of the factorization */
+  PetscInt  solveits;      /* Jacobi iterations for each triangular solve, 0 for exact triangular solves */
+  Mat       fact;          /* symbolic ILU(k) factor, holds the computed factors */
+  PetscInt  nz;            /* number of nonzeros of the factor */
+  PetscInt  *frow;         /* row of each nonzero of the factor */
+  PetscInt  *apos;         /* location of each nonzero of the factor in the matrix, -1 for fill */
+  PetscInt  *uci,*ucp;     /* column j of U (diagonal included) is at factor locations ucp[uci[j]:uci[j+1]], by increasing row */
+  MatScalar *val[2];       /* current and previous iterates of the factor values, with U(i,i) stored at bdiag[i] */
+  PetscScalar *work[2];    /* work vectors of the Jacobi triangular solves */
+} PC_ChowILU;
+
+static PetscErrorCode PCReset_ChowILU(PC pc)
+{
+  PC_ChowILU     *ilu = (PC_ChowILU*)pc->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatDestroy(&ilu->fact);CHKERRQ(ierr);
+  ierr = PetscFree4(ilu->frow,ilu->apos,ilu->uci,ilu->ucp);CHKERRQ(ierr);
+  ierr = PetscFree2(ilu->val[0],ilu->val[1]);CHKERRQ(ierr);
+  ierr = PetscFree2(ilu->work[0],ilu->work[1]);CHKERRQ(ierr);
+  ilu->nz = 0;
+  PetscFunctionReturn(0);
+}
+
+/*
+   Builds the symbolic factor and the index arrays used by the sweeps; only needed when the nonzero pattern changes
+*/
+static PetscErrorCode PCChowILUSetUpSymbolic_Private(PC pc)
+{
+  PC_ChowILU     *ilu = (PC_ChowILU*)pc->data;
+  Mat            A = pc->pmat;
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data,*b;
+  MatFactorInfo  info;
+  IS             isrow,iscol;
+  PetscInt       n = A->rmap->n,nz,i,j,k,p,q,*bi,*bj,*bdiag,*cnt;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PCReset_ChowILU(pc);CHKERRQ(ierr);
+  ierr = MatGetFactor(A,MATSOLVERPETSC,MAT_FACTOR_ILU,&ilu->fact);CHKERRQ(ierr);
+  ierr = MatGetOrdering(A,MATORDERINGNATURAL,&isrow,&iscol);CHKERRQ(ierr);
+  ierr = MatFactorInfoInitialize(&info);CHKERRQ(ierr);
+  info.levels = ilu->levels;
+  info.fill   = 1.0;
+  ierr = MatILUFactorSymbolic(ilu->fact,A,isrow,iscol,&info);CHKERRQ(ierr);
+  ierr = ISDestroy(&isrow);CHKERRQ(ierr);
+  ierr = ISDestroy(&iscol);CHKERRQ(ierr);
+  ierr = PetscLogObjectParent((PetscObject)pc,(PetscObject)ilu->fact);CHKERRQ(ierr);
+
+  b     = (Mat_SeqAIJ*)ilu->fact->data;
+  bi    = b->i;
+  bj    = b->j;
+  bdiag = b->diag;
+  nz    = ilu->nz = n ? bdiag[0]+1 : 0;
+  ierr  = PetscMalloc4(nz,&ilu->frow,nz,&ilu->apos,n+1,&ilu->uci,nz-bi[n],&ilu->ucp);CHKERRQ(ierr);
+  ierr  = PetscMalloc2(nz,&ilu->val[0],nz,&ilu->val[1]);CHKERRQ(ierr);
+  ierr  = PetscMalloc2(n,&ilu->work[0],n,&ilu->work[1]);CHKERRQ(ierr);
+  ierr  = PetscLogObjectMemory((PetscObject)pc,(2*nz+n+1+nz-bi[n])*sizeof(PetscInt)+2*nz*sizeof(MatScalar)+2*n*sizeof(PetscScalar));CHKERRQ(ierr);
+
+  /* row of each nonzero and its location in A, row i of the factor is L(i,:), U(i,i), then the rest of U(i,:) */
+  for (i=0; i<n; i++) {
+    const PetscInt *aj = a->j + a->i[i],anz = a->i[i+1] - a->i[i];
+
+    for (p=bi[i]; p<bi[i+1]; p++) ilu->frow[p] = i;
+    for (p=bdiag[i+1]+1; p<=bdiag[i]; p++) ilu->frow[p] = i;
+    for (p=bi[i],k=0; p<bi[i+1]; p++) {
+      while (k < anz && aj[k] < bj[p]) k++;
+      ilu->apos[p] = (k < anz && aj[k] == bj[p]) ? a->i[i]+k : -1;
+    }
+    ilu->apos[bdiag[i]] = a->diag[i];
+    for (p=bdiag[i+1]+1,k=a->diag[i]-a->i[i]; p<bdiag[i]; p++) {
+      while (k < anz && aj[k] < bj[p]) k++;
+      ilu->apos[p] = (k < anz && aj[k] == bj[p]) ? a->i[i]+k : -1;
+    }
+  }
+
+  /* column oriented index of U, the rows of each column are increasing since the rows are traversed in order */
+  ierr = PetscCalloc1(n+1,&cnt);CHKERRQ(ierr);
+  for (p=bi[n]; p<nz; p++) cnt[bj[p]+1]++;
+  ilu->uci[0] = 0;
+  for (j=0; j<n; j++) {ilu->uci[j+1] = ilu->uci[j] + cnt[j+1]; cnt[j+1] = ilu->uci[j];}
+  for (i=0; i<n; i++) {
+    ilu->ucp[cnt[i+1]++] = bdiag[i];
+    for (q=bdiag[i+1]+1; q<bdiag[i]; q++) ilu->ucp[cnt[bj[q]+1]++] = q;
+  }
+  ierr = PetscFree(cnt);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   One sweep of the fixed-point iteration, computes every nonzero of the factors from the previous iterate old[]
+
+     L(i,j) = (A(i,j) - sum_{k<j} L(i,k) U(k,j))/U(j,j),  i > j
+     U(i,j) =  A(i,j) - sum_{k<i} L(i,k) U(k,j),          i <= j
+
+   Does not use the PETSc error handling since it is called inside a threaded region
+*/
+PETSC_STATIC_INLINE PetscLogDouble PCChowILUSweep_Private(PC_ChowILU *ilu,const MatScalar *aa,const PetscInt *bi,const PetscInt *bj,const PetscInt *bdiag,PetscInt p,const MatScalar *old,MatScalar *cur)
+{
+  const PetscInt i = ilu->frow[p],j = bj[p],m = PetscMin(i,j);
+  PetscInt       q = bi[i],qend = bi[i+1],r = ilu->uci[j],rend = ilu->uci[j+1],k,kr;
+  MatScalar      s = ilu->apos[p] >= 0 ? aa[ilu->apos[p]] : 0.0;
+  PetscLogDouble flops = 0;
+
+  /* merge row i of L with column j of U over k < min(i,j) */
+  while (q < qend && r < rend) {
+    k = bj[q];
+    if (k >= m) break;
+    kr = ilu->frow[ilu->ucp[r]];
+    if (kr >= m) break;
+    if (k == kr) {s -= old[q]*old[ilu->ucp[r]]; q++; r++; flops += 2;}
+    else if (k < kr) q++;
+    else r++;
+  }
+  if (i > j) {
+    if (old[bdiag[j]] != (MatScalar)0.0) {s /= old[bdiag[j]]; flops++;}
+    else s = old[p];
+  }
+  cur[p] = s;
+  return flops;
+}
+
+/*
+   Solves with the factors, either exactly or with Jacobi iterations for each triangular factor
+
+     z^{k+1} = b - (L - I) z^k,                 z^0 = b
+     y^{k+1} = D^{-1} (z - (U - D) y^k),       y^0 = D^{-1} z
+*/
+static PetscErrorCode PCApply_ChowILU(PC pc,Vec x,Vec y)
+{
+  PC_ChowILU        *ilu = (PC_ChowILU*)pc->data;
+  Mat_SeqAIJ        *b = (Mat_SeqAIJ*)ilu->fact->data;
+  const PetscInt    n = ilu->fact->rmap->n,*bi = b->i,*bj = b->j,*bdiag = b->diag;
+  const MatScalar   *ba = b->a;
+  const PetscScalar *xx;
+  PetscScalar       *yy,*z,*zold,*w,*wold,*tmp;
+  PetscInt          it,i;
+  PetscErrorCode    ierr;
+#if defined(PETSC_HAVE_OPENMP)
+  PetscInt          nt = ((Mat_SeqAIJ*)pc->pmat->data)->threads.nthreads;
+#endif
+
+  PetscFunctionBegin;
+  if (!ilu->solveits) {
+    ierr = MatSolve(ilu->fact,x,y);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetArrayRead(x,&xx);CHKERRQ(ierr);
+  ierr = VecGetArray(y,&yy);CHKERRQ(ierr);
+
+  /* lower triangular solve, the final iterate must land in work[0] so that y is free for the upper triangular solve */
+  z    = (ilu->solveits % 2) ? ilu->work[0] : yy;
+  zold = (ilu->solveits % 2) ? yy : ilu->work[0];
+  ierr = PetscArraycpy(zold,xx,n);CHKERRQ(ierr);
+  for (it=0; it<ilu->solveits; it++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+    for (i=0; i<n; i++) {
+      PetscScalar sum = xx[i];
+      PetscInt    q;
+
+      for (q=bi[i]; q<bi[i+1]; q++) sum -= ba[q]*zold[bj[q]];
+      z[i] = sum;
+    }
+    tmp = z; z = zold; zold = tmp;
+  }
+  z = zold;
+
+  /* upper triangular solve, the final iterate must land in y */
+  w    = (ilu->solveits % 2) ? yy : ilu->work[1];
+  wold = (ilu->solveits % 2) ? ilu->work[1] : yy;
+  for (i=0; i<n; i++) wold[i] = ba[bdiag[i]]*z[i];
+  for (it=0; it<ilu->solveits; it++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+    for (i=0; i<n; i++) {
+      PetscScalar sum = z[i];
+      PetscInt    q;
+
+      for (q=bdiag[i+1]+1; q<bdiag[i]; q++) sum -= ba[q]*wold[bj[q]];
+      w[i] = ba[bdiag[i]]*sum;
+    }
+    tmp = w; w = wold; wold = tmp;
+  }
+  ierr = VecRestoreArray(y,&yy);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(x,&xx);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*ilu->solveits*(ilu->nz - n) + (ilu->solveits+1.0)*n);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PCSetUp_ChowILU(PC pc)
+{
+  PC_ChowILU      *ilu = (PC_ChowILU*)pc->data;
+  Mat_SeqAIJ      *a,*b;
+  const MatScalar *aa;
+  MatScalar       *cur,*old,*tmp;
+  const PetscInt  *adiag,*bi,*bj,*bdiag;
+  PetscInt        n,nz,p,s,i,nzeropivot = 0;
+  PetscLogDouble  flops = 0,sflops;
+  PetscBool       flg;
+  PetscErrorCode  ierr;
+#if defined(PETSC_HAVE_OPENMP)
+  PetscInt        nt;
+#endif
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)pc->pmat,MATSEQAIJ,&flg);CHKERRQ(ierr);
+  if (!flg) SETERRQ1(PetscObjectComm((PetscObject)pc),PETSC_ERR_SUP,"Matrix type %s not supported, use PCCHOWILU as the subdomain solver of PCBJACOBI or PCASM in parallel",((PetscObject)pc->pmat)->type_name);
+  if (!ilu->fact || pc->flag != SAME_NONZERO_PATTERN) {
+    ierr = PCChowILUSetUpSymbolic_Private(pc);CHKERRQ(ierr);
+  }
+  pc->failedreason = PC_NOERROR;
+  a     = (Mat_SeqAIJ*)pc->pmat->data;
+  b     = (Mat_SeqAIJ*)ilu->fact->data;
+  aa    = a->a;
+  adiag = a->diag;
+  bi    = b->i;
+  bj    = b->j;
+  bdiag = b->diag;
+  n     = pc->pmat->rmap->n;
+  nz    = ilu->nz;
+  old   = ilu->val[0];
+  cur   = ilu->val[1];
+#if defined(PETSC_HAVE_OPENMP)
+  nt    = a->threads.nthreads;
+#endif
+
+  /* initial guess L = tril(A) diag(A)^{-1}, U = triu(A) */
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+  for (p=0; p<nz; p++) {
+    const PetscInt i = ilu->frow[p],j = bj[p];
+
+    if (ilu->apos[p] < 0) old[p] = 0.0;
+    else if (i > j && aa[adiag[j]] != (MatScalar)0.0) old[p] = aa[ilu->apos[p]]/aa[adiag[j]];
+    else old[p] = aa[ilu->apos[p]];
+  }
+
+  for (s=0; s<ilu->sweeps; s++) {
+    sflops = 0;
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) reduction(+:sflops)
+#endif
+    for (p=0; p<nz; p++) sflops += PCChowILUSweep_Private(ilu,aa,bi,bj,bdiag,p,old,cur);
+    flops += sflops;
+    tmp = old; old = cur; cur = tmp;
+  }
+
+  /* the factor stores the inverse of the diagonal of U */
+  ierr = PetscArraycpy(b->a,old,nz);CHKERRQ(ierr);
+  for (i=0; i<n; i++) {
+    if (old[bdiag[i]] == (MatScalar)0.0) nzeropivot++;
+    else b->a[bdiag[i]] = 1.0/old[bdiag[i]];
+  }
+  ierr = PetscLogFlops(flops+n);CHKERRQ(ierr);
+  if (nzeropivot) {
+    ierr = PetscInfo1(pc,"Computed factor has %D zero pivots\n",nzeropivot);CHKERRQ(ierr);
+    ilu->fact->factorerrortype = MAT_FACTOR_NUMERIC_ZEROPIVOT;
+    pc->failedreason           = PC_FACTOR_NUMERIC_ZEROPIVOT;
+  } else ilu->fact->factorerrortype = MAT_FACTOR_NOERROR;
+
+  ilu->fact->ops->solve = MatSolve_SeqAIJ_NaturalOrdering;
+  ilu->fact->assembled  = PETSC_TRUE;
+  ilu->fact->preallocated = PETSC_TRUE;
+  if (!ilu->solveits) {
+    ierr = MatSeqAIJSetUpLevels_LU(ilu->fact,pc->pmat);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PCDestroy_ChowILU(PC pc)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PCReset_ChowILU(pc);CHKERRQ(ierr);
+  ierr = PetscFree(pc->data);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PCSetFromOptions_ChowILU(PetscOptionItems *PetscOptionsObject,PC pc)
+{
+  PC_ChowILU     *ilu = (PC_ChowILU*)pc->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscOptionsHead(PetscOptionsObject,"Chow-Patel ILU options");CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-pc_chowilu_levels","levels of fill of the symbolic factorization","None",ilu->levels,&ilu->levels,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-pc_chowilu_sweeps","number of sweeps of the factorization","None",ilu->sweeps,&ilu->sweeps,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-pc_chowilu_solve_iterations","Jacobi iterations for each triangular solve, 0 for exact triangular solves","None",ilu->solveits,&ilu->solveits,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsTail();CHKERRQ(ierr);
+  if (ilu->levels < 0) SETERRQ1(PetscObjectComm((PetscObject)pc),PETSC_ERR_ARG_OUTOFRANGE,"Levels of fill %D must be nonnegative",ilu->levels);
+  if (ilu->sweeps < 0) SETERRQ1(PetscObjectComm((PetscObject)pc),PETSC_ERR_ARG_OUTOFRANGE,"Number of sweeps %D must be nonnegative",ilu->sweeps);
+  if (ilu->solveits < 0) SETERRQ1(PetscObjectComm((PetscObject)pc),PETSC_ERR_ARG_OUTOFRANGE,"Number of solve iterations %D must be nonnegative",ilu->solveits);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PCView_ChowILU(PC pc,PetscViewer viewer)
+{
+  PC_ChowILU     *ilu = (PC_ChowILU*)pc->data;
+  PetscErrorCode ierr;
+  PetscBool      iascii;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&iascii);CHKERRQ(ierr);
+  if (iascii) {
+    ierr = PetscViewerASCIIPrintf(viewer,"  %D levels of fill, %D sweeps\n",ilu->levels,ilu->sweeps);CHKERRQ(ierr);
+    if (ilu->solveits) {
+      ierr = PetscViewerASCIIPrintf(viewer,"  %D Jacobi iterations for each triangular solve\n",ilu->solveits);CHKERRQ(ierr);
+    } else {
+      ierr = PetscViewerASCIIPrintf(viewer,"  exact triangular solves\n");CHKERRQ(ierr);
+    }
+  }
+  PetscFunctionReturn(0);
+}
+
+/*MC
+     PCCHOWILU - Fine-grained iterative incomplete LU factorization of Chow and Patel for MATSEQAIJ matrices
+
+   Options Database Keys:
++  -pc_chowilu_levels <0> - levels of fill of the symbolic factorization
+.  -pc_chowilu_sweeps <3> - number of sweeps of the fixed-point iteration that computes the factors
+-  -pc_chowilu_solve_iterations <2> - number of Jacobi iterations used for each triangular solve, 0 for exact triangular solves
+
+   Level: intermediate
+
+   Notes:
+    The nonzero pattern of the factors is that of PCILU with the natural ordering. Starting from L = tril(A) diag(A)^{-1}
+    and U = triu(A), each sweep recomputes every nonzero of the factors from the values of the previous sweep, so the
+    nonzeros can be computed concurrently. With enough sweeps the factors converge to those computed by PCILU.
+
+    The sweeps and the Jacobi triangular solves are threaded with OpenMP using the number of threads of the matrix,
+    see MatSeqAIJSetNumThreads() and -mat_seqaij_num_threads. Exact triangular solves are level scheduled in that case.
+
+    In parallel use it as the subdomain solver of PCBJACOBI or PCASM, for example -sub_pc_type chowilu.
+
+   References:
+.  1. - E. Chow and A. Patel, "Fine-grained parallel incomplete LU factorization", SIAM J. Sci. Comput., 37(2), 2015.
+
+.seealso:  PCCreate(), PCSetType(), PCType (for list of available types), PC, PCILU, PCCHOWILUVIENNACL, MatSeqAIJSetNumThreads()
+
+M*/
+
+PETSC_EXTERN PetscErrorCode PCCreate_ChowILU(PC pc)
+{
+  PetscErrorCode ierr;
+  PC_ChowILU     *ilu;
+
+  PetscFunctionBegin;
+  ierr = PetscNewLog(pc,&ilu);CHKERRQ(ierr);
+
+  pc->ops->apply           = PCApply_ChowILU;
+  pc->ops->setup           = PCSetUp_ChowILU;
+  pc->ops->reset           = PCReset_ChowILU;
+  pc->ops->setfromoptions  = PCSetFromOptions_ChowILU;
+  pc->ops->view            = PCView_ChowILU;
+  pc->ops->destroy         = PCDestroy_ChowILU;
+  pc->data                 = (void*)ilu;
+  ilu->levels              = 0;
+  ilu->sweeps              = 3;
+  ilu->solveits            = 2;
+  PetscFunctionReturn(0);
+}
@@ -182,6 +182,7 @@ static PetscErrorCode PCSetCoordinates_AGG(PC pc, PetscInt ndm, PetscInt a_nloc,
   PetscValidHeaderSpecific(pc,PC_CLASSID,1);
   PetscValidHeaderSpecific(mat,MAT_CLASSID,1);
   nloc = a_nloc;
+  ierr = PCGAMGSetCoordinates_Private(pc, ndm, a_nloc, coords);CHKERRQ(ierr);
 
   /* SA: null space vectors */
   ierr = MatGetBlockSize(mat, &ndf);CHKERRQ(ierr); /* this does not work for Stokes */
@@ -242,6 +243,80 @@ static const NState DELETED =-1;
 static const NState REMOVED =-3;
 #define IS_SELECTED(s) (s!=DELETED && s!=NOT_DONE && s!=REMOVED)
 
+/*
+   smoothAggsSteal_Private - selected vertex lid takes its local neighbor lidj from the aggregate of sgid
+*/
+static PetscErrorCode smoothAggsSteal_Private(PC pc,PetscCoarsenData *aggs_2,PetscInt lid,PetscInt lidj,PetscInt sgid,PetscInt my0,PetscInt Iend)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (sgid >= my0 && sgid < Iend) {       /* I'm stealing this local from a local sgid */
+    PetscInt     hav=0,slid=sgid-my0,gidj=lidj+my0;
+    PetscCDIntNd *pos,*last=NULL;
+    /* looking for local from local so id_llist_2 works */
+    ierr = PetscCDGetHeadPos(aggs_2,slid,&pos);CHKERRQ(ierr);
+    while (pos) {
+      PetscInt gid;
+      ierr = PetscCDIntNdGetID(pos, &gid);CHKERRQ(ierr);
+      if (gid == gidj) {
+        if (!last) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"last cannot be null");
+        ierr = PetscCDRemoveNextNode(aggs_2, slid, last);CHKERRQ(ierr);
+        ierr = PetscCDAppendNode(aggs_2, lid, pos);CHKERRQ(ierr);
+        hav  = 1;
+        break;
+      } else last = pos;
+
+      ierr = PetscCDGetNextPos(aggs_2,slid,&pos);CHKERRQ(ierr);
+    }
+    if (hav!=1) {
+      if (!hav) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"failed to find adj in 'selected' lists - structurally unsymmetric matrix");
+      SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"found node %D times???",hav);
+    }
+  } else {            /* I'm stealing this local, owned by a ghost */
+    if (sgid != -1) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Mat has an un-symmetric graph. Use '-%spc_gamg_sym_graph true' to symmetrize the graph or '-%spc_gamg_threshold -1' if the matrix is structurally symmetric.",((PetscObject)pc)->prefix ? ((PetscObject)pc)->prefix : "",((PetscObject)pc)->prefix ? ((PetscObject)pc)->prefix : "");
+    ierr = PetscCDAppendID(aggs_2, lid, lidj+my0);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/*
+   smoothAggsRemove_Private - deleted vertex lid, taken by a selected ghost, leaves the aggregate of sgidold
+*/
+static PetscErrorCode smoothAggsRemove_Private(PetscCoarsenData *aggs_2,PetscInt lid,PetscInt sgidold,PetscInt my0,PetscInt Iend)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (sgidold>=my0 && sgidold<Iend) { /* this was mine */
+    PetscInt     hav=0,oldslidj=sgidold-my0;
+    PetscCDIntNd *pos,*last=NULL;
+    /* remove from 'oldslidj' list */
+    ierr = PetscCDGetHeadPos(aggs_2,oldslidj,&pos);CHKERRQ(ierr);
+    while (pos) {
+      PetscInt gid;
+      ierr = PetscCDIntNdGetID(pos, &gid);CHKERRQ(ierr);
+      if (lid+my0 == gid) {
+        /* id_llist_2[lastid] = id_llist_2[flid];   /\* remove lid from oldslidj list *\/ */
+        if (!last) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"last cannot be null");
+        ierr = PetscCDRemoveNextNode(aggs_2, oldslidj, last);CHKERRQ(ierr);
+        /* ghost (PetscScalar)statej will add this later */
+        hav = 1;
+        break;
+      } else last = pos;
+
+      ierr = PetscCDGetNextPos(aggs_2,oldslidj,&pos);CHKERRQ(ierr);
+    }
+    if (hav!=1) {
+      if (!hav) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"failed to find adj in 'selected' lists - structurally unsymmetric matrix");
+      SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"found node %D times???",hav);
+    }
+  } else {
+    /* ghosts remove this later */
+  }
+  PetscFunctionReturn(0);
+}
+
 /* -------------------------------------------------------------------------- */
 /*
    smoothAggs - greedy grab of with G1 (unsquared graph) -- AIJ specific
@@ -259,7 +334,7 @@ static PetscErrorCode smoothAggs(PC pc,Mat Gmat_2, Mat Gmat_1,PetscCoarsenData *
   PetscBool      isMPI;
   Mat_SeqAIJ     *matA_1, *matB_1=0;
   MPI_Comm       comm;
-  PetscInt       lid,*ii,*idx,ix,Iend,my0,kk,n,j;
+  PetscInt       lid,*ii,*idx,ix,Iend,my0,kk,n,j,nt,*lid_new_gid;
   Mat_MPIAIJ     *mpimat_2 = 0, *mpimat_1=0;
   const PetscInt nloc      = Gmat_2->rmap->n;
   PetscScalar    *cpcol_1_state,*cpcol_2_state,*cpcol_2_par_orig,*lid_parent_gid;
@@ -368,87 +443,85 @@ static PetscErrorCode smoothAggs(PC pc,Mat Gmat_2, Mat Gmat_1,PetscCoarsenData *
   } /* ismpi */
 
   /* doit */
-  for (lid=0; lid<nloc; lid++) {
-    NState state = lid_state[lid];
-    if (IS_SELECTED(state)) {
-      /* steal locals */
-      ii  = matA_1->i; n = ii[lid+1] - ii[lid];
-      idx = matA_1->j + ii[lid];
-      for (j=0; j<n; j++) {
-        PetscInt lidj   = idx[j], sgid;
-        NState   statej = lid_state[lidj];
-        if (statej==DELETED && (sgid=(PetscInt)PetscRealPart(lid_parent_gid[lidj])) != lid+my0) { /* steal local */
-          lid_parent_gid[lidj] = (PetscScalar)(lid+my0); /* send this if sgid is not local */
-          if (sgid >= my0 && sgid < Iend) {       /* I'm stealing this local from a local sgid */
-            PetscInt     hav=0,slid=sgid-my0,gidj=lidj+my0;
-            PetscCDIntNd *pos,*last=NULL;
-            /* looking for local from local so id_llist_2 works */
-            ierr = PetscCDGetHeadPos(aggs_2,slid,&pos);CHKERRQ(ierr);
-            while (pos) {
-              PetscInt gid;
-              ierr = PetscCDIntNdGetID(pos, &gid);CHKERRQ(ierr);
-              if (gid == gidj) {
-                if (!last) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"last cannot be null");
-                ierr = PetscCDRemoveNextNode(aggs_2, slid, last);CHKERRQ(ierr);
-                ierr = PetscCDAppendNode(aggs_2, lid, pos);CHKERRQ(ierr);
-                hav  = 1;
-                break;
-              } else last = pos;
-
-              ierr = PetscCDGetNextPos(aggs_2,slid,&pos);CHKERRQ(ierr);
-            }
-            if (hav!=1) {
-              if (!hav) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"failed to find adj in 'selected' lists - structurally unsymmetric matrix");
-              SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"found node %D times???",hav);
-            }
-          } else {            /* I'm stealing this local, owned by a ghost */
-            if (sgid != -1) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Mat has an un-symmetric graph. Use '-%spc_gamg_sym_graph true' to symmetrize the graph or '-%spc_gamg_threshold -1' if the matrix is structurally symmetric.",((PetscObject)pc)->prefix ? ((PetscObject)pc)->prefix : "",((PetscObject)pc)->prefix ? ((PetscObject)pc)->prefix : "");
-            ierr = PetscCDAppendID(aggs_2, lid, lidj+my0);CHKERRQ(ierr);
+  ierr = PCGAMGGetGraphNumThreads(Gmat_1,&nt);CHKERRQ(ierr);
+  if (nt > 1) {
+    /*
+       The aggregates of the squared graph leave each deleted vertex with at most one selected neighbor, so the threads
+       find, for each deleted vertex, the selected neighbor (local, or else ghost) that takes it. The lists are then
+       updated in the order of the serial loop.
+    */
+    ierr = PetscMalloc1(nloc, &lid_new_gid);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) private(j,ix)
+#endif
+    for (lid=0; lid<nloc; lid++) {
+      PetscInt sgidold = (PetscInt)PetscRealPart(lid_parent_gid[lid]),sgid = -1;
+
+      if (lid_state[lid] == DELETED) {
+        for (j=matA_1->i[lid]; j<matA_1->i[lid+1]; j++) {
+          if (IS_SELECTED(lid_state[matA_1->j[j]])) sgid = matA_1->j[j]+my0;
+        }
+        if (sgid == -1 && lid_cprowID_1 && (ix=lid_cprowID_1[lid]) != -1) {
+          for (j=matB_1->compressedrow.i[ix]; j<matB_1->compressedrow.i[ix+1]; j++) {
+            NState statej = (NState)PetscRealPart(cpcol_1_state[matB_1->j[j]]);
+            if (IS_SELECTED(statej) && sgidold != (PetscInt)statej) {sgid = (PetscInt)statej; break;}
           }
         }
-      } /* local neighbors */
-    } else if (state == DELETED && lid_cprowID_1) {
-      PetscInt sgidold = (PetscInt)PetscRealPart(lid_parent_gid[lid]);
-      /* see if I have a selected ghost neighbor that will steal me */
-      if ((ix=lid_cprowID_1[lid]) != -1) {
-        ii  = matB_1->compressedrow.i; n = ii[ix+1] - ii[ix];
-        idx = matB_1->j + ii[ix];
+        if (sgid == sgidold) sgid = -1;
+      }
+      lid_new_gid[lid] = sgid;
+    }
+    for (lid=0; lid<nloc; lid++) {
+      NState state = lid_state[lid];
+      if (IS_SELECTED(state)) {
+        for (j=matA_1->i[lid]; j<matA_1->i[lid+1]; j++) {
+          PetscInt lidj = matA_1->j[j], sgid;
+          if (lid_state[lidj] == DELETED && lid_new_gid[lidj] == lid+my0) {
+            sgid                 = (PetscInt)PetscRealPart(lid_parent_gid[lidj]);
+            lid_parent_gid[lidj] = (PetscScalar)(lid+my0);
+            ierr = smoothAggsSteal_Private(pc,aggs_2,lid,lidj,sgid,my0,Iend);CHKERRQ(ierr);
+          }
+        }
+      } else if (state == DELETED && lid_new_gid[lid] != -1 && (lid_new_gid[lid] < my0 || lid_new_gid[lid] >= Iend)) {
+        PetscInt sgidold = (PetscInt)PetscRealPart(lid_parent_gid[lid]);
+        lid_parent_gid[lid] = (PetscScalar)lid_new_gid[lid];
+        ierr = smoothAggsRemove_Private(aggs_2,lid,sgidold,my0,Iend);CHKERRQ(ierr);
+      }
+    }
+    ierr = PetscFree(lid_new_gid);CHKERRQ(ierr);
+  } else {
+    for (lid=0; lid<nloc; lid++) {
+      NState state = lid_state[lid];
+      if (IS_SELECTED(state)) {
+        /* steal locals */
+        ii  = matA_1->i; n = ii[lid+1] - ii[lid];
+        idx = matA_1->j + ii[lid];
         for (j=0; j<n; j++) {
-          PetscInt cpid   = idx[j];
-          NState   statej = (NState)PetscRealPart(cpcol_1_state[cpid]);
-          if (IS_SELECTED(statej) && sgidold != (PetscInt)statej) { /* ghost will steal this, remove from my list */
-            lid_parent_gid[lid] = (PetscScalar)statej; /* send who selected */
-            if (sgidold>=my0 && sgidold<Iend) { /* this was mine */
-              PetscInt     hav=0,oldslidj=sgidold-my0;
-              PetscCDIntNd *pos,*last=NULL;
-              /* remove from 'oldslidj' list */
-              ierr = PetscCDGetHeadPos(aggs_2,oldslidj,&pos);CHKERRQ(ierr);
-              while (pos) {
-                PetscInt gid;
-                ierr = PetscCDIntNdGetID(pos, &gid);CHKERRQ(ierr);
-                if (lid+my0 == gid) {
-                  /* id_llist_2[lastid] = id_llist_2[flid];   /\* remove lid from oldslidj list *\/ */
-                  if (!last) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"last cannot be null");
-                  ierr = PetscCDRemoveNextNode(aggs_2, oldslidj, last);CHKERRQ(ierr);
-                  /* ghost (PetscScalar)statej will add this later */
-                  hav = 1;
-                  break;
-                } else last = pos;
-
-                ierr = PetscCDGetNextPos(aggs_2,oldslidj,&pos);CHKERRQ(ierr);
-              }
-              if (hav!=1) {
-                if (!hav) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"failed to find adj in 'selected' lists - structurally unsymmetric matrix");
-                SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"found node %D times???",hav);
-              }
-            } else {
-              /* ghosts remove this later */
+          PetscInt lidj   = idx[j], sgid;
+          NState   statej = lid_state[lidj];
+          if (statej==DELETED && (sgid=(PetscInt)PetscRealPart(lid_parent_gid[lidj])) != lid+my0) { /* steal local */
+            lid_parent_gid[lidj] = (PetscScalar)(lid+my0); /* send this if sgid is not local */
+            ierr = smoothAggsSteal_Private(pc,aggs_2,lid,lidj,sgid,my0,Iend);CHKERRQ(ierr);
+          }
+        } /* local neighbors */
+      } else if (state == DELETED && lid_cprowID_1) {
+        PetscInt sgidold = (PetscInt)PetscRealPart(lid_parent_gid[lid]);
+        /* see if I have a selected ghost neighbor that will steal me */
+        if ((ix=lid_cprowID_1[lid]) != -1) {
+          ii  = matB_1->compressedrow.i; n = ii[ix+1] - ii[ix];
+          idx = matB_1->j + ii[ix];
+          for (j=0; j<n; j++) {
+            PetscInt cpid   = idx[j];
+            NState   statej = (NState)PetscRealPart(cpcol_1_state[cpid]);
+            if (IS_SELECTED(statej) && sgidold != (PetscInt)statej) { /* ghost will steal this, remove from my list */
+              lid_parent_gid[lid] = (PetscScalar)statej; /* send who selected */
+              ierr = smoothAggsRemove_Private(aggs_2,lid,sgidold,my0,Iend);CHKERRQ(ierr);
             }
           }
         }
-      }
-    } /* selected/deleted */
-  } /* node loop */
+      } /* selected/deleted */
+    } /* node loop */
+  }
 
   if (isMPI) {
     PetscScalar     *cpcol_2_parent,*cpcol_2_gid;
@@ -852,7 +925,7 @@ static PetscErrorCode PCGAMGCoarsen_AGG(PC a_pc,Mat *a_Gmat1,PetscCoarsenData **
   PC_GAMG_AGG    *pc_gamg_agg = (PC_GAMG_AGG*)pc_gamg->subctx;
   Mat            mat,Gmat2, Gmat1 = *a_Gmat1;  /* squared graph */
   IS             perm;
-  PetscInt       Istart,Iend,Ii,nloc,bs,n,m;
+  PetscInt       Istart,Iend,Ii,nloc,bs,n,m,nt;
   PetscInt       *permute;
   PetscBool      *bIndexSet;
   MatCoarsen     crs;
@@ -874,6 +947,9 @@ static PetscErrorCode PCGAMGCoarsen_AGG(PC a_pc,Mat *a_Gmat1,PetscCoarsenData **
   if (pc_gamg->current_level < pc_gamg_agg->square_graph) {
     ierr = PetscInfo2(a_pc,"Square Graph on level %D of %D to square\n",pc_gamg->current_level+1,pc_gamg_agg->square_graph);CHKERRQ(ierr);
     ierr = MatTransposeMatMult(Gmat1, Gmat1, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &Gmat2);CHKERRQ(ierr);
+    /* the coarsener uses the threads of the squared graph */
+    ierr = PCGAMGGetGraphNumThreads(Gmat1, &nt);CHKERRQ(ierr);
+    ierr = PCGAMGSetGraphNumThreads(Gmat2, nt);CHKERRQ(ierr);
   } else Gmat2 = Gmat1;
 
   /* get MIS aggs - randomize */
@@ -961,6 +1037,7 @@ static PetscErrorCode PCGAMGProlongator_AGG(PC pc,Mat Amat,Mat Gmat,PetscCoarsen
   PetscReal      *data_w_ghost;
   PetscInt       myCrs0, nbnodes=0, *flid_fgid;
   MatType        mtype;
+  PetscBool      isbaij;
 
   PetscFunctionBegin;
   ierr = PetscObjectGetComm((PetscObject)Amat,&comm);CHKERRQ(ierr);
@@ -981,8 +1058,12 @@ static PetscErrorCode PCGAMGProlongator_AGG(PC pc,Mat Amat,Mat Gmat,PetscCoarsen
     if (!ise) nLocalSelected++;
   }
 
-  /* create prolongator, create P matrix */
-  ierr = MatGetType(Amat,&mtype);CHKERRQ(ierr);
+  /* create prolongator, create P matrix; it is AIJ for BAIJ matrices since its blocks bs x col_bs are not square */
+  ierr = PetscObjectTypeCompareAny((PetscObject)Amat,&isbaij,MATSEQBAIJ,MATMPIBAIJ,"");CHKERRQ(ierr);
+  if (isbaij) mtype = MATAIJ;
+  else {
+    ierr = MatGetType(Amat,&mtype);CHKERRQ(ierr);
+  }
   ierr = MatCreate(comm, &Prol);CHKERRQ(ierr);
   ierr = MatSetSizes(Prol,nloc*bs,nLocalSelected*col_bs,PETSC_DETERMINE,PETSC_DETERMINE);CHKERRQ(ierr);
   ierr = MatSetBlockSizes(Prol, bs, col_bs);CHKERRQ(ierr);
@@ -39,6 +39,15 @@ PetscErrorCode PCReset_GAMG(PC pc)
   ierr = PetscFree(pc_gamg->data);CHKERRQ(ierr);
   pc_gamg->data_sz = 0;
   ierr = PetscFree(pc_gamg->orig_data);CHKERRQ(ierr);
+  ierr = PetscFree(pc_gamg->coords);CHKERRQ(ierr);
+  pc_gamg->coords_dim  = 0;
+  pc_gamg->coords_nloc = 0;
+  for (level = 1; level < pc_gamg->load_nlevels; level++) {
+    ierr = MatDestroy(&pc_gamg->load_P[level]);CHKERRQ(ierr);
+    ierr = MatDestroy(&pc_gamg->load_A[level]);CHKERRQ(ierr);
+  }
+  ierr = PetscFree2(pc_gamg->load_P,pc_gamg->load_A);CHKERRQ(ierr);
+  pc_gamg->load_nlevels = 0;
   for (level = 0; level < PETSC_MG_MAXLEVELS ; level++) {
     mg->min_eigen_DinvA[level] = 0;
     mg->max_eigen_DinvA[level] = 0;
@@ -48,6 +57,219 @@ PetscErrorCode PCReset_GAMG(PC pc)
   PetscFunctionReturn(0);
 }
 
+/* -------------------------------------------------------------------------- */
+/*
+   PCGAMGSetCoordinates_Private - keep a copy of the coordinates of the fine grid vertices for the space
+     filling curve repartitioning of the coarse grids, see PCGAMGSetRepartitionSFC()
+
+   Input Parameter:
+   . pc - the preconditioner context
+   . ndm - dimension of the coordinates
+   . a_nloc - number of local vertices, or of local equations if the coordinates are blocked
+   . coords - [a_nloc][ndm] - interleaved coordinate data
+*/
+PetscErrorCode PCGAMGSetCoordinates_Private(PC pc,PetscInt ndm,PetscInt a_nloc,const PetscReal coords[])
+{
+  PC_MG          *mg      = (PC_MG*)pc->data;
+  PC_GAMG        *pc_gamg = (PC_GAMG*)mg->innerctx;
+  PetscErrorCode ierr;
+  PetscInt       bs,my0,Iend,nloc,kk,ii,stride;
+
+  PetscFunctionBegin;
+  ierr = PetscFree(pc_gamg->coords);CHKERRQ(ierr);
+  pc_gamg->coords_dim  = 0;
+  pc_gamg->coords_nloc = 0;
+  if (ndm < 1 || (!coords && a_nloc)) PetscFunctionReturn(0);
+  ierr = MatGetBlockSize(pc->pmat, &bs);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(pc->pmat, &my0, &Iend);CHKERRQ(ierr);
+  nloc = (Iend-my0)/bs;
+  if (a_nloc == nloc) stride = 1;
+  else if (a_nloc == Iend-my0) stride = bs; /* assumes the coordinates are blocked */
+  else PetscFunctionReturn(0);
+  ierr = PetscMalloc1(nloc*ndm, &pc_gamg->coords);CHKERRQ(ierr);
+  for (kk=0; kk<nloc; kk++) {
+    for (ii=0; ii<ndm; ii++) pc_gamg->coords[kk*ndm + ii] = coords[stride*kk*ndm + ii];
+  }
+  pc_gamg->coords_dim  = ndm;
+  pc_gamg->coords_nloc = nloc;
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCGAMGCoarsenCoordinates_Private - replace the coordinates of the fine vertices by those of the coarse
+     vertices, the averages of the fine coordinates weighted by the magnitude of the first row of each block
+     row of the prolongator
+
+   Input Parameter:
+   . P - prolongator, before any repartitioning
+   . f_bs - fine block size
+   . cr_bs - coarse block size
+   In/Output Parameter:
+   . a_coords - coordinates, with the block size of the dimension
+*/
+static PetscErrorCode PCGAMGCoarsenCoordinates_Private(Mat P,PetscInt f_bs,PetscInt cr_bs,Vec *a_coords)
+{
+  PetscErrorCode    ierr;
+  Vec               acc,crd;
+  MPI_Comm          comm;
+  PetscInt          dim,Istart,Iend,cstart,cend,ncrs,ncols,row,node,cnode,jj,kk;
+  const PetscInt    *idx;
+  const PetscScalar *vals,*xf,*xa;
+  PetscScalar       *w,*xc;
+  PetscReal         wt;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)P,&comm);CHKERRQ(ierr);
+  ierr = VecGetBlockSize(*a_coords,&dim);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(P,&Istart,&Iend);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRangeColumn(P,&cstart,&cend);CHKERRQ(ierr);
+  ncrs = (cend-cstart)/cr_bs;
+  /* sums of w_ij x_i and w_ij for each coarse vertex j */
+  ierr = VecCreate(comm,&acc);CHKERRQ(ierr);
+  ierr = VecSetSizes(acc,ncrs*(dim+1),PETSC_DECIDE);CHKERRQ(ierr);
+  ierr = VecSetBlockSize(acc,dim+1);CHKERRQ(ierr);
+  ierr = VecSetType(acc,VECSTANDARD);CHKERRQ(ierr);
+  ierr = PetscMalloc1(dim+1,&w);CHKERRQ(ierr);
+  ierr = VecGetArrayRead(*a_coords,&xf);CHKERRQ(ierr);
+  for (row=Istart; row<Iend; row+=f_bs) {
+    node = (row-Istart)/f_bs;
+    ierr = MatGetRow(P,row,&ncols,&idx,&vals);CHKERRQ(ierr);
+    for (jj=0; jj<ncols;) {
+      cnode = idx[jj]/cr_bs;
+      for (wt=0.0; jj<ncols && idx[jj]/cr_bs == cnode; jj++) wt += PetscAbsScalar(vals[jj]);
+      if (wt == 0.0) continue;
+      for (kk=0; kk<dim; kk++) w[kk] = wt*xf[node*dim+kk];
+      w[dim] = wt;
+      ierr = VecSetValuesBlocked(acc,1,&cnode,w,ADD_VALUES);CHKERRQ(ierr);
+    }
+    ierr = MatRestoreRow(P,row,&ncols,&idx,&vals);CHKERRQ(ierr);
+  }
+  ierr = VecRestoreArrayRead(*a_coords,&xf);CHKERRQ(ierr);
+  ierr = PetscFree(w);CHKERRQ(ierr);
+  ierr = VecAssemblyBegin(acc);CHKERRQ(ierr);
+  ierr = VecAssemblyEnd(acc);CHKERRQ(ierr);
+
+  ierr = VecCreate(comm,&crd);CHKERRQ(ierr);
+  ierr = VecSetSizes(crd,ncrs*dim,PETSC_DECIDE);CHKERRQ(ierr);
+  ierr = VecSetBlockSize(crd,dim);CHKERRQ(ierr);
+  ierr = VecSetType(crd,VECSTANDARD);CHKERRQ(ierr);
+  ierr = VecGetArrayRead(acc,&xa);CHKERRQ(ierr);
+  ierr = VecGetArray(crd,&xc);CHKERRQ(ierr);
+  for (cnode=0; cnode<ncrs; cnode++) {
+    wt = PetscRealPart(xa[cnode*(dim+1)+dim]);
+    for (kk=0; kk<dim; kk++) xc[cnode*dim+kk] = wt > 0.0 ? xa[cnode*(dim+1)+kk]/wt : 0.0;
+  }
+  ierr = VecRestoreArray(crd,&xc);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(acc,&xa);CHKERRQ(ierr);
+  ierr = VecDestroy(&acc);CHKERRQ(ierr);
+  ierr = VecDestroy(a_coords);CHKERRQ(ierr);
+  *a_coords = crd;
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCGAMGHilbertKey_Private - index of a point of the integer grid [0,2^nbits)^dim along the Hilbert curve,
+     with Skilling's transposition of the axes (J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, 2004)
+*/
+static PetscInt PCGAMGHilbertKey_Private(PetscInt dim,PetscInt nbits,unsigned int X[])
+{
+  unsigned int M = 1U << (nbits-1),P,Q,t;
+  PetscInt     i,b,key = 0;
+
+  /* inverse undo excess work */
+  for (Q=M; Q>1; Q>>=1) {
+    P = Q-1;
+    for (i=0; i<dim; i++) {
+      if (X[i] & Q) X[0] ^= P;
+      else {
+        t = (X[0] ^ X[i]) & P; X[0] ^= t; X[i] ^= t;
+      }
+    }
+  }
+  /* Gray encode */
+  for (i=1; i<dim; i++) X[i] ^= X[i-1];
+  t = 0;
+  for (Q=M; Q>1; Q>>=1) if (X[dim-1] & Q) t ^= Q-1;
+  for (i=0; i<dim; i++) X[i] ^= t;
+  /* interleave the bits of the transposed axes, most significant first */
+  for (b=nbits-1; b>=0; b--) {
+    for (i=0; i<dim; i++) key = (key << 1) | (PetscInt)((X[i] >> b) & 1U);
+  }
+  return key;
+}
+
+/*
+   PCGAMGPartitionSFC_Private - split the vertices in 'nparts' pieces of consecutive vertices along the Hilbert
+     curve through their coordinates, with a parallel sort of the keys of the vertices
+
+   Input Parameter:
+   . coords - coordinates of the vertices, with the block size of the dimension
+   . nparts - number of parts
+   Output Parameter:
+   . part - [nloc] part of each local vertex
+*/
+static PetscErrorCode PCGAMGPartitionSFC_Private(Vec coords,PetscMPIInt nparts,PetscInt part[])
+{
+  PetscErrorCode    ierr;
+  MPI_Comm          comm;
+  PetscLayout       map;
+  PetscInt          dim,sdim,nbits,nloc,ii,kk,lo,hi,mid,*keys,*sorted,*lsplit,*gsplit;
+  PetscInt64        pos;
+  PetscReal         lbnd[6],gbnd[6],h = 0.0,scale;
+  const PetscScalar *x;
+  unsigned int      X[3];
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)coords,&comm);CHKERRQ(ierr);
+  ierr = VecGetBlockSize(coords,&dim);CHKERRQ(ierr);
+  ierr = VecGetLocalSize(coords,&nloc);CHKERRQ(ierr);
+  nloc /= dim;
+  sdim  = PetscMin(dim,3);
+  nbits = PetscMin((PetscInt)(8*sizeof(PetscInt)-1)/sdim,31);
+  ierr  = VecGetArrayRead(coords,&x);CHKERRQ(ierr);
+  /* bounding box, as -min and max */
+  for (kk=0; kk<2*sdim; kk++) lbnd[kk] = PETSC_MIN_REAL;
+  for (ii=0; ii<nloc; ii++) {
+    for (kk=0; kk<sdim; kk++) {
+      lbnd[kk]      = PetscMax(lbnd[kk],-PetscRealPart(x[ii*dim+kk]));
+      lbnd[sdim+kk] = PetscMax(lbnd[sdim+kk],PetscRealPart(x[ii*dim+kk]));
+    }
+  }
+  ierr = MPIU_Allreduce(lbnd,gbnd,2*sdim,MPIU_REAL,MPIU_MAX,comm);CHKERRQ(ierr);
+  for (kk=0; kk<sdim; kk++) h = PetscMax(h,gbnd[sdim+kk]+gbnd[kk]);
+  scale = h > 0.0 ? (PetscReal)((((PetscInt64)1) << nbits) - 1)/h : 0.0;
+  ierr  = PetscMalloc4(nloc,&keys,nloc,&sorted,nparts,&lsplit,nparts,&gsplit);CHKERRQ(ierr);
+  for (ii=0; ii<nloc; ii++) {
+    for (kk=0; kk<sdim; kk++) X[kk] = (unsigned int)((PetscRealPart(x[ii*dim+kk])+gbnd[kk])*scale);
+    keys[ii] = PCGAMGHilbertKey_Private(sdim,nbits,X);
+  }
+  ierr = VecRestoreArrayRead(coords,&x);CHKERRQ(ierr);
+
+  ierr = PetscLayoutCreate(comm,&map);CHKERRQ(ierr);
+  ierr = PetscLayoutSetLocalSize(map,nloc);CHKERRQ(ierr);
+  ierr = PetscLayoutSetBlockSize(map,1);CHKERRQ(ierr);
+  ierr = PetscLayoutSetUp(map);CHKERRQ(ierr);
+  ierr = PetscParallelSortInt(map,map,keys,sorted);CHKERRQ(ierr);
+  /* the first key of each part, but the first, from the process that owns it */
+  for (kk=1; kk<nparts; kk++) {
+    pos          = ((PetscInt64)map->N*kk)/nparts;
+    lsplit[kk-1] = (pos >= map->rstart && pos < map->rend) ? sorted[pos-map->rstart] : PETSC_MIN_INT;
+  }
+  ierr = MPIU_Allreduce(lsplit,gsplit,nparts-1,MPIU_INT,MPI_MAX,comm);CHKERRQ(ierr);
+  ierr = PetscLayoutDestroy(&map);CHKERRQ(ierr);
+  /* part of a vertex is the number of splitters not larger than its key */
+  for (ii=0; ii<nloc; ii++) {
+    for (lo=0, hi=nparts-1; lo<hi;) {
+      mid = (lo+hi)/2;
+      if (gsplit[mid] <= keys[ii]) lo = mid+1;
+      else hi = mid;
+    }
+    part[ii] = lo;
+  }
+  ierr = PetscFree4(keys,sorted,lsplit,gsplit);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 /* -------------------------------------------------------------------------- */
 /*
    PCGAMGCreateLevel_GAMG: create coarse op with RAP.  repartition and/or reduce number
@@ -81,6 +303,9 @@ static PetscErrorCode PCGAMGCreateLevel_GAMG(PC pc,Mat Amat_fine,PetscInt cr_bs,
   ierr = MPI_Comm_size(comm, &size);CHKERRQ(ierr);
   ierr = MatGetBlockSize(Amat_fine, &f_bs);CHKERRQ(ierr);
   ierr = MatPtAP(Amat_fine, Pold, MAT_INITIAL_MATRIX, 2.0, &Cmat);CHKERRQ(ierr);
+  if (pc_gamg->crs_coords) {
+    ierr = PCGAMGCoarsenCoordinates_Private(Pold, f_bs, cr_bs, &pc_gamg->crs_coords);CHKERRQ(ierr);
+  }
 
   if (Pcolumnperm) *Pcolumnperm = NULL;
 
@@ -152,7 +377,20 @@ static PetscErrorCode PCGAMGCreateLevel_GAMG(PC pc,Mat Amat_fine,PetscInt cr_bs,
 #endif
     /* make 'is_eq_newproc' */
     ierr = PetscMalloc1(size, &counts);CHKERRQ(ierr);
-    if (pc_gamg->repart) {
+    if (pc_gamg->repart && pc_gamg->crs_coords) {
+      /* Repartition along the space filling curve through the coarse vertices */
+      PetscInt *part;
+      ierr = PetscInfo4(pc,"Repartition with a space filling curve: size (active): %d --> %d, %D local equations, using %s process layout\n",*a_nactive_proc, new_size, ncrs_eq, (pc_gamg->layout_type==PCGAMG_LAYOUT_COMPACT) ? "compact" : "spread");CHKERRQ(ierr);
+      ierr = PetscMalloc2(nloc_old, &part, ncrs_eq, &newproc_idx);CHKERRQ(ierr);
+      ierr = PCGAMGPartitionSFC_Private(pc_gamg->crs_coords, new_size, part);CHKERRQ(ierr);
+      for (kk = jj = 0 ; kk < nloc_old ; kk++) {
+        for (ii = 0 ; ii < cr_bs ; ii++, jj++) {
+          newproc_idx[jj] = part[kk] * expand_factor; /* distribution */
+        }
+      }
+      ierr = ISCreateGeneral(comm, ncrs_eq, newproc_idx, PETSC_COPY_VALUES, &is_eq_newproc);CHKERRQ(ierr);
+      ierr = PetscFree2(part,newproc_idx);CHKERRQ(ierr);
+    } else if (pc_gamg->repart) {
       /* Repartition Cmat_{k} and move colums of P^{k}_{k-1} and coordinates of primal part accordingly */
       Mat      adj;
       ierr = PetscInfo4(pc,"Repartition: size (active): %d --> %d, %D local equations, using %s process layout\n",*a_nactive_proc, new_size, ncrs_eq, (pc_gamg->layout_type==PCGAMG_LAYOUT_COMPACT) ? "compact" : "spread");CHKERRQ(ierr);
@@ -167,7 +405,6 @@ static PetscErrorCode PCGAMGCreateLevel_GAMG(PC pc,Mat Amat_fine,PetscInt cr_bs,
         const PetscInt    *idx;
         PetscInt          *d_nnz, *o_nnz, M, N;
         static PetscInt   llev = 0; /* ugly but just used for debugging */
-        MatType           mtype;
 
         ierr = PetscMalloc2(ncrs, &d_nnz,ncrs, &o_nnz);CHKERRQ(ierr);
         ierr = MatGetOwnershipRange(Cmat, &Istart_crs, &Iend_crs);CHKERRQ(ierr);
@@ -181,10 +418,10 @@ static PetscErrorCode PCGAMGCreateLevel_GAMG(PC pc,Mat Amat_fine,PetscInt cr_bs,
           if (o_nnz[jj] > (M/cr_bs-ncrs)) o_nnz[jj] = M/cr_bs-ncrs;
         }
 
-        ierr = MatGetType(Amat_fine,&mtype);CHKERRQ(ierr);
+        /* the scalar matrix is AIJ whatever the type of the operators, it only gets AIJ preallocation */
         ierr = MatCreate(comm, &tMat);CHKERRQ(ierr);
         ierr = MatSetSizes(tMat, ncrs, ncrs,PETSC_DETERMINE, PETSC_DETERMINE);CHKERRQ(ierr);
-        ierr = MatSetType(tMat,mtype);CHKERRQ(ierr);
+        ierr = MatSetType(tMat,MATAIJ);CHKERRQ(ierr);
         ierr = MatSeqAIJSetPreallocation(tMat,0,d_nnz);CHKERRQ(ierr);
         ierr = MatMPIAIJSetPreallocation(tMat,0,d_nnz,0,o_nnz);CHKERRQ(ierr);
         ierr = PetscFree2(d_nnz,o_nnz);CHKERRQ(ierr);
@@ -357,6 +594,32 @@ static PetscErrorCode PCGAMGCreateLevel_GAMG(PC pc,Mat Amat_fine,PetscInt cr_bs,
       *Pcolumnperm = new_eq_indices;
     }
     ierr = ISDestroy(&is_eq_num);CHKERRQ(ierr);
+    /* move the coordinates of the coarse vertices */
+    if (pc_gamg->crs_coords) {
+      Vec            dest_crd;
+      IS             isscat;
+      VecScatter     vecscat;
+      const PetscInt *idx;
+      PetscInt       dim;
+
+      ierr = VecGetBlockSize(pc_gamg->crs_coords, &dim);CHKERRQ(ierr);
+      ierr = PetscMalloc1(ncrs_new, &tidx);CHKERRQ(ierr);
+      ierr = ISGetIndices(new_eq_indices, &idx);CHKERRQ(ierr);
+      for (ii=0; ii<ncrs_new; ii++) tidx[ii] = idx[ii*cr_bs]/cr_bs;
+      ierr = ISRestoreIndices(new_eq_indices, &idx);CHKERRQ(ierr);
+      ierr = ISCreateBlock(comm, dim, ncrs_new, tidx, PETSC_OWN_POINTER, &isscat);CHKERRQ(ierr);
+      ierr = VecCreate(comm, &dest_crd);CHKERRQ(ierr);
+      ierr = VecSetSizes(dest_crd, dim*ncrs_new, PETSC_DECIDE);CHKERRQ(ierr);
+      ierr = VecSetBlockSize(dest_crd, dim);CHKERRQ(ierr);
+      ierr = VecSetType(dest_crd,VECSTANDARD);CHKERRQ(ierr);
+      ierr = VecScatterCreate(pc_gamg->crs_coords, isscat, dest_crd, NULL, &vecscat);CHKERRQ(ierr);
+      ierr = ISDestroy(&isscat);CHKERRQ(ierr);
+      ierr = VecScatterBegin(vecscat,pc_gamg->crs_coords,dest_crd,INSERT_VALUES,SCATTER_FORWARD);CHKERRQ(ierr);
+      ierr = VecScatterEnd(vecscat,pc_gamg->crs_coords,dest_crd,INSERT_VALUES,SCATTER_FORWARD);CHKERRQ(ierr);
+      ierr = VecScatterDestroy(&vecscat);CHKERRQ(ierr);
+      ierr = VecDestroy(&pc_gamg->crs_coords);CHKERRQ(ierr);
+      pc_gamg->crs_coords = dest_crd;
+    }
 #if defined PETSC_GAMG_USE_LOG
     ierr = PetscLogEventEnd(petsc_gamg_setup_events[SET13],0,0,0,0);CHKERRQ(ierr);
     ierr = PetscLogEventBegin(petsc_gamg_setup_events[SET14],0,0,0,0);CHKERRQ(ierr);
@@ -425,6 +688,46 @@ static PetscErrorCode PCGAMGCreateLevel_GAMG(PC pc,Mat Amat_fine,PetscInt cr_bs,
   PetscFunctionReturn(0);
 }
 
+/*
+   PCGAMGSetUpLoadedLevels_Private - takes the prolongators and the coarse grid operators of a hierarchy read with
+     PCLoad(); with -pc_gamg_load_ptap the coarse grid operators are recomputed from the prolongators
+*/
+static PetscErrorCode PCGAMGSetUpLoadedLevels_Private(PC pc,Mat Pmat,Mat Aarr[],Mat Parr[],PetscInt *a_level,PetscLogDouble *nnz0,PetscLogDouble *nnztot)
+{
+  PetscErrorCode ierr;
+  PC_MG          *mg      = (PC_MG*)pc->data;
+  PC_GAMG        *pc_gamg = (PC_GAMG*)mg->innerctx;
+  MatInfo        info;
+  PetscInt       level,m,n;
+
+  PetscFunctionBegin;
+  ierr    = MatGetInfo(Pmat,MAT_GLOBAL_SUM,&info);CHKERRQ(ierr);
+  *nnz0   = info.nz_used;
+  *nnztot = info.nz_used;
+  Aarr[0] = Pmat;
+  for (level = 1; level < pc_gamg->load_nlevels; level++) {
+    Parr[level] = pc_gamg->load_P[level];
+    pc_gamg->load_P[level] = NULL;
+    ierr = MatGetLocalSize(Aarr[level-1], &m, NULL);CHKERRQ(ierr);
+    ierr = MatGetLocalSize(Parr[level], &n, NULL);CHKERRQ(ierr);
+    if (m != n) SETERRQ3(PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Loaded prolongator of level %D has %D local rows but the operator has %D",level,n,m);
+    if (pc_gamg->load_ptap) {
+      ierr = MatPtAP(Aarr[level-1], Parr[level], MAT_INITIAL_MATRIX, 2.0, &Aarr[level]);CHKERRQ(ierr);
+      ierr = MatDestroy(&pc_gamg->load_A[level]);CHKERRQ(ierr);
+    } else {
+      Aarr[level] = pc_gamg->load_A[level];
+      pc_gamg->load_A[level] = NULL;
+    }
+    ierr     = MatGetInfo(Aarr[level], MAT_GLOBAL_SUM, &info);CHKERRQ(ierr);
+    *nnztot += info.nz_used;
+  }
+  *a_level = pc_gamg->load_nlevels-1;
+  ierr     = PetscInfo2(pc,"Using a hierarchy of %D levels from PCLoad(), %s coarse grid operators\n",pc_gamg->load_nlevels,pc_gamg->load_ptap ? "recomputed" : "loaded");CHKERRQ(ierr);
+  ierr     = PetscFree2(pc_gamg->load_P,pc_gamg->load_A);CHKERRQ(ierr);
+  pc_gamg->load_nlevels = 0;
+  PetscFunctionReturn(0);
+}
+
 /* -------------------------------------------------------------------------- */
 /*
    PCSetUp_GAMG - Prepares for the use of the GAMG preconditioner
@@ -447,7 +750,7 @@ PetscErrorCode PCSetUp_GAMG(PC pc)
   IS             *ASMLocalIDsArr[PETSC_MG_MAXLEVELS];
   PetscLogDouble nnz0=0.,nnztot=0.;
   MatInfo        info;
-  PetscBool      is_last = PETSC_FALSE;
+  PetscBool      is_last = PETSC_FALSE,use_aggs_in_asm = pc_gamg->use_aggs_in_asm;
 
   PetscFunctionBegin;
   ierr = PetscObjectGetComm((PetscObject)pc,&comm);CHKERRQ(ierr);
@@ -493,6 +796,16 @@ PetscErrorCode PCSetUp_GAMG(PC pc)
     }
   }
 
+  if (pc_gamg->load_nlevels) {
+    /* hierarchy from PCLoad(), the graphs, the aggregates and the prolongators are not constructed */
+    ierr = PCGAMGSetUpLoadedLevels_Private(pc,Pmat,Aarr,Parr,&level,&nnz0,&nnztot);CHKERRQ(ierr);
+    if (use_aggs_in_asm) {
+      ierr = PetscInfo(pc,"The aggregates of a loaded hierarchy are not available for PCASM\n");CHKERRQ(ierr);
+      use_aggs_in_asm = PETSC_FALSE;
+    }
+    goto setlevels;
+  }
+
   if (!pc_gamg->data) {
     if (pc_gamg->orig_data) {
       ierr = MatGetBlockSize(Pmat, &bs);CHKERRQ(ierr);
@@ -527,6 +840,28 @@ PetscErrorCode PCSetUp_GAMG(PC pc)
   nnztot = info.nz_used;
   ierr = PetscInfo6(pc,"level %d) N=%D, n data rows=%d, n data cols=%d, nnz/row (ave)=%d, np=%d\n",0,M,pc_gamg->data_cell_rows,pc_gamg->data_cell_cols,(int)(nnz0/(PetscReal)M+0.5),size);CHKERRQ(ierr);
 
+  /* coordinates of the vertices, carried to the coarse grids for the space filling curve repartitioning */
+  if (pc_gamg->repart && pc_gamg->repart_sfc) {
+    PetscInt    ldim[2],gdim[2];
+    PetscScalar *array;
+
+    ierr    = MatGetLocalSize(Pmat, &qq, NULL);CHKERRQ(ierr);
+    ldim[0] = (pc_gamg->coords_dim && pc_gamg->coords_nloc == qq/bs) ? pc_gamg->coords_dim : 0;
+    ldim[1] = -ldim[0];
+    ierr    = MPIU_Allreduce(ldim,gdim,2,MPIU_INT,MPI_MAX,comm);CHKERRQ(ierr);
+    if (gdim[0] > 0 && gdim[0] == -gdim[1]) {
+      ierr = VecCreate(comm, &pc_gamg->crs_coords);CHKERRQ(ierr);
+      ierr = VecSetSizes(pc_gamg->crs_coords, (qq/bs)*gdim[0], PETSC_DECIDE);CHKERRQ(ierr);
+      ierr = VecSetBlockSize(pc_gamg->crs_coords, gdim[0]);CHKERRQ(ierr);
+      ierr = VecSetType(pc_gamg->crs_coords, VECSTANDARD);CHKERRQ(ierr);
+      ierr = VecGetArray(pc_gamg->crs_coords, &array);CHKERRQ(ierr);
+      for (qq=0; qq<pc_gamg->coords_nloc*pc_gamg->coords_dim; qq++) array[qq] = pc_gamg->coords[qq];
+      ierr = VecRestoreArray(pc_gamg->crs_coords, &array);CHKERRQ(ierr);
+    } else {
+      ierr = PetscInfo(pc,"No coordinates for the space filling curve repartitioning, using MatPartitioning\n");CHKERRQ(ierr);
+    }
+  }
+
   /* Get A_i and R_i */
   for (level=0, Aarr[0]=Pmat, nactivepe = size; level < (pc_gamg->Nlevels-1) && (!level || M>pc_gamg->coarse_eq_limit); level++) {
     pc_gamg->current_level = level;
@@ -608,7 +943,9 @@ PetscErrorCode PCSetUp_GAMG(PC pc)
     }
   } /* levels */
   ierr                  = PetscFree(pc_gamg->data);CHKERRQ(ierr);
+  ierr                  = VecDestroy(&pc_gamg->crs_coords);CHKERRQ(ierr);
 
+setlevels:
   ierr = PetscInfo2(pc,"%D levels, grid complexity = %g\n",level+1,nnztot/nnz0);CHKERRQ(ierr);
   pc_gamg->Nlevels = level + 1;
   fine_level       = level;
@@ -632,7 +969,7 @@ PetscErrorCode PCSetUp_GAMG(PC pc)
       ierr = KSPSetType(smoother, KSPCHEBYSHEV);CHKERRQ(ierr);
 
       /* set blocks for ASM smoother that uses the 'aggregates' */
-      if (pc_gamg->use_aggs_in_asm) {
+      if (use_aggs_in_asm) {
         PetscInt sz;
         IS       *iss;
 
@@ -861,7 +1198,7 @@ static PetscErrorCode PCGAMGSetCoarseEqLim_GAMG(PC pc, PetscInt n)
 
    Level: intermediate
 
-.seealso: ()
+.seealso: PCGAMGSetRepartitionSFC()
 @*/
 PetscErrorCode PCGAMGSetRepartition(PC pc, PetscBool n)
 {
@@ -883,6 +1220,47 @@ static PetscErrorCode PCGAMGSetRepartition_GAMG(PC pc, PetscBool n)
   PetscFunctionReturn(0);
 }
 
+/*@
+   PCGAMGSetRepartitionSFC - Repartition the coarse grids along a space filling curve through the coordinates of the vertices
+
+   Collective on PC
+
+   Input Parameters:
++  pc - the preconditioner context
+-  n - PETSC_TRUE or PETSC_FALSE
+
+   Options Database Key:
+.  -pc_gamg_repartition_sfc <true,false>
+
+   Notes:
+    this has an effect only with PCGAMGSetRepartition() and if the coordinates of the vertices are given with PCSetCoordinates().
+    The coordinates of the coarse vertices are the averages of the coordinates of the fine vertices weighted by the prolongator,
+    and the coarse vertices are split in consecutive pieces of a Hilbert curve with a parallel sort instead of a call to MatPartitioningApply()
+
+   Level: intermediate
+
+.seealso: PCGAMGSetRepartition(), PCSetCoordinates(), PetscParallelSortInt()
+@*/
+PetscErrorCode PCGAMGSetRepartitionSFC(PC pc, PetscBool n)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc,PC_CLASSID,1);
+  ierr = PetscTryMethod(pc,"PCGAMGSetRepartitionSFC_C",(PC,PetscBool),(pc,n));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PCGAMGSetRepartitionSFC_GAMG(PC pc, PetscBool n)
+{
+  PC_MG   *mg      = (PC_MG*)pc->data;
+  PC_GAMG *pc_gamg = (PC_GAMG*)mg->innerctx;
+
+  PetscFunctionBegin;
+  pc_gamg->repart_sfc = n;
+  PetscFunctionReturn(0);
+}
+
 /*@
    PCGAMGSetEstEigKSPMaxIt - Set number of KSP iterations in eigen estimator (for Cheby)
 
@@ -1489,6 +1867,9 @@ static PetscErrorCode PCView_GAMG(PC pc,PetscViewer viewer)
   if (pc_gamg->use_aggs_in_asm) {
     ierr = PetscViewerASCIIPrintf(viewer,"      Using aggregates from coarsening process to define subdomains for PCASM\n");CHKERRQ(ierr);
   }
+  if (pc_gamg->repart && pc_gamg->repart_sfc) {
+    ierr = PetscViewerASCIIPrintf(viewer,"      Repartitioning coarse grids along a space filling curve through the coordinates\n");CHKERRQ(ierr);
+  }
   if (pc_gamg->use_parallel_coarse_grid_solver) {
     ierr = PetscViewerASCIIPrintf(viewer,"      Using parallel coarse grid solver (all coarse grid equations not put on one process)\n");CHKERRQ(ierr);
   }
@@ -1510,6 +1891,159 @@ static PetscErrorCode PCView_GAMG(PC pc,PetscViewer viewer)
   PetscFunctionReturn(0);
 }
 
+/* -------------------------------------------------------------------------- */
+/*
+   PCGAMGMatView_Private - write a matrix of the hierarchy with its type, block sizes and parallel layout
+*/
+static PetscErrorCode PCGAMGMatView_Private(Mat A,PetscViewer viewer)
+{
+  PetscErrorCode ierr;
+  MPI_Comm       comm;
+  PetscMPIInt    rank,size;
+  PetscInt       bs[2],lsz[2],*sizes = NULL;
+  char           type[256];
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)A,&comm);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(comm,&rank);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  ierr = PetscStrncpy(type,((PetscObject)A)->type_name,256);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryWrite(viewer,type,256,PETSC_CHAR,PETSC_FALSE);CHKERRQ(ierr);
+  ierr = MatGetBlockSizes(A,&bs[0],&bs[1]);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryWrite(viewer,bs,2,PETSC_INT,PETSC_FALSE);CHKERRQ(ierr);
+  ierr = MatGetLocalSize(A,&lsz[0],&lsz[1]);CHKERRQ(ierr);
+  if (!rank) {ierr = PetscMalloc1(2*size,&sizes);CHKERRQ(ierr);}
+  ierr = MPI_Gather(lsz,2,MPIU_INT,sizes,2,MPIU_INT,0,comm);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryWrite(viewer,sizes,2*size,PETSC_INT,PETSC_FALSE);CHKERRQ(ierr);
+  ierr = PetscFree(sizes);CHKERRQ(ierr);
+  ierr = MatView(A,viewer);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCGAMGMatLoad_Private - read a matrix written with PCGAMGMatView_Private()
+*/
+static PetscErrorCode PCGAMGMatLoad_Private(MPI_Comm comm,PetscViewer viewer,Mat *A)
+{
+  PetscErrorCode ierr;
+  PetscMPIInt    rank,size;
+  PetscInt       bs[2],*sizes;
+  char           type[256];
+
+  PetscFunctionBegin;
+  ierr = MPI_Comm_rank(comm,&rank);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryRead(viewer,type,256,NULL,PETSC_CHAR);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryRead(viewer,bs,2,NULL,PETSC_INT);CHKERRQ(ierr);
+  ierr = PetscMalloc1(2*size,&sizes);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryRead(viewer,sizes,2*size,NULL,PETSC_INT);CHKERRQ(ierr);
+  ierr = MatCreate(comm,A);CHKERRQ(ierr);
+  ierr = MatSetSizes(*A,sizes[2*rank],sizes[2*rank+1],PETSC_DETERMINE,PETSC_DETERMINE);CHKERRQ(ierr);
+  ierr = PetscFree(sizes);CHKERRQ(ierr);
+  ierr = MatSetType(*A,type);CHKERRQ(ierr);
+  /* MatLoad() gives the block size of the rows to the columns too, so the column block size is set after it */
+  ierr = MatSetBlockSize(*A,bs[0] == bs[1] ? bs[0] : 1);CHKERRQ(ierr);
+  ierr = MatLoad(*A,viewer);CHKERRQ(ierr);
+  ierr = MatSetBlockSizes(*A,bs[0],bs[1]);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCView_GAMG_Binary - PCView() of PCGAMG: the hierarchy of a set up PCGAMG to a binary viewer, to be read
+     with PCLoad(), and PCView_MG() for the other viewers
+
+   The file has the size of the communicator and the number of levels, the eigenvalue estimates of each level
+   and then, from the finest to the coarsest level, the prolongator to and the operator of each coarse level.
+   The block sizes of the matrices are in the file, so the hierarchy is only written to a viewer without a .info
+   file (PetscViewerBinarySetSkipInfo()), whose -matload_block_size would apply to all the matrices when loading.
+*/
+static PetscErrorCode PCView_GAMG_Binary(PC pc,PetscViewer viewer)
+{
+  PetscErrorCode ierr;
+  PC_MG          *mg = (PC_MG*)pc->data;
+  PetscBool      isbinary,skipinfo;
+  PetscMPIInt    size;
+  PetscInt       hdr[2],nlevels,level,lidx;
+  PetscReal      eig[2*PETSC_MG_MAXLEVELS];
+  KSP            smoother;
+  Mat            A,P;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERBINARY,&isbinary);CHKERRQ(ierr);
+  if (!isbinary) {
+    ierr = PCView_MG(pc,viewer);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr    = MPI_Comm_size(PetscObjectComm((PetscObject)pc),&size);CHKERRQ(ierr);
+  ierr    = PetscViewerBinaryGetSkipInfo(viewer,&skipinfo);CHKERRQ(ierr);
+  nlevels = (pc->setupcalled && mg->levels) ? mg->nlevels : 0;
+  if (nlevels && !skipinfo) {
+    ierr    = PetscInfo(pc,"Not writing the hierarchy to a binary viewer with a .info file, see PetscViewerBinarySetSkipInfo()\n");CHKERRQ(ierr);
+    nlevels = 0;
+  }
+  hdr[0]  = size;
+  hdr[1]  = nlevels;
+  ierr    = PetscViewerBinaryWrite(viewer,hdr,2,PETSC_INT,PETSC_FALSE);CHKERRQ(ierr);
+  if (!nlevels) PetscFunctionReturn(0);
+  for (level=0; level<nlevels; level++) {
+    eig[2*level]   = mg->min_eigen_DinvA[level];
+    eig[2*level+1] = mg->max_eigen_DinvA[level];
+  }
+  ierr = PetscViewerBinaryWrite(viewer,eig,2*nlevels,PETSC_REAL,PETSC_FALSE);CHKERRQ(ierr);
+  for (level=1, lidx=nlevels-1; level<nlevels; level++, lidx--) {
+    ierr = PCMGGetInterpolation(pc,lidx,&P);CHKERRQ(ierr);
+    ierr = PCGAMGMatView_Private(P,viewer);CHKERRQ(ierr);
+    ierr = PCMGGetSmoother(pc,lidx-1,&smoother);CHKERRQ(ierr);
+    ierr = KSPGetOperators(smoother,NULL,&A);CHKERRQ(ierr);
+    ierr = PCGAMGMatView_Private(A,viewer);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCLoad_GAMG - read a hierarchy written with PCView() to a binary viewer; the next PCSetUp() uses it
+     instead of constructing the graphs, the aggregates and the prolongators
+
+   The communicator must have the same size and the operator the same parallel layout as when the hierarchy
+   was written.  With -pc_gamg_load_ptap the coarse grid operators are recomputed with MatPtAP() from the
+   loaded prolongators instead of being read, for operators with new values.
+*/
+static PetscErrorCode PCLoad_GAMG(PC pc,PetscViewer viewer)
+{
+  PetscErrorCode ierr;
+  PC_MG          *mg      = (PC_MG*)pc->data;
+  PC_GAMG        *pc_gamg = (PC_GAMG*)mg->innerctx;
+  MPI_Comm       comm;
+  PetscMPIInt    size;
+  PetscInt       hdr[2],level;
+  PetscReal      eig[2*PETSC_MG_MAXLEVELS];
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)pc,&comm);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  ierr = PetscViewerBinaryRead(viewer,hdr,2,NULL,PETSC_INT);CHKERRQ(ierr);
+  if (hdr[0] != size) SETERRQ2(comm,PETSC_ERR_ARG_INCOMP,"Hierarchy was written with %D processes, cannot load it on %d",hdr[0],size);
+  if (hdr[1] > PETSC_MG_MAXLEVELS) SETERRQ2(comm,PETSC_ERR_FILE_UNEXPECTED,"Hierarchy has %D levels, more than %d",hdr[1],PETSC_MG_MAXLEVELS);
+  /* forget any previous setup */
+  ierr = PCReset_GAMG(pc);CHKERRQ(ierr);
+  ierr = PCReset_MG(pc);CHKERRQ(ierr);
+  pc->setupcalled      = 0;
+  pc_gamg->setup_count = 0;
+  if (!hdr[1]) PetscFunctionReturn(0);
+  ierr = PetscViewerBinaryRead(viewer,eig,2*hdr[1],NULL,PETSC_REAL);CHKERRQ(ierr);
+  for (level=0; level<hdr[1]; level++) {
+    mg->min_eigen_DinvA[level] = eig[2*level];
+    mg->max_eigen_DinvA[level] = eig[2*level+1];
+  }
+  ierr = PetscCalloc2(hdr[1],&pc_gamg->load_P,hdr[1],&pc_gamg->load_A);CHKERRQ(ierr);
+  pc_gamg->load_nlevels = hdr[1];
+  for (level=1; level<hdr[1]; level++) {
+    ierr = PCGAMGMatLoad_Private(comm,viewer,&pc_gamg->load_P[level]);CHKERRQ(ierr);
+    ierr = PCGAMGMatLoad_Private(comm,viewer,&pc_gamg->load_A[level]);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode PCSetFromOptions_GAMG(PetscOptionItems *PetscOptionsObject,PC pc)
 {
   PetscErrorCode ierr;
@@ -1533,10 +2067,12 @@ PetscErrorCode PCSetFromOptions_GAMG(PetscOptionItems *PetscOptionsObject,PC pc)
     ierr = PCGAMGSetEstEigKSPType(pc,tname);CHKERRQ(ierr);
   }
   ierr = PetscOptionsBool("-pc_gamg_repartition","Repartion coarse grids","PCGAMGSetRepartition",pc_gamg->repart,&pc_gamg->repart,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsBool("-pc_gamg_repartition_sfc","Repartion coarse grids along a space filling curve through the coordinates","PCGAMGSetRepartitionSFC",pc_gamg->repart_sfc,&pc_gamg->repart_sfc,NULL);CHKERRQ(ierr);
   f2 = PETSC_TRUE;
   ierr = PetscOptionsBool("-pc_gamg_use_sa_esteig","Use eigen estimate from Smoothed aggregation for smoother","PCGAMGSetUseSAEstEig",f2,&f2,&flag);CHKERRQ(ierr);
   if (flag) pc_gamg->use_sa_esteig = f2 ? 1 : 0;
   ierr = PetscOptionsBool("-pc_gamg_reuse_interpolation","Reuse prolongation operator","PCGAMGReuseInterpolation",pc_gamg->reuse_prol,&pc_gamg->reuse_prol,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsBool("-pc_gamg_load_ptap","Recompute the coarse grid operators of a hierarchy read with PCLoad()","PCLoad",pc_gamg->load_ptap,&pc_gamg->load_ptap,NULL);CHKERRQ(ierr);
   ierr = PetscOptionsBool("-pc_gamg_asm_use_agg","Use aggregation aggregates for ASM smoother","PCGAMGASMSetUseAggs",pc_gamg->use_aggs_in_asm,&pc_gamg->use_aggs_in_asm,NULL);CHKERRQ(ierr);
   ierr = PetscOptionsBool("-pc_gamg_use_parallel_coarse_grid_solver","Use parallel coarse grid solver (otherwise put last grid on one process)","PCGAMGSetUseParallelCoarseGridSolve",pc_gamg->use_parallel_coarse_grid_solver,&pc_gamg->use_parallel_coarse_grid_solver,NULL);CHKERRQ(ierr);
   ierr = PetscOptionsBool("-pc_gamg_cpu_pin_coarse_grids","Pin coarse grids to the CPU","PCGAMGSetCpuPinCoarseGrids",pc_gamg->cpu_pin_coarse_grids,&pc_gamg->cpu_pin_coarse_grids,NULL);CHKERRQ(ierr);
@@ -1578,7 +2114,9 @@ PetscErrorCode PCSetFromOptions_GAMG(PetscOptionItems *PetscOptionsObject,PC pc)
    Options Database Keys:
 +   -pc_gamg_type <type> - one of agg, geo, or classical
 .   -pc_gamg_repartition  <true,default=false> - repartition the degrees of freedom accross the coarse grids as they are determined
+.   -pc_gamg_repartition_sfc <true,default=false> - repartition along a space filling curve through the coordinates given with PCSetCoordinates() instead of with MatPartitioning
 .   -pc_gamg_reuse_interpolation <true,default=false> - when rebuilding the algebraic multigrid preconditioner reuse the previously computed interpolations
+.   -pc_gamg_load_ptap <true,default=false> - recompute the coarse grid operators of a hierarchy read with PCLoad() from the loaded prolongators
 .   -pc_gamg_asm_use_agg <true,default=false> - use the aggregates from the coasening process to defined the subdomains on each level for the PCASM smoother
 .   -pc_gamg_process_eq_limit <limit, default=50> - GAMG will reduce the number of MPI processes used directly on the coarse grids so that there are around <limit>
                                         equations on each process that has degrees of freedom
@@ -1604,6 +2142,9 @@ PetscErrorCode PCSetFromOptions_GAMG(PetscOptionItems *PetscOptionsObject,PC pc)
        Call MatSetNearNullSpace() (or PCSetCoordinates() if solving the equations of elasticity) to indicate the near null space of the operator
        See the Users Manual Chapter 4 for more details
 
+    PCView() to a binary viewer created with PetscViewerBinarySetSkipInfo() (or -viewer_binary_skip_info) saves the hierarchy of a set up
+    PCGAMG, that PCLoad() reads back on the same number of processes
+
   Level: intermediate
 
 .seealso:  PCCreate(), PCSetType(), MatSetBlockSize(), PCMGType, PCSetCoordinates(), MatSetNearNullSpace(), PCGAMGSetType(), PCGAMGAGG, PCGAMGGEO, PCGAMGCLASSICAL, PCGAMGSetProcEqLim(),
@@ -1642,6 +2183,8 @@ PETSC_EXTERN PetscErrorCode PCCreate_GAMG(PC pc)
   pc->ops->setup          = PCSetUp_GAMG;
   pc->ops->reset          = PCReset_GAMG;
   pc->ops->destroy        = PCDestroy_GAMG;
+  pc->ops->view           = PCView_GAMG_Binary;
+  pc->ops->load           = PCLoad_GAMG;
   mg->view                = PCView_GAMG;
 
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCMGGetLevels_C",PCMGGetLevels_MG);CHKERRQ(ierr);
@@ -1649,6 +2192,7 @@ PETSC_EXTERN PetscErrorCode PCCreate_GAMG(PC pc)
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetProcEqLim_C",PCGAMGSetProcEqLim_GAMG);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetCoarseEqLim_C",PCGAMGSetCoarseEqLim_GAMG);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetRepartition_C",PCGAMGSetRepartition_GAMG);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetRepartitionSFC_C",PCGAMGSetRepartitionSFC_GAMG);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetEstEigKSPType_C",PCGAMGSetEstEigKSPType_GAMG);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetEstEigKSPMaxIt_C",PCGAMGSetEstEigKSPMaxIt_GAMG);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetEigenvalues_C",PCGAMGSetEigenvalues_GAMG);CHKERRQ(ierr);
@@ -1664,6 +2208,8 @@ PETSC_EXTERN PetscErrorCode PCCreate_GAMG(PC pc)
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGGetType_C",PCGAMGGetType_GAMG);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)pc,"PCGAMGSetNlevels_C",PCGAMGSetNlevels_GAMG);CHKERRQ(ierr);
   pc_gamg->repart           = PETSC_FALSE;
+  pc_gamg->repart_sfc       = PETSC_FALSE;
+  pc_gamg->load_ptap        = PETSC_FALSE;
   pc_gamg->reuse_prol       = PETSC_FALSE;
   pc_gamg->use_aggs_in_asm  = PETSC_FALSE;
   pc_gamg->use_parallel_coarse_grid_solver = PETSC_FALSE;
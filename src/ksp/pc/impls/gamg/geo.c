@@ -77,6 +77,7 @@ PetscErrorCode PCSetCoordinates_GEO(PC pc, PetscInt ndm, PetscInt a_nloc, PetscR
   }
   if (pc_gamg->data[arrsz] != -99.) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_PLIB,"pc_gamg->data[arrsz %D] %g != -99.",arrsz,pc_gamg->data[arrsz]);
   pc_gamg->data_sz = arrsz;
+  ierr = PCGAMGSetCoordinates_Private(pc, ndm, a_nloc, coords);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
@@ -54,6 +54,207 @@ PETSC_STATIC_INLINE PetscErrorCode MatCollapseRows(Mat Amat,PetscInt start,Petsc
 }
 
 
+/* -------------------------------------------------------------------------- */
+/*
+   PCGAMGGetGraphNumThreads - the number of threads of the (diagonal block of the) graph, see MatSeqAIJSetNumThreads();
+   1 for other matrix types. The graph methods and the coarseners use these threads.
+*/
+PetscErrorCode PCGAMGGetGraphNumThreads(Mat Gmat,PetscInt *nt)
+{
+  PetscErrorCode ierr;
+  PetscBool      isseqaij,ismpiaij;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectBaseTypeCompare((PetscObject)Gmat,MATSEQAIJ,&isseqaij);CHKERRQ(ierr);
+  ierr = PetscObjectBaseTypeCompare((PetscObject)Gmat,MATMPIAIJ,&ismpiaij);CHKERRQ(ierr);
+  if (ismpiaij)      *nt = ((Mat_SeqAIJ*)((Mat_MPIAIJ*)Gmat->data)->A->data)->threads.nthreads;
+  else if (isseqaij) *nt = ((Mat_SeqAIJ*)Gmat->data)->threads.nthreads;
+  else               *nt = 1;
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCGAMGSetGraphNumThreads - sets the number of threads of a graph, on both blocks of a MATMPIAIJ graph
+*/
+PetscErrorCode PCGAMGSetGraphNumThreads(Mat Gmat,PetscInt nt)
+{
+  PetscErrorCode ierr;
+  PetscBool      ismpiaij;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectBaseTypeCompare((PetscObject)Gmat,MATMPIAIJ,&ismpiaij);CHKERRQ(ierr);
+  if (ismpiaij) {
+    ierr = MatSeqAIJSetNumThreads(((Mat_MPIAIJ*)Gmat->data)->A,nt);CHKERRQ(ierr);
+    ierr = MatSeqAIJSetNumThreads(((Mat_MPIAIJ*)Gmat->data)->B,nt);CHKERRQ(ierr);
+  } else {
+    ierr = MatSeqAIJSetNumThreads(Gmat,nt);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/* the local rows of a MATSEQAIJ or MATMPIAIJ matrix, read directly by the threads */
+typedef struct {
+  const Mat_SeqAIJ *a,*b;    /* diagonal and off-diagonal blocks, b is NULL for MATSEQAIJ */
+  const PetscInt   *garray;  /* global columns of b */
+  PetscInt         cstart;   /* first global column of a */
+} PCGAMGRows;
+
+static PetscErrorCode PCGAMGRowsSetUp_Private(Mat Amat,PCGAMGRows *rows)
+{
+  PetscErrorCode ierr;
+  PetscBool      ismpiaij;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectBaseTypeCompare((PetscObject)Amat,MATMPIAIJ,&ismpiaij);CHKERRQ(ierr);
+  if (ismpiaij) {
+    Mat_MPIAIJ *aij = (Mat_MPIAIJ*)Amat->data;
+
+    rows->a      = (Mat_SeqAIJ*)aij->A->data;
+    rows->b      = (Mat_SeqAIJ*)aij->B->data;
+    rows->garray = aij->garray;
+    rows->cstart = Amat->cmap->rstart;
+  } else {
+    rows->a      = (Mat_SeqAIJ*)Amat->data;
+    rows->b      = NULL;
+    rows->garray = NULL;
+    rows->cstart = 0;
+  }
+  PetscFunctionReturn(0);
+}
+
+PETSC_STATIC_INLINE PetscInt PCGAMGRowLength_Private(const PCGAMGRows *rows,PetscInt r)
+{
+  return rows->a->i[r+1] - rows->a->i[r] + (rows->b ? rows->b->i[r+1] - rows->b->i[r] : 0);
+}
+
+/* copies local row r with its global column indices in increasing order, as MatGetRow() gives them */
+PETSC_STATIC_INLINE PetscInt PCGAMGGetRow_Private(const PCGAMGRows *rows,PetscInt r,PetscInt cols[],PetscScalar vals[])
+{
+  const Mat_SeqAIJ *a = rows->a,*b = rows->b;
+  PetscInt         n = 0,j,jb = b ? b->i[r] : 0,jbend = b ? b->i[r+1] : 0;
+
+  for (; jb<jbend && rows->garray[b->j[jb]] < rows->cstart; jb++) {
+    cols[n]   = rows->garray[b->j[jb]];
+    vals[n++] = b->a[jb];
+  }
+  for (j=a->i[r]; j<a->i[r+1]; j++) {
+    cols[n]   = a->j[j] + rows->cstart;
+    vals[n++] = a->a[j];
+  }
+  for (; jb<jbend; jb++) {
+    cols[n]   = rows->garray[b->j[jb]];
+    vals[n++] = b->a[jb];
+  }
+  return n;
+}
+
+/*
+   Creates a graph of type mtype from rows written by the threads: local row i has cnt[i] entries, with global column
+   indices, at off[i] in cols[] and vals[]. The rows are packed by the threads and inserted with the CSR preallocation.
+*/
+static PetscErrorCode PCGAMGCreateGraphFromRows_Private(MPI_Comm comm,MatType mtype,PetscInt nloc,PetscInt nt,const PetscInt off[],const PetscInt cnt[],const PetscInt cols[],const PetscScalar vals[],Mat *a_Gmat)
+{
+  PetscErrorCode ierr;
+  PetscInt       i,*ii,*jj;
+  PetscScalar    *aa;
+  Mat            Gmat;
+
+  PetscFunctionBegin;
+  ierr  = PetscMalloc1(nloc+1,&ii);CHKERRQ(ierr);
+  ii[0] = 0;
+  for (i=0; i<nloc; i++) ii[i+1] = ii[i] + cnt[i];
+  ierr = PetscMalloc2(ii[nloc],&jj,ii[nloc],&aa);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+  for (i=0; i<nloc; i++) {
+    PetscInt k;
+
+    for (k=0; k<cnt[i]; k++) {
+      jj[ii[i]+k] = cols[off[i]+k];
+      aa[ii[i]+k] = vals[off[i]+k];
+    }
+  }
+  ierr = MatCreate(comm,&Gmat);CHKERRQ(ierr);
+  ierr = MatSetSizes(Gmat,nloc,nloc,PETSC_DETERMINE,PETSC_DETERMINE);CHKERRQ(ierr);
+  ierr = MatSetBlockSizes(Gmat,1,1);CHKERRQ(ierr);
+  ierr = MatSetType(Gmat,mtype);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocationCSR(Gmat,ii,jj,aa);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocationCSR(Gmat,ii,jj,aa);CHKERRQ(ierr);
+  ierr = PetscFree(ii);CHKERRQ(ierr);
+  ierr = PetscFree2(jj,aa);CHKERRQ(ierr);
+  ierr = PCGAMGSetGraphNumThreads(Gmat,nt);CHKERRQ(ierr);
+  *a_Gmat = Gmat;
+  PetscFunctionReturn(0);
+}
+
+/*
+   The scalar graph of a (MPI)AIJ matrix with block size bs > 1, built by nt threads: each block row merges the absolute
+   values of its bs rows into its block columns, adding them in the order of MatSetValues() in PCGAMGCreateGraph() so
+   the graph is the same
+*/
+static PetscErrorCode PCGAMGCreateGraph_Threaded(Mat Amat,PetscInt bs,PetscInt nt,Mat *a_Gmat)
+{
+  PetscErrorCode ierr;
+  PCGAMGRows     rows;
+  PetscInt       nloc = Amat->rmap->n/bs,i,k,t,rmax = 0,bmax = 0,*off,*cnt,*cols,*wcols;
+  PetscScalar    *vals,*wvals;
+  MatType        mtype;
+
+  PetscFunctionBegin;
+  ierr = PCGAMGRowsSetUp_Private(Amat,&rows);CHKERRQ(ierr);
+  ierr = PetscMalloc2(nloc+1,&off,nloc,&cnt);CHKERRQ(ierr);
+  for (off[0]=i=0; i<nloc; i++) {
+    PetscInt n,nb = 0;
+
+    for (k=0; k<bs; k++) {
+      n     = PCGAMGRowLength_Private(&rows,i*bs+k);
+      nb   += n;
+      rmax  = PetscMax(rmax,n);
+    }
+    bmax     = PetscMax(bmax,nb);
+    off[i+1] = off[i] + nb;
+  }
+  /* the block rows are merged in their slots of cols[] and vals[], with a row and a merge buffer for each thread */
+  ierr = PetscMalloc2(off[nloc],&cols,off[nloc],&vals);CHKERRQ(ierr);
+  ierr = PetscMalloc2(nt*(rmax+bmax),&wcols,nt*(rmax+bmax),&wvals);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static,1)
+#endif
+  for (t=0; t<nt; t++) {
+    PetscInt    ib,r,e,p,na,nb,nr,J,*rc = wcols + t*(rmax+bmax),*tc = rc + rmax,*ac,*bc,*tmpc;
+    PetscScalar sv,*rv = wvals + t*(rmax+bmax),*tv = rv + rmax,*av,*bv,*tmpv;
+
+    for (ib=(nloc*t)/nt; ib<(nloc*(t+1))/nt; ib++) {
+      /* merge rows alternating between the slot and the thread buffer, starting so the last merge ends in the slot */
+      ac = bs%2 ? tc : cols + off[ib]; av = bs%2 ? tv : vals + off[ib];
+      bc = bs%2 ? cols + off[ib] : tc; bv = bs%2 ? vals + off[ib] : tv;
+      na = 0;
+      for (r=ib*bs; r<(ib+1)*bs; r++) {
+        nr = PCGAMGGetRow_Private(&rows,r,rc,rv);
+        for (e=p=nb=0; e<nr; e++) {
+          J  = rc[e]/bs;
+          sv = PetscAbs(PetscRealPart(rv[e]));
+          while (p<na && ac[p] < J) {bc[nb] = ac[p]; bv[nb++] = av[p++];}
+          if (nb && bc[nb-1] == J) bv[nb-1] += sv;
+          else if (p<na && ac[p] == J) {bc[nb] = J; bv[nb++] = av[p++] + sv;}
+          else {bc[nb] = J; bv[nb++] = sv;}
+        }
+        while (p<na) {bc[nb] = ac[p]; bv[nb++] = av[p++];}
+        tmpc = ac; ac = bc; bc = tmpc; tmpv = av; av = bv; bv = tmpv;
+        na = nb;
+      }
+      cnt[ib] = na;
+    }
+  }
+  ierr = PetscFree2(wcols,wvals);CHKERRQ(ierr);
+  ierr = MatGetType(Amat,&mtype);CHKERRQ(ierr);
+  ierr = PCGAMGCreateGraphFromRows_Private(PetscObjectComm((PetscObject)Amat),mtype,nloc,nt,off,cnt,cols,vals,a_Gmat);CHKERRQ(ierr);
+  ierr = PetscFree2(cols,vals);CHKERRQ(ierr);
+  ierr = PetscFree2(off,cnt);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 /* -------------------------------------------------------------------------- */
 /*
    PCGAMGCreateGraph - create simple scaled scalar graph from matrix
@@ -66,10 +267,11 @@ PETSC_STATIC_INLINE PetscErrorCode MatCollapseRows(Mat Amat,PetscInt start,Petsc
 PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
 {
   PetscErrorCode ierr;
-  PetscInt       Istart,Iend,Ii,jj,kk,ncols,nloc,NN,MM,bs;
+  PetscInt       Istart,Iend,Ii,jj,kk,ncols,nloc,NN,MM,bs,nt;
   MPI_Comm       comm;
-  Mat            Gmat;
+  Mat            Gmat,Aaij = NULL;
   MatType        mtype;
+  PetscBool      ismixed;
 
   PetscFunctionBegin;
   ierr = PetscObjectGetComm((PetscObject)Amat,&comm);CHKERRQ(ierr);
@@ -82,11 +284,21 @@ PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
   ierr = PetscLogEventBegin(petsc_gamg_setup_events[GRAPH],0,0,0,0);CHKERRQ(ierr);
 #endif
 
-  if (bs > 1) {
+  /* the graph of a MATAIJMIXED matrix is a MATAIJ matrix, built from the values rounded to single precision */
+  ierr = PetscObjectTypeCompareAny((PetscObject)Amat,&ismixed,MATSEQAIJMIXED,MATMPIAIJMIXED,"");CHKERRQ(ierr);
+  if (ismixed) {
+    ierr = MatConvert(Amat, MATAIJ, MAT_INITIAL_MATRIX, &Aaij);CHKERRQ(ierr);
+    Amat = Aaij;
+  }
+
+  ierr = PCGAMGGetGraphNumThreads(Amat, &nt);CHKERRQ(ierr);
+  if (bs > 1 && nt > 1) {
+    ierr = PCGAMGCreateGraph_Threaded(Amat, bs, nt, &Gmat);CHKERRQ(ierr);
+  } else if (bs > 1) {
     const PetscScalar *vals;
     const PetscInt    *idx;
     PetscInt          *d_nnz, *o_nnz,*w0,*w1,*w2;
-    PetscBool         ismpiaij,isseqaij;
+    PetscBool         ismpiaij,isseqaij,ismpibaij,isseqbaij;
 
     /*
        Determine the preallocation needed for the scalar matrix derived from the vector matrix.
@@ -94,7 +306,9 @@ PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
 
     ierr = PetscObjectBaseTypeCompare((PetscObject)Amat,MATSEQAIJ,&isseqaij);CHKERRQ(ierr);
     ierr = PetscObjectBaseTypeCompare((PetscObject)Amat,MATMPIAIJ,&ismpiaij);CHKERRQ(ierr);
-    ierr = PetscMalloc2(nloc, &d_nnz,isseqaij ? 0 : nloc, &o_nnz);CHKERRQ(ierr);
+    ierr = PetscObjectTypeCompare((PetscObject)Amat,MATSEQBAIJ,&isseqbaij);CHKERRQ(ierr);
+    ierr = PetscObjectTypeCompare((PetscObject)Amat,MATMPIBAIJ,&ismpibaij);CHKERRQ(ierr);
+    ierr = PetscMalloc2(nloc, &d_nnz,(isseqaij || isseqbaij) ? 0 : nloc, &o_nnz);CHKERRQ(ierr);
 
     if (isseqaij) {
       PetscInt       max_d_nnz;
@@ -141,10 +355,31 @@ PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
         if (o_nnz[jj] > (NN/bs-nloc)) o_nnz[jj] = NN/bs-nloc;
       }
 
-    } else SETERRQ(PETSC_COMM_WORLD,PETSC_ERR_USER,"Require AIJ matrix type");
+    } else if (isseqbaij || ismpibaij) {
+      Mat Dbaij = Amat,Obaij = NULL;
+
+      /*
+         Exact preallocation counts, the graph has the block structure of the matrix
+      */
+      if (ismpibaij) {ierr = MatMPIBAIJGetSeqBAIJ(Amat,&Dbaij,&Obaij,NULL);CHKERRQ(ierr);}
+      for (Ii = 0, jj = 0; Ii < Iend - Istart; Ii += bs, jj++) {
+        ierr = MatGetRow(Dbaij,Ii,&ncols,0,0);CHKERRQ(ierr);
+        d_nnz[jj] = ncols/bs;
+        ierr = MatRestoreRow(Dbaij,Ii,&ncols,0,0);CHKERRQ(ierr);
+        if (Obaij) {
+          ierr = MatGetRow(Obaij,Ii,&ncols,0,0);CHKERRQ(ierr);
+          o_nnz[jj] = ncols/bs;
+          ierr = MatRestoreRow(Obaij,Ii,&ncols,0,0);CHKERRQ(ierr);
+        }
+      }
+
+    } else SETERRQ(PETSC_COMM_WORLD,PETSC_ERR_USER,"Require AIJ or BAIJ matrix type");
 
     /* get scalar copy (norms) of matrix */
-    ierr = MatGetType(Amat,&mtype);CHKERRQ(ierr);
+    if (isseqbaij || ismpibaij) mtype = MATAIJ;
+    else {
+      ierr = MatGetType(Amat,&mtype);CHKERRQ(ierr);
+    }
     ierr = MatCreate(comm, &Gmat);CHKERRQ(ierr);
     ierr = MatSetSizes(Gmat,nloc,nloc,PETSC_DETERMINE,PETSC_DETERMINE);CHKERRQ(ierr);
     ierr = MatSetBlockSizes(Gmat, 1, 1);CHKERRQ(ierr);
@@ -165,10 +400,14 @@ PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
     }
     ierr = MatAssemblyBegin(Gmat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
     ierr = MatAssemblyEnd(Gmat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  } else if (Aaij) {
+    Gmat = Aaij;
+    Aaij = NULL;
   } else {
     /* just copy scalar matrix - abs() not taken here but scaled later */
     ierr = MatDuplicate(Amat, MAT_COPY_VALUES, &Gmat);CHKERRQ(ierr);
   }
+  ierr = MatDestroy(&Aaij);CHKERRQ(ierr);
 
 #if defined PETSC_GAMG_USE_LOG
   ierr = PetscLogEventEnd(petsc_gamg_setup_events[GRAPH],0,0,0,0);CHKERRQ(ierr);
@@ -178,6 +417,92 @@ PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
   PetscFunctionReturn(0);
 }
 
+/*
+   The filtered graph built by nt threads: row i merges row i of Gmat with row i of its transpose when symm, and each
+   entry that passes the threshold adds (half of, when symm) its absolute value, as the MatSetValues() of
+   PCGAMGFilterGraph() do, so the graph is the same
+*/
+static PetscErrorCode PCGAMGFilterGraph_Threaded(Mat Gmat,PetscReal vfilter,PetscBool symm,PetscInt nt,Mat *a_tGmat,PetscInt *a_nnz0,PetscInt *a_nnz1)
+{
+  PetscErrorCode ierr;
+  Mat            matTrans = NULL;
+  PCGAMGRows     rows,trows;
+  PetscInt       nloc = Gmat->rmap->n,i,t,n,gmax = 0,tmax = 0,nnz0 = 0,nnz1 = 0,*off,*cnt,*cols,*wcols;
+  PetscScalar    *vals,*wvals;
+  MatType        mtype;
+
+  PetscFunctionBegin;
+  ierr = PCGAMGRowsSetUp_Private(Gmat,&rows);CHKERRQ(ierr);
+  if (symm) {
+    ierr = MatTranspose(Gmat, MAT_INITIAL_MATRIX, &matTrans);CHKERRQ(ierr);
+    ierr = PCGAMGRowsSetUp_Private(matTrans,&trows);CHKERRQ(ierr);
+  }
+  ierr = PetscMalloc2(nloc+1,&off,nloc,&cnt);CHKERRQ(ierr);
+  for (off[0]=i=0; i<nloc; i++) {
+    n        = PCGAMGRowLength_Private(&rows,i);
+    gmax     = PetscMax(gmax,n);
+    off[i+1] = off[i] + n;
+    if (symm) {
+      n         = PCGAMGRowLength_Private(&trows,i);
+      tmax      = PetscMax(tmax,n);
+      off[i+1] += n;
+    }
+  }
+  ierr = PetscMalloc2(off[nloc],&cols,off[nloc],&vals);CHKERRQ(ierr);
+  ierr = PetscMalloc2(nt*(gmax+tmax),&wcols,nt*(gmax+tmax),&wvals);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static,1) reduction(+:nnz0,nnz1)
+#endif
+  for (t=0; t<nt; t++) {
+    PetscInt    r,p,q,ng,ntr,col,nr,*gc = wcols + t*(gmax+tmax),*tc = gc + gmax,*c;
+    PetscScalar s,*gv = wvals + t*(gmax+tmax),*tv = gv + gmax,*v;
+    PetscReal   a;
+    PetscBool   in;
+
+    for (r=(nloc*t)/nt; r<(nloc*(t+1))/nt; r++) {
+      ng    = PCGAMGGetRow_Private(&rows,r,gc,gv);
+      ntr   = symm ? PCGAMGGetRow_Private(&trows,r,tc,tv) : 0;
+      nnz0 += ng;
+      c     = cols + off[r];
+      v     = vals + off[r];
+      for (p=q=nr=0; p<ng || q<ntr;) {
+        col = (q == ntr || (p < ng && gc[p] <= tc[q])) ? gc[p] : tc[q];
+        s   = 0.0;
+        in  = PETSC_FALSE;
+        if (p < ng && gc[p] == col) {
+          a = PetscAbs(PetscRealPart(gv[p])); p++;
+          if (a > vfilter) {
+            nnz1++;
+            s  = symm ? 0.5*a : a;
+            in = PETSC_TRUE;
+          }
+        }
+        if (q < ntr && tc[q] == col) {
+          a = PetscAbs(PetscRealPart(tv[q])); q++;
+          if (a > vfilter) {
+            s += 0.5*a;
+            in = PETSC_TRUE;
+          }
+        }
+        if (in) {
+          c[nr]   = col;
+          v[nr++] = s;
+        }
+      }
+      cnt[r] = nr;
+    }
+  }
+  ierr = PetscFree2(wcols,wvals);CHKERRQ(ierr);
+  ierr = MatDestroy(&matTrans);CHKERRQ(ierr);
+  ierr = MatGetType(Gmat,&mtype);CHKERRQ(ierr);
+  ierr = PCGAMGCreateGraphFromRows_Private(PetscObjectComm((PetscObject)Gmat),mtype,nloc,nt,off,cnt,cols,vals,a_tGmat);CHKERRQ(ierr);
+  ierr = PetscFree2(cols,vals);CHKERRQ(ierr);
+  ierr = PetscFree2(off,cnt);CHKERRQ(ierr);
+  *a_nnz0 = nnz0;
+  *a_nnz1 = nnz1;
+  PetscFunctionReturn(0);
+}
+
 /* -------------------------------------------------------------------------- */
 /*@C
    PCGAMGFilterGraph - filter (remove zero and possibly small values from the) graph and make it symmetric if requested
@@ -199,7 +524,7 @@ PetscErrorCode PCGAMGCreateGraph(Mat Amat, Mat *a_Gmat)
 PetscErrorCode PCGAMGFilterGraph(Mat *a_Gmat,PetscReal vfilter,PetscBool symm)
 {
   PetscErrorCode    ierr;
-  PetscInt          Istart,Iend,Ii,jj,ncols,nnz0,nnz1, NN, MM, nloc;
+  PetscInt          Istart,Iend,Ii,jj,ncols,nnz0 = 0,nnz1 = 0, NN, MM, nloc, nt;
   PetscMPIInt       rank;
   Mat               Gmat  = *a_Gmat, tGmat, matTrans;
   MPI_Comm          comm;
@@ -257,60 +582,65 @@ PetscErrorCode PCGAMGFilterGraph(Mat *a_Gmat,PetscReal vfilter,PetscBool symm)
   nloc = Iend - Istart;
   ierr = MatGetSize(Gmat, &MM, &NN);CHKERRQ(ierr);
 
-  if (symm) {
-    ierr = MatTranspose(Gmat, MAT_INITIAL_MATRIX, &matTrans);CHKERRQ(ierr);
-  }
+  ierr = PCGAMGGetGraphNumThreads(Gmat, &nt);CHKERRQ(ierr);
+  if (nt > 1) {
+    ierr = PCGAMGFilterGraph_Threaded(Gmat, vfilter, symm, nt, &tGmat, &nnz0, &nnz1);CHKERRQ(ierr);
+  } else {
+    if (symm) {
+      ierr = MatTranspose(Gmat, MAT_INITIAL_MATRIX, &matTrans);CHKERRQ(ierr);
+    }
 
-  /* Determine upper bound on nonzeros needed in new filtered matrix */
-  ierr = PetscMalloc2(nloc, &d_nnz,nloc, &o_nnz);CHKERRQ(ierr);
-  for (Ii = Istart, jj = 0; Ii < Iend; Ii++, jj++) {
-    ierr      = MatGetRow(Gmat,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
-    d_nnz[jj] = ncols;
-    o_nnz[jj] = ncols;
-    ierr      = MatRestoreRow(Gmat,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
+    /* Determine upper bound on nonzeros needed in new filtered matrix */
+    ierr = PetscMalloc2(nloc, &d_nnz,nloc, &o_nnz);CHKERRQ(ierr);
+    for (Ii = Istart, jj = 0; Ii < Iend; Ii++, jj++) {
+      ierr      = MatGetRow(Gmat,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
+      d_nnz[jj] = ncols;
+      o_nnz[jj] = ncols;
+      ierr      = MatRestoreRow(Gmat,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
+      if (symm) {
+        ierr       = MatGetRow(matTrans,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
+        d_nnz[jj] += ncols;
+        o_nnz[jj] += ncols;
+        ierr       = MatRestoreRow(matTrans,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
+      }
+      if (d_nnz[jj] > nloc) d_nnz[jj] = nloc;
+      if (o_nnz[jj] > (MM-nloc)) o_nnz[jj] = MM - nloc;
+    }
+    ierr = MatGetType(Gmat,&mtype);CHKERRQ(ierr);
+    ierr = MatCreate(comm, &tGmat);CHKERRQ(ierr);
+    ierr = MatSetSizes(tGmat,nloc,nloc,MM,MM);CHKERRQ(ierr);
+    ierr = MatSetBlockSizes(tGmat, 1, 1);CHKERRQ(ierr);
+    ierr = MatSetType(tGmat, mtype);CHKERRQ(ierr);
+    ierr = MatSeqAIJSetPreallocation(tGmat,0,d_nnz);CHKERRQ(ierr);
+    ierr = MatMPIAIJSetPreallocation(tGmat,0,d_nnz,0,o_nnz);CHKERRQ(ierr);
+    ierr = PetscFree2(d_nnz,o_nnz);CHKERRQ(ierr);
     if (symm) {
-      ierr       = MatGetRow(matTrans,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
-      d_nnz[jj] += ncols;
-      o_nnz[jj] += ncols;
-      ierr       = MatRestoreRow(matTrans,Ii,&ncols,NULL,NULL);CHKERRQ(ierr);
+      ierr = MatDestroy(&matTrans);CHKERRQ(ierr);
+    } else {
+      /* all entries are generated locally so MatAssembly will be slightly faster for large process counts */
+      ierr = MatSetOption(tGmat,MAT_NO_OFF_PROC_ENTRIES,PETSC_TRUE);CHKERRQ(ierr);
     }
-    if (d_nnz[jj] > nloc) d_nnz[jj] = nloc;
-    if (o_nnz[jj] > (MM-nloc)) o_nnz[jj] = MM - nloc;
-  }
-  ierr = MatGetType(Gmat,&mtype);CHKERRQ(ierr);
-  ierr = MatCreate(comm, &tGmat);CHKERRQ(ierr);
-  ierr = MatSetSizes(tGmat,nloc,nloc,MM,MM);CHKERRQ(ierr);
-  ierr = MatSetBlockSizes(tGmat, 1, 1);CHKERRQ(ierr);
-  ierr = MatSetType(tGmat, mtype);CHKERRQ(ierr);
-  ierr = MatSeqAIJSetPreallocation(tGmat,0,d_nnz);CHKERRQ(ierr);
-  ierr = MatMPIAIJSetPreallocation(tGmat,0,d_nnz,0,o_nnz);CHKERRQ(ierr);
-  ierr = PetscFree2(d_nnz,o_nnz);CHKERRQ(ierr);
-  if (symm) {
-    ierr = MatDestroy(&matTrans);CHKERRQ(ierr);
-  } else {
-    /* all entries are generated locally so MatAssembly will be slightly faster for large process counts */
-    ierr = MatSetOption(tGmat,MAT_NO_OFF_PROC_ENTRIES,PETSC_TRUE);CHKERRQ(ierr);
-  }
 
-  for (Ii = Istart, nnz0 = nnz1 = 0; Ii < Iend; Ii++) {
-    ierr = MatGetRow(Gmat,Ii,&ncols,&idx,&vals);CHKERRQ(ierr);
-    for (jj=0; jj<ncols; jj++,nnz0++) {
-      PetscScalar sv = PetscAbs(PetscRealPart(vals[jj]));
-      if (PetscRealPart(sv) > vfilter) {
-        nnz1++;
-        if (symm) {
-          sv  *= 0.5;
-          ierr = MatSetValues(tGmat,1,&Ii,1,&idx[jj],&sv,ADD_VALUES);CHKERRQ(ierr);
-          ierr = MatSetValues(tGmat,1,&idx[jj],1,&Ii,&sv,ADD_VALUES);CHKERRQ(ierr);
-        } else {
-          ierr = MatSetValues(tGmat,1,&Ii,1,&idx[jj],&sv,ADD_VALUES);CHKERRQ(ierr);
+    for (Ii = Istart, nnz0 = nnz1 = 0; Ii < Iend; Ii++) {
+      ierr = MatGetRow(Gmat,Ii,&ncols,&idx,&vals);CHKERRQ(ierr);
+      for (jj=0; jj<ncols; jj++,nnz0++) {
+        PetscScalar sv = PetscAbs(PetscRealPart(vals[jj]));
+        if (PetscRealPart(sv) > vfilter) {
+          nnz1++;
+          if (symm) {
+            sv  *= 0.5;
+            ierr = MatSetValues(tGmat,1,&Ii,1,&idx[jj],&sv,ADD_VALUES);CHKERRQ(ierr);
+            ierr = MatSetValues(tGmat,1,&idx[jj],1,&Ii,&sv,ADD_VALUES);CHKERRQ(ierr);
+          } else {
+            ierr = MatSetValues(tGmat,1,&Ii,1,&idx[jj],&sv,ADD_VALUES);CHKERRQ(ierr);
+          }
         }
       }
+      ierr = MatRestoreRow(Gmat,Ii,&ncols,&idx,&vals);CHKERRQ(ierr);
     }
-    ierr = MatRestoreRow(Gmat,Ii,&ncols,&idx,&vals);CHKERRQ(ierr);
+    ierr = MatAssemblyBegin(tGmat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(tGmat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
   }
-  ierr = MatAssemblyBegin(tGmat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
-  ierr = MatAssemblyEnd(tGmat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
 
 #if defined PETSC_GAMG_USE_LOG
   ierr = PetscLogEventEnd(petsc_gamg_setup_events[GRAPH],0,0,0,0);CHKERRQ(ierr);
@@ -272,6 +272,20 @@ static PetscErrorCode PCApply_Jacobi(PC pc,Vec x,Vec y)
   ierr = VecPointwiseMult(y,x,jac->diag);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
+
+static PetscErrorCode PCMatApply_Jacobi(PC pc,Mat X,Mat Y)
+{
+  PC_Jacobi      *jac = (PC_Jacobi*)pc->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!jac->diag) {
+    ierr = PCSetUp_Jacobi_NonSymmetric(pc);CHKERRQ(ierr);
+  }
+  ierr = MatCopy(X,Y,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+  ierr = MatDiagonalScale(Y,jac->diag,NULL);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
 /* -------------------------------------------------------------------------- */
 /*
    PCApplySymmetricLeftOrRight_Jacobi - Applies the left or right part of a
@@ -416,6 +430,7 @@ PETSC_EXTERN PetscErrorCode PCCreate_Jacobi(PC pc)
       not needed.
   */
   pc->ops->apply               = PCApply_Jacobi;
+  pc->ops->matapply            = PCMatApply_Jacobi;
   pc->ops->applytranspose      = PCApply_Jacobi;
   pc->ops->setup               = PCSetUp_Jacobi;
   pc->ops->reset               = PCReset_Jacobi;
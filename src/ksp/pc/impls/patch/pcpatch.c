@@ -5,7 +5,6 @@
 #include <petscsf.h>
 #include <petscbt.h>
 #include <petscds.h>
-#include <../src/mat/impls/dense/seq/dense.h> /*I "petscmat.h" I*/
 
 PetscLogEvent PC_Patch_CreatePatches, PC_Patch_ComputeOp, PC_Patch_Solve, PC_Patch_Apply, PC_Patch_Prealloc;
 
@@ -2208,15 +2207,6 @@ PetscErrorCode PCPatchComputeOperator_Internal(PC pc, Vec x, Mat mat, PetscInt p
   ierr = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
   ierr = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
 
-  if (!(withArtificial || isNonlinear) && patch->denseinverse) {
-    MatFactorInfo info;
-    PetscBool     flg;
-    ierr = PetscObjectTypeCompare((PetscObject)mat, MATSEQDENSE, &flg);CHKERRQ(ierr);
-    if (!flg) SETERRQ(PetscObjectComm((PetscObject)pc), PETSC_ERR_ARG_WRONGSTATE, "Invalid Mat type for dense inverse");
-    ierr = MatFactorInfoInitialize(&info);CHKERRQ(ierr);
-    ierr = MatLUFactor(mat, NULL, NULL, &info);CHKERRQ(ierr);
-    ierr = MatSeqDenseInvertFactors_Private(mat);CHKERRQ(ierr);
-  }
   PetscStackPop;
   ierr = ISDestroy(&patch->cellIS);CHKERRQ(ierr);
   if(withArtificial) {
@@ -2463,6 +2453,46 @@ PetscErrorCode PCPatch_ScatterLocal_Private(PC pc, PetscInt p, Vec x, Vec y, Ins
   PetscFunctionReturn(0);
 }
 
+/* Factor all the patch matrices together, the blocks of the same size are factored several at a time */
+static PetscErrorCode PCPatchFactorDense_Private(PC pc)
+{
+  PC_PATCH          *patch = (PC_PATCH *) pc->data;
+  PetscInt           i, m, n, lda, pStart, offset, *sizes;
+  const PetscScalar *a;
+  PetscBool          flg, zeropivot;
+  PetscErrorCode     ierr;
+
+  PetscFunctionBegin;
+  if (!patch->densebatch) {
+    ierr = PetscSectionGetChart(patch->gtolCounts, &pStart, NULL);CHKERRQ(ierr);
+    ierr = PetscMalloc1(patch->npatch, &sizes);CHKERRQ(ierr);
+    for (i = 0, n = 0; i < patch->npatch; ++i) {
+      ierr = PetscSectionGetDof(patch->gtolCounts, i+pStart, &sizes[i]);CHKERRQ(ierr);
+      ierr = PetscSectionGetOffset(patch->gtolCounts, i+pStart, &offset);CHKERRQ(ierr);
+      if (offset != n) SETERRQ(PETSC_COMM_SELF, PETSC_ERR_PLIB, "Patch dofs are not numbered contiguously");
+      n += sizes[i];
+    }
+    ierr = ISGetLocalSize(patch->gtol, &m);CHKERRQ(ierr);
+    if (m != n) SETERRQ2(PETSC_COMM_SELF, PETSC_ERR_PLIB, "Patch dofs %D do not match the local to patch map %D", n, m);
+    ierr = PetscBatchedDenseCreate(patch->npatch, sizes, &patch->densebatch);CHKERRQ(ierr);
+    ierr = PetscFree(sizes);CHKERRQ(ierr);
+    ierr = PetscMalloc1(n, &patch->denseWork);CHKERRQ(ierr);
+  }
+  for (i = 0; i < patch->npatch; ++i) {
+    ierr = MatGetSize(patch->mat[i], &m, &n);CHKERRQ(ierr);
+    if (!m) continue;
+    ierr = PetscObjectTypeCompare((PetscObject) patch->mat[i], MATSEQDENSE, &flg);CHKERRQ(ierr);
+    if (!flg) SETERRQ(PetscObjectComm((PetscObject)pc), PETSC_ERR_ARG_WRONGSTATE, "Invalid Mat type for dense inverse");
+    ierr = MatDenseGetLDA(patch->mat[i], &lda);CHKERRQ(ierr);
+    ierr = MatDenseGetArrayRead(patch->mat[i], &a);CHKERRQ(ierr);
+    ierr = PetscBatchedDenseSetBlock(patch->densebatch, i, a, lda);CHKERRQ(ierr);
+    ierr = MatDenseRestoreArrayRead(patch->mat[i], &a);CHKERRQ(ierr);
+  }
+  ierr = PetscBatchedDenseLUFactor(patch->densebatch, (PetscBool) !pc->erroriffailure, &zeropivot);CHKERRQ(ierr);
+  if (zeropivot) pc->failedreason = PC_FACTOR_NUMERIC_ZEROPIVOT;
+  PetscFunctionReturn(0);
+}
+
 static PetscErrorCode PCSetUp_PATCH_Linear(PC pc)
 {
   PC_PATCH      *patch = (PC_PATCH *) pc->data;
@@ -2500,11 +2530,11 @@ static PetscErrorCode PCSetUp_PATCH_Linear(PC pc)
       ierr = PCPatchComputeOperator_Internal(pc, NULL, patch->mat[i], i, PETSC_FALSE);CHKERRQ(ierr);
       if (!patch->denseinverse) {
         ierr = KSPSetOperators((KSP) patch->solver[i], patch->mat[i], patch->mat[i]);CHKERRQ(ierr);
-      } else if (patch->mat[i] && !patch->densesolve) {
-        /* Setup matmult callback */
-        ierr = MatGetOperation(patch->mat[i], MATOP_MULT, (void (**)(void))&patch->densesolve);CHKERRQ(ierr);
       }
     }
+    if (patch->denseinverse) {
+      ierr = PCPatchFactorDense_Private(pc);CHKERRQ(ierr);
+    }
   }
   if(patch->local_composition_type == PC_COMPOSITE_MULTIPLICATIVE) {
     for (i = 0; i < patch->npatch; ++i) {
@@ -2796,7 +2826,14 @@ static PetscErrorCode PCApply_PATCH_Linear(PC pc, PetscInt i, Vec x, Vec y)
 
   PetscFunctionBegin;
   if (patch->denseinverse) {
-    ierr = (*patch->densesolve)(patch->mat[i], x, y);CHKERRQ(ierr);
+    const PetscScalar *xx;
+    PetscScalar       *yy;
+
+    ierr = VecGetArrayRead(x, &xx);CHKERRQ(ierr);
+    ierr = VecGetArray(y, &yy);CHKERRQ(ierr);
+    ierr = PetscBatchedDenseLUSolveBlock(patch->densebatch, i, xx, yy);CHKERRQ(ierr);
+    ierr = VecRestoreArrayRead(x, &xx);CHKERRQ(ierr);
+    ierr = VecRestoreArray(y, &yy);CHKERRQ(ierr);
     PetscFunctionReturn(0);
   }
   ksp = (KSP) patch->solver[i];
@@ -2911,21 +2948,49 @@ static PetscErrorCode PCApply_PATCH(PC pc, Vec x, Vec y)
   ierr = VecSet(patch->localUpdate, 0.0);CHKERRQ(ierr);
   ierr = PetscSectionGetChart(patch->gtolCounts, &pStart, NULL);CHKERRQ(ierr);
   ierr = PetscLogEventBegin(PC_Patch_Solve, pc, 0, 0, 0);CHKERRQ(ierr);
-  for (sweep = 0; sweep < nsweep; sweep++) {
-    for (j = start[sweep]; j*inc[sweep] < end[sweep]*inc[sweep]; j += inc[sweep]) {
-      PetscInt i       = patch->user_patches ? iterationSet[j] : j;
-      PetscInt start, len;
-
-      ierr = PetscSectionGetDof(patch->gtolCounts, i+pStart, &len);CHKERRQ(ierr);
-      ierr = PetscSectionGetOffset(patch->gtolCounts, i+pStart, &start);CHKERRQ(ierr);
-      /* TODO: Squash out these guys in the setup as well. */
-      if (len <= 0) continue;
-      /* TODO: Do we need different scatters for X and Y? */
-      ierr = PCPatch_ScatterLocal_Private(pc, i+pStart, patch->localRHS, patch->patchRHS, INSERT_VALUES, SCATTER_FORWARD, SCATTER_INTERIOR);CHKERRQ(ierr);
-      ierr = (*patch->applysolver)(pc, i, patch->patchRHS, patch->patchUpdate);CHKERRQ(ierr);
-      ierr = PCPatch_ScatterLocal_Private(pc, i+pStart, patch->patchUpdate, patch->localUpdate, ADD_VALUES, SCATTER_REVERSE, SCATTER_INTERIOR);CHKERRQ(ierr);
-      if(patch->local_composition_type == PC_COMPOSITE_MULTIPLICATIVE) {
-        ierr = (*patch->updatemultiplicative)(pc, i, pStart);CHKERRQ(ierr);
+  if (patch->densebatch && patch->applysolver == PCApply_PATCH_Linear && patch->local_composition_type == PC_COMPOSITE_ADDITIVE) {
+    /* The patch solves are independent: solve all of them at once and add the updates in the order of the sweeps */
+    const PetscScalar *rhs;
+    PetscScalar       *update;
+    const PetscInt    *gtol;
+    PetscInt           ndof, k;
+
+    ierr = ISGetLocalSize(patch->gtol, &ndof);CHKERRQ(ierr);
+    ierr = ISGetIndices(patch->gtol, &gtol);CHKERRQ(ierr);
+    ierr = VecGetArrayRead(patch->localRHS, &rhs);CHKERRQ(ierr);
+    for (k = 0; k < ndof; ++k) patch->denseWork[k] = rhs[gtol[k]];
+    ierr = VecRestoreArrayRead(patch->localRHS, &rhs);CHKERRQ(ierr);
+    ierr = PetscBatchedDenseLUSolve(patch->densebatch, patch->denseWork, patch->denseWork);CHKERRQ(ierr);
+    ierr = VecGetArray(patch->localUpdate, &update);CHKERRQ(ierr);
+    for (sweep = 0; sweep < nsweep; sweep++) {
+      for (j = start[sweep]; j*inc[sweep] < end[sweep]*inc[sweep]; j += inc[sweep]) {
+        PetscInt i = patch->user_patches ? iterationSet[j] : j;
+        PetscInt start, len;
+
+        ierr = PetscSectionGetDof(patch->gtolCounts, i+pStart, &len);CHKERRQ(ierr);
+        ierr = PetscSectionGetOffset(patch->gtolCounts, i+pStart, &start);CHKERRQ(ierr);
+        for (k = start; k < start+len; ++k) update[gtol[k]] += patch->denseWork[k];
+      }
+    }
+    ierr = VecRestoreArray(patch->localUpdate, &update);CHKERRQ(ierr);
+    ierr = ISRestoreIndices(patch->gtol, &gtol);CHKERRQ(ierr);
+  } else {
+    for (sweep = 0; sweep < nsweep; sweep++) {
+      for (j = start[sweep]; j*inc[sweep] < end[sweep]*inc[sweep]; j += inc[sweep]) {
+        PetscInt i       = patch->user_patches ? iterationSet[j] : j;
+        PetscInt start, len;
+
+        ierr = PetscSectionGetDof(patch->gtolCounts, i+pStart, &len);CHKERRQ(ierr);
+        ierr = PetscSectionGetOffset(patch->gtolCounts, i+pStart, &start);CHKERRQ(ierr);
+        /* TODO: Squash out these guys in the setup as well. */
+        if (len <= 0) continue;
+        /* TODO: Do we need different scatters for X and Y? */
+        ierr = PCPatch_ScatterLocal_Private(pc, i+pStart, patch->localRHS, patch->patchRHS, INSERT_VALUES, SCATTER_FORWARD, SCATTER_INTERIOR);CHKERRQ(ierr);
+        ierr = (*patch->applysolver)(pc, i, patch->patchRHS, patch->patchUpdate);CHKERRQ(ierr);
+        ierr = PCPatch_ScatterLocal_Private(pc, i+pStart, patch->patchUpdate, patch->localUpdate, ADD_VALUES, SCATTER_REVERSE, SCATTER_INTERIOR);CHKERRQ(ierr);
+        if(patch->local_composition_type == PC_COMPOSITE_MULTIPLICATIVE) {
+          ierr = (*patch->updatemultiplicative)(pc, i, pStart);CHKERRQ(ierr);
+        }
       }
     }
   }
@@ -2972,6 +3037,8 @@ static PetscErrorCode PCReset_PATCH_Linear(PC pc)
   if (patch->solver) {
     for (i = 0; i < patch->npatch; ++i) {ierr = KSPReset((KSP) patch->solver[i]);CHKERRQ(ierr);}
   }
+  ierr = PetscBatchedDenseDestroy(&patch->densebatch);CHKERRQ(ierr);
+  ierr = PetscFree(patch->denseWork);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
@@ -3128,7 +3195,7 @@ static PetscErrorCode PCSetFromOptions_PATCH(PetscOptionItems *PetscOptionsObjec
   ierr = PetscOptionsEnum(option,"Type of local solver composition (additive or multiplicative)","PCPatchSetLocalComposition",PCCompositeTypes,(PetscEnum)loctype,(PetscEnum*)&loctype,&flg);CHKERRQ(ierr);
   if(flg) { ierr = PCPatchSetLocalComposition(pc, loctype);CHKERRQ(ierr);}
   ierr = PetscSNPrintf(option, PETSC_MAX_PATH_LEN, "-%s_patch_dense_inverse", patch->classname);CHKERRQ(ierr);
-  ierr = PetscOptionsBool(option, "Compute inverses of patch matrices and apply directly? Ignores KSP/PC settings on patch.", "PCPatchSetDenseInverse", patch->denseinverse, &patch->denseinverse, &flg);CHKERRQ(ierr);
+  ierr = PetscOptionsBool(option, "Factor the dense patch matrices directly and solve with the factors? Ignores KSP/PC settings on patch.", "PCPatchSetDenseInverse", patch->denseinverse, &patch->denseinverse, &flg);CHKERRQ(ierr);
   ierr = PetscSNPrintf(option, PETSC_MAX_PATH_LEN, "-%s_patch_construct_dim", patch->classname);CHKERRQ(ierr);
   ierr = PetscOptionsInt(option, "What dimension of mesh point to construct patches by? (0 = vertices)", "PCPATCH", patch->dim, &patch->dim, &dimflg);CHKERRQ(ierr);
   ierr = PetscSNPrintf(option, PETSC_MAX_PATH_LEN, "-%s_patch_construct_codim", patch->classname);CHKERRQ(ierr);
@@ -3254,7 +3321,7 @@ static PetscErrorCode PCView_PATCH(PC pc, PetscViewer viewer)
   else                                                        {ierr = PetscViewerASCIIPrintf(viewer, "Patch construction operator: unknown\n");CHKERRQ(ierr);}
 
   if (patch->denseinverse) {
-    ierr = PetscViewerASCIIPrintf(viewer, "Explicitly forming dense inverse and applying patch solver via MatMult.\n");CHKERRQ(ierr);
+    ierr = PetscViewerASCIIPrintf(viewer, "Factoring the dense patch matrices in batches and applying the patch solver with batched LU solves.\n");CHKERRQ(ierr);
   } else {
     if (patch->isNonlinear) {
       ierr = PetscViewerASCIIPrintf(viewer, "SNES on patches (all same):\n");CHKERRQ(ierr);
@@ -3335,7 +3402,8 @@ PETSC_EXTERN PetscErrorCode PCCreate_Patch(PC pc)
   patch->viewPoints         = PETSC_FALSE;
   patch->viewSection        = PETSC_FALSE;
   patch->viewMatrix         = PETSC_FALSE;
-  patch->densesolve         = NULL;
+  patch->densebatch         = NULL;
+  patch->denseWork          = NULL;
   patch->setupsolver        = PCSetUp_PATCH_Linear;
   patch->applysolver        = PCApply_PATCH_Linear;
   patch->resetsolver        = PCReset_PATCH_Linear;
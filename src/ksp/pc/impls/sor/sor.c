@@ -3,6 +3,8 @@
    Defines a  (S)SOR  preconditioner for any Mat implementation
 */
 #include <petsc/private/pcimpl.h>               /*I "petscpc.h" I*/
+#include <../src/mat/impls/aij/seq/aij.h>
+#include <../src/mat/impls/aij/mpi/mpiaij.h>
 
 typedef struct {
   PetscInt   its;         /* inner iterations, number of sweeps */
@@ -33,6 +35,45 @@ static PetscErrorCode PCApply_SOR(PC pc,Vec x,Vec y)
   PetscFunctionReturn(0);
 }
 
+/*
+   A single zero initial guess sweep on a MATSEQAIJ matrix, or a local one on the diagonal block of a MATMPIAIJ matrix
+   that needs no communication, is applied to all the columns at once; the other configurations, including the inode
+   block sweeps, are applied one column at a time
+*/
+static PetscErrorCode PCMatApply_SOR(PC pc,Mat X,Mat Y)
+{
+  PC_SOR            *jac = (PC_SOR*)pc->data;
+  PetscErrorCode    ierr;
+  Mat               A = NULL;
+  PetscBool         isseq,ismpi;
+  PetscInt          N,ldx,ldy;
+  const PetscScalar *x;
+  PetscScalar       *y;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)pc->pmat,MATSEQAIJ,&isseq);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)pc->pmat,MATMPIAIJ,&ismpi);CHKERRQ(ierr);
+  if (jac->its*jac->lits == 1 && !(jac->sym & SOR_EISENSTAT)) {
+    if (isseq) A = pc->pmat;
+    else if (ismpi && !(jac->sym & ~SOR_LOCAL_SYMMETRIC_SWEEP)) A = ((Mat_MPIAIJ*)pc->pmat->data)->A;
+  }
+  if (!A || A->ops->sor != MatSOR_SeqAIJ) {
+    ierr = PCMatApply_Columns_Private(pc,X,Y);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = MatGetSize(X,NULL,&N);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Y,&ldy);CHKERRQ(ierr);
+  ierr = MatDenseGetArrayRead(X,&x);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(Y,&y);CHKERRQ(ierr);
+  ierr = MatSORDense_SeqAIJ_Private(A,N,x,ldx,jac->omega,jac->sym,jac->fshift,y,ldy);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(Y,&y);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArrayRead(X,&x);CHKERRQ(ierr);
+  pc->pmat->factorerrortype = A->factorerrortype;
+  ierr = MatFactorGetError(pc->pmat,(MatFactorError*)&pc->failedreason);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 static PetscErrorCode PCApplyTranspose_SOR(PC pc,Vec x,Vec y)
 {
   PC_SOR         *jac = (PC_SOR*)pc->data;
@@ -443,6 +484,7 @@ PETSC_EXTERN PetscErrorCode PCCreate_SOR(PC pc)
   ierr = PetscNewLog(pc,&jac);CHKERRQ(ierr);
 
   pc->ops->apply           = PCApply_SOR;
+  pc->ops->matapply        = PCMatApply_SOR;
   pc->ops->applytranspose  = PCApplyTranspose_SOR;
   pc->ops->applyrichardson = PCApplyRichardson_SOR;
   pc->ops->setfromoptions  = PCSetFromOptions_SOR;
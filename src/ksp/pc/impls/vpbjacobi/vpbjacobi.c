@@ -5,12 +5,14 @@
 */
 
 #include <petsc/private/pcimpl.h>   /*I "petscpc.h" I*/
+#include <petsc/private/kernels/batcheddense.h>
 
 /*
    Private context (data structure) for the VPBJacobi preconditioner.
 */
 typedef struct {
-  MatScalar *diag;
+  MatScalar         *diag;
+  PetscBatchedDense batch;   /* the inverses of the blocks, interleaved across blocks of equal size */
 } PC_VPBJacobi;
 
 
@@ -18,88 +20,18 @@ static PetscErrorCode PCApply_VPBJacobi(PC pc,Vec x,Vec y)
 {
   PC_VPBJacobi      *jac = (PC_VPBJacobi*)pc->data;
   PetscErrorCode    ierr;
-  PetscInt          i,ncnt = 0;
-  const MatScalar   *diag = jac->diag;
-  PetscInt          ib,jb,bs;
   const PetscScalar *xx;
-  PetscScalar       *yy,x0,x1,x2,x3,x4,x5,x6;
-  PetscInt          nblocks;
-  const PetscInt    *bsizes;
+  PetscScalar       *yy;
 
   PetscFunctionBegin;
-  ierr = MatGetVariableBlockSizes(pc->pmat,&nblocks,&bsizes);CHKERRQ(ierr);
   ierr = VecGetArrayRead(x,&xx);CHKERRQ(ierr);
   ierr = VecGetArray(y,&yy);CHKERRQ(ierr);
-  for (i=0; i<nblocks; i++) {
-    bs = bsizes[i];
-    switch (bs) {
-    case 1:
-      yy[ncnt] = *diag*xx[ncnt];
-      break;
-    case 2:
-      x0         = xx[ncnt]; x1 = xx[ncnt+1];
-      yy[ncnt]   = diag[0]*x0 + diag[2]*x1;
-      yy[ncnt+1] = diag[1]*x0 + diag[3]*x1;
-      break;
-    case 3:
-      x0 = xx[ncnt]; x1 = xx[ncnt+1]; x2 = xx[ncnt+2];
-      yy[ncnt]   = diag[0]*x0 + diag[3]*x1 + diag[6]*x2;
-      yy[ncnt+1] = diag[1]*x0 + diag[4]*x1 + diag[7]*x2;
-      yy[ncnt+2] = diag[2]*x0 + diag[5]*x1 + diag[8]*x2;
-      break;
-    case 4:
-      x0 = xx[ncnt]; x1 = xx[ncnt+1]; x2 = xx[ncnt+2]; x3 = xx[ncnt+3];
-      yy[ncnt]   = diag[0]*x0 + diag[4]*x1 + diag[8]*x2  + diag[12]*x3;
-      yy[ncnt+1] = diag[1]*x0 + diag[5]*x1 + diag[9]*x2  + diag[13]*x3;
-      yy[ncnt+2] = diag[2]*x0 + diag[6]*x1 + diag[10]*x2 + diag[14]*x3;
-      yy[ncnt+3] = diag[3]*x0 + diag[7]*x1 + diag[11]*x2 + diag[15]*x3;
-      break;
-    case 5:
-      x0 = xx[ncnt]; x1 = xx[ncnt+1]; x2 = xx[ncnt+2]; x3 = xx[ncnt+3]; x4 = xx[ncnt+4];
-      yy[ncnt]   = diag[0]*x0 + diag[5]*x1 + diag[10]*x2  + diag[15]*x3 + diag[20]*x4;
-      yy[ncnt+1] = diag[1]*x0 + diag[6]*x1 + diag[11]*x2  + diag[16]*x3 + diag[21]*x4;
-      yy[ncnt+2] = diag[2]*x0 + diag[7]*x1 + diag[12]*x2 + diag[17]*x3 + diag[22]*x4;
-      yy[ncnt+3] = diag[3]*x0 + diag[8]*x1 + diag[13]*x2 + diag[18]*x3 + diag[23]*x4;
-      yy[ncnt+4] = diag[4]*x0 + diag[9]*x1 + diag[14]*x2 + diag[19]*x3 + diag[24]*x4;
-      break;
-    case 6:
-      x0 = xx[ncnt]; x1 = xx[ncnt+1]; x2 = xx[ncnt+2]; x3 = xx[ncnt+3]; x4 = xx[ncnt+4]; x5 = xx[ncnt+5];
-      yy[ncnt]   = diag[0]*x0 + diag[6]*x1  + diag[12]*x2  + diag[18]*x3 + diag[24]*x4 + diag[30]*x5;
-      yy[ncnt+1] = diag[1]*x0 + diag[7]*x1  + diag[13]*x2  + diag[19]*x3 + diag[25]*x4 + diag[31]*x5;
-      yy[ncnt+2] = diag[2]*x0 + diag[8]*x1  + diag[14]*x2  + diag[20]*x3 + diag[26]*x4 + diag[32]*x5;
-      yy[ncnt+3] = diag[3]*x0 + diag[9]*x1  + diag[15]*x2  + diag[21]*x3 + diag[27]*x4 + diag[33]*x5;
-      yy[ncnt+4] = diag[4]*x0 + diag[10]*x1 + diag[16]*x2  + diag[22]*x3 + diag[28]*x4 + diag[34]*x5;
-      yy[ncnt+5] = diag[5]*x0 + diag[11]*x1 + diag[17]*x2  + diag[23]*x3 + diag[29]*x4 + diag[35]*x5;
-      break;
-    case 7:
-      x0 = xx[ncnt]; x1 = xx[ncnt+1]; x2 = xx[ncnt+2]; x3 = xx[ncnt+3]; x4 = xx[ncnt+4]; x5 = xx[ncnt+5]; x6 = xx[ncnt+6];
-      yy[ncnt]   = diag[0]*x0 + diag[7]*x1  + diag[14]*x2  + diag[21]*x3 + diag[28]*x4 + diag[35]*x5 + diag[42]*x6;
-      yy[ncnt+1] = diag[1]*x0 + diag[8]*x1  + diag[15]*x2  + diag[22]*x3 + diag[29]*x4 + diag[36]*x5 + diag[43]*x6;
-      yy[ncnt+2] = diag[2]*x0 + diag[9]*x1  + diag[16]*x2  + diag[23]*x3 + diag[30]*x4 + diag[37]*x5 + diag[44]*x6;
-      yy[ncnt+3] = diag[3]*x0 + diag[10]*x1 + diag[17]*x2  + diag[24]*x3 + diag[31]*x4 + diag[38]*x5 + diag[45]*x6;
-      yy[ncnt+4] = diag[4]*x0 + diag[11]*x1 + diag[18]*x2  + diag[25]*x3 + diag[32]*x4 + diag[39]*x5 + diag[46]*x6;
-      yy[ncnt+5] = diag[5]*x0 + diag[12]*x1 + diag[19]*x2  + diag[26]*x3 + diag[33]*x4 + diag[40]*x5 + diag[47]*x6;
-      yy[ncnt+6] = diag[6]*x0 + diag[13]*x1 + diag[20]*x2  + diag[27]*x3 + diag[34]*x4 + diag[41]*x5 + diag[48]*x6;
-      break;
-    default:
-      for (ib=0; ib<bs; ib++){
-        PetscScalar rowsum = 0;
-        for (jb=0; jb<bs; jb++){
-          rowsum += diag[ib+jb*bs] * xx[ncnt+jb];
-        }
-        yy[ncnt+ib] = rowsum;
-      }
-    }
-    ncnt += bsizes[i];
-    diag += bsizes[i]*bsizes[i];
-  }
+  ierr = PetscBatchedDenseMult(jac->batch,xx,yy);CHKERRQ(ierr);
   ierr = VecRestoreArrayRead(x,&xx);CHKERRQ(ierr);
   ierr = VecRestoreArray(y,&yy);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
-
-
 /* -------------------------------------------------------------------------- */
 static PetscErrorCode PCSetUp_VPBJacobi(PC pc)
 {
@@ -110,6 +42,7 @@ static PetscErrorCode PCSetUp_VPBJacobi(PC pc)
   PetscInt       i,nsize = 0,nlocal;
   PetscInt       nblocks;
   const PetscInt *bsizes;
+  MatScalar      *diag;
 
   PetscFunctionBegin;
   ierr = MatGetVariableBlockSizes(pc->pmat,&nblocks,&bsizes);CHKERRQ(ierr);
@@ -122,6 +55,10 @@ static PetscErrorCode PCSetUp_VPBJacobi(PC pc)
   ierr = MatInvertVariableBlockDiagonal(A,nblocks,bsizes,jac->diag);CHKERRQ(ierr);
   ierr = MatFactorGetError(A,&err);CHKERRQ(ierr);
   if (err) pc->failedreason = (PCFailedReason)err;
+  if (!jac->batch) {ierr = PetscBatchedDenseCreate(nblocks,bsizes,&jac->batch);CHKERRQ(ierr);}
+  for (i=0, diag=jac->diag; i<nblocks; diag+=bsizes[i]*bsizes[i], i++) {
+    ierr = PetscBatchedDenseSetBlock(jac->batch,i,diag,bsizes[i]);CHKERRQ(ierr);
+  }
   pc->ops->apply = PCApply_VPBJacobi;
   PetscFunctionReturn(0);
 }
@@ -136,6 +73,7 @@ static PetscErrorCode PCDestroy_VPBJacobi(PC pc)
       Free the private data structure that was hanging off the PC
   */
   ierr = PetscFree(jac->diag);CHKERRQ(ierr);
+  ierr = PetscBatchedDenseDestroy(&jac->batch);CHKERRQ(ierr);
   ierr = PetscFree(pc->data);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -151,7 +89,8 @@ static PetscErrorCode PCDestroy_VPBJacobi(PC pc)
    This works for AIJ matrices
 
    Uses dense LU factorization with partial pivoting to invert the blocks; if a zero pivot
-   is detected a PETSc error is generated.
+   is detected a PETSc error is generated. The inverses are applied with PetscBatchedDenseMult(), several blocks
+   of the same size at a time.
 
    One must call MatSetVariableBlockSizes() to use this preconditioner
    Developer Notes:
@@ -29,6 +29,7 @@ PETSC_EXTERN PetscErrorCode PCCreate_Redistribute(PC);
 PETSC_EXTERN PetscErrorCode PCCreate_SVD(PC);
 PETSC_EXTERN PetscErrorCode PCCreate_GAMG(PC);
 PETSC_EXTERN PetscErrorCode PCCreate_Kaczmarz(PC);
+PETSC_EXTERN PetscErrorCode PCCreate_ChowILU(PC);
 PETSC_EXTERN PetscErrorCode PCCreate_Telescope(PC);
 PETSC_EXTERN PetscErrorCode PCCreate_Patch(PC);
 PETSC_EXTERN PetscErrorCode PCCreate_LMVM(PC);
@@ -111,6 +112,7 @@ PetscErrorCode  PCRegisterAll(void)
   ierr = PCRegister(PCSVD          ,PCCreate_SVD);CHKERRQ(ierr);
   ierr = PCRegister(PCGAMG         ,PCCreate_GAMG);CHKERRQ(ierr);
   ierr = PCRegister(PCKACZMARZ     ,PCCreate_Kaczmarz);CHKERRQ(ierr);
+  ierr = PCRegister(PCCHOWILU      ,PCCreate_ChowILU);CHKERRQ(ierr);
   ierr = PCRegister(PCTELESCOPE    ,PCCreate_Telescope);CHKERRQ(ierr);
   ierr = PCRegister(PCPATCH        ,PCCreate_Patch);CHKERRQ(ierr);
   ierr = PCRegister(PCHMG          ,PCCreate_HMG);CHKERRQ(ierr);
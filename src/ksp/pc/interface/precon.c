@@ -8,7 +8,7 @@
 /* Logging support */
 PetscClassId  PC_CLASSID;
 PetscLogEvent PC_SetUp, PC_SetUpOnBlocks, PC_Apply, PC_ApplyCoarse, PC_ApplyMultiple, PC_ApplySymmetricLeft;
-PetscLogEvent PC_ApplySymmetricRight, PC_ModifySubMatrices, PC_ApplyOnBlocks, PC_ApplyTransposeOnBlocks;
+PetscLogEvent PC_ApplySymmetricRight, PC_ModifySubMatrices, PC_ApplyOnBlocks, PC_ApplyTransposeOnBlocks, PC_MatApply;
 PetscInt      PetscMGLevelId;
 
 PetscErrorCode PCGetDefaultType_Private(PC pc,const char *type[])
@@ -448,6 +448,99 @@ PetscErrorCode  PCApply(PC pc,Vec x,Vec y)
   PetscFunctionReturn(0);
 }
 
+/*@
+   PCMatApply - Applies the preconditioner to each column of a dense matrix.
+
+   Collective on PC
+
+   Input Parameters:
++  pc - the preconditioner context
+-  X - block of input vectors, a MATSEQDENSE or MATMPIDENSE matrix
+
+   Output Parameter:
+.  Y - block of output vectors, a dense matrix of the same type and sizes as X
+
+   Notes:
+   Preconditioners that can apply themselves to several vectors at once, e.g. PCJACOBI, PCILU, PCLU, PCICC,
+   PCCHOLESKY or PCBJACOBI with one block per process, do so while reading their data once for all the columns.
+   PCSOR does so for one sweep of a MATSEQAIJ matrix without inodes, or one local sweep of the diagonal block of a
+   MATMPIAIJ matrix. The others, including PCMG and PCGAMG, are applied to one column at a time with PCApply().
+
+   Level: developer
+
+.seealso: PCApply(), KSPMatSolve()
+@*/
+PetscErrorCode  PCMatApply(PC pc,Mat X,Mat Y)
+{
+  PetscErrorCode ierr;
+  PetscInt       m,n,nx,my,ny,N;
+  PetscBool      match;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pc,PC_CLASSID,1);
+  PetscValidHeaderSpecific(X,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(Y,MAT_CLASSID,3);
+  PetscCheckSameComm(pc,1,X,2);
+  PetscCheckSameComm(pc,1,Y,3);
+  if (X == Y) SETERRQ(PetscObjectComm((PetscObject)pc),PETSC_ERR_ARG_IDN,"X and Y must be different matrices");
+  ierr = PetscObjectTypeCompareAny((PetscObject)X,&match,MATSEQDENSE,MATMPIDENSE,"");CHKERRQ(ierr);
+  if (!match) SETERRQ(PetscObjectComm((PetscObject)pc),PETSC_ERR_ARG_WRONG,"Provided block of input vectors not stored in a dense Mat");
+  ierr = PetscObjectTypeCompareAny((PetscObject)Y,&match,MATSEQDENSE,MATMPIDENSE,"");CHKERRQ(ierr);
+  if (!match) SETERRQ(PetscObjectComm((PetscObject)pc),PETSC_ERR_ARG_WRONG,"Provided block of output vectors not stored in a dense Mat");
+  ierr = MatGetLocalSize(pc->pmat,&m,&n);CHKERRQ(ierr);
+  ierr = MatGetLocalSize(X,&nx,NULL);CHKERRQ(ierr);
+  ierr = MatGetLocalSize(Y,&my,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(X,NULL,&N);CHKERRQ(ierr);
+  ierr = MatGetSize(Y,NULL,&ny);CHKERRQ(ierr);
+  if (my != m) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Preconditioner number of local rows %D does not equal output block number of local rows %D",m,my);
+  if (nx != n) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Preconditioner number of local columns %D does not equal input block number of local rows %D",n,nx);
+  if (ny != N) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Input block number of columns %D does not equal output block number of columns %D",N,ny);
+
+  ierr = PCSetUp(pc);CHKERRQ(ierr);
+  if (pc->ops->matapply) {
+    ierr = PetscLogEventBegin(PC_MatApply,pc,X,Y,0);CHKERRQ(ierr);
+    ierr = (*pc->ops->matapply)(pc,X,Y);CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(PC_MatApply,pc,X,Y,0);CHKERRQ(ierr);
+  } else {
+    ierr = PCMatApply_Columns_Private(pc,X,Y);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/*
+   PCMatApply_Columns_Private - Applies the preconditioner with PCApply() to one column of X at a time, for the
+   preconditioners without a blocked application or with one that does not support the current configuration
+*/
+PetscErrorCode PCMatApply_Columns_Private(PC pc,Mat X,Mat Y)
+{
+  PetscErrorCode ierr;
+  PetscInt       N,i,ldx,ldy;
+  Vec            x,y;
+  PetscScalar    *xa,*ya;
+
+  PetscFunctionBegin;
+  ierr = PetscInfo1(pc,"PC type %s applying column by column\n",((PetscObject)pc)->type_name);CHKERRQ(ierr);
+  ierr = MatGetSize(X,NULL,&N);CHKERRQ(ierr);
+  ierr = MatCreateVecs(X,NULL,&x);CHKERRQ(ierr);
+  ierr = MatCreateVecs(Y,NULL,&y);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Y,&ldy);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseGetArray(Y,&ya);CHKERRQ(ierr);
+  for (i=0; i<N; i++) {
+    ierr = VecPlaceArray(x,xa+i*ldx);CHKERRQ(ierr);
+    ierr = VecPlaceArray(y,ya+i*ldy);CHKERRQ(ierr);
+    ierr = PCApply(pc,x,y);CHKERRQ(ierr);
+    ierr = VecResetArray(x);CHKERRQ(ierr);
+    ierr = VecResetArray(y);CHKERRQ(ierr);
+  }
+  ierr = MatDenseRestoreArray(X,&xa);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(Y,&ya);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 /*@
    PCApplySymmetricLeft - Applies the left part of a symmetric preconditioner to a vector.
 
@@ -419,7 +419,7 @@ static PetscErrorCode heavyEdgeMatchAgg(IS perm,Mat a_Gmat,PetscCoarsenData **a_
   PetscErrorCode   ierr;
   PetscBool        isMPI;
   MPI_Comm         comm;
-  PetscInt         sub_it,kk,n,ix,*idx,*ii,iter,Iend,my0;
+  PetscInt         sub_it,kk,n,ix,*idx,*ii,iter,Iend,my0,nt;
   PetscMPIInt      rank,size;
   const PetscInt   nloc = a_Gmat->rmap->n,n_iter=6; /* need to figure out how to stop this */
   PetscInt         *lid_cprowID,*lid_gid;
@@ -458,13 +458,15 @@ static PetscErrorCode heavyEdgeMatchAgg(IS perm,Mat a_Gmat,PetscCoarsenData **a_
   /* make a copy of the graph, this gets destroyed in iterates */
   ierr = MatDuplicate(a_Gmat,MAT_COPY_VALUES,&cMat);CHKERRQ(ierr);
   ierr = PetscObjectTypeCompare((PetscObject)a_Gmat, MATMPIAIJ, &isMPI);CHKERRQ(ierr);
+  /* the threads of the (diagonal block of the) graph set up the edges, the matching itself goes through the sorted edges */
+  nt   = ((Mat_SeqAIJ*)(isMPI ? ((Mat_MPIAIJ*)a_Gmat->data)->A->data : a_Gmat->data))->threads.nthreads;
   iter = 0;
   while (iter++ < n_iter) {
-    PetscScalar    *cpcol_gid,*cpcol_max_ew,*cpcol_max_pe,*lid_max_ew;
+    PetscScalar    *cpcol_gid,*cpcol_max_ew,*cpcol_max_pe,*lid_max_ew,*lid_max_pe;
     PetscBool      *cpcol_matched;
     PetscMPIInt    *cpcol_pe,proc;
     Vec            locMaxEdge,locMaxPE,ghostMaxEdge,ghostMaxPE;
-    PetscInt       nEdges,n_nz_row,jj;
+    PetscInt       nEdges,n_nz_row,jj,*eoff;
     Edge           *Edges;
     PetscInt       gid;
     const PetscInt *perm_ix, n_sub_its = 120;
@@ -535,39 +537,41 @@ static PetscErrorCode heavyEdgeMatchAgg(IS perm,Mat a_Gmat,PetscCoarsenData **a_
     }
 
     /* compute 'locMaxEdge' & 'locMaxPE', and create list of edges, count edges' */
-    for (nEdges=0,kk=0,gid=my0; kk<nloc; kk++,gid++) {
-      PetscReal   max_e = 0., tt;
-      PetscScalar vval;
-      PetscInt    lid   = kk;
-      PetscMPIInt max_pe=rank,pe;
-
-      ii = matA->i; n = ii[lid+1] - ii[lid]; idx = matA->j + ii[lid];
-      ap = matA->a + ii[lid];
+    ierr = VecGetArray(locMaxEdge, &lid_max_ew);CHKERRQ(ierr);
+    ierr = VecGetArray(locMaxPE, &lid_max_pe);CHKERRQ(ierr);
+    nEdges = 0;
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) reduction(+:nEdges)
+#endif
+    for (kk=0; kk<nloc; kk++) {
+      PetscReal       max_e = 0., tt;
+      PetscInt        lid   = kk,jj,n,ix;
+      PetscMPIInt     max_pe=rank,pe;
+      const PetscInt  *idx;
+      const MatScalar *ap;
+
+      n = matA->i[lid+1] - matA->i[lid]; idx = matA->j + matA->i[lid];
+      ap = matA->a + matA->i[lid];
       for (jj=0; jj<n; jj++) {
         PetscInt lidj = idx[jj];
         if (lidj != lid && PetscRealPart(ap[jj]) > max_e) max_e = PetscRealPart(ap[jj]);
         if (lidj > lid) nEdges++;
       }
       if ((ix=lid_cprowID[lid]) != -1) { /* if I have any ghost neighbors */
-        ii  = matB->compressedrow.i; n = ii[ix+1] - ii[ix];
-        ap  = matB->a + ii[ix];
-        idx = matB->j + ii[ix];
+        n   = matB->compressedrow.i[ix+1] - matB->compressedrow.i[ix];
+        ap  = matB->a + matB->compressedrow.i[ix];
+        idx = matB->j + matB->compressedrow.i[ix];
         for (jj=0; jj<n; jj++) {
           if ((tt=PetscRealPart(ap[jj])) > max_e) max_e = tt;
           nEdges++;
           if ((pe=cpcol_pe[idx[jj]]) > max_pe) max_pe = pe;
         }
       }
-      vval = max_e;
-      ierr = VecSetValues(locMaxEdge, 1, &gid, &vval, INSERT_VALUES);CHKERRQ(ierr);
-
-      vval = (PetscScalar)max_pe;
-      ierr = VecSetValues(locMaxPE, 1, &gid, &vval, INSERT_VALUES);CHKERRQ(ierr);
+      lid_max_ew[kk] = max_e;
+      lid_max_pe[kk] = (PetscScalar)max_pe;
     }
-    ierr = VecAssemblyBegin(locMaxEdge);CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(locMaxEdge);CHKERRQ(ierr);
-    ierr = VecAssemblyBegin(locMaxPE);CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(locMaxPE);CHKERRQ(ierr);
+    ierr = VecRestoreArray(locMaxEdge, &lid_max_ew);CHKERRQ(ierr);
+    ierr = VecRestoreArray(locMaxPE, &lid_max_pe);CHKERRQ(ierr);
 
     /* get 'cpcol_max_ew' & 'cpcol_max_pe' */
     if (mpimat) {
@@ -582,43 +586,69 @@ static PetscErrorCode heavyEdgeMatchAgg(IS perm,Mat a_Gmat,PetscCoarsenData **a_
       ierr = VecGetArray(ghostMaxPE, &cpcol_max_pe);CHKERRQ(ierr);
     }
 
-    /* setup sorted list of edges */
+    /* setup list of edges in the order of 'perm', each vertex writes its edges from eoff[] */
     ierr = PetscMalloc1(nEdges, &Edges);CHKERRQ(ierr);
+    ierr = PetscMalloc1(nloc+1, &eoff);CHKERRQ(ierr);
     ierr = ISGetIndices(perm, &perm_ix);CHKERRQ(ierr);
-    for (nEdges=n_nz_row=kk=0; kk<nloc; kk++) {
-      PetscInt nn, lid = perm_ix[kk];
-      ii = matA->i; nn = n = ii[lid+1] - ii[lid]; idx = matA->j + ii[lid];
-      ap = matA->a + ii[lid];
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+    for (kk=0; kk<nloc; kk++) {
+      PetscInt lid = perm_ix[kk],ix,jj,ne = 0;
+
+      for (jj=matA->i[lid]; jj<matA->i[lid+1]; jj++) if (matA->j[jj] > lid) ne++;
+      if ((ix=lid_cprowID[lid]) != -1) ne += matB->compressedrow.i[ix+1] - matB->compressedrow.i[ix];
+      eoff[kk+1] = ne;
+    }
+    for (eoff[0]=kk=0; kk<nloc; kk++) eoff[kk+1] += eoff[kk];
+    n_nz_row = 0;
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) reduction(+:n_nz_row)
+#endif
+    for (kk=0; kk<nloc; kk++) {
+      PetscInt        nn,n,lid = perm_ix[kk],ix,jj,ne = eoff[kk];
+      const PetscInt  *idx;
+      const MatScalar *ap;
+
+      nn = n = matA->i[lid+1] - matA->i[lid]; idx = matA->j + matA->i[lid];
+      ap = matA->a + matA->i[lid];
       for (jj=0; jj<n; jj++) {
         PetscInt lidj = idx[jj];
         if (lidj > lid) {
-          Edges[nEdges].lid0   = lid;
-          Edges[nEdges].gid1   = lidj + my0;
-          Edges[nEdges].cpid1  = -1;
-          Edges[nEdges].weight = PetscRealPart(ap[jj]);
-          nEdges++;
+          Edges[ne].lid0   = lid;
+          Edges[ne].gid1   = lidj + my0;
+          Edges[ne].cpid1  = -1;
+          Edges[ne].weight = PetscRealPart(ap[jj]);
+          ne++;
         }
       }
       if ((ix=lid_cprowID[lid]) != -1) { /* if I have any ghost neighbors */
-        ii  = matB->compressedrow.i; n = ii[ix+1] - ii[ix];
-        ap  = matB->a + ii[ix];
-        idx = matB->j + ii[ix];
+        n   = matB->compressedrow.i[ix+1] - matB->compressedrow.i[ix];
+        ap  = matB->a + matB->compressedrow.i[ix];
+        idx = matB->j + matB->compressedrow.i[ix];
         nn += n;
         for (jj=0; jj<n; jj++) {
-          Edges[nEdges].lid0   = lid;
-          Edges[nEdges].gid1   = (PetscInt)PetscRealPart(cpcol_gid[idx[jj]]);
-          Edges[nEdges].cpid1  = idx[jj];
-          Edges[nEdges].weight = PetscRealPart(ap[jj]);
-          nEdges++;
+          Edges[ne].lid0   = lid;
+          Edges[ne].gid1   = (PetscInt)PetscRealPart(cpcol_gid[idx[jj]]);
+          Edges[ne].cpid1  = idx[jj];
+          Edges[ne].weight = PetscRealPart(ap[jj]);
+          ne++;
         }
       }
       if (nn > 1) n_nz_row++;
-      else if (iter == 1) {
-        /* should select this because it is technically in the MIS but lets not */
-        ierr = PetscCDRemoveAll(agg_llists, lid);CHKERRQ(ierr);
+    }
+    if (iter == 1) {
+      for (kk=0; kk<nloc; kk++) {
+        PetscInt lid = perm_ix[kk],nn = matA->i[lid+1] - matA->i[lid];
+        if ((ix=lid_cprowID[lid]) != -1) nn += matB->compressedrow.i[ix+1] - matB->compressedrow.i[ix];
+        if (nn <= 1) {
+          /* should select this because it is technically in the MIS but lets not */
+          ierr = PetscCDRemoveAll(agg_llists, lid);CHKERRQ(ierr);
+        }
       }
     }
     ierr = ISRestoreIndices(perm,&perm_ix);CHKERRQ(ierr);
+    ierr = PetscFree(eoff);CHKERRQ(ierr);
 
     qsort(Edges, nEdges, sizeof(Edge), gamg_hem_compare);
 
@@ -8,6 +8,137 @@
 #define MIS_REMOVED  -3
 #define MIS_IS_SELECTED(s) (s!=MIS_DELETED && s!=MIS_NOT_DONE && s!=MIS_REMOVED)
 
+#define MIS_SWEEP_OUT     0
+#define MIS_SWEEP_CAND    1
+#define MIS_SWEEP_BLOCKED 2
+#define MIS_SWEEP_SEL     3
+#define MIS_SWEEP_DEAD    4
+
+typedef struct {
+  PetscInt         nloc,my0,Iend;
+  const PetscInt   *perm_ix;     /* greedy ordering */
+  PetscInt         *prio;        /* priority of each vertex, the first in the greedy ordering is the highest */
+  Mat_SeqAIJ       *matA,*matB;  /* local and ghost adjacency, matB in compressed row storage */
+  const PetscInt   *lid_cprowID,*cpcol_gid,*cpcol_state;
+  char             *flag,*next;  /* state of each vertex in the sweep, winners of a round */
+  PetscInt         *parent;      /* selected vertex that takes a dead vertex */
+} MISSweep;
+
+/*
+   One sweep of maxIndSetAgg() over the local vertices with nt threads: Luby's algorithm with the fixed priorities
+   sw->prio[]. The vertices that are not blocked by an undone ghost on a higher process are candidates; in each round
+   the candidates with a higher priority than all their candidate neighbors are selected, and their undone neighbors
+   die. At the end each dead vertex goes to its selected neighbor with the highest priority. With the priorities of
+   the greedy ordering this selects the same vertices, and builds the same lists, as the serial sweep; only the lists
+   are filled serially, in the greedy ordering.
+*/
+static PetscErrorCode maxIndSetAggSweep_Threaded(MISSweep *sw,PetscInt nt,PetscBool strict_aggs,PetscInt lid_state[],PetscBool lid_removed[],PetscCoarsenData *agg_lists,PetscInt *a_nDone,PetscInt *a_nremoved,PetscInt *a_nselected)
+{
+  PetscErrorCode   ierr;
+  const PetscInt   nloc = sw->nloc,my0 = sw->my0,Iend = sw->Iend,*ai = sw->matA->i,*aj = sw->matA->j,*prio = sw->prio;
+  const PetscInt   *lid_cprowID = sw->lid_cprowID,*cpcol_gid = sw->cpcol_gid,*cpcol_state = sw->cpcol_state;
+  const Mat_SeqAIJ *matB = sw->matB;
+  char             *flag = sw->flag,*next = sw->next;
+  PetscInt         *parent = sw->parent,lid,kk,j,ix,n,nremoved = 0,nwin,nDone = 0,nselected = 0;
+
+  PetscFunctionBegin;
+  /* candidates, blocked vertices, and singletons that are removed */
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) private(j,ix,n) reduction(+:nremoved)
+#endif
+  for (lid=0; lid<nloc; lid++) {
+    char f = MIS_SWEEP_CAND;
+
+    if (lid_removed[lid] || lid_state[lid] != MIS_NOT_DONE) f = MIS_SWEEP_OUT;
+    else if ((ix=lid_cprowID[lid]) != -1) {
+      for (j=matB->compressedrow.i[ix]; j<matB->compressedrow.i[ix+1]; j++) {
+        if (cpcol_state[matB->j[j]] == MIS_NOT_DONE && cpcol_gid[matB->j[j]] >= Iend) {f = MIS_SWEEP_BLOCKED; break;}
+      }
+    }
+    if (f == MIS_SWEEP_CAND && ai[lid+1] - ai[lid] < 2) {
+      ix = lid_cprowID[lid];
+      n  = (ix == -1) ? 0 : matB->compressedrow.i[ix+1] - matB->compressedrow.i[ix];
+      if (!n) { /* one local adj (me) and no ghost - singleton */
+        lid_removed[lid] = PETSC_TRUE;
+        f                = MIS_SWEEP_OUT;
+        nremoved++;
+      }
+    }
+    flag[lid]   = f;
+    parent[lid] = -1;
+  }
+
+  /* Luby rounds: winners are found reading flag[], then flag[] is updated reading the winners */
+  while (1) {
+    nwin = 0;
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) private(j) reduction(+:nwin)
+#endif
+    for (lid=0; lid<nloc; lid++) {
+      char win = (char)(flag[lid] == MIS_SWEEP_CAND);
+
+      for (j=ai[lid]; win && j<ai[lid+1]; j++) {
+        if (aj[j] != lid && flag[aj[j]] == MIS_SWEEP_CAND && prio[aj[j]] > prio[lid]) win = 0;
+      }
+      next[lid] = win;
+      nwin     += win;
+    }
+    if (!nwin) break;
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) private(j)
+#endif
+    for (lid=0; lid<nloc; lid++) {
+      if (next[lid]) flag[lid] = MIS_SWEEP_SEL;
+      else if (flag[lid] == MIS_SWEEP_CAND || flag[lid] == MIS_SWEEP_BLOCKED) {
+        for (j=ai[lid]; j<ai[lid+1]; j++) {
+          if (next[aj[j]]) {flag[lid] = MIS_SWEEP_DEAD; break;}
+        }
+      }
+    }
+  }
+
+  /* the selected neighbor with the highest priority, the first to reach a dead vertex in the serial sweep, takes it */
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static) private(j)
+#endif
+  for (lid=0; lid<nloc; lid++) {
+    if (flag[lid] == MIS_SWEEP_DEAD) {
+      for (j=ai[lid]; j<ai[lid+1]; j++) {
+        if (flag[aj[j]] == MIS_SWEEP_SEL && (parent[lid] == -1 || prio[aj[j]] > prio[parent[lid]])) parent[lid] = aj[j];
+      }
+    }
+  }
+
+  /* fill the lists in the greedy ordering */
+  for (kk=0; kk<nloc; kk++) {
+    lid = sw->perm_ix[kk];
+    if (flag[lid] != MIS_SWEEP_SEL) continue;
+    lid_state[lid] = lid+my0;
+    nselected++;
+    nDone++;
+    ierr = PetscCDAppendID(agg_lists, lid, strict_aggs ? lid+my0 : lid);CHKERRQ(ierr);
+    for (j=ai[lid]; j<ai[lid+1]; j++) {
+      PetscInt lidj = aj[j];
+      if (flag[lidj] == MIS_SWEEP_DEAD && parent[lidj] == lid) {
+        nDone++;
+        ierr = PetscCDAppendID(agg_lists, lid, strict_aggs ? lidj+my0 : lidj);CHKERRQ(ierr);
+        lid_state[lidj] = MIS_DELETED;
+      }
+    }
+    if (!strict_aggs && (ix=lid_cprowID[lid]) != -1) {
+      for (j=matB->compressedrow.i[ix]; j<matB->compressedrow.i[ix+1]; j++) {
+        if (cpcol_state[matB->j[j]] == MIS_NOT_DONE) {
+          ierr = PetscCDAppendID(agg_lists, lid, nloc+matB->j[j]);CHKERRQ(ierr);
+        }
+      }
+    }
+  }
+  *a_nDone     += nDone + nremoved;
+  *a_nremoved  += nremoved;
+  *a_nselected += nselected;
+  PetscFunctionReturn(0);
+}
+
 /* -------------------------------------------------------------------------- */
 /*
    maxIndSetAgg - parallel maximal independent set (MIS) with data locality info. MatAIJ specific!!!
@@ -27,7 +158,7 @@ PetscErrorCode maxIndSetAgg(IS perm,Mat Gmat,PetscBool strict_aggs,PetscCoarsenD
   Mat_SeqAIJ       *matA,*matB=NULL;
   Mat_MPIAIJ       *mpimat=NULL;
   MPI_Comm         comm;
-  PetscInt         num_fine_ghosts,kk,n,ix,j,*idx,*ii,iter,Iend,my0,nremoved,gid,lid,cpid,lidj,sgid,t1,t2,slid,nDone,nselected=0,state,statej;
+  PetscInt         num_fine_ghosts,kk,n,ix,j,*idx,*ii,iter,Iend,my0,nremoved,gid,lid,cpid,lidj,sgid,t1,t2,slid,nDone,nselected=0,state,statej,nt;
   PetscInt         *cpcol_gid,*cpcol_state,*lid_cprowID,*lid_gid,*cpcol_sel_gid,*icpcol_gid,*lid_state,*lid_parent_gid=NULL;
   PetscBool        *lid_removed;
   PetscBool        isMPI,isAIJ,isOK;
@@ -36,6 +167,7 @@ PetscErrorCode maxIndSetAgg(IS perm,Mat Gmat,PetscBool strict_aggs,PetscCoarsenD
   PetscCoarsenData *agg_lists;
   PetscLayout      layout;
   PetscSF          sf;
+  MISSweep         sw;
 
   PetscFunctionBegin;
   ierr = PetscObjectGetComm((PetscObject)Gmat,&comm);CHKERRQ(ierr);
@@ -101,83 +233,101 @@ PetscErrorCode maxIndSetAgg(IS perm,Mat Gmat,PetscBool strict_aggs,PetscCoarsenD
   /* MIS */
   iter = nremoved = nDone = 0;
   ierr = ISGetIndices(perm, &perm_ix);CHKERRQ(ierr);
+  nt   = matA->threads.nthreads;
+  if (nt > 1) { /* priorities for the threaded sweeps: the first vertex in the greedy ordering has the highest */
+    ierr = PetscMalloc4(nloc,&sw.prio,nloc,&sw.flag,nloc,&sw.next,nloc,&sw.parent);CHKERRQ(ierr);
+    for (kk=0; kk<nloc; kk++) sw.prio[perm_ix[kk]] = nloc-kk;
+    sw.nloc        = nloc;
+    sw.my0         = my0;
+    sw.Iend        = Iend;
+    sw.perm_ix     = perm_ix;
+    sw.matA        = matA;
+    sw.matB        = matB;
+    sw.lid_cprowID = lid_cprowID;
+    sw.cpcol_gid   = mpimat ? cpcol_gid : NULL;
+    sw.cpcol_state = mpimat ? cpcol_state : NULL;
+  }
   while (nDone < nloc || PETSC_TRUE) { /* asyncronous not implemented */
     iter++;
-    /* check all vertices */
-    for (kk=0; kk<nloc; kk++) {
-      lid   = perm_ix[kk];
-      state = lid_state[lid];
-      if (lid_removed[lid]) continue;
-      if (state == MIS_NOT_DONE) {
-        /* parallel test, delete if selected ghost */
-        isOK = PETSC_TRUE;
-        if ((ix=lid_cprowID[lid]) != -1) { /* if I have any ghost neighbors */
-          ii  = matB->compressedrow.i; n = ii[ix+1] - ii[ix];
-          idx = matB->j + ii[ix];
-          for (j=0; j<n; j++) {
-            cpid   = idx[j]; /* compressed row ID in B mat */
-            gid    = cpcol_gid[cpid];
-            statej = cpcol_state[cpid];
-            if (statej == MIS_NOT_DONE && gid >= Iend) { /* should be (pe>rank), use gid as pe proxy */
-              isOK = PETSC_FALSE; /* can not delete */
-              break;
+    if (nt > 1) {
+      ierr = maxIndSetAggSweep_Threaded(&sw,nt,strict_aggs,lid_state,lid_removed,agg_lists,&nDone,&nremoved,&nselected);CHKERRQ(ierr);
+    } else {
+      /* check all vertices */
+      for (kk=0; kk<nloc; kk++) {
+        lid   = perm_ix[kk];
+        state = lid_state[lid];
+        if (lid_removed[lid]) continue;
+        if (state == MIS_NOT_DONE) {
+          /* parallel test, delete if selected ghost */
+          isOK = PETSC_TRUE;
+          if ((ix=lid_cprowID[lid]) != -1) { /* if I have any ghost neighbors */
+            ii  = matB->compressedrow.i; n = ii[ix+1] - ii[ix];
+            idx = matB->j + ii[ix];
+            for (j=0; j<n; j++) {
+              cpid   = idx[j]; /* compressed row ID in B mat */
+              gid    = cpcol_gid[cpid];
+              statej = cpcol_state[cpid];
+              if (statej == MIS_NOT_DONE && gid >= Iend) { /* should be (pe>rank), use gid as pe proxy */
+                isOK = PETSC_FALSE; /* can not delete */
+                break;
+              }
             }
-          }
-        } /* parallel test */
-        if (isOK) { /* select or remove this vertex */
-          nDone++;
-          /* check for singleton */
-          ii = matA->i; n = ii[lid+1] - ii[lid];
-          if (n < 2) {
-            /* if I have any ghost adj then not a sing */
-            ix = lid_cprowID[lid];
-            if (ix==-1 || !(matB->compressedrow.i[ix+1]-matB->compressedrow.i[ix])) {
-              nremoved++;
-              lid_removed[lid] = PETSC_TRUE;
-              /* should select this because it is technically in the MIS but lets not */
-              continue; /* one local adj (me) and no ghost - singleton */
+          } /* parallel test */
+          if (isOK) { /* select or remove this vertex */
+            nDone++;
+            /* check for singleton */
+            ii = matA->i; n = ii[lid+1] - ii[lid];
+            if (n < 2) {
+              /* if I have any ghost adj then not a sing */
+              ix = lid_cprowID[lid];
+              if (ix==-1 || !(matB->compressedrow.i[ix+1]-matB->compressedrow.i[ix])) {
+                nremoved++;
+                lid_removed[lid] = PETSC_TRUE;
+                /* should select this because it is technically in the MIS but lets not */
+                continue; /* one local adj (me) and no ghost - singleton */
+              }
             }
-          }
-          /* SELECTED state encoded with global index */
-          lid_state[lid] = lid+my0; /* needed???? */
-          nselected++;
-          if (strict_aggs) {
-            ierr = PetscCDAppendID(agg_lists, lid, lid+my0);CHKERRQ(ierr);
-          } else {
-            ierr = PetscCDAppendID(agg_lists, lid, lid);CHKERRQ(ierr);
-          }
-          /* delete local adj */
-          idx = matA->j + ii[lid];
-          for (j=0; j<n; j++) {
-            lidj   = idx[j];
-            statej = lid_state[lidj];
-            if (statej == MIS_NOT_DONE) {
-              nDone++;
-              if (strict_aggs) {
-                ierr = PetscCDAppendID(agg_lists, lid, lidj+my0);CHKERRQ(ierr);
-              } else {
-                ierr = PetscCDAppendID(agg_lists, lid, lidj);CHKERRQ(ierr);
+            /* SELECTED state encoded with global index */
+            lid_state[lid] = lid+my0; /* needed???? */
+            nselected++;
+            if (strict_aggs) {
+              ierr = PetscCDAppendID(agg_lists, lid, lid+my0);CHKERRQ(ierr);
+            } else {
+              ierr = PetscCDAppendID(agg_lists, lid, lid);CHKERRQ(ierr);
+            }
+            /* delete local adj */
+            idx = matA->j + ii[lid];
+            for (j=0; j<n; j++) {
+              lidj   = idx[j];
+              statej = lid_state[lidj];
+              if (statej == MIS_NOT_DONE) {
+                nDone++;
+                if (strict_aggs) {
+                  ierr = PetscCDAppendID(agg_lists, lid, lidj+my0);CHKERRQ(ierr);
+                } else {
+                  ierr = PetscCDAppendID(agg_lists, lid, lidj);CHKERRQ(ierr);
+                }
+                lid_state[lidj] = MIS_DELETED;  /* delete this */
               }
-              lid_state[lidj] = MIS_DELETED;  /* delete this */
             }
-          }
-          /* delete ghost adj of lid - deleted ghost done later for strict_aggs */
-          if (!strict_aggs) {
-            if ((ix=lid_cprowID[lid]) != -1) { /* if I have any ghost neighbors */
-              ii  = matB->compressedrow.i; n = ii[ix+1] - ii[ix];
-              idx = matB->j + ii[ix];
-              for (j=0; j<n; j++) {
-                cpid   = idx[j]; /* compressed row ID in B mat */
-                statej = cpcol_state[cpid];
-                if (statej == MIS_NOT_DONE) {
-                  ierr = PetscCDAppendID(agg_lists, lid, nloc+cpid);CHKERRQ(ierr);
+            /* delete ghost adj of lid - deleted ghost done later for strict_aggs */
+            if (!strict_aggs) {
+              if ((ix=lid_cprowID[lid]) != -1) { /* if I have any ghost neighbors */
+                ii  = matB->compressedrow.i; n = ii[ix+1] - ii[ix];
+                idx = matB->j + ii[ix];
+                for (j=0; j<n; j++) {
+                  cpid   = idx[j]; /* compressed row ID in B mat */
+                  statej = cpcol_state[cpid];
+                  if (statej == MIS_NOT_DONE) {
+                    ierr = PetscCDAppendID(agg_lists, lid, nloc+cpid);CHKERRQ(ierr);
+                  }
                 }
               }
             }
-          }
-        } /* selected */
-      } /* not done vertex */
-    } /* vertex loop */
+          } /* selected */
+        } /* not done vertex */
+      } /* vertex loop */
+    }
 
     /* update ghost states and count todos */
     if (mpimat) {
@@ -217,7 +367,10 @@ PetscErrorCode maxIndSetAgg(IS perm,Mat Gmat,PetscBool strict_aggs,PetscCoarsenD
     } else break; /* all done */
   } /* outer parallel MIS loop */
   ierr = ISRestoreIndices(perm,&perm_ix);CHKERRQ(ierr);
-  ierr = PetscInfo3(Gmat,"\t removed %D of %D vertices.  %D selected.\n",nremoved,nloc,nselected);CHKERRQ(ierr);
+  if (nt > 1) {
+    ierr = PetscFree4(sw.prio,sw.flag,sw.next,sw.parent);CHKERRQ(ierr);
+  }
+  ierr = PetscInfo4(Gmat,"\t removed %D of %D vertices.  %D selected (%D threads).\n",nremoved,nloc,nselected,nt);CHKERRQ(ierr);
 
   /* tell adj who my lid_parent_gid vertices belong to - fill in agg_lists selected ghost lists */
   if (strict_aggs && matB) {
@@ -258,6 +411,17 @@ PetscErrorCode maxIndSetAgg(IS perm,Mat Gmat,PetscBool strict_aggs,PetscCoarsenD
 typedef struct {
   int dummy;
 } MatCoarsen_MIS;
+
+/* a pseudo random key of a global vertex number, independent of the number of processes and threads */
+PETSC_STATIC_INLINE PetscInt MISHash_Private(PetscInt gid)
+{
+  unsigned int x = (unsigned int)gid;
+
+  x ^= x >> 16; x *= 0x85ebca6bU;
+  x ^= x >> 13; x *= 0xc2b2ae35U;
+  x ^= x >> 16;
+  return (PetscInt)(x >> 1);
+}
 /*
    MIS coarsen, simple greedy.
 */
@@ -270,12 +434,33 @@ static PetscErrorCode MatCoarsenApply_MIS(MatCoarsen coarse)
   PetscFunctionBegin;
   PetscValidHeaderSpecific(coarse,MAT_COARSEN_CLASSID,1);
   if (!coarse->perm) {
-    IS       perm;
-    PetscInt n,m;
-    MPI_Comm comm;
+    IS         perm;
+    PetscInt   n,m,i,rstart,nt = 1,*key,*idx;
+    MPI_Comm   comm;
+    PetscBool  isMPI,isAIJ;
+    Mat_SeqAIJ *matA;
     ierr = PetscObjectGetComm((PetscObject)mat,&comm);CHKERRQ(ierr);
     ierr = MatGetLocalSize(mat, &m, &n);CHKERRQ(ierr);
-    ierr = ISCreateStride(comm, m, 0, 1, &perm);CHKERRQ(ierr);
+    ierr = PetscObjectBaseTypeCompare((PetscObject)mat,MATMPIAIJ,&isMPI);CHKERRQ(ierr);
+    ierr = PetscObjectBaseTypeCompare((PetscObject)mat,MATSEQAIJ,&isAIJ);CHKERRQ(ierr);
+    if (isMPI || isAIJ) {
+      matA = (Mat_SeqAIJ*)(isMPI ? ((Mat_MPIAIJ*)mat->data)->A->data : mat->data);
+      nt   = matA->threads.nthreads;
+    }
+    if (nt > 1) {
+      /* the natural ordering would need about as many Luby rounds as the graph has levels; use random priorities */
+      ierr = MatGetOwnershipRange(mat, &rstart, NULL);CHKERRQ(ierr);
+      ierr = PetscMalloc2(m, &key, m, &idx);CHKERRQ(ierr);
+      for (i=0; i<m; i++) {
+        key[i] = MISHash_Private(rstart+i);
+        idx[i] = i;
+      }
+      ierr = PetscSortIntWithArray(m, key, idx);CHKERRQ(ierr);
+      ierr = ISCreateGeneral(PETSC_COMM_SELF, m, idx, PETSC_COPY_VALUES, &perm);CHKERRQ(ierr);
+      ierr = PetscFree2(key, idx);CHKERRQ(ierr);
+    } else {
+      ierr = ISCreateStride(comm, m, 0, 1, &perm);CHKERRQ(ierr);
+    }
     ierr = maxIndSetAgg(perm, mat, coarse->strict_aggs, &coarse->agg_lists);CHKERRQ(ierr);
     ierr = ISDestroy(&perm);CHKERRQ(ierr);
   } else {
@@ -326,9 +511,14 @@ PetscErrorCode MatCoarsenDestroy_MIS(MatCoarsen coarse)
    Options Database Keys:
 .  -mat_coarsen_MIS_xxx -
 
+   Notes:
+   When the graph (its diagonal block in parallel) uses threads, see MatSeqAIJSetNumThreads(), the local vertices are
+   processed by those threads with Luby's algorithm, using the greedy ordering from MatCoarsenSetGreedyOrdering() as
+   priorities, or random priorities without an ordering. With an ordering the aggregates are the same as with one thread.
+
    Level: beginner
 
-.seealso: MatCoarsenSetType(), MatCoarsenType
+.seealso: MatCoarsenSetType(), MatCoarsenType, MatCoarsenSetGreedyOrdering(), MatSeqAIJSetNumThreads()
 
 M*/
 
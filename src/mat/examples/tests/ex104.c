@@ -17,11 +17,7 @@ int main(int argc,char **argv)
   IS             isrows,iscols;
   const PetscInt *rows,*cols;
   PetscScalar    *v,rval;
-#if defined(PETSC_HAVE_ELEMENTAL)
   PetscBool      Test_MatMatMult=PETSC_TRUE;
-#else
-  PetscBool      Test_MatMatMult=PETSC_FALSE;
-#endif
   PetscMPIInt    size;
 
   ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
@@ -29,6 +25,7 @@ int main(int argc,char **argv)
 
   ierr = PetscOptionsGetInt(NULL,NULL,"-M",&M,NULL);CHKERRQ(ierr);
   ierr = PetscOptionsGetInt(NULL,NULL,"-N",&N,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetBool(NULL,NULL,"-test_matmatmult",&Test_MatMatMult,NULL);CHKERRQ(ierr);
   ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
   ierr = MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,M,N);CHKERRQ(ierr);
   ierr = MatSetType(A,MATDENSE);CHKERRQ(ierr);
@@ -77,9 +74,6 @@ int main(int argc,char **argv)
 
   /* Test MatMatMult() */
   if (Test_MatMatMult) {
-#if !defined(PETSC_HAVE_ELEMENTAL)
-    if (size > 1) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_SUP,"This test requires ELEMENTAL");
-#endif
     ierr = MatTranspose(A,MAT_INITIAL_MATRIX,&B);CHKERRQ(ierr); /* B = A^T */
     ierr = MatMatMult(B,A,MAT_INITIAL_MATRIX,fill,&C);CHKERRQ(ierr); /* C = B*A = A^T*A */
     ierr = MatMatMult(B,A,MAT_REUSE_MATRIX,fill,&C);CHKERRQ(ierr);
@@ -213,4 +207,10 @@ int main(int argc,char **argv)
       output_file: output/ex104.out
       args: -M 23 -N 31 -matmattransmult_mpidense_mpidense_via allgatherv
 
+    test:
+      suffix: 6
+      nsize: {{2 3}}
+      output_file: output/ex104.out
+      args: -M 23 -N 31 -matmatmult_mpidense_mpidense_via {{summa allgatherv}}
+
 TEST*/
@@ -0,0 +1,90 @@
+static char help[] = "Tests MatSetPreallocationCOO() and MatSetValuesCOO() against MatSetValues()\n\n";
+
+#include <petscmat.h>
+
+/* Each process contributes 2x2 element matrices for a contiguous range of 1d elements that does not match the row
+   layout, so that duplicated entries and entries in rows owned by other processes are both exercised */
+int main(int argc,char **argv)
+{
+  Mat            A,B;
+  PetscErrorCode ierr;
+  PetscMPIInt    rank,size;
+  PetscInt       N = 13,ne,estart,e,k,n,it,*coo_i,*coo_j;
+  PetscScalar    *coo_v;
+  PetscReal      norm;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = MPI_Comm_rank(PETSC_COMM_WORLD,&rank);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(PETSC_COMM_WORLD,&size);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-N",&N,NULL);CHKERRQ(ierr);
+
+  /* give the last process most of the elements */
+  ne     = (N-1)/(2*size);
+  estart = rank*ne;
+  if (rank == size-1) ne = N-1-estart;
+
+  n    = 4*ne+1;
+  ierr = PetscMalloc3(n,&coo_i,n,&coo_j,n,&coo_v);CHKERRQ(ierr);
+  for (e=0,k=0; e<ne; e++) {
+    PetscInt r = estart+e;
+    coo_i[k] = r;   coo_j[k++] = r;
+    coo_i[k] = r;   coo_j[k++] = r+1;
+    coo_i[k] = r+1; coo_j[k++] = r;
+    coo_i[k] = r+1; coo_j[k++] = r+1;
+  }
+  /* an ignored entry */
+  coo_i[k] = -1; coo_j[k++] = 0;
+
+  ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N);CHKERRQ(ierr);
+  ierr = MatSetFromOptions(A);CHKERRQ(ierr);
+  ierr = MatSetPreallocationCOO(A,n,coo_i,coo_j);CHKERRQ(ierr);
+
+  ierr = MatCreate(PETSC_COMM_WORLD,&B);CHKERRQ(ierr);
+  ierr = MatSetSizes(B,PETSC_DECIDE,PETSC_DECIDE,N,N);CHKERRQ(ierr);
+  ierr = MatSetType(B,MATAIJ);CHKERRQ(ierr);
+  ierr = MatSetUp(B);CHKERRQ(ierr);
+
+  for (it=0; it<3; it++) {
+    InsertMode imode = it == 2 ? ADD_VALUES : INSERT_VALUES;
+
+    for (k=0; k<n; k++) coo_v[k] = (PetscScalar)(1 + (k*7 + it*3 + rank) % 11);
+    ierr = MatSetValuesCOO(A,coo_v,imode);CHKERRQ(ierr);
+
+    if (imode == INSERT_VALUES) {ierr = MatZeroEntries(B);CHKERRQ(ierr);}
+    for (k=0; k<n; k++) {
+      ierr = MatSetValue(B,coo_i[k],coo_j[k],coo_v[k],ADD_VALUES);CHKERRQ(ierr);
+    }
+    ierr = MatAssemblyBegin(B,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+    ierr = MatAssemblyEnd(B,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+    ierr = MatAXPY(B,-1.0,A,DIFFERENT_NONZERO_PATTERN);CHKERRQ(ierr);
+    ierr = MatNorm(B,NORM_FROBENIUS,&norm);CHKERRQ(ierr);
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Pass %D: norm of difference %g\n",it,(double)norm);CHKERRQ(ierr);
+    ierr = MatAXPY(B,1.0,A,DIFFERENT_NONZERO_PATTERN);CHKERRQ(ierr);
+  }
+  ierr = MatNorm(A,NORM_1,&norm);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"Norm of A %g\n",(double)norm);CHKERRQ(ierr);
+
+  ierr = PetscFree3(coo_i,coo_j,coo_v);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+     suffix: 1
+     nsize: {{1 2 3}}
+     args: -mat_type aij
+     output_file: output/ex236_1.out
+
+   test:
+     suffix: 2
+     nsize: 2
+     args: -mat_type baij
+     output_file: output/ex236_1.out
+
+TEST*/
@@ -0,0 +1,103 @@
+static char help[] = "Tests the threaded MatMult() and MatMultAdd() of SeqAIJ against the serial kernels\n\n";
+
+#include <petscmat.h>
+
+/* Assembles a 1d stencil with bs unknowns per point, so that the matrix has inodes of size bs, and with only every
+   skip-th point coupled, so that the compressed row kernels are used when skip is large */
+int main(int argc,char **argv)
+{
+  Mat            A,B;
+  Vec            x,y,z,w;
+  PetscErrorCode ierr;
+  PetscInt       n = 100,bs = 2,skip = 1,nthreads = 3,p,q,c,d,row,col;
+  PetscScalar    v;
+  PetscReal      norm;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-bs",&bs,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-skip",&skip,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-nthreads",&nthreads,NULL);CHKERRQ(ierr);
+
+  ierr = MatCreate(PETSC_COMM_SELF,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,n*bs,n*bs,n*bs,n*bs);CHKERRQ(ierr);
+  ierr = MatSetType(A,MATSEQAIJ);CHKERRQ(ierr);
+  ierr = MatSetFromOptions(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(A,3*bs,NULL);CHKERRQ(ierr);
+  for (p=0; p<n; p+=skip) {
+    for (q=PetscMax(p-1,0); q<=PetscMin(p+1,n-1); q++) {
+      for (c=0; c<bs; c++) {
+        for (d=0; d<bs; d++) {
+          row  = p*bs+c;
+          col  = q*bs+d;
+          v    = (PetscScalar)((row*7 + col*3) % 13) - 6.0;
+          ierr = MatSetValues(A,1,&row,1,&col,&v,INSERT_VALUES);CHKERRQ(ierr);
+        }
+      }
+    }
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+  ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetNumThreads(B,nthreads);CHKERRQ(ierr);
+
+  ierr = MatCreateVecs(B,&x,&y);CHKERRQ(ierr);
+  ierr = VecDuplicate(y,&z);CHKERRQ(ierr);
+  ierr = VecDuplicate(y,&w);CHKERRQ(ierr);
+  for (row=0; row<n*bs; row++) {
+    v    = PetscSinReal((PetscReal)row);
+    ierr = VecSetValue(x,row,v,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = VecAssemblyBegin(x);CHKERRQ(ierr);
+  ierr = VecAssemblyEnd(x);CHKERRQ(ierr);
+
+  ierr = MatMult(A,x,y);CHKERRQ(ierr);
+  ierr = MatMult(B,x,z);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,y);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_INFINITY,&norm);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_SELF,"MatMult: norm of difference %g\n",(double)norm);CHKERRQ(ierr);
+
+  ierr = VecCopy(x,w);CHKERRQ(ierr);
+  ierr = MatMultAdd(A,x,w,y);CHKERRQ(ierr);
+  ierr = MatMultAdd(B,x,w,z);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,y);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_INFINITY,&norm);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_SELF,"MatMultAdd: norm of difference %g\n",(double)norm);CHKERRQ(ierr);
+
+  /* in place, and again with the partition cached */
+  ierr = MatMultAdd(A,x,w,w);CHKERRQ(ierr);
+  ierr = VecCopy(x,z);CHKERRQ(ierr);
+  ierr = MatMultAdd(B,x,z,z);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,w);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_INFINITY,&norm);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_SELF,"In place MatMultAdd: norm of difference %g\n",(double)norm);CHKERRQ(ierr);
+
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  ierr = VecDestroy(&z);CHKERRQ(ierr);
+  ierr = VecDestroy(&w);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+     suffix: 1
+     args: -bs {{1 3}} -skip {{1 5}}
+     output_file: output/ex237_1.out
+
+   test:
+     suffix: 2
+     args: -mat_no_inode -bs 2 -skip {{1 5}} -nthreads 4
+     output_file: output/ex237_1.out
+
+   test:
+     suffix: 3
+     args: -mat_seqaij_num_threads 2 -nthreads 5 -n 7
+     output_file: output/ex237_1.out
+
+TEST*/
@@ -0,0 +1,165 @@
+static char help[] = "Tests the single precision kernels of MATSEQAIJMIXED against MATSEQAIJ\n\n";
+
+#include <petscmat.h>
+
+static PetscErrorCode CheckDifference(const char *op,Vec y,Vec z)
+{
+  PetscErrorCode ierr;
+  PetscReal      norm,ynorm;
+
+  PetscFunctionBegin;
+  ierr = VecNorm(y,NORM_INFINITY,&ynorm);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,y);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_INFINITY,&norm);CHKERRQ(ierr);
+  if (norm > 1.e-5*ynorm) {
+    ierr = PetscPrintf(PETSC_COMM_SELF,"%s: relative difference %g larger than single precision\n",op,(double)(norm/ynorm));CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_SELF,"%s: relative difference within single precision\n",op);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/* A diagonally dominant matrix with a 2d 5-point pattern whose entries are not exactly representable in single precision */
+int main(int argc,char **argv)
+{
+  Mat            A,B,FA,FB;
+  Vec            x,y,z,w;
+  IS             isrow,iscol;
+  MatFactorInfo  info;
+  PetscErrorCode ierr;
+  PetscInt       n = 12,i,j,k,row,col;
+  PetscScalar    v;
+  PetscReal      norm;
+  PetscBool      flg;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL);CHKERRQ(ierr);
+
+  ierr = MatCreate(PETSC_COMM_SELF,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,n*n,n*n,n*n,n*n);CHKERRQ(ierr);
+  ierr = MatSetType(A,MATSEQAIJ);CHKERRQ(ierr);
+  ierr = MatSetFromOptions(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(A,5,NULL);CHKERRQ(ierr);
+  for (i=0; i<n; i++) {
+    for (j=0; j<n; j++) {
+      row  = i*n+j;
+      v    = 4.0 + 1.0/(row+3.0);
+      ierr = MatSetValues(A,1,&row,1,&row,&v,INSERT_VALUES);CHKERRQ(ierr);
+      for (k=0; k<4; k++) {
+        PetscInt ii = i + (k == 0 ? -1 : (k == 1 ? 1 : 0)),jj = j + (k == 2 ? -1 : (k == 3 ? 1 : 0));
+
+        if (ii < 0 || ii >= n || jj < 0 || jj >= n) continue;
+        col  = ii*n+jj;
+        v    = -1.0/(1.0 + 0.1*((row + 3*col) % 7));
+        ierr = MatSetValues(A,1,&row,1,&col,&v,INSERT_VALUES);CHKERRQ(ierr);
+      }
+    }
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatConvert(A,MATSEQAIJMIXED,MAT_INITIAL_MATRIX,&B);CHKERRQ(ierr);
+
+  ierr = MatCreateVecs(A,&x,&y);CHKERRQ(ierr);
+  ierr = VecDuplicate(y,&z);CHKERRQ(ierr);
+  ierr = VecDuplicate(y,&w);CHKERRQ(ierr);
+  for (row=0; row<n*n; row++) {
+    v    = PetscSinReal((PetscReal)row);
+    ierr = VecSetValue(x,row,v,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = VecAssemblyBegin(x);CHKERRQ(ierr);
+  ierr = VecAssemblyEnd(x);CHKERRQ(ierr);
+
+  ierr = MatMult(A,x,y);CHKERRQ(ierr);
+  ierr = MatMult(B,x,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatMult",y,z);CHKERRQ(ierr);
+
+  ierr = VecCopy(x,w);CHKERRQ(ierr);
+  ierr = MatMultAdd(A,x,w,y);CHKERRQ(ierr);
+  ierr = MatMultAdd(B,x,w,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatMultAdd",y,z);CHKERRQ(ierr);
+
+  ierr = MatMultTranspose(A,x,y);CHKERRQ(ierr);
+  ierr = MatMultTranspose(B,x,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatMultTranspose",y,z);CHKERRQ(ierr);
+
+  ierr = MatGetDiagonal(A,y);CHKERRQ(ierr);
+  ierr = MatGetDiagonal(B,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatGetDiagonal",y,z);CHKERRQ(ierr);
+
+  ierr = MatSOR(A,x,1.2,(MatSORType)(SOR_LOCAL_SYMMETRIC_SWEEP | SOR_ZERO_INITIAL_GUESS),0.0,2,1,y);CHKERRQ(ierr);
+  ierr = MatSOR(B,x,1.2,(MatSORType)(SOR_LOCAL_SYMMETRIC_SWEEP | SOR_ZERO_INITIAL_GUESS),0.0,2,1,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatSOR",y,z);CHKERRQ(ierr);
+
+  /* the factor of the mixed matrix is a mixed matrix */
+  ierr = MatGetOrdering(A,MATORDERINGRCM,&isrow,&iscol);CHKERRQ(ierr);
+  ierr = MatFactorInfoInitialize(&info);CHKERRQ(ierr);
+  info.fill = 1.0;
+  ierr = MatGetFactor(A,MATSOLVERPETSC,MAT_FACTOR_ILU,&FA);CHKERRQ(ierr);
+  ierr = MatGetFactor(B,MATSOLVERPETSC,MAT_FACTOR_ILU,&FB);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompare((PetscObject)FB,MATSEQAIJMIXED,&flg);CHKERRQ(ierr);
+  if (!flg) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Factor of a MATSEQAIJMIXED matrix should be MATSEQAIJMIXED");
+  ierr = MatILUFactorSymbolic(FA,A,isrow,iscol,&info);CHKERRQ(ierr);
+  ierr = MatILUFactorSymbolic(FB,B,isrow,iscol,&info);CHKERRQ(ierr);
+  ierr = MatLUFactorNumeric(FA,A,&info);CHKERRQ(ierr);
+  ierr = MatLUFactorNumeric(FB,B,&info);CHKERRQ(ierr);
+  ierr = MatSolve(FA,x,y);CHKERRQ(ierr);
+  ierr = MatSolve(FB,x,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatSolve",y,z);CHKERRQ(ierr);
+
+  /* the single precision copy must follow changes of the values */
+  ierr = MatScale(A,2.0);CHKERRQ(ierr);
+  ierr = MatScale(B,2.0);CHKERRQ(ierr);
+  ierr = MatShift(A,1.0);CHKERRQ(ierr);
+  ierr = MatShift(B,1.0);CHKERRQ(ierr);
+  ierr = MatMult(A,x,y);CHKERRQ(ierr);
+  ierr = MatMult(B,x,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatMult after MatScale() and MatShift()",y,z);CHKERRQ(ierr);
+
+  /* values set after the products are used by the next product */
+  row  = n*n/2;
+  v    = 10.0;
+  ierr = MatSetValues(A,1,&row,1,&row,&v,ADD_VALUES);CHKERRQ(ierr);
+  ierr = MatSetValues(B,1,&row,1,&row,&v,ADD_VALUES);CHKERRQ(ierr);
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyBegin(B,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(B,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatMult(A,x,y);CHKERRQ(ierr);
+  ierr = MatMult(B,x,z);CHKERRQ(ierr);
+  ierr = CheckDifference("MatMult after MatSetValues()",y,z);CHKERRQ(ierr);
+
+  ierr = MatDestroy(&FA);CHKERRQ(ierr);
+  /* back to MATSEQAIJ the values keep their rounding to single precision, a duplicate has the same values */
+  ierr = MatDuplicate(B,MAT_COPY_VALUES,&FA);CHKERRQ(ierr);
+  ierr = MatConvert(B,MATSEQAIJ,MAT_INPLACE_MATRIX,&B);CHKERRQ(ierr);
+  ierr = MatMult(FA,x,y);CHKERRQ(ierr);
+  ierr = MatMult(B,x,z);CHKERRQ(ierr);
+  ierr = VecAXPY(z,-1.0,y);CHKERRQ(ierr);
+  ierr = VecNorm(z,NORM_INFINITY,&norm);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_SELF,"MatMult after MatConvert() to MATSEQAIJ: norm of difference with the duplicate %g\n",(double)norm);CHKERRQ(ierr);
+
+  ierr = ISDestroy(&isrow);CHKERRQ(ierr);
+  ierr = ISDestroy(&iscol);CHKERRQ(ierr);
+  ierr = VecDestroy(&x);CHKERRQ(ierr);
+  ierr = VecDestroy(&y);CHKERRQ(ierr);
+  ierr = VecDestroy(&z);CHKERRQ(ierr);
+  ierr = VecDestroy(&w);CHKERRQ(ierr);
+  ierr = MatDestroy(&FA);CHKERRQ(ierr);
+  ierr = MatDestroy(&FB);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   build:
+      requires: !complex
+
+   test:
+      suffix: 1
+      args: -mat_seqaij_num_threads {{1 3}}
+      output_file: output/ex238_1.out
+
+TEST*/
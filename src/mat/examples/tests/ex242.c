@@ -0,0 +1,82 @@
+static char help[] = "Tests MatDenseTSQR() on a tall and skinny dense matrix.\n\n\
+  -M <M> : number of rows\n\
+  -N <N> : number of columns\n\n";
+
+#include <petscmat.h>
+
+int main(int argc,char **argv)
+{
+  Mat            A,B,R,QtQ,QR;
+  PetscRandom    rand;
+  PetscInt       M = 60,N = 7,i,j,rstart,rend;
+  PetscScalar    *r;
+  PetscReal      orth,err,nrm;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-M",&M,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-N",&N,NULL);CHKERRQ(ierr);
+  ierr = PetscRandomCreate(PETSC_COMM_WORLD,&rand);CHKERRQ(ierr);
+  ierr = PetscRandomSetFromOptions(rand);CHKERRQ(ierr);
+  ierr = MatCreateDense(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,M,N,NULL,&A);CHKERRQ(ierr);
+  ierr = MatSetRandom(A,rand);CHKERRQ(ierr);
+  ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  ierr = PetscMalloc1(N*N,&r);CHKERRQ(ierr);
+
+  ierr = MatDenseTSQR(A,r);CHKERRQ(ierr);
+
+  /* R as a parallel dense matrix, to check that Q R = B */
+  ierr = MatCreateDense(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,N,N,NULL,&R);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(R,&rstart,&rend);CHKERRQ(ierr);
+  for (i=rstart; i<rend; i++) {
+    for (j=i; j<N; j++) {ierr = MatSetValue(R,i,j,r[i+j*N],INSERT_VALUES);CHKERRQ(ierr);}
+  }
+  ierr = MatAssemblyBegin(R,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(R,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatMatMult(A,R,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&QR);CHKERRQ(ierr);
+  ierr = MatAXPY(QR,-1.0,B,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+  ierr = MatNorm(QR,NORM_FROBENIUS,&err);CHKERRQ(ierr);
+  ierr = MatNorm(B,NORM_FROBENIUS,&nrm);CHKERRQ(ierr);
+  err /= nrm;
+
+  /* Q^T Q = I */
+  ierr = MatTransposeMatMult(A,A,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&QtQ);CHKERRQ(ierr);
+  ierr = MatShift(QtQ,-1.0);CHKERRQ(ierr);
+  ierr = MatNorm(QtQ,NORM_FROBENIUS,&orth);CHKERRQ(ierr);
+  if (orth > 100.0*PETSC_SMALL) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Loss of orthogonality of Q %g\n",(double)orth);CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Q^T Q = I to the tolerance\n");CHKERRQ(ierr);
+  }
+  if (err > 100.0*PETSC_SMALL) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Relative error in Q R %g\n",(double)err);CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Q R = A to the tolerance\n");CHKERRQ(ierr);
+  }
+
+  ierr = PetscFree(r);CHKERRQ(ierr);
+  ierr = MatDestroy(&QtQ);CHKERRQ(ierr);
+  ierr = MatDestroy(&QR);CHKERRQ(ierr);
+  ierr = MatDestroy(&R);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = PetscRandomDestroy(&rand);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      requires: !complex
+      nsize: {{1 2 3 4 5}}
+      output_file: output/ex242_1.out
+
+   test:
+      suffix: 2
+      requires: !complex
+      nsize: 4
+      args: -M 13 -N 9
+      output_file: output/ex242_1.out
+
+TEST*/
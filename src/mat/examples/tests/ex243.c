@@ -0,0 +1,125 @@
+static char help[] = "Tests the threaded MatMatMult() and MatPtAP() of AIJ matrices against the serial ones.\n\n\
+  -m <m>        : grid size in each direction\n\
+  -nthreads <n> : number of threads of the (diagonal block of the) matrix\n\n";
+
+#include <petscmat.h>
+
+static PetscErrorCode SetNumThreads(Mat A,PetscInt nthreads)
+{
+  Mat            Ad,Ao;
+  PetscBool      flg;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)A,MATMPIAIJ,&flg);CHKERRQ(ierr);
+  if (flg) {
+    ierr = MatMPIAIJGetSeqAIJ(A,&Ad,&Ao,NULL);CHKERRQ(ierr);
+    ierr = MatSeqAIJSetNumThreads(Ad,nthreads);CHKERRQ(ierr);
+    ierr = MatSeqAIJSetNumThreads(Ao,nthreads);CHKERRQ(ierr);
+  } else {
+    ierr = MatSeqAIJSetNumThreads(A,nthreads);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode CheckEqual(Mat X,Mat Y,const char *name)
+{
+  Mat            D;
+  PetscReal      nrm,nrmx;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatDuplicate(X,MAT_COPY_VALUES,&D);CHKERRQ(ierr);
+  ierr = MatAXPY(D,-1.0,Y,DIFFERENT_NONZERO_PATTERN);CHKERRQ(ierr);
+  ierr = MatNorm(D,NORM_FROBENIUS,&nrm);CHKERRQ(ierr);
+  ierr = MatNorm(X,NORM_FROBENIUS,&nrmx);CHKERRQ(ierr);
+  if (nrm > PETSC_SMALL*nrmx) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"%s differs from the serial product by %g\n",name,(double)nrm);CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"%s agrees with the serial product\n",name);CHKERRQ(ierr);
+  }
+  ierr = MatDestroy(&D);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A,B,P,C0,C,D0,D;
+  PetscInt       m = 20,nthreads = 3,i,j,k,Istart,Iend,N,Nc;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-nthreads",&nthreads,NULL);CHKERRQ(ierr);
+  N    = m*m;
+  Nc   = (N+1)/2;
+
+  /* 5-point Laplacian with unsymmetric perturbations */
+  ierr = MatCreateAIJ(PETSC_COMM_WORLD,PETSC_DECIDE,PETSC_DECIDE,N,N,5,NULL,5,NULL,&A);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(A,&Istart,&Iend);CHKERRQ(ierr);
+  for (k=Istart; k<Iend; k++) {
+    i = k/m; j = k - i*m;
+    if (i>0)   {ierr = MatSetValue(A,k,k-m,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (i<m-1) {ierr = MatSetValue(A,k,k+m,-1.0-0.1*j,INSERT_VALUES);CHKERRQ(ierr);}
+    if (j>0)   {ierr = MatSetValue(A,k,k-1,-1.0,INSERT_VALUES);CHKERRQ(ierr);}
+    if (j<m-1) {ierr = MatSetValue(A,k,k+1,-1.0+0.05*i,INSERT_VALUES);CHKERRQ(ierr);}
+    ierr = MatSetValue(A,k,k,4.0,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+  /* interpolation-like operator with two entries per row */
+  ierr = MatCreateAIJ(PETSC_COMM_WORLD,Iend-Istart,PETSC_DECIDE,N,Nc,2,NULL,2,NULL,&P);CHKERRQ(ierr);
+  for (k=Istart; k<Iend; k++) {
+    ierr = MatSetValue(P,k,k/2,0.75,INSERT_VALUES);CHKERRQ(ierr);
+    ierr = MatSetValue(P,k,(k/2+Nc/3)%Nc,0.25,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(P,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(P,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+  /* serial references */
+  ierr = MatMatMult(A,A,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&C0);CHKERRQ(ierr);
+  ierr = MatPtAP(A,P,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&D0);CHKERRQ(ierr);
+
+  ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  ierr = SetNumThreads(B,nthreads);CHKERRQ(ierr);
+  ierr = MatMatMult(B,B,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&C);CHKERRQ(ierr);
+  ierr = CheckEqual(C0,C,"MatMatMult()");CHKERRQ(ierr);
+  ierr = MatPtAP(B,P,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&D);CHKERRQ(ierr);
+  ierr = CheckEqual(D0,D,"MatPtAP()");CHKERRQ(ierr);
+
+  /* numeric products with new values */
+  ierr = MatScale(A,2.0);CHKERRQ(ierr);
+  ierr = MatScale(B,2.0);CHKERRQ(ierr);
+  ierr = MatMatMult(A,A,MAT_REUSE_MATRIX,PETSC_DEFAULT,&C0);CHKERRQ(ierr);
+  ierr = MatMatMult(B,B,MAT_REUSE_MATRIX,PETSC_DEFAULT,&C);CHKERRQ(ierr);
+  ierr = CheckEqual(C0,C,"MatMatMult() with MAT_REUSE_MATRIX");CHKERRQ(ierr);
+  ierr = MatPtAP(A,P,MAT_REUSE_MATRIX,PETSC_DEFAULT,&D0);CHKERRQ(ierr);
+  ierr = MatPtAP(B,P,MAT_REUSE_MATRIX,PETSC_DEFAULT,&D);CHKERRQ(ierr);
+  ierr = CheckEqual(D0,D,"MatPtAP() with MAT_REUSE_MATRIX");CHKERRQ(ierr);
+
+  ierr = MatDestroy(&C0);CHKERRQ(ierr);
+  ierr = MatDestroy(&C);CHKERRQ(ierr);
+  ierr = MatDestroy(&D0);CHKERRQ(ierr);
+  ierr = MatDestroy(&D);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = MatDestroy(&P);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      nsize: {{1 3}}
+      args: -nthreads {{1 4}}
+      output_file: output/ex243_1.out
+
+   test:
+      suffix: 2
+      nsize: {{2 3}}
+      args: -matptap_via {{scalable nonscalable}} -m 33
+      output_file: output/ex243_1.out
+
+TEST*/
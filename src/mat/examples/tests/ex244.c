@@ -0,0 +1,135 @@
+static char help[] = "Tests MatPtAP() and MatMatMult() of a BAIJ matrix with an AIJ matrix against the AIJ products.\n\n\
+  -m <m>    : grid size in each direction\n\
+  -bs <bs>  : block size of A\n\
+  -cbs <bs> : column block size of P\n\n";
+
+#include <petscmat.h>
+
+static PetscErrorCode CheckEqual(Mat X,Mat Y,const char *name)
+{
+  Mat            D;
+  PetscReal      nrm,nrmx;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatConvert(Y,MATAIJ,MAT_INITIAL_MATRIX,&D);CHKERRQ(ierr);
+  ierr = MatAXPY(D,-1.0,X,DIFFERENT_NONZERO_PATTERN);CHKERRQ(ierr);
+  ierr = MatNorm(D,NORM_FROBENIUS,&nrm);CHKERRQ(ierr);
+  ierr = MatNorm(X,NORM_FROBENIUS,&nrmx);CHKERRQ(ierr);
+  if (nrm > PETSC_SMALL*nrmx) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"%s differs from the AIJ product by %g\n",name,(double)nrm);CHKERRQ(ierr);
+  }
+  ierr = MatDestroy(&D);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A,B,P,C,D,AP,BP;
+  PetscBool      isbaij;
+  PetscInt       m = 8,bs = 3,cbs = 2,N,Nc,i,j,k,r,c,rstart,rend,nbr[5],nn,row,col;
+  PetscScalar    *v;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-bs",&bs,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-cbs",&cbs,NULL);CHKERRQ(ierr);
+  N    = m*m;
+  Nc   = (N+2)/3;
+  ierr = PetscMalloc1(5*bs*bs,&v);CHKERRQ(ierr);
+
+  /* block 5-point stencil with dense unsymmetric blocks */
+  ierr = MatCreate(PETSC_COMM_WORLD,&A);CHKERRQ(ierr);
+  ierr = MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N*bs,N*bs);CHKERRQ(ierr);
+  ierr = MatSetBlockSize(A,bs);CHKERRQ(ierr);
+  ierr = MatSetType(A,MATAIJ);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(A,5*bs,NULL);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation(A,5*bs,NULL,5*bs,NULL);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRange(A,&rstart,&rend);CHKERRQ(ierr);
+  for (k=rstart/bs; k<rend/bs; k++) {
+    i = k/m; j = k - i*m; nn = 0;
+    if (i>0)   nbr[nn++] = k-m;
+    if (j>0)   nbr[nn++] = k-1;
+    nbr[nn++] = k;
+    if (j<m-1) nbr[nn++] = k+1;
+    if (i<m-1) nbr[nn++] = k+m;
+    for (r=0; r<bs; r++) {
+      for (c=0; c<nn*bs; c++) {
+        col = nbr[c/bs]*bs + c%bs;
+        v[r*nn*bs+c] = (col == k*bs+r) ? 4.0*bs : -1.0/(1.0 + PetscAbsInt(col-k*bs-r)) + 0.01*PetscSinReal((PetscReal)(k+r+c));
+      }
+    }
+    ierr = MatSetValuesBlocked(A,1,&k,nn,nbr,v,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatConvert(A,MATBAIJ,MAT_INITIAL_MATRIX,&B);CHKERRQ(ierr);
+
+  /* aggregation-like prolongator, with some blocks not full */
+  ierr = MatCreate(PETSC_COMM_WORLD,&P);CHKERRQ(ierr);
+  ierr = MatSetSizes(P,rend-rstart,PETSC_DECIDE,N*bs,Nc*cbs);CHKERRQ(ierr);
+  ierr = MatSetBlockSizes(P,bs,cbs);CHKERRQ(ierr);
+  ierr = MatSetType(P,MATAIJ);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(P,2*cbs,NULL);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation(P,2*cbs,NULL,2*cbs,NULL);CHKERRQ(ierr);
+  for (row=rstart; row<rend; row++) {
+    k = row/bs;
+    for (c=0; c<cbs; c++) {
+      col  = (k/3)*cbs + c;
+      ierr = MatSetValue(P,row,col,1.0/(1.0+row%bs+c),INSERT_VALUES);CHKERRQ(ierr);
+      if ((row+c)%2) {
+        col  = ((k/3+Nc/2)%Nc)*cbs + c;
+        ierr = MatSetValue(P,row,col,0.5*PetscCosReal((PetscReal)(row+c)),INSERT_VALUES);CHKERRQ(ierr);
+      }
+    }
+  }
+  ierr = MatAssemblyBegin(P,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(P,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+  ierr = MatPtAP(A,P,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&C);CHKERRQ(ierr);
+  ierr = MatPtAP(B,P,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&D);CHKERRQ(ierr);
+  ierr = PetscObjectTypeCompareAny((PetscObject)D,&isbaij,MATSEQBAIJ,MATMPIBAIJ,"");CHKERRQ(ierr);
+  ierr = MatGetBlockSize(D,&k);CHKERRQ(ierr);
+  ierr = PetscPrintf(PETSC_COMM_WORLD,"P^T*A*P is %s with block size %D\n",isbaij ? "BAIJ" : "not BAIJ",k);CHKERRQ(ierr);
+  ierr = CheckEqual(C,D,"MatPtAP()");CHKERRQ(ierr);
+  ierr = MatMatMult(A,P,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&AP);CHKERRQ(ierr);
+  ierr = MatMatMult(B,P,MAT_INITIAL_MATRIX,PETSC_DEFAULT,&BP);CHKERRQ(ierr);
+  ierr = CheckEqual(AP,BP,"MatMatMult()");CHKERRQ(ierr);
+
+  /* numeric products with new values */
+  ierr = MatScale(A,-3.0);CHKERRQ(ierr);
+  ierr = MatScale(B,-3.0);CHKERRQ(ierr);
+  ierr = MatScale(P,0.5);CHKERRQ(ierr);
+  ierr = MatPtAP(A,P,MAT_REUSE_MATRIX,PETSC_DEFAULT,&C);CHKERRQ(ierr);
+  ierr = MatPtAP(B,P,MAT_REUSE_MATRIX,PETSC_DEFAULT,&D);CHKERRQ(ierr);
+  ierr = CheckEqual(C,D,"MatPtAP() with MAT_REUSE_MATRIX");CHKERRQ(ierr);
+  ierr = MatMatMult(A,P,MAT_REUSE_MATRIX,PETSC_DEFAULT,&AP);CHKERRQ(ierr);
+  ierr = MatMatMult(B,P,MAT_REUSE_MATRIX,PETSC_DEFAULT,&BP);CHKERRQ(ierr);
+  ierr = CheckEqual(AP,BP,"MatMatMult() with MAT_REUSE_MATRIX");CHKERRQ(ierr);
+
+  ierr = PetscFree(v);CHKERRQ(ierr);
+  ierr = MatDestroy(&A);CHKERRQ(ierr);
+  ierr = MatDestroy(&B);CHKERRQ(ierr);
+  ierr = MatDestroy(&P);CHKERRQ(ierr);
+  ierr = MatDestroy(&C);CHKERRQ(ierr);
+  ierr = MatDestroy(&D);CHKERRQ(ierr);
+  ierr = MatDestroy(&AP);CHKERRQ(ierr);
+  ierr = MatDestroy(&BP);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      nsize: {{1 3}}
+      output_file: output/ex244_1.out
+
+   test:
+      suffix: 2
+      nsize: {{1 2 4}}
+      args: -bs 2 -cbs 3 -m 10
+      output_file: output/ex244_2.out
+
+TEST*/
@@ -0,0 +1,245 @@
+
+#include <../src/mat/impls/aij/mpi/mpiaij.h>
+#include <../src/mat/impls/aij/seq/aijmixed/aijmixed.h>
+
+/*@C
+   MatCreateMPIAIJMixed - Creates a sparse parallel matrix whose local
+   portions are stored as MATSEQAIJMIXED matrices (a matrix class that inherits
+   from SEQAIJ but only stores the values in single precision and the column
+   indices in 32 bit integers once its products and relaxations have run).
+   The same guidelines that apply to MPIAIJ matrices for preallocating the matrix
+   storage apply here as well.
+
+      Collective
+
+   Input Parameters:
++  comm - MPI communicator
+.  m - number of local rows (or PETSC_DECIDE to have calculated if M is given)
+           This value should be the same as the local size used in creating the
+           y vector for the matrix-vector product y = Ax.
+.  n - This value should be the same as the local size used in creating the
+       x vector for the matrix-vector product y = Ax. (or PETSC_DECIDE to have
+       calculated if N is given) For square matrices n is almost always m.
+.  M - number of global rows (or PETSC_DETERMINE to have calculated if m is given)
+.  N - number of global columns (or PETSC_DETERMINE to have calculated if n is given)
+.  d_nz  - number of nonzeros per row in DIAGONAL portion of local submatrix
+           (same value is used for all local rows)
+.  d_nnz - array containing the number of nonzeros in the various rows of the
+           DIAGONAL portion of the local submatrix (possibly different for each row)
+           or NULL, if d_nz is used to specify the nonzero structure.
+           The size of this array is equal to the number of local rows, i.e 'm'.
+.  o_nz  - number of nonzeros per row in the OFF-DIAGONAL portion of local
+           submatrix (same value is used for all local rows).
+-  o_nnz - array containing the number of nonzeros in the various rows of the
+           OFF-DIAGONAL portion of the local submatrix (possibly different for
+           each row) or NULL, if o_nz is used to specify the nonzero
+           structure. The size of this array is equal to the number
+           of local rows, i.e 'm'.
+
+   Output Parameter:
+.  A - the matrix
+
+   Notes:
+   If the *_nnz parameter is given then the *_nz parameter is ignored
+
+   When calling this routine with a single process communicator, a matrix of
+   type SEQAIJMIXED is returned.
+
+   Level: intermediate
+
+.seealso: MatCreate(), MatCreateSeqAIJMixed(), MatSetValues(), MATAIJMIXED
+@*/
+PetscErrorCode  MatCreateMPIAIJMixed(MPI_Comm comm,PetscInt m,PetscInt n,PetscInt M,PetscInt N,PetscInt d_nz,const PetscInt d_nnz[],PetscInt o_nz,const PetscInt o_nnz[],Mat *A)
+{
+  PetscErrorCode ierr;
+  PetscMPIInt    size;
+
+  PetscFunctionBegin;
+  ierr = MatCreate(comm,A);CHKERRQ(ierr);
+  ierr = MatSetSizes(*A,m,n,M,N);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  if (size > 1) {
+    ierr = MatSetType(*A,MATMPIAIJMIXED);CHKERRQ(ierr);
+    ierr = MatMPIAIJSetPreallocation(*A,d_nz,d_nnz,o_nz,o_nnz);CHKERRQ(ierr);
+  } else {
+    ierr = MatSetType(*A,MATSEQAIJMIXED);CHKERRQ(ierr);
+    ierr = MatSeqAIJSetPreallocation(*A,d_nz,d_nnz);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+/* Rebuilds the MATSEQAIJ storage of both blocks */
+static PetscErrorCode MatMPIAIJMixedExpand_Private(Mat A)
+{
+  Mat_MPIAIJ     *a = (Mat_MPIAIJ*)A->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(a->A);CHKERRQ(ierr);
+  ierr = MatAIJMixedExpand_Private(a->B);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMPIAIJSetPreallocation_MPIAIJMixed(Mat B,PetscInt d_nz,const PetscInt d_nnz[],PetscInt o_nz,const PetscInt o_nnz[])
+{
+  Mat_MPIAIJ     *b = (Mat_MPIAIJ*)B->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatMPIAIJMixedExpand_Private(B);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation_MPIAIJ(B,d_nz,d_nnz,o_nz,o_nnz);CHKERRQ(ierr);
+  ierr = MatConvert_SeqAIJ_SeqAIJMixed(b->A, MATSEQAIJMIXED, MAT_INPLACE_MATRIX, &b->A);CHKERRQ(ierr);
+  ierr = MatConvert_SeqAIJ_SeqAIJMixed(b->B, MATSEQAIJMIXED, MAT_INPLACE_MATRIX, &b->B);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatSetPreallocationCOO_MPIAIJMixed(Mat A,PetscInt n,const PetscInt i[],const PetscInt j[])
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatMPIAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatSetPreallocationCOO_MPIAIJ(A,n,i,j);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatSetValuesCOO_MPIAIJMixed(Mat A,const PetscScalar v[],InsertMode imode)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatMPIAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatSetValuesCOO_MPIAIJ(A,v,imode);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatDestroy_MPIAIJMixed(Mat A)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (A->spptr) {
+    ierr = MatAIJMixedUnwrapOperations_Private(A,MATMPIAIJMIXED);CHKERRQ(ierr);
+    ierr = PetscFree(A->spptr);CHKERRQ(ierr);
+  }
+  ierr = PetscObjectChangeTypeName((PetscObject)A,MATMPIAIJ);CHKERRQ(ierr);
+  ierr = MatDestroy_MPIAIJ(A);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   The blocks are MATSEQAIJMIXED matrices, whose kernels MatMult_MPIAIJ() and the other MATMPIAIJ kernels call; the
+   operations of MATMPIAIJ that read the storage of the blocks are wrapped to rebuild it first
+*/
+PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPIAIJMixed(Mat A,MatType type,MatReuse reuse,Mat *newmat)
+{
+  PetscErrorCode ierr;
+  Mat            B = *newmat;
+  Mat_MPIAIJ     *b;
+  Mat_AIJMixed   *mixed;
+  PetscBool      sametype;
+
+  PetscFunctionBegin;
+  if (reuse == MAT_INITIAL_MATRIX) {
+    ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  }
+  ierr = PetscObjectTypeCompare((PetscObject)A,type,&sametype);CHKERRQ(ierr);
+  if (sametype) PetscFunctionReturn(0);
+
+  b = (Mat_MPIAIJ*)B->data;
+  if (b->A) {ierr = MatConvert_SeqAIJ_SeqAIJMixed(b->A, MATSEQAIJMIXED, MAT_INPLACE_MATRIX, &b->A);CHKERRQ(ierr);}
+  if (b->B) {ierr = MatConvert_SeqAIJ_SeqAIJMixed(b->B, MATSEQAIJMIXED, MAT_INPLACE_MATRIX, &b->B);CHKERRQ(ierr);}
+
+  ierr            = PetscNewLog(B,&mixed);CHKERRQ(ierr);
+  B->spptr        = (void*)mixed;
+  mixed->basetype = MATMPIAIJ;
+  mixed->expand   = MatMPIAIJMixedExpand_Private;
+  B->ops->destroy = MatDestroy_MPIAIJMixed;
+  ierr = MatAIJMixedWrapOperations_Private(B,MATMPIAIJMIXED);CHKERRQ(ierr);
+
+  ierr = PetscObjectChangeTypeName((PetscObject) B, MATMPIAIJMIXED);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatMPIAIJSetPreallocation_C",MatMPIAIJSetPreallocation_MPIAIJMixed);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSetPreallocationCOO_C",MatSetPreallocationCOO_MPIAIJMixed);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSetValuesCOO_C",MatSetValuesCOO_MPIAIJMixed);CHKERRQ(ierr);
+  *newmat = B;
+  PetscFunctionReturn(0);
+}
+
+/*
+   MatMPIAIJMixedDemote_Private - Gives B the values of the assembled MATMPIAIJ matrix A in single precision
+
+   The diagonal and off-diagonal blocks of B are obtained from those of A with MatSeqAIJMixedDemote_Private(), so they
+   share their structure with the blocks of A; the communication pattern is copied as in MatDuplicate().
+*/
+PetscErrorCode MatMPIAIJMixedDemote_Private(Mat A,MatReuse reuse,Mat *B)
+{
+  Mat_MPIAIJ     *a = (Mat_MPIAIJ*)A->data,*b;
+  PetscErrorCode ierr;
+  PetscInt       len;
+
+  PetscFunctionBegin;
+  if (!A->assembled) SETERRQ(PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_WRONGSTATE,"Not for unassembled matrix");
+  if (reuse == MAT_REUSE_MATRIX) {
+    b    = (Mat_MPIAIJ*)(*B)->data;
+    ierr = MatSeqAIJMixedDemote_Private(a->A,MAT_REUSE_MATRIX,&b->A);CHKERRQ(ierr);
+    ierr = MatSeqAIJMixedDemote_Private(a->B,MAT_REUSE_MATRIX,&b->B);CHKERRQ(ierr);
+    ierr = PetscObjectStateIncrease((PetscObject)*B);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = MatCreate(PetscObjectComm((PetscObject)A),B);CHKERRQ(ierr);
+  ierr = MatSetSizes(*B,A->rmap->n,A->cmap->n,A->rmap->N,A->cmap->N);CHKERRQ(ierr);
+  ierr = MatSetBlockSizesFromMats(*B,A,A);CHKERRQ(ierr);
+  ierr = MatSetType(*B,MATMPIAIJMIXED);CHKERRQ(ierr);
+  b    = (Mat_MPIAIJ*)(*B)->data;
+  ierr = PetscLayoutReference(A->rmap,&(*B)->rmap);CHKERRQ(ierr);
+  ierr = PetscLayoutReference(A->cmap,&(*B)->cmap);CHKERRQ(ierr);
+  (*B)->assembled    = PETSC_TRUE;
+  (*B)->preallocated = PETSC_TRUE;
+  (*B)->nonzerostate = A->nonzerostate;
+  b->donotstash      = a->donotstash;
+  b->roworiented     = a->roworiented;
+  len  = a->B->cmap->n;
+  ierr = PetscMalloc1(len+1,&b->garray);CHKERRQ(ierr);
+  ierr = PetscArraycpy(b->garray,a->garray,len);CHKERRQ(ierr);
+  ierr = VecDuplicate(a->lvec,&b->lvec);CHKERRQ(ierr);
+  ierr = PetscLogObjectParent((PetscObject)*B,(PetscObject)b->lvec);CHKERRQ(ierr);
+  ierr = VecScatterCopy(a->Mvctx,&b->Mvctx);CHKERRQ(ierr);
+  ierr = PetscLogObjectParent((PetscObject)*B,(PetscObject)b->Mvctx);CHKERRQ(ierr);
+  if (a->Mvctx_mpi1) {
+    ierr = VecScatterCopy(a->Mvctx_mpi1,&b->Mvctx_mpi1);CHKERRQ(ierr);
+    ierr = PetscLogObjectParent((PetscObject)*B,(PetscObject)b->Mvctx_mpi1);CHKERRQ(ierr);
+  }
+  ierr = MatSeqAIJMixedDemote_Private(a->A,MAT_INITIAL_MATRIX,&b->A);CHKERRQ(ierr);
+  ierr = PetscLogObjectParent((PetscObject)*B,(PetscObject)b->A);CHKERRQ(ierr);
+  ierr = MatSeqAIJMixedDemote_Private(a->B,MAT_INITIAL_MATRIX,&b->B);CHKERRQ(ierr);
+  ierr = PetscLogObjectParent((PetscObject)*B,(PetscObject)b->B);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJMixed(Mat A)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatSetType(A,MATMPIAIJ);CHKERRQ(ierr);
+  ierr = MatConvert_MPIAIJ_MPIAIJMixed(A,MATMPIAIJMIXED,MAT_INPLACE_MATRIX,&A);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*MC
+   MATAIJMIXED - MATAIJMIXED = "aijmixed" - A matrix type to be used for sparse matrices whose products and relaxations
+   use the values in single precision and the column indices in 32 bit integers, and that only keep this storage.
+
+   This matrix type is identical to MATSEQAIJMIXED when constructed with a single process communicator,
+   and MATMPIAIJMIXED otherwise.  As a result, for single process communicators,
+  MatSeqAIJSetPreallocation() is supported, and similarly MatMPIAIJSetPreallocation() is supported
+  for communicators controlling multiple processes.  It is recommended that you call both of
+  the above preallocation routines for simplicity.
+
+   Options Database Keys:
+. -mat_type aijmixed - sets the matrix type to "aijmixed" during a call to MatSetFromOptions()
+
+  Level: intermediate
+
+.seealso: MatCreateMPIAIJMixed(), MATSEQAIJMIXED, MATMPIAIJMIXED
+M*/
@@ -1,4 +1,5 @@
 #include <../src/mat/impls/aij/mpi/mpiaij.h>   /*I "petscmat.h" I*/
+#include <../src/mat/impls/aij/seq/aijmixed/aijmixed.h>
 #include <petsc/private/vecimpl.h>
 #include <petsc/private/vecscatterimpl.h>
 #include <petsc/private/isimpl.h>
@@ -1277,6 +1278,9 @@ PetscErrorCode MatDestroy_MPIAIJ(Mat mat)
   if (aij->Mvctx_mpi1) {ierr = VecScatterDestroy(&aij->Mvctx_mpi1);CHKERRQ(ierr);}
   ierr = PetscFree2(aij->rowvalues,aij->rowindices);CHKERRQ(ierr);
   ierr = PetscFree(aij->ld);CHKERRQ(ierr);
+  ierr = PetscSFDestroy(&aij->coo_sf);CHKERRQ(ierr);
+  ierr = PetscFree2(aij->coo_own,aij->coo_send);CHKERRQ(ierr);
+  ierr = PetscFree2(aij->coo_sendbuf,aij->coo_buf);CHKERRQ(ierr);
   ierr = PetscFree(mat->data);CHKERRQ(ierr);
 
   ierr = PetscObjectChangeTypeName((PetscObject)mat,0);CHKERRQ(ierr);
@@ -1298,6 +1302,10 @@ PetscErrorCode MatDestroy_MPIAIJ(Mat mat)
 #endif
   ierr = PetscObjectComposeFunction((PetscObject)mat,"MatConvert_mpiaij_is_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)mat,"MatPtAP_is_mpiaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)mat,"MatPtAP_mpibaij_mpiaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)mat,"MatMatMult_mpibaij_mpiaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)mat,"MatSetPreallocationCOO_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)mat,"MatSetValuesCOO_C",NULL);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
@@ -2887,6 +2895,145 @@ PetscErrorCode MatResetPreallocation_MPIAIJ(Mat B)
   PetscFunctionReturn(0);
 }
 
+/*
+   Entries in rows owned by other processes are leaves of a star forest whose roots are the local rows of their owners;
+   PetscSFGather() then delivers them, in a fixed order, right after the entries the owner provided itself. The diagonal
+   and off-diagonal blocks are preallocated from this combined list with MatSetPreallocationCOO_SeqAIJ() and their
+   permutations are redirected into it, so a reassembly is one gather plus one summation pass per block.
+
+   The off-diagonal block is built with global column indices; MatSetUpMultiply_MPIAIJ() relabels them in place with
+   a monotone map, which preserves the position of every nonzero and hence the permutation.
+*/
+PetscErrorCode MatSetPreallocationCOO_MPIAIJ(Mat mat,PetscInt ncoo,const PetscInt coo_i[],const PetscInt coo_j[])
+{
+  Mat_MPIAIJ     *mpiaij = (Mat_MPIAIJ*)mat->data;
+  Mat_SeqAIJ     *seq;
+  PetscErrorCode ierr;
+  PetscInt       M = mat->rmap->N,N = mat->cmap->N,m = mat->rmap->n,rstart = mat->rmap->rstart,rend = mat->rmap->rend;
+  PetscInt       cstart = mat->cmap->rstart,cend = mat->cmap->rend;
+  PetscInt       k,r,d,p,n1 = 0,n2 = 0,nrecv = 0,ntot,nA = 0,nB = 0,lidx;
+  PetscInt       *own,*send,*sendj,*ci,*cj,*Ai,*Aj,*Apos,*Bi,*Bj,*Bpos;
+  PetscMPIInt    owner;
+  PetscSFNode    *iremote;
+  PetscSF        sf;
+  const PetscInt *degree;
+
+  PetscFunctionBegin;
+  for (k=0; k<ncoo; k++) {
+    if (coo_i[k] < 0 || coo_j[k] < 0) continue;
+    if (coo_i[k] >= M) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"COO row index %D out of range [0,%D)",coo_i[k],M);
+    if (coo_j[k] >= N) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"COO column index %D out of range [0,%D)",coo_j[k],N);
+    if (coo_i[k] >= rstart && coo_i[k] < rend) n1++;
+    else n2++;
+  }
+  ierr = PetscMalloc2(n1,&own,n2,&send);CHKERRQ(ierr);
+  ierr = PetscMalloc1(n2,&iremote);CHKERRQ(ierr);
+  ierr = PetscMalloc1(n2,&sendj);CHKERRQ(ierr);
+  n1 = n2 = 0;
+  for (k=0; k<ncoo; k++) {
+    if (coo_i[k] < 0 || coo_j[k] < 0) continue;
+    if (coo_i[k] >= rstart && coo_i[k] < rend) own[n1++] = k;
+    else {
+      ierr = PetscLayoutFindOwnerIndex(mat->rmap,coo_i[k],&owner,&lidx);CHKERRQ(ierr);
+      iremote[n2].rank  = owner;
+      iremote[n2].index = lidx;
+      sendj[n2]         = coo_j[k];
+      send[n2++]        = k;
+    }
+  }
+  ierr = PetscSFCreate(PetscObjectComm((PetscObject)mat),&sf);CHKERRQ(ierr);
+  ierr = PetscSFSetGraph(sf,m,n2,NULL,PETSC_OWN_POINTER,iremote,PETSC_OWN_POINTER);CHKERRQ(ierr);
+  ierr = PetscSFSetUp(sf);CHKERRQ(ierr);
+  ierr = PetscSFComputeDegreeBegin(sf,&degree);CHKERRQ(ierr);
+  ierr = PetscSFComputeDegreeEnd(sf,&degree);CHKERRQ(ierr);
+  for (r=0; r<m; r++) nrecv += degree[r];
+  ntot = n1 + nrecv;
+
+  /* combined list: owned entries first, then the received ones which arrive grouped by local row */
+  ierr = PetscMalloc2(ntot,&ci,ntot,&cj);CHKERRQ(ierr);
+  for (p=0; p<n1; p++) {
+    ci[p] = coo_i[own[p]] - rstart;
+    cj[p] = coo_j[own[p]];
+  }
+  ierr = PetscSFGatherBegin(sf,MPIU_INT,sendj,cj+n1);CHKERRQ(ierr);
+  ierr = PetscSFGatherEnd(sf,MPIU_INT,sendj,cj+n1);CHKERRQ(ierr);
+  ierr = PetscFree(sendj);CHKERRQ(ierr);
+  for (r=0,p=n1; r<m; r++) {
+    for (d=0; d<degree[r]; d++) ci[p++] = r;
+  }
+
+  for (p=0; p<ntot; p++) {
+    if (cj[p] >= cstart && cj[p] < cend) nA++;
+    else nB++;
+  }
+  ierr = PetscMalloc3(nA,&Ai,nA,&Aj,nA,&Apos);CHKERRQ(ierr);
+  ierr = PetscMalloc3(nB,&Bi,nB,&Bj,nB,&Bpos);CHKERRQ(ierr);
+  nA = nB = 0;
+  for (p=0; p<ntot; p++) {
+    if (cj[p] >= cstart && cj[p] < cend) {
+      Ai[nA] = ci[p]; Aj[nA] = cj[p] - cstart; Apos[nA++] = p;
+    } else {
+      Bi[nB] = ci[p]; Bj[nB] = cj[p];          Bpos[nB++] = p;
+    }
+  }
+  ierr = PetscFree2(ci,cj);CHKERRQ(ierr);
+
+  /* rebuild empty diagonal and off-diagonal blocks, then give them their exact structure */
+  ierr = MatMPIAIJSetPreallocation_MPIAIJ(mat,0,NULL,0,NULL);CHKERRQ(ierr);
+  ierr = MatSetPreallocationCOO_SeqAIJ(mpiaij->A,nA,Ai,Aj);CHKERRQ(ierr);
+  ierr = MatSetPreallocationCOO_SeqAIJ(mpiaij->B,nB,Bi,Bj);CHKERRQ(ierr);
+  seq  = (Mat_SeqAIJ*)mpiaij->A->data;
+  for (p=0; p<seq->coo_jmap[seq->nz]; p++) seq->coo_perm[p] = Apos[seq->coo_perm[p]];
+  seq->coo_n = ntot;
+  seq  = (Mat_SeqAIJ*)mpiaij->B->data;
+  for (p=0; p<seq->coo_jmap[seq->nz]; p++) seq->coo_perm[p] = Bpos[seq->coo_perm[p]];
+  seq->coo_n = ntot;
+  ierr = PetscFree3(Ai,Aj,Apos);CHKERRQ(ierr);
+  ierr = PetscFree3(Bi,Bj,Bpos);CHKERRQ(ierr);
+
+  ierr = PetscSFDestroy(&mpiaij->coo_sf);CHKERRQ(ierr);
+  ierr = PetscFree2(mpiaij->coo_own,mpiaij->coo_send);CHKERRQ(ierr);
+  ierr = PetscFree2(mpiaij->coo_sendbuf,mpiaij->coo_buf);CHKERRQ(ierr);
+  mpiaij->coo_sf   = sf;
+  mpiaij->coo_n1   = n1;
+  mpiaij->coo_n2   = n2;
+  mpiaij->coo_own  = own;
+  mpiaij->coo_send = send;
+  ierr = PetscMalloc2(n2,&mpiaij->coo_sendbuf,ntot,&mpiaij->coo_buf);CHKERRQ(ierr);
+
+  /* builds garray, lvec and Mvctx; the blocks are already assembled so nothing else moves */
+  ierr = MatAssemblyBegin(mat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(mat,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatSetValuesCOO_MPIAIJ(Mat mat,const PetscScalar coo_v[],InsertMode imode)
+{
+  Mat_MPIAIJ     *mpiaij = (Mat_MPIAIJ*)mat->data;
+  PetscErrorCode ierr;
+  PetscInt       p,n1 = mpiaij->coo_n1,n2 = mpiaij->coo_n2;
+  PetscScalar    *sendbuf = mpiaij->coo_sendbuf,*buf = mpiaij->coo_buf;
+
+  PetscFunctionBegin;
+  if (!mpiaij->coo_sf) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"Must call MatSetPreallocationCOO() first");
+  if (coo_v) {
+    for (p=0; p<n2; p++) sendbuf[p] = coo_v[mpiaij->coo_send[p]];
+  } else {
+    ierr = PetscArrayzero(sendbuf,n2);CHKERRQ(ierr);
+  }
+  ierr = PetscSFGatherBegin(mpiaij->coo_sf,MPIU_SCALAR,sendbuf,buf+n1);CHKERRQ(ierr);
+  if (coo_v) {
+    for (p=0; p<n1; p++) buf[p] = coo_v[mpiaij->coo_own[p]];
+  } else {
+    ierr = PetscArrayzero(buf,n1);CHKERRQ(ierr);
+  }
+  ierr = PetscSFGatherEnd(mpiaij->coo_sf,MPIU_SCALAR,sendbuf,buf+n1);CHKERRQ(ierr);
+  ierr = MatSetValuesCOO_SeqAIJ(mpiaij->A,buf,imode);CHKERRQ(ierr);
+  ierr = MatSetValuesCOO_SeqAIJ(mpiaij->B,buf,imode);CHKERRQ(ierr);
+  ierr = VecDestroy(&mpiaij->diag);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode MatDuplicate_MPIAIJ(Mat matin,MatDuplicateOption cpvalues,Mat *newmat)
 {
   Mat            mat;
@@ -4588,6 +4735,8 @@ PetscErrorCode MatMPIAIJGetSeqAIJ(Mat A,Mat *Ad,Mat *Ao,const PetscInt *colmap[]
   PetscFunctionBegin;
   ierr = PetscStrbeginswith(((PetscObject)A)->type_name,MATMPIAIJ,&flg);CHKERRQ(ierr);
   if (!flg) SETERRQ(PetscObjectComm((PetscObject)A),PETSC_ERR_SUP,"This function requires a MATMPIAIJ matrix as input");
+  /* the blocks of a MATMPIAIJMIXED matrix must have their MATSEQAIJ storage for callers that read it */
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
   if (Ad)     *Ad     = a->A;
   if (Ao)     *Ao     = a->B;
   if (colmap) *colmap = a->garray;
@@ -5179,6 +5328,7 @@ PetscErrorCode MatMPIAIJGetLocalMat(Mat A,MatReuse scall,Mat *A_loc)
   PetscFunctionBegin;
   ierr = PetscStrbeginswith(((PetscObject)A)->type_name,MATMPIAIJ,&match);CHKERRQ(ierr);
   if (!match) SETERRQ(PetscObjectComm((PetscObject)A), PETSC_ERR_SUP,"Requires MATMPIAIJ matrix as input");
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
   ierr = MPI_Comm_size(PetscObjectComm((PetscObject)A),&size);CHKERRQ(ierr);
   if (size == 1) {
     if (scall == MAT_INITIAL_MATRIX) {
@@ -5950,6 +6100,9 @@ PetscErrorCode MatGetCommunicationStructs(Mat A, Vec *lvec, PetscInt *colmap[],
 
 PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPIAIJCRL(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPIAIJPERM(Mat,MatType,MatReuse,Mat*);
+#if !defined(PETSC_USE_COMPLEX)
+PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPIAIJMixed(Mat,MatType,MatReuse,Mat*);
+#endif
 PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPIAIJSELL(Mat,MatType,MatReuse,Mat*);
 #if defined(PETSC_HAVE_MKL_SPARSE)
 PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPIAIJMKL(Mat,MatType,MatReuse,Mat*);
@@ -5966,6 +6119,8 @@ PETSC_INTERN PetscErrorCode MatMatMatMult_Transpose_AIJ_AIJ(Mat,Mat,Mat,MatReuse
 PETSC_INTERN PetscErrorCode MatConvert_XAIJ_IS(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_MPIAIJ_MPISELL(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatPtAP_IS_XAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
+PETSC_INTERN PetscErrorCode MatPtAP_XBAIJ_XAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
+PETSC_INTERN PetscErrorCode MatMatMult_XBAIJ_XAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
 
 /*
     Computes (B'*A')' since computing B*A directly is untenable
@@ -6098,6 +6253,9 @@ PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJ(Mat B)
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatDiagonalScaleLocal_C",MatDiagonalScaleLocal_MPIAIJ);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_mpiaij_mpiaijperm_C",MatConvert_MPIAIJ_MPIAIJPERM);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_mpiaij_mpiaijsell_C",MatConvert_MPIAIJ_MPIAIJSELL);CHKERRQ(ierr);
+#if !defined(PETSC_USE_COMPLEX)
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_mpiaij_mpiaijmixed_C",MatConvert_MPIAIJ_MPIAIJMixed);CHKERRQ(ierr);
+#endif
 #if defined(PETSC_HAVE_MKL_SPARSE)
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_mpiaij_mpiaijmkl_C",MatConvert_MPIAIJ_MPIAIJMKL);CHKERRQ(ierr);
 #endif
@@ -6119,6 +6277,10 @@ PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJ(Mat B)
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatMatMatMult_transpose_mpiaij_mpiaij_C",MatMatMatMult_Transpose_AIJ_AIJ);CHKERRQ(ierr);
 #endif
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatPtAP_is_mpiaij_C",MatPtAP_IS_XAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatPtAP_mpibaij_mpiaij_C",MatPtAP_XBAIJ_XAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatMatMult_mpibaij_mpiaij_C",MatMatMult_XBAIJ_XAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSetPreallocationCOO_C",MatSetPreallocationCOO_MPIAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSetValuesCOO_C",MatSetValuesCOO_MPIAIJ);CHKERRQ(ierr);
   ierr = PetscObjectChangeTypeName((PetscObject)B,MATMPIAIJ);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -79,6 +79,12 @@ typedef struct {
   /* used by MatMatMatMult() */
   Mat_MatMatMatMult *matmatmatmult;
 
+  /* Used by MatSetPreallocationCOO() and MatSetValuesCOO() */
+  PetscSF     coo_sf;                  /* gathers the entries of rows owned by other processes at their owners */
+  PetscInt    coo_n1,coo_n2;           /* number of entries in locally owned rows, number of entries sent away */
+  PetscInt    *coo_own,*coo_send;      /* positions in the user's value array of the owned and of the sent entries */
+  PetscScalar *coo_sendbuf,*coo_buf;   /* packed outgoing values; owned values followed by the received ones */
+
   /* Used by MPICUSP and MPICUSPARSE classes */
   void * spptr;
 
@@ -91,6 +97,8 @@ PETSC_INTERN PetscErrorCode MatAssemblyEnd_MPIAIJ(Mat,MatAssemblyType);
 PETSC_INTERN PetscErrorCode MatSetUpMultiply_MPIAIJ(Mat);
 PETSC_INTERN PetscErrorCode MatDisAssemble_MPIAIJ(Mat);
 PETSC_INTERN PetscErrorCode MatDuplicate_MPIAIJ(Mat,MatDuplicateOption,Mat*);
+PETSC_INTERN PetscErrorCode MatSetPreallocationCOO_MPIAIJ(Mat,PetscInt,const PetscInt[],const PetscInt[]);
+PETSC_INTERN PetscErrorCode MatSetValuesCOO_MPIAIJ(Mat,const PetscScalar[],InsertMode);
 PETSC_INTERN PetscErrorCode MatIncreaseOverlap_MPIAIJ(Mat,PetscInt,IS [],PetscInt);
 PETSC_INTERN PetscErrorCode MatIncreaseOverlap_MPIAIJ_Scalable(Mat,PetscInt,IS [],PetscInt);
 PETSC_INTERN PetscErrorCode MatFDColoringCreate_MPIXAIJ(Mat,ISColoring,MatFDColoring);
@@ -213,6 +213,80 @@ PETSC_INTERN PetscErrorCode MatPtAP_MPIAIJ_MPIAIJ(Mat A,Mat P,MatReuse scall,Pet
   PetscFunctionReturn(0);
 }
 
+/*
+   Threaded numeric AP_loc = A_loc*P = Ad*P_loc + Ao*P_oth, used once threads were set on the diagonal block of A with
+   MatSeqAIJSetNumThreads(). The rows of AP_loc are split among its threads; with dense each thread accumulates its rows
+   in its own array of pN entries, otherwise it merges them into the sorted rows of AP_loc. The column indices of AP_loc
+   must be global.
+*/
+static PetscErrorCode MatPtAPNumericAPloc_MPIAIJ_Threaded(Mat A,Mat P,Mat_APMPI *ptap,PetscBool dense)
+{
+  PetscErrorCode ierr;
+  Mat_MPIAIJ     *a   = (Mat_MPIAIJ*)A->data;
+  Mat_SeqAIJ     *ap  = (Mat_SeqAIJ*)(ptap->AP_loc)->data;
+  Mat_SeqAIJ     *As[2],*Ps[2];
+  PetscInt       nt   = ap->threads.nthreads,pN = P->cmap->N,t;
+  const PetscInt *rstart;
+  PetscScalar    *work = NULL;
+  PetscLogDouble flops = 0.0;
+
+  PetscFunctionBegin;
+  As[0] = (Mat_SeqAIJ*)(a->A)->data;
+  Ps[0] = (Mat_SeqAIJ*)(ptap->P_loc)->data;
+  As[1] = (Mat_SeqAIJ*)(a->B)->data;
+  Ps[1] = ptap->P_oth ? (Mat_SeqAIJ*)(ptap->P_oth)->data : NULL;
+  ierr  = MatSeqAIJGetThreadPartition_Private(ptap->AP_loc,MAT_SEQAIJ_PARTITION_ROWS,NULL,&rstart);CHKERRQ(ierr);
+  if (dense) {ierr = PetscMalloc1(nt*pN,&work);CHKERRQ(ierr);}
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static,1) reduction(+:flops)
+#endif
+  for (t=0; t<nt; t++) {
+    PetscScalar    *apa = work ? work + t*pN : NULL,v;
+    MatScalar      *ca,*pa;
+    const PetscInt *cj,*pj;
+    PetscInt       r,s,j,k,kk,row,cnz,pnz;
+
+    if (apa) {
+      for (k=0; k<pN; k++) apa[k] = 0.0;
+    }
+    for (r=rstart[t]; r<rstart[t+1]; r++) {
+      cnz = ap->i[r+1] - ap->i[r];
+      cj  = ap->j + ap->i[r];
+      ca  = ap->a + ap->i[r];
+      if (!apa) {
+        for (k=0; k<cnz; k++) ca[k] = 0.0;
+      }
+      for (s=0; s<2; s++) {
+        if (!Ps[s]) continue;
+        for (j=As[s]->i[r]; j<As[s]->i[r+1]; j++) {
+          row = As[s]->j[j];
+          v   = As[s]->a[j];
+          pnz = Ps[s]->i[row+1] - Ps[s]->i[row];
+          pj  = Ps[s]->j + Ps[s]->i[row];
+          pa  = Ps[s]->a + Ps[s]->i[row];
+          if (apa) { /* dense axpy */
+            for (k=0; k<pnz; k++) apa[pj[k]] += v*pa[k];
+          } else { /* sparse axpy */
+            for (k=0,kk=0; k<pnz; kk++) {
+              if (cj[kk] == pj[k]) {ca[kk] += v*pa[k]; k++;}
+            }
+          }
+          flops += 2.0*pnz;
+        }
+      }
+      if (apa) {
+        for (k=0; k<cnz; k++) {
+          ca[k]      = apa[cj[k]];
+          apa[cj[k]] = 0.0;
+        }
+      }
+    }
+  }
+  ierr = PetscFree(work);CHKERRQ(ierr);
+  ierr = PetscLogFlops(flops);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode MatPtAPNumeric_MPIAIJ_MPIAIJ_scalable(Mat A,Mat P,Mat C)
 {
   PetscErrorCode    ierr;
@@ -262,20 +336,29 @@ PetscErrorCode MatPtAPNumeric_MPIAIJ_MPIAIJ_scalable(Mat A,Mat P,Mat C)
   api   = ap->i;
   apj   = ap->j;
   ierr = ISLocalToGlobalMappingApply(ptap->ltog,api[AP_loc->rmap->n],apj,apj);CHKERRQ(ierr);
-  for (i=0; i<am; i++) {
-    /* AP[i,:] = A[i,:]*P = Ad*P_loc Ao*P_oth */
-    apnz = api[i+1] - api[i];
-    apa = ap->a + api[i];
-    ierr = PetscArrayzero(apa,apnz);CHKERRQ(ierr);
-    AProw_scalable(i,ad,ao,p_loc,p_oth,api,apj,apa);
+  if (ap->threads.nthreads > 1) {
+    ierr = MatPtAPNumericAPloc_MPIAIJ_Threaded(A,P,ptap,PETSC_FALSE);CHKERRQ(ierr);
+  } else {
+    for (i=0; i<am; i++) {
+      /* AP[i,:] = A[i,:]*P = Ad*P_loc Ao*P_oth */
+      apnz = api[i+1] - api[i];
+      apa = ap->a + api[i];
+      ierr = PetscArrayzero(apa,apnz);CHKERRQ(ierr);
+      AProw_scalable(i,ad,ao,p_loc,p_oth,api,apj,apa);
+    }
   }
   ierr = ISGlobalToLocalMappingApply(ptap->ltog,IS_GTOLM_DROP,api[AP_loc->rmap->n],apj,&nout,apj);CHKERRQ(ierr);
   if (api[AP_loc->rmap->n] != nout) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_INCOMP,"Incorrect mapping %D != %D\n",api[AP_loc->rmap->n],nout);
 
   /* 3) C_loc = Rd*AP_loc, C_oth = Ro*AP_loc */
-  /* Always use scalable version since we are in the MPI scalable version */
-  ierr = MatMatMultNumeric_SeqAIJ_SeqAIJ_Scalable(ptap->Rd,AP_loc,ptap->C_loc);CHKERRQ(ierr);
-  ierr = MatMatMultNumeric_SeqAIJ_SeqAIJ_Scalable(ptap->Ro,AP_loc,ptap->C_oth);CHKERRQ(ierr);
+  /* Always use scalable version since we are in the MPI scalable version, the threaded one only needs work space of the size of the rows */
+  if (ap->threads.nthreads > 1) {
+    ierr = MatMatMultNumeric_SeqAIJ_SeqAIJ_Threaded(ptap->Rd,AP_loc,ptap->C_loc);CHKERRQ(ierr);
+    ierr = MatMatMultNumeric_SeqAIJ_SeqAIJ_Threaded(ptap->Ro,AP_loc,ptap->C_oth);CHKERRQ(ierr);
+  } else {
+    ierr = MatMatMultNumeric_SeqAIJ_SeqAIJ_Scalable(ptap->Rd,AP_loc,ptap->C_loc);CHKERRQ(ierr);
+    ierr = MatMatMultNumeric_SeqAIJ_SeqAIJ_Scalable(ptap->Ro,AP_loc,ptap->C_oth);CHKERRQ(ierr);
+  }
 
   C_loc = ptap->C_loc;
   C_oth = ptap->C_oth;
@@ -472,6 +555,8 @@ PetscErrorCode MatPtAPSymbolic_MPIAIJ_MPIAIJ_scalable(Mat A,Mat P,PetscReal fill
   /* Create AP_loc for reuse */
   ierr = MatCreateSeqAIJWithArrays(PETSC_COMM_SELF,am,pN,api,apj,apv,&ptap->AP_loc);CHKERRQ(ierr);
   ierr = MatSeqAIJCompactOutExtraColumns_SeqAIJ(ptap->AP_loc, &ptap->ltog);CHKERRQ(ierr);
+  /* AP_loc, and through it the products C_loc = Rd*AP_loc and C_oth = Ro*AP_loc, use the threads of the diagonal block of A */
+  ierr = MatSeqAIJSetNumThreads(ptap->AP_loc,ad->threads.nthreads);CHKERRQ(ierr);
 
 #if defined(PETSC_USE_INFO)
   if (ao) {
@@ -1836,6 +1921,8 @@ PetscErrorCode MatPtAPSymbolic_MPIAIJ_MPIAIJ(Mat A,Mat P,PetscReal fill,Mat *C)
 
   /* Create AP_loc for reuse */
   ierr = MatCreateSeqAIJWithArrays(PETSC_COMM_SELF,am,pN,api,apj,apv,&ptap->AP_loc);CHKERRQ(ierr);
+  /* AP_loc, and through it the products C_loc = Rd*AP_loc and C_oth = Ro*AP_loc, use the threads of the diagonal block of A */
+  ierr = MatSeqAIJSetNumThreads(ptap->AP_loc,ad->threads.nthreads);CHKERRQ(ierr);
 
 #if defined(PETSC_USE_INFO)
   if (ao) {
@@ -2103,14 +2190,18 @@ PetscErrorCode MatPtAPNumeric_MPIAIJ_MPIAIJ(Mat A,Mat P,Mat C)
   apa   = ptap->apa;
   api   = ap->i;
   apj   = ap->j;
-  for (i=0; i<am; i++) {
-    /* AP[i,:] = A[i,:]*P = Ad*P_loc Ao*P_oth */
-    AProw_nonscalable(i,ad,ao,p_loc,p_oth,apa);
-    apnz = api[i+1] - api[i];
-    for (j=0; j<apnz; j++) {
-      col = apj[j+api[i]];
-      ap->a[j+ap->i[i]] = apa[col];
-      apa[col] = 0.0;
+  if (ap->threads.nthreads > 1) {
+    ierr = MatPtAPNumericAPloc_MPIAIJ_Threaded(A,P,ptap,PETSC_TRUE);CHKERRQ(ierr);
+  } else {
+    for (i=0; i<am; i++) {
+      /* AP[i,:] = A[i,:]*P = Ad*P_loc Ao*P_oth */
+      AProw_nonscalable(i,ad,ao,p_loc,p_oth,apa);
+      apnz = api[i+1] - api[i];
+      for (j=0; j<apnz; j++) {
+        col = apj[j+api[i]];
+        ap->a[j+ap->i[i]] = apa[col];
+        apa[col] = 0.0;
+      }
     }
   }
 
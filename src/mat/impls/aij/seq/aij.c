@@ -9,15 +9,23 @@
 #include <petscblaslapack.h>
 #include <petscbt.h>
 #include <petsc/private/kernels/blocktranspose.h>
+#if defined(PETSC_HAVE_OPENMP)
+#include <omp.h>
+#endif
 
 PetscErrorCode MatSeqAIJSetTypeFromOptions(Mat A)
 {
   PetscErrorCode       ierr;
   PetscBool            flg;
   char                 type[256];
+  PetscInt             nthreads = ((Mat_SeqAIJ*)A->data)->threads.nthreads;
 
   PetscFunctionBegin;
   ierr = PetscObjectOptionsBegin((PetscObject)A);
+  ierr = PetscOptionsInt("-mat_seqaij_num_threads","Number of OpenMP threads used by MatMult()","MatSeqAIJSetNumThreads",nthreads,&nthreads,&flg);CHKERRQ(ierr);
+  if (flg) {
+    ierr = MatSeqAIJSetNumThreads(A,nthreads);CHKERRQ(ierr);
+  }
   ierr = PetscOptionsFList("-mat_seqaij_type","Matrix SeqAIJ type","MatSeqAIJSetType",MatSeqAIJList,"seqaij",type,256,&flg);CHKERRQ(ierr);
   if (flg) {
     ierr = MatSeqAIJSetType(A,type);CHKERRQ(ierr);
@@ -1040,6 +1048,130 @@ PetscErrorCode MatView_SeqAIJ(Mat A,PetscViewer viewer)
   PetscFunctionReturn(0);
 }
 
+/*
+   Splits n units (rows, compressed rows or inodes) whose nonzeros are counted by the cumulative array ptr[] into nt
+   contiguous ranges, each with about the same number of nonzeros plus rows; rows[] is the cumulative number of rows
+   in the units, NULL when each unit is a single row
+*/
+void MatSeqAIJSplitByWeight_Private(PetscInt n,const PetscInt ptr[],const PetscInt rows[],PetscInt nt,PetscInt start[])
+{
+  PetscInt  t,lo,hi,mid;
+  PetscReal total = (PetscReal)(ptr[n] - ptr[0] + (rows ? rows[n] : n)),target;
+
+  start[0] = 0;
+  for (t=1; t<nt; t++) {
+    target = total*t/nt;
+    lo     = start[t-1];
+    hi     = n;
+    while (lo < hi) { /* first unit whose cumulative weight reaches the target */
+      mid = lo + (hi - lo)/2;
+      if ((PetscReal)(ptr[mid] - ptr[0] + (rows ? rows[mid] : mid)) < target) lo = mid + 1;
+      else hi = mid;
+    }
+    start[t] = lo;
+  }
+  start[nt] = n;
+}
+
+/*
+   Returns the split of the units of the given type among the threads used by MatMult_SeqAIJ() and friends. The split
+   is computed the first time it is needed and kept until the nonzero structure or the type of the units changes.
+*/
+PetscErrorCode MatSeqAIJGetThreadPartition_Private(Mat A,MatSeqAIJPartitionType type,const PetscInt **start,const PetscInt **rstart)
+{
+  Mat_SeqAIJ         *a  = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJ_Threads *th = &a->threads;
+  PetscErrorCode     ierr;
+  PetscInt           m = A->rmap->n,nt = th->nthreads,n,t,i,*nptr,*nrow;
+
+  PetscFunctionBegin;
+  switch (type) {
+  case MAT_SEQAIJ_PARTITION_ROWS:          n = m;                        break;
+  case MAT_SEQAIJ_PARTITION_COMPRESSEDROWS: n = a->compressedrow.nrows;  break;
+  case MAT_SEQAIJ_PARTITION_INODES:        n = a->inode.node_count;      break;
+  default: SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Unknown partition type");
+  }
+  if (!th->start || th->type != type || th->nunits != n || th->mat_nonzerostate != A->nonzerostate) {
+    if (!th->start) {
+      ierr = PetscMalloc2(nt+1,&th->start,nt+1,&th->rstart);CHKERRQ(ierr);
+      ierr = PetscLogObjectMemory((PetscObject)A,2*(nt+1)*sizeof(PetscInt));CHKERRQ(ierr);
+    }
+    switch (type) {
+    case MAT_SEQAIJ_PARTITION_ROWS:
+      MatSeqAIJSplitByWeight_Private(n,a->i,NULL,nt,th->start);
+      ierr = PetscArraycpy(th->rstart,th->start,nt+1);CHKERRQ(ierr);
+      break;
+    case MAT_SEQAIJ_PARTITION_COMPRESSEDROWS:
+      MatSeqAIJSplitByWeight_Private(n,a->compressedrow.i,NULL,nt,th->start);
+      /* thread t also owns the empty rows that precede its first nonempty row */
+      th->rstart[0] = 0;
+      for (t=1; t<nt; t++) th->rstart[t] = th->start[t] < n ? a->compressedrow.rindex[th->start[t]] : m;
+      th->rstart[nt] = m;
+      break;
+    case MAT_SEQAIJ_PARTITION_INODES:
+      ierr    = PetscMalloc2(n+1,&nptr,n+1,&nrow);CHKERRQ(ierr);
+      nrow[0] = 0;
+      for (i=0; i<n; i++) {
+        nptr[i]   = a->i[nrow[i]];
+        nrow[i+1] = nrow[i] + a->inode.size[i];
+      }
+      nptr[n] = a->i[m];
+      MatSeqAIJSplitByWeight_Private(n,nptr,nrow,nt,th->start);
+      for (t=0; t<=nt; t++) th->rstart[t] = nrow[th->start[t]];
+      ierr = PetscFree2(nptr,nrow);CHKERRQ(ierr);
+      break;
+    }
+    th->type             = type;
+    th->nunits           = n;
+    th->mat_nonzerostate = A->nonzerostate;
+    ierr = PetscInfo2(A,"Split %D units among %D threads\n",n,nt);CHKERRQ(ierr);
+  }
+  if (start)  *start  = th->start;
+  if (rstart) *rstart = th->rstart;
+  PetscFunctionReturn(0);
+}
+
+/*
+   Moves the a, j, and i arrays into new storage that is filled by the same threads that later multiply with each row,
+   so that with a first-touch page placement policy the matrix is spread over the NUMA domains of those threads
+*/
+static PetscErrorCode MatSeqAIJFirstTouch_Private(Mat A)
+{
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
+  PetscErrorCode ierr;
+  PetscInt       m = A->rmap->n,nt = a->threads.nthreads,t,*ni,*nj;
+  const PetscInt *rstart;
+  MatScalar      *na;
+
+  PetscFunctionBegin;
+  if (nt < 2 || !a->free_a || !a->free_ij || A->structure_only) PetscFunctionReturn(0);
+  ierr = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_ROWS,NULL,&rstart);CHKERRQ(ierr);
+  ierr = PetscMalloc1(a->maxnz,&na);CHKERRQ(ierr);
+  ierr = PetscMalloc1(a->maxnz,&nj);CHKERRQ(ierr);
+  ierr = PetscMalloc1(m+1,&ni);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static,1)
+#endif
+  for (t=0; t<nt; t++) {
+    PetscInt r,k;
+
+    for (r=rstart[t]; r<rstart[t+1]; r++) {
+      ni[r+1] = a->i[r+1];
+      for (k=a->i[r]; k<a->i[r+1]; k++) {
+        nj[k] = a->j[k];
+        na[k] = a->a[k];
+      }
+    }
+  }
+  ni[0] = 0;
+  ierr  = MatSeqXAIJFreeAIJ(A,&a->a,&a->j,&a->i);CHKERRQ(ierr);
+  a->a            = na;
+  a->j            = nj;
+  a->i            = ni;
+  a->singlemalloc = PETSC_FALSE;
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode MatAssemblyEnd_SeqAIJ(Mat A,MatAssemblyType mode)
 {
   Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
@@ -1099,6 +1231,7 @@ PetscErrorCode MatAssemblyEnd_SeqAIJ(Mat A,MatAssemblyType mode)
   A->info.nz_unneeded = (PetscReal)fshift;
   a->rmax             = rmax;
 
+  ierr = MatSeqAIJFirstTouch_Private(A);CHKERRQ(ierr);
   if (!A->structure_only) {
     ierr = MatCheckCompressedRow(A,a->nonzerorowcnt,&a->compressedrow,a->i,m,ratio);CHKERRQ(ierr);
   }
@@ -1176,6 +1309,9 @@ PetscErrorCode MatDestroy_SeqAIJ(Mat A)
   ierr = ISColoringDestroy(&a->coloring);CHKERRQ(ierr);
   ierr = PetscFree2(a->compressedrow.i,a->compressedrow.rindex);CHKERRQ(ierr);
   ierr = PetscFree(a->matmult_abdense);CHKERRQ(ierr);
+  ierr = PetscFree2(a->coo_jmap,a->coo_perm);CHKERRQ(ierr);
+  ierr = PetscFree2(a->threads.start,a->threads.rstart);CHKERRQ(ierr);
+  ierr = MatSeqAIJLevelsReset_Private(&a->levels);CHKERRQ(ierr);
 
   ierr = MatDestroy_SeqAIJ_Inode(A);CHKERRQ(ierr);
   ierr = PetscFree(A->data);CHKERRQ(ierr);
@@ -1187,6 +1323,9 @@ PetscErrorCode MatDestroy_SeqAIJ(Mat A)
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaij_seqsbaij_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaij_seqbaij_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaij_seqaijperm_C",NULL);CHKERRQ(ierr);
+#if !defined(PETSC_USE_COMPLEX)
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaij_seqaijmixed_C",NULL);CHKERRQ(ierr);
+#endif
 #if defined(PETSC_HAVE_ELEMENTAL)
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaij_elemental_C",NULL);CHKERRQ(ierr);
 #endif
@@ -1203,6 +1342,11 @@ PetscErrorCode MatDestroy_SeqAIJ(Mat A)
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJSetPreallocationCSR_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatReorderForNonzeroDiagonal_C",NULL);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)A,"MatPtAP_is_seqaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatPtAP_seqbaij_seqaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatMatMult_seqbaij_seqaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSetPreallocationCOO_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSetValuesCOO_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJSetNumThreads_C",NULL);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
@@ -1380,6 +1524,32 @@ PetscErrorCode MatMult_SeqAIJ(Mat A,Vec xx,Vec yy)
   ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
   ierr = VecGetArray(yy,&y);CHKERRQ(ierr);
   ii   = a->i;
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1) { /* each thread multiplies a range of rows holding about the same number of nonzeros */
+    const PetscInt *start,*rstart;
+    PetscInt       t,nt = a->threads.nthreads;
+
+    ierr = MatSeqAIJGetThreadPartition_Private(A,usecprow ? MAT_SEQAIJ_PARTITION_COMPRESSEDROWS : MAT_SEQAIJ_PARTITION_ROWS,&start,&rstart);CHKERRQ(ierr);
+    if (usecprow) {
+      ii   = a->compressedrow.i;
+      ridx = a->compressedrow.rindex;
+    }
+#pragma omp parallel for num_threads(nt) schedule(static,1) private(i,n,aj,aa,sum)
+    for (t=0; t<nt; t++) {
+      if (usecprow) {
+        for (i=rstart[t]; i<rstart[t+1]; i++) y[i] = 0.0;
+      }
+      for (i=start[t]; i<start[t+1]; i++) {
+        n   = ii[i+1] - ii[i];
+        aj  = a->j + ii[i];
+        aa  = a->a + ii[i];
+        sum = 0.0;
+        PetscSparseDensePlusDot(sum,x,aa,aj,n);
+        y[usecprow ? ridx[i] : i] = sum;
+      }
+    }
+  } else
+#endif
   if (usecprow) { /* use compressed row format */
     ierr = PetscArrayzero(y,m);CHKERRQ(ierr);
     m    = a->compressedrow.nrows;
@@ -1531,6 +1701,33 @@ PetscErrorCode MatMultAdd_SeqAIJ(Mat A,Vec xx,Vec yy,Vec zz)
   PetscFunctionBegin;
   ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
   ierr = VecGetArrayPair(yy,zz,&y,&z);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1) {
+    const PetscInt *start,*rstart;
+    PetscInt       t,nt = a->threads.nthreads;
+
+    ierr = MatSeqAIJGetThreadPartition_Private(A,usecprow ? MAT_SEQAIJ_PARTITION_COMPRESSEDROWS : MAT_SEQAIJ_PARTITION_ROWS,&start,&rstart);CHKERRQ(ierr);
+    ii   = usecprow ? a->compressedrow.i : a->i;
+    ridx = a->compressedrow.rindex;
+#pragma omp parallel for num_threads(nt) schedule(static,1) private(i,n,aj,aa,sum)
+    for (t=0; t<nt; t++) {
+      PetscInt row;
+
+      if (usecprow && zz != yy) {
+        for (i=rstart[t]; i<rstart[t+1]; i++) z[i] = y[i];
+      }
+      for (i=start[t]; i<start[t+1]; i++) {
+        row = usecprow ? ridx[i] : i;
+        n   = ii[i+1] - ii[i];
+        aj  = a->j + ii[i];
+        aa  = a->a + ii[i];
+        sum = y[row];
+        PetscSparseDensePlusDot(sum,x,aa,aj,n);
+        z[row] = sum;
+      }
+    }
+  } else
+#endif
   if (usecprow) { /* use compressed row format */
     if (zz != yy) {
       ierr = PetscArraycpy(z,y,m);CHKERRQ(ierr);
@@ -1989,6 +2186,73 @@ PetscErrorCode MatSOR_SeqAIJ(Mat A,Vec bb,PetscReal omega,MatSORType flag,PetscR
   PetscFunctionReturn(0);
 }
 
+/*
+   MatSORDense_SeqAIJ_Private - One forward, backward or symmetric sweep of MatSOR_SeqAIJ() with a zero initial guess
+   on each of the N columns of the dense arrays b and x, reading the matrix once for all the columns
+*/
+PetscErrorCode MatSORDense_SeqAIJ_Private(Mat A,PetscInt N,const PetscScalar *b,PetscInt ldb,PetscReal omega,MatSORType flag,PetscReal fshift,PetscScalar *x,PetscInt ldx)
+{
+  Mat_SeqAIJ      *a = (Mat_SeqAIJ*)A->data;
+  PetscScalar     *t,*sum;
+  const MatScalar *v,*idiag;
+  PetscErrorCode  ierr;
+  PetscInt        n,m = A->rmap->n,i,j,k;
+  const PetscInt  *idx,*diag;
+  PetscBool       forward,backward;
+
+  PetscFunctionBegin;
+  if (flag == SOR_APPLY_UPPER || flag == SOR_APPLY_LOWER || flag & SOR_EISENSTAT) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_SUP,"Only forward, backward and symmetric sweeps");
+  forward  = (flag & SOR_FORWARD_SWEEP || flag & SOR_LOCAL_FORWARD_SWEEP) ? PETSC_TRUE : PETSC_FALSE;
+  backward = (flag & SOR_BACKWARD_SWEEP || flag & SOR_LOCAL_BACKWARD_SWEEP) ? PETSC_TRUE : PETSC_FALSE;
+
+  if (fshift != a->fshift || omega != a->omega) a->idiagvalid = PETSC_FALSE; /* must recompute idiag[] */
+  if (!a->idiagvalid) {ierr = MatInvertDiagonal_SeqAIJ(A,omega,fshift);CHKERRQ(ierr);}
+  a->fshift = fshift;
+  a->omega  = omega;
+
+  diag  = a->diag;
+  idiag = a->idiag;
+  /* row i of t holds the application of the lower-triangular part to the N columns, as a->ssor_work for one vector */
+  ierr = PetscMalloc1((forward ? m : 1)*N,&t);CHKERRQ(ierr);
+  if (forward) {
+    for (i=0; i<m; i++) {
+      n   = diag[i] - a->i[i];
+      idx = a->j + a->i[i];
+      v   = a->a + a->i[i];
+      sum = t + i*N;
+      for (k=0; k<N; k++) sum[k] = b[i+k*ldb];
+      for (j=0; j<n; j++) {
+        for (k=0; k<N; k++) sum[k] -= v[j]*x[idx[j]+k*ldx];
+      }
+      for (k=0; k<N; k++) x[i+k*ldx] = sum[k]*idiag[i];
+    }
+    ierr = PetscLogFlops(N*a->nz);CHKERRQ(ierr);
+  }
+  if (backward) {
+    for (i=m-1; i>=0; i--) {
+      n   = a->i[i+1] - diag[i] - 1;
+      idx = a->j + diag[i] + 1;
+      v   = a->a + diag[i] + 1;
+      if (forward) sum = t + i*N;
+      else {
+        sum = t;
+        for (k=0; k<N; k++) sum[k] = b[i+k*ldb];
+      }
+      for (j=0; j<n; j++) {
+        for (k=0; k<N; k++) sum[k] -= v[j]*x[idx[j]+k*ldx];
+      }
+      if (forward) {
+        for (k=0; k<N; k++) x[i+k*ldx] = (1-omega)*x[i+k*ldx] + sum[k]*idiag[i];  /* omega in idiag */
+      } else {
+        for (k=0; k<N; k++) x[i+k*ldx] = sum[k]*idiag[i];
+      }
+    }
+    ierr = PetscLogFlops(N*a->nz);CHKERRQ(ierr);
+  }
+  ierr = PetscFree(t);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 
 PetscErrorCode MatGetInfo_SeqAIJ(Mat A,MatInfoType flag,MatInfo *info)
 {
@@ -4075,6 +4339,209 @@ PetscErrorCode  MatSeqAIJSetPreallocationCSR_SeqAIJ(Mat B,const PetscInt Ii[],co
   PetscFunctionReturn(0);
 }
 
+/*
+   Creates the vectors with arrays zeroed by the threads of MatMult_SeqAIJ() so that their pages are placed, with a first-touch
+   policy, in about the same NUMA domains as the rows of the matrix
+*/
+static PetscErrorCode MatSeqAIJFirstTouchVec_Private(Mat A,Vec v)
+{
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
+  PetscErrorCode ierr;
+  PetscInt       i,n,nt = a->threads.nthreads;
+  PetscScalar    *array;
+  PetscBool      isseq;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)v,VECSEQ,&isseq);CHKERRQ(ierr);
+  if (!isseq) PetscFunctionReturn(0);
+  ierr = VecGetLocalSize(v,&n);CHKERRQ(ierr);
+  ierr = PetscMalloc1(n,&array);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+  for (i=0; i<n; i++) array[i] = 0.0;
+  ierr = VecReplaceArray(v,array);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatCreateVecs_SeqAIJ(Mat A,Vec *right,Vec *left)
+{
+  PetscErrorCode ierr;
+  PetscInt       rbs,cbs;
+
+  PetscFunctionBegin;
+  ierr = MatGetBlockSizes(A,&rbs,&cbs);CHKERRQ(ierr);
+  if (right) {
+    ierr = VecCreate(PETSC_COMM_SELF,right);CHKERRQ(ierr);
+    ierr = VecSetSizes(*right,A->cmap->n,PETSC_DETERMINE);CHKERRQ(ierr);
+    ierr = VecSetBlockSize(*right,cbs);CHKERRQ(ierr);
+    ierr = VecSetType(*right,A->defaultvectype);CHKERRQ(ierr);
+    ierr = MatSeqAIJFirstTouchVec_Private(A,*right);CHKERRQ(ierr);
+  }
+  if (left) {
+    ierr = VecCreate(PETSC_COMM_SELF,left);CHKERRQ(ierr);
+    ierr = VecSetSizes(*left,A->rmap->n,PETSC_DETERMINE);CHKERRQ(ierr);
+    ierr = VecSetBlockSize(*left,rbs);CHKERRQ(ierr);
+    ierr = VecSetType(*left,A->defaultvectype);CHKERRQ(ierr);
+    ierr = MatSeqAIJFirstTouchVec_Private(A,*left);CHKERRQ(ierr);
+  }
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatSeqAIJSetNumThreads_SeqAIJ(Mat A,PetscInt nthreads)
+{
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+#if defined(PETSC_HAVE_OPENMP)
+  if (nthreads == PETSC_DECIDE || nthreads == PETSC_DEFAULT) nthreads = (PetscInt)omp_get_max_threads();
+#else
+  nthreads = 1;
+#endif
+  if (nthreads < 1) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of threads %D must be positive",nthreads);
+  if (nthreads == a->threads.nthreads) PetscFunctionReturn(0);
+  ierr = PetscFree2(a->threads.start,a->threads.rstart);CHKERRQ(ierr);
+  a->threads.nthreads = nthreads;
+  A->ops->getvecs     = nthreads > 1 ? MatCreateVecs_SeqAIJ : NULL;
+  ierr = PetscInfo1(A,"Using %D threads in MatMult()\n",nthreads);CHKERRQ(ierr);
+  if (A->assembled) {ierr = MatSeqAIJFirstTouch_Private(A);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+/*@
+   MatSeqAIJSetNumThreads - Sets the number of OpenMP threads used by MatMult() and MatMultAdd() with a MATSEQAIJ matrix
+
+   Logically Collective on Mat
+
+   Input Parameters:
++  A - the matrix
+-  nthreads - the number of threads, PETSC_DECIDE for the OpenMP default, or 1 for the serial kernels
+
+   Options Database Keys:
+.  -mat_seqaij_num_threads <n> - the number of threads
+
+   Notes:
+   The rows (compressed rows, or inodes, depending on the kernel used) are split into contiguous ranges holding about the same
+   number of nonzeros plus rows, one per thread. The split is computed at the first product and reused until the nonzero
+   structure of the matrix changes.
+
+   With more than one thread the matrix arrays are copied, each time the nonzero structure is assembled, by the threads that
+   multiply with them, and MatCreateVecs() zeroes the new vectors with the same threads; with a first-touch page placement
+   policy this puts the data in the NUMA domains where it is used. Matrices created with user provided arrays are not copied.
+
+   This has no effect unless PETSc was configured with OpenMP. With MPI, use one rank per socket or NUMA domain and call
+   this on the diagonal and off-diagonal blocks obtained with MatMPIAIJGetSeqAIJ(), or use the options database key.
+
+   Level: intermediate
+
+.seealso: MatMult(), MatCreateVecs(), MatCreateSeqAIJ(), MatMPIAIJGetSeqAIJ()
+@*/
+PetscErrorCode MatSeqAIJSetNumThreads(Mat A,PetscInt nthreads)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidLogicalCollectiveInt(A,nthreads,2);
+  ierr = PetscTryMethod(A,"MatSeqAIJSetNumThreads_C",(Mat,PetscInt),(A,nthreads));CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Bucket the coordinates by row, sort each row by column carrying the original position along, and collapse
+   duplicates. The CSR structure is then handed to MatSeqAIJSetPreallocationCSR(), while coo_jmap[] and coo_perm[]
+   record which input entries are summed into each nonzero so MatSetValuesCOO_SeqAIJ() never searches.
+*/
+PetscErrorCode MatSetPreallocationCOO_SeqAIJ(Mat A,PetscInt ncoo,const PetscInt coo_i[],const PetscInt coo_j[])
+{
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
+  PetscErrorCode ierr;
+  PetscInt       m = A->rmap->n,n = A->cmap->n,i,k,p,q,start,end,ntot;
+  PetscInt       *ai,*next,*cols,*jmap,*perm;
+
+  PetscFunctionBegin;
+  ierr = PetscCalloc1(m+1,&ai);CHKERRQ(ierr);
+  for (k=0; k<ncoo; k++) {
+    if (coo_i[k] < 0 || coo_j[k] < 0) continue;
+    if (coo_i[k] >= m) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"COO row index %D out of range [0,%D)",coo_i[k],m);
+    if (coo_j[k] >= n) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"COO column index %D out of range [0,%D)",coo_j[k],n);
+    ai[coo_i[k]+1]++;
+  }
+  for (i=0; i<m; i++) ai[i+1] += ai[i];
+  ntot = ai[m];
+
+  ierr = PetscMalloc2(ntot,&cols,m,&next);CHKERRQ(ierr);
+  ierr = PetscMalloc2(ntot+1,&jmap,ntot,&perm);CHKERRQ(ierr);
+  ierr = PetscArraycpy(next,ai,m);CHKERRQ(ierr);
+  for (k=0; k<ncoo; k++) {
+    if (coo_i[k] < 0 || coo_j[k] < 0) continue;
+    p       = next[coo_i[k]]++;
+    cols[p] = coo_j[k];
+    perm[p] = k;
+  }
+
+  /* sort each row and squeeze out repeated columns; ai[] and cols[] are overwritten with the compressed CSR */
+  q = 0; start = 0;
+  for (i=0; i<m; i++) {
+    end   = ai[i+1];
+    ierr  = PetscSortIntWithArray(end-start,cols+start,perm+start);CHKERRQ(ierr);
+    ai[i] = q;
+    for (p=start; p<end; p++) {
+      if (q == ai[i] || cols[p] != cols[q-1]) {
+        jmap[q]   = p;
+        cols[q++] = cols[p];
+      }
+    }
+    start = end;
+  }
+  ai[m]   = q;
+  jmap[q] = ntot;
+
+  ierr = MatSeqAIJSetPreallocationCSR(A,ai,cols,NULL);CHKERRQ(ierr);
+  ierr = PetscFree2(cols,next);CHKERRQ(ierr);
+  ierr = PetscFree(ai);CHKERRQ(ierr);
+
+  ierr = PetscFree2(a->coo_jmap,a->coo_perm);CHKERRQ(ierr);
+  a->coo_n    = ncoo;
+  a->coo_jmap = jmap;
+  a->coo_perm = perm;
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatSetValuesCOO_SeqAIJ(Mat A,const PetscScalar coo_v[],InsertMode imode)
+{
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
+  PetscErrorCode ierr;
+  PetscInt       k,p,nz = a->nz;
+  const PetscInt *jmap = a->coo_jmap,*perm = a->coo_perm;
+  MatScalar      *aa = a->a;
+  PetscScalar    sum;
+
+  PetscFunctionBegin;
+  if (!jmap) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"Must call MatSetPreallocationCOO() first");
+  if (!coo_v) {
+    if (imode == INSERT_VALUES) {ierr = PetscArrayzero(aa,nz);CHKERRQ(ierr);}
+  } else if (imode == INSERT_VALUES) {
+    for (k=0; k<nz; k++) {
+      sum = 0.0;
+      for (p=jmap[k]; p<jmap[k+1]; p++) sum += coo_v[perm[p]];
+      aa[k] = sum;
+    }
+  } else {
+    for (k=0; k<nz; k++) {
+      sum = 0.0;
+      for (p=jmap[k]; p<jmap[k+1]; p++) sum += coo_v[perm[p]];
+      aa[k] += sum;
+    }
+  }
+  ierr = PetscLogFlops(jmap[nz]);CHKERRQ(ierr);
+  /* the nonzero state is unchanged so this only invalidates cached diagonals and lets subclasses refresh their copies */
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 #include <../src/mat/impls/dense/seq/dense.h>
 #include <petsc/private/kernels/petscaxpy.h>
 
@@ -4234,6 +4701,8 @@ PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqDense(Mat,MatType,MatReuse,Mat*
 PETSC_EXTERN PetscErrorCode MatConvert_SeqAIJ_SeqSELL(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_XAIJ_IS(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatPtAP_IS_XAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
+PETSC_INTERN PetscErrorCode MatPtAP_XBAIJ_XAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
+PETSC_INTERN PetscErrorCode MatMatMult_XBAIJ_XAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
 
 /*@C
    MatSeqAIJGetArray - gives read/write access to the array where the data for a MATSEQAIJ matrix is stored
@@ -4411,6 +4880,7 @@ PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJ(Mat B)
   b->idiagvalid         = PETSC_FALSE;
   b->ibdiagvalid        = PETSC_FALSE;
   b->keepnonzeropattern = PETSC_FALSE;
+  b->threads.nthreads   = 1;
 
   ierr = PetscObjectChangeTypeName((PetscObject)B,MATSEQAIJ);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatSeqAIJGetArray_C",MatSeqAIJGetArray_SeqAIJ);CHKERRQ(ierr);
@@ -4427,6 +4897,9 @@ PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJ(Mat B)
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_seqaij_seqsbaij_C",MatConvert_SeqAIJ_SeqSBAIJ);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_seqaij_seqbaij_C",MatConvert_SeqAIJ_SeqBAIJ);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_seqaij_seqaijperm_C",MatConvert_SeqAIJ_SeqAIJPERM);CHKERRQ(ierr);
+#if !defined(PETSC_USE_COMPLEX)
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_seqaij_seqaijmixed_C",MatConvert_SeqAIJ_SeqAIJMixed);CHKERRQ(ierr);
+#endif
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_seqaij_seqaijsell_C",MatConvert_SeqAIJ_SeqAIJSELL);CHKERRQ(ierr);
 #if defined(PETSC_HAVE_MKL_SPARSE)
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatConvert_seqaij_seqaijmkl_C",MatConvert_SeqAIJ_SeqAIJMKL);CHKERRQ(ierr);
@@ -4455,6 +4928,11 @@ PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJ(Mat B)
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatMatMultSymbolic_seqdense_seqaij_C",MatMatMultSymbolic_SeqDense_SeqAIJ);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatMatMultNumeric_seqdense_seqaij_C",MatMatMultNumeric_SeqDense_SeqAIJ);CHKERRQ(ierr);
   ierr = PetscObjectComposeFunction((PetscObject)B,"MatPtAP_is_seqaij_C",MatPtAP_IS_XAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatPtAP_seqbaij_seqaij_C",MatPtAP_XBAIJ_XAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatMatMult_seqbaij_seqaij_C",MatMatMult_XBAIJ_XAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSetPreallocationCOO_C",MatSetPreallocationCOO_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSetValuesCOO_C",MatSetValuesCOO_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatSeqAIJSetNumThreads_C",MatSeqAIJSetNumThreads_SeqAIJ);CHKERRQ(ierr);
   ierr = MatCreate_SeqAIJ_Inode(B);CHKERRQ(ierr);
   ierr = PetscObjectChangeTypeName((PetscObject)B,MATSEQAIJ);CHKERRQ(ierr);
   ierr = MatSeqAIJSetTypeFromOptions(B);CHKERRQ(ierr);  /* this allows changing the matrix subtype to say MATSEQAIJPERM */
@@ -4545,6 +5023,11 @@ PetscErrorCode MatDuplicateNoCreate_SeqAIJ(Mat C,Mat A,MatDuplicateOption cpvalu
   c->nonzerorowcnt = a->nonzerorowcnt;
   C->nonzerostate  = A->nonzerostate;
 
+  if (a->threads.nthreads > 1) {
+    c->threads.nthreads = a->threads.nthreads;
+    C->ops->getvecs     = MatCreateVecs_SeqAIJ;
+    if (mallocmatspace) {ierr = MatSeqAIJFirstTouch_Private(C);CHKERRQ(ierr);}
+  }
   ierr = MatDuplicate_SeqAIJ_Inode(A,cpvalues,&C);CHKERRQ(ierr);
   ierr = PetscFunctionListDuplicate(((PetscObject)A)->qlist,&((PetscObject)C)->qlist);CHKERRQ(ierr);
   PetscFunctionReturn(0);
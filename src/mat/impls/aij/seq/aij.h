@@ -97,6 +97,28 @@ typedef struct {
   PetscObjectState mat_nonzerostate;               /* non-zero state when inodes were checked for */
 } Mat_SeqAIJ_Inode;
 
+/* Info about the OpenMP threaded MatMult() and MatMultAdd() kernels for SeqAIJ */
+typedef enum {MAT_SEQAIJ_PARTITION_ROWS,MAT_SEQAIJ_PARTITION_COMPRESSEDROWS,MAT_SEQAIJ_PARTITION_INODES} MatSeqAIJPartitionType;
+
+typedef struct {
+  PetscInt               nthreads;                 /* number of threads used by MatMult() and MatMultAdd(), 1 means the serial kernels */
+  MatSeqAIJPartitionType type;                     /* units (rows, compressed rows or inodes) the partition below splits */
+  PetscInt               nunits;                   /* number of units when the partition was computed */
+  PetscObjectState       mat_nonzerostate;         /* non-zero state when the partition was computed */
+  PetscInt               *start;                   /* units start[t] to start[t+1]-1 are handled by thread t */
+  PetscInt               *rstart;                  /* rows rstart[t] to rstart[t+1]-1 of the result are written by thread t */
+} Mat_SeqAIJ_Threads;
+
+/* Level sets (wavefronts) of the triangular factors, used by the threaded MatSolve() of ILU and ICC factors */
+typedef struct {
+  PetscInt         nthreads;                       /* number of threads used in MatSolve(), the level sets are only built when this is above 1 */
+  PetscInt         nlevels[2];                     /* number of levels of the forward (0) and backward (1) sweeps */
+  PetscInt         *lstart[2];                     /* rows rows[s][lstart[s][k]] to rows[s][lstart[s][k+1]-1] of sweep s only depend on earlier levels */
+  PetscInt         *rows[2];
+  PetscInt         *ti,*tr,*tp;                    /* ICC only: column k of U holds aa[tp[p]] in row tr[p] for p in [ti[k],ti[k+1]) */
+  PetscScalar      *work;                          /* ICC only: the forward sweep before the diagonal scaling */
+} Mat_SeqAIJ_Levels;
+
 PETSC_INTERN PetscErrorCode MatView_SeqAIJ_Inode(Mat,PetscViewer);
 PETSC_INTERN PetscErrorCode MatAssemblyEnd_SeqAIJ_Inode(Mat,MatAssemblyType);
 PETSC_INTERN PetscErrorCode MatDestroy_SeqAIJ_Inode(Mat);
@@ -108,10 +130,18 @@ PETSC_INTERN PetscErrorCode MatLUFactorNumeric_SeqAIJ_Inode_inplace(Mat,Mat,cons
 PETSC_INTERN PetscErrorCode MatLUFactorNumeric_SeqAIJ_Inode(Mat,Mat,const MatFactorInfo*);
 PETSC_INTERN PetscErrorCode MatSeqAIJGetArray_SeqAIJ(Mat,PetscScalar**);
 PETSC_INTERN PetscErrorCode MatSeqAIJRestoreArray_SeqAIJ(Mat,PetscScalar**);
+PETSC_INTERN PetscErrorCode MatSetPreallocationCOO_SeqAIJ(Mat,PetscInt,const PetscInt[],const PetscInt[]);
+PETSC_INTERN PetscErrorCode MatSetValuesCOO_SeqAIJ(Mat,const PetscScalar[],InsertMode);
+PETSC_INTERN PetscErrorCode MatSeqAIJGetThreadPartition_Private(Mat,MatSeqAIJPartitionType,const PetscInt**,const PetscInt**);
+PETSC_INTERN void MatSeqAIJSplitByWeight_Private(PetscInt,const PetscInt[],const PetscInt[],PetscInt,PetscInt[]);
+PETSC_INTERN PetscErrorCode MatSeqAIJLevelsReset_Private(Mat_SeqAIJ_Levels*);
+PETSC_INTERN PetscErrorCode MatSeqAIJSetUpLevels_LU(Mat,Mat);
 
 typedef struct {
   SEQAIJHEADER(MatScalar);
   Mat_SeqAIJ_Inode inode;
+  Mat_SeqAIJ_Threads threads;
+  Mat_SeqAIJ_Levels  levels;                  /* level sets of a factor, for the threaded MatSolve() */
   MatScalar        *saved_values;             /* location for stashing nonzero values of matrix */
 
   PetscScalar *idiag,*mdiag,*ssor_work;       /* inverse of diagonal entries, diagonal values and workspace for Eisenstat trick */
@@ -129,6 +159,9 @@ typedef struct {
   Mat_RARt            *rart;               /* used by MatRARt() */
   Mat_MatMatTransMult *abt;                /* used by MatMatTransposeMult() */
   Mat_MatTransMatMult *atb;                /* used by MatTransposeMatMult() */
+
+  PetscInt    coo_n;                          /* length of the values array expected by MatSetValuesCOO() */
+  PetscInt    *coo_jmap,*coo_perm;            /* nonzero k is the sum of coo_v[coo_perm[coo_jmap[k]:coo_jmap[k+1]]] */
 } Mat_SeqAIJ;
 
 /*
@@ -230,6 +263,7 @@ PETSC_INTERN PetscErrorCode MatDuplicate_SeqAIJ(Mat,MatDuplicateOption,Mat*);
 PETSC_INTERN PetscErrorCode MatCopy_SeqAIJ(Mat,Mat,MatStructure);
 PETSC_INTERN PetscErrorCode MatMissingDiagonal_SeqAIJ(Mat,PetscBool*,PetscInt*);
 PETSC_INTERN PetscErrorCode MatMarkDiagonal_SeqAIJ(Mat);
+PETSC_INTERN PetscErrorCode MatInvertDiagonal_SeqAIJ(Mat,PetscScalar,PetscScalar);
 PETSC_INTERN PetscErrorCode MatFindZeroDiagonals_SeqAIJ_Private(Mat,PetscInt*,PetscInt**);
 
 PETSC_INTERN PetscErrorCode MatMult_SeqAIJ(Mat A,Vec,Vec);
@@ -237,6 +271,8 @@ PETSC_INTERN PetscErrorCode MatMultAdd_SeqAIJ(Mat A,Vec,Vec,Vec);
 PETSC_INTERN PetscErrorCode MatMultTranspose_SeqAIJ(Mat A,Vec,Vec);
 PETSC_INTERN PetscErrorCode MatMultTransposeAdd_SeqAIJ(Mat A,Vec,Vec,Vec);
 PETSC_INTERN PetscErrorCode MatSOR_SeqAIJ(Mat,Vec,PetscReal,MatSORType,PetscReal,PetscInt,PetscInt,Vec);
+PETSC_INTERN PetscErrorCode MatSORDense_SeqAIJ_Private(Mat,PetscInt,const PetscScalar*,PetscInt,PetscReal,MatSORType,PetscReal,PetscScalar*,PetscInt);
+PETSC_INTERN PetscErrorCode MatGetDiagonal_SeqAIJ(Mat,Vec);
 
 PETSC_INTERN PetscErrorCode MatSetOption_SeqAIJ(Mat,MatOption,PetscBool);
 
@@ -248,6 +284,7 @@ PETSC_INTERN PetscErrorCode MatTranspose_SeqAIJ(Mat,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatToSymmetricIJ_SeqAIJ(PetscInt,PetscInt*,PetscInt*,PetscBool,PetscInt,PetscInt,PetscInt**,PetscInt**);
 PETSC_INTERN PetscErrorCode MatLUFactorSymbolic_SeqAIJ_inplace(Mat,Mat,IS,IS,const MatFactorInfo*);
 PETSC_INTERN PetscErrorCode MatLUFactorSymbolic_SeqAIJ(Mat,Mat,IS,IS,const MatFactorInfo*);
+PETSC_INTERN PetscErrorCode MatGetFactor_seqaij_petsc(Mat,MatFactorType,Mat*);
 PETSC_INTERN PetscErrorCode MatLUFactorNumeric_SeqAIJ_inplace(Mat,Mat,const MatFactorInfo*);
 PETSC_INTERN PetscErrorCode MatLUFactorNumeric_SeqAIJ(Mat,Mat,const MatFactorInfo*);
 PETSC_INTERN PetscErrorCode MatLUFactorNumeric_SeqAIJ_InplaceWithPerm(Mat,Mat,const MatFactorInfo*);
@@ -286,6 +323,7 @@ PETSC_INTERN PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_Heap(Mat,Mat,PetscR
 PETSC_INTERN PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_BTHeap(Mat,Mat,PetscReal,Mat*);
 PETSC_INTERN PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_RowMerge(Mat,Mat,PetscReal,Mat*);
 PETSC_INTERN PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_LLCondensed(Mat,Mat,PetscReal,Mat*);
+PETSC_INTERN PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_Threaded(Mat,Mat,PetscReal,Mat*);
 #if defined(PETSC_HAVE_HYPRE)
 PETSC_INTERN PetscErrorCode MatMatMultSymbolic_AIJ_AIJ_wHYPRE(Mat,Mat,PetscReal,Mat*);
 #endif
@@ -294,6 +332,7 @@ PETSC_INTERN PetscErrorCode MatMatMultNumeric_SeqAIJ_SeqAIJ(Mat,Mat,Mat);
 PETSC_INTERN PetscErrorCode MatMatMultNumeric_SeqAIJ_SeqAIJ_Sorted(Mat,Mat,Mat);
 PETSC_INTERN PetscErrorCode MatMatMultNumeric_SeqDense_SeqAIJ(Mat,Mat,Mat);
 PETSC_INTERN PetscErrorCode MatMatMultNumeric_SeqAIJ_SeqAIJ_Scalable(Mat,Mat,Mat);
+PETSC_INTERN PetscErrorCode MatMatMultNumeric_SeqAIJ_SeqAIJ_Threaded(Mat,Mat,Mat);
 PETSC_INTERN PetscErrorCode MatMatMultNumeric_SeqAIJ_SeqAIJ_Combined(Mat,Mat,Mat);
 
 PETSC_INTERN PetscErrorCode MatPtAP_SeqAIJ_SeqAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
@@ -366,9 +405,18 @@ PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_Elemental(Mat,MatType,MatReuse,Mat
 PETSC_INTERN PetscErrorCode MatConvert_AIJ_HYPRE(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqAIJPERM(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqAIJSELL(Mat,MatType,MatReuse,Mat*);
+PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqAIJMixed(Mat,MatType,MatReuse,Mat*);
+PETSC_INTERN PetscErrorCode MatConvert_SeqAIJMixed_SeqAIJ(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqAIJMKL(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqAIJViennaCL(Mat,MatType,MatReuse,Mat*);
 PETSC_INTERN PetscErrorCode MatReorderForNonzeroDiagonal_SeqAIJ(Mat,PetscReal,IS,IS);
+PETSC_INTERN PetscErrorCode MatIsTranspose_SeqAIJ(Mat,Mat,PetscReal,PetscBool*);
+PETSC_INTERN PetscErrorCode MatSeqAIJSetColumnIndices_SeqAIJ(Mat,PetscInt*);
+PETSC_INTERN PetscErrorCode MatStoreValues_SeqAIJ(Mat);
+PETSC_INTERN PetscErrorCode MatRetrieveValues_SeqAIJ(Mat);
+PETSC_INTERN PetscErrorCode MatResetPreallocation_SeqAIJ(Mat);
+PETSC_INTERN PetscErrorCode MatSeqAIJSetPreallocationCSR_SeqAIJ(Mat,const PetscInt[],const PetscInt[],const PetscScalar[]);
+PETSC_INTERN PetscErrorCode MatSeqAIJSetNumThreads_SeqAIJ(Mat,PetscInt);
 PETSC_INTERN PetscErrorCode MatMatMult_SeqDense_SeqAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
 PETSC_INTERN PetscErrorCode MatRARt_SeqAIJ_SeqAIJ(Mat,Mat,MatReuse,PetscReal,Mat*);
 PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJ(Mat);
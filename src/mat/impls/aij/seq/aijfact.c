@@ -121,6 +121,272 @@ PETSC_INTERN PetscErrorCode MatGetFactor_seqaij_petsc(Mat A,MatFactorType ftype,
   PetscFunctionReturn(0);
 }
 
+PetscErrorCode MatSeqAIJLevelsReset_Private(Mat_SeqAIJ_Levels *lv)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscFree2(lv->lstart[0],lv->rows[0]);CHKERRQ(ierr);
+  ierr = PetscFree2(lv->lstart[1],lv->rows[1]);CHKERRQ(ierr);
+  ierr = PetscFree3(lv->ti,lv->tr,lv->tp);CHKERRQ(ierr);
+  ierr = PetscFree(lv->work);CHKERRQ(ierr);
+  lv->nlevels[0] = lv->nlevels[1] = 0;
+  PetscFunctionReturn(0);
+}
+
+/* Sorts the rows by level, keeping the rows of each level in increasing order */
+static PetscErrorCode MatSeqAIJLevelsBucket_Private(PetscInt n,const PetscInt level[],PetscInt *nlevels,PetscInt **lstart,PetscInt **rows)
+{
+  PetscErrorCode ierr;
+  PetscInt       i,nl = 0,*ls,*r;
+
+  PetscFunctionBegin;
+  for (i=0; i<n; i++) nl = PetscMax(nl,level[i]+1);
+  ierr = PetscMalloc2(nl+1,&ls,n,&r);CHKERRQ(ierr);
+  ierr = PetscArrayzero(ls,nl+1);CHKERRQ(ierr);
+  for (i=0; i<n; i++) ls[level[i]+1]++;
+  for (i=0; i<nl; i++) ls[i+1] += ls[i];
+  for (i=0; i<n; i++) r[ls[level[i]]++] = i;
+  for (i=nl; i>0; i--) ls[i] = ls[i-1];
+  ls[0]    = 0;
+  *nlevels = nl;
+  *lstart  = ls;
+  *rows    = r;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatSeqAIJLevelsLog_Private(Mat fact,Mat_SeqAIJ_Levels *lv)
+{
+  PetscErrorCode ierr;
+  PetscInt       n = fact->rmap->n,nl = lv->nlevels[0] + lv->nlevels[1];
+
+  PetscFunctionBegin;
+  ierr = PetscLogEventSetDof(MAT_LevelSets,0,(PetscLogDouble)nl);CHKERRQ(ierr);
+  ierr = PetscLogEventSetDof(MAT_LevelSets,1,nl ? 2.0*n/nl : 0.0);CHKERRQ(ierr);
+  ierr = PetscInfo5(fact,"Triangular solves with %D threads: %D forward and %D backward levels, on average %g and %g rows per level\n",lv->nthreads,lv->nlevels[0],lv->nlevels[1],lv->nlevels[0] ? (double)n/lv->nlevels[0] : 0.0,lv->nlevels[1] ? (double)n/lv->nlevels[1] : 0.0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Level-scheduled solve with an LU or ILU factor: the rows of a level only depend on rows of earlier levels of the
+   same sweep so they are computed concurrently, with a barrier between levels
+*/
+static PetscErrorCode MatSolve_SeqAIJ_Levels(Mat A,Vec bb,Vec xx)
+{
+  Mat_SeqAIJ        *a  = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJ_Levels *lv = &a->levels;
+  PetscErrorCode    ierr;
+  const PetscInt    n = A->rmap->n,*ai = a->i,*aj = a->j,*adiag = a->diag;
+  const PetscInt    *r,*c;
+  const MatScalar   *aa = a->a;
+  const PetscScalar *b;
+  PetscScalar       *x,*tmp = a->solve_work;
+
+  PetscFunctionBegin;
+  if (!n) PetscFunctionReturn(0);
+  ierr = PetscLogEventBegin(MAT_SolveLevels,A,0,0,0);CHKERRQ(ierr);
+  ierr = VecGetArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecGetArrayWrite(xx,&x);CHKERRQ(ierr);
+  ierr = ISGetIndices(a->row,&r);CHKERRQ(ierr);
+  ierr = ISGetIndices(a->col,&c);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel num_threads(lv->nthreads)
+#endif
+  {
+    const PetscInt  *vi;
+    const MatScalar *v;
+    PetscScalar     sum;
+    PetscInt        l,k,i,nz;
+
+    /* forward solve the lower triangular */
+    for (l=0; l<lv->nlevels[0]; l++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+      for (k=lv->lstart[0][l]; k<lv->lstart[0][l+1]; k++) {
+        i   = lv->rows[0][k];
+        nz  = ai[i+1] - ai[i];
+        v   = aa + ai[i];
+        vi  = aj + ai[i];
+        sum = b[r[i]];
+        PetscSparseDenseMinusDot(sum,tmp,v,vi,nz);
+        tmp[i] = sum;
+      }
+    }
+    /* backward solve the upper triangular */
+    for (l=0; l<lv->nlevels[1]; l++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+      for (k=lv->lstart[1][l]; k<lv->lstart[1][l+1]; k++) {
+        i   = lv->rows[1][k];
+        v   = aa + adiag[i+1] + 1;
+        vi  = aj + adiag[i+1] + 1;
+        nz  = adiag[i] - adiag[i+1] - 1;
+        sum = tmp[i];
+        PetscSparseDenseMinusDot(sum,tmp,v,vi,nz);
+        x[c[i]] = tmp[i] = sum*v[nz]; /* v[nz] = aa[adiag[i]] */
+      }
+    }
+  }
+  ierr = ISRestoreIndices(a->row,&r);CHKERRQ(ierr);
+  ierr = ISRestoreIndices(a->col,&c);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecRestoreArrayWrite(xx,&x);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2*a->nz - A->cmap->n);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_SolveLevels,A,0,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Called at the end of the numeric LU and ILU factorizations: when A uses threads (see MatSeqAIJSetNumThreads()) computes
+   the level sets of both triangular factors and switches the factor to the level-scheduled solve
+*/
+PetscErrorCode MatSeqAIJSetUpLevels_LU(Mat fact,Mat A)
+{
+  Mat_SeqAIJ        *a  = (Mat_SeqAIJ*)A->data,*b = (Mat_SeqAIJ*)fact->data;
+  Mat_SeqAIJ_Levels *lv = &b->levels;
+  PetscErrorCode    ierr;
+  PetscInt          n = fact->rmap->n,*bi = b->i,*bj = b->j,*bdiag = b->diag,*level,i,k,lev;
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJLevelsReset_Private(lv);CHKERRQ(ierr);
+  lv->nthreads = a->threads.nthreads;
+  if (lv->nthreads < 2) PetscFunctionReturn(0);
+  ierr = PetscLogEventBegin(MAT_LevelSets,fact,A,0,0);CHKERRQ(ierr);
+  ierr = PetscMalloc1(n,&level);CHKERRQ(ierr);
+  for (i=0; i<n; i++) {
+    for (lev=0,k=bi[i]; k<bi[i+1]; k++) lev = PetscMax(lev,level[bj[k]]+1);
+    level[i] = lev;
+  }
+  ierr = MatSeqAIJLevelsBucket_Private(n,level,&lv->nlevels[0],&lv->lstart[0],&lv->rows[0]);CHKERRQ(ierr);
+  for (i=n-1; i>=0; i--) {
+    for (lev=0,k=bdiag[i+1]+1; k<bdiag[i]; k++) lev = PetscMax(lev,level[bj[k]]+1);
+    level[i] = lev;
+  }
+  ierr = MatSeqAIJLevelsBucket_Private(n,level,&lv->nlevels[1],&lv->lstart[1],&lv->rows[1]);CHKERRQ(ierr);
+  ierr = PetscFree(level);CHKERRQ(ierr);
+  fact->ops->solve = MatSolve_SeqAIJ_Levels;
+  ierr = MatSeqAIJLevelsLog_Private(fact,lv);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_LevelSets,fact,A,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Level-scheduled solve with a Cholesky or ICC factor U^T D U. The forward sweep with U^T is done by columns of U
+   through the transposed structure so that each row of the sweep is computed by a single thread
+*/
+static PetscErrorCode MatSolve_SeqSBAIJ_1_Levels(Mat A,Vec bb,Vec xx)
+{
+  Mat_SeqSBAIJ      *a  = (Mat_SeqSBAIJ*)A->data;
+  Mat_SeqAIJ_Levels *lv = &a->levels;
+  PetscErrorCode    ierr;
+  const PetscInt    mbs = a->mbs,*ai = a->i,*aj = a->j,*adiag = a->diag,*rp;
+  const MatScalar   *aa = a->a;
+  const PetscScalar *b;
+  PetscScalar       *x,*t = a->solve_work,*u = lv->work;
+
+  PetscFunctionBegin;
+  ierr = PetscLogEventBegin(MAT_SolveLevels,A,0,0,0);CHKERRQ(ierr);
+  ierr = VecGetArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecGetArray(xx,&x);CHKERRQ(ierr);
+  ierr = ISGetIndices(a->row,&rp);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel num_threads(lv->nthreads)
+#endif
+  {
+    const PetscInt  *vj;
+    const MatScalar *v;
+    PetscScalar     sum;
+    PetscInt        l,k,p,j,nz;
+
+    /* solve U^T*D*y = perm(b) by forward substitution */
+    for (l=0; l<lv->nlevels[0]; l++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+      for (p=lv->lstart[0][l]; p<lv->lstart[0][l+1]; p++) {
+        k   = lv->rows[0][p];
+        sum = b[rp[k]];
+        for (j=lv->ti[k]; j<lv->ti[k+1]; j++) sum += aa[lv->tp[j]]*u[lv->tr[j]];
+        u[k] = sum;
+        t[k] = sum*aa[adiag[k]]; /* aa[adiag[k]] = 1/D(k) */
+      }
+    }
+    /* solve U*perm(x) = y by back substitution */
+    for (l=0; l<lv->nlevels[1]; l++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+      for (p=lv->lstart[1][l]; p<lv->lstart[1][l+1]; p++) {
+        k   = lv->rows[1][p];
+        v   = aa + ai[k];
+        vj  = aj + ai[k];
+        nz  = ai[k+1] - ai[k] - 1;
+        sum = t[k];
+        for (j=0; j<nz; j++) sum += v[j]*t[vj[j]];
+        t[k]     = sum;
+        x[rp[k]] = sum;
+      }
+    }
+  }
+  ierr = ISRestoreIndices(a->row,&rp);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecRestoreArray(xx,&x);CHKERRQ(ierr);
+  ierr = PetscLogFlops(4.0*a->nz - 3.0*mbs);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_SolveLevels,A,0,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Same as MatSeqAIJSetUpLevels_LU() for the factors computed by MatCholeskyFactorNumeric_SeqAIJ() */
+static PetscErrorCode MatSeqAIJSetUpLevels_Cholesky(Mat fact,Mat A)
+{
+  Mat_SeqAIJ        *a  = (Mat_SeqAIJ*)A->data;
+  Mat_SeqSBAIJ      *b  = (Mat_SeqSBAIJ*)fact->data;
+  Mat_SeqAIJ_Levels *lv = &b->levels;
+  PetscErrorCode    ierr;
+  PetscInt          n = fact->rmap->n,*bi = b->i,*bj = b->j,*level,i,k,lev,nz = bi[n];
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJLevelsReset_Private(lv);CHKERRQ(ierr);
+  lv->nthreads = a->threads.nthreads;
+  if (lv->nthreads < 2) PetscFunctionReturn(0);
+  ierr = PetscLogEventBegin(MAT_LevelSets,fact,A,0,0);CHKERRQ(ierr);
+  ierr = PetscCalloc1(n,&level);CHKERRQ(ierr);
+  ierr = PetscMalloc1(n,&lv->work);CHKERRQ(ierr);
+  /* transpose of the strictly upper triangular part; the diagonal is the last entry of each row */
+  ierr = PetscMalloc3(n+1,&lv->ti,nz-n,&lv->tr,nz-n,&lv->tp);CHKERRQ(ierr);
+  ierr = PetscArrayzero(lv->ti,n+1);CHKERRQ(ierr);
+  for (i=0; i<n; i++) {
+    for (k=bi[i]; k<bi[i+1]-1; k++) lv->ti[bj[k]+1]++;
+  }
+  for (i=0; i<n; i++) lv->ti[i+1] += lv->ti[i];
+  for (i=0; i<n; i++) {
+    for (k=bi[i]; k<bi[i+1]-1; k++) {
+      lv->tr[lv->ti[bj[k]]]   = i;
+      lv->tp[lv->ti[bj[k]]++] = k;
+    }
+  }
+  for (i=n; i>0; i--) lv->ti[i] = lv->ti[i-1];
+  lv->ti[0] = 0;
+  /* the forward sweep with U^T; rows of U are visited in increasing order so the levels of their columns can be pushed */
+  for (i=0; i<n; i++) {
+    for (k=bi[i]; k<bi[i+1]-1; k++) level[bj[k]] = PetscMax(level[bj[k]],level[i]+1);
+  }
+  ierr = MatSeqAIJLevelsBucket_Private(n,level,&lv->nlevels[0],&lv->lstart[0],&lv->rows[0]);CHKERRQ(ierr);
+  for (i=n-1; i>=0; i--) {
+    for (lev=0,k=bi[i]; k<bi[i+1]-1; k++) lev = PetscMax(lev,level[bj[k]]+1);
+    level[i] = lev;
+  }
+  ierr = MatSeqAIJLevelsBucket_Private(n,level,&lv->nlevels[1],&lv->lstart[1],&lv->rows[1]);CHKERRQ(ierr);
+  ierr = PetscFree(level);CHKERRQ(ierr);
+  fact->ops->solve          = MatSolve_SeqSBAIJ_1_Levels;
+  fact->ops->solvetranspose = MatSolve_SeqSBAIJ_1_Levels;
+  ierr = MatSeqAIJLevelsLog_Private(fact,lv);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_LevelSets,fact,A,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode MatLUFactorSymbolic_SeqAIJ_inplace(Mat B,Mat A,IS isrow,IS iscol,const MatFactorInfo *info)
 {
   Mat_SeqAIJ         *a = (Mat_SeqAIJ*)A->data,*b;
@@ -599,6 +865,8 @@ PetscErrorCode MatLUFactorNumeric_SeqAIJ(Mat B,Mat A,const MatFactorInfo *info)
   C->assembled              = PETSC_TRUE;
   C->preallocated           = PETSC_TRUE;
 
+  ierr = MatSeqAIJSetUpLevels_LU(C,A);CHKERRQ(ierr);
+
   ierr = PetscLogFlops(C->cmap->n);CHKERRQ(ierr);
 
   /* MatShiftView(A,info,&sctx) */
@@ -1077,15 +1345,15 @@ PetscErrorCode MatMatSolve_SeqAIJ(Mat A,Mat B,Mat X)
   IS                iscol = a->col,isrow = a->row;
   PetscErrorCode    ierr;
   PetscInt          i, n = A->rmap->n,*vi,*ai = a->i,*aj = a->j,*adiag = a->diag;
-  PetscInt          nz,neq;
+  PetscInt          nz,neq,nrhs = B->cmap->n,ldb,ldx;
   const PetscInt    *rout,*cout,*r,*c;
-  PetscScalar       *x,*tmp,sum;
+  PetscScalar       *x,*tmp,*t,sum;
   const PetscScalar *b;
   const PetscScalar *aa = a->a,*v;
   PetscBool         bisdense,xisdense;
 
   PetscFunctionBegin;
-  if (!n) PetscFunctionReturn(0);
+  if (!n || !nrhs) PetscFunctionReturn(0);
 
   ierr = PetscObjectTypeCompare((PetscObject)B,MATSEQDENSE,&bisdense);CHKERRQ(ierr);
   if (!bisdense) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_INCOMP,"B matrix must be a SeqDense matrix");
@@ -1094,44 +1362,49 @@ PetscErrorCode MatMatSolve_SeqAIJ(Mat A,Mat B,Mat X)
     if (!xisdense) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_INCOMP,"X matrix must be a SeqDense matrix");
   }
 
+  ierr = MatDenseGetLDA(B,&ldb);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(X,&ldx);CHKERRQ(ierr);
   ierr = MatDenseGetArrayRead(B,&b);CHKERRQ(ierr);
   ierr = MatDenseGetArray(X,&x);CHKERRQ(ierr);
 
-  tmp  = a->solve_work;
+  if (nrhs == 1) tmp = a->solve_work;
+  else {ierr = PetscMalloc1(n*nrhs,&tmp);CHKERRQ(ierr);}
   ierr = ISGetIndices(isrow,&rout);CHKERRQ(ierr); r = rout;
   ierr = ISGetIndices(iscol,&cout);CHKERRQ(ierr); c = cout;
 
-  for (neq=0; neq<B->cmap->n; neq++) {
-    /* forward solve the lower triangular */
-    tmp[0] = b[r[0]];
-    v      = aa;
-    vi     = aj;
-    for (i=1; i<n; i++) {
-      nz  = ai[i+1] - ai[i];
-      sum = b[r[i]];
-      PetscSparseDenseMinusDot(sum,tmp,v,vi,nz);
-      tmp[i] = sum;
-      v     += nz; vi += nz;
+  /* each row of the factors is read once from memory and used for all the right hand sides */
+  /* forward solve the lower triangular */
+  for (i=0; i<n; i++) {
+    nz = ai[i+1] - ai[i];
+    v  = aa + ai[i];
+    vi = aj + ai[i];
+    for (neq=0; neq<nrhs; neq++) {
+      t   = tmp + neq*n;
+      sum = b[r[i]+neq*ldb];
+      PetscSparseDenseMinusDot(sum,t,v,vi,nz);
+      t[i] = sum;
     }
+  }
 
-    /* backward solve the upper triangular */
-    for (i=n-1; i>=0; i--) {
-      v   = aa + adiag[i+1]+1;
-      vi  = aj + adiag[i+1]+1;
-      nz  = adiag[i]-adiag[i+1]-1;
-      sum = tmp[i];
-      PetscSparseDenseMinusDot(sum,tmp,v,vi,nz);
-      x[c[i]] = tmp[i] = sum*v[nz]; /* v[nz] = aa[adiag[i]] */
+  /* backward solve the upper triangular */
+  for (i=n-1; i>=0; i--) {
+    v  = aa + adiag[i+1]+1;
+    vi = aj + adiag[i+1]+1;
+    nz = adiag[i]-adiag[i+1]-1;
+    for (neq=0; neq<nrhs; neq++) {
+      t   = tmp + neq*n;
+      sum = t[i];
+      PetscSparseDenseMinusDot(sum,t,v,vi,nz);
+      x[c[i]+neq*ldx] = t[i] = sum*v[nz]; /* v[nz] = aa[adiag[i]] */
     }
-
-    b += n;
-    x += n;
   }
+
+  if (nrhs > 1) {ierr = PetscFree(tmp);CHKERRQ(ierr);}
   ierr = ISRestoreIndices(isrow,&rout);CHKERRQ(ierr);
   ierr = ISRestoreIndices(iscol,&cout);CHKERRQ(ierr);
   ierr = MatDenseRestoreArrayRead(B,&b);CHKERRQ(ierr);
   ierr = MatDenseRestoreArray(X,&x);CHKERRQ(ierr);
-  ierr = PetscLogFlops(B->cmap->n*(2.0*a->nz - n));CHKERRQ(ierr);
+  ierr = PetscLogFlops(nrhs*(2.0*a->nz - n));CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
 
@@ -2178,6 +2451,7 @@ PetscErrorCode MatCholeskyFactorNumeric_SeqAIJ(Mat B,Mat A,const MatFactorInfo *
 
   C->assembled    = PETSC_TRUE;
   C->preallocated = PETSC_TRUE;
+  ierr = MatSeqAIJSetUpLevels_Cholesky(C,A);CHKERRQ(ierr);
 
   ierr = PetscLogFlops(C->rmap->n);CHKERRQ(ierr);
 
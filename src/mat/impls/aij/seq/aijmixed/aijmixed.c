@@ -0,0 +1,1365 @@
+/*
+  Defines basic operations for the MATSEQAIJMIXED matrix class.
+  This class is derived from the MATSEQAIJ class. The first time one of the
+  bandwidth bound kernels (MatMult(), MatMultAdd(), MatMultTranspose(),
+  MatMultTransposeAdd(), MatGetDiagonal(), MatSOR() and MatSolve() with the
+  LU/ILU factors) runs, the values are rounded to single precision and the
+  column indices are stored in 32 bit integers, and the MATSEQAIJ arrays of
+  values and column indices are freed. The kernels accumulate in PetscScalar.
+  All the other MATSEQAIJ operations are wrapped: they first rebuild the
+  MATSEQAIJ arrays from the reduced storage, which the next kernel makes again.
+*/
+
+#include <../src/mat/impls/aij/seq/aijmixed/aijmixed.h>
+
+typedef struct {
+  MATAIJMIXEDHEADER;
+  PetscBool      compressed;       /* a[] and j[] hold the matrix, the MATSEQAIJ arrays of values and column indices are freed */
+  PetscInt       nz;               /* length of a[] and j[] */
+  float          *a;               /* values in single precision */
+  int            *j;               /* column indices in 32 bit integers */
+  Mat            owner;            /* MATSEQAIJ matrix whose row offsets and column indices this matrix uses, or NULL */
+  PetscObjectState ownernzstate;   /* nonzero state of owner when they were borrowed */
+  PetscBool      sharedj;          /* j[] is the array of column indices of owner */
+  PetscErrorCode (*lufactornumeric)(Mat,Mat,const MatFactorInfo*); /* MATSEQAIJ numeric factorization, for LU and ILU factor matrices */
+} Mat_SeqAIJMixed;
+
+static PetscErrorCode MatSolve_SeqAIJMixed(Mat,Vec,Vec);
+static PetscErrorCode MatSolve_SeqAIJMixed_Levels(Mat,Vec,Vec);
+
+/*
+   Rounds the nz values v to single precision and, unless j is NULL, copies the column indices j to 32 bit integers,
+   into the reduced storage of A
+*/
+static PetscErrorCode MatSeqAIJMixedRound_Private(Mat A,PetscInt nz,const MatScalar *v,const PetscInt *j)
+{
+  Mat_SeqAIJ      *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  PetscInt        i;
+
+  PetscFunctionBegin;
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1 && !A->factortype) {
+    const PetscInt *rstart;
+    PetscInt       t,k,nt = a->threads.nthreads;
+    PetscErrorCode ierr;
+
+    /* each row is first touched by the thread that streams it in the kernels */
+    ierr = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_ROWS,NULL,&rstart);CHKERRQ(ierr);
+#pragma omp parallel for num_threads(nt) schedule(static,1) private(k)
+    for (t=0; t<nt; t++) {
+      for (k=a->i[rstart[t]]; k<a->i[rstart[t+1]]; k++) {
+        mixed->a[k] = (float)v[k];
+        if (j) mixed->j[k] = (int)j[k];
+      }
+    }
+  } else
+#endif
+  {
+    for (i=0; i<nz; i++) mixed->a[i] = (float)v[i];
+    if (j) for (i=0; i<nz; i++) mixed->j[i] = (int)j[i];
+  }
+  PetscFunctionReturn(0);
+}
+
+/*
+   Moves the values and column indices to the reduced storage, keeping the row offsets. For LU and ILU factors this
+   covers both triangular factors and is only done when the factor uses the solves below. Matrices whose arrays belong
+   to the user or that have no values keep the MATSEQAIJ storage, and their kernels are the MATSEQAIJ ones.
+   A matrix that borrows the row offsets and column indices of an owner (see MatSeqAIJMixedDemote_Private()) only
+   moves its values, and uses the column indices of the owner in place when PetscInt has 32 bits.
+*/
+static PetscErrorCode MatSeqAIJMixedCompress_Private(Mat A)
+{
+  Mat_SeqAIJ      *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  PetscErrorCode  ierr;
+  PetscInt        nz,m = A->rmap->n,*ii;
+
+  PetscFunctionBegin;
+  if (mixed->compressed || !a->a || !a->free_a) PetscFunctionReturn(0);
+  /* a new nonzero reallocated the structure of A, which now owns it */
+  if (mixed->owner && a->free_ij) {ierr = MatDestroy(&mixed->owner);CHKERRQ(ierr);}
+  if (!mixed->owner && !a->free_ij) PetscFunctionReturn(0);
+  if (mixed->owner && mixed->owner->nonzerostate != mixed->ownernzstate) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"The nonzero structure of the matrix whose column indices are shared has changed");
+  if (A->factortype && A->ops->solve != MatSolve_SeqAIJMixed && A->ops->solve != MatSolve_SeqAIJMixed_Levels) PetscFunctionReturn(0);
+  if (A->cmap->n > PETSC_MPI_INT_MAX) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_SUP,"Column indices of a matrix with %D columns do not fit in 32 bits",A->cmap->n);
+  nz   = A->factortype ? (m ? a->diag[0]+1 : 0) : a->i[m];
+  ierr = PetscMalloc1(nz,&mixed->a);CHKERRQ(ierr);
+#if !defined(PETSC_USE_64BIT_INDICES)
+  mixed->sharedj = mixed->owner ? PETSC_TRUE : PETSC_FALSE;
+#endif
+  if (mixed->sharedj) mixed->j = (int*)a->j;
+  else {ierr = PetscMalloc1(nz,&mixed->j);CHKERRQ(ierr);}
+  ierr = MatSeqAIJMixedRound_Private(A,nz,a->a,mixed->sharedj ? NULL : a->j);CHKERRQ(ierr);
+  if (mixed->owner) {
+    ierr = PetscFree(a->a);CHKERRQ(ierr);
+  } else if (a->singlemalloc) {
+    ierr = PetscMalloc1(m+1,&ii);CHKERRQ(ierr);
+    ierr = PetscArraycpy(ii,a->i,m+1);CHKERRQ(ierr);
+    ierr = PetscFree3(a->a,a->j,a->i);CHKERRQ(ierr);
+    a->i            = ii;
+    a->singlemalloc = PETSC_FALSE;
+  } else {
+    ierr = PetscFree(a->a);CHKERRQ(ierr);
+    ierr = PetscFree(a->j);CHKERRQ(ierr);
+  }
+  mixed->nz         = nz;
+  mixed->compressed = PETSC_TRUE;
+  ierr = PetscInfo2(A,"Matrix with %D nonzeros moved to single precision values and 32 bit column indices, %D rows\n",nz,m);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Rebuilds the MATSEQAIJ arrays from the reduced storage; the values keep their single precision rounding. The column
+   indices borrowed from an owner are still those of the owner.
+*/
+static PetscErrorCode MatSeqAIJMixedExpand_Private(Mat A)
+{
+  Mat_SeqAIJ      *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  PetscErrorCode  ierr;
+  PetscInt        i,nz;
+
+  PetscFunctionBegin;
+  if (!mixed || !mixed->compressed) PetscFunctionReturn(0);
+  nz   = mixed->nz;
+  ierr = PetscMalloc1(nz,&a->a);CHKERRQ(ierr);
+  if (!mixed->owner) {ierr = PetscMalloc1(nz,&a->j);CHKERRQ(ierr);}
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1 && !A->factortype) {
+    const PetscInt *rstart;
+    PetscInt       t,k,nt = a->threads.nthreads;
+
+    ierr = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_ROWS,NULL,&rstart);CHKERRQ(ierr);
+#pragma omp parallel for num_threads(nt) schedule(static,1) private(i,k)
+    for (t=0; t<nt; t++) {
+      for (k=a->i[rstart[t]]; k<a->i[rstart[t+1]]; k++) {
+        a->a[k] = (MatScalar)mixed->a[k];
+        if (!mixed->owner) a->j[k] = (PetscInt)mixed->j[k];
+      }
+    }
+  } else
+#endif
+  {
+    for (i=0; i<nz; i++) a->a[i] = (MatScalar)mixed->a[i];
+    if (!mixed->owner) for (i=0; i<nz; i++) a->j[i] = (PetscInt)mixed->j[i];
+  }
+  ierr = PetscFree(mixed->a);CHKERRQ(ierr);
+  if (!mixed->sharedj) {ierr = PetscFree(mixed->j);CHKERRQ(ierr);}
+  mixed->j       = NULL;
+  mixed->sharedj = PETSC_FALSE;
+  if (!A->factortype) a->maxnz = nz;
+  mixed->compressed = PETSC_FALSE;
+  PetscFunctionReturn(0);
+}
+
+/*
+   Rebuilds the storage of the base type of A if it is a MATSEQAIJMIXED or MATMPIAIJMIXED matrix, for code that
+   reads the MATSEQAIJ or MATMPIAIJ storage directly
+*/
+PetscErrorCode MatAIJMixedExpand_Private(Mat A)
+{
+  PetscErrorCode ierr;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  if (!A || !A->spptr) PetscFunctionReturn(0);
+  ierr = PetscObjectTypeCompareAny((PetscObject)A,&flg,MATSEQAIJMIXED,MATMPIAIJMIXED,"");CHKERRQ(ierr);
+  if (flg) {ierr = (*((Mat_AIJMixed*)A->spptr)->expand)(A);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMult_SeqAIJMixed(Mat A,Vec xx,Vec yy)
+{
+  Mat_SeqAIJ        *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed   *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  const PetscInt    *ii    = a->i,m = A->rmap->n;
+  const PetscScalar *x;
+  PetscScalar       *y;
+  PetscErrorCode    ierr;
+  const float       *aa;
+  const int         *aj;
+  PetscInt          i,k;
+  PetscScalar       sum;
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  if (!mixed->compressed) {
+    ierr = MatMult_SeqAIJ(A,xx,yy);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecGetArray(yy,&y);CHKERRQ(ierr);
+  aa   = mixed->a;
+  aj   = mixed->j;
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1) {
+    const PetscInt *start,*rstart;
+    PetscInt       t,nt = a->threads.nthreads;
+
+    ierr = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_ROWS,&start,&rstart);CHKERRQ(ierr);
+#pragma omp parallel for num_threads(nt) schedule(static,1) private(i,k,sum)
+    for (t=0; t<nt; t++) {
+      for (i=start[t]; i<start[t+1]; i++) {
+        sum = 0.0;
+        for (k=ii[i]; k<ii[i+1]; k++) sum += (PetscScalar)aa[k]*x[aj[k]];
+        y[i] = sum;
+      }
+    }
+  } else
+#endif
+  {
+    for (i=0; i<m; i++) {
+      sum = 0.0;
+      for (k=ii[i]; k<ii[i+1]; k++) sum += (PetscScalar)aa[k]*x[aj[k]];
+      y[i] = sum;
+    }
+  }
+  ierr = PetscLogFlops(2.0*a->nz - a->nonzerorowcnt);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecRestoreArray(yy,&y);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMultAdd_SeqAIJMixed(Mat A,Vec xx,Vec yy,Vec zz)
+{
+  Mat_SeqAIJ        *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed   *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  const PetscInt    *ii    = a->i,m = A->rmap->n;
+  const PetscScalar *x;
+  PetscScalar       *y,*z;
+  PetscErrorCode    ierr;
+  const float       *aa;
+  const int         *aj;
+  PetscInt          i,k;
+  PetscScalar       sum;
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  if (!mixed->compressed) {
+    ierr = MatMultAdd_SeqAIJ(A,xx,yy,zz);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecGetArrayPair(yy,zz,&y,&z);CHKERRQ(ierr);
+  aa   = mixed->a;
+  aj   = mixed->j;
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1) {
+    const PetscInt *start,*rstart;
+    PetscInt       t,nt = a->threads.nthreads;
+
+    ierr = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_ROWS,&start,&rstart);CHKERRQ(ierr);
+#pragma omp parallel for num_threads(nt) schedule(static,1) private(i,k,sum)
+    for (t=0; t<nt; t++) {
+      for (i=start[t]; i<start[t+1]; i++) {
+        sum = y[i];
+        for (k=ii[i]; k<ii[i+1]; k++) sum += (PetscScalar)aa[k]*x[aj[k]];
+        z[i] = sum;
+      }
+    }
+  } else
+#endif
+  {
+    for (i=0; i<m; i++) {
+      sum = y[i];
+      for (k=ii[i]; k<ii[i+1]; k++) sum += (PetscScalar)aa[k]*x[aj[k]];
+      z[i] = sum;
+    }
+  }
+  ierr = PetscLogFlops(2.0*a->nz);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecRestoreArrayPair(yy,zz,&y,&z);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMultTransposeAdd_SeqAIJMixed(Mat A,Vec xx,Vec zz,Vec yy)
+{
+  Mat_SeqAIJ        *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed   *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  const PetscInt    *ii    = a->i,m = A->rmap->n;
+  const PetscScalar *x;
+  PetscScalar       *y,alpha;
+  PetscErrorCode    ierr;
+  const float       *aa;
+  const int         *aj;
+  PetscInt          i,k;
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  if (!mixed->compressed) {
+    ierr = MatMultTransposeAdd_SeqAIJ(A,xx,zz,yy);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  if (zz != yy) {ierr = VecCopy(zz,yy);CHKERRQ(ierr);}
+  ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecGetArray(yy,&y);CHKERRQ(ierr);
+  aa   = mixed->a;
+  aj   = mixed->j;
+  for (i=0; i<m; i++) {
+    alpha = x[i];
+    for (k=ii[i]; k<ii[i+1]; k++) y[aj[k]] += (PetscScalar)aa[k]*alpha;
+  }
+  ierr = PetscLogFlops(2.0*a->nz);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecRestoreArray(yy,&y);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMultTranspose_SeqAIJMixed(Mat A,Vec xx,Vec yy)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = VecSet(yy,0.0);CHKERRQ(ierr);
+  ierr = MatMultTransposeAdd_SeqAIJMixed(A,xx,yy,yy);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatGetDiagonal_SeqAIJMixed(Mat A,Vec v)
+{
+  Mat_SeqAIJ      *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  PetscErrorCode  ierr;
+  PetscInt        i,k,n;
+  PetscScalar     *x;
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  if (!mixed->compressed) {
+    ierr = MatGetDiagonal_SeqAIJ(A,v);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  ierr = VecGetLocalSize(v,&n);CHKERRQ(ierr);
+  if (n != A->rmap->n) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Nonconforming matrix and vector");
+  ierr = VecGetArrayWrite(v,&x);CHKERRQ(ierr);
+  if (A->factortype == MAT_FACTOR_ILU || A->factortype == MAT_FACTOR_LU) {
+    for (i=0; i<n; i++) x[i] = 1.0/(PetscScalar)mixed->a[a->diag[i]];
+  } else {
+    for (i=0; i<n; i++) {
+      x[i] = 0.0;
+      for (k=a->i[i]; k<a->i[i+1]; k++) {
+        if (mixed->j[k] == i) {
+          x[i] = (PetscScalar)mixed->a[k];
+          break;
+        }
+      }
+    }
+  }
+  ierr = VecRestoreArrayWrite(v,&x);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Forward and backward SOR sweeps with the reduced storage; the inverse of the (shifted) diagonal is kept in
+   PetscScalar by MatInvertDiagonal_SeqAIJ(). Eisenstat and the application of the triangular parts use MatSOR_SeqAIJ().
+*/
+static PetscErrorCode MatSOR_SeqAIJMixed(Mat A,Vec bb,PetscReal omega,MatSORType flag,PetscReal fshift,PetscInt its,PetscInt lits,Vec xx)
+{
+  Mat_SeqAIJ        *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed   *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  const PetscInt    *ii    = a->i,*diag,m = A->rmap->n;
+  const PetscScalar *b,*idiag;
+  PetscScalar       *x,sum;
+  PetscErrorCode    ierr;
+  const float       *aa;
+  const int         *aj;
+  PetscInt          i,k;
+
+  PetscFunctionBegin;
+  if (flag & (SOR_EISENSTAT | SOR_APPLY_UPPER | SOR_APPLY_LOWER)) {
+    ierr = MatSeqAIJMixedExpand_Private(A);CHKERRQ(ierr);
+    ierr = MatSOR_SeqAIJ(A,bb,omega,flag,fshift,its,lits,xx);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  if (its <= 0 || lits <= 0) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONG,"Relaxation requires global its %D and local its %D both positive",its,lits);
+  if (!a->idiagvalid) {
+    ierr = MatSeqAIJMixedExpand_Private(A);CHKERRQ(ierr);
+    ierr = MatInvertDiagonal_SeqAIJ(A,omega,fshift);CHKERRQ(ierr);
+  }
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  if (!mixed->compressed) {
+    ierr = MatSOR_SeqAIJ(A,bb,omega,flag,fshift,its,lits,xx);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+  /* xx is the parallel vector when called from MatSOR_MPIAIJ(), where the blocks of other processes may not be compressed */
+  ierr  = VecGetArray(xx,&x);CHKERRQ(ierr);
+  ierr  = VecGetArrayRead(bb,&b);CHKERRQ(ierr);
+  if (flag & SOR_ZERO_INITIAL_GUESS) {ierr = PetscArrayzero(x,m);CHKERRQ(ierr);}
+  aa    = mixed->a;
+  aj    = mixed->j;
+  diag  = a->diag;
+  idiag = a->idiag;
+  its   = its*lits;
+  ierr  = PetscLogFlops(its*(((flag & SOR_FORWARD_SWEEP) || (flag & SOR_LOCAL_FORWARD_SWEEP)) + ((flag & SOR_BACKWARD_SWEEP) || (flag & SOR_LOCAL_BACKWARD_SWEEP)))*(2.0*a->nz + 4.0*m));CHKERRQ(ierr);
+  while (its--) {
+    if ((flag & SOR_FORWARD_SWEEP) || (flag & SOR_LOCAL_FORWARD_SWEEP)) {
+      for (i=0; i<m; i++) {
+        sum = b[i] + (PetscScalar)aa[diag[i]]*x[i];
+        for (k=ii[i]; k<ii[i+1]; k++) sum -= (PetscScalar)aa[k]*x[aj[k]];
+        x[i] = (1.0 - omega)*x[i] + idiag[i]*sum;
+      }
+    }
+    if ((flag & SOR_BACKWARD_SWEEP) || (flag & SOR_LOCAL_BACKWARD_SWEEP)) {
+      for (i=m-1; i>=0; i--) {
+        sum = b[i] + (PetscScalar)aa[diag[i]]*x[i];
+        for (k=ii[i]; k<ii[i+1]; k++) sum -= (PetscScalar)aa[k]*x[aj[k]];
+        x[i] = (1.0 - omega)*x[i] + idiag[i]*sum;
+      }
+    }
+  }
+  ierr = VecRestoreArray(xx,&x);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(bb,&b);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatSolve_SeqAIJMixed(Mat A,Vec bb,Vec xx)
+{
+  Mat_SeqAIJ        *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed   *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  IS                iscol  = a->col,isrow = a->row;
+  PetscErrorCode    ierr;
+  const PetscInt    n = A->rmap->n,*ai = a->i,*adiag = a->diag;
+  PetscInt          i,k;
+  const PetscInt    *r,*c;
+  PetscScalar       *x,*tmp,sum;
+  const PetscScalar *b;
+  const float       *aa;
+  const int         *aj;
+
+  PetscFunctionBegin;
+  if (!n) PetscFunctionReturn(0);
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  aa   = mixed->a;
+  aj   = mixed->j;
+
+  ierr = VecGetArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecGetArrayWrite(xx,&x);CHKERRQ(ierr);
+  ierr = ISGetIndices(isrow,&r);CHKERRQ(ierr);
+  ierr = ISGetIndices(iscol,&c);CHKERRQ(ierr);
+  tmp  = a->solve_work;
+
+  /* forward solve the lower triangular */
+  for (i=0; i<n; i++) {
+    sum = b[r[i]];
+    for (k=ai[i]; k<ai[i+1]; k++) sum -= (PetscScalar)aa[k]*tmp[aj[k]];
+    tmp[i] = sum;
+  }
+
+  /* backward solve the upper triangular, aa[adiag[i]] is the inverse of the diagonal */
+  for (i=n-1; i>=0; i--) {
+    sum = tmp[i];
+    for (k=adiag[i+1]+1; k<adiag[i]; k++) sum -= (PetscScalar)aa[k]*tmp[aj[k]];
+    x[c[i]] = tmp[i] = sum*(PetscScalar)aa[adiag[i]];
+  }
+
+  ierr = ISRestoreIndices(isrow,&r);CHKERRQ(ierr);
+  ierr = ISRestoreIndices(iscol,&c);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecRestoreArrayWrite(xx,&x);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*mixed->nz - n);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Level-scheduled solve of MatSolve_SeqAIJ_Levels() with the reduced storage, for factors of matrices that use threads */
+static PetscErrorCode MatSolve_SeqAIJMixed_Levels(Mat A,Vec bb,Vec xx)
+{
+  Mat_SeqAIJ        *a     = (Mat_SeqAIJ*)A->data;
+  Mat_SeqAIJMixed   *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  Mat_SeqAIJ_Levels *lv    = &a->levels;
+  PetscErrorCode    ierr;
+  const PetscInt    n = A->rmap->n,*ai = a->i,*adiag = a->diag;
+  const PetscInt    *r,*c;
+  const PetscScalar *b;
+  PetscScalar       *x,*tmp = a->solve_work;
+  const float       *aa;
+  const int         *aj;
+
+  PetscFunctionBegin;
+  if (!n) PetscFunctionReturn(0);
+  ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);
+  aa   = mixed->a;
+  aj   = mixed->j;
+  ierr = PetscLogEventBegin(MAT_SolveLevels,A,0,0,0);CHKERRQ(ierr);
+  ierr = VecGetArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecGetArrayWrite(xx,&x);CHKERRQ(ierr);
+  ierr = ISGetIndices(a->row,&r);CHKERRQ(ierr);
+  ierr = ISGetIndices(a->col,&c);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel num_threads(lv->nthreads)
+#endif
+  {
+    PetscScalar sum;
+    PetscInt    l,k,q,i;
+
+    /* forward solve the lower triangular */
+    for (l=0; l<lv->nlevels[0]; l++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+      for (k=lv->lstart[0][l]; k<lv->lstart[0][l+1]; k++) {
+        i   = lv->rows[0][k];
+        sum = b[r[i]];
+        for (q=ai[i]; q<ai[i+1]; q++) sum -= (PetscScalar)aa[q]*tmp[aj[q]];
+        tmp[i] = sum;
+      }
+    }
+    /* backward solve the upper triangular, aa[adiag[i]] is the inverse of the diagonal */
+    for (l=0; l<lv->nlevels[1]; l++) {
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp for schedule(static)
+#endif
+      for (k=lv->lstart[1][l]; k<lv->lstart[1][l+1]; k++) {
+        i   = lv->rows[1][k];
+        sum = tmp[i];
+        for (q=adiag[i+1]+1; q<adiag[i]; q++) sum -= (PetscScalar)aa[q]*tmp[aj[q]];
+        x[c[i]] = tmp[i] = sum*(PetscScalar)aa[adiag[i]];
+      }
+    }
+  }
+  ierr = ISRestoreIndices(a->row,&r);CHKERRQ(ierr);
+  ierr = ISRestoreIndices(a->col,&c);CHKERRQ(ierr);
+  ierr = VecRestoreArrayRead(bb,&b);CHKERRQ(ierr);
+  ierr = VecRestoreArrayWrite(xx,&x);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*mixed->nz - n);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_SolveLevels,A,0,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Wrappers of the operations of the base type: they rebuild the base storage of the operands that are MATSEQAIJMIXED
+   or MATMPIAIJMIXED matrices and call the operation saved in the Mat_AIJMixed of the first of them
+*/
+static PetscErrorCode MatAIJMixedPrepare_Private(Mat X,Mat Y,Mat Z,struct _MatOps **ops)
+{
+  PetscErrorCode ierr;
+  Mat            M[3];
+  PetscBool      flg;
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  M[0] = X; M[1] = Y; M[2] = Z;
+  *ops = NULL;
+  for (i=0; i<3; i++) {
+    if (!M[i] || !M[i]->spptr) continue;
+    ierr = PetscObjectTypeCompareAny((PetscObject)M[i],&flg,MATSEQAIJMIXED,MATMPIAIJMIXED,"");CHKERRQ(ierr);
+    if (!flg) continue;
+    ierr = (*((Mat_AIJMixed*)M[i]->spptr)->expand)(M[i]);CHKERRQ(ierr);
+    if (!*ops) *ops = &((Mat_AIJMixed*)M[i]->spptr)->ops;
+  }
+  if (!*ops) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"No MATSEQAIJMIXED or MATMPIAIJMIXED operand");
+  PetscFunctionReturn(0);
+}
+
+/* Makes the numeric products into C, computed again with MAT_REUSE_MATRIX, rebuild the base storage of their operands */
+#define MATAIJMIXED_PRODUCT_NUMERIC(op) \
+static PetscErrorCode MatAIJMixedProduct_##op(Mat A,Mat B,Mat C) \
+{ \
+  PetscErrorCode ierr,(*f)(Mat,Mat,Mat); \
+  PetscFunctionBegin; \
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr); \
+  ierr = MatAIJMixedExpand_Private(B);CHKERRQ(ierr); \
+  ierr = MatAIJMixedExpand_Private(C);CHKERRQ(ierr); \
+  ierr = PetscObjectQueryFunction((PetscObject)C,"MatAIJMixedProduct_" #op "_C",&f);CHKERRQ(ierr); \
+  ierr = (*f)(A,B,C);CHKERRQ(ierr); \
+  PetscFunctionReturn(0); \
+}
+
+MATAIJMIXED_PRODUCT_NUMERIC(matmultnumeric)
+MATAIJMIXED_PRODUCT_NUMERIC(ptapnumeric)
+MATAIJMIXED_PRODUCT_NUMERIC(mattransposemultnumeric)
+MATAIJMIXED_PRODUCT_NUMERIC(transposematmultnumeric)
+MATAIJMIXED_PRODUCT_NUMERIC(rartnumeric)
+
+#define MATAIJMIXED_PRODUCT_WRAP(op) \
+  if (C->ops->op && C->ops->op != MatAIJMixedProduct_##op) { \
+    ierr = PetscObjectComposeFunction((PetscObject)C,"MatAIJMixedProduct_" #op "_C",C->ops->op);CHKERRQ(ierr); \
+    C->ops->op = MatAIJMixedProduct_##op; \
+  }
+
+static PetscErrorCode MatAIJMixedProductWrap_Private(Mat C)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (!C) PetscFunctionReturn(0);
+  MATAIJMIXED_PRODUCT_WRAP(matmultnumeric)
+  MATAIJMIXED_PRODUCT_WRAP(ptapnumeric)
+  MATAIJMIXED_PRODUCT_WRAP(mattransposemultnumeric)
+  MATAIJMIXED_PRODUCT_WRAP(transposematmultnumeric)
+  MATAIJMIXED_PRODUCT_WRAP(rartnumeric)
+  PetscFunctionReturn(0);
+}
+
+#define MATAIJMIXED_WRAP(op,decl,args,X,Y,Z) \
+static PetscErrorCode MatAIJMixed_##op decl \
+{ \
+  PetscErrorCode ierr; \
+  struct _MatOps *ops; \
+  PetscFunctionBegin; \
+  ierr = MatAIJMixedPrepare_Private(X,Y,Z,&ops);CHKERRQ(ierr); \
+  ierr = (*ops->op)args;CHKERRQ(ierr); \
+  PetscFunctionReturn(0); \
+}
+
+/* the same for operations that create a product C */
+#define MATAIJMIXED_WRAP_PRODUCT(op,decl,args,X,Y,Z,C) \
+static PetscErrorCode MatAIJMixed_##op decl \
+{ \
+  PetscErrorCode ierr; \
+  struct _MatOps *ops; \
+  PetscFunctionBegin; \
+  ierr = MatAIJMixedPrepare_Private(X,Y,Z,&ops);CHKERRQ(ierr); \
+  ierr = (*ops->op)args;CHKERRQ(ierr); \
+  ierr = MatAIJMixedProductWrap_Private(C);CHKERRQ(ierr); \
+  PetscFunctionReturn(0); \
+}
+
+MATAIJMIXED_WRAP(setvalues,(Mat A,PetscInt m,const PetscInt im[],PetscInt n,const PetscInt in[],const PetscScalar v[],InsertMode is),(A,m,im,n,in,v,is),A,NULL,NULL)
+MATAIJMIXED_WRAP(getrow,(Mat A,PetscInt row,PetscInt *nz,PetscInt **idx,PetscScalar **v),(A,row,nz,idx,v),A,NULL,NULL)
+MATAIJMIXED_WRAP(restorerow,(Mat A,PetscInt row,PetscInt *nz,PetscInt **idx,PetscScalar **v),(A,row,nz,idx,v),A,NULL,NULL)
+MATAIJMIXED_WRAP(solveadd,(Mat A,Vec b,Vec y,Vec x),(A,b,y,x),A,NULL,NULL)
+MATAIJMIXED_WRAP(solvetranspose,(Mat A,Vec b,Vec x),(A,b,x),A,NULL,NULL)
+MATAIJMIXED_WRAP(solvetransposeadd,(Mat A,Vec b,Vec y,Vec x),(A,b,y,x),A,NULL,NULL)
+MATAIJMIXED_WRAP(lufactor,(Mat A,IS row,IS col,const MatFactorInfo *info),(A,row,col,info),A,NULL,NULL)
+MATAIJMIXED_WRAP(choleskyfactor,(Mat A,IS perm,const MatFactorInfo *info),(A,perm,info),A,NULL,NULL)
+MATAIJMIXED_WRAP(transpose,(Mat A,MatReuse reuse,Mat *B),(A,reuse,B),A,reuse == MAT_REUSE_MATRIX ? *B : NULL,NULL)
+MATAIJMIXED_WRAP(equal,(Mat A,Mat B,PetscBool *flg),(A,B,flg),A,B,NULL)
+MATAIJMIXED_WRAP(diagonalscale,(Mat A,Vec l,Vec r),(A,l,r),A,NULL,NULL)
+MATAIJMIXED_WRAP(norm,(Mat A,NormType type,PetscReal *nrm),(A,type,nrm),A,NULL,NULL)
+MATAIJMIXED_WRAP(assemblyend,(Mat A,MatAssemblyType mode),(A,mode),A,NULL,NULL)
+MATAIJMIXED_WRAP(zeroentries,(Mat A),(A),A,NULL,NULL)
+MATAIJMIXED_WRAP(zerorows,(Mat A,PetscInt n,const PetscInt rows[],PetscScalar diag,Vec x,Vec b),(A,n,rows,diag,x,b),A,NULL,NULL)
+MATAIJMIXED_WRAP(forwardsolve,(Mat A,Vec b,Vec x),(A,b,x),A,NULL,NULL)
+MATAIJMIXED_WRAP(backwardsolve,(Mat A,Vec b,Vec x),(A,b,x),A,NULL,NULL)
+MATAIJMIXED_WRAP(ilufactor,(Mat A,IS row,IS col,const MatFactorInfo *info),(A,row,col,info),A,NULL,NULL)
+MATAIJMIXED_WRAP(iccfactor,(Mat A,IS perm,const MatFactorInfo *info),(A,perm,info),A,NULL,NULL)
+MATAIJMIXED_WRAP(axpy,(Mat Y,PetscScalar a,Mat X,MatStructure str),(Y,a,X,str),Y,X,NULL)
+MATAIJMIXED_WRAP(increaseoverlap,(Mat A,PetscInt n,IS is[],PetscInt ov),(A,n,is,ov),A,NULL,NULL)
+MATAIJMIXED_WRAP(getvalues,(Mat A,PetscInt m,const PetscInt im[],PetscInt n,const PetscInt in[],PetscScalar v[]),(A,m,im,n,in,v),A,NULL,NULL)
+MATAIJMIXED_WRAP(copy,(Mat A,Mat B,MatStructure str),(A,B,str),A,B,NULL)
+MATAIJMIXED_WRAP(getrowmax,(Mat A,Vec v,PetscInt idx[]),(A,v,idx),A,NULL,NULL)
+MATAIJMIXED_WRAP(scale,(Mat A,PetscScalar a),(A,a),A,NULL,NULL)
+MATAIJMIXED_WRAP(shift,(Mat A,PetscScalar a),(A,a),A,NULL,NULL)
+MATAIJMIXED_WRAP(diagonalset,(Mat A,Vec d,InsertMode is),(A,d,is),A,NULL,NULL)
+MATAIJMIXED_WRAP(zerorowscolumns,(Mat A,PetscInt n,const PetscInt rows[],PetscScalar diag,Vec x,Vec b),(A,n,rows,diag,x,b),A,NULL,NULL)
+MATAIJMIXED_WRAP(setrandom,(Mat A,PetscRandom r),(A,r),A,NULL,NULL)
+MATAIJMIXED_WRAP(getrowij,(Mat A,PetscInt shift,PetscBool sym,PetscBool inodec,PetscInt *n,const PetscInt *ia[],const PetscInt *ja[],PetscBool *done),(A,shift,sym,inodec,n,ia,ja,done),A,NULL,NULL)
+MATAIJMIXED_WRAP(restorerowij,(Mat A,PetscInt shift,PetscBool sym,PetscBool inodec,PetscInt *n,const PetscInt *ia[],const PetscInt *ja[],PetscBool *done),(A,shift,sym,inodec,n,ia,ja,done),A,NULL,NULL)
+MATAIJMIXED_WRAP(getcolumnij,(Mat A,PetscInt shift,PetscBool sym,PetscBool inodec,PetscInt *n,const PetscInt *ia[],const PetscInt *ja[],PetscBool *done),(A,shift,sym,inodec,n,ia,ja,done),A,NULL,NULL)
+MATAIJMIXED_WRAP(restorecolumnij,(Mat A,PetscInt shift,PetscBool sym,PetscBool inodec,PetscInt *n,const PetscInt *ia[],const PetscInt *ja[],PetscBool *done),(A,shift,sym,inodec,n,ia,ja,done),A,NULL,NULL)
+MATAIJMIXED_WRAP(fdcoloringcreate,(Mat A,ISColoring iscoloring,MatFDColoring c),(A,iscoloring,c),A,NULL,NULL)
+MATAIJMIXED_WRAP(coloringpatch,(Mat A,PetscInt nin,PetscInt ncolors,ISColoringValue coloring[],ISColoring *iscoloring),(A,nin,ncolors,coloring,iscoloring),A,NULL,NULL)
+MATAIJMIXED_WRAP(setunfactored,(Mat A),(A),A,NULL,NULL)
+MATAIJMIXED_WRAP(permute,(Mat A,IS row,IS col,Mat *B),(A,row,col,B),A,NULL,NULL)
+MATAIJMIXED_WRAP(setvaluesblocked,(Mat A,PetscInt m,const PetscInt im[],PetscInt n,const PetscInt in[],const PetscScalar v[],InsertMode is),(A,m,im,n,in,v,is),A,NULL,NULL)
+MATAIJMIXED_WRAP(createsubmatrix,(Mat A,IS row,IS col,MatReuse reuse,Mat *B),(A,row,col,reuse,B),A,reuse == MAT_REUSE_MATRIX ? *B : NULL,NULL)
+MATAIJMIXED_WRAP(view,(Mat A,PetscViewer viewer),(A,viewer),A,NULL,NULL)
+MATAIJMIXED_WRAP_PRODUCT(matmatmult,(Mat A,Mat B,Mat C,MatReuse reuse,PetscReal fill,Mat *D),(A,B,C,reuse,fill,D),A,B,C,reuse == MAT_INITIAL_MATRIX ? *D : NULL)
+MATAIJMIXED_WRAP_PRODUCT(matmatmultsymbolic,(Mat A,Mat B,Mat C,PetscReal fill,Mat *D),(A,B,C,fill,D),A,B,C,*D)
+MATAIJMIXED_WRAP(matmatmultnumeric,(Mat A,Mat B,Mat C,Mat D),(A,B,C,D),A,B,C)
+MATAIJMIXED_WRAP(setvalueslocal,(Mat A,PetscInt m,const PetscInt im[],PetscInt n,const PetscInt in[],const PetscScalar v[],InsertMode is),(A,m,im,n,in,v,is),A,NULL,NULL)
+MATAIJMIXED_WRAP(zerorowslocal,(Mat A,PetscInt n,const PetscInt rows[],PetscScalar diag,Vec x,Vec b),(A,n,rows,diag,x,b),A,NULL,NULL)
+MATAIJMIXED_WRAP(getrowmaxabs,(Mat A,Vec v,PetscInt idx[]),(A,v,idx),A,NULL,NULL)
+MATAIJMIXED_WRAP(getrowminabs,(Mat A,Vec v,PetscInt idx[]),(A,v,idx),A,NULL,NULL)
+MATAIJMIXED_WRAP(convert,(Mat A,MatType type,MatReuse reuse,Mat *B),(A,type,reuse,B),A,NULL,NULL)
+MATAIJMIXED_WRAP(fdcoloringapply,(Mat J,MatFDColoring c,Vec x,void *ctx),(J,c,x,ctx),J,NULL,NULL)
+MATAIJMIXED_WRAP(findzerodiagonals,(Mat A,IS *zerorows),(A,zerorows),A,NULL,NULL)
+MATAIJMIXED_WRAP(load,(Mat A,PetscViewer viewer),(A,viewer),A,NULL,NULL)
+MATAIJMIXED_WRAP(issymmetric,(Mat A,PetscReal tol,PetscBool *flg),(A,tol,flg),A,NULL,NULL)
+MATAIJMIXED_WRAP(ishermitian,(Mat A,PetscReal tol,PetscBool *flg),(A,tol,flg),A,NULL,NULL)
+MATAIJMIXED_WRAP(isstructurallysymmetric,(Mat A,PetscBool *flg),(A,flg),A,NULL,NULL)
+MATAIJMIXED_WRAP(setvaluesblockedlocal,(Mat A,PetscInt m,const PetscInt im[],PetscInt n,const PetscInt in[],const PetscScalar v[],InsertMode is),(A,m,im,n,in,v,is),A,NULL,NULL)
+MATAIJMIXED_WRAP_PRODUCT(matmultsymbolic,(Mat A,Mat B,PetscReal fill,Mat *C),(A,B,fill,C),A,B,NULL,*C)
+MATAIJMIXED_WRAP(matmultnumeric,(Mat A,Mat B,Mat C),(A,B,C),A,B,C)
+MATAIJMIXED_WRAP_PRODUCT(ptapsymbolic,(Mat A,Mat P,PetscReal fill,Mat *C),(A,P,fill,C),A,P,NULL,*C)
+MATAIJMIXED_WRAP(ptapnumeric,(Mat A,Mat P,Mat C),(A,P,C),A,P,C)
+MATAIJMIXED_WRAP_PRODUCT(mattransposemult,(Mat A,Mat B,MatReuse reuse,PetscReal fill,Mat *C),(A,B,reuse,fill,C),A,B,NULL,reuse == MAT_INITIAL_MATRIX ? *C : NULL)
+MATAIJMIXED_WRAP_PRODUCT(mattransposemultsymbolic,(Mat A,Mat B,PetscReal fill,Mat *C),(A,B,fill,C),A,B,NULL,*C)
+MATAIJMIXED_WRAP(mattransposemultnumeric,(Mat A,Mat B,Mat C),(A,B,C),A,B,C)
+MATAIJMIXED_WRAP(conjugate,(Mat A),(A),A,NULL,NULL)
+MATAIJMIXED_WRAP(viewnative,(Mat A,PetscViewer viewer),(A,viewer),A,NULL,NULL)
+MATAIJMIXED_WRAP(setvaluesrow,(Mat A,PetscInt row,const PetscScalar v[]),(A,row,v),A,NULL,NULL)
+MATAIJMIXED_WRAP(realpart,(Mat A),(A),A,NULL,NULL)
+MATAIJMIXED_WRAP(imaginarypart,(Mat A),(A),A,NULL,NULL)
+MATAIJMIXED_WRAP(matsolve,(Mat A,Mat B,Mat X),(A,B,X),A,NULL,NULL)
+MATAIJMIXED_WRAP(matsolvetranspose,(Mat A,Mat B,Mat X),(A,B,X),A,NULL,NULL)
+MATAIJMIXED_WRAP(getrowmin,(Mat A,Vec v,PetscInt idx[]),(A,v,idx),A,NULL,NULL)
+MATAIJMIXED_WRAP(getcolumnvector,(Mat A,Vec v,PetscInt col),(A,v,col),A,NULL,NULL)
+MATAIJMIXED_WRAP(missingdiagonal,(Mat A,PetscBool *missing,PetscInt *d),(A,missing,d),A,NULL,NULL)
+MATAIJMIXED_WRAP(getseqnonzerostructure,(Mat A,Mat *B),(A,B),A,NULL,NULL)
+MATAIJMIXED_WRAP(getlocalsubmatrix,(Mat A,IS row,IS col,Mat *B),(A,row,col,B),A,NULL,NULL)
+MATAIJMIXED_WRAP(multdiagonalblock,(Mat A,Vec x,Vec y),(A,x,y),A,NULL,NULL)
+MATAIJMIXED_WRAP(hermitiantranspose,(Mat A,MatReuse reuse,Mat *B),(A,reuse,B),A,reuse == MAT_REUSE_MATRIX ? *B : NULL,NULL)
+MATAIJMIXED_WRAP(getmultiprocblock,(Mat A,MPI_Comm comm,MatReuse reuse,Mat *B),(A,comm,reuse,B),A,reuse == MAT_REUSE_MATRIX ? *B : NULL,NULL)
+MATAIJMIXED_WRAP(findnonzerorows,(Mat A,IS *keptrows),(A,keptrows),A,NULL,NULL)
+MATAIJMIXED_WRAP(getcolumnnorms,(Mat A,NormType type,PetscReal *norms),(A,type,norms),A,NULL,NULL)
+MATAIJMIXED_WRAP(invertblockdiagonal,(Mat A,const PetscScalar **values),(A,values),A,NULL,NULL)
+MATAIJMIXED_WRAP(invertvariableblockdiagonal,(Mat A,PetscInt nblocks,const PetscInt *bsizes,PetscScalar *diag),(A,nblocks,bsizes,diag),A,NULL,NULL)
+MATAIJMIXED_WRAP(setvaluesbatch,(Mat A,PetscInt nb,PetscInt bs,PetscInt *rows,const PetscScalar *v),(A,nb,bs,rows,v),A,NULL,NULL)
+MATAIJMIXED_WRAP_PRODUCT(transposematmultsymbolic,(Mat A,Mat B,PetscReal fill,Mat *C),(A,B,fill,C),A,B,NULL,*C)
+MATAIJMIXED_WRAP(transposematmultnumeric,(Mat A,Mat B,Mat C),(A,B,C),A,B,C)
+MATAIJMIXED_WRAP(transposecoloringcreate,(Mat A,ISColoring iscoloring,MatTransposeColoring c),(A,iscoloring,c),A,NULL,NULL)
+MATAIJMIXED_WRAP(transcoloringapplysptoden,(MatTransposeColoring c,Mat B,Mat Btdense),(c,B,Btdense),B,NULL,NULL)
+MATAIJMIXED_WRAP(transcoloringapplydentosp,(MatTransposeColoring c,Mat Cden,Mat Csp),(c,Cden,Csp),Csp,NULL,NULL)
+MATAIJMIXED_WRAP_PRODUCT(rart,(Mat A,Mat R,MatReuse reuse,PetscReal fill,Mat *C),(A,R,reuse,fill,C),A,R,NULL,reuse == MAT_INITIAL_MATRIX ? *C : NULL)
+MATAIJMIXED_WRAP_PRODUCT(rartsymbolic,(Mat A,Mat R,PetscReal fill,Mat *C),(A,R,fill,C),A,R,NULL,*C)
+MATAIJMIXED_WRAP(rartnumeric,(Mat A,Mat R,Mat C),(A,R,C),A,R,C)
+MATAIJMIXED_WRAP(aypx,(Mat Y,PetscScalar a,Mat X,MatStructure str),(Y,a,X,str),Y,X,NULL)
+MATAIJMIXED_WRAP(fdcoloringsetup,(Mat A,ISColoring iscoloring,MatFDColoring c),(A,iscoloring,c),A,NULL,NULL)
+MATAIJMIXED_WRAP(findoffblockdiagonalentries,(Mat A,IS *is),(A,is),A,NULL,NULL)
+MATAIJMIXED_WRAP(creatempimatconcatenateseqmat,(MPI_Comm comm,Mat inmat,PetscInt n,MatReuse reuse,Mat *outmat),(comm,inmat,n,reuse,outmat),inmat,reuse == MAT_REUSE_MATRIX ? *outmat : NULL,NULL)
+MATAIJMIXED_WRAP(mattransposesolve,(Mat A,Mat B,Mat X),(A,B,X),A,NULL,NULL)
+MATAIJMIXED_WRAP(getvalueslocal,(Mat A,PetscInt m,const PetscInt im[],PetscInt n,const PetscInt in[],PetscScalar v[]),(A,m,im,n,in,v),A,NULL,NULL)
+
+static PetscErrorCode MatAIJMixed_createsubmatrices(Mat A,PetscInt n,const IS irow[],const IS icol[],MatReuse scall,Mat *submat[])
+{
+  PetscErrorCode ierr;
+  struct _MatOps *ops;
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedPrepare_Private(A,NULL,NULL,&ops);CHKERRQ(ierr);
+  if (scall == MAT_REUSE_MATRIX) {
+    for (i=0; i<n; i++) {ierr = MatAIJMixedExpand_Private((*submat)[i]);CHKERRQ(ierr);}
+  }
+  ierr = (*ops->createsubmatrices)(A,n,irow,icol,scall,submat);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatAIJMixed_createsubmatricesmpi(Mat A,PetscInt n,const IS irow[],const IS icol[],MatReuse scall,Mat *submat[])
+{
+  PetscErrorCode ierr;
+  struct _MatOps *ops;
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedPrepare_Private(A,NULL,NULL,&ops);CHKERRQ(ierr);
+  if (scall == MAT_REUSE_MATRIX) {
+    for (i=0; i<n; i++) {ierr = MatAIJMixedExpand_Private((*submat)[i]);CHKERRQ(ierr);}
+  }
+  ierr = (*ops->createsubmatricesmpi)(A,n,irow,icol,scall,submat);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   The products dispatch on the base types: the operation of the base type when both operands share it, otherwise the
+   function composed for the pair of base types, as MatMatMult(), MatTransposeMatMult() and MatPtAP() do
+*/
+static PetscErrorCode MatAIJMixedGetBase_Private(Mat X,MatType *type,struct _MatOps **ops)
+{
+  PetscErrorCode ierr;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompareAny((PetscObject)X,&flg,MATSEQAIJMIXED,MATMPIAIJMIXED,"");CHKERRQ(ierr);
+  if (flg && X->spptr) {
+    Mat_AIJMixed *mixed = (Mat_AIJMixed*)X->spptr;
+
+    ierr  = (*mixed->expand)(X);CHKERRQ(ierr);
+    *type = mixed->basetype;
+    *ops  = &mixed->ops;
+  } else {
+    *type = ((PetscObject)X)->type_name;
+    *ops  = X->ops;
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatAIJMixedProductName_Private(const char prod[],MatType ta,MatType tb,char name[],size_t len)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscStrncpy(name,prod,len);CHKERRQ(ierr);
+  ierr = PetscStrlcat(name,"_",len);CHKERRQ(ierr);
+  ierr = PetscStrlcat(name,ta,len);CHKERRQ(ierr);
+  ierr = PetscStrlcat(name,"_",len);CHKERRQ(ierr);
+  ierr = PetscStrlcat(name,tb,len);CHKERRQ(ierr);
+  ierr = PetscStrlcat(name,"_C",len);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatAIJMixed_matmult(Mat A,Mat B,MatReuse scall,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr,(*mult)(Mat,Mat,MatReuse,PetscReal,Mat*) = NULL;
+  struct _MatOps *opsA,*opsB;
+  MatType        ta,tb;
+  char           name[256];
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedGetBase_Private(A,&ta,&opsA);CHKERRQ(ierr);
+  ierr = MatAIJMixedGetBase_Private(B,&tb,&opsB);CHKERRQ(ierr);
+  if (opsA->matmult && opsA->matmult == opsB->matmult) mult = opsA->matmult;
+  else {
+    ierr = MatAIJMixedProductName_Private("MatMatMult",ta,tb,name,sizeof(name));CHKERRQ(ierr);
+    ierr = PetscObjectQueryFunction((PetscObject)B,name,&mult);CHKERRQ(ierr);
+    if (!mult) {ierr = PetscObjectQueryFunction((PetscObject)A,name,&mult);CHKERRQ(ierr);}
+    if (!mult) SETERRQ2(PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"MatMatMult requires A, %s, to be compatible with B, %s",ta,tb);
+  }
+  ierr = (*mult)(A,B,scall,fill,C);CHKERRQ(ierr);
+  if (scall == MAT_INITIAL_MATRIX) {ierr = MatAIJMixedProductWrap_Private(*C);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatAIJMixed_transposematmult(Mat A,Mat B,MatReuse scall,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr,(*mult)(Mat,Mat,MatReuse,PetscReal,Mat*) = NULL;
+  struct _MatOps *opsA,*opsB;
+  MatType        ta,tb;
+  char           name[256];
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedGetBase_Private(A,&ta,&opsA);CHKERRQ(ierr);
+  ierr = MatAIJMixedGetBase_Private(B,&tb,&opsB);CHKERRQ(ierr);
+  if (opsA->transposematmult && opsA->transposematmult == opsB->transposematmult) mult = opsA->transposematmult;
+  else {
+    ierr = MatAIJMixedProductName_Private("MatTransposeMatMult",ta,tb,name,sizeof(name));CHKERRQ(ierr);
+    ierr = PetscObjectQueryFunction((PetscObject)B,name,&mult);CHKERRQ(ierr);
+    if (!mult) {ierr = PetscObjectQueryFunction((PetscObject)A,name,&mult);CHKERRQ(ierr);}
+    if (!mult) SETERRQ2(PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_INCOMP,"MatTransposeMatMult requires A, %s, to be compatible with B, %s",ta,tb);
+  }
+  ierr = (*mult)(A,B,scall,fill,C);CHKERRQ(ierr);
+  if (scall == MAT_INITIAL_MATRIX) {ierr = MatAIJMixedProductWrap_Private(*C);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatAIJMixed_ptap(Mat A,Mat P,MatReuse scall,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr,(*ptap)(Mat,Mat,MatReuse,PetscReal,Mat*) = NULL;
+  struct _MatOps *opsA,*opsP;
+  MatType        ta,tp;
+  PetscBool      sametype;
+  char           name[256];
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedGetBase_Private(A,&ta,&opsA);CHKERRQ(ierr);
+  ierr = MatAIJMixedGetBase_Private(P,&tp,&opsP);CHKERRQ(ierr);
+  ierr = PetscStrcmp(ta,tp,&sametype);CHKERRQ(ierr);
+  if (opsA->ptap && opsA->ptap == opsP->ptap && sametype) ptap = opsA->ptap;
+  else {
+    ierr = MatAIJMixedProductName_Private("MatPtAP",ta,tp,name,sizeof(name));CHKERRQ(ierr);
+    ierr = PetscObjectQueryFunction((PetscObject)P,name,&ptap);CHKERRQ(ierr);
+    if (!ptap) {ierr = PetscObjectQueryFunction((PetscObject)A,name,&ptap);CHKERRQ(ierr);}
+  }
+  if (!ptap) ptap = MatPtAP_Basic;
+  ierr = (*ptap)(A,P,scall,fill,C);CHKERRQ(ierr);
+  if (scall == MAT_INITIAL_MATRIX) {ierr = MatAIJMixedProductWrap_Private(*C);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+/* all the wrapped operations, the others are either implemented on the reduced storage or do not read it */
+#define MATAIJMIXED_OPS(_) \
+  _(setvalues) _(getrow) _(restorerow) _(solveadd) _(solvetranspose) _(solvetransposeadd) _(lufactor) _(choleskyfactor) \
+  _(transpose) _(equal) _(diagonalscale) _(norm) _(assemblyend) _(zeroentries) _(zerorows) _(forwardsolve) _(backwardsolve) \
+  _(ilufactor) _(iccfactor) _(axpy) _(createsubmatrices) _(increaseoverlap) _(getvalues) _(copy) _(getrowmax) _(scale) \
+  _(shift) _(diagonalset) _(zerorowscolumns) _(setrandom) _(getrowij) _(restorerowij) _(getcolumnij) _(restorecolumnij) \
+  _(fdcoloringcreate) _(coloringpatch) _(setunfactored) _(permute) _(setvaluesblocked) _(createsubmatrix) _(view) \
+  _(matmatmult) _(matmatmultsymbolic) _(matmatmultnumeric) _(setvalueslocal) _(zerorowslocal) _(getrowmaxabs) \
+  _(getrowminabs) _(convert) _(fdcoloringapply) _(findzerodiagonals) _(load) _(issymmetric) _(ishermitian) \
+  _(isstructurallysymmetric) _(setvaluesblockedlocal) _(matmult) _(matmultsymbolic) _(matmultnumeric) _(ptap) \
+  _(ptapsymbolic) _(ptapnumeric) _(mattransposemult) _(mattransposemultsymbolic) _(mattransposemultnumeric) _(conjugate) \
+  _(viewnative) _(setvaluesrow) _(realpart) _(imaginarypart) _(matsolve) _(matsolvetranspose) _(getrowmin) \
+  _(getcolumnvector) _(missingdiagonal) _(getseqnonzerostructure) _(getlocalsubmatrix) _(multdiagonalblock) \
+  _(hermitiantranspose) _(getmultiprocblock) _(findnonzerorows) _(getcolumnnorms) _(invertblockdiagonal) \
+  _(invertvariableblockdiagonal) _(createsubmatricesmpi) _(setvaluesbatch) _(transposematmult) \
+  _(transposematmultsymbolic) _(transposematmultnumeric) _(transposecoloringcreate) _(transcoloringapplysptoden) \
+  _(transcoloringapplydentosp) _(rart) _(rartsymbolic) _(rartnumeric) _(aypx) _(fdcoloringsetup) \
+  _(findoffblockdiagonalentries) _(creatempimatconcatenateseqmat) _(mattransposesolve) _(getvalueslocal)
+
+#define MATAIJMIXED_INSTALL(op) \
+  if (A->ops->op && A->ops->op != MatAIJMixed_##op) { \
+    mixed->ops.op = A->ops->op; \
+    A->ops->op    = MatAIJMixed_##op; \
+  }
+
+#define MATAIJMIXED_UNINSTALL(op) \
+  if (A->ops->op == MatAIJMixed_##op) A->ops->op = mixed->ops.op;
+
+static PetscErrorCode MatAIJMixedComposeProducts_Private(Mat A,MatType mtype,PetscBool set)
+{
+  Mat_AIJMixed   *mixed = (Mat_AIJMixed*)A->spptr;
+  MatType        btype  = mixed->basetype,dtype;
+  PetscBool      seq;
+  char           name[256];
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr  = PetscStrcmp(btype,MATSEQAIJ,&seq);CHKERRQ(ierr);
+  dtype = seq ? MATSEQDENSE : MATMPIDENSE;
+  ierr  = MatAIJMixedProductName_Private("MatMatMult",mtype,btype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_matmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatMatMult",btype,mtype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_matmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatMatMult",mtype,dtype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_matmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatMatMult",dtype,mtype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_matmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatTransposeMatMult",mtype,btype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_transposematmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatTransposeMatMult",btype,mtype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_transposematmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatTransposeMatMult",mtype,dtype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_transposematmult : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatPtAP",mtype,btype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_ptap : NULL);CHKERRQ(ierr);
+  ierr  = MatAIJMixedProductName_Private("MatPtAP",btype,mtype,name,sizeof(name));CHKERRQ(ierr);
+  ierr  = PetscObjectComposeFunction((PetscObject)A,name,set ? MatAIJMixed_ptap : NULL);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Replaces the operations of A that read the storage of its base type by the wrappers, saving them in the
+   Mat_AIJMixed of A; also used after the operations were set again, for example by a numeric factorization.
+   mtype is the name of the mixed type, used by the products with matrices of the base type.
+*/
+PetscErrorCode MatAIJMixedWrapOperations_Private(Mat A,MatType mtype)
+{
+  Mat_AIJMixed   *mixed = (Mat_AIJMixed*)A->spptr;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  MATAIJMIXED_OPS(MATAIJMIXED_INSTALL)
+  if (!A->factortype) {ierr = MatAIJMixedComposeProducts_Private(A,mtype,PETSC_TRUE);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatAIJMixedUnwrapOperations_Private(Mat A,MatType mtype)
+{
+  Mat_AIJMixed   *mixed = (Mat_AIJMixed*)A->spptr;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  MATAIJMIXED_OPS(MATAIJMIXED_UNINSTALL)
+  ierr = MatAIJMixedComposeProducts_Private(A,mtype,PETSC_FALSE);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* The composed functions of MATSEQAIJ that read its storage, wrapped in the same way */
+#define MATSEQAIJMIXED_COMPOSED(f,decl,args,X,Y) \
+static PetscErrorCode f##_SeqAIJMixed decl \
+{ \
+  PetscErrorCode ierr; \
+  PetscFunctionBegin; \
+  ierr = MatAIJMixedExpand_Private(X);CHKERRQ(ierr); \
+  ierr = MatAIJMixedExpand_Private(Y);CHKERRQ(ierr); \
+  ierr = f##_SeqAIJ args;CHKERRQ(ierr); \
+  PetscFunctionReturn(0); \
+}
+
+MATSEQAIJMIXED_COMPOSED(MatSeqAIJGetArray,(Mat A,PetscScalar *array[]),(A,array),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatSeqAIJSetColumnIndices,(Mat A,PetscInt *indices),(A,indices),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatStoreValues,(Mat A),(A),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatRetrieveValues,(Mat A),(A),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatIsTranspose,(Mat A,Mat B,PetscReal tol,PetscBool *f),(A,B,tol,f),A,B)
+MATSEQAIJMIXED_COMPOSED(MatSeqAIJSetPreallocation,(Mat A,PetscInt nz,const PetscInt nnz[]),(A,nz,nnz),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatResetPreallocation,(Mat A),(A),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatSeqAIJSetPreallocationCSR,(Mat A,const PetscInt i[],const PetscInt j[],const PetscScalar v[]),(A,i,j,v),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatSetPreallocationCOO,(Mat A,PetscInt n,const PetscInt i[],const PetscInt j[]),(A,n,i,j),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatSetValuesCOO,(Mat A,const PetscScalar v[],InsertMode imode),(A,v,imode),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatReorderForNonzeroDiagonal,(Mat A,PetscReal abstol,IS ris,IS cis),(A,abstol,ris,cis),A,NULL)
+MATSEQAIJMIXED_COMPOSED(MatSeqAIJSetNumThreads,(Mat A,PetscInt nthreads),(A,nthreads),A,NULL)
+
+static PetscErrorCode MatSeqAIJMixedComposeFunctions_Private(Mat A,PetscBool mixed)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJGetArray_C",mixed ? MatSeqAIJGetArray_SeqAIJMixed : MatSeqAIJGetArray_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJSetColumnIndices_C",mixed ? MatSeqAIJSetColumnIndices_SeqAIJMixed : MatSeqAIJSetColumnIndices_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatStoreValues_C",mixed ? MatStoreValues_SeqAIJMixed : MatStoreValues_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatRetrieveValues_C",mixed ? MatRetrieveValues_SeqAIJMixed : MatRetrieveValues_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatIsTranspose_C",mixed ? MatIsTranspose_SeqAIJMixed : MatIsTranspose_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatIsHermitianTranspose_C",mixed ? MatIsTranspose_SeqAIJMixed : MatIsTranspose_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJSetPreallocation_C",mixed ? MatSeqAIJSetPreallocation_SeqAIJMixed : MatSeqAIJSetPreallocation_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatResetPreallocation_C",mixed ? MatResetPreallocation_SeqAIJMixed : MatResetPreallocation_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJSetPreallocationCSR_C",mixed ? MatSeqAIJSetPreallocationCSR_SeqAIJMixed : MatSeqAIJSetPreallocationCSR_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSetPreallocationCOO_C",mixed ? MatSetPreallocationCOO_SeqAIJMixed : MatSetPreallocationCOO_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSetValuesCOO_C",mixed ? MatSetValuesCOO_SeqAIJMixed : MatSetValuesCOO_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatReorderForNonzeroDiagonal_C",mixed ? MatReorderForNonzeroDiagonal_SeqAIJMixed : MatReorderForNonzeroDiagonal_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatSeqAIJSetNumThreads_C",mixed ? MatSeqAIJSetNumThreads_SeqAIJMixed : MatSeqAIJSetNumThreads_SeqAIJ);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaijmixed_seqaij_C",mixed ? MatConvert_SeqAIJMixed_SeqAIJ : NULL);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   The numeric LU and ILU factorizations run on the MATSEQAIJ storage of both matrices; the factor then moves to the
+   reduced storage if its solve is the standard or the level-scheduled one, which are replaced by the versions above
+*/
+static PetscErrorCode MatLUFactorNumeric_SeqAIJMixed(Mat B,Mat A,const MatFactorInfo *info)
+{
+  Mat_SeqAIJ      *b     = (Mat_SeqAIJ*)B->data;
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)B->spptr;
+  PetscErrorCode  ierr;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJMixedExpand_Private(B);CHKERRQ(ierr);
+  ierr = (*mixed->lufactornumeric)(B,A,info);CHKERRQ(ierr);
+  ierr = MatAIJMixedWrapOperations_Private(B,MATSEQAIJMIXED);CHKERRQ(ierr);
+  if (b->levels.lstart[0]) {
+    B->ops->solve = MatSolve_SeqAIJMixed_Levels;
+  } else if (B->ops->solve == MatSolve_SeqAIJ || B->ops->solve == MatSolve_SeqAIJ_NaturalOrdering) {
+    B->ops->solve = MatSolve_SeqAIJMixed;
+  } else PetscFunctionReturn(0);
+  ierr = MatSeqAIJMixedCompress_Private(B);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatLUFactorSymbolic_SeqAIJMixed(Mat B,Mat A,IS isrow,IS iscol,const MatFactorInfo *info)
+{
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)B->spptr;
+  PetscErrorCode  ierr;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJMixedExpand_Private(B);CHKERRQ(ierr);
+  ierr = MatLUFactorSymbolic_SeqAIJ(B,A,isrow,iscol,info);CHKERRQ(ierr);
+  mixed->lufactornumeric  = B->ops->lufactornumeric;
+  B->ops->lufactornumeric = MatLUFactorNumeric_SeqAIJMixed;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatILUFactorSymbolic_SeqAIJMixed(Mat B,Mat A,IS isrow,IS iscol,const MatFactorInfo *info)
+{
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)B->spptr;
+  PetscErrorCode  ierr;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatSeqAIJMixedExpand_Private(B);CHKERRQ(ierr);
+  ierr = MatILUFactorSymbolic_SeqAIJ(B,A,isrow,iscol,info);CHKERRQ(ierr);
+  mixed->lufactornumeric  = B->ops->lufactornumeric;
+  B->ops->lufactornumeric = MatLUFactorNumeric_SeqAIJMixed;
+  PetscFunctionReturn(0);
+}
+
+/* Cholesky and ICC factors are MATSEQAIJ matrices; only the reads of the factored matrix are wrapped */
+static PetscErrorCode MatCholeskyFactorNumeric_SeqAIJMixed(Mat B,Mat A,const MatFactorInfo *info)
+{
+  PetscErrorCode ierr,(*f)(Mat,Mat,const MatFactorInfo*);
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = PetscObjectQueryFunction((PetscObject)B,"MatCholeskyFactorNumeric_seqaijmixed_C",&f);CHKERRQ(ierr);
+  ierr = (*f)(B,A,info);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatCholeskyFactorSymbolic_SeqAIJMixed(Mat B,Mat A,IS perm,const MatFactorInfo *info)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatCholeskyFactorSymbolic_SeqAIJ(B,A,perm,info);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatCholeskyFactorNumeric_seqaijmixed_C",B->ops->choleskyfactornumeric);CHKERRQ(ierr);
+  B->ops->choleskyfactornumeric = MatCholeskyFactorNumeric_SeqAIJMixed;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatICCFactorSymbolic_SeqAIJMixed(Mat B,Mat A,IS perm,const MatFactorInfo *info)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatICCFactorSymbolic_SeqAIJ(B,A,perm,info);CHKERRQ(ierr);
+  ierr = PetscObjectComposeFunction((PetscObject)B,"MatCholeskyFactorNumeric_seqaijmixed_C",B->ops->choleskyfactornumeric);CHKERRQ(ierr);
+  B->ops->choleskyfactornumeric = MatCholeskyFactorNumeric_SeqAIJMixed;
+  PetscFunctionReturn(0);
+}
+
+/*
+   The LU and ILU factors of a MATSEQAIJMIXED matrix are MATSEQAIJMIXED matrices whose triangular solves use the
+   reduced storage; Cholesky and ICC factors are the usual MATSEQAIJ ones.
+*/
+PETSC_INTERN PetscErrorCode MatGetFactor_seqaijmixed_petsc(Mat A,MatFactorType ftype,Mat *B)
+{
+  PetscErrorCode ierr;
+  PetscBool      mixed;
+
+  PetscFunctionBegin;
+  ierr = MatGetFactor_seqaij_petsc(A,ftype,B);CHKERRQ(ierr);
+  if (ftype == MAT_FACTOR_LU || ftype == MAT_FACTOR_ILU) {
+    ierr = PetscObjectTypeCompare((PetscObject)*B,MATSEQAIJMIXED,&mixed);CHKERRQ(ierr);
+    if (!mixed) {ierr = MatConvert_SeqAIJ_SeqAIJMixed(*B,MATSEQAIJMIXED,MAT_INPLACE_MATRIX,B);CHKERRQ(ierr);}
+    (*B)->ops->lufactorsymbolic  = MatLUFactorSymbolic_SeqAIJMixed;
+    (*B)->ops->ilufactorsymbolic = MatILUFactorSymbolic_SeqAIJMixed;
+  } else {
+    (*B)->ops->choleskyfactorsymbolic = MatCholeskyFactorSymbolic_SeqAIJMixed;
+    (*B)->ops->iccfactorsymbolic      = MatICCFactorSymbolic_SeqAIJMixed;
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatAssemblyEnd_SeqAIJMixed(Mat A,MatAssemblyType mode)
+{
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (mode == MAT_FLUSH_ASSEMBLY) PetscFunctionReturn(0);
+
+  /* the inode kernels would replace the MatMult() and MatSOR() that use the reduced storage */
+  a->inode.use = PETSC_FALSE;
+  ierr         = MatAssemblyEnd_SeqAIJ(A,mode);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatDestroy_SeqAIJMixed(Mat A)
+{
+  PetscErrorCode  ierr;
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)A->spptr;
+
+  PetscFunctionBegin;
+  if (mixed) {
+    /* If MatHeaderMerge() was used then this SeqAIJMixed matrix will not have a spptr. */
+    ierr = PetscFree(mixed->a);CHKERRQ(ierr);
+    if (!mixed->sharedj) {ierr = PetscFree(mixed->j);CHKERRQ(ierr);}
+    ierr = MatDestroy(&mixed->owner);CHKERRQ(ierr);
+    ierr = PetscFree(A->spptr);CHKERRQ(ierr);
+  }
+  ierr = PetscObjectComposeFunction((PetscObject)A,"MatConvert_seqaijmixed_seqaij_C",NULL);CHKERRQ(ierr);
+  ierr = PetscObjectChangeTypeName((PetscObject)A,MATSEQAIJ);CHKERRQ(ierr);
+  ierr = MatDestroy_SeqAIJ(A);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatDuplicate_SeqAIJMixed(Mat A,MatDuplicateOption op,Mat *M)
+{
+  Mat_SeqAIJMixed *mixed = (Mat_SeqAIJMixed*)A->spptr;
+  PetscBool       compressed = mixed->compressed;
+  PetscErrorCode  ierr;
+
+  PetscFunctionBegin;
+  ierr = MatSeqAIJMixedExpand_Private(A);CHKERRQ(ierr);
+  ierr = MatDuplicate_SeqAIJ(A,op,M);CHKERRQ(ierr);
+  if (compressed) {ierr = MatSeqAIJMixedCompress_Private(A);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+PETSC_INTERN PetscErrorCode MatConvert_SeqAIJMixed_SeqAIJ(Mat A,MatType type,MatReuse reuse,Mat *newmat)
+{
+  PetscErrorCode ierr;
+  Mat            B = *newmat;
+
+  PetscFunctionBegin;
+  if (reuse == MAT_INITIAL_MATRIX) {
+    ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  }
+  ierr = MatSeqAIJMixedExpand_Private(B);CHKERRQ(ierr);
+  if (((Mat_SeqAIJMixed*)B->spptr)->owner) {
+    Mat_SeqAIJ *b = (Mat_SeqAIJ*)B->data;
+    PetscInt   m = B->rmap->n,*i,*j;
+
+    /* the MATSEQAIJ matrix gets its own copy of the borrowed structure */
+    ierr = PetscMalloc1(m+1,&i);CHKERRQ(ierr);
+    ierr = PetscMalloc1(b->i[m],&j);CHKERRQ(ierr);
+    ierr = PetscArraycpy(i,b->i,m+1);CHKERRQ(ierr);
+    ierr = PetscArraycpy(j,b->j,b->i[m]);CHKERRQ(ierr);
+    b->i       = i;
+    b->j       = j;
+    b->free_ij = PETSC_TRUE;
+    ierr = MatDestroy(&((Mat_SeqAIJMixed*)B->spptr)->owner);CHKERRQ(ierr);
+  }
+  ierr = MatAIJMixedUnwrapOperations_Private(B,MATSEQAIJMIXED);CHKERRQ(ierr);
+
+  /* Reset the original function pointers. */
+  B->ops->assemblyend      = MatAssemblyEnd_SeqAIJ;
+  B->ops->destroy          = MatDestroy_SeqAIJ;
+  B->ops->duplicate        = MatDuplicate_SeqAIJ;
+  B->ops->mult             = MatMult_SeqAIJ;
+  B->ops->multadd          = MatMultAdd_SeqAIJ;
+  B->ops->multtranspose    = MatMultTranspose_SeqAIJ;
+  B->ops->multtransposeadd = MatMultTransposeAdd_SeqAIJ;
+  B->ops->getdiagonal      = MatGetDiagonal_SeqAIJ;
+  B->ops->sor              = MatSOR_SeqAIJ;
+  if (B->ops->solve == MatSolve_SeqAIJMixed || B->ops->solve == MatSolve_SeqAIJMixed_Levels) B->ops->solve = MatSolve_SeqAIJ;
+
+  ierr = MatSeqAIJMixedComposeFunctions_Private(B,PETSC_FALSE);CHKERRQ(ierr);
+  ierr = PetscFree(B->spptr);CHKERRQ(ierr);
+
+  /* the inode routines are considered again at the next assembly */
+  ((Mat_SeqAIJ*)B->data)->inode.use = PETSC_TRUE;
+  ierr = PetscObjectChangeTypeName((PetscObject)B,MATSEQAIJ);CHKERRQ(ierr);
+  *newmat = B;
+  PetscFunctionReturn(0);
+}
+
+/* MatConvert_SeqAIJ_SeqAIJMixed converts a SeqAIJ matrix into a
+ * SeqAIJMixed matrix.  This routine is called by the MatCreate_SeqAIJMixed()
+ * routine, but can also be used to convert an assembled SeqAIJ matrix
+ * into a SeqAIJMixed one; the storage is reduced by the first kernel that runs. */
+PETSC_INTERN PetscErrorCode MatConvert_SeqAIJ_SeqAIJMixed(Mat A,MatType type,MatReuse reuse,Mat *newmat)
+{
+  PetscErrorCode  ierr;
+  Mat             B = *newmat;
+  Mat_SeqAIJMixed *mixed;
+  PetscBool       sametype;
+
+  PetscFunctionBegin;
+  if (reuse == MAT_INITIAL_MATRIX) {
+    ierr = MatDuplicate(A,MAT_COPY_VALUES,&B);CHKERRQ(ierr);
+  }
+  ierr = PetscObjectTypeCompare((PetscObject)A,type,&sametype);CHKERRQ(ierr);
+  if (sametype) PetscFunctionReturn(0);
+
+  ierr            = PetscNewLog(B,&mixed);CHKERRQ(ierr);
+  B->spptr        = (void*)mixed;
+  mixed->basetype = MATSEQAIJ;
+  mixed->expand   = MatSeqAIJMixedExpand_Private;
+
+  /* Set function pointers for methods that we inherit from AIJ but override, then wrap the others */
+  B->ops->duplicate   = MatDuplicate_SeqAIJMixed;
+  B->ops->assemblyend = MatAssemblyEnd_SeqAIJMixed;
+  B->ops->destroy     = MatDestroy_SeqAIJMixed;
+  ierr = MatAIJMixedWrapOperations_Private(B,MATSEQAIJMIXED);CHKERRQ(ierr);
+  B->ops->mult             = MatMult_SeqAIJMixed;
+  B->ops->multadd          = MatMultAdd_SeqAIJMixed;
+  B->ops->multtranspose    = MatMultTranspose_SeqAIJMixed;
+  B->ops->multtransposeadd = MatMultTransposeAdd_SeqAIJMixed;
+  B->ops->getdiagonal      = MatGetDiagonal_SeqAIJMixed;
+  B->ops->sor              = MatSOR_SeqAIJMixed;
+  ((Mat_SeqAIJ*)B->data)->inode.use = PETSC_FALSE;
+
+  ierr = MatSeqAIJMixedComposeFunctions_Private(B,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscObjectChangeTypeName((PetscObject)B,MATSEQAIJMIXED);CHKERRQ(ierr);
+  *newmat = B;
+  PetscFunctionReturn(0);
+}
+
+/*
+   MatSeqAIJMixedDemote_Private - Gives B the values of the assembled MATSEQAIJ matrix A in single precision
+
+   With MAT_INITIAL_MATRIX, B is a new MATSEQAIJMIXED matrix created directly in the reduced storage: it borrows the
+   row offsets and the column indices of A, which it references, and only stores its values (and its column indices
+   when PetscInt has 64 bits). With MAT_REUSE_MATRIX only the values of B are refreshed, A must be the matrix B
+   borrows from with the same nonzero structure, otherwise B is updated with MatCopy(). No double precision copy of
+   A is made, so B adds 4 bytes per nonzero to the footprint of A.
+*/
+PetscErrorCode MatSeqAIJMixedDemote_Private(Mat A,MatReuse reuse,Mat *B)
+{
+  Mat_SeqAIJ      *a = (Mat_SeqAIJ*)A->data,*b;
+  Mat_SeqAIJMixed *mixed;
+  PetscErrorCode  ierr;
+  PetscInt        m = A->rmap->n,nz = a->i[A->rmap->n];
+
+  PetscFunctionBegin;
+  if (!A->assembled) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"Not for unassembled matrix");
+  if (reuse == MAT_REUSE_MATRIX) {
+    mixed = (Mat_SeqAIJMixed*)(*B)->spptr;
+    if (mixed->owner == A && mixed->compressed && A->nonzerostate == mixed->ownernzstate) {
+      ierr = MatSeqAIJMixedRound_Private(*B,nz,a->a,NULL);CHKERRQ(ierr);
+      ierr = MatSeqAIJInvalidateDiagonal(*B);CHKERRQ(ierr);
+      ierr = PetscObjectStateIncrease((PetscObject)*B);CHKERRQ(ierr);
+    } else {
+      ierr = MatCopy(A,*B,SAME_NONZERO_PATTERN);CHKERRQ(ierr);
+    }
+    PetscFunctionReturn(0);
+  }
+  if (A->cmap->n > PETSC_MPI_INT_MAX) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_SUP,"Column indices of a matrix with %D columns do not fit in 32 bits",A->cmap->n);
+  ierr = MatCreate(PetscObjectComm((PetscObject)A),B);CHKERRQ(ierr);
+  ierr = MatSetSizes(*B,m,A->cmap->n,m,A->cmap->n);CHKERRQ(ierr);
+  ierr = MatSetBlockSizesFromMats(*B,A,A);CHKERRQ(ierr);
+  ierr = MatSetType(*B,MATSEQAIJ);CHKERRQ(ierr);
+  ierr = MatDuplicateNoCreate_SeqAIJ(*B,A,MAT_DO_NOT_COPY_VALUES,PETSC_FALSE);CHKERRQ(ierr);
+  b               = (Mat_SeqAIJ*)(*B)->data;
+  b->i            = a->i;
+  b->j            = a->j;
+  b->singlemalloc = PETSC_FALSE;
+  b->free_ij      = PETSC_FALSE;
+  ierr  = MatConvert_SeqAIJ_SeqAIJMixed(*B,MATSEQAIJMIXED,MAT_INPLACE_MATRIX,B);CHKERRQ(ierr);
+  mixed = (Mat_SeqAIJMixed*)(*B)->spptr;
+  ierr  = PetscObjectReference((PetscObject)A);CHKERRQ(ierr);
+  mixed->owner        = A;
+  mixed->ownernzstate = A->nonzerostate;
+  ierr = PetscMalloc1(nz,&mixed->a);CHKERRQ(ierr);
+#if !defined(PETSC_USE_64BIT_INDICES)
+  mixed->sharedj = PETSC_TRUE;
+  mixed->j       = (int*)a->j;
+#else
+  ierr = PetscMalloc1(nz,&mixed->j);CHKERRQ(ierr);
+#endif
+  ierr = MatSeqAIJMixedRound_Private(*B,nz,a->a,mixed->sharedj ? NULL : a->j);CHKERRQ(ierr);
+  mixed->nz         = nz;
+  mixed->compressed = PETSC_TRUE;
+  ierr = PetscInfo2(*B,"Matrix with %D nonzeros in single precision sharing the structure of its double precision original, %D rows\n",nz,m);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   MatCreateSeqAIJMixed - Creates a sparse matrix of type MATSEQAIJMIXED.
+   This type inherits from AIJ and, once its kernels are used, only stores
+   the values in single precision and the column indices in 32 bit integers.
+   As with the AIJ type, it is important to preallocate matrix storage in
+   order to get good assembly performance.
+
+   Collective
+
+   Input Parameters:
++  comm - MPI communicator, set to PETSC_COMM_SELF
+.  m - number of rows
+.  n - number of columns
+.  nz - number of nonzeros per row (same for all rows)
+-  nnz - array containing the number of nonzeros in the various rows
+         (possibly different for each row) or NULL
+
+   Output Parameter:
+.  A - the matrix
+
+   Notes:
+   If nnz is given then nz is ignored
+
+   The products and solves accumulate in PetscScalar, so only the precision of the matrix entries is reduced. This is
+   intended for the operators of inner solves, for example those of KSPIR with -ksp_ir_demote.
+
+   Level: intermediate
+
+.seealso: MatCreate(), MatCreateMPIAIJMixed(), MatSetValues(), MATSEQAIJMIXED
+@*/
+PetscErrorCode  MatCreateSeqAIJMixed(MPI_Comm comm,PetscInt m,PetscInt n,PetscInt nz,const PetscInt nnz[],Mat *A)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatCreate(comm,A);CHKERRQ(ierr);
+  ierr = MatSetSizes(*A,m,n,m,n);CHKERRQ(ierr);
+  ierr = MatSetType(*A,MATSEQAIJMIXED);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation_SeqAIJ(*A,nz,nnz);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*MC
+   MATSEQAIJMIXED - MATSEQAIJMIXED = "seqaijmixed" - A MATSEQAIJ matrix whose MatMult(), MatMultAdd(), MatMultTranspose(),
+   MatGetDiagonal(), MatSOR() and LU/ILU triangular solves use the values in single precision and the column indices in
+   32 bit integers
+
+   Options Database Keys:
+. -mat_type seqaijmixed - sets the matrix type to "seqaijmixed" during a call to MatSetFromOptions()
+
+   Level: intermediate
+
+   Notes:
+   The first of these kernels to run rounds the values to single precision and frees the MATSEQAIJ arrays of values
+   and column indices, so the matrix takes about 8 instead of 16 bytes per nonzero. Any other operation first rebuilds
+   the MATSEQAIJ arrays, with the rounded values, and they are freed again by the next kernel; for example setting values
+   and assembling again works as for MATSEQAIJ. Inodes are not used. MatMPIAIJGetSeqAIJ() and MatMPIAIJGetLocalMat()
+   rebuild the MATSEQAIJ arrays of the blocks of a MATMPIAIJMIXED matrix, for callers that read them directly.
+
+   The factors of MatGetFactor() with MATSOLVERPETSC are computed in double precision. LU and ILU factors are then also
+   stored in single precision; when the matrix uses threads (MatSeqAIJSetNumThreads()) their solves are level-scheduled.
+
+.seealso: MatCreateSeqAIJMixed(), MATAIJMIXED, MATSEQAIJ
+M*/
+
+PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJMixed(Mat A)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatSetType(A,MATSEQAIJ);CHKERRQ(ierr);
+  ierr = MatConvert_SeqAIJ_SeqAIJMixed(A,MATSEQAIJMIXED,MAT_INPLACE_MATRIX,&A);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
@@ -0,0 +1,26 @@
+#if !defined(__AIJMIXED_H)
+#define __AIJMIXED_H
+
+#include <../src/mat/impls/aij/seq/aij.h>
+
+/*
+   Shared by MATSEQAIJMIXED and MATMPIAIJMIXED. These matrices only keep the values in single precision and the column
+   indices in 32 bit integers once a kernel has used them; the operations of the base type that read its storage are
+   replaced by wrappers that first rebuild it with expand() and then call the saved operation in ops.
+*/
+#define MATAIJMIXEDHEADER \
+  struct _MatOps ops;               /* operations of the base type replaced by the wrappers */ \
+  MatType        basetype;          /* MATSEQAIJ or MATMPIAIJ */ \
+  PetscErrorCode (*expand)(Mat)     /* rebuilds the storage of the base type */
+
+typedef struct {
+  MATAIJMIXEDHEADER;
+} Mat_AIJMixed;
+
+PETSC_INTERN PetscErrorCode MatAIJMixedExpand_Private(Mat);
+PETSC_INTERN PetscErrorCode MatAIJMixedWrapOperations_Private(Mat,MatType);
+PETSC_INTERN PetscErrorCode MatAIJMixedUnwrapOperations_Private(Mat,MatType);
+PETSC_INTERN PetscErrorCode MatSeqAIJMixedDemote_Private(Mat,MatReuse,Mat*);
+PETSC_INTERN PetscErrorCode MatMPIAIJMixedDemote_Private(Mat,MatReuse,Mat*);
+
+#endif
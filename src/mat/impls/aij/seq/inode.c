@@ -364,32 +364,26 @@ static PetscErrorCode MatRestoreColumnIJ_SeqAIJ_Inode(Mat A,PetscInt oshift,Pets
 
 /* ----------------------------------------------------------- */
 
-static PetscErrorCode MatMult_SeqAIJ_Inode(Mat A,Vec xx,Vec yy)
+/*
+   Multiplies with the inodes node_start to node_end-1, the first of which starts at the given row, and returns the number of
+   nonzero rows or -1 for an unsupported node size. It does no error checking so it can be called inside an OpenMP parallel region.
+*/
+static PetscInt MatMult_SeqAIJ_Inode_Private(const Mat_SeqAIJ *a,PetscInt node_start,PetscInt node_end,PetscInt row,const PetscScalar *x,PetscScalar *y)
 {
-  Mat_SeqAIJ        *a = (Mat_SeqAIJ*)A->data;
   PetscScalar       sum1,sum2,sum3,sum4,sum5,tmp0,tmp1;
-  PetscScalar       *y;
-  const PetscScalar *x;
   const MatScalar   *v1,*v2,*v3,*v4,*v5;
-  PetscErrorCode    ierr;
-  PetscInt          i1,i2,n,i,row,node_max,nsz,sz,nonzerorow=0;
-  const PetscInt    *idx,*ns,*ii;
+  PetscInt          i1,i2,n,i,nsz,sz,nonzerorow=0;
+  const PetscInt    *idx,*ns = a->inode.size,*ii;
 
 #if defined(PETSC_HAVE_PRAGMA_DISJOINT)
 #pragma disjoint(*x,*y,*v1,*v2,*v3,*v4,*v5)
 #endif
 
-  PetscFunctionBegin;
-  if (!a->inode.size) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Missing Inode Structure");
-  node_max = a->inode.node_count;
-  ns       = a->inode.size;     /* Node Size array */
-  ierr     = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
-  ierr     = VecGetArray(yy,&y);CHKERRQ(ierr);
-  idx      = a->j;
-  v1       = a->a;
-  ii       = a->i;
+  idx = a->j + a->i[row];
+  v1  = a->a + a->i[row];
+  ii  = a->i + row;
 
-  for (i = 0,row = 0; i< node_max; ++i) {
+  for (i = node_start; i< node_end; ++i) {
     nsz         = ns[i];
     n           = ii[1] - ii[0];
     nonzerorow += (n>0)*nsz;
@@ -544,41 +538,64 @@ static PetscErrorCode MatMult_SeqAIJ_Inode(Mat A,Vec xx,Vec yy)
       idx    +=4*sz;
       break;
     default:
-      SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Node size not yet supported");
+      return -1;
     }
   }
-  ierr = VecRestoreArrayRead(xx,&x);CHKERRQ(ierr);
-  ierr = VecRestoreArray(yy,&y);CHKERRQ(ierr);
-  ierr = PetscLogFlops(2.0*a->nz - nonzerorow);CHKERRQ(ierr);
-  PetscFunctionReturn(0);
+  return nonzerorow;
 }
-/* ----------------------------------------------------------- */
-/* Almost same code as the MatMult_SeqAIJ_Inode() */
-static PetscErrorCode MatMultAdd_SeqAIJ_Inode(Mat A,Vec xx,Vec zz,Vec yy)
+
+static PetscErrorCode MatMult_SeqAIJ_Inode(Mat A,Vec xx,Vec yy)
 {
   Mat_SeqAIJ        *a = (Mat_SeqAIJ*)A->data;
-  PetscScalar       sum1,sum2,sum3,sum4,sum5,tmp0,tmp1;
-  const MatScalar   *v1,*v2,*v3,*v4,*v5;
+  PetscScalar       *y;
   const PetscScalar *x;
-  PetscScalar       *y,*z,*zt;
   PetscErrorCode    ierr;
-  PetscInt          i1,i2,n,i,row,node_max,nsz,sz;
-  const PetscInt    *idx,*ns,*ii;
+  PetscInt          nonzerorow;
 
   PetscFunctionBegin;
   if (!a->inode.size) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Missing Inode Structure");
-  node_max = a->inode.node_count;
-  ns       = a->inode.size;     /* Node Size array */
-
   ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
-  ierr = VecGetArrayPair(zz,yy,&z,&y);CHKERRQ(ierr);
-  zt = z;
+  ierr = VecGetArray(yy,&y);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1) {
+    const PetscInt *start,*rstart;
+    PetscInt       t,nt = a->threads.nthreads,nbad = 0;
+
+    ierr       = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_INODES,&start,&rstart);CHKERRQ(ierr);
+    nonzerorow = 0;
+#pragma omp parallel for num_threads(nt) schedule(static,1) reduction(+:nonzerorow,nbad)
+    for (t=0; t<nt; t++) {
+      PetscInt cnt = MatMult_SeqAIJ_Inode_Private(a,start[t],start[t+1],rstart[t],x,y);
+
+      if (cnt < 0) nbad++;
+      else nonzerorow += cnt;
+    }
+    if (nbad) nonzerorow = -1;
+  } else
+#endif
+  nonzerorow = MatMult_SeqAIJ_Inode_Private(a,0,a->inode.node_count,0,x,y);
+  if (nonzerorow < 0) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Node size not yet supported");
+  ierr = VecRestoreArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecRestoreArray(yy,&y);CHKERRQ(ierr);
+  ierr = PetscLogFlops(2.0*a->nz - nonzerorow);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+/* ----------------------------------------------------------- */
+/* Almost same code as the MatMult_SeqAIJ_Inode_Private(), returns 0 or -1 for an unsupported node size */
+static PetscInt MatMultAdd_SeqAIJ_Inode_Private(const Mat_SeqAIJ *a,PetscInt node_start,PetscInt node_end,PetscInt row,const PetscScalar *x,const PetscScalar *z,PetscScalar *y)
+{
+  PetscScalar       sum1,sum2,sum3,sum4,sum5,tmp0,tmp1;
+  const MatScalar   *v1,*v2,*v3,*v4,*v5;
+  const PetscScalar *zt;
+  PetscInt          i1,i2,n,i,nsz,sz;
+  const PetscInt    *idx,*ns = a->inode.size,*ii;
 
-  idx = a->j;
-  v1  = a->a;
-  ii  = a->i;
+  zt  = z + row;
+  idx = a->j + a->i[row];
+  v1  = a->a + a->i[row];
+  ii  = a->i + row;
 
-  for (i = 0,row = 0; i< node_max; ++i) {
+  for (i = node_start; i< node_end; ++i) {
     nsz = ns[i];
     n   = ii[1] - ii[0];
     ii += nsz;
@@ -730,9 +747,39 @@ static PetscErrorCode MatMultAdd_SeqAIJ_Inode(Mat A,Vec xx,Vec zz,Vec yy)
       idx    +=4*sz;
       break;
     default:
-      SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Node size not yet supported");
+      return -1;
     }
   }
+  return 0;
+}
+
+/* Almost same code as the MatMult_SeqAIJ_Inode() */
+static PetscErrorCode MatMultAdd_SeqAIJ_Inode(Mat A,Vec xx,Vec zz,Vec yy)
+{
+  Mat_SeqAIJ        *a = (Mat_SeqAIJ*)A->data;
+  const PetscScalar *x;
+  PetscScalar       *y,*z;
+  PetscErrorCode    ierr;
+  PetscInt          nbad = 0;
+
+  PetscFunctionBegin;
+  if (!a->inode.size) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Missing Inode Structure");
+  ierr = VecGetArrayRead(xx,&x);CHKERRQ(ierr);
+  ierr = VecGetArrayPair(zz,yy,&z,&y);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+  if (a->threads.nthreads > 1) {
+    const PetscInt *start,*rstart;
+    PetscInt       t,nt = a->threads.nthreads;
+
+    ierr = MatSeqAIJGetThreadPartition_Private(A,MAT_SEQAIJ_PARTITION_INODES,&start,&rstart);CHKERRQ(ierr);
+#pragma omp parallel for num_threads(nt) schedule(static,1) reduction(+:nbad)
+    for (t=0; t<nt; t++) {
+      if (MatMultAdd_SeqAIJ_Inode_Private(a,start[t],start[t+1],rstart[t],x,z,y) < 0) nbad++;
+    }
+  } else
+#endif
+  if (MatMultAdd_SeqAIJ_Inode_Private(a,0,a->inode.node_count,0,x,z,y) < 0) nbad++;
+  if (nbad) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_COR,"Node size not yet supported");
   ierr = VecRestoreArrayRead(xx,&x);CHKERRQ(ierr);
   ierr = VecRestoreArrayPair(zz,yy,&z,&y);CHKERRQ(ierr);
   ierr = PetscLogFlops(2.0*a->nz);CHKERRQ(ierr);
@@ -1843,6 +1890,8 @@ PetscErrorCode MatLUFactorNumeric_SeqAIJ_Inode(Mat B,Mat A,const MatFactorInfo *
   C->assembled              = PETSC_TRUE;
   C->preallocated           = PETSC_TRUE;
 
+  ierr = MatSeqAIJSetUpLevels_LU(C,A);CHKERRQ(ierr);
+
   ierr = PetscLogFlops(C->cmap->n);CHKERRQ(ierr);
 
   /* MatShiftView(A,info,&sctx) */
@@ -9,6 +9,9 @@
 #include <petscbt.h>
 #include <petsc/private/isimpl.h>
 #include <../src/mat/impls/dense/seq/dense.h>
+#if defined(PETSC_HAVE_OPENMP)
+#include <omp.h>
+#endif
 
 
 PETSC_INTERN PetscErrorCode MatMatMult_SeqAIJ_SeqAIJ(Mat A,Mat B,MatReuse scall,PetscReal fill,Mat *C)
@@ -44,17 +47,19 @@ PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ(Mat A,Mat B,PetscReal fill,Mat *
 {
   PetscErrorCode ierr;
 #if !defined(PETSC_HAVE_HYPRE)
-  const char     *algTypes[8] = {"sorted","scalable","scalable_fast","heap","btheap","llcondensed","combined","rowmerge"};
-  PetscInt       nalg = 8;
-#else
-  const char     *algTypes[9] = {"sorted","scalable","scalable_fast","heap","btheap","llcondensed","combined","rowmerge","hypre"};
+  const char     *algTypes[9] = {"sorted","scalable","scalable_fast","heap","btheap","llcondensed","combined","rowmerge","threaded"};
   PetscInt       nalg = 9;
+#else
+  const char     *algTypes[10] = {"sorted","scalable","scalable_fast","heap","btheap","llcondensed","combined","rowmerge","threaded","hypre"};
+  PetscInt       nalg = 10;
 #endif
   PetscInt       alg = 0; /* set default algorithm */
 
   PetscFunctionBegin;
+  /* the threaded product is the default once threads were requested on one of the factors with MatSeqAIJSetNumThreads() */
+  if (((Mat_SeqAIJ*)A->data)->threads.nthreads > 1 || ((Mat_SeqAIJ*)B->data)->threads.nthreads > 1) alg = 8;
   ierr = PetscOptionsBegin(PetscObjectComm((PetscObject)A),((PetscObject)A)->prefix,"MatMatMult","Mat");CHKERRQ(ierr);
-  ierr = PetscOptionsEList("-matmatmult_via","Algorithmic approach","MatMatMult",algTypes,nalg,algTypes[0],&alg,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsEList("-matmatmult_via","Algorithmic approach","MatMatMult",algTypes,nalg,algTypes[alg],&alg,NULL);CHKERRQ(ierr);
   ierr = PetscOptionsEnd();CHKERRQ(ierr);
   switch (alg) {
   case 1:
@@ -78,8 +83,11 @@ PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ(Mat A,Mat B,PetscReal fill,Mat *
   case 7:
     ierr = MatMatMultSymbolic_SeqAIJ_SeqAIJ_RowMerge(A,B,fill,C);CHKERRQ(ierr);
     break;
-#if defined(PETSC_HAVE_HYPRE)
   case 8:
+    ierr = MatMatMultSymbolic_SeqAIJ_SeqAIJ_Threaded(A,B,fill,C);CHKERRQ(ierr);
+    break;
+#if defined(PETSC_HAVE_HYPRE)
+  case 9:
     ierr = MatMatMultSymbolic_AIJ_AIJ_wHYPRE(A,B,fill,C);CHKERRQ(ierr);
     break;
 #endif
@@ -1013,6 +1021,283 @@ PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_RowMerge(Mat A,Mat B,PetscReal f
   PetscFunctionReturn(0);
 }
 
+/*
+   Accumulator for one row of C = A*B in the threaded product: either a dense array indexed by the columns of B, or,
+   when B has many more columns than the rows of C can hold, an open addressing hash table with at least twice as
+   many slots as the longest row. Each thread owns one, so no locking is needed.
+*/
+typedef struct {
+  PetscBool   hash;
+  PetscInt    size;   /* number of slots: the number of columns of B for the dense array, a power of two for the hash table */
+  PetscInt    *key;   /* dense: the last row that produced the column; hash: the column held by the slot, or -1 */
+  PetscScalar *val;   /* values, only used by the numeric product */
+  PetscInt    *slot;  /* hash: the slots filled by the current row */
+} MatSpGEMMAcc;
+
+static PetscErrorCode MatSpGEMMAccCreate_Private(PetscInt bn,PetscInt rmax,PetscBool values,MatSpGEMMAcc *acc)
+{
+  PetscErrorCode ierr;
+  PetscInt       size = 2;
+
+  PetscFunctionBegin;
+  while (size < 2*rmax) size *= 2;
+  acc->hash = (PetscBool)(bn > 4*size);
+  acc->size = acc->hash ? size : bn;
+  ierr = PetscMalloc1(acc->size,&acc->key);CHKERRQ(ierr);
+  acc->val  = NULL;
+  acc->slot = NULL;
+  if (values) {ierr = PetscMalloc1(acc->size,&acc->val);CHKERRQ(ierr);}
+  if (acc->hash) {ierr = PetscMalloc1(rmax,&acc->slot);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatSpGEMMAccDestroy_Private(MatSpGEMMAcc *acc)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscFree(acc->key);CHKERRQ(ierr);
+  ierr = PetscFree(acc->val);CHKERRQ(ierr);
+  ierr = PetscFree(acc->slot);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* returns the slot of column c in the hash table, inserting it and recording the slot in slot[(*n)++] if it is not there */
+PETSC_STATIC_INLINE PetscInt MatSpGEMMAccHashSlot_Private(MatSpGEMMAcc *acc,PetscInt c,PetscInt *n)
+{
+  PetscInt h = (PetscInt)(((size_t)c*(size_t)2654435761U) & (size_t)(acc->size-1));
+
+  while (acc->key[h] != c) {
+    if (acc->key[h] < 0) {
+      acc->key[h]       = c;
+      acc->slot[(*n)++] = h;
+      break;
+    }
+    h = (h+1) & (acc->size-1);
+  }
+  return h;
+}
+
+/* sorts the column indices of one row of C; it runs inside parallel regions, so it does not use PetscSortInt() and the PETSc stack */
+static void MatSpGEMMSortRow_Private(PetscInt n,PetscInt x[])
+{
+  PetscInt i,j,last,tmp;
+
+  if (n < 16) {
+    for (i=1; i<n; i++) {
+      tmp = x[i];
+      for (j=i; j>0 && x[j-1]>tmp; j--) x[j] = x[j-1];
+      x[j] = tmp;
+    }
+    return;
+  }
+  tmp = x[0]; x[0] = x[n/2]; x[n/2] = tmp;
+  for (last=0,i=1; i<n; i++) {
+    if (x[i] < x[0]) {last++; tmp = x[last]; x[last] = x[i]; x[i] = tmp;}
+  }
+  tmp = x[0]; x[0] = x[last]; x[last] = tmp;
+  MatSpGEMMSortRow_Private(last,x);
+  MatSpGEMMSortRow_Private(n-last-1,x+last+1);
+}
+
+/*
+   Splits the rows of A among nt threads with about the same number of multiply-adds in C = A*B each. rmax[t] bounds the
+   number of nonzeros in the rows of C computed by thread t: the multiply-adds of a row, capped by the number of columns
+   of B, and the row length of C when its structure ci[] is already known.
+*/
+static PetscErrorCode MatMatMultSplitRows_SeqAIJ_SeqAIJ_Threaded(Mat A,Mat B,const PetscInt ci[],PetscInt nt,PetscInt start[],PetscInt rmax[])
+{
+  PetscErrorCode ierr;
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data,*b = (Mat_SeqAIJ*)B->data;
+  const PetscInt *ai = a->i,*aj = a->j,*bi = b->i;
+  PetscInt       am = A->rmap->n,bn = B->cmap->n,i,t,*w;
+
+  PetscFunctionBegin;
+  ierr = PetscMalloc1(am+1,&w);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static)
+#endif
+  for (i=0; i<am; i++) {
+    PetscInt k,nz = 0;
+
+    for (k=ai[i]; k<ai[i+1]; k++) nz += bi[aj[k]+1] - bi[aj[k]];
+    w[i+1] = nz;
+  }
+  w[0] = 0;
+  for (i=0; i<am; i++) w[i+1] += w[i];
+  MatSeqAIJSplitByWeight_Private(am,w,NULL,nt,start);
+  for (t=0; t<nt; t++) {
+    rmax[t] = 0;
+    for (i=start[t]; i<start[t+1]; i++) {
+      rmax[t] = PetscMax(rmax[t],PetscMin(w[i+1]-w[i],bn));
+      if (ci) rmax[t] = PetscMax(rmax[t],ci[i+1]-ci[i]);
+    }
+  }
+  ierr = PetscFree(w);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* number of threads of the threaded product: the largest set on A or B with MatSeqAIJSetNumThreads(), or the OpenMP default */
+static PetscInt MatMatMultGetNumThreads_SeqAIJ_SeqAIJ(Mat A,Mat B)
+{
+  PetscInt nt = PetscMax(((Mat_SeqAIJ*)A->data)->threads.nthreads,((Mat_SeqAIJ*)B->data)->threads.nthreads);
+
+#if defined(PETSC_HAVE_OPENMP)
+  if (nt < 2) nt = (PetscInt)omp_get_max_threads();
+#endif
+  return nt;
+}
+
+/*
+   Thread-parallel Gustavson product. The rows of A are split among the threads by the number of multiply-adds they
+   need; in a first pass each thread counts the nonzeros of its rows of C with its own accumulator, then, once the row
+   pointers are known, it fills and sorts the column indices of the same rows in place, so there is no serial merge.
+   C keeps the number of threads, which the numeric product and MatMult() with C then use.
+*/
+PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_Threaded(Mat A,Mat B,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr;
+  Mat_SeqAIJ     *a = (Mat_SeqAIJ*)A->data,*b = (Mat_SeqAIJ*)B->data,*c;
+  const PetscInt *ai = a->i,*aj = a->j,*bi = b->i,*bj = b->j;
+  PetscInt       am = A->rmap->n,bn = B->cmap->n,bm = B->rmap->n,nt,t,i,pass,*start,*rmax,*ci,*cj = NULL;
+  MatSpGEMMAcc   *acc;
+  PetscReal      afill;
+
+  PetscFunctionBegin;
+  nt   = MatMatMultGetNumThreads_SeqAIJ_SeqAIJ(A,B);
+  ierr = PetscMalloc3(nt+1,&start,nt,&rmax,nt,&acc);CHKERRQ(ierr);
+  ierr = PetscMalloc1(am+1,&ci);CHKERRQ(ierr);
+  ierr = MatMatMultSplitRows_SeqAIJ_SeqAIJ_Threaded(A,B,NULL,nt,start,rmax);CHKERRQ(ierr);
+  for (t=0; t<nt; t++) {ierr = MatSpGEMMAccCreate_Private(bn,rmax[t],PETSC_FALSE,&acc[t]);CHKERRQ(ierr);}
+
+  /* pass 0 counts the nonzeros in each row of C, pass 1 writes and sorts their column indices */
+  for (pass=0; pass<2; pass++) {
+    if (pass) {
+      ci[0] = 0;
+      for (i=0; i<am; i++) ci[i+1] += ci[i];
+      ierr = PetscMalloc1(ci[am]+1,&cj);CHKERRQ(ierr);
+    }
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static,1)
+#endif
+    for (t=0; t<nt; t++) {
+      MatSpGEMMAcc *ac = &acc[t];
+      PetscInt     r,j,k,col,n,*crow;
+
+      for (k=0; k<ac->size; k++) ac->key[k] = -1;
+      for (r=start[t]; r<start[t+1]; r++) {
+        n    = 0;
+        crow = pass ? cj + ci[r] : NULL;
+        for (j=ai[r]; j<ai[r+1]; j++) {
+          for (k=bi[aj[j]]; k<bi[aj[j]+1]; k++) {
+            col = bj[k];
+            if (ac->hash) (void)MatSpGEMMAccHashSlot_Private(ac,col,&n);
+            else if (ac->key[col] != r) {
+              ac->key[col] = r;
+              if (crow) crow[n] = col;
+              n++;
+            }
+          }
+        }
+        if (ac->hash) {
+          for (k=0; k<n; k++) {
+            if (crow) crow[k] = ac->key[ac->slot[k]];
+            ac->key[ac->slot[k]] = -1;
+          }
+        }
+        if (crow) MatSpGEMMSortRow_Private(n,crow);
+        else ci[r+1] = n;
+      }
+    }
+  }
+  for (t=0; t<nt; t++) {ierr = MatSpGEMMAccDestroy_Private(&acc[t]);CHKERRQ(ierr);}
+  ierr = PetscFree3(start,rmax,acc);CHKERRQ(ierr);
+
+  ierr = MatCreateSeqAIJWithArrays(PetscObjectComm((PetscObject)A),am,bn,ci,cj,NULL,C);CHKERRQ(ierr);
+  ierr = MatSetBlockSizesFromMats(*C,A,B);CHKERRQ(ierr);
+  ierr = MatSetType(*C,((PetscObject)A)->type_name);CHKERRQ(ierr);
+
+  /* MatCreateSeqAIJWithArrays flags matrix so PETSc doesn't free the user's arrays. */
+  /* These are PETSc arrays, so change flags so arrays can be deleted by PETSc */
+  c          = (Mat_SeqAIJ*)((*C)->data);
+  c->free_a  = PETSC_FALSE;
+  c->free_ij = PETSC_TRUE;
+  c->nonew   = 0;
+  ierr = MatSeqAIJSetNumThreads(*C,nt);CHKERRQ(ierr);
+  (*C)->ops->matmultnumeric = MatMatMultNumeric_SeqAIJ_SeqAIJ_Threaded;
+
+  /* set MatInfo */
+  afill = (PetscReal)ci[am]/(ai[am]+bi[bm]) + 1.e-5;
+  if (afill < 1.0) afill = 1.0;
+  c->maxnz                     = ci[am];
+  c->nz                        = ci[am];
+  (*C)->info.mallocs           = 0;
+  (*C)->info.fill_ratio_given  = fill;
+  (*C)->info.fill_ratio_needed = afill;
+  ierr = PetscInfo2((*C),"Threaded product with %D threads, %D nonzeros\n",nt,ci[am]);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatMatMultNumeric_SeqAIJ_SeqAIJ_Threaded(Mat A,Mat B,Mat C)
+{
+  PetscErrorCode  ierr;
+  Mat_SeqAIJ      *a = (Mat_SeqAIJ*)A->data,*b = (Mat_SeqAIJ*)B->data,*c = (Mat_SeqAIJ*)C->data;
+  const PetscInt  *ai = a->i,*aj = a->j,*bi = b->i,*bj = b->j,*ci = c->i,*cj = c->j;
+  const MatScalar *aa = a->a,*ba = b->a;
+  MatScalar       *ca;
+  PetscInt        am = A->rmap->n,bn = B->cmap->n,nt = c->threads.nthreads,t,*start,*rmax;
+  MatSpGEMMAcc    *acc;
+  PetscLogDouble  flops = 0.0;
+
+  PetscFunctionBegin;
+  if (!c->a) {
+    ierr      = PetscMalloc1(ci[am]+1,&c->a);CHKERRQ(ierr);
+    c->free_a = PETSC_TRUE;
+  }
+  ca   = c->a;
+  ierr = PetscMalloc3(nt+1,&start,nt,&rmax,nt,&acc);CHKERRQ(ierr);
+  ierr = MatMatMultSplitRows_SeqAIJ_SeqAIJ_Threaded(A,B,ci,nt,start,rmax);CHKERRQ(ierr);
+  for (t=0; t<nt; t++) {ierr = MatSpGEMMAccCreate_Private(bn,rmax[t],PETSC_TRUE,&acc[t]);CHKERRQ(ierr);}
+#if defined(PETSC_HAVE_OPENMP)
+#pragma omp parallel for num_threads(nt) schedule(static,1) reduction(+:flops)
+#endif
+  for (t=0; t<nt; t++) {
+    MatSpGEMMAcc *ac = &acc[t];
+    PetscInt     r,j,k,n,h;
+    MatScalar    v;
+
+    for (k=0; k<ac->size; k++) {
+      ac->key[k] = -1;
+      ac->val[k] = 0.0;
+    }
+    for (r=start[t]; r<start[t+1]; r++) {
+      n = 0;
+      for (j=ai[r]; j<ai[r+1]; j++) {
+        v = aa[j];
+        for (k=bi[aj[j]]; k<bi[aj[j]+1]; k++) {
+          h           = ac->hash ? MatSpGEMMAccHashSlot_Private(ac,bj[k],&n) : bj[k];
+          ac->val[h] += v*ba[k];
+        }
+        flops += 2*(bi[aj[j]+1] - bi[aj[j]]);
+      }
+      for (k=ci[r]; k<ci[r+1]; k++) {
+        h          = ac->hash ? MatSpGEMMAccHashSlot_Private(ac,cj[k],&n) : cj[k];
+        ca[k]      = ac->val[h];
+        ac->val[h] = 0.0;
+      }
+      if (ac->hash) {
+        for (k=0; k<n; k++) ac->key[ac->slot[k]] = -1;
+      }
+    }
+  }
+  for (t=0; t<nt; t++) {ierr = MatSpGEMMAccDestroy_Private(&acc[t]);CHKERRQ(ierr);}
+  ierr = PetscFree3(start,rmax,acc);CHKERRQ(ierr);
+  ierr = MatAssemblyBegin(C,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(C,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = PetscLogFlops(flops);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 /* concatenate unique entries and then sort */
 PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqAIJ_Sorted(Mat A,Mat B,PetscReal fill,Mat *C)
 {
@@ -1448,27 +1733,28 @@ PetscErrorCode MatMatMultSymbolic_SeqAIJ_SeqDense(Mat A,Mat B,PetscReal fill,Mat
 PetscErrorCode MatMatMultNumericAdd_SeqAIJ_SeqDense(Mat A,Mat B,Mat C)
 {
   Mat_SeqAIJ        *a=(Mat_SeqAIJ*)A->data;
-  Mat_SeqDense      *bd = (Mat_SeqDense*)B->data;
+  Mat_SeqDense      *bd = (Mat_SeqDense*)B->data,*cd = (Mat_SeqDense*)C->data;
   PetscErrorCode    ierr;
-  PetscScalar       *c,r1,r2,r3,r4,*c1,*c2,*c3,*c4,aatmp;
+  PetscScalar       *c,r1,r2,r3,r4,*c1,aatmp;
   const PetscScalar *aa,*b,*b1,*b2,*b3,*b4,*av;
   const PetscInt    *aj;
-  PetscInt          cm=C->rmap->n,cn=B->cmap->n,bm=bd->lda,am=A->rmap->n;
-  PetscInt          am4=4*am,bm4=4*bm,col,i,j,n,ajtmp;
+  PetscInt          cn=B->cmap->n,bm=bd->lda,cm=cd->lda,am=A->rmap->n;
+  PetscInt          col,i,j,n,ajtmp;
 
   PetscFunctionBegin;
-  if (!cm || !cn) PetscFunctionReturn(0);
+  if (!am || !cn) PetscFunctionReturn(0);
   ierr = MatSeqAIJGetArrayRead(A,&av);CHKERRQ(ierr);
   ierr = MatDenseGetArray(C,&c);CHKERRQ(ierr);
   ierr = MatDenseGetArrayRead(B,&b);CHKERRQ(ierr);
-  b1 = b; b2 = b1 + bm; b3 = b2 + bm; b4 = b3 + bm;
-  c1 = c; c2 = c1 + am; c3 = c2 + am; c4 = c3 + am;
-  for (col=0; col<cn-4; col += 4) {  /* over columns of C */
-    for (i=0; i<am; i++) {        /* over rows of C in those columns */
+  /* the row of A is read once from memory for all the columns of B, which are processed four at a time */
+  for (i=0; i<am; i++) {        /* over rows of C */
+    n  = a->i[i+1] - a->i[i];
+    aj = a->j + a->i[i];
+    aa = av + a->i[i];
+    c1 = c + i;
+    for (col=0; col+4<=cn; col += 4) {  /* over columns of C */
+      b1 = b + col*bm; b2 = b1 + bm; b3 = b2 + bm; b4 = b3 + bm;
       r1 = r2 = r3 = r4 = 0.0;
-      n  = a->i[i+1] - a->i[i];
-      aj = a->j + a->i[i];
-      aa = av + a->i[i];
       for (j=0; j<n; j++) {
         aatmp = aa[j]; ajtmp = aj[j];
         r1 += aatmp*b1[ajtmp];
@@ -1476,27 +1762,17 @@ PetscErrorCode MatMatMultNumericAdd_SeqAIJ_SeqDense(Mat A,Mat B,Mat C)
         r3 += aatmp*b3[ajtmp];
         r4 += aatmp*b4[ajtmp];
       }
-      c1[i] += r1;
-      c2[i] += r2;
-      c3[i] += r3;
-      c4[i] += r4;
+      c1[col*cm]     += r1;
+      c1[(col+1)*cm] += r2;
+      c1[(col+2)*cm] += r3;
+      c1[(col+3)*cm] += r4;
     }
-    b1 += bm4; b2 += bm4; b3 += bm4; b4 += bm4;
-    c1 += am4; c2 += am4; c3 += am4; c4 += am4;
-  }
-  for (; col<cn; col++) {   /* over extra columns of C */
-    for (i=0; i<am; i++) {  /* over rows of C in those columns */
+    for (; col<cn; col++) {     /* over extra columns of C */
+      b1 = b + col*bm;
       r1 = 0.0;
-      n  = a->i[i+1] - a->i[i];
-      aj = a->j + a->i[i];
-      aa = av + a->i[i];
-      for (j=0; j<n; j++) {
-        r1 += aa[j]*b1[aj[j]];
-      }
-      c1[i] += r1;
+      for (j=0; j<n; j++) r1 += aa[j]*b1[aj[j]];
+      c1[col*cm] += r1;
     }
-    b1 += bm;
-    c1 += am;
   }
   ierr = PetscLogFlops(cn*(2.0*a->nz));CHKERRQ(ierr);
   ierr = MatDenseRestoreArray(C,&c);CHKERRQ(ierr);
@@ -0,0 +1,487 @@
+/*
+  Defines the products C = P^T*A*P and C = A*P where A is a SeqBAIJ or MPIBAIJ matrix with block size bs and P is
+  a SeqAIJ or MPIAIJ matrix whose column block size is cbs, for instance a prolongator of PCGAMG.
+
+  The rows of P are grouped by bs and its columns by cbs, so that P is handled as a matrix of dense bs x cbs blocks
+  (stored by columns like the blocks of BAIJ). A*P is then computed as products of dense blocks, and P^T*A*P is a
+  BAIJ matrix with block size cbs.
+*/
+
+#include <../src/mat/impls/baij/mpi/mpibaij.h>
+#include <../src/mat/impls/aij/seq/aij.h>
+#include <../src/mat/utils/freespace.h>
+
+typedef struct {
+  Mat         *Pext;                /* rows of P matching the block columns of the diagonal, then of the off-diagonal, part of A */
+  IS          rows,cols;
+  MatReuse    reuse;                /* MAT_INITIAL_MATRIX right after the symbolic product, where Pext is already current */
+  PetscInt    bs,cbs;               /* block size of A, and column block size of P */
+  PetscInt    mbs,nb;               /* number of block rows of A and of the blocked P */
+  PetscInt    *pbi,*pbj,*pbmap;     /* blocked P, and the location of each nonzero of P in pba */
+  PetscScalar *pba;
+  PetscInt    *api,*apj,apmax;      /* blocked A*P, with global block columns, and its longest row */
+  PetscScalar *apa;
+  PetscInt    *idx;
+  PetscScalar *work;
+} Mat_BAIJAIJ;
+
+static PetscErrorCode MatBAIJAIJDestroy_Private(void *ptr)
+{
+  Mat_BAIJAIJ    *prod = (Mat_BAIJAIJ*)ptr;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (prod->Pext) {ierr = MatDestroySubMatrices(1,&prod->Pext);CHKERRQ(ierr);}
+  ierr = ISDestroy(&prod->rows);CHKERRQ(ierr);
+  ierr = ISDestroy(&prod->cols);CHKERRQ(ierr);
+  ierr = PetscFree3(prod->pbi,prod->pbj,prod->pbmap);CHKERRQ(ierr);
+  ierr = PetscFree(prod->pba);CHKERRQ(ierr);
+  ierr = PetscFree(prod->api);CHKERRQ(ierr);
+  ierr = PetscFree(prod->apj);CHKERRQ(ierr);
+  ierr = PetscFree(prod->apa);CHKERRQ(ierr);
+  ierr = PetscFree2(prod->idx,prod->work);CHKERRQ(ierr);
+  ierr = PetscFree(prod);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* the diagonal and off-diagonal parts of A; the block columns of Ao are numbered after those of Ad */
+static PetscErrorCode MatBAIJAIJGetParts_Private(Mat A,Mat *Ad,Mat *Ao)
+{
+  PetscBool      flg;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)A,MATMPIBAIJ,&flg);CHKERRQ(ierr);
+  if (flg) {
+    Mat_MPIBAIJ *b = (Mat_MPIBAIJ*)A->data;
+
+    *Ad = b->A;
+    *Ao = b->B;
+  } else {
+    *Ad = A;
+    *Ao = NULL;
+  }
+  PetscFunctionReturn(0);
+}
+
+/* the rows of P needed by the local rows of A, with global column indices */
+static PetscErrorCode MatBAIJAIJGetLocalP_Private(Mat A,Mat P,Mat_BAIJAIJ *prod,MatReuse scall,Mat *Ploc)
+{
+  PetscBool      flg;
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectTypeCompare((PetscObject)A,MATMPIBAIJ,&flg);CHKERRQ(ierr);
+  if (!flg) {
+    *Ploc = P;
+    PetscFunctionReturn(0);
+  }
+  if (scall == MAT_INITIAL_MATRIX) {
+    Mat_MPIBAIJ *b  = (Mat_MPIBAIJ*)A->data;
+    PetscInt    bs  = prod->bs,nd = A->cmap->n/bs,no = b->B->cmap->n/bs,i,*bidx;
+
+    ierr = PetscMalloc1(nd+no,&bidx);CHKERRQ(ierr);
+    for (i=0; i<nd; i++) bidx[i] = A->cmap->rstart/bs + i;
+    for (i=0; i<no; i++) bidx[nd+i] = b->garray[i];
+    ierr = ISCreateBlock(PETSC_COMM_SELF,bs,nd+no,bidx,PETSC_OWN_POINTER,&prod->rows);CHKERRQ(ierr);
+    ierr = ISCreateStride(PETSC_COMM_SELF,P->cmap->N,0,1,&prod->cols);CHKERRQ(ierr);
+  }
+  ierr  = MatCreateSubMatrices(P,1,&prod->rows,&prod->cols,scall,&prod->Pext);CHKERRQ(ierr);
+  *Ploc = prod->Pext[0];
+  PetscFunctionReturn(0);
+}
+
+/*
+   Block structure of P and of A*P. Each block row of P gathers the columns of its bs rows, divided by cbs, and
+   pbmap[] records where each nonzero of P goes in the dense blocks.
+*/
+static PetscErrorCode MatBAIJAIJSymbolic_Private(Mat A,Mat P,PetscReal fill,Mat_BAIJAIJ *prod)
+{
+  PetscErrorCode     ierr;
+  Mat                Ad,Ao,Ploc;
+  Mat_SeqBAIJ        *parts[2];
+  Mat_SeqAIJ         *p;
+  PetscInt           bs = prod->bs,cbs = prod->cbs,nb,mbs,nd,s,i,j,k,K,e,n,nmax,*buf,*pbi,*pbj,*api,pnz,c;
+  PetscFreeSpaceList free_space=NULL,current_space=NULL;
+
+  PetscFunctionBegin;
+  ierr = MatBAIJAIJGetParts_Private(A,&Ad,&Ao);CHKERRQ(ierr);
+  ierr = MatBAIJAIJGetLocalP_Private(A,P,prod,MAT_INITIAL_MATRIX,&Ploc);CHKERRQ(ierr);
+  p        = (Mat_SeqAIJ*)Ploc->data;
+  parts[0] = (Mat_SeqBAIJ*)Ad->data;
+  parts[1] = Ao ? (Mat_SeqBAIJ*)Ao->data : NULL;
+  nb       = Ploc->rmap->n/bs;
+  mbs      = A->rmap->n/bs;
+  nd       = Ad->cmap->n/bs;
+  prod->nb  = nb;
+  prod->mbs = mbs;
+
+  /* blocked P */
+  for (K=0,nmax=0; K<nb; K++) nmax = PetscMax(nmax,p->i[(K+1)*bs] - p->i[K*bs]);
+  ierr   = PetscMalloc3(nb+1,&prod->pbi,p->i[nb*bs],&prod->pbj,p->i[nb*bs],&prod->pbmap);CHKERRQ(ierr);
+  ierr   = PetscMalloc1(nmax,&buf);CHKERRQ(ierr);
+  pbi    = prod->pbi;
+  pbj    = prod->pbj;
+  pbi[0] = 0;
+  for (K=0; K<nb; K++) {
+    for (e=p->i[K*bs],n=0; e<p->i[(K+1)*bs]; e++) buf[n++] = p->j[e]/cbs;
+    ierr = PetscSortRemoveDupsInt(&n,buf);CHKERRQ(ierr);
+    ierr = PetscArraycpy(pbj+pbi[K],buf,n);CHKERRQ(ierr);
+    pbi[K+1] = pbi[K] + n;
+    for (i=0; i<bs; i++) {
+      for (e=p->i[K*bs+i]; e<p->i[K*bs+i+1]; e++) {
+        ierr = PetscFindInt(p->j[e]/cbs,n,pbj+pbi[K],&j);CHKERRQ(ierr);
+        c    = p->j[e] % cbs;
+        prod->pbmap[e] = (pbi[K]+j)*bs*cbs + i + c*bs;
+      }
+    }
+  }
+  ierr = PetscFree(buf);CHKERRQ(ierr);
+  ierr = PetscMalloc1(pbi[nb]*bs*cbs,&prod->pba);CHKERRQ(ierr);
+
+  /* blocked A*P, the union of the block rows of P selected by each block row of A */
+  for (i=0,nmax=0; i<mbs; i++) {
+    for (s=0,pnz=0; s<2; s++) {
+      if (!parts[s]) continue;
+      for (k=parts[s]->i[i]; k<parts[s]->i[i+1]; k++) {
+        K    = parts[s]->j[k] + (s ? nd : 0);
+        pnz += pbi[K+1] - pbi[K];
+      }
+    }
+    nmax = PetscMax(nmax,pnz);
+  }
+  ierr = PetscMalloc1(nmax,&buf);CHKERRQ(ierr);
+  ierr = PetscMalloc1(mbs+1,&prod->api);CHKERRQ(ierr);
+  api    = prod->api;
+  api[0] = 0;
+  ierr   = PetscFreeSpaceGet(PetscRealIntMultTruncate(fill,PetscIntSumTruncate(parts[0]->nz,pbi[nb])),&free_space);CHKERRQ(ierr);
+  current_space = free_space;
+  prod->apmax   = 0;
+  for (i=0; i<mbs; i++) {
+    for (s=0,n=0; s<2; s++) {
+      if (!parts[s]) continue;
+      for (k=parts[s]->i[i]; k<parts[s]->i[i+1]; k++) {
+        K    = parts[s]->j[k] + (s ? nd : 0);
+        ierr = PetscArraycpy(buf+n,pbj+pbi[K],pbi[K+1]-pbi[K]);CHKERRQ(ierr);
+        n   += pbi[K+1] - pbi[K];
+      }
+    }
+    ierr = PetscSortRemoveDupsInt(&n,buf);CHKERRQ(ierr);
+    if (current_space->local_remaining<n) {
+      ierr = PetscFreeSpaceGet(PetscIntSumTruncate(n,current_space->total_array_size),&current_space);CHKERRQ(ierr);
+    }
+    ierr = PetscArraycpy(current_space->array,buf,n);CHKERRQ(ierr);
+    current_space->array           += n;
+    current_space->local_used      += n;
+    current_space->local_remaining -= n;
+    api[i+1]    = api[i] + n;
+    prod->apmax = PetscMax(prod->apmax,n);
+  }
+  ierr = PetscFree(buf);CHKERRQ(ierr);
+  ierr = PetscMalloc1(api[mbs]+1,&prod->apj);CHKERRQ(ierr);
+  ierr = PetscFreeSpaceContiguous(&free_space,prod->apj);CHKERRQ(ierr);
+  ierr = PetscMalloc1(api[mbs]*bs*cbs,&prod->apa);CHKERRQ(ierr);
+  ierr = PetscMalloc2(prod->apmax*cbs+bs,&prod->idx,PetscMax(bs,cbs)*cbs*prod->apmax,&prod->work);CHKERRQ(ierr);
+  prod->reuse = MAT_INITIAL_MATRIX;
+  PetscFunctionReturn(0);
+}
+
+/* values of the blocked P and of the blocked A*P, computed with dense bs x bs times bs x cbs block products */
+static PetscErrorCode MatBAIJAIJNumeric_Private(Mat A,Mat P,Mat_BAIJAIJ *prod)
+{
+  PetscErrorCode    ierr;
+  Mat               Ad,Ao,Ploc;
+  Mat_SeqBAIJ       *parts[2];
+  Mat_SeqAIJ        *p;
+  const PetscInt    bs = prod->bs,cbs = prod->cbs,bs2 = bs*bs,pbs2 = bs*cbs,*pbi = prod->pbi,*pbj = prod->pbj;
+  const PetscInt    *api = prod->api,*apj = prod->apj,*pj,*cj;
+  PetscInt          nd,s,i,k,kk,K,e,r,c,cc,pnz;
+  const MatScalar   *a;
+  const PetscScalar *pb;
+  PetscScalar       *ap,t;
+  PetscLogDouble    flops = 0.0;
+
+  PetscFunctionBegin;
+  ierr = MatBAIJAIJGetParts_Private(A,&Ad,&Ao);CHKERRQ(ierr);
+  if (prod->reuse == MAT_REUSE_MATRIX) {
+    ierr = MatBAIJAIJGetLocalP_Private(A,P,prod,MAT_REUSE_MATRIX,&Ploc);CHKERRQ(ierr);
+  } else {
+    Ploc = prod->Pext ? prod->Pext[0] : P;
+  }
+  prod->reuse = MAT_REUSE_MATRIX;
+  p        = (Mat_SeqAIJ*)Ploc->data;
+  parts[0] = (Mat_SeqBAIJ*)Ad->data;
+  parts[1] = Ao ? (Mat_SeqBAIJ*)Ao->data : NULL;
+  nd       = Ad->cmap->n/bs;
+
+  ierr = PetscArrayzero(prod->pba,pbi[prod->nb]*pbs2);CHKERRQ(ierr);
+  for (e=0; e<p->i[prod->nb*bs]; e++) prod->pba[prod->pbmap[e]] = p->a[e];
+
+  ierr = PetscArrayzero(prod->apa,api[prod->mbs]*pbs2);CHKERRQ(ierr);
+  for (i=0; i<prod->mbs; i++) {
+    cj = apj + api[i];
+    for (s=0; s<2; s++) {
+      if (!parts[s]) continue;
+      for (k=parts[s]->i[i]; k<parts[s]->i[i+1]; k++) {
+        K   = parts[s]->j[k] + (s ? nd : 0);
+        a   = parts[s]->a + k*bs2;
+        pnz = pbi[K+1] - pbi[K];
+        pj  = pbj + pbi[K];
+        pb  = prod->pba + pbi[K]*pbs2;
+        for (e=0,kk=0; e<pnz; e++,pb+=pbs2) {
+          while (cj[kk] != pj[e]) kk++;
+          ap = prod->apa + (api[i]+kk)*pbs2;
+          for (cc=0; cc<cbs; cc++) {
+            for (c=0; c<bs; c++) {
+              t = pb[c+cc*bs];
+              for (r=0; r<bs; r++) ap[r+cc*bs] += a[r+c*bs]*t;
+            }
+          }
+        }
+        flops += 2.0*bs2*cbs*pnz;
+      }
+    }
+  }
+  ierr = PetscLogFlops(flops);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatBAIJAIJCheck_Private(Mat A,Mat P,Mat_BAIJAIJ *prod)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MatGetBlockSize(A,&prod->bs);CHKERRQ(ierr);
+  ierr = MatGetBlockSizes(P,NULL,&prod->cbs);CHKERRQ(ierr);
+  if (A->rmap->n != A->cmap->n) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_SUP,"Local rows %D and columns %D of A must be the same",A->rmap->n,A->cmap->n);
+  if (P->rmap->n != A->cmap->n) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"Local rows of P %D must match the local columns of A %D",P->rmap->n,A->cmap->n);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatPtAPNumeric_XBAIJ_XAIJ(Mat A,Mat P,Mat C)
+{
+  PetscErrorCode    ierr;
+  PetscContainer    container;
+  Mat_BAIJAIJ       *prod;
+  PetscInt          bs,cbs,pbs2,K,e,j,r,c,s,n,row;
+  const PetscScalar *pb,*ap;
+  PetscScalar       *v,t;
+  PetscLogDouble    flops = 0.0;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectQuery((PetscObject)C,"MatBAIJAIJ",(PetscObject*)&container);CHKERRQ(ierr);
+  if (!container) SETERRQ(PetscObjectComm((PetscObject)C),PETSC_ERR_PLIB,"Container does not exist");
+  ierr = PetscContainerGetPointer(container,(void**)&prod);CHKERRQ(ierr);
+  ierr = MatBAIJAIJNumeric_Private(A,P,prod);CHKERRQ(ierr);
+
+  /* C_IJ += P_KI^T (AP)_KJ for the local block rows K of P, the block rows I of C may belong to other processes */
+  bs   = prod->bs;
+  cbs  = prod->cbs;
+  pbs2 = bs*cbs;
+  v    = prod->work;
+  ierr = MatZeroEntries(C);CHKERRQ(ierr);
+  for (K=0; K<prod->mbs; K++) {
+    n = prod->api[K+1] - prod->api[K];
+    if (!n) continue;
+    pb = prod->pba + prod->pbi[K]*pbs2;
+    for (e=prod->pbi[K]; e<prod->pbi[K+1]; e++,pb+=pbs2) {
+      row = prod->pbj[e];
+      ap = prod->apa + prod->api[K]*pbs2;
+      for (j=0; j<n; j++,ap+=pbs2) {
+        for (r=0; r<cbs; r++) {
+          for (c=0; c<cbs; c++) {
+            for (s=0,t=0.0; s<bs; s++) t += pb[s+r*bs]*ap[s+c*bs];
+            v[r*n*cbs+j*cbs+c] = t;
+          }
+        }
+      }
+      ierr   = MatSetValuesBlocked(C,1,&row,n,prod->apj+prod->api[K],v,ADD_VALUES);CHKERRQ(ierr);
+      flops += 2.0*pbs2*cbs*n;
+    }
+  }
+  ierr = MatAssemblyBegin(C,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(C,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = PetscLogFlops(flops);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatPtAPSymbolic_XBAIJ_XAIJ(Mat A,Mat P,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr;
+  MPI_Comm       comm;
+  PetscContainer container;
+  Mat_BAIJAIJ    *prod;
+  Mat            pre;
+  PetscInt       K,e,j,n,row,cbs;
+  PetscScalar    *zeros;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)A,&comm);CHKERRQ(ierr);
+  ierr = PetscNew(&prod);CHKERRQ(ierr);
+  ierr = MatBAIJAIJCheck_Private(A,P,prod);CHKERRQ(ierr);
+  ierr = MatBAIJAIJSymbolic_Private(A,P,fill,prod);CHKERRQ(ierr);
+  cbs  = prod->cbs;
+
+  /* the block rows of C are the union of the rows of A*P times the blocks of P^T, which may belong to other processes */
+  ierr = MatCreate(comm,&pre);CHKERRQ(ierr);
+  ierr = MatSetType(pre,MATPREALLOCATOR);CHKERRQ(ierr);
+  ierr = MatSetSizes(pre,P->cmap->n,P->cmap->n,P->cmap->N,P->cmap->N);CHKERRQ(ierr);
+  ierr = MatSetBlockSize(pre,cbs);CHKERRQ(ierr);
+  ierr = MatSetUp(pre);CHKERRQ(ierr);
+  ierr = PetscCalloc1(prod->apmax,&zeros);CHKERRQ(ierr);
+  for (K=0; K<prod->mbs; K++) {
+    n = prod->api[K+1] - prod->api[K];
+    for (j=0; j<n; j++) prod->idx[j] = prod->apj[prod->api[K]+j]*cbs;
+    for (e=prod->pbi[K]; e<prod->pbi[K+1]; e++) {
+      row  = prod->pbj[e]*cbs;
+      ierr = MatSetValues(pre,1,&row,n,prod->idx,zeros,INSERT_VALUES);CHKERRQ(ierr);
+    }
+  }
+  ierr = PetscFree(zeros);CHKERRQ(ierr);
+  ierr = MatAssemblyBegin(pre,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(pre,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+
+  ierr = MatCreate(comm,C);CHKERRQ(ierr);
+  ierr = MatSetSizes(*C,P->cmap->n,P->cmap->n,P->cmap->N,P->cmap->N);CHKERRQ(ierr);
+  ierr = MatSetBlockSizes(*C,cbs,cbs);CHKERRQ(ierr);
+  ierr = MatSetType(*C,MATBAIJ);CHKERRQ(ierr);
+  ierr = MatPreallocatorPreallocate(pre,PETSC_TRUE,*C);CHKERRQ(ierr);
+  ierr = MatDestroy(&pre);CHKERRQ(ierr);
+
+  ierr = PetscContainerCreate(comm,&container);CHKERRQ(ierr);
+  ierr = PetscContainerSetPointer(container,prod);CHKERRQ(ierr);
+  ierr = PetscContainerSetUserDestroy(container,MatBAIJAIJDestroy_Private);CHKERRQ(ierr);
+  ierr = PetscObjectCompose((PetscObject)(*C),"MatBAIJAIJ",(PetscObject)container);CHKERRQ(ierr);
+  ierr = PetscContainerDestroy(&container);CHKERRQ(ierr);
+  (*C)->ops->ptapnumeric = MatPtAPNumeric_XBAIJ_XAIJ;
+  ierr = PetscInfo3(*C,"Blocked PtAP with block sizes %D and %D, %D blocks in A*P\n",prod->bs,cbs,prod->api[prod->mbs]);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   MatPtAP_XBAIJ_XAIJ - C = P^T*A*P for a SeqBAIJ or MPIBAIJ matrix A and a SeqAIJ or MPIAIJ matrix P, where C is
+   a BAIJ matrix whose block size is the column block size of P
+*/
+PETSC_INTERN PetscErrorCode MatPtAP_XBAIJ_XAIJ(Mat A,Mat P,MatReuse scall,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (scall == MAT_INITIAL_MATRIX) {
+    ierr = PetscLogEventBegin(MAT_PtAPSymbolic,A,P,0,0);CHKERRQ(ierr);
+    ierr = MatPtAPSymbolic_XBAIJ_XAIJ(A,P,fill,C);CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(MAT_PtAPSymbolic,A,P,0,0);CHKERRQ(ierr);
+  }
+  ierr = PetscLogEventBegin(MAT_PtAPNumeric,A,P,0,0);CHKERRQ(ierr);
+  ierr = (*(*C)->ops->ptapnumeric)(A,P,*C);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_PtAPNumeric,A,P,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMatMultNumeric_XBAIJ_XAIJ(Mat A,Mat P,Mat C)
+{
+  PetscErrorCode    ierr;
+  PetscContainer    container;
+  Mat_BAIJAIJ       *prod;
+  PetscInt          bs,cbs,pbs2,i,j,r,c,n,*rows,*cols;
+  const PetscScalar *ap;
+  PetscScalar       *v;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectQuery((PetscObject)C,"MatBAIJAIJ",(PetscObject*)&container);CHKERRQ(ierr);
+  if (!container) SETERRQ(PetscObjectComm((PetscObject)C),PETSC_ERR_PLIB,"Container does not exist");
+  ierr = PetscContainerGetPointer(container,(void**)&prod);CHKERRQ(ierr);
+  ierr = MatBAIJAIJNumeric_Private(A,P,prod);CHKERRQ(ierr);
+
+  /* insert the dense bs x cbs blocks of A*P one block row at a time */
+  bs   = prod->bs;
+  cbs  = prod->cbs;
+  pbs2 = bs*cbs;
+  rows = prod->idx;
+  cols = prod->idx + bs;
+  v    = prod->work;
+  for (i=0; i<prod->mbs; i++) {
+    n  = prod->api[i+1] - prod->api[i];
+    ap = prod->apa + prod->api[i]*pbs2;
+    for (r=0; r<bs; r++) rows[r] = A->rmap->rstart + i*bs + r;
+    for (j=0; j<n; j++,ap+=pbs2) {
+      for (c=0; c<cbs; c++) {
+        cols[j*cbs+c] = prod->apj[prod->api[i]+j]*cbs + c;
+        for (r=0; r<bs; r++) v[r*n*cbs+j*cbs+c] = ap[r+c*bs];
+      }
+    }
+    ierr = MatSetValues(C,bs,rows,n*cbs,cols,v,INSERT_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(C,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(C,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMatMultSymbolic_XBAIJ_XAIJ(Mat A,Mat P,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr;
+  MPI_Comm       comm;
+  PetscContainer container;
+  Mat_BAIJAIJ    *prod;
+  PetscInt       bs,cbs,i,j,r,c,col,d,o,*dnz,*onz;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)A,&comm);CHKERRQ(ierr);
+  ierr = PetscNew(&prod);CHKERRQ(ierr);
+  ierr = MatBAIJAIJCheck_Private(A,P,prod);CHKERRQ(ierr);
+  ierr = MatBAIJAIJSymbolic_Private(A,P,fill,prod);CHKERRQ(ierr);
+  bs   = prod->bs;
+  cbs  = prod->cbs;
+
+  /* A*P is AIJ since its blocks bs x cbs need not be square */
+  ierr = PetscMalloc2(A->rmap->n,&dnz,A->rmap->n,&onz);CHKERRQ(ierr);
+  for (i=0; i<prod->mbs; i++) {
+    for (j=prod->api[i],d=0,o=0; j<prod->api[i+1]; j++) {
+      for (c=0; c<cbs; c++) {
+        col = prod->apj[j]*cbs + c;
+        if (col >= P->cmap->rstart && col < P->cmap->rend) d++;
+        else o++;
+      }
+    }
+    for (r=0; r<bs; r++) {
+      dnz[i*bs+r] = d;
+      onz[i*bs+r] = o;
+    }
+  }
+  ierr = MatCreate(comm,C);CHKERRQ(ierr);
+  ierr = MatSetSizes(*C,A->rmap->n,P->cmap->n,A->rmap->N,P->cmap->N);CHKERRQ(ierr);
+  ierr = MatSetBlockSizes(*C,bs,cbs);CHKERRQ(ierr);
+  ierr = MatSetType(*C,MATAIJ);CHKERRQ(ierr);
+  ierr = MatSeqAIJSetPreallocation(*C,0,dnz);CHKERRQ(ierr);
+  ierr = MatMPIAIJSetPreallocation(*C,0,dnz,0,onz);CHKERRQ(ierr);
+  ierr = MatSetOption(*C,MAT_NEW_NONZERO_ALLOCATION_ERR,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscFree2(dnz,onz);CHKERRQ(ierr);
+
+  ierr = PetscContainerCreate(comm,&container);CHKERRQ(ierr);
+  ierr = PetscContainerSetPointer(container,prod);CHKERRQ(ierr);
+  ierr = PetscContainerSetUserDestroy(container,MatBAIJAIJDestroy_Private);CHKERRQ(ierr);
+  ierr = PetscObjectCompose((PetscObject)(*C),"MatBAIJAIJ",(PetscObject)container);CHKERRQ(ierr);
+  ierr = PetscContainerDestroy(&container);CHKERRQ(ierr);
+  (*C)->ops->matmultnumeric = MatMatMultNumeric_XBAIJ_XAIJ;
+  PetscFunctionReturn(0);
+}
+
+/*
+   MatMatMult_XBAIJ_XAIJ - C = A*P for a SeqBAIJ or MPIBAIJ matrix A and a SeqAIJ or MPIAIJ matrix P, where C is an
+   AIJ matrix with the row block size of A and the column block size of P
+*/
+PETSC_INTERN PetscErrorCode MatMatMult_XBAIJ_XAIJ(Mat A,Mat P,MatReuse scall,PetscReal fill,Mat *C)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (scall == MAT_INITIAL_MATRIX) {
+    ierr = PetscLogEventBegin(MAT_MatMultSymbolic,A,P,0,0);CHKERRQ(ierr);
+    ierr = MatMatMultSymbolic_XBAIJ_XAIJ(A,P,fill,C);CHKERRQ(ierr);
+    ierr = PetscLogEventEnd(MAT_MatMultSymbolic,A,P,0,0);CHKERRQ(ierr);
+  }
+  ierr = PetscLogEventBegin(MAT_MatMultNumeric,A,P,0,0);CHKERRQ(ierr);
+  ierr = (*(*C)->ops->matmultnumeric)(A,P,*C);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_MatMultNumeric,A,P,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
@@ -2251,6 +2251,7 @@ PetscErrorCode MatScale_SeqBAIJ(Mat inA,PetscScalar alpha)
   PetscFunctionBegin;
   ierr = PetscBLASIntCast(totalnz,&tnz);CHKERRQ(ierr);
   PetscStackCallBLAS("BLASscal",BLASscal_(&tnz,&oalpha,a->a,&one));
+  a->idiagvalid = PETSC_FALSE; /* the inverses of the diagonal blocks used by MatSOR() */
   ierr = PetscLogFlops(totalnz);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -6,6 +6,7 @@
 
 #include <../src/mat/impls/dense/mpi/mpidense.h>    /*I   "petscmat.h"  I*/
 #include <../src/mat/impls/aij/mpi/mpiaij.h>
+#include <petsc/private/vecimpl.h>
 #include <petscblaslapack.h>
 
 /*@
@@ -35,6 +36,51 @@ PetscErrorCode MatDenseGetLocalMatrix(Mat A,Mat *B)
   PetscFunctionReturn(0);
 }
 
+/*@
+   MatDenseTSQR - Computes the QR factorization of a MATSEQDENSE or MATMPIDENSE matrix with more rows than columns
+   with the tall-skinny QR (TSQR) algorithm, the matrix is overwritten with the orthonormal factor Q
+
+   Collective on Mat
+
+   Input Parameter:
+.  A - the dense matrix, with at least as many rows as columns
+
+   Output Parameters:
++  A - the factor Q, whose columns are orthonormal, with A_in = Q R
+-  R - the N by N upper triangular factor, stored by columns, with a real nonnegative diagonal (may be NULL)
+
+   Notes:
+   Each process computes the Householder QR factorization of its rows, then the N by N triangular factors are
+   combined along a binary tree, so only log2(size) messages of N*N scalars are needed. R is the same on all processes.
+
+   Level: advanced
+
+.seealso: VecTSQR(), MatDenseGetArray()
+@*/
+PetscErrorCode MatDenseTSQR(Mat A,PetscScalar R[])
+{
+  PetscErrorCode ierr;
+  Mat            Aloc;
+  PetscScalar    *a,*r = R;
+  PetscInt       m,N,lda;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  ierr = PetscObjectTypeCompareAny((PetscObject)A,&flg,MATSEQDENSE,MATMPIDENSE,"");CHKERRQ(ierr);
+  if (!flg) SETERRQ1(PetscObjectComm((PetscObject)A),PETSC_ERR_SUP,"Not for matrix type %s",((PetscObject)A)->type_name);
+  ierr = MatGetLocalSize(A,&m,NULL);CHKERRQ(ierr);
+  ierr = MatGetSize(A,NULL,&N);CHKERRQ(ierr);
+  ierr = MatDenseGetLocalMatrix(A,&Aloc);CHKERRQ(ierr);
+  ierr = MatDenseGetLDA(Aloc,&lda);CHKERRQ(ierr);
+  if (!R) {ierr = PetscMalloc1(N*N,&r);CHKERRQ(ierr);}
+  ierr = MatDenseGetArray(A,&a);CHKERRQ(ierr);
+  ierr = VecTSQR_Private(PetscObjectComm((PetscObject)A),m,N,a,lda,r);CHKERRQ(ierr);
+  ierr = MatDenseRestoreArray(A,&a);CHKERRQ(ierr);
+  if (!R) {ierr = PetscFree(r);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode MatGetRow_MPIDense(Mat A,PetscInt row,PetscInt *nz,PetscInt **idx,PetscScalar **v)
 {
   Mat_MPIDense   *mat = (Mat_MPIDense*)A->data;
@@ -1215,13 +1261,8 @@ static struct _MatOps MatOps_Values = { MatSetValues_MPIDense,
                                         0,
                                         0,
                                         0,
-#if defined(PETSC_HAVE_ELEMENTAL)
                                 /* 89*/ MatMatMult_MPIDense_MPIDense,
                                         MatMatMultSymbolic_MPIDense_MPIDense,
-#else
-                                /* 89*/ 0,
-                                        0,
-#endif
                                         MatMatMultNumeric_MPIDense,
                                         0,
                                         0,
@@ -1966,12 +2007,23 @@ PetscErrorCode MatTransposeMatMultNumeric_MPIDense_MPIDense(Mat A,Mat B,Mat C)
   ierr = MPI_Comm_rank(comm,&rank);CHKERRQ(ierr);
   ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
 
-  /* compute atbarray = aseq^T * bseq */
+  /* compute atbarray = aseq^T * bseq, with half of the flops when A and B are the same (a Gram matrix) */
   ierr = PetscBLASIntCast(a->A->cmap->n,&an);CHKERRQ(ierr);
   ierr = PetscBLASIntCast(b->A->cmap->n,&bn);CHKERRQ(ierr);
   ierr = PetscBLASIntCast(a->A->rmap->n,&am);CHKERRQ(ierr);
   ierr = PetscBLASIntCast(A->cmap->N,&aN);CHKERRQ(ierr);
-  PetscStackCallBLAS("BLASgemm",BLASgemm_("T","N",&an,&bn,&am,&_DOne,aseq->v,&aseq->lda,bseq->v,&bseq->lda,&_DZero,atbarray,&aN));
+  if (!am) {
+    ierr = PetscMemzero(atbarray,cM*cN*sizeof(PetscScalar));CHKERRQ(ierr);
+  } else if (A == B) {
+    PetscStackCallBLAS("BLASsyrk",BLASsyrk_("U","T",&an,&am,&_DOne,aseq->v,&aseq->lda,&_DZero,atbarray,&aN));
+    for (j=0; j<cN; j++) {
+      for (i=j+1; i<cM; i++) atbarray[i+j*cM] = atbarray[j+i*cM];
+    }
+    ierr = PetscLogFlops(1.0*an*(an+1)*am);CHKERRQ(ierr);
+  } else {
+    PetscStackCallBLAS("BLASgemm",BLASgemm_("T","N",&an,&bn,&am,&_DOne,aseq->v,&aseq->lda,bseq->v,&bseq->lda,&_DZero,atbarray,&aN));
+    ierr = PetscLogFlops(2.0*an*bn*am);CHKERRQ(ierr);
+  }
 
   ierr = MatGetOwnershipRanges(C,&ranges);CHKERRQ(ierr);
   for (i=0; i<size; i++) recvcounts[i] = (ranges[i+1] - ranges[i])*cN;
@@ -2247,6 +2299,8 @@ PetscErrorCode MatDestroy_MatMatMult_MPIDense_MPIDense(Mat A)
   ierr = MatDestroy(&ab->Ce);CHKERRQ(ierr);
   ierr = MatDestroy(&ab->Ae);CHKERRQ(ierr);
   ierr = MatDestroy(&ab->Be);CHKERRQ(ierr);
+  ierr = PetscFree2(ab->buf[0],ab->buf[1]);CHKERRQ(ierr);
+  ierr = PetscFree2(ab->recvcounts,ab->recvdispls);CHKERRQ(ierr);
 
   ierr = (ab->destroy)(A);CHKERRQ(ierr);
   ierr = PetscFree(ab);CHKERRQ(ierr);
@@ -2254,7 +2308,7 @@ PetscErrorCode MatDestroy_MatMatMult_MPIDense_MPIDense(Mat A)
 }
 
 #if defined(PETSC_HAVE_ELEMENTAL)
-PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense(Mat A,Mat B,Mat C)
+static PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense_Elemental(Mat A,Mat B,Mat C)
 {
   PetscErrorCode   ierr;
   Mat_MPIDense     *c=(Mat_MPIDense*)C->data;
@@ -2268,7 +2322,7 @@ PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense(Mat A,Mat B,Mat C)
   PetscFunctionReturn(0);
 }
 
-PetscErrorCode MatMatMultSymbolic_MPIDense_MPIDense(Mat A,Mat B,PetscReal fill,Mat *C)
+static PetscErrorCode MatMatMultSymbolic_MPIDense_MPIDense_Elemental(Mat A,Mat B,PetscReal fill,Mat *C)
 {
   PetscErrorCode   ierr;
   Mat              Ae,Be,Ce;
@@ -2276,10 +2330,6 @@ PetscErrorCode MatMatMultSymbolic_MPIDense_MPIDense(Mat A,Mat B,PetscReal fill,M
   Mat_MatMultDense *ab;
 
   PetscFunctionBegin;
-  if (A->cmap->rstart != B->rmap->rstart || A->cmap->rend != B->rmap->rend) {
-    SETERRQ4(PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_SIZ,"Matrix local dimensions are incompatible, A (%D, %D) != B (%D,%D)",A->rmap->rstart,A->rmap->rend,B->rmap->rstart,B->rmap->rend);
-  }
-
   /* convert A and B to Elemental matrices Ae and Be */
   ierr = MatConvert(A,MATELEMENTAL,MAT_INITIAL_MATRIX, &Ae);CHKERRQ(ierr);
   ierr = MatConvert(B,MATELEMENTAL,MAT_INITIAL_MATRIX, &Be);CHKERRQ(ierr);
@@ -2287,7 +2337,7 @@ PetscErrorCode MatMatMultSymbolic_MPIDense_MPIDense(Mat A,Mat B,PetscReal fill,M
   /* Ce = Ae*Be */
   ierr = MatMatMultSymbolic(Ae,Be,fill,&Ce);CHKERRQ(ierr);
   ierr = MatMatMultNumeric(Ae,Be,Ce);CHKERRQ(ierr);
- 
+
   /* convert Ce to C */
   ierr = MatConvert(Ce,MATMPIDENSE,MAT_INITIAL_MATRIX,C);CHKERRQ(ierr);
 
@@ -2299,27 +2349,241 @@ PetscErrorCode MatMatMultSymbolic_MPIDense_MPIDense(Mat A,Mat B,PetscReal fill,M
   ab->Ae             = Ae;
   ab->Be             = Be;
   ab->Ce             = Ce;
+  ab->alg            = 2;
   ab->destroy        = (*C)->ops->destroy;
   (*C)->ops->destroy        = MatDestroy_MatMatMult_MPIDense_MPIDense;
   (*C)->ops->matmultnumeric = MatMatMultNumeric_MPIDense_MPIDense;
   PetscFunctionReturn(0);
 }
+#endif
+
+/*
+   SUMMA on the row distribution of MPIDENSE: the columns of A matching the rows of B owned by process p
+   are local to every process, so step p broadcasts the rows of B owned by p and each process adds
+   A_local(:,rows of p) * B(rows of p,:) to its rows of C. The broadcast of the next block of rows
+   is overlapped with the local product when nonblocking collectives are available.
+*/
+static PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense_SUMMA(Mat A,Mat B,Mat C)
+{
+  Mat_MPIDense     *a=(Mat_MPIDense*)A->data, *b=(Mat_MPIDense*)B->data, *c=(Mat_MPIDense*)C->data;
+  Mat_SeqDense     *aseq=(Mat_SeqDense*)(a->A)->data, *bseq=(Mat_SeqDense*)(b->A)->data;
+  Mat_SeqDense     *cseq=(Mat_SeqDense*)(c->A)->data;
+  Mat_MatMultDense *ab = c->abdense;
+  PetscErrorCode   ierr;
+  MPI_Comm         comm;
+  PetscMPIInt      rank,size,p,q,count;
+  PetscScalar      *block[2],_DOne=1.0,beta=0.0;
+  PetscInt         i,j,bn,bN=B->cmap->N;
+  PetscBLASInt     cm,cn,ck,ldb;
+  const PetscInt   *ranges;
+#if defined(PETSC_HAVE_MPI_NONBLOCKING_COLLECTIVES)
+  MPI_Request      req;
+#endif
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)A,&comm);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(comm,&rank);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  ierr = MatGetOwnershipRanges(B,&ranges);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(c->A->rmap->n,&cm);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(bN,&cn);CHKERRQ(ierr);
+
+  /* the rows of B owned by process q go to ab->buf[q%2], the owner sends from its own storage when it is contiguous */
+  for (q=0; q<PetscMin(size,2); q++) {
+    block[q] = ab->buf[q];
+    if (rank == q) {
+      bn = ranges[q+1] - ranges[q];
+      if (bseq->lda == bn) block[q] = bseq->v;
+      else {
+        for (j=0; j<bN; j++) {
+          for (i=0; i<bn; i++) block[q][i+j*bn] = bseq->v[i+j*bseq->lda];
+        }
+      }
+    }
+  }
+  ierr = PetscMPIIntCast((ranges[1]-ranges[0])*bN,&count);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_MPI_NONBLOCKING_COLLECTIVES)
+  ierr = MPI_Ibcast(block[0],count,MPIU_SCALAR,0,comm,&req);CHKERRQ(ierr);
+#endif
+  for (p=0; p<size; p++) {
+    bn = ranges[p+1] - ranges[p];
+#if defined(PETSC_HAVE_MPI_NONBLOCKING_COLLECTIVES)
+    ierr = MPI_Wait(&req,MPI_STATUS_IGNORE);CHKERRQ(ierr);
+    if (p+1 < size) {
+      ierr = PetscMPIIntCast((ranges[p+2]-ranges[p+1])*bN,&count);CHKERRQ(ierr);
+      ierr = MPI_Ibcast(block[(p+1)%2],count,MPIU_SCALAR,p+1,comm,&req);CHKERRQ(ierr);
+    }
+#else
+    ierr = PetscMPIIntCast(bn*bN,&count);CHKERRQ(ierr);
+    ierr = MPI_Bcast(block[p%2],count,MPIU_SCALAR,p,comm);CHKERRQ(ierr);
+#endif
+    if (cm && bn) {
+      ierr = PetscBLASIntCast(bn,&ck);CHKERRQ(ierr);
+      ldb  = ck;
+      PetscStackCallBLAS("BLASgemm",BLASgemm_("N","N",&cm,&cn,&ck,&_DOne,aseq->v+ranges[p]*aseq->lda,&aseq->lda,block[p%2],&ldb,&beta,cseq->v,&cseq->lda));
+      beta = 1.0;
+    }
+    ierr = PetscLogFlops(2.0*cm*cn*bn);CHKERRQ(ierr);
+
+    /* the block of rows of B for step p+2 goes where the block of step p was */
+    if (p+2 < size) {
+      block[p%2] = ab->buf[p%2];
+      if (rank == p+2) {
+        bn = ranges[p+3] - ranges[p+2];
+        if (bseq->lda == bn) block[p%2] = bseq->v;
+        else {
+          for (j=0; j<bN; j++) {
+            for (i=0; i<bn; i++) block[p%2][i+j*bn] = bseq->v[i+j*bseq->lda];
+          }
+        }
+      }
+    }
+  }
+  if (beta == 0.0) { /* A has no columns */
+    for (j=0; j<cn; j++) {
+      ierr = PetscMemzero(cseq->v+j*cseq->lda,cm*sizeof(PetscScalar));CHKERRQ(ierr);
+    }
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense_Allgatherv(Mat A,Mat B,Mat C)
+{
+  Mat_MPIDense     *a=(Mat_MPIDense*)A->data, *b=(Mat_MPIDense*)B->data, *c=(Mat_MPIDense*)C->data;
+  Mat_SeqDense     *aseq=(Mat_SeqDense*)(a->A)->data, *bseq=(Mat_SeqDense*)(b->A)->data;
+  Mat_SeqDense     *cseq=(Mat_SeqDense*)(c->A)->data;
+  Mat_MatMultDense *ab = c->abdense;
+  PetscErrorCode   ierr;
+  MPI_Comm         comm;
+  PetscScalar      *sendbuf,*recvbuf,_DOne=1.0,_DZero=0.0;
+  PetscInt         i,j,bn=B->rmap->n,bN=B->cmap->N;
+  PetscMPIInt      count;
+  PetscBLASInt     cm,cn,ck,ldb;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)A,&comm);CHKERRQ(ierr);
+
+  /* gather B^T on all processes, so that each block of rows of B is contiguous */
+  sendbuf = ab->buf[0];
+  recvbuf = ab->buf[1];
+  for (i=0; i<bn; i++) {
+    for (j=0; j<bN; j++) sendbuf[j+i*bN] = bseq->v[i+j*bseq->lda];
+  }
+  ierr = PetscMPIIntCast(bn*bN,&count);CHKERRQ(ierr);
+  ierr = MPI_Allgatherv(sendbuf,count,MPIU_SCALAR,recvbuf,ab->recvcounts,ab->recvdispls,MPIU_SCALAR,comm);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(c->A->rmap->n,&cm);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(bN,&cn);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(A->cmap->N,&ck);CHKERRQ(ierr);
+  ldb  = PetscMax(1,cn);
+  if (cm) PetscStackCallBLAS("BLASgemm",BLASgemm_("N","T",&cm,&cn,&ck,&_DOne,aseq->v,&aseq->lda,recvbuf,&ldb,&_DZero,cseq->v,&cseq->lda));
+  ierr = PetscLogFlops(2.0*cm*cn*ck);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense(Mat A,Mat B,Mat C)
+{
+  Mat_MPIDense     *c=(Mat_MPIDense*)C->data;
+  Mat_MatMultDense *ab = c->abdense;
+  PetscErrorCode   ierr;
+
+  PetscFunctionBegin;
+  switch (ab->alg) {
+  case 1:
+    ierr = MatMatMultNumeric_MPIDense_MPIDense_Allgatherv(A,B,C);CHKERRQ(ierr);
+    break;
+#if defined(PETSC_HAVE_ELEMENTAL)
+  case 2:
+    ierr = MatMatMultNumeric_MPIDense_MPIDense_Elemental(A,B,C);CHKERRQ(ierr);
+    break;
+#endif
+  default:
+    ierr = MatMatMultNumeric_MPIDense_MPIDense_SUMMA(A,B,C);CHKERRQ(ierr);
+    break;
+  }
+  PetscFunctionReturn(0);
+}
+
+PetscErrorCode MatMatMultSymbolic_MPIDense_MPIDense(Mat A,Mat B,PetscReal fill,Mat *C)
+{
+  PetscErrorCode   ierr;
+  Mat              Cdense;
+  MPI_Comm         comm;
+  PetscMPIInt      i,size;
+  PetscInt         maxRows,bufsiz,bN=B->cmap->N;
+  Mat_MPIDense     *c;
+  Mat_MatMultDense *ab;
+  const char       *algTypes[3] = {"summa","allgatherv","elemental"};
+#if defined(PETSC_HAVE_ELEMENTAL)
+  PetscInt         alg,nalg = 3;
+#else
+  PetscInt         alg,nalg = 2;
+#endif
+
+  PetscFunctionBegin;
+  ierr = PetscObjectGetComm((PetscObject)A,&comm);CHKERRQ(ierr);
+  if (A->cmap->rstart != B->rmap->rstart || A->cmap->rend != B->rmap->rend) {
+    SETERRQ4(comm,PETSC_ERR_ARG_SIZ,"Matrix local dimensions are incompatible, A (%D, %D) != B (%D,%D)",A->cmap->rstart,A->cmap->rend,B->rmap->rstart,B->rmap->rend);
+  }
+  alg = 0; /* default is summa */
+  ierr = PetscOptionsBegin(comm,((PetscObject)A)->prefix,"MatMatMult","Mat");CHKERRQ(ierr);
+  ierr = PetscOptionsEList("-matmatmult_mpidense_mpidense_via","Algorithmic approach","MatMatMult",algTypes,nalg,algTypes[0],&alg,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsEnd();CHKERRQ(ierr);
+#if defined(PETSC_HAVE_ELEMENTAL)
+  if (alg == 2) {
+    ierr = MatMatMultSymbolic_MPIDense_MPIDense_Elemental(A,B,fill,C);CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+  }
+#endif
+
+  /* create matrix product Cdense */
+  ierr = MatCreate(comm,&Cdense);CHKERRQ(ierr);
+  ierr = MatSetSizes(Cdense,A->rmap->n,B->cmap->n,A->rmap->N,B->cmap->N);CHKERRQ(ierr);
+  ierr = MatSetType(Cdense,MATMPIDENSE);CHKERRQ(ierr);
+  ierr = MatMPIDenseSetPreallocation(Cdense,NULL);CHKERRQ(ierr);
+  ierr = MatAssemblyBegin(Cdense,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(Cdense,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  *C   = Cdense;
+
+  /* create data structure for reuse Cdense */
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  ierr = PetscNew(&ab);CHKERRQ(ierr);
+  ab->alg = alg;
+  switch (alg) {
+  case 1:
+    ierr = PetscMalloc2(B->rmap->n*bN,&ab->buf[0],B->rmap->N*bN,&ab->buf[1]);CHKERRQ(ierr);
+    ierr = PetscMalloc2(size,&ab->recvcounts,size+1,&ab->recvdispls);CHKERRQ(ierr);
+    for (i=0; i<=size; i++) {ierr = PetscMPIIntCast(B->rmap->range[i]*bN,&ab->recvdispls[i]);CHKERRQ(ierr);}
+    for (i=0; i<size; i++) ab->recvcounts[i] = ab->recvdispls[i+1] - ab->recvdispls[i];
+    break;
+  default:
+    for (maxRows=0, i=0; i<size; i++) maxRows = PetscMax(maxRows,B->rmap->range[i+1] - B->rmap->range[i]);
+    bufsiz = maxRows*bN;
+    ierr = PetscMalloc2(bufsiz,&ab->buf[0],bufsiz,&ab->buf[1]);CHKERRQ(ierr);
+    break;
+  }
+
+  c                        = (Mat_MPIDense*)Cdense->data;
+  c->abdense               = ab;
+  ab->destroy              = Cdense->ops->destroy;
+  Cdense->ops->destroy        = MatDestroy_MatMatMult_MPIDense_MPIDense;
+  Cdense->ops->matmultnumeric = MatMatMultNumeric_MPIDense_MPIDense;
+  PetscFunctionReturn(0);
+}
 
 PETSC_INTERN PetscErrorCode MatMatMult_MPIDense_MPIDense(Mat A,Mat B,MatReuse scall,PetscReal fill,Mat *C)
 {
   PetscErrorCode ierr;
 
   PetscFunctionBegin;
-  if (scall == MAT_INITIAL_MATRIX) { /* symbolic product includes numeric product */
+  if (scall == MAT_INITIAL_MATRIX) {
     ierr = PetscLogEventBegin(MAT_MatMultSymbolic,A,B,0,0);CHKERRQ(ierr);
     ierr = MatMatMultSymbolic_MPIDense_MPIDense(A,B,fill,C);CHKERRQ(ierr);
     ierr = PetscLogEventEnd(MAT_MatMultSymbolic,A,B,0,0);CHKERRQ(ierr);
-  } else {
-    ierr = PetscLogEventBegin(MAT_MatMultNumeric,A,B,0,0);CHKERRQ(ierr);
-    ierr = MatMatMultNumeric_MPIDense_MPIDense(A,B,*C);CHKERRQ(ierr);
-    ierr = PetscLogEventEnd(MAT_MatMultNumeric,A,B,0,0);CHKERRQ(ierr);
+    /* the symbolic product with Elemental includes the numeric product */
+    if (((Mat_MPIDense*)(*C)->data)->abdense->alg == 2) PetscFunctionReturn(0);
   }
+  ierr = PetscLogEventBegin(MAT_MatMultNumeric,A,B,0,0);CHKERRQ(ierr);
+  ierr = MatMatMultNumeric_MPIDense_MPIDense(A,B,*C);CHKERRQ(ierr);
+  ierr = PetscLogEventEnd(MAT_MatMultNumeric,A,B,0,0);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
-#endif
-
@@ -5,7 +5,11 @@
 
 typedef struct { /* used by MatMatMult_MPIDense_MPIDense() */
   Mat            Ae,Be,Ce;           /* matrix in Elemental format */
+  PetscScalar    *buf[2];            /* row blocks of B (summa) or all of B^T (allgatherv) */
+  PetscMPIInt    *recvcounts;
+  PetscMPIInt    *recvdispls;
   PetscErrorCode (*destroy)(Mat);
+  PetscInt       alg; /* algorithm used */
 } Mat_MatMultDense;
 
 typedef struct { /* used by MatTransposeMatMult_MPIDense_MPIDense() */
@@ -61,7 +65,5 @@ PETSC_INTERN PetscErrorCode MatTransposeMatMult_MPIDense_MPIDense(Mat,Mat,MatReu
 PETSC_INTERN PetscErrorCode MatTransposeMatMultSymbolic_MPIDense_MPIDense(Mat,Mat,PetscReal,Mat*);
 PETSC_INTERN PetscErrorCode MatTransposeMatMultNumeric_MPIDense_MPIDense(Mat,Mat,Mat);
 
-#if defined(PETSC_HAVE_ELEMENTAL)
 PETSC_INTERN PetscErrorCode MatMatMult_MPIDense_MPIDense(Mat,Mat,MatReuse,PetscReal,Mat*);
 PETSC_INTERN PetscErrorCode MatMatMultNumeric_MPIDense_MPIDense(Mat,Mat,Mat);
-#endif
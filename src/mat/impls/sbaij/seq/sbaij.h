@@ -22,6 +22,7 @@ typedef struct {
   PetscBool        ignore_ltriangular; /* if true, ignore the lower triangular values inserted by users */
   PetscBool        getrow_utriangular; /* if true, MatGetRow_SeqSBAIJ() is enabled to get the upper part of the row */
   Mat_SeqAIJ_Inode inode;
+  Mat_SeqAIJ_Levels levels;      /* level sets of an ICC factor, for the threaded MatSolve() */
   unsigned short   *jshort;
   PetscBool        free_jshort;
 } Mat_SeqSBAIJ;
@@ -128,6 +128,9 @@ PETSC_EXTERN PetscErrorCode MatSolverTypeRegister_Lusol(void);
 
 PETSC_INTERN PetscErrorCode MatGetFactor_seqaij_petsc(Mat,MatFactorType,Mat*);
 PETSC_INTERN PetscErrorCode MatGetFactor_seqbaij_petsc(Mat,MatFactorType,Mat*);
+#if !defined(PETSC_USE_COMPLEX)
+PETSC_INTERN PetscErrorCode MatGetFactor_seqaijmixed_petsc(Mat,MatFactorType,Mat*);
+#endif
 PETSC_INTERN PetscErrorCode MatGetFactor_seqsbaij_petsc(Mat,MatFactorType,Mat*);
 PETSC_INTERN PetscErrorCode MatGetFactor_seqdense_petsc(Mat,MatFactorType,Mat*);
 #if defined(PETSC_HAVE_CUDA)
@@ -271,6 +274,10 @@ PetscErrorCode  MatInitializePackage(void)
   ierr = PetscLogEventRegister("MatDenseCopyTo",MAT_CLASSID,&MAT_DenseCopyToGPU);CHKERRQ(ierr);
   ierr = PetscLogEventRegister("MatDenseCopyFrom",MAT_CLASSID,&MAT_DenseCopyFromGPU);CHKERRQ(ierr);
   ierr = PetscLogEventRegister("MatSetValBatch",MAT_CLASSID,&MAT_SetValuesBatch);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("MatPreallCOO",MAT_CLASSID,&MAT_PreallCOO);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("MatSetValCOO",MAT_CLASSID,&MAT_SetValuesCOO);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("MatLevelSets",MAT_CLASSID,&MAT_LevelSets);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("MatSolveLevels",MAT_CLASSID,&MAT_SolveLevels);CHKERRQ(ierr);
 
   ierr = PetscLogEventRegister("MatColoringApply",MAT_COLORING_CLASSID,&MATCOLORING_Apply);CHKERRQ(ierr);
   ierr = PetscLogEventRegister("MatColoringComm",MAT_COLORING_CLASSID,&MATCOLORING_Comm);CHKERRQ(ierr);
@@ -315,6 +322,14 @@ PetscErrorCode  MatInitializePackage(void)
   }
 
   /* Register the PETSc built in factorization based solvers */
+#if !defined(PETSC_USE_COMPLEX)
+  /* before MATSEQAIJ since the matrix types are matched by prefix */
+  ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJMIXED,   MAT_FACTOR_LU,MatGetFactor_seqaijmixed_petsc);CHKERRQ(ierr);
+  ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJMIXED,   MAT_FACTOR_CHOLESKY,MatGetFactor_seqaijmixed_petsc);CHKERRQ(ierr);
+  ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJMIXED,   MAT_FACTOR_ILU,MatGetFactor_seqaijmixed_petsc);CHKERRQ(ierr);
+  ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJMIXED,   MAT_FACTOR_ICC,MatGetFactor_seqaijmixed_petsc);CHKERRQ(ierr);
+#endif
+
   ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJ,        MAT_FACTOR_LU,MatGetFactor_seqaij_petsc);CHKERRQ(ierr);
   ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJ,        MAT_FACTOR_CHOLESKY,MatGetFactor_seqaij_petsc);CHKERRQ(ierr);
   ierr = MatSolverTypeRegister(MATSOLVERPETSC, MATSEQAIJ,        MAT_FACTOR_ILU,MatGetFactor_seqaij_petsc);CHKERRQ(ierr);
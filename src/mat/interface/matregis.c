@@ -31,6 +31,11 @@ PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJPERM(Mat);
 PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJSELL(Mat);
 PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJSELL(Mat);
 
+#if !defined(PETSC_USE_COMPLEX)
+PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJMixed(Mat);
+PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJMixed(Mat);
+#endif
+
 #if defined(PETSC_HAVE_MKL_SPARSE)
 PETSC_EXTERN PetscErrorCode MatCreate_SeqAIJMKL(Mat);
 PETSC_EXTERN PetscErrorCode MatCreate_MPIAIJMKL(Mat);
@@ -117,6 +122,12 @@ PetscErrorCode  MatRegisterAll(void)
   ierr = MatRegister(MATMPIAIJSELL,     MatCreate_MPIAIJSELL);CHKERRQ(ierr);
   ierr = MatRegister(MATSEQAIJSELL,     MatCreate_SeqAIJSELL);CHKERRQ(ierr);
 
+#if !defined(PETSC_USE_COMPLEX)
+  ierr = MatRegisterRootName(MATAIJMIXED,MATSEQAIJMIXED,MATMPIAIJMIXED);CHKERRQ(ierr);
+  ierr = MatRegister(MATMPIAIJMIXED,    MatCreate_MPIAIJMixed);CHKERRQ(ierr);
+  ierr = MatRegister(MATSEQAIJMIXED,    MatCreate_SeqAIJMixed);CHKERRQ(ierr);
+#endif
+
 #if defined(PETSC_HAVE_MKL_SPARSE)
   ierr = MatRegisterRootName(MATAIJMKL, MATSEQAIJMKL,MATMPIAIJMKL);CHKERRQ(ierr);
   ierr = MatRegister(MATMPIAIJMKL,      MatCreate_MPIAIJMKL);CHKERRQ(ierr);
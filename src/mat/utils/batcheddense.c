@@ -0,0 +1,405 @@
+
+/*
+   Batched LU factorization, triangular solves and products of many small dense blocks, used by PCVPBJACOBI and by
+   PCPATCH with -pc_patch_dense_inverse instead of one call per block.
+
+   The blocks of equal size n are grouped in batches of W = PETSC_BATCHED_DENSE_WIDTH blocks; entry (i,j) of lane l
+   of a batch is at a[(j*n+i)*W+l], so the innermost loops run over the lanes with unit stride and a fixed length.
+   The last batch of each size is padded with identity blocks.
+*/
+#include <petsc/private/kernels/batcheddense.h>
+
+#define W PETSC_BATCHED_DENSE_WIDTH
+
+struct _n_PetscBatchedDense {
+  PetscInt    nblocks,nbatch;
+  PetscInt    *xoff;     /* offset of each block in the vectors, nblocks+1 */
+  PetscInt    *loc;      /* batch*W + lane of each block, -1 for empty blocks */
+  PetscInt    *bsize;    /* size of the blocks of each batch */
+  PetscInt    *bblock;   /* block in each lane of each batch, -1 for padding */
+  PetscInt    *aoff;     /* offset of each batch in a, nbatch+1 */
+  PetscInt    *poff;     /* offset of each batch in piv and of its rows in the interleaved vectors, nbatch+1 */
+  PetscScalar *a;
+  PetscInt    *piv;      /* row interchanges of the factorization */
+  PetscScalar *work;     /* W*(largest block size) */
+};
+
+/*@C
+   PetscBatchedDenseCreate - Creates the storage for many small dense blocks, grouped in batches of blocks of equal size
+
+   Not Collective
+
+   Input Parameters:
++  nblocks - the number of blocks
+-  bsizes - the size of each block, may be zero
+
+   Output Parameter:
+.  bd - the batched blocks, all zero
+
+   Level: developer
+
+.seealso: PetscBatchedDenseSetBlock(), PetscBatchedDenseLUFactor(), PetscBatchedDenseLUSolve(), PetscBatchedDenseMult()
+@*/
+PetscErrorCode PetscBatchedDenseCreate(PetscInt nblocks,const PetscInt bsizes[],PetscBatchedDense *bd)
+{
+  PetscBatchedDense b;
+  PetscInt          i,j,k,l,n,nb,*size,*perm,maxsize = 0;
+  PetscErrorCode    ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscNew(&b);CHKERRQ(ierr);
+  b->nblocks = nblocks;
+  ierr = PetscMalloc2(nblocks+1,&b->xoff,nblocks,&b->loc);CHKERRQ(ierr);
+  ierr = PetscMalloc2(nblocks,&size,nblocks,&perm);CHKERRQ(ierr);
+  b->xoff[0] = 0;
+  for (i=0; i<nblocks; i++) {
+    b->xoff[i+1] = b->xoff[i] + bsizes[i];
+    b->loc[i]    = -1;
+    size[i]      = bsizes[i];
+    perm[i]      = i;
+    maxsize      = PetscMax(maxsize,bsizes[i]);
+  }
+  ierr = PetscSortIntWithArray(nblocks,size,perm);CHKERRQ(ierr);
+  for (i=0, nb=0; i<nblocks; i=j) {
+    for (j=i; j<nblocks && size[j] == size[i]; j++) ;
+    if (size[i]) nb += (j-i+W-1)/W;
+  }
+  b->nbatch = nb;
+  ierr = PetscMalloc5(nb,&b->bsize,nb*W,&b->bblock,nb+1,&b->aoff,nb+1,&b->poff,W*maxsize,&b->work);CHKERRQ(ierr);
+  b->aoff[0] = 0;
+  b->poff[0] = 0;
+  for (i=0, nb=0; i<nblocks; i=j) {
+    for (j=i; j<nblocks && size[j] == size[i]; j++) ;
+    if (!size[i]) continue;
+    n = size[i];
+    for (k=i; k<j; k+=W, nb++) {
+      b->bsize[nb]  = n;
+      b->aoff[nb+1] = b->aoff[nb] + n*n*W;
+      b->poff[nb+1] = b->poff[nb] + n*W;
+      for (l=0; l<W; l++) {
+        if (k+l < j) {
+          b->bblock[nb*W+l] = perm[k+l];
+          b->loc[perm[k+l]] = nb*W+l;
+        } else b->bblock[nb*W+l] = -1;
+      }
+    }
+  }
+  ierr = PetscFree2(size,perm);CHKERRQ(ierr);
+  ierr = PetscCalloc1(b->aoff[nb],&b->a);CHKERRQ(ierr);
+  ierr = PetscCalloc1(b->poff[nb],&b->piv);CHKERRQ(ierr);
+  for (k=0; k<nb; k++) {
+    n = b->bsize[k];
+    for (l=0; l<W; l++) {
+      if (b->bblock[k*W+l] >= 0) continue;
+      for (i=0; i<n; i++) b->a[b->aoff[k]+(i*n+i)*W+l] = 1.0;
+    }
+  }
+  *bd = b;
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscBatchedDenseDestroy - Destroys batched dense blocks
+
+   Not Collective
+
+   Input Parameter:
+.  bd - the batched blocks
+
+   Level: developer
+
+.seealso: PetscBatchedDenseCreate()
+@*/
+PetscErrorCode PetscBatchedDenseDestroy(PetscBatchedDense *bd)
+{
+  PetscBatchedDense b = *bd;
+  PetscErrorCode    ierr;
+
+  PetscFunctionBegin;
+  if (!b) PetscFunctionReturn(0);
+  ierr = PetscFree2(b->xoff,b->loc);CHKERRQ(ierr);
+  ierr = PetscFree5(b->bsize,b->bblock,b->aoff,b->poff,b->work);CHKERRQ(ierr);
+  ierr = PetscFree(b->a);CHKERRQ(ierr);
+  ierr = PetscFree(b->piv);CHKERRQ(ierr);
+  ierr = PetscFree(b);CHKERRQ(ierr);
+  *bd  = NULL;
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscBatchedDenseSetBlock - Sets the entries of a block
+
+   Not Collective
+
+   Input Parameters:
++  bd - the batched blocks
+.  blk - the block
+.  v - the entries of the block, stored by columns
+-  lda - the leading dimension of v
+
+   Level: developer
+
+.seealso: PetscBatchedDenseCreate(), PetscBatchedDenseLUFactor()
+@*/
+PetscErrorCode PetscBatchedDenseSetBlock(PetscBatchedDense bd,PetscInt blk,const PetscScalar v[],PetscInt lda)
+{
+  PetscInt    i,j,n,l,bt;
+  PetscScalar *a;
+
+  PetscFunctionBegin;
+  if (blk < 0 || blk >= bd->nblocks) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Block %D not in [0,%D)",blk,bd->nblocks);
+  if (bd->loc[blk] < 0) PetscFunctionReturn(0);
+  bt = bd->loc[blk]/W;
+  l  = bd->loc[blk]%W;
+  n  = bd->bsize[bt];
+  a  = bd->a + bd->aoff[bt];
+  for (j=0; j<n; j++) {
+    for (i=0; i<n; i++) a[(j*n+i)*W+l] = v[i+j*lda];
+  }
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscBatchedDenseLUFactor - LU factorization with partial pivoting of all the blocks, in place
+
+   Not Collective
+
+   Input Parameters:
++  bd - the batched blocks
+-  allowzeropivot - do not generate an error for a zero pivot
+
+   Output Parameter:
+.  zeropivotdetected - a zero pivot was found, may be NULL when allowzeropivot is PETSC_FALSE
+
+   Notes:
+   The rows of the factors are interchanged as in LAPACK getrf; the reciprocals of the diagonal of U are stored.
+
+   Level: developer
+
+.seealso: PetscBatchedDenseLUSolve(), PetscBatchedDenseLUSolveBlock()
+@*/
+PetscErrorCode PetscBatchedDenseLUFactor(PetscBatchedDense bd,PetscBool allowzeropivot,PetscBool *zeropivotdetected)
+{
+  PetscErrorCode ierr;
+  PetscInt       bt,n,i,j,k,l,p[W];
+  PetscReal      amax[W],t;
+  PetscScalar    *a,d[W],s;
+  PetscInt       *piv;
+
+  PetscFunctionBegin;
+  if (zeropivotdetected) *zeropivotdetected = PETSC_FALSE;
+  for (bt=0; bt<bd->nbatch; bt++) {
+    n   = bd->bsize[bt];
+    a   = bd->a + bd->aoff[bt];
+    piv = bd->piv + bd->poff[bt];
+    for (k=0; k<n; k++) {
+      /* pivot of column k in each lane */
+      for (l=0; l<W; l++) {
+        p[l]    = k;
+        amax[l] = PetscAbsScalar(a[(k*n+k)*W+l]);
+      }
+      for (i=k+1; i<n; i++) {
+        for (l=0; l<W; l++) {
+          t = PetscAbsScalar(a[(k*n+i)*W+l]);
+          if (t > amax[l]) {amax[l] = t; p[l] = i;}
+        }
+      }
+      for (l=0; l<W; l++) {
+        piv[k*W+l] = p[l];
+        if (amax[l] == 0.0) {
+          if (!allowzeropivot) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_MAT_LU_ZRPVT,"Zero pivot in row %D of block %D",k,bd->bblock[bt*W+l]);
+          ierr = PetscInfo2(NULL,"Zero pivot in row %D of block %D\n",k,bd->bblock[bt*W+l]);CHKERRQ(ierr);
+          *zeropivotdetected = PETSC_TRUE;
+        }
+        if (p[l] != k) {
+          for (j=0; j<n; j++) {
+            s                   = a[(j*n+k)*W+l];
+            a[(j*n+k)*W+l]      = a[(j*n+p[l])*W+l];
+            a[(j*n+p[l])*W+l]   = s;
+          }
+        }
+      }
+      for (l=0; l<W; l++) {
+        d[l]           = 1.0/a[(k*n+k)*W+l];
+        a[(k*n+k)*W+l] = d[l];
+      }
+      for (i=k+1; i<n; i++) {
+        for (l=0; l<W; l++) a[(k*n+i)*W+l] *= d[l];
+      }
+      /* rank one update of the trailing block */
+      for (j=k+1; j<n; j++) {
+        for (i=k+1; i<n; i++) {
+          for (l=0; l<W; l++) a[(j*n+i)*W+l] -= a[(k*n+i)*W+l]*a[(j*n+k)*W+l];
+        }
+      }
+    }
+  }
+  for (bt=0; bt<bd->nbatch; bt++) {ierr = PetscLogFlops((2.0/3.0)*W*bd->bsize[bt]*bd->bsize[bt]*bd->bsize[bt]);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+/* solve with the factors of a batch, for the right hand sides x interleaved as the rows of the blocks */
+PETSC_STATIC_INLINE void PetscBatchedDenseLUSolve_Private(PetscInt n,const PetscScalar *a,const PetscInt *piv,PetscScalar *x)
+{
+  PetscInt    i,k,l;
+  PetscScalar s;
+
+  for (k=0; k<n; k++) {
+    for (l=0; l<W; l++) {
+      const PetscInt p = piv[k*W+l];
+      s            = x[k*W+l];
+      x[k*W+l]     = x[p*W+l];
+      x[p*W+l]     = s;
+    }
+  }
+  for (k=0; k<n; k++) {
+    for (i=k+1; i<n; i++) {
+      for (l=0; l<W; l++) x[i*W+l] -= a[(k*n+i)*W+l]*x[k*W+l];
+    }
+  }
+  for (k=n-1; k>=0; k--) {
+    for (l=0; l<W; l++) x[k*W+l] *= a[(k*n+k)*W+l];
+    for (i=0; i<k; i++) {
+      for (l=0; l<W; l++) x[i*W+l] -= a[(k*n+i)*W+l]*x[k*W+l];
+    }
+  }
+}
+
+/*@C
+   PetscBatchedDenseLUSolve - Solves with all the factored blocks
+
+   Not Collective
+
+   Input Parameters:
++  bd - the batched blocks, factored with PetscBatchedDenseLUFactor()
+-  x - the right hand sides of the blocks, one after the other in the order of the blocks
+
+   Output Parameter:
+.  y - the solutions, may be the same as x
+
+   Level: developer
+
+.seealso: PetscBatchedDenseLUFactor(), PetscBatchedDenseLUSolveBlock()
+@*/
+PetscErrorCode PetscBatchedDenseLUSolve(PetscBatchedDense bd,const PetscScalar x[],PetscScalar y[])
+{
+  PetscErrorCode ierr;
+  PetscInt       bt,n,i,l,blk;
+  PetscScalar    *xw = bd->work;
+
+  PetscFunctionBegin;
+  for (bt=0; bt<bd->nbatch; bt++) {
+    n = bd->bsize[bt];
+    for (l=0; l<W; l++) {
+      blk = bd->bblock[bt*W+l];
+      if (blk < 0) for (i=0; i<n; i++) xw[i*W+l] = 0.0;
+      else         for (i=0; i<n; i++) xw[i*W+l] = x[bd->xoff[blk]+i];
+    }
+    PetscBatchedDenseLUSolve_Private(n,bd->a+bd->aoff[bt],bd->piv+bd->poff[bt],xw);
+    for (l=0; l<W; l++) {
+      blk = bd->bblock[bt*W+l];
+      if (blk >= 0) for (i=0; i<n; i++) y[bd->xoff[blk]+i] = xw[i*W+l];
+    }
+  }
+  ierr = PetscLogFlops(2.0*bd->aoff[bd->nbatch]);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscBatchedDenseLUSolveBlock - Solves with one factored block
+
+   Not Collective
+
+   Input Parameters:
++  bd - the batched blocks, factored with PetscBatchedDenseLUFactor()
+.  blk - the block
+-  x - the right hand side
+
+   Output Parameter:
+.  y - the solution, may be the same as x
+
+   Level: developer
+
+.seealso: PetscBatchedDenseLUFactor(), PetscBatchedDenseLUSolve()
+@*/
+PetscErrorCode PetscBatchedDenseLUSolveBlock(PetscBatchedDense bd,PetscInt blk,const PetscScalar x[],PetscScalar y[])
+{
+  PetscErrorCode    ierr;
+  PetscInt          bt,n,i,k,l,p;
+  const PetscScalar *a;
+  const PetscInt    *piv;
+  PetscScalar       s,*xw = bd->work;
+
+  PetscFunctionBegin;
+  if (blk < 0 || blk >= bd->nblocks) SETERRQ2(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Block %D not in [0,%D)",blk,bd->nblocks);
+  if (bd->loc[blk] < 0) PetscFunctionReturn(0);
+  bt  = bd->loc[blk]/W;
+  l   = bd->loc[blk]%W;
+  n   = bd->bsize[bt];
+  a   = bd->a + bd->aoff[bt] + l;
+  piv = bd->piv + bd->poff[bt] + l;
+  for (i=0; i<n; i++) xw[i] = x[i];
+  for (k=0; k<n; k++) {
+    p     = piv[k*W];
+    s     = xw[k];
+    xw[k] = xw[p];
+    xw[p] = s;
+  }
+  for (k=0; k<n; k++) {
+    for (i=k+1; i<n; i++) xw[i] -= a[(k*n+i)*W]*xw[k];
+  }
+  for (k=n-1; k>=0; k--) {
+    xw[k] *= a[(k*n+k)*W];
+    for (i=0; i<k; i++) xw[i] -= a[(k*n+i)*W]*xw[k];
+  }
+  for (i=0; i<n; i++) y[i] = xw[i];
+  ierr = PetscLogFlops(2.0*n*n);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscBatchedDenseMult - Multiplies by all the (not factored) blocks
+
+   Not Collective
+
+   Input Parameters:
++  bd - the batched blocks
+-  x - the vectors of the blocks, one after the other in the order of the blocks
+
+   Output Parameter:
+.  y - the products, may not be the same as x
+
+   Level: developer
+
+.seealso: PetscBatchedDenseSetBlock()
+@*/
+PetscErrorCode PetscBatchedDenseMult(PetscBatchedDense bd,const PetscScalar x[],PetscScalar y[])
+{
+  PetscErrorCode    ierr;
+  PetscInt          bt,n,i,j,l,blk;
+  const PetscScalar *a;
+  PetscScalar       *xw = bd->work,yw[W];
+
+  PetscFunctionBegin;
+  for (bt=0; bt<bd->nbatch; bt++) {
+    n = bd->bsize[bt];
+    a = bd->a + bd->aoff[bt];
+    for (l=0; l<W; l++) {
+      blk = bd->bblock[bt*W+l];
+      if (blk < 0) for (j=0; j<n; j++) xw[j*W+l] = 0.0;
+      else         for (j=0; j<n; j++) xw[j*W+l] = x[bd->xoff[blk]+j];
+    }
+    for (i=0; i<n; i++) {
+      for (l=0; l<W; l++) yw[l] = 0.0;
+      for (j=0; j<n; j++) {
+        for (l=0; l<W; l++) yw[l] += a[(j*n+i)*W+l]*xw[j*W+l];
+      }
+      for (l=0; l<W; l++) {
+        blk = bd->bblock[bt*W+l];
+        if (blk >= 0) y[bd->xoff[blk]+i] = yw[l];
+      }
+    }
+  }
+  ierr = PetscLogFlops(2.0*bd->aoff[bd->nbatch]);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
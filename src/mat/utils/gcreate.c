@@ -322,6 +322,153 @@ PetscErrorCode MatXAIJSetPreallocation(Mat A,PetscInt bs,const PetscInt dnnz[],c
   PetscFunctionReturn(0);
 }
 
+static PetscErrorCode MatCOOContainerDestroy_Private(void *ptr)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscFree(ptr);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*
+   Fallback for matrix types without a native COO implementation: remember the coordinates and
+   replay them through MatSetValues() and a full assembly on each MatSetValuesCOO() call
+*/
+static PetscErrorCode MatSetPreallocationCOO_Basic(Mat A,PetscInt ncoo,const PetscInt coo_i[],const PetscInt coo_j[])
+{
+  PetscErrorCode ierr;
+  PetscContainer container;
+  PetscInt       *ij;
+
+  PetscFunctionBegin;
+  ierr = PetscMalloc1(2*ncoo+1,&ij);CHKERRQ(ierr);
+  ij[0] = ncoo;
+  ierr = PetscArraycpy(ij+1,coo_i,ncoo);CHKERRQ(ierr);
+  ierr = PetscArraycpy(ij+1+ncoo,coo_j,ncoo);CHKERRQ(ierr);
+  ierr = PetscContainerCreate(PETSC_COMM_SELF,&container);CHKERRQ(ierr);
+  ierr = PetscContainerSetPointer(container,ij);CHKERRQ(ierr);
+  ierr = PetscContainerSetUserDestroy(container,MatCOOContainerDestroy_Private);CHKERRQ(ierr);
+  ierr = PetscObjectCompose((PetscObject)A,"__PETSc_coo_ij",(PetscObject)container);CHKERRQ(ierr);
+  ierr = PetscContainerDestroy(&container);CHKERRQ(ierr);
+  ierr = MatSetUp(A);CHKERRQ(ierr);
+  ierr = MatSetOption(A,MAT_NEW_NONZERO_ALLOCATION_ERR,PETSC_FALSE);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode MatSetValuesCOO_Basic(Mat A,const PetscScalar coo_v[],InsertMode imode)
+{
+  PetscErrorCode ierr;
+  PetscContainer container;
+  PetscInt       *ij,ncoo,k;
+
+  PetscFunctionBegin;
+  ierr = PetscObjectQuery((PetscObject)A,"__PETSc_coo_ij",(PetscObject*)&container);CHKERRQ(ierr);
+  if (!container) SETERRQ(PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_WRONGSTATE,"Must call MatSetPreallocationCOO() first");
+  ierr = PetscContainerGetPointer(container,(void**)&ij);CHKERRQ(ierr);
+  ncoo = ij[0];
+  if (imode == INSERT_VALUES) {ierr = MatZeroEntries(A);CHKERRQ(ierr);}
+  for (k=0; k<ncoo; k++) {
+    ierr = MatSetValue(A,ij[1+k],ij[1+ncoo+k],coo_v ? coo_v[k] : 0.0,ADD_VALUES);CHKERRQ(ierr);
+  }
+  ierr = MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  ierr = MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   MatSetPreallocationCOO - set the nonzero pattern of a matrix from a list of coordinates (COO format) that will be
+   reused by every subsequent MatSetValuesCOO()
+
+   Collective on Mat
+
+   Input Arguments:
++  A - matrix being preallocated
+.  ncoo - number of entries provided by this process
+.  coo_i - global row index of each entry
+-  coo_j - global column index of each entry
+
+   Notes:
+   Entries may appear more than once, in which case their values are summed by MatSetValuesCOO(). Entries with a negative
+   row or column index are ignored. Rows need not be owned by the calling process.
+
+   For MATSEQAIJ and MATMPIAIJ the permutation of the coordinates into the compressed row storage and the pattern of the
+   off-process communication are computed here, once, so that each MatSetValuesCOO() is a single gather with no searching,
+   sorting or stashing. The nonzero pattern of the matrix is fixed after this call; inserting a new nonzero with
+   MatSetValues() is an error.
+
+   Level: beginner
+
+.seealso: MatSetValuesCOO(), MatSeqAIJSetPreallocation(), MatMPIAIJSetPreallocation(), MatXAIJSetPreallocation()
+@*/
+PetscErrorCode MatSetPreallocationCOO(Mat A,PetscInt ncoo,const PetscInt coo_i[],const PetscInt coo_j[])
+{
+  PetscErrorCode ierr;
+  PetscErrorCode (*f)(Mat,PetscInt,const PetscInt[],const PetscInt[]) = NULL;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidType(A,1);
+  if (ncoo < 0) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of COO entries cannot be negative %D",ncoo);
+  if (ncoo) {
+    PetscValidIntPointer(coo_i,3);
+    PetscValidIntPointer(coo_j,4);
+  }
+  ierr = PetscLayoutSetUp(A->rmap);CHKERRQ(ierr);
+  ierr = PetscLayoutSetUp(A->cmap);CHKERRQ(ierr);
+  ierr = PetscObjectQueryFunction((PetscObject)A,"MatSetPreallocationCOO_C",&f);CHKERRQ(ierr);
+  ierr = PetscLogEventBegin(MAT_PreallCOO,A,0,0,0);CHKERRQ(ierr);
+  if (f) {
+    ierr = (*f)(A,ncoo,coo_i,coo_j);CHKERRQ(ierr);
+  } else {
+    ierr = MatSetPreallocationCOO_Basic(A,ncoo,coo_i,coo_j);CHKERRQ(ierr);
+  }
+  ierr = PetscLogEventEnd(MAT_PreallCOO,A,0,0,0);CHKERRQ(ierr);
+  ierr = PetscObjectStateIncrease((PetscObject)A);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   MatSetValuesCOO - set the values of a matrix whose nonzero pattern was given with MatSetPreallocationCOO()
+
+   Collective on Mat
+
+   Input Arguments:
++  A - matrix being assembled
+.  coo_v - values, in the same order as the coordinates passed to MatSetPreallocationCOO(), or NULL to use zeros
+-  imode - INSERT_VALUES to replace the current values, ADD_VALUES to add to them
+
+   Notes:
+   Values of repeated coordinates are summed in both modes. The matrix is assembled on return; there is no need to call
+   MatAssemblyBegin() and MatAssemblyEnd().
+
+   Level: beginner
+
+.seealso: MatSetPreallocationCOO(), MatSetValues(), InsertMode, INSERT_VALUES, ADD_VALUES
+@*/
+PetscErrorCode MatSetValuesCOO(Mat A,const PetscScalar coo_v[],InsertMode imode)
+{
+  PetscErrorCode ierr;
+  PetscErrorCode (*f)(Mat,const PetscScalar[],InsertMode) = NULL;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(A,MAT_CLASSID,1);
+  PetscValidType(A,1);
+  MatCheckPreallocated(A,1);
+  PetscValidLogicalCollectiveEnum(A,imode,3);
+  if (imode != INSERT_VALUES && imode != ADD_VALUES) SETERRQ(PetscObjectComm((PetscObject)A),PETSC_ERR_ARG_WRONG,"Only INSERT_VALUES and ADD_VALUES are supported");
+  ierr = PetscObjectQueryFunction((PetscObject)A,"MatSetValuesCOO_C",&f);CHKERRQ(ierr);
+  ierr = PetscLogEventBegin(MAT_SetValuesCOO,A,0,0,0);CHKERRQ(ierr);
+  if (f) {
+    ierr = (*f)(A,coo_v,imode);CHKERRQ(ierr);
+  } else {
+    ierr = MatSetValuesCOO_Basic(A,coo_v,imode);CHKERRQ(ierr);
+  }
+  ierr = PetscLogEventEnd(MAT_SetValuesCOO,A,0,0,0);CHKERRQ(ierr);
+  ierr = PetscObjectStateIncrease((PetscObject)A);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
 /*
         Merges some information from Cs header to A; the C object is then destroyed
 
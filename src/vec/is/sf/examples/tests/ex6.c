@@ -0,0 +1,144 @@
+static char help[]= "Test PetscSFBatch, broadcasts and reductions on star forests with different graphs and units grouped in one exchange\n\n";
+
+#include <petsc.h>
+#include <petscsf.h>
+
+/* Number of entries of a and b that differ, summed over all processes */
+static PetscErrorCode CountDiff(PetscInt n,const PetscReal *a,const PetscReal *b,PetscInt *ndiff)
+{
+  PetscErrorCode ierr;
+  PetscInt       i,nd = 0;
+
+  PetscFunctionBegin;
+  for (i=0; i<n; i++) if (a[i] != b[i]) nd++;
+  ierr = MPIU_Allreduce(&nd,ndiff,1,MPIU_INT,MPI_SUM,PETSC_COMM_WORLD);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+int main(int argc, char **argv)
+{
+  PetscErrorCode ierr;
+  PetscSF        sfA,sfB,sfC;
+  PetscLayout    map;
+  PetscSFBatch   batch;
+  PetscSFNode    *iremote;
+  PetscInt       *ilocal,i,round,ndiff[4];
+  PetscInt       nrootsA = 4,nleavesA = 7,nrootsB = 3,nleavesB = 6;
+  PetscInt       *rootA,*leafA,*leafA2,rootC[2],*leafC,*leafC2;
+  PetscReal      *rootB,*leafB,*rootB1,*rootB2,*leafB1,*leafB2,*lA,*lA2;
+  PetscMPIInt    rank,size;
+  MPI_Datatype   unitB;
+
+  ierr = PetscInitialize(&argc,&argv,NULL,help);if (ierr) return ierr;
+  ierr = MPI_Comm_size(PETSC_COMM_WORLD,&size);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(PETSC_COMM_WORLD,&rank);CHKERRQ(ierr);
+
+  /* sfA: contiguous leaves on the previous, the same and the next process */
+  ierr = PetscMalloc1(nleavesA,&iremote);CHKERRQ(ierr);
+  for (i=0; i<nleavesA; i++) {
+    iremote[i].rank  = (rank+size+i%3-1)%size;
+    iremote[i].index = (3*i+1)%nrootsA;
+  }
+  ierr = PetscSFCreate(PETSC_COMM_WORLD,&sfA);CHKERRQ(ierr);
+  ierr = PetscSFSetFromOptions(sfA);CHKERRQ(ierr);
+  ierr = PetscSFSetGraph(sfA,nrootsA,nleavesA,NULL,PETSC_OWN_POINTER,iremote,PETSC_OWN_POINTER);CHKERRQ(ierr);
+  ierr = PetscSFSetUp(sfA);CHKERRQ(ierr);
+
+  /* sfB: sparse leaves, in reverse order, on the next two processes */
+  ierr = PetscMalloc1(nleavesB,&iremote);CHKERRQ(ierr);
+  ierr = PetscMalloc1(nleavesB,&ilocal);CHKERRQ(ierr);
+  for (i=0; i<nleavesB; i++) {
+    iremote[i].rank  = (rank+1+i%2)%size;
+    iremote[i].index = i%nrootsB;
+    ilocal[i]        = 2*(nleavesB-i)-1;
+  }
+  ierr = PetscSFCreate(PETSC_COMM_WORLD,&sfB);CHKERRQ(ierr);
+  ierr = PetscSFSetFromOptions(sfB);CHKERRQ(ierr);
+  ierr = PetscSFSetGraph(sfB,nrootsB,nleavesB,ilocal,PETSC_OWN_POINTER,iremote,PETSC_OWN_POINTER);CHKERRQ(ierr);
+  ierr = PetscSFSetUp(sfB);CHKERRQ(ierr);
+
+  /* sfC: an allgather, which the batch leaves to its own implementation */
+  ierr = PetscLayoutCreate(PETSC_COMM_WORLD,&map);CHKERRQ(ierr);
+  ierr = PetscLayoutSetLocalSize(map,2);CHKERRQ(ierr);
+  ierr = PetscLayoutSetUp(map);CHKERRQ(ierr);
+  ierr = PetscSFCreate(PETSC_COMM_WORLD,&sfC);CHKERRQ(ierr);
+  ierr = PetscSFSetGraphWithPattern(sfC,map,PETSCSF_PATTERN_ALLGATHER);CHKERRQ(ierr);
+  ierr = PetscSFSetUp(sfC);CHKERRQ(ierr);
+  ierr = PetscLayoutDestroy(&map);CHKERRQ(ierr);
+  ierr = PetscMalloc2(2*size,&leafC,2*size,&leafC2);CHKERRQ(ierr);
+
+  /* sfB moves three reals per node */
+  ierr = MPI_Type_contiguous(3,MPIU_REAL,&unitB);CHKERRQ(ierr);
+  ierr = MPI_Type_commit(&unitB);CHKERRQ(ierr);
+  ierr = PetscMalloc3(nrootsA,&rootA,nleavesA,&leafA,nleavesA,&leafA2);CHKERRQ(ierr);
+  ierr = PetscMalloc2(nleavesA,&lA,nleavesA,&lA2);CHKERRQ(ierr);
+  ierr = PetscMalloc6(3*nrootsB,&rootB,3*nrootsB,&rootB1,3*nrootsB,&rootB2,6*nleavesB,&leafB,6*nleavesB,&leafB1,6*nleavesB,&leafB2);CHKERRQ(ierr);
+
+  ierr = PetscSFBatchCreate(PETSC_COMM_WORLD,&batch);CHKERRQ(ierr);
+  for (round=0; round<3; round++) {
+    for (i=0; i<nrootsA; i++) rootA[i] = 100*rank+10*round+i;
+    for (i=0; i<nleavesA; i++) leafA[i] = leafA2[i] = -1;
+    for (i=0; i<3*nrootsB; i++) rootB[i] = rootB1[i] = rootB2[i] = 0.5*rank+i;
+    for (i=0; i<6*nleavesB; i++) {leafB[i] = 1000*rank+i+round; leafB1[i] = leafB2[i] = i;}
+    for (i=0; i<2; i++) rootC[i] = 10*rank+i+round;
+
+    /* The last round queues the operations in another order, so the batch builds a new plan */
+    if (round < 2) {
+      ierr = PetscSFBatchAddBcastAndOp(batch,sfA,MPIU_INT,rootA,leafA,MPIU_REPLACE);CHKERRQ(ierr);
+      ierr = PetscSFBatchAddReduce(batch,sfB,unitB,leafB,rootB1,MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFBatchAddBcastAndOp(batch,sfB,unitB,rootB,leafB1,MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFBatchAddBcastAndOp(batch,sfC,MPIU_INT,rootC,leafC,MPIU_REPLACE);CHKERRQ(ierr);
+    } else {
+      ierr = PetscSFBatchAddBcastAndOp(batch,sfC,MPIU_INT,rootC,leafC,MPIU_REPLACE);CHKERRQ(ierr);
+      ierr = PetscSFBatchAddBcastAndOp(batch,sfB,unitB,rootB,leafB1,MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFBatchAddReduce(batch,sfB,unitB,leafB,rootB1,MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFBatchAddBcastAndOp(batch,sfA,MPIU_INT,rootA,leafA,MPIU_REPLACE);CHKERRQ(ierr);
+    }
+    ierr = PetscSFBatchBegin(batch);CHKERRQ(ierr);
+    ierr = PetscSFBatchEnd(batch);CHKERRQ(ierr);
+
+    ierr = PetscSFBcastBegin(sfA,MPIU_INT,rootA,leafA2);CHKERRQ(ierr);
+    ierr = PetscSFBcastEnd(sfA,MPIU_INT,rootA,leafA2);CHKERRQ(ierr);
+    ierr = PetscSFBcastBegin(sfC,MPIU_INT,rootC,leafC2);CHKERRQ(ierr);
+    ierr = PetscSFBcastEnd(sfC,MPIU_INT,rootC,leafC2);CHKERRQ(ierr);
+    ierr = PetscSFReduceBegin(sfB,unitB,leafB,rootB2,MPIU_SUM);CHKERRQ(ierr);
+    ierr = PetscSFReduceEnd(sfB,unitB,leafB,rootB2,MPIU_SUM);CHKERRQ(ierr);
+    ierr = PetscSFBcastAndOpBegin(sfB,unitB,rootB,leafB2,MPIU_SUM);CHKERRQ(ierr);
+    ierr = PetscSFBcastAndOpEnd(sfB,unitB,rootB,leafB2,MPIU_SUM);CHKERRQ(ierr);
+
+    for (i=0; i<nleavesA; i++) {lA[i] = (PetscReal)leafA[i]; lA2[i] = (PetscReal)leafA2[i];}
+    ierr = CountDiff(nleavesA,lA,lA2,&ndiff[0]);CHKERRQ(ierr);
+    ierr = CountDiff(3*nrootsB,rootB1,rootB2,&ndiff[1]);CHKERRQ(ierr);
+    ierr = CountDiff(6*nleavesB,leafB1,leafB2,&ndiff[2]);CHKERRQ(ierr);
+    for (i=0, ndiff[3]=0; i<2*size; i++) if (leafC[i] != leafC2[i]) ndiff[3]++;
+    ierr = MPIU_Allreduce(MPI_IN_PLACE,&ndiff[3],1,MPIU_INT,MPI_SUM,PETSC_COMM_WORLD);CHKERRQ(ierr);
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Round %D: differences with the individual operations %D %D %D %D\n",round,ndiff[0],ndiff[1],ndiff[2],ndiff[3]);CHKERRQ(ierr);
+  }
+
+  ierr = PetscSFBatchDestroy(&batch);CHKERRQ(ierr);
+  ierr = PetscFree3(rootA,leafA,leafA2);CHKERRQ(ierr);
+  ierr = PetscFree2(lA,lA2);CHKERRQ(ierr);
+  ierr = PetscFree2(leafC,leafC2);CHKERRQ(ierr);
+  ierr = PetscFree6(rootB,rootB1,rootB2,leafB,leafB1,leafB2);CHKERRQ(ierr);
+  ierr = MPI_Type_free(&unitB);CHKERRQ(ierr);
+  ierr = PetscSFDestroy(&sfA);CHKERRQ(ierr);
+  ierr = PetscSFDestroy(&sfB);CHKERRQ(ierr);
+  ierr = PetscSFDestroy(&sfC);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+     nsize: {{1 3}}
+     args: -sf_type basic
+
+   test:
+     suffix: neighbor
+     nsize: 3
+     output_file: output/ex6_1.out
+     args: -sf_type neighbor
+     requires: define(PETSC_HAVE_MPI_NEIGHBORHOOD_COLLECTIVES)
+
+TEST*/
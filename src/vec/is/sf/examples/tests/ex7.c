@@ -0,0 +1,101 @@
+static char help[]= "Test the threaded packing and unpacking of PetscSF against the serial routines, on a graph whose roots have many leaves\n\n";
+
+#include <petsc.h>
+#include <petscsf.h>
+
+/* Number of entries of a and b that differ, summed over all processes */
+static PetscErrorCode CountDiff(PetscInt n,const PetscReal *a,const PetscReal *b,PetscInt *ndiff)
+{
+  PetscErrorCode ierr;
+  PetscInt       i,nd = 0;
+
+  PetscFunctionBegin;
+  for (i=0; i<n; i++) if (a[i] != b[i]) nd++;
+  ierr = MPIU_Allreduce(&nd,ndiff,1,MPIU_INT,MPI_SUM,PETSC_COMM_WORLD);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+int main(int argc, char **argv)
+{
+  PetscErrorCode ierr;
+  PetscSF        sf[2];
+  PetscSFNode    *iremote;
+  PetscInt       *ilocal,i,j,s,bs,nroots = 1000,nleaves = 10000,ndiff[4];
+  PetscReal      *rootdata[2],*leafdata[2],*rootred[2],*leafbc[2];
+  PetscMPIInt    rank,size;
+  MPI_Datatype   unit[2];
+
+  ierr = PetscInitialize(&argc,&argv,NULL,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-nroots",&nroots,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-nleaves",&nleaves,NULL);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(PETSC_COMM_WORLD,&size);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(PETSC_COMM_WORLD,&rank);CHKERRQ(ierr);
+
+  /* The same graph twice: sf[0] is serial and sf[1] uses the options with prefix thr_.
+     Leaves are every other entry of the leaf data, on this and the next process; several leaves share each root */
+  for (s=0; s<2; s++) {
+    ierr = PetscMalloc1(nleaves,&iremote);CHKERRQ(ierr);
+    ierr = PetscMalloc1(nleaves,&ilocal);CHKERRQ(ierr);
+    for (i=0; i<nleaves; i++) {
+      iremote[i].rank  = (rank+i%2)%size;
+      iremote[i].index = (7*i)%nroots;
+      ilocal[i]        = 2*i;
+    }
+    ierr = PetscSFCreate(PETSC_COMM_WORLD,&sf[s]);CHKERRQ(ierr);
+    if (s) {ierr = PetscObjectSetOptionsPrefix((PetscObject)sf[s],"thr_");CHKERRQ(ierr);}
+    ierr = PetscSFSetFromOptions(sf[s]);CHKERRQ(ierr);
+    ierr = PetscSFSetGraph(sf[s],nroots,nleaves,ilocal,PETSC_OWN_POINTER,iremote,PETSC_OWN_POINTER);CHKERRQ(ierr);
+    ierr = PetscSFSetUp(sf[s]);CHKERRQ(ierr);
+  }
+
+  /* Units of one and three reals */
+  unit[0] = MPIU_REAL;
+  ierr = MPI_Type_contiguous(3,MPIU_REAL,&unit[1]);CHKERRQ(ierr);
+  ierr = MPI_Type_commit(&unit[1]);CHKERRQ(ierr);
+  for (s=0; s<2; s++) {ierr = PetscMalloc4(3*nroots,&rootdata[s],6*nleaves,&leafdata[s],3*nroots,&rootred[s],6*nleaves,&leafbc[s]);CHKERRQ(ierr);}
+
+  for (j=0; j<2; j++) {
+    bs = j ? 3 : 1;
+    for (s=0; s<2; s++) {
+      for (i=0; i<bs*nroots; i++) rootdata[s][i] = rootred[s][i] = 1.0/(1.0+rank+i);
+      for (i=0; i<2*bs*nleaves; i++) leafdata[s][i] = leafbc[s][i] = 0.1*rank+1.0/(3.0+i);
+      ierr = PetscSFBcastBegin(sf[s],unit[j],rootdata[s],leafdata[s]);CHKERRQ(ierr);
+      ierr = PetscSFBcastEnd(sf[s],unit[j],rootdata[s],leafdata[s]);CHKERRQ(ierr);
+      ierr = PetscSFBcastAndOpBegin(sf[s],unit[j],rootdata[s],leafbc[s],MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFBcastAndOpEnd(sf[s],unit[j],rootdata[s],leafbc[s],MPIU_SUM);CHKERRQ(ierr);
+      /* Sums of reals differ in the last bits if the leaves of a root are added in another order */
+      ierr = PetscSFReduceBegin(sf[s],unit[j],leafbc[s],rootred[s],MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFReduceEnd(sf[s],unit[j],leafbc[s],rootred[s],MPIU_SUM);CHKERRQ(ierr);
+      ierr = PetscSFReduceBegin(sf[s],unit[j],leafdata[s],rootdata[s],MPIU_MAX);CHKERRQ(ierr);
+      ierr = PetscSFReduceEnd(sf[s],unit[j],leafdata[s],rootdata[s],MPIU_MAX);CHKERRQ(ierr);
+    }
+    ierr = CountDiff(2*bs*nleaves,leafdata[0],leafdata[1],&ndiff[0]);CHKERRQ(ierr);
+    ierr = CountDiff(2*bs*nleaves,leafbc[0],leafbc[1],&ndiff[1]);CHKERRQ(ierr);
+    ierr = CountDiff(bs*nroots,rootred[0],rootred[1],&ndiff[2]);CHKERRQ(ierr);
+    ierr = CountDiff(bs*nroots,rootdata[0],rootdata[1],&ndiff[3]);CHKERRQ(ierr);
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Unit of %D reals: differences with the serial routines %D %D %D %D\n",bs,ndiff[0],ndiff[1],ndiff[2],ndiff[3]);CHKERRQ(ierr);
+  }
+
+  for (s=0; s<2; s++) {
+    ierr = PetscFree4(rootdata[s],leafdata[s],rootred[s],leafbc[s]);CHKERRQ(ierr);
+    ierr = PetscSFDestroy(&sf[s]);CHKERRQ(ierr);
+  }
+  ierr = MPI_Type_free(&unit[1]);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+     nsize: {{1 3}}
+     args: -thr_sf_num_threads 2
+
+   test:
+     suffix: neighbor
+     nsize: 3
+     output_file: output/ex7_1.out
+     args: -sf_type neighbor -thr_sf_num_threads 2
+     requires: define(PETSC_HAVE_MPI_NEIGHBORHOOD_COLLECTIVES)
+
+TEST*/
@@ -598,4 +598,27 @@ int main(int argc,char **argv)
       nsize: 4
       args: -sf_type basic -test_all -test_bcastop 0 -test_fetchandop 0
 
+   test:
+      suffix: 10_prepost
+      output_file: output/ex1_10_basic.out
+      nsize: 4
+      args: -sf_type basic -sf_basic_prepost -test_all -test_bcastop 0 -test_fetchandop 0
+
+   # -sf_shm_ranks_per_node splits the node so that the messages between node leaders are tested too
+   test:
+      suffix: 10_shm
+      output_file: output/ex1_10_basic.out
+      filter: sed -e "s/type: shm/type: basic/"
+      nsize: 4
+      args: -sf_type shm -sf_shm_ranks_per_node {{0 1 2}} -test_all -test_bcastop 0 -test_fetchandop 0
+      requires: define(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY)
+
+   test:
+      suffix: 8_shm
+      output_file: output/ex1_8_basic.out
+      filter: sed -e "s/type: shm/type: basic/"
+      nsize: 3
+      args: -test_bcast -test_sf_distribute -sf_type shm -sf_shm_ranks_per_node 2
+      requires: define(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY)
+
 TEST*/
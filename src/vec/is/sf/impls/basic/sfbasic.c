@@ -1,5 +1,8 @@
 
 #include <../src/vec/is/sf/impls/basic/sfbasic.h>
+#if defined(PETSC_HAVE_OPENMP)
+#include <omp.h>
+#endif
 
 /*===================================================================================*/
 /*              Internal routines for PetscSFPack                              */
@@ -29,12 +32,13 @@ static PetscErrorCode PetscSFPackGetReqs_Basic(PetscSF sf,PetscSFPack link,Petsc
   }
 
   if (rootreqs && !link->rootreqsinited[direction][rootmtype]) {
+    ierr = PetscLogEventBegin(PETSCSF_ReqsInit,sf,0,0,0);CHKERRQ(ierr);
     ierr = PetscSFGetRootInfo_Basic(sf,&nrootranks,&ndrootranks,NULL,&rootoffset,NULL);CHKERRQ(ierr);
     if (direction == PETSCSF_LEAF2ROOT_REDUCE) {
       for (i=ndrootranks,j=0; i<nrootranks; i++,j++) {
         MPI_Aint disp = (rootoffset[i] - rootoffset[ndrootranks])*link->unitbytes;
         ierr = PetscMPIIntCast(rootoffset[i+1]-rootoffset[i],&n);CHKERRQ(ierr);
-        ierr = MPI_Recv_init(link->rootbuf[rootmtype]+disp,n,unit,bas->iranks[i],link->tag,comm,&link->rootreqs[direction][rootmtype][j]);CHKERRQ(ierr);
+        ierr = MPI_Recv_init(link->rootbuf[rootmtype]+disp,n,unit,bas->iranks[i],link->rtag,comm,&link->rootreqs[direction][rootmtype][j]);CHKERRQ(ierr);
       }
     } else if (direction == PETSCSF_ROOT2LEAF_BCAST) {
       for (i=ndrootranks,j=0; i<nrootranks; i++,j++) {
@@ -44,15 +48,17 @@ static PetscErrorCode PetscSFPackGetReqs_Basic(PetscSF sf,PetscSFPack link,Petsc
       }
     } else SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Out-of-range PetscSFDirection = %d\n",(int)direction);
     link->rootreqsinited[direction][rootmtype] = PETSC_TRUE;
+    ierr = PetscLogEventEnd(PETSCSF_ReqsInit,sf,0,0,0);CHKERRQ(ierr);
   }
 
   if (leafreqs && !link->leafreqsinited[direction][leafmtype]) {
+    ierr = PetscLogEventBegin(PETSCSF_ReqsInit,sf,0,0,0);CHKERRQ(ierr);
     ierr = PetscSFGetLeafInfo_Basic(sf,&nleafranks,&ndleafranks,NULL,&leafoffset,NULL,NULL);CHKERRQ(ierr);
     if (direction == PETSCSF_LEAF2ROOT_REDUCE) {
       for (i=ndleafranks,j=0; i<nleafranks; i++,j++) {
         MPI_Aint disp = (leafoffset[i] - leafoffset[ndleafranks])*link->unitbytes;
         ierr = PetscMPIIntCast(leafoffset[i+1]-leafoffset[i],&n);CHKERRQ(ierr);
-        ierr = MPI_Send_init(link->leafbuf[leafmtype]+disp,n,unit,sf->ranks[i],link->tag,comm,&link->leafreqs[direction][leafmtype][j]);CHKERRQ(ierr);
+        ierr = MPI_Send_init(link->leafbuf[leafmtype]+disp,n,unit,sf->ranks[i],link->rtag,comm,&link->leafreqs[direction][leafmtype][j]);CHKERRQ(ierr);
       }
     } else if (direction == PETSCSF_ROOT2LEAF_BCAST) {
       for (i=ndleafranks,j=0; i<nleafranks; i++,j++) {
@@ -62,6 +68,7 @@ static PetscErrorCode PetscSFPackGetReqs_Basic(PetscSF sf,PetscSFPack link,Petsc
       }
     } else SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Out-of-range PetscSFDirection = %d\n",(int)direction);
     link->leafreqsinited[direction][leafmtype] = PETSC_TRUE;
+    ierr = PetscLogEventEnd(PETSCSF_ReqsInit,sf,0,0,0);CHKERRQ(ierr);
   }
 
   if (rootreqs) *rootreqs = link->rootreqs[direction][rootmtype];
@@ -69,6 +76,49 @@ static PetscErrorCode PetscSFPackGetReqs_Basic(PetscSF sf,PetscSFPack link,Petsc
   PetscFunctionReturn(0);
 }
 
+/* Start the receives of an operation in the given direction, unless they were preposted at the end of the previous one.
+   Receives preposted for the other direction are cancelled, since the buffer they target is about to be packed.
+*/
+static PetscErrorCode PetscSFPackStartRecvs_Basic(PetscSFPack link,PetscSFDirection direction,MPI_Request *reqs)
+{
+  PetscErrorCode ierr;
+  PetscSFDirection other = direction == PETSCSF_ROOT2LEAF_BCAST ? PETSCSF_LEAF2ROOT_REDUCE : PETSCSF_ROOT2LEAF_BCAST;
+
+  PetscFunctionBegin;
+  ierr = PetscSFPackCancelPreposted(link,other);CHKERRQ(ierr);
+  if (link->preposted[direction] && (reqs == link->rootreqs[direction][PETSC_MEMTYPE_HOST] || reqs == link->leafreqs[direction][PETSC_MEMTYPE_HOST])) {
+    link->preposted[direction] = PETSC_FALSE; /* Already started */
+    PetscFunctionReturn(0);
+  }
+  ierr = PetscSFPackCancelPreposted(link,direction);CHKERRQ(ierr);
+  if (direction == PETSCSF_ROOT2LEAF_BCAST) {ierr = MPI_Startall_irecv(link->leafbuflen,link->unit,link->nleafreqs,reqs);CHKERRQ(ierr);}
+  else                                      {ierr = MPI_Startall_irecv(link->rootbuflen,link->unit,link->nrootreqs,reqs);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
+
+/* With -sf_basic_prepost, start the host receives of the next operation in the same direction as soon as this one
+   completed, so that the messages of peers that are ahead of us find them posted. A preposted receive can only match a
+   message of the same direction: the two directions use different tags, and a peer cannot start an operation in the
+   other direction before we sent it our part of that operation, which we do after cancelling the preposted receives.
+*/
+static PetscErrorCode PetscSFPackPrepostRecvs_Basic(PetscSF sf,PetscSFPack link,PetscSFDirection direction)
+{
+  PetscErrorCode ierr;
+  PetscSF_Basic  *bas = (PetscSF_Basic*)sf->data;
+
+  PetscFunctionBegin;
+  if (!bas->prepost) PetscFunctionReturn(0);
+  if (direction == PETSCSF_ROOT2LEAF_BCAST) {
+    if (!link->leafreqsinited[direction][PETSC_MEMTYPE_HOST]) PetscFunctionReturn(0); /* Not a link of SFBasic, or not used with host buffers */
+    ierr = MPI_Startall_irecv(link->leafbuflen,link->unit,link->nleafreqs,link->leafreqs[direction][PETSC_MEMTYPE_HOST]);CHKERRQ(ierr);
+  } else {
+    if (!link->rootreqsinited[direction][PETSC_MEMTYPE_HOST]) PetscFunctionReturn(0);
+    ierr = MPI_Startall_irecv(link->rootbuflen,link->unit,link->nrootreqs,link->rootreqs[direction][PETSC_MEMTYPE_HOST]);CHKERRQ(ierr);
+  }
+  link->preposted[direction] = PETSC_TRUE;
+  PetscFunctionReturn(0);
+}
+
 /* Common part shared by SFBasic and SFNeighbor based on the fact they all deal with sparse graphs. */
 PETSC_INTERN PetscErrorCode PetscSFPackGet_Basic_Common(PetscSF sf,MPI_Datatype unit,PetscMemType rootmtype,const void *rootdata,PetscMemType leafmtype,const void *leafdata,PetscInt nrootreqs,PetscInt nleafreqs,PetscSFPack *mylink)
 {
@@ -96,6 +146,7 @@ PETSC_INTERN PetscErrorCode PetscSFPackGet_Basic_Common(PetscSF sf,MPI_Datatype
   ierr = PetscNew(&link);CHKERRQ(ierr);
   ierr = PetscSFPackSetUp_Host(sf,link,unit);CHKERRQ(ierr);
   ierr = PetscCommGetNewTag(PetscObjectComm((PetscObject)sf),&link->tag);CHKERRQ(ierr); /* One tag per link */
+  ierr = PetscCommGetNewTag(PetscObjectComm((PetscObject)sf),&link->rtag);CHKERRQ(ierr);
 
   /* Allocate root, leaf, self buffers, and MPI requests */
   link->rootbuflen = rootoffset[nrootranks]-rootoffset[ndrootranks];
@@ -253,10 +304,19 @@ PETSC_INTERN PetscErrorCode PetscSFSetUp_Basic(PetscSF sf)
 PETSC_INTERN PetscErrorCode PetscSFSetFromOptions_Basic(PetscOptionItems *PetscOptionsObject,PetscSF sf)
 {
   PetscErrorCode ierr;
+  PetscSF_Basic  *bas = (PetscSF_Basic*)sf->data;
 
   PetscFunctionBegin;
   ierr = PetscOptionsHead(PetscOptionsObject,"PetscSF Basic options");CHKERRQ(ierr);
   ierr = PetscOptionsBool("-sf_use_pinned_buffer","Use pinned (nonpagable) memory for send/recv buffers on host","PetscSFSetFromOptions",sf->use_pinned_buf,&sf->use_pinned_buf,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsBool("-sf_basic_prepost","Start the receives of the next operation as soon as the current one completes","PetscSFSetFromOptions",bas->prepost,&bas->prepost,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-sf_num_threads","Number of OpenMP threads packing and unpacking host data, 0 for the OpenMP default","PetscSFSetFromOptions",sf->nthreads,&sf->nthreads,NULL);CHKERRQ(ierr);
+#if defined(PETSC_HAVE_OPENMP)
+  if (!sf->nthreads) sf->nthreads = (PetscInt)omp_get_max_threads();
+#else
+  sf->nthreads = 1;
+#endif
+  if (sf->nthreads < 1) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of threads %D must be positive",sf->nthreads);
   ierr = PetscOptionsTail();CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -312,7 +372,7 @@ static PetscErrorCode PetscSFBcastAndOpBegin_Basic(PetscSF sf,MPI_Datatype unit,
 
   ierr = PetscSFPackGetReqs_Basic(sf,link,PETSCSF_ROOT2LEAF_BCAST,&rootreqs,&leafreqs);CHKERRQ(ierr);
   /* Post Irecv. Note distinguished ranks receive data via shared memory (i.e., not via MPI) */
-  ierr = MPI_Startall_irecv(link->leafbuflen,unit,link->nleafreqs,leafreqs);CHKERRQ(ierr);
+  ierr = PetscSFPackStartRecvs_Basic(link,PETSCSF_ROOT2LEAF_BCAST,leafreqs);CHKERRQ(ierr);
 
   /* Do Isend */
   ierr = PetscSFPackRootData(sf,link,rootloc,rootdata,PETSC_TRUE);CHKERRQ(ierr);
@@ -334,6 +394,7 @@ PETSC_INTERN PetscErrorCode PetscSFBcastAndOpEnd_Basic(PetscSF sf,MPI_Datatype u
   ierr = PetscSFPackWaitall(link,PETSCSF_ROOT2LEAF_BCAST);CHKERRQ(ierr);
   ierr = PetscSFGetLeafIndicesWithMemType_Basic(sf,leafmtype,&leafloc);CHKERRQ(ierr);
   ierr = PetscSFUnpackAndOpLeafData(sf,link,leafloc,leafdata,op,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFPackPrepostRecvs_Basic(sf,link,PETSCSF_ROOT2LEAF_BCAST);CHKERRQ(ierr);
   ierr = PetscSFPackReclaim(sf,&link);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -352,7 +413,7 @@ static PetscErrorCode PetscSFReduceBegin_Basic(PetscSF sf,MPI_Datatype unit,Pets
   ierr = PetscSFPackGet_Basic(sf,unit,rootmtype,rootdata,leafmtype,leafdata,PETSCSF_LEAF2ROOT_REDUCE,&link);CHKERRQ(ierr);
   ierr = PetscSFPackGetReqs_Basic(sf,link,PETSCSF_LEAF2ROOT_REDUCE,&rootreqs,&leafreqs);CHKERRQ(ierr);
   /* Eagerly post root receives for non-distinguished ranks */
-  ierr = MPI_Startall_irecv(link->rootbuflen,unit,link->nrootreqs,rootreqs);CHKERRQ(ierr);
+  ierr = PetscSFPackStartRecvs_Basic(link,PETSCSF_LEAF2ROOT_REDUCE,rootreqs);CHKERRQ(ierr);
 
   /* Pack and send leaf data */
   ierr = PetscSFPackLeafData(sf,link,leafloc,leafdata,PETSC_TRUE);CHKERRQ(ierr);
@@ -373,6 +434,7 @@ PETSC_INTERN PetscErrorCode PetscSFReduceEnd_Basic(PetscSF sf,MPI_Datatype unit,
   ierr = PetscSFPackGetInUse(sf,unit,rootdata,leafdata,PETSC_OWN_POINTER,&link);CHKERRQ(ierr);
   ierr = PetscSFPackWaitall(link,PETSCSF_LEAF2ROOT_REDUCE);CHKERRQ(ierr);
   ierr = PetscSFUnpackAndOpRootData(sf,link,rootloc,rootdata,op,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFPackPrepostRecvs_Basic(sf,link,PETSCSF_LEAF2ROOT_REDUCE);CHKERRQ(ierr);
   ierr = PetscSFPackReclaim(sf,&link);CHKERRQ(ierr);
   PetscFunctionReturn(0);
 }
@@ -402,7 +464,7 @@ static PetscErrorCode PetscSFFetchAndOpEnd_Basic(PetscSF sf,MPI_Datatype unit,Pe
   ierr = PetscSFPackGetReqs_Basic(sf,link,PETSCSF_ROOT2LEAF_BCAST,&rootreqs,&leafreqs);CHKERRQ(ierr);
 
   /* Post leaf receives */
-  ierr = MPI_Startall_irecv(link->leafbuflen,unit,link->nleafreqs,leafreqs);CHKERRQ(ierr);
+  ierr = PetscSFPackStartRecvs_Basic(link,PETSCSF_ROOT2LEAF_BCAST,leafreqs);CHKERRQ(ierr);
 
   /* Process local fetch-and-op, post root sends */
   ierr = PetscSFFetchAndOpRootData(sf,link,rootloc,rootdata,op,PETSC_TRUE);CHKERRQ(ierr);
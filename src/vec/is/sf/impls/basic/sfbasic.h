@@ -15,6 +15,7 @@
   PetscSFPackOpt   selfrootpackopt; /* Optimization plans to (un)pack roots connected to local leaves */                           \
   PetscSFPack      avail;           /* One or more entries per MPI Datatype, lazily constructed */                                 \
   PetscSFPack      inuse;           /* Buffers being used for transactions that have not yet completed */                          \
+  PetscBool        prepost;         /* Start the receives of the next operation of a link when the current one completes */        \
   PetscBool        selfrootdups;    /* Indices of roots in irootloc[0,ioffset[ndiranks]) have dups, implying theads working ... */ \
                                     /* ... on these roots in parallel may have data race. */                                       \
   PetscBool        remoterootdups   /* Indices of roots in irootloc[ioffset[ndiranks],ioffset[niranks]) have dups */
@@ -363,9 +364,10 @@ PETSC_STATIC_INLINE PetscErrorCode PetscSFPackSetupOptimizations_Basic(PetscSF s
   ierr = PetscSFPackOptCreate(bas->ndiranks,             bas->ioffset,              bas->irootloc,&bas->selfrootpackopt);CHKERRQ(ierr);
   ierr = PetscSFPackOptCreate(bas->niranks-bas->ndiranks,bas->ioffset+bas->ndiranks,bas->irootloc,&bas->rootpackopt);CHKERRQ(ierr);
 
-#if defined(PETSC_HAVE_CUDA)
+#if defined(PETSC_HAVE_CUDA) || defined(PETSC_HAVE_OPENMP)
   /* Check duplicates in irootloc[] so CUDA packing kernels can use cheaper regular operations
      instead of atomics to unpack data on leaves/roots, when they know there is not data race.
+     Threaded host unpacking likewise only needs the colored routines when there are duplicates.
    */
   ierr = PetscCheckDupsInt(sf->roffset[sf->ndranks],                              sf->rmine,                                &sf->selfleafdups);CHKERRQ(ierr);
   ierr = PetscCheckDupsInt(sf->roffset[sf->nranks]-sf->roffset[sf->ndranks],      sf->rmine+sf->roffset[sf->ndranks],       &sf->remoteleafdups);CHKERRQ(ierr);
@@ -385,7 +387,7 @@ PETSC_STATIC_INLINE PetscErrorCode PetscSFPackDestroyOptimizations_Basic(PetscSF
   ierr = PetscSFPackOptDestroy(&sf->selfleafpackopt);CHKERRQ(ierr);
   ierr = PetscSFPackOptDestroy(&bas->rootpackopt);CHKERRQ(ierr);
   ierr = PetscSFPackOptDestroy(&bas->selfrootpackopt);CHKERRQ(ierr);
-#if defined(PETSC_HAVE_CUDA)
+#if defined(PETSC_HAVE_CUDA) || defined(PETSC_HAVE_OPENMP)
   sf->selfleafdups    = PETSC_TRUE;
   sf->remoteleafdups  = PETSC_TRUE;
   bas->selfrootdups   = PETSC_TRUE; /* The default is assuming there are dups so that atomics are used. */
@@ -25,6 +25,29 @@
 
 #define PairType(Type1,Type2) Type1##_##Type2 /* typename for struct {Type1 a; Type2 b;} */
 
+/* Threaded host (un)packing with link->nthreads OpenMP threads.
+
+   A routine is shared by the threads only when it moves at least SF_THREAD_MINBYTES bytes, so that it pays for waking them up.
+   The threads then split the entries evenly and ignore the optimization plans, which are made per rank for a single thread.
+   Unpacking into indices with duplicates would race, so it is done by the colored routines instead, in which thread c only
+   updates the entries of the blocks of SF_COLOR_BLOCK consecutive units of the unpacked data with number b, b%nthreads == c.
+   All updates of an entry are thus done by one thread, in the same order as the serial routine.
+ */
+#define SF_THREAD_MINBYTES    16384
+#define SF_COLOR_BLOCK        64
+#if defined(PETSC_HAVE_OPENMP)
+#define SF_PRAGMA(x)          _Pragma(#x)
+#define SF_OMP_FOR(nt)        SF_PRAGMA(omp parallel for num_threads(nt) schedule(static))
+#define SF_OMP_FOR_COLOR(nt)  SF_PRAGMA(omp parallel for num_threads(nt) schedule(static,1))
+#define SF_NTHREADS(link,n)   (((link)->nthreads > 1 && (size_t)(n)*(link)->unitbytes >= SF_THREAD_MINBYTES) ? (link)->nthreads : 1)
+#define SF_OPENMP(statement)  statement
+#else
+#define SF_OMP_FOR(nt)
+#define SF_OMP_FOR_COLOR(nt)
+#define SF_NTHREADS(link,n)   1
+#define SF_OPENMP(statement)
+#endif
+
 /* DEF_PackFunc - macro defining a Pack routine
 
    Arguments of the macro:
@@ -44,13 +67,20 @@
   static PetscErrorCode CPPJoin4(Pack,Type,BS,EQ)(PetscInt count,const PetscInt *idx,PetscSFPack link,PetscSFPackOpt opt,const void *unpacked,void *packed) \
   {                                                                                                          \
     PetscErrorCode ierr;                                                                                     \
-    const Type     *u = (const Type*)unpacked,*u2;                                                           \
+    const Type     *u = (const Type*)unpacked,*u2,*u3;                                                       \
     Type           *p = (Type*)packed,*p2;                                                                   \
-    PetscInt       i,j,k,l,r,step,bs=link->bs;                                                               \
+    PetscInt       i,j,k,l,r,step,bs=link->bs,nt=SF_NTHREADS(link,count);                                   \
     const PetscInt *idx2,M = (EQ) ? 1 : bs/BS; /* If EQ, then M=1 enables compiler's const-propagation */    \
     const PetscInt MBS = M*BS; /* MBS=bs. We turn MBS into a compile time const when EQ=1. */                \
     PetscFunctionBegin;                                                                                      \
-    if (!idx) {ierr = PetscArraycpy(p,u,MBS*count);CHKERRQ(ierr);}  /* Indices are contiguous */             \
+    if (nt > 1) { /* Threads split the entries */                                                            \
+      SF_OMP_FOR(nt)                                                                                         \
+      for (i=0; i<count; i++) {                                                                              \
+        const PetscInt s = idx ? idx[i] : i;                                                                 \
+        PetscInt       jj;                                                                                   \
+        for (jj=0; jj<MBS; jj++) p[i*MBS+jj] = u[s*MBS+jj];                                                  \
+      }                                                                                                      \
+    } else if (!idx) {ierr = PetscArraycpy(p,u,MBS*count);CHKERRQ(ierr);}  /* Indices are contiguous */      \
     else if (!opt) { /* No optimizations available */                                                        \
       for (i=0; i<count; i++)                                                                                \
         for (j=0; j<M; j++)     /* Decent compilers should eliminate this loop when M = const 1 */           \
@@ -77,6 +107,14 @@
           step = opt->stride_step[r];                                                                        \
           for (i=0; i<opt->stride_n[r]; i++)                                                                 \
             for (j=0; j<MBS; j++) p2[i*MBS+j] = u2[i*step*MBS+j];                                            \
+        } else if (opt->type[r] == PETSCSF_PACKOPT_BOX) {                                                    \
+          u2 = u + idx[opt->offset[r]]*MBS;                                                                  \
+          l  = opt->box_n[3*r]*MBS; /* length of a contiguous run in basic type */                           \
+          for (k=0; k<opt->box_n[3*r+2]; k++)                                                                \
+            for (j=0; j<opt->box_n[3*r+1]; j++,p2+=l) {                                                      \
+              u3 = u2 + (k*opt->box_step[2*r+1]+j*opt->box_step[2*r])*MBS;                                   \
+              for (i=0; i<l; i++) p2[i] = u3[i];                                                             \
+            }                                                                                                \
         } else SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Unknown SFPack optimzation type %D",opt->type[r]);   \
       }                                                                                                      \
     }                                                                                                        \
@@ -86,13 +124,15 @@
 /* DEF_Action - macro defining a Unpack(Fetch)AndInsert routine
 
    Arguments:
-  +action     Unpack or Fetch
+  +action     Unpack, UnpackColored or Fetch
   .Type       Type of the data
   .BS         Block size for vectorization
   .EQ        (bs == BS) ? 1 : 0. EQ is a compile-time const.
   .FILTER     Macro defining what to do with a statement, either EXECUTE or IGNORE
   .CType      Type with or without the const qualifier, i.e., const Type or Type
   .Cvoid      void with or without the const qualifier, i.e., const void or void
+  .NT         Number of threads of the routine, 1 for a serial routine
+  -COLOR      1 if the indices might have duplicates, so that the threads must use the coloring, otherwise 0
 
   Notes:
    This macro is not combined with DEF_ActionAndOp because we want to use memcpy in this macro.
@@ -102,17 +142,33 @@
 
    If action is Fetch, we may do Malloc/Free in the routine. It is costly but the expectation is that this case is really rare.
  */
-#define DEF_Action(action,Type,BS,EQ,FILTER,CType,Cvoid)               \
+#define DEF_Action(action,Type,BS,EQ,FILTER,CType,Cvoid,NT,COLOR)      \
   static PetscErrorCode CPPJoin4(action##AndInsert,Type,BS,EQ)(PetscInt count,const PetscInt *idx,PetscSFPack link,PetscSFPackOpt opt,void *unpacked,Cvoid *packed) \
   {                                                                                                          \
     PetscErrorCode ierr;                                                                                     \
-    Type           *u = (Type*)unpacked,*u2;                                                                 \
+    Type           *u = (Type*)unpacked,*u2,*u3;                                                             \
     CType          *p = (CType*)packed,*p2;                                                                  \
-    PetscInt       i,j,k,l,r,step,bs=link->bs;                                                               \
+    PetscInt       i,j,k,l,r,c,step,bs=link->bs,nt=NT;                                                       \
     const PetscInt *idx2,M = (EQ) ? 1 : bs/BS; /* If EQ, then M=1 enables compiler's const-propagation */    \
     const PetscInt MBS = M*BS; /* MBS=bs. We turn MBS into a compile time const when EQ=1. */                \
     PetscFunctionBegin;                                                                                      \
-    if (!idx) {                                                                                              \
+    if (nt > 1 && (!(COLOR) || !idx)) { /* Threads split the entries */                                      \
+      SF_OMP_FOR(nt)                                                                                         \
+      for (i=0; i<count; i++) {                                                                              \
+        const PetscInt s = idx ? idx[i] : i;                                                                 \
+        PetscInt       jj;                                                                                   \
+        for (jj=0; jj<MBS; jj++) u[s*MBS+jj] = p[i*MBS+jj];                                                  \
+      }                                                                                                      \
+    } else if (nt > 1) { /* Thread c only does the entries of its color */                                   \
+      SF_OMP_FOR_COLOR(nt)                                                                                   \
+      for (c=0; c<nt; c++) {                                                                                 \
+        PetscInt ii,jj;                                                                                      \
+        for (ii=0; ii<count; ii++) {                                                                         \
+          if ((idx[ii]/SF_COLOR_BLOCK)%nt != c) continue;                                                    \
+          for (jj=0; jj<MBS; jj++) u[idx[ii]*MBS+jj] = p[ii*MBS+jj];                                         \
+        }                                                                                                    \
+      }                                                                                                      \
+    } else if (!idx) {                                                                                       \
       FILTER(Type *v);                                                                                       \
       FILTER(ierr = PetscMalloc1(count*MBS,&v);CHKERRQ(ierr));                                               \
       FILTER(ierr = PetscArraycpy(v,u,count*MBS);CHKERRQ(ierr));                                             \
@@ -161,6 +217,18 @@
                        u2[i*step*MBS+j*BS+k] = p2[i*MBS+j*BS+k];                                             \
                 FILTER(p2[i*MBS+j*BS+k]      = t);                                                           \
               }                                                                                              \
+        } else if (opt->type[r] == PETSCSF_PACKOPT_BOX) {                                                    \
+          u2 = u + idx[opt->offset[r]]*MBS;                                                                  \
+          l  = opt->box_n[3*r]*MBS;                                                                          \
+          for (k=0; k<opt->box_n[3*r+2]; k++)                                                                \
+            for (j=0; j<opt->box_n[3*r+1]; j++,p2+=l) {                                                      \
+              u3 = u2 + (k*opt->box_step[2*r+1]+j*opt->box_step[2*r])*MBS;                                   \
+              for (i=0; i<l; i++) {                                                                          \
+                FILTER(Type t = u3[i]);                                                                      \
+                       u3[i]  = p2[i];                                                                       \
+                FILTER(p2[i]  = t);                                                                          \
+              }                                                                                              \
+            }                                                                                                \
         } else SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Unknown SFPack optimzation type %D",opt->type[r]);   \
       }                                                                                                      \
     }                                                                                                        \
@@ -170,7 +238,7 @@
 /* DEF_ActionAndOp - macro defining a Unpack(Fetch)AndOp routine. Op can not be Insert, Maxloc or Minloc
 
    Arguments:
-  +action     Unpack or Fetch
+  +action     Unpack, UnpackColored or Fetch
   .opname     Name of the Op, such as Add, Mult, LAND, etc.
   .Type       Type of the data
   .BS         Block size for vectorization
@@ -179,18 +247,38 @@
   .APPLY      Macro defining application of the op. Could be BINARY_OP, FUNCTION_OP, LXOR_OP or PAIRTYPE_OP
   .FILTER     Macro defining what to do with a statement, either EXECUTE or IGNORE
   .CType      Type with or without the const qualifier, i.e., const Type or Type
-  -Cvoid      void with or without the const qualifier, i.e., const void or void
+  .Cvoid      void with or without the const qualifier, i.e., const void or void
+  .NT         Number of threads of the routine, 1 for a serial routine
+  -COLOR      1 if the indices might have duplicates, so that the threads must use the coloring, otherwise 0
  */
-#define DEF_ActionAndOp(action,opname,Type,BS,EQ,op,APPLY,FILTER,CType,Cvoid) \
+#define DEF_ActionAndOp(action,opname,Type,BS,EQ,op,APPLY,FILTER,CType,Cvoid,NT,COLOR) \
   static PetscErrorCode CPPJoin4(action##And##opname,Type,BS,EQ)(PetscInt count,const PetscInt *idx,PetscSFPack link,PetscSFPackOpt opt,void *unpacked,Cvoid *packed) \
   {                                                                                                          \
-    Type           *u = (Type*)unpacked,*u2,t;                                                               \
+    Type           *u = (Type*)unpacked,*u2,*u3,t;                                                           \
     CType          *p = (CType*)packed,*p2;                                                                  \
-    PetscInt       i,j,k,l,r,step,bs=link->bs;                                                               \
+    PetscInt       i,j,k,l,r,c,step,bs=link->bs,nt=NT;                                                       \
     const PetscInt *idx2,M = (EQ) ? 1 : bs/BS; /* If EQ, then M=1 enables compiler's const-propagation */    \
     const PetscInt MBS = M*BS; /* MBS=bs. We turn MBS into a compile time const when EQ=1. */                \
     PetscFunctionBegin;                                                                                      \
-    if (!idx) {                                                                                              \
+    if (nt > 1 && (!(COLOR) || !idx)) { /* Threads split the entries */                                      \
+      SF_OMP_FOR(nt)                                                                                         \
+      for (i=0; i<count; i++) {                                                                              \
+        const PetscInt s = idx ? idx[i] : i;                                                                 \
+        PetscInt       jj;                                                                                   \
+        Type           v;                                                                                    \
+        for (jj=0; jj<MBS; jj++) {v = u[s*MBS+jj]; APPLY(u[s*MBS+jj],v,op,p[i*MBS+jj]);}                     \
+      }                                                                                                      \
+    } else if (nt > 1) { /* Thread c only does the entries of its color */                                   \
+      SF_OMP_FOR_COLOR(nt)                                                                                   \
+      for (c=0; c<nt; c++) {                                                                                 \
+        PetscInt ii,jj;                                                                                      \
+        Type     v;                                                                                          \
+        for (ii=0; ii<count; ii++) {                                                                         \
+          if ((idx[ii]/SF_COLOR_BLOCK)%nt != c) continue;                                                    \
+          for (jj=0; jj<MBS; jj++) {v = u[idx[ii]*MBS+jj]; APPLY(u[idx[ii]*MBS+jj],v,op,p[ii*MBS+jj]);}     \
+        }                                                                                                    \
+      }                                                                                                      \
+    } else if (!idx) {                                                                                       \
       for (i=0; i<count; i++)                                                                                \
         for (j=0; j<M; j++)                                                                                  \
           for (k=0; k<BS; k++) {                                                                             \
@@ -239,6 +327,18 @@
                 APPLY (u2[i*step*MBS+j*BS+k],t,op,p2[i*MBS+j*BS+k]);                                         \
                 FILTER(p2[i*MBS+j*BS+k] = t);                                                                \
               }                                                                                              \
+        } else if (opt->type[r] == PETSCSF_PACKOPT_BOX) {                                                    \
+          u2 = u + idx[opt->offset[r]]*MBS;                                                                  \
+          l  = opt->box_n[3*r]*MBS;                                                                          \
+          for (k=0; k<opt->box_n[3*r+2]; k++)                                                                \
+            for (j=0; j<opt->box_n[3*r+1]; j++,p2+=l) {                                                      \
+              u3 = u2 + (k*opt->box_step[2*r+1]+j*opt->box_step[2*r])*MBS;                                   \
+              for (i=0; i<l; i++) {                                                                          \
+                t    = u3[i];                                                                                \
+                APPLY (u3[i],t,op,p2[i]);                                                                    \
+                FILTER(p2[i] = t);                                                                           \
+              }                                                                                              \
+            }                                                                                                \
         } else SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Unknown SFPack optimzation type %D",opt->type[r]);   \
       }                                                                                                      \
     }                                                                                                        \
@@ -279,38 +379,48 @@
 /* Pack, Unpack/Fetch ops */
 #define DEF_Pack(Type,BS,EQ)                                                                   \
   DEF_PackFunc(Type,BS,EQ)                                                                     \
-  DEF_Action(Unpack,Type,BS,EQ,IGNORE,const Type,const void)                                   \
-  DEF_Action(Fetch, Type,BS,EQ,EXECUTE,Type,void)                                              \
+  DEF_Action(Unpack,Type,BS,EQ,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)         \
+  SF_OPENMP(DEF_Action(UnpackColored,Type,BS,EQ,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  DEF_Action(Fetch, Type,BS,EQ,EXECUTE,Type,void,1,0)                                          \
   static void CPPJoin4(PackInit_Pack,Type,BS,EQ)(PetscSFPack link) {                           \
-    link->h_Pack            = CPPJoin4(Pack,           Type,BS,EQ);                            \
-    link->h_UnpackAndInsert = CPPJoin4(UnpackAndInsert,Type,BS,EQ);                            \
-    link->h_FetchAndInsert  = CPPJoin4(FetchAndInsert, Type,BS,EQ);                            \
+    link->h_Pack             = CPPJoin4(Pack,                  Type,BS,EQ);                    \
+    link->h_UnpackAndInsert  = CPPJoin4(UnpackAndInsert,       Type,BS,EQ);                    \
+    SF_OPENMP(link->hc_UnpackAndInsert = CPPJoin4(UnpackColoredAndInsert,Type,BS,EQ));         \
+    link->h_FetchAndInsert   = CPPJoin4(FetchAndInsert,        Type,BS,EQ);                    \
   }
 
 /* Add, Mult ops */
 #define DEF_Add(Type,BS,EQ)                                                                    \
-  DEF_ActionAndOp(Unpack,Add, Type,BS,EQ,+,BINARY_OP,IGNORE,const Type,const void)             \
-  DEF_ActionAndOp(Unpack,Mult,Type,BS,EQ,*,BINARY_OP,IGNORE,const Type,const void)             \
-  DEF_ActionAndOp(Fetch, Add, Type,BS,EQ,+,BINARY_OP,EXECUTE,Type,void)                        \
-  DEF_ActionAndOp(Fetch, Mult,Type,BS,EQ,*,BINARY_OP,EXECUTE,Type,void)                        \
+  DEF_ActionAndOp(Unpack,Add,Type,BS,EQ,+,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  DEF_ActionAndOp(Unpack,Mult,Type,BS,EQ,*,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,Add,Type,BS,EQ,+,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,Mult,Type,BS,EQ,*,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  DEF_ActionAndOp(Fetch, Add,Type,BS,EQ,+,BINARY_OP,EXECUTE,Type,void,1,0)                     \
+  DEF_ActionAndOp(Fetch, Mult,Type,BS,EQ,*,BINARY_OP,EXECUTE,Type,void,1,0)                    \
   static void CPPJoin4(PackInit_Add,Type,BS,EQ)(PetscSFPack link) {                            \
-    link->h_UnpackAndAdd    = CPPJoin4(UnpackAndAdd,   Type,BS,EQ);                            \
-    link->h_UnpackAndMult   = CPPJoin4(UnpackAndMult,  Type,BS,EQ);                            \
-    link->h_FetchAndAdd     = CPPJoin4(FetchAndAdd,    Type,BS,EQ);                            \
-    link->h_FetchAndMult    = CPPJoin4(FetchAndMult,   Type,BS,EQ);                            \
+    link->h_UnpackAndAdd   = CPPJoin4(UnpackAndAdd,Type,BS,EQ);                                \
+    link->h_UnpackAndMult  = CPPJoin4(UnpackAndMult,Type,BS,EQ);                               \
+    SF_OPENMP(link->hc_UnpackAndAdd = CPPJoin4(UnpackColoredAndAdd,Type,BS,EQ));               \
+    SF_OPENMP(link->hc_UnpackAndMult = CPPJoin4(UnpackColoredAndMult,Type,BS,EQ));             \
+    link->h_FetchAndAdd    = CPPJoin4(FetchAndAdd,Type,BS,EQ);                                 \
+    link->h_FetchAndMult   = CPPJoin4(FetchAndMult,Type,BS,EQ);                                \
   }
 
 /* Max, Min ops */
 #define DEF_Cmp(Type,BS,EQ)                                                                    \
-  DEF_ActionAndOp(Unpack,Max,Type,BS,EQ,PetscMax,FUNCTION_OP,IGNORE,const Type,const void)     \
-  DEF_ActionAndOp(Unpack,Min,Type,BS,EQ,PetscMin,FUNCTION_OP,IGNORE,const Type,const void)     \
-  DEF_ActionAndOp(Fetch, Max,Type,BS,EQ,PetscMax,FUNCTION_OP,EXECUTE,Type,void)                \
-  DEF_ActionAndOp(Fetch, Min,Type,BS,EQ,PetscMin,FUNCTION_OP,EXECUTE,Type,void)                \
+  DEF_ActionAndOp(Unpack,Max,Type,BS,EQ,PetscMax,FUNCTION_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  DEF_ActionAndOp(Unpack,Min,Type,BS,EQ,PetscMin,FUNCTION_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,Max,Type,BS,EQ,PetscMax,FUNCTION_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,Min,Type,BS,EQ,PetscMin,FUNCTION_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  DEF_ActionAndOp(Fetch, Max,Type,BS,EQ,PetscMax,FUNCTION_OP,EXECUTE,Type,void,1,0)            \
+  DEF_ActionAndOp(Fetch, Min,Type,BS,EQ,PetscMin,FUNCTION_OP,EXECUTE,Type,void,1,0)            \
   static void CPPJoin4(PackInit_Compare,Type,BS,EQ)(PetscSFPack link) {                        \
-    link->h_UnpackAndMax    = CPPJoin4(UnpackAndMax,   Type,BS,EQ);                            \
-    link->h_UnpackAndMin    = CPPJoin4(UnpackAndMin,   Type,BS,EQ);                            \
-    link->h_FetchAndMax     = CPPJoin4(FetchAndMax ,   Type,BS,EQ);                            \
-    link->h_FetchAndMin     = CPPJoin4(FetchAndMin ,   Type,BS,EQ);                            \
+    link->h_UnpackAndMax   = CPPJoin4(UnpackAndMax,Type,BS,EQ);                                \
+    link->h_UnpackAndMin   = CPPJoin4(UnpackAndMin,Type,BS,EQ);                                \
+    SF_OPENMP(link->hc_UnpackAndMax = CPPJoin4(UnpackColoredAndMax,Type,BS,EQ));               \
+    SF_OPENMP(link->hc_UnpackAndMin = CPPJoin4(UnpackColoredAndMin,Type,BS,EQ));               \
+    link->h_FetchAndMax    = CPPJoin4(FetchAndMax,Type,BS,EQ);                                 \
+    link->h_FetchAndMin    = CPPJoin4(FetchAndMin,Type,BS,EQ);                                 \
   }
 
 /* Logical ops.
@@ -318,36 +428,48 @@
   the compilation warning "empty macro arguments are undefined in ISO C90"
  */
 #define DEF_Log(Type,BS,EQ)                                                                    \
-  DEF_ActionAndOp(Unpack,LAND,Type,BS,EQ,&&,BINARY_OP,IGNORE,const Type,const void)            \
-  DEF_ActionAndOp(Unpack,LOR, Type,BS,EQ,||,BINARY_OP,IGNORE,const Type,const void)            \
-  DEF_ActionAndOp(Unpack,LXOR,Type,BS,EQ,&, LXOR_OP,  IGNORE,const Type,const void)            \
-  DEF_ActionAndOp(Fetch, LAND,Type,BS,EQ,&&,BINARY_OP,EXECUTE,Type,void)                       \
-  DEF_ActionAndOp(Fetch, LOR, Type,BS,EQ,||,BINARY_OP,EXECUTE,Type,void)                       \
-  DEF_ActionAndOp(Fetch, LXOR,Type,BS,EQ,&, LXOR_OP,  EXECUTE,Type,void)                       \
+  DEF_ActionAndOp(Unpack,LAND,Type,BS,EQ,&&,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  DEF_ActionAndOp(Unpack,LOR,Type,BS,EQ,||,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  DEF_ActionAndOp(Unpack,LXOR,Type,BS,EQ,&,LXOR_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,LAND,Type,BS,EQ,&&,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,LOR,Type,BS,EQ,||,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,LXOR,Type,BS,EQ,&,LXOR_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  DEF_ActionAndOp(Fetch, LAND,Type,BS,EQ,&&,BINARY_OP,EXECUTE,Type,void,1,0)                   \
+  DEF_ActionAndOp(Fetch, LOR,Type,BS,EQ,||,BINARY_OP,EXECUTE,Type,void,1,0)                    \
+  DEF_ActionAndOp(Fetch, LXOR,Type,BS,EQ,&,LXOR_OP,EXECUTE,Type,void,1,0)                      \
   static void CPPJoin4(PackInit_Logical,Type,BS,EQ)(PetscSFPack link) {                        \
-    link->h_UnpackAndLAND   = CPPJoin4(UnpackAndLAND,Type,BS,EQ);                              \
-    link->h_UnpackAndLOR    = CPPJoin4(UnpackAndLOR, Type,BS,EQ);                              \
-    link->h_UnpackAndLXOR   = CPPJoin4(UnpackAndLXOR,Type,BS,EQ);                              \
-    link->h_FetchAndLAND    = CPPJoin4(FetchAndLAND, Type,BS,EQ);                              \
-    link->h_FetchAndLOR     = CPPJoin4(FetchAndLOR,  Type,BS,EQ);                              \
-    link->h_FetchAndLXOR    = CPPJoin4(FetchAndLXOR, Type,BS,EQ);                              \
+    link->h_UnpackAndLAND  = CPPJoin4(UnpackAndLAND,Type,BS,EQ);                               \
+    link->h_UnpackAndLOR   = CPPJoin4(UnpackAndLOR,Type,BS,EQ);                                \
+    link->h_UnpackAndLXOR  = CPPJoin4(UnpackAndLXOR,Type,BS,EQ);                               \
+    SF_OPENMP(link->hc_UnpackAndLAND = CPPJoin4(UnpackColoredAndLAND,Type,BS,EQ));             \
+    SF_OPENMP(link->hc_UnpackAndLOR = CPPJoin4(UnpackColoredAndLOR,Type,BS,EQ));               \
+    SF_OPENMP(link->hc_UnpackAndLXOR = CPPJoin4(UnpackColoredAndLXOR,Type,BS,EQ));             \
+    link->h_FetchAndLAND   = CPPJoin4(FetchAndLAND,Type,BS,EQ);                                \
+    link->h_FetchAndLOR    = CPPJoin4(FetchAndLOR,Type,BS,EQ);                                 \
+    link->h_FetchAndLXOR   = CPPJoin4(FetchAndLXOR,Type,BS,EQ);                                \
   }
 
 /* Bitwise ops */
 #define DEF_Bit(Type,BS,EQ)                                                                    \
-  DEF_ActionAndOp(Unpack,BAND,Type,BS,EQ,&,BINARY_OP,IGNORE,const Type,const void)             \
-  DEF_ActionAndOp(Unpack,BOR, Type,BS,EQ,|,BINARY_OP,IGNORE,const Type,const void)             \
-  DEF_ActionAndOp(Unpack,BXOR,Type,BS,EQ,^,BINARY_OP,IGNORE,const Type,const void)             \
-  DEF_ActionAndOp(Fetch, BAND,Type,BS,EQ,&,BINARY_OP,EXECUTE,Type,void)                        \
-  DEF_ActionAndOp(Fetch, BOR, Type,BS,EQ,|,BINARY_OP,EXECUTE,Type,void)                        \
-  DEF_ActionAndOp(Fetch, BXOR,Type,BS,EQ,^,BINARY_OP,EXECUTE,Type,void)                        \
+  DEF_ActionAndOp(Unpack,BAND,Type,BS,EQ,&,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  DEF_ActionAndOp(Unpack,BOR,Type,BS,EQ,|,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  DEF_ActionAndOp(Unpack,BXOR,Type,BS,EQ,^,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),0)\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,BAND,Type,BS,EQ,&,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,BOR,Type,BS,EQ,|,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  SF_OPENMP(DEF_ActionAndOp(UnpackColored,BXOR,Type,BS,EQ,^,BINARY_OP,IGNORE,const Type,const void,SF_NTHREADS(link,count),1))\
+  DEF_ActionAndOp(Fetch, BAND,Type,BS,EQ,&,BINARY_OP,EXECUTE,Type,void,1,0)                    \
+  DEF_ActionAndOp(Fetch, BOR,Type,BS,EQ,|,BINARY_OP,EXECUTE,Type,void,1,0)                     \
+  DEF_ActionAndOp(Fetch, BXOR,Type,BS,EQ,^,BINARY_OP,EXECUTE,Type,void,1,0)                    \
   static void CPPJoin4(PackInit_Bitwise,Type,BS,EQ)(PetscSFPack link) {                        \
-    link->h_UnpackAndBAND   = CPPJoin4(UnpackAndBAND,Type,BS,EQ);                              \
-    link->h_UnpackAndBOR    = CPPJoin4(UnpackAndBOR, Type,BS,EQ);                              \
-    link->h_UnpackAndBXOR   = CPPJoin4(UnpackAndBXOR,Type,BS,EQ);                              \
-    link->h_FetchAndBAND    = CPPJoin4(FetchAndBAND, Type,BS,EQ);                              \
-    link->h_FetchAndBOR     = CPPJoin4(FetchAndBOR,  Type,BS,EQ);                              \
-    link->h_FetchAndBXOR    = CPPJoin4(FetchAndBXOR, Type,BS,EQ);                              \
+    link->h_UnpackAndBAND  = CPPJoin4(UnpackAndBAND,Type,BS,EQ);                               \
+    link->h_UnpackAndBOR   = CPPJoin4(UnpackAndBOR,Type,BS,EQ);                                \
+    link->h_UnpackAndBXOR  = CPPJoin4(UnpackAndBXOR,Type,BS,EQ);                               \
+    SF_OPENMP(link->hc_UnpackAndBAND = CPPJoin4(UnpackColoredAndBAND,Type,BS,EQ));             \
+    SF_OPENMP(link->hc_UnpackAndBOR = CPPJoin4(UnpackColoredAndBOR,Type,BS,EQ));               \
+    SF_OPENMP(link->hc_UnpackAndBXOR = CPPJoin4(UnpackColoredAndBXOR,Type,BS,EQ));             \
+    link->h_FetchAndBAND   = CPPJoin4(FetchAndBAND,Type,BS,EQ);                                \
+    link->h_FetchAndBOR    = CPPJoin4(FetchAndBOR,Type,BS,EQ);                                 \
+    link->h_FetchAndBXOR   = CPPJoin4(FetchAndBXOR,Type,BS,EQ);                                \
   }
 
 /* Maxloc, Minloc */
@@ -359,6 +481,8 @@
   static void CPPJoin3(PackInit_Xloc,Type1,Type2)(PetscSFPack link) {                          \
     link->h_UnpackAndMaxloc = CPPJoin4(UnpackAndMaxloc,PairType(Type1,Type2),1,1);             \
     link->h_UnpackAndMinloc = CPPJoin4(UnpackAndMinloc,PairType(Type1,Type2),1,1);             \
+    SF_OPENMP(link->hc_UnpackAndMaxloc = link->h_UnpackAndMaxloc); /* Serial */                \
+    SF_OPENMP(link->hc_UnpackAndMinloc = link->h_UnpackAndMinloc);                             \
     link->h_FetchAndMaxloc  = CPPJoin4(FetchAndMaxloc, PairType(Type1,Type2),1,1);             \
     link->h_FetchAndMinloc  = CPPJoin4(FetchAndMinloc, PairType(Type1,Type2),1,1);             \
   }
@@ -543,6 +667,31 @@ PetscErrorCode PetscSFPackReclaim(PetscSF sf,PetscSFPack *link)
   PetscFunctionReturn(0);
 }
 
+/* Cancel the receives started for a next operation in the given direction, since it is not the operation coming next
+   and it needs their buffer. The peers can not have sent anything for them yet, since they wait for our messages of
+   the current operation before starting another one.
+*/
+PetscErrorCode PetscSFPackCancelPreposted(PetscSFPack link,PetscSFDirection direction)
+{
+  PetscErrorCode ierr;
+  PetscMPIInt    i,n,flg;
+  MPI_Request    *reqs;
+  MPI_Status     status;
+
+  PetscFunctionBegin;
+  if (!link->preposted[direction]) PetscFunctionReturn(0);
+  if (direction == PETSCSF_ROOT2LEAF_BCAST) {n = link->nleafreqs; reqs = link->leafreqs[direction][PETSC_MEMTYPE_HOST];}
+  else                                      {n = link->nrootreqs; reqs = link->rootreqs[direction][PETSC_MEMTYPE_HOST];}
+  for (i=0; i<n; i++) {
+    ierr = MPI_Cancel(&reqs[i]);CHKERRQ(ierr);
+    ierr = MPI_Wait(&reqs[i],&status);CHKERRQ(ierr);
+    ierr = MPI_Test_cancelled(&status,&flg);CHKERRQ(ierr);
+    if (!flg) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"A preposted receive got the message of another operation");
+  }
+  link->preposted[direction] = PETSC_FALSE;
+  PetscFunctionReturn(0);
+}
+
 /* Destroy all links, i.e., PetscSFPacks in the linked list, usually named 'avail' */
 PetscErrorCode PetscSFPackDestroyAvailable(PetscSF sf,PetscSFPack *avail)
 {
@@ -554,6 +703,8 @@ PetscErrorCode PetscSFPackDestroyAvailable(PetscSF sf,PetscSFPack *avail)
   for (; link; link=next) {
     next = link->next;
     if (!link->isbuiltin) {ierr = MPI_Type_free(&link->unit);CHKERRQ(ierr);}
+    ierr = PetscSFPackCancelPreposted(link,PETSCSF_ROOT2LEAF_BCAST);CHKERRQ(ierr);
+    ierr = PetscSFPackCancelPreposted(link,PETSCSF_LEAF2ROOT_REDUCE);CHKERRQ(ierr);
     for (i=0; i<(link->nrootreqs+link->nleafreqs)*4; i++) { /* Persistent reqs must be freed. */
       if (link->reqs[i] != MPI_REQUEST_NULL) {ierr = MPI_Request_free(&link->reqs[i]);CHKERRQ(ierr);}
     }
@@ -629,6 +780,7 @@ PetscErrorCode PetscSFPackSetUp_Host(PetscSF sf,PetscSFPack link,MPI_Datatype un
   ierr = MPI_Type_get_envelope(unit,&ni,&na,&nd,&combiner);CHKERRQ(ierr);
   link->isbuiltin = (combiner == MPI_COMBINER_NAMED) ? PETSC_TRUE : PETSC_FALSE; /* unit is MPI builtin */
   link->bs = 1; /* default */
+  link->nthreads = sf->nthreads;
 
   if (is2Int) {
     PackInit_PairType_int_int(link);
@@ -734,6 +886,23 @@ PetscErrorCode PetscSFPackGetUnpackAndOp(PetscSFPack link,PetscMemType mtype,MPI
 {
   PetscFunctionBegin;
   *UnpackAndOp = NULL;
+#if defined(PETSC_HAVE_OPENMP)
+  if (mtype == PETSC_MEMTYPE_HOST && atomic && link->nthreads > 1) { /* Colored routines avoid the races of threads */
+    if      (op == MPIU_REPLACE)              *UnpackAndOp = link->hc_UnpackAndInsert;
+    else if (op == MPI_SUM || op == MPIU_SUM) *UnpackAndOp = link->hc_UnpackAndAdd;
+    else if (op == MPI_PROD)                  *UnpackAndOp = link->hc_UnpackAndMult;
+    else if (op == MPI_MAX || op == MPIU_MAX) *UnpackAndOp = link->hc_UnpackAndMax;
+    else if (op == MPI_MIN || op == MPIU_MIN) *UnpackAndOp = link->hc_UnpackAndMin;
+    else if (op == MPI_LAND)                  *UnpackAndOp = link->hc_UnpackAndLAND;
+    else if (op == MPI_BAND)                  *UnpackAndOp = link->hc_UnpackAndBAND;
+    else if (op == MPI_LOR)                   *UnpackAndOp = link->hc_UnpackAndLOR;
+    else if (op == MPI_BOR)                   *UnpackAndOp = link->hc_UnpackAndBOR;
+    else if (op == MPI_LXOR)                  *UnpackAndOp = link->hc_UnpackAndLXOR;
+    else if (op == MPI_BXOR)                  *UnpackAndOp = link->hc_UnpackAndBXOR;
+    else if (op == MPI_MAXLOC)                *UnpackAndOp = link->hc_UnpackAndMaxloc;
+    else if (op == MPI_MINLOC)                *UnpackAndOp = link->hc_UnpackAndMinloc;
+  } else
+#endif
   if (mtype == PETSC_MEMTYPE_HOST) {
     if      (op == MPIU_REPLACE)              *UnpackAndOp = link->h_UnpackAndInsert;
     else if (op == MPI_SUM || op == MPIU_SUM) *UnpackAndOp = link->h_UnpackAndAdd;
@@ -856,7 +1025,7 @@ PetscErrorCode PetscSFPackGetFetchAndOp(PetscSFPack link,PetscMemType mtype,MPI_
 PetscErrorCode PetscSFPackOptCreate(PetscInt n,const PetscInt *offset,const PetscInt *idx,PetscSFPackOpt *out)
 {
   PetscErrorCode ierr;
-  PetscInt       i,j,k,n_copies,tot_copies=0,step;
+  PetscInt       i,j,k,n_copies,tot_copies=0,step,m,start,dx,dy,dz,X,Y;
   PetscBool      strided,optimized=PETSC_FALSE;
   PetscSFPackOpt opt;
 
@@ -892,7 +1061,7 @@ PetscErrorCode PetscSFPackOptCreate(PetscInt n,const PetscInt *offset,const Pets
 
   /* Setup memcpy plan for each contiguous piece */
   k    = 0; /* k-th copy */
-  ierr = PetscMalloc4(tot_copies,&opt->copy_start,tot_copies,&opt->copy_length,n,&opt->stride_step,n,&opt->stride_n);CHKERRQ(ierr);
+  ierr = PetscMalloc6(tot_copies,&opt->copy_start,tot_copies,&opt->copy_length,n,&opt->stride_step,n,&opt->stride_n,3*n,&opt->box_n,2*n,&opt->box_step);CHKERRQ(ierr);
   for (i=0; i<n; i++) { /* for each target processor */
     if (opt->type[i] == PETSCSF_PACKOPT_MULTICOPY) {
       n_copies           = 1;
@@ -929,10 +1098,37 @@ PetscErrorCode PetscSFPackOptCreate(PetscInt n,const PetscInt *offset,const Pets
       }
     }
   }
+
+  /* Are the indices a 3D box, i.e., dx long contiguous runs, dy runs X apart in a plane, dz planes Y apart? Ghost
+     exchanges of DMDA are made of such boxes, whose runs are usually too short for memcpy */
+  for (i=0; i<n; i++) {
+    m = offset[i+1] - offset[i];
+    if (opt->type[i] != PETSCSF_PACKOPT_NONE || m < 16) continue;
+    start = idx[offset[i]];
+    for (dx=1; dx<m && idx[offset[i]+dx] == start+dx; dx++) ;
+    X = (dx < m) ? idx[offset[i]+dx] - start : 0;
+    if (dx < m && X <= dx) continue; /* Runs must not overlap and must go forward */
+    for (dy=1; dy*dx<m && idx[offset[i]+dy*dx] == start+dy*X; dy++) ;
+    if (m % (dx*dy)) continue;
+    dz = m/(dx*dy);
+    Y  = (dz > 1) ? idx[offset[i]+dx*dy] - start : 0;
+    if (dz > 1 && Y < (dy-1)*X+dx) continue;
+    for (j=0; j<m; j++) { /* j = (c*dy+b)*dx+a */
+      if (idx[offset[i]+j] != start + (j/(dx*dy))*Y + ((j/dx)%dy)*X + j%dx) break;
+    }
+    if (j < m) continue;
+    opt->type[i]          = PETSCSF_PACKOPT_BOX;
+    opt->box_n[3*i]       = dx;
+    opt->box_n[3*i+1]     = dy;
+    opt->box_n[3*i+2]     = dz;
+    opt->box_step[2*i]    = X;
+    opt->box_step[2*i+1]  = Y;
+    optimized             = PETSC_TRUE;
+  }
   /* If no rank gets optimized, free arrays to save memory */
   if (!optimized) {
     ierr = PetscFree3(opt->type,opt->offset,opt->copy_offset);CHKERRQ(ierr);
-    ierr = PetscFree4(opt->copy_start,opt->copy_length,opt->stride_step,opt->stride_n);CHKERRQ(ierr);
+    ierr = PetscFree6(opt->copy_start,opt->copy_length,opt->stride_step,opt->stride_n,opt->box_n,opt->box_step);CHKERRQ(ierr);
     ierr = PetscFree(opt);CHKERRQ(ierr);
     *out = NULL;
   } else *out = opt;
@@ -947,7 +1143,7 @@ PetscErrorCode PetscSFPackOptDestroy(PetscSFPackOpt *out)
   PetscFunctionBegin;
   if (opt) {
     ierr = PetscFree3(opt->type,opt->offset,opt->copy_offset);CHKERRQ(ierr);
-    ierr = PetscFree4(opt->copy_start,opt->copy_length,opt->stride_step,opt->stride_n);CHKERRQ(ierr);
+    ierr = PetscFree6(opt->copy_start,opt->copy_length,opt->stride_step,opt->stride_n,opt->box_n,opt->box_step);CHKERRQ(ierr);
     ierr = PetscFree(opt);CHKERRQ(ierr);
     *out = NULL;
   }
@@ -11,9 +11,10 @@
   Often, the indices are associated with n ranks. Each rank's indices are stored consecutively in idx[].
   We analyze indices for each rank and see if they are patterns that can be used to optimize the packing.
   The result is stored in PetscSFPackOpt. Packing for a rank might be non-optimizable, or optimized into
-  a small number of contiguous memory copies or one strided memory copy.
+  a small number of contiguous memory copies, one strided memory copy, or a copy of a 3D box (such as the face or
+  edge slabs exchanged by DMDA), which is a set of equally long contiguous runs laid out in rows and planes.
  */
-typedef enum {PETSCSF_PACKOPT_NONE=0, PETSCSF_PACKOPT_MULTICOPY, PETSCSF_PACKOPT_STRIDE} PetscSFPackOptType;
+typedef enum {PETSCSF_PACKOPT_NONE=0, PETSCSF_PACKOPT_MULTICOPY, PETSCSF_PACKOPT_STRIDE, PETSCSF_PACKOPT_BOX} PetscSFPackOptType;
 
 struct _n_PetscSFPackOpt {
   PetscInt           n;             /* Number of destination ranks */
@@ -24,6 +25,8 @@ struct _n_PetscSFPackOpt {
   PetscInt           *copy_length;  /* [*]     starting at idx[copy_start[j]] */
   PetscInt           *stride_step;  /* [n]   If type[i] = PETSCSF_PACKOPT_STRIDE, then packing for i-th rank is strided, with first index being idx[offset[i]] and step stride_step[i], */
   PetscInt           *stride_n;     /* [n]     and total stride_n[i] steps */
+  PetscInt           *box_n;        /* [3n]  If type[i] = PETSCSF_PACKOPT_BOX, then the indices for i-th rank are idx[offset[i]] + c*box_step[2i+1] + b*box_step[2i] + a, */
+  PetscInt           *box_step;     /* [2n]    for a < box_n[3i], b < box_n[3i+1], c < box_n[3i+2], with a running fastest */
 };
 
 typedef struct _n_PetscSFPack* PetscSFPack;
@@ -58,6 +61,24 @@ struct _n_PetscSFPack {
   PetscErrorCode (*h_FetchAndBOR)     (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,      void*);
   PetscErrorCode (*h_FetchAndLXOR)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,      void*);
   PetscErrorCode (*h_FetchAndBXOR)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,      void*);
+#if defined(PETSC_HAVE_OPENMP)
+  /* Host unpacking used with link->nthreads > 1 threads when the indices might have duplicates. Threads only update
+     entries of their own color, see sfpack.c. Maxloc and Minloc are serial.
+  */
+  PetscErrorCode (*hc_UnpackAndInsert) (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndAdd)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndMin)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndMax)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndMinloc) (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndMaxloc) (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndMult)   (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndLAND)   (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndBAND)   (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndLOR)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndBOR)    (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndLXOR)   (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+  PetscErrorCode (*hc_UnpackAndBXOR)   (PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+#endif
 #if defined(PETSC_HAVE_CUDA)
   /* These fields are lazily initialized in a sense that only when device pointers are passed to an SF, the SF
      will set them, otherwise it just leaves them alone even though PETSC_HAVE_CUDA. Packing routines using
@@ -125,11 +146,13 @@ struct _n_PetscSFPack {
   cudaStream_t   stream;                 /* Stream to launch pack/unapck kernels if not using the default stream */
 #endif
   PetscMPIInt    tag;                    /* Each link has a tag so we can perform multiple SF ops at the same time */
+  PetscMPIInt    rtag;                   /* Tag of leaf to root messages, so that receives preposted for one direction never match messages of the other */
   MPI_Datatype   unit;                   /* The MPI datatype this PetscSFPack is built for */
   MPI_Datatype   basicunit;              /* unit is made of MPI builtin dataype basicunit */
   PetscBool      isbuiltin;              /* Is unit an MPI/PETSc builtin datatype? If it is true, then bs=1 and basicunit is equivalent to unit */
   size_t         unitbytes;              /* Number of bytes in a unit */
   PetscInt       bs;                     /* Number of basic units in a unit */
+  PetscInt       nthreads;               /* Number of threads of the host pack/unpack routines. It is a copy from SF for convenience */
   const void     *rootdata,*leafdata;    /* rootdata and leafdata used as keys for operation */
   char           *rootbuf[2];            /* Buffer for packed roots on Host (0 or PETSC_MEMTYPE_HOST) or Device (1 or PETSC_MEMTYPE_DEVICE) */
   char           *leafbuf[2];            /* Buffer for packed leaves on Host (0) or Device (1) */
@@ -146,12 +169,14 @@ struct _n_PetscSFPack {
   PetscBool      rootreqsinited[2][2];   /* Are root requests initialized? Also in layout of [PETSCSF_DIRECTION][PETSC_MEMTYPE]*/
   PetscBool      leafreqsinited[2][2];   /* Are leaf requests initialized? Also in layout of [PETSCSF_DIRECTION][PETSC_MEMTYPE]*/
   MPI_Request    *reqs;                  /* An array of length (nrootreqs+nleafreqs)*4. Pointers in rootreqs[][] and leafreqs[][] point here */
+  PetscBool      preposted[2];           /* Are the host receives of [PETSCSF_DIRECTION] started ahead of the next operation in that direction? */
   PetscSFPack    next;
 };
 
 PETSC_INTERN PetscErrorCode PetscSFPackGetInUse(PetscSF,MPI_Datatype,const void*,const void*,PetscCopyMode,PetscSFPack*);
 PETSC_INTERN PetscErrorCode PetscSFPackReclaim(PetscSF,PetscSFPack*);
 PETSC_INTERN PetscErrorCode PetscSFPackDestroyAvailable(PetscSF,PetscSFPack*);
+PETSC_INTERN PetscErrorCode PetscSFPackCancelPreposted(PetscSFPack,PetscSFDirection);
 
 PETSC_STATIC_INLINE PetscErrorCode PetscSFPackGetPack(PetscSFPack link,PetscMemType mtype,PetscErrorCode (**Pack)(PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,const void*,void*))
 {
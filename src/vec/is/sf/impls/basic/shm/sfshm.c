@@ -0,0 +1,701 @@
+#include <../src/vec/is/sf/impls/basic/sfpack.h>
+#include <../src/vec/is/sf/impls/basic/sfbasic.h>
+
+#if defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY)
+
+/*
+   PETSCSFSHM is SFBasic with the MPI point-to-point messages replaced by copies through MPI-3 shared memory windows.
+
+   Each link (one per MPI datatype) has a window with one segment per rank of the node. The segment of a rank holds its
+   root buffer, followed by its leaf buffer, and on the leader (rank 0 of the node) a buffer for the data going to other
+   nodes (bufout), followed by a buffer for the data coming from other nodes (bufin), all in units of the datatype.
+
+   A rank reads the chunk of a peer on the same node directly from the segment of the peer. The chunks between nodes are
+   aggregated by the leaders, which exchange one message per pair of nodes. Both leaders of a pair order the chunks by
+   (root rank, leaf rank), so the layout of the messages needs no negotiation.
+
+   The windows are allocated once per link, which the SF keeps and reuses for each datatype, since links of different
+   datatypes can be in use at the same time. -sf_basic_prepost is rejected, since bufout and bufin are the send buffer in one
+   direction and the receive buffer in the other.
+*/
+
+/* A graph edge between ranks on different nodes, as seen by the leader of one of them */
+typedef struct {
+  PetscInt leader;  /* Leader of the other node */
+  PetscInt rrank;   /* Rank owning the roots */
+  PetscInt lrank;   /* Rank owning the leaves */
+  PetscInt len;     /* Number of units in the chunk */
+  PetscInt off;     /* Offset of the chunk in the segment of the rank on this node */
+  PetscInt shmrank; /* Rank on this node */
+  PetscInt gidx;    /* Index of the edge on the leader before sorting */
+} PetscSFShmEdge;
+
+typedef struct _n_PetscSFShmWin *PetscSFShmWin;
+struct _n_PetscSFShmWin {
+  PetscSFPack   link;  /* The link whose buffers live in this window */
+  MPI_Win       win;
+  char          **base; /* [shmsize] Start of the segments of the ranks on this node */
+  MPI_Request   *reqs;  /* [noutleaders+ninleaders] Requests of the leader */
+  PetscSFShmWin next;
+};
+
+typedef struct {
+  SFBASICHEADER;
+  PetscInt       ranks_per_node; /* If positive, split each node into groups of this many ranks, to test the inter-node path on one node */
+  MPI_Comm       shmcomm;        /* Ranks sharing memory */
+  PetscMPIInt    shmrank,shmsize;
+  PetscMPIInt    *leafsrcrank;   /* [nranks-ndranks] Rank on this node holding the chunk of roots of a remote root rank */
+  PetscInt       *leafsrcoff;    /* [nranks-ndranks] Offset of that chunk in its segment */
+  PetscMPIInt    *rootsrcrank;   /* [niranks-ndiranks] Rank on this node holding the chunk of leaves of a remote leaf rank */
+  PetscInt       *rootsrcoff;    /* [niranks-ndiranks] Offset of that chunk in its segment */
+  /* Only meaningful on the leader */
+  PetscMPIInt    noutleaders,*outleaders; /* Leaders owning leaves of roots on this node */
+  PetscInt       *outoffset;              /* [noutleaders+1] Chunks for outleaders[i] are in [outoffset[i],outoffset[i+1]) of bufout */
+  PetscMPIInt    ninleaders,*inleaders;   /* Leaders owning roots of leaves on this node */
+  PetscInt       *inoffset;               /* [ninleaders+1] Chunks for inleaders[i] are in [inoffset[i],inoffset[i+1]) of bufin */
+  PetscInt       noutedges,ninedges;
+  PetscSFShmEdge *outedges,*inedges;      /* Sorted edges, in the order of their chunks in bufout and bufin */
+  PetscInt       bufoutstart,bufinstart;  /* Offsets of bufout and bufin in the segment of the leader */
+  PetscSFShmWin  wins;
+} PetscSF_Shm;
+
+/*===================================================================================*/
+/*              Internal utility routines                                            */
+/*===================================================================================*/
+
+/* The communicators of the groups of ranks_per_node ranks of a node, cached on the communicator of the node */
+typedef struct {
+  PetscInt n;
+  PetscInt *ranks_per_node;
+  MPI_Comm *comms;
+} PetscSFShmSplitComms;
+
+static PetscMPIInt Petsc_SFShm_keyval = MPI_KEYVAL_INVALID;
+
+/*
+   Private routine to free the split communicators when the communicator of the node is freed, called by MPI
+*/
+PETSC_EXTERN PetscMPIInt MPIAPI Petsc_DelComm_SFShm(MPI_Comm comm,PetscMPIInt keyval,void *val,void *extra_state)
+{
+  PetscErrorCode       ierr;
+  PetscSFShmSplitComms *split = (PetscSFShmSplitComms*)val;
+  PetscInt             i;
+
+  PetscFunctionBegin;
+  for (i=0; i<split->n; i++) {ierr = MPI_Comm_free(&split->comms[i]);CHKERRMPI(ierr);}
+  ierr = PetscFree2(split->ranks_per_node,split->comms);CHKERRMPI(ierr);
+  ierr = PetscFree(split);CHKERRMPI(ierr);
+  PetscFunctionReturn(MPI_SUCCESS);
+}
+
+static PetscErrorCode PetscSFShmFinalizePackage_Private(void)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MPI_Comm_free_keyval(&Petsc_SFShm_keyval);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Get the communicator of the group of ranks_per_node ranks of nodecomm this rank is in, or nodecomm itself if
+   ranks_per_node is not positive. It is split the first time and then cached on nodecomm, as the communicator of the
+   node is cached on the communicator of the SF by PetscShmCommGet(). The caller does not free it.
+*/
+static PetscErrorCode PetscSFShmGetSplitComm_Private(MPI_Comm nodecomm,PetscInt ranks_per_node,MPI_Comm *splitcomm)
+{
+  PetscErrorCode       ierr;
+  PetscSFShmSplitComms *split;
+  PetscMPIInt          noderank,flg;
+  PetscInt             i,*rpn;
+  MPI_Comm             *comms;
+
+  PetscFunctionBegin;
+  if (ranks_per_node <= 0) {*splitcomm = nodecomm; PetscFunctionReturn(0);}
+  if (Petsc_SFShm_keyval == MPI_KEYVAL_INVALID) {
+    ierr = MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN,Petsc_DelComm_SFShm,&Petsc_SFShm_keyval,NULL);CHKERRQ(ierr);
+    ierr = PetscRegisterFinalize(PetscSFShmFinalizePackage_Private);CHKERRQ(ierr);
+  }
+  ierr = MPI_Comm_get_attr(nodecomm,Petsc_SFShm_keyval,&split,&flg);CHKERRQ(ierr);
+  if (!flg) {
+    ierr = PetscNew(&split);CHKERRQ(ierr);
+    ierr = MPI_Comm_set_attr(nodecomm,Petsc_SFShm_keyval,split);CHKERRQ(ierr);
+  }
+  for (i=0; i<split->n; i++) {
+    if (split->ranks_per_node[i] == ranks_per_node) {*splitcomm = split->comms[i]; PetscFunctionReturn(0);}
+  }
+  ierr = PetscMalloc2(split->n+1,&rpn,split->n+1,&comms);CHKERRQ(ierr);
+  ierr = PetscArraycpy(rpn,split->ranks_per_node,split->n);CHKERRQ(ierr);
+  ierr = PetscArraycpy(comms,split->comms,split->n);CHKERRQ(ierr);
+  ierr = PetscFree2(split->ranks_per_node,split->comms);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(nodecomm,&noderank);CHKERRQ(ierr);
+  ierr = MPI_Comm_split(nodecomm,noderank/ranks_per_node,noderank,&comms[split->n]);CHKERRQ(ierr);
+  rpn[split->n]         = ranks_per_node;
+  *splitcomm            = comms[split->n];
+  split->ranks_per_node = rpn;
+  split->comms          = comms;
+  split->n++;
+  PetscFunctionReturn(0);
+}
+
+static int PetscSFShmEdgeCompare(const void *a,const void *b)
+{
+  const PetscSFShmEdge *x = (const PetscSFShmEdge*)a,*y = (const PetscSFShmEdge*)b;
+
+  if (x->leader != y->leader) return x->leader < y->leader ? -1 : 1;
+  if (x->rrank  != y->rrank)  return x->rrank  < y->rrank  ? -1 : 1;
+  if (x->lrank  != y->lrank)  return x->lrank  < y->lrank  ? -1 : 1;
+  return 0;
+}
+
+/* Gather the inter-node edges of the ranks on this node to the leader, which orders them and returns to each rank the
+   offsets of its chunks in the leader's buffer. The leader also gets the sorted edges and their split among the other leaders.
+*/
+static PetscErrorCode PetscSFShmRouteEdges_Private(PetscSF sf,PetscInt n,PetscSFShmEdge *edges,PetscInt *pos,PetscMPIInt *nleaders,PetscMPIInt **leaders,PetscInt **offset,PetscInt *nall,PetscSFShmEdge **all)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  PetscMPIInt    i,nn,nl = 0,*counts = NULL,*displs = NULL;
+  PetscInt       j,p,total = 0,*allpos = NULL;
+  MPI_Datatype   edgetype;
+
+  PetscFunctionBegin;
+  *nleaders = 0;
+  *leaders  = NULL;
+  *offset   = NULL;
+  *all      = NULL;
+  ierr = PetscMPIIntCast(n,&nn);CHKERRQ(ierr);
+  ierr = MPI_Type_contiguous(sizeof(PetscSFShmEdge)/sizeof(PetscInt),MPIU_INT,&edgetype);CHKERRQ(ierr);
+  ierr = MPI_Type_commit(&edgetype);CHKERRQ(ierr);
+  if (!shm->shmrank) {ierr = PetscMalloc2(shm->shmsize,&counts,shm->shmsize+1,&displs);CHKERRQ(ierr);}
+  ierr = MPI_Gather(&nn,1,MPI_INT,counts,1,MPI_INT,0,shm->shmcomm);CHKERRQ(ierr);
+  if (!shm->shmrank) {
+    displs[0] = 0;
+    for (i=0; i<shm->shmsize; i++) displs[i+1] = displs[i]+counts[i];
+    total = displs[shm->shmsize];
+    ierr  = PetscMalloc1(total,all);CHKERRQ(ierr);
+    ierr  = PetscMalloc1(total,&allpos);CHKERRQ(ierr);
+  }
+  ierr = MPI_Gatherv(edges,nn,edgetype,*all,counts,displs,edgetype,0,shm->shmcomm);CHKERRQ(ierr);
+  if (!shm->shmrank) {
+    for (j=0; j<total; j++) (*all)[j].gidx = j;
+    qsort(*all,total,sizeof(PetscSFShmEdge),PetscSFShmEdgeCompare);
+    for (j=0; j<total; j++) if (!j || (*all)[j].leader != (*all)[j-1].leader) nl++;
+    ierr = PetscMalloc2(nl,leaders,nl+1,offset);CHKERRQ(ierr);
+    for (j=0,p=0,nl=0; j<total; j++) {
+      if (!j || (*all)[j].leader != (*all)[j-1].leader) {
+        ierr           = PetscMPIIntCast((*all)[j].leader,&(*leaders)[nl]);CHKERRQ(ierr);
+        (*offset)[nl++] = p;
+      }
+      allpos[(*all)[j].gidx] = p;
+      p += (*all)[j].len;
+    }
+    (*offset)[nl] = p;
+    *nleaders     = nl;
+  }
+  ierr  = MPI_Scatterv(allpos,counts,displs,MPIU_INT,pos,nn,MPIU_INT,0,shm->shmcomm);CHKERRQ(ierr);
+  *nall = total;
+  ierr  = PetscFree(allpos);CHKERRQ(ierr);
+  ierr  = PetscFree2(counts,displs);CHKERRQ(ierr);
+  ierr  = MPI_Type_free(&edgetype);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Get a link with its root and leaf buffers in a shared memory window, allocating the window the first time the link is used */
+static PetscErrorCode PetscSFPackGet_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType rootmtype,const void *rootdata,PetscMemType leafmtype,const void *leafdata,PetscSFPack *mylink,PetscSFShmWin *mywin)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  PetscInt       i,nrootranks,ndrootranks,nleafranks,ndleafranks,segsize;
+  PetscMPIInt    r,disp_unit;
+  MPI_Aint       size;
+  MPI_Info       info;
+  char           *base;
+  PetscSFPack    link;
+  PetscSFShmWin  w;
+
+  PetscFunctionBegin;
+  if (rootmtype != PETSC_MEMTYPE_HOST || leafmtype != PETSC_MEMTYPE_HOST) SETERRQ(PetscObjectComm((PetscObject)sf),PETSC_ERR_SUP,"PETSCSFSHM only supports root and leaf data in host memory");
+  ierr = PetscSFGetRootInfo_Basic(sf,&nrootranks,&ndrootranks,NULL,NULL,NULL);CHKERRQ(ierr);
+  ierr = PetscSFGetLeafInfo_Basic(sf,&nleafranks,&ndleafranks,NULL,NULL,NULL,NULL);CHKERRQ(ierr);
+  ierr = PetscSFPackGet_Basic_Common(sf,unit,rootmtype,rootdata,leafmtype,leafdata,nrootranks-ndrootranks,nleafranks-ndleafranks,&link);CHKERRQ(ierr);
+  for (w=shm->wins; w; w=w->next) if (w->link == link) break;
+  if (!w) {
+    /* Collective on shmcomm, which is fine since all ranks create their links in the same SF operations */
+    segsize = link->rootbuflen + link->leafbuflen;
+    if (!shm->shmrank) segsize = shm->bufinstart + shm->inoffset[shm->ninleaders];
+    ierr = PetscNew(&w);CHKERRQ(ierr);
+    ierr = PetscMalloc2(shm->shmsize,&w->base,shm->noutleaders+shm->ninleaders,&w->reqs);CHKERRQ(ierr);
+    ierr = MPI_Info_create(&info);CHKERRQ(ierr);
+    ierr = MPI_Info_set(info,"alloc_shared_noncontig","true");CHKERRQ(ierr);
+    ierr = MPI_Win_allocate_shared((MPI_Aint)(segsize*link->unitbytes),1,info,shm->shmcomm,&base,&w->win);CHKERRQ(ierr);
+    ierr = MPI_Info_free(&info);CHKERRQ(ierr);
+    ierr = MPI_Win_lock_all(MPI_MODE_NOCHECK,w->win);CHKERRQ(ierr);
+    for (r=0; r<shm->shmsize; r++) {ierr = MPI_Win_shared_query(w->win,r,&size,&disp_unit,&w->base[r]);CHKERRQ(ierr);}
+
+    /* Replace the buffers allocated by SFBasic, and the persistent requests that might have been built on them */
+    for (i=0; i<(link->nrootreqs+link->nleafreqs)*4; i++) {
+      if (link->reqs[i] != MPI_REQUEST_NULL) {ierr = MPI_Request_free(&link->reqs[i]);CHKERRQ(ierr);}
+    }
+    ierr = PetscArrayzero(&link->rootreqsinited[0][0],4);CHKERRQ(ierr);
+    ierr = PetscArrayzero(&link->leafreqsinited[0][0],4);CHKERRQ(ierr);
+    ierr = PetscFreeWithMemType(PETSC_MEMTYPE_HOST,link->rootbuf[PETSC_MEMTYPE_HOST]);CHKERRQ(ierr);
+    ierr = PetscFreeWithMemType(PETSC_MEMTYPE_HOST,link->leafbuf[PETSC_MEMTYPE_HOST]);CHKERRQ(ierr);
+    link->rootbuf[PETSC_MEMTYPE_HOST] = base;
+    link->leafbuf[PETSC_MEMTYPE_HOST] = base + link->rootbuflen*link->unitbytes;
+    w->link    = link;
+    w->next    = shm->wins;
+    shm->wins  = w;
+  }
+  *mylink = link;
+  *mywin  = w;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFShmGetWin(PetscSF sf,PetscSFPack link,PetscSFShmWin *mywin)
+{
+  PetscSF_Shm   *shm = (PetscSF_Shm*)sf->data;
+  PetscSFShmWin w;
+
+  PetscFunctionBegin;
+  for (w=shm->wins; w; w=w->next) if (w->link == link) break;
+  if (!w) SETERRQ(PetscObjectComm((PetscObject)sf),PETSC_ERR_PLIB,"No shared memory window for this link");
+  *mywin = w;
+  PetscFunctionReturn(0);
+}
+
+/* Make the stores of all ranks on the node to the window visible to each other */
+PETSC_STATIC_INLINE PetscErrorCode PetscSFShmSync(PetscSF_Shm *shm,PetscSFShmWin w)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = MPI_Win_sync(w->win);CHKERRQ(ierr);
+  ierr = MPI_Barrier(shm->shmcomm);CHKERRQ(ierr);
+  ierr = MPI_Win_sync(w->win);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* Start moving the packed root buffers to the leaf buffers. The leader receives the chunks from other nodes into bufin,
+   and once all ranks of the node have packed, sends the chunks of bufout, one message per destination node.
+*/
+static PetscErrorCode PetscSFShmBcastStart(PetscSF sf,PetscSFPack link,PetscSFShmWin w)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  MPI_Comm       comm = PetscObjectComm((PetscObject)sf);
+  size_t         ub = link->unitbytes;
+  PetscInt       i;
+  PetscMPIInt    n;
+  char           *bufout,*bufin;
+
+  PetscFunctionBegin;
+  if (!shm->shmrank) {
+    bufin = w->base[0] + shm->bufinstart*ub;
+    for (i=0; i<shm->ninleaders; i++) {
+      ierr = PetscMPIIntCast(shm->inoffset[i+1]-shm->inoffset[i],&n);CHKERRQ(ierr);
+      ierr = MPI_Irecv(bufin+shm->inoffset[i]*ub,n,link->unit,shm->inleaders[i],link->tag,comm,&w->reqs[i]);CHKERRQ(ierr);
+    }
+  }
+  ierr = PetscSFShmSync(shm,w);CHKERRQ(ierr);
+  if (!shm->shmrank) {
+    bufout = w->base[0] + shm->bufoutstart*ub;
+    for (i=0; i<shm->noutedges; i++) {
+      const PetscSFShmEdge *e = &shm->outedges[i];
+      ierr    = PetscMemcpy(bufout,w->base[e->shmrank]+e->off*ub,e->len*ub);CHKERRQ(ierr);
+      bufout += e->len*ub;
+    }
+    bufout = w->base[0] + shm->bufoutstart*ub;
+    for (i=0; i<shm->noutleaders; i++) {
+      ierr = PetscMPIIntCast(shm->outoffset[i+1]-shm->outoffset[i],&n);CHKERRQ(ierr);
+      ierr = MPI_Isend(bufout+shm->outoffset[i]*ub,n,link->unit,shm->outleaders[i],link->tag,comm,&w->reqs[shm->ninleaders+i]);CHKERRQ(ierr);
+    }
+  }
+  PetscFunctionReturn(0);
+}
+
+/* Copy the chunks of the remote root ranks, from their segments on this node or from bufin of the leader, into the leaf buffer */
+static PetscErrorCode PetscSFShmBcastFinish(PetscSF sf,PetscSFPack link,PetscSFShmWin w)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  size_t         ub = link->unitbytes;
+  PetscInt       i,nleafranks,ndleafranks;
+  const PetscInt *leafoffset;
+
+  PetscFunctionBegin;
+  if (!shm->shmrank) {ierr = MPI_Waitall(shm->ninleaders+shm->noutleaders,w->reqs,MPI_STATUSES_IGNORE);CHKERRQ(ierr);}
+  ierr = PetscSFShmSync(shm,w);CHKERRQ(ierr);
+  ierr = PetscSFGetLeafInfo_Basic(sf,&nleafranks,&ndleafranks,NULL,&leafoffset,NULL,NULL);CHKERRQ(ierr);
+  for (i=ndleafranks; i<nleafranks; i++) {
+    ierr = PetscMemcpy(link->leafbuf[PETSC_MEMTYPE_HOST]+(leafoffset[i]-leafoffset[ndleafranks])*ub,w->base[shm->leafsrcrank[i-ndleafranks]]+shm->leafsrcoff[i-ndleafranks]*ub,(leafoffset[i+1]-leafoffset[i])*ub);CHKERRQ(ierr);
+  }
+  /* The root buffers and bufin can not be reused before everyone has copied out of them */
+  ierr = PetscSFShmSync(shm,w);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/* The reverse of PetscSFShmBcastStart(): the leader receives into bufout and sends bufin */
+static PetscErrorCode PetscSFShmReduceStart(PetscSF sf,PetscSFPack link,PetscSFShmWin w)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  MPI_Comm       comm = PetscObjectComm((PetscObject)sf);
+  size_t         ub = link->unitbytes;
+  PetscInt       i;
+  PetscMPIInt    n;
+  char           *bufout,*bufin;
+
+  PetscFunctionBegin;
+  if (!shm->shmrank) {
+    bufout = w->base[0] + shm->bufoutstart*ub;
+    for (i=0; i<shm->noutleaders; i++) {
+      ierr = PetscMPIIntCast(shm->outoffset[i+1]-shm->outoffset[i],&n);CHKERRQ(ierr);
+      ierr = MPI_Irecv(bufout+shm->outoffset[i]*ub,n,link->unit,shm->outleaders[i],link->tag,comm,&w->reqs[i]);CHKERRQ(ierr);
+    }
+  }
+  ierr = PetscSFShmSync(shm,w);CHKERRQ(ierr);
+  if (!shm->shmrank) {
+    bufin = w->base[0] + shm->bufinstart*ub;
+    for (i=0; i<shm->ninedges; i++) {
+      const PetscSFShmEdge *e = &shm->inedges[i];
+      ierr   = PetscMemcpy(bufin,w->base[e->shmrank]+e->off*ub,e->len*ub);CHKERRQ(ierr);
+      bufin += e->len*ub;
+    }
+    bufin = w->base[0] + shm->bufinstart*ub;
+    for (i=0; i<shm->ninleaders; i++) {
+      ierr = PetscMPIIntCast(shm->inoffset[i+1]-shm->inoffset[i],&n);CHKERRQ(ierr);
+      ierr = MPI_Isend(bufin+shm->inoffset[i]*ub,n,link->unit,shm->inleaders[i],link->tag,comm,&w->reqs[shm->noutleaders+i]);CHKERRQ(ierr);
+    }
+  }
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFShmReduceFinish(PetscSF sf,PetscSFPack link,PetscSFShmWin w)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  size_t         ub = link->unitbytes;
+  PetscInt       i,nrootranks,ndrootranks;
+  const PetscInt *rootoffset;
+
+  PetscFunctionBegin;
+  if (!shm->shmrank) {ierr = MPI_Waitall(shm->ninleaders+shm->noutleaders,w->reqs,MPI_STATUSES_IGNORE);CHKERRQ(ierr);}
+  ierr = PetscSFShmSync(shm,w);CHKERRQ(ierr);
+  ierr = PetscSFGetRootInfo_Basic(sf,&nrootranks,&ndrootranks,NULL,&rootoffset,NULL);CHKERRQ(ierr);
+  for (i=ndrootranks; i<nrootranks; i++) {
+    ierr = PetscMemcpy(link->rootbuf[PETSC_MEMTYPE_HOST]+(rootoffset[i]-rootoffset[ndrootranks])*ub,w->base[shm->rootsrcrank[i-ndrootranks]]+shm->rootsrcoff[i-ndrootranks]*ub,(rootoffset[i+1]-rootoffset[i])*ub);CHKERRQ(ierr);
+  }
+  ierr = PetscSFShmSync(shm,w);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*===================================================================================*/
+/*              Implementations of SF public APIs                                    */
+/*===================================================================================*/
+static PetscErrorCode PetscSFSetUp_Shm(PetscSF sf)
+{
+  PetscErrorCode    ierr;
+  PetscSF_Shm       *shm = (PetscSF_Shm*)sf->data;
+  PetscShmComm      pshmcomm;
+  MPI_Comm          comm,nodecomm;
+  MPI_Group         group,shmgroup;
+  MPI_Request       *reqs;
+  PetscMPIInt       rank,leader,tag[2];
+  PetscInt          i,j,nroot,nleaf,nout = 0,nin = 0,rootbuflen,leafbuflen,start[2],*sendroot,*recvroot,*sendleaf,*recvleaf,*outpos,*inpos;
+  PetscInt          nrootranks,ndrootranks,nleafranks,ndleafranks;
+  const PetscMPIInt *rootranks,*leafranks;
+  const PetscInt    *rootoffset,*leafoffset;
+  PetscSFShmEdge    *out,*in;
+
+  PetscFunctionBegin;
+  ierr = PetscSFSetUp_Basic(sf);CHKERRQ(ierr);
+  ierr = PetscSFGetRootInfo_Basic(sf,&nrootranks,&ndrootranks,&rootranks,&rootoffset,NULL);CHKERRQ(ierr);
+  ierr = PetscSFGetLeafInfo_Basic(sf,&nleafranks,&ndleafranks,&leafranks,&leafoffset,NULL,NULL);CHKERRQ(ierr);
+  nroot      = nrootranks-ndrootranks;
+  nleaf      = nleafranks-ndleafranks;
+  rootbuflen = rootoffset[nrootranks]-rootoffset[ndrootranks];
+  leafbuflen = leafoffset[nleafranks]-leafoffset[ndleafranks];
+
+  ierr = PetscObjectGetComm((PetscObject)sf,&comm);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(comm,&rank);CHKERRQ(ierr);
+  ierr = PetscShmCommGet(comm,&pshmcomm);CHKERRQ(ierr);
+  ierr = PetscShmCommGetMpiShmComm(pshmcomm,&nodecomm);CHKERRQ(ierr);
+  ierr = PetscSFShmGetSplitComm_Private(nodecomm,shm->ranks_per_node,&shm->shmcomm);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(shm->shmcomm,&shm->shmrank);CHKERRQ(ierr);
+  ierr = MPI_Comm_size(shm->shmcomm,&shm->shmsize);CHKERRQ(ierr);
+  leader = rank;
+  ierr = MPI_Bcast(&leader,1,MPI_INT,0,shm->shmcomm);CHKERRQ(ierr);
+
+  /* Tell the peers our leader and where in our segment the chunk for them is */
+  ierr = PetscMalloc4(2*nroot,&sendroot,2*nroot,&recvroot,2*nleaf,&sendleaf,2*nleaf,&recvleaf);CHKERRQ(ierr);
+  ierr = PetscMalloc1(2*(nroot+nleaf),&reqs);CHKERRQ(ierr);
+  ierr = PetscObjectGetNewTag((PetscObject)sf,&tag[0]);CHKERRQ(ierr);
+  ierr = PetscObjectGetNewTag((PetscObject)sf,&tag[1]);CHKERRQ(ierr);
+  for (i=0; i<nroot; i++) {
+    sendroot[2*i]   = leader;
+    sendroot[2*i+1] = rootoffset[ndrootranks+i]-rootoffset[ndrootranks];
+    ierr = MPI_Irecv(recvroot+2*i,2,MPIU_INT,rootranks[ndrootranks+i],tag[0],comm,&reqs[i]);CHKERRQ(ierr);
+    ierr = MPI_Isend(sendroot+2*i,2,MPIU_INT,rootranks[ndrootranks+i],tag[1],comm,&reqs[nroot+nleaf+i]);CHKERRQ(ierr);
+  }
+  for (i=0; i<nleaf; i++) {
+    sendleaf[2*i]   = leader;
+    sendleaf[2*i+1] = rootbuflen+leafoffset[ndleafranks+i]-leafoffset[ndleafranks];
+    ierr = MPI_Irecv(recvleaf+2*i,2,MPIU_INT,leafranks[ndleafranks+i],tag[1],comm,&reqs[nroot+i]);CHKERRQ(ierr);
+    ierr = MPI_Isend(sendleaf+2*i,2,MPIU_INT,leafranks[ndleafranks+i],tag[0],comm,&reqs[2*nroot+nleaf+i]);CHKERRQ(ierr);
+  }
+  ierr = MPI_Waitall(2*(nroot+nleaf),reqs,MPI_STATUSES_IGNORE);CHKERRQ(ierr);
+
+  /* Find the peers on this node, the others are reached through the leaders */
+  ierr = PetscMalloc2(nleaf,&shm->leafsrcrank,nleaf,&shm->leafsrcoff);CHKERRQ(ierr);
+  ierr = PetscMalloc2(nroot,&shm->rootsrcrank,nroot,&shm->rootsrcoff);CHKERRQ(ierr);
+  ierr = MPI_Comm_group(comm,&group);CHKERRQ(ierr);
+  ierr = MPI_Comm_group(shm->shmcomm,&shmgroup);CHKERRQ(ierr);
+  ierr = MPI_Group_translate_ranks(group,nroot,(PetscMPIInt*)rootranks+ndrootranks,shmgroup,shm->rootsrcrank);CHKERRQ(ierr);
+  ierr = MPI_Group_translate_ranks(group,nleaf,(PetscMPIInt*)leafranks+ndleafranks,shmgroup,shm->leafsrcrank);CHKERRQ(ierr);
+  ierr = MPI_Group_free(&group);CHKERRQ(ierr);
+  ierr = MPI_Group_free(&shmgroup);CHKERRQ(ierr);
+  for (i=0; i<nroot; i++) if (shm->rootsrcrank[i] == MPI_UNDEFINED) nout++;
+  for (i=0; i<nleaf; i++) if (shm->leafsrcrank[i] == MPI_UNDEFINED) nin++;
+  ierr = PetscMalloc4(nout,&out,nout,&outpos,nin,&in,nin,&inpos);CHKERRQ(ierr);
+  for (i=0,j=0; i<nroot; i++) {
+    if (shm->rootsrcrank[i] != MPI_UNDEFINED) {shm->rootsrcoff[i] = recvroot[2*i+1]; continue;}
+    out[j].leader  = recvroot[2*i];
+    out[j].rrank   = rank;
+    out[j].lrank   = rootranks[ndrootranks+i];
+    out[j].len     = rootoffset[ndrootranks+i+1]-rootoffset[ndrootranks+i];
+    out[j].off     = sendroot[2*i+1];
+    out[j].shmrank = shm->shmrank;
+    out[j].gidx    = 0;
+    j++;
+  }
+  for (i=0,j=0; i<nleaf; i++) {
+    if (shm->leafsrcrank[i] != MPI_UNDEFINED) {shm->leafsrcoff[i] = recvleaf[2*i+1]; continue;}
+    in[j].leader  = recvleaf[2*i];
+    in[j].rrank   = leafranks[ndleafranks+i];
+    in[j].lrank   = rank;
+    in[j].len     = leafoffset[ndleafranks+i+1]-leafoffset[ndleafranks+i];
+    in[j].off     = sendleaf[2*i+1];
+    in[j].shmrank = shm->shmrank;
+    in[j].gidx    = 0;
+    j++;
+  }
+  ierr = PetscSFShmRouteEdges_Private(sf,nout,out,outpos,&shm->noutleaders,&shm->outleaders,&shm->outoffset,&shm->noutedges,&shm->outedges);CHKERRQ(ierr);
+  ierr = PetscSFShmRouteEdges_Private(sf,nin,in,inpos,&shm->ninleaders,&shm->inleaders,&shm->inoffset,&shm->ninedges,&shm->inedges);CHKERRQ(ierr);
+
+  /* Place bufout and bufin after the root and leaf buffers of the leader */
+  if (!shm->shmrank) {
+    start[0] = rootbuflen+leafbuflen;
+    start[1] = start[0]+shm->outoffset[shm->noutleaders];
+  }
+  ierr = MPI_Bcast(start,2,MPIU_INT,0,shm->shmcomm);CHKERRQ(ierr);
+  shm->bufoutstart = start[0];
+  shm->bufinstart  = start[1];
+  for (i=0,j=0; i<nroot; i++) {
+    if (shm->rootsrcrank[i] != MPI_UNDEFINED) continue;
+    shm->rootsrcrank[i] = 0;
+    shm->rootsrcoff[i]  = shm->bufoutstart+outpos[j++];
+  }
+  for (i=0,j=0; i<nleaf; i++) {
+    if (shm->leafsrcrank[i] != MPI_UNDEFINED) continue;
+    shm->leafsrcrank[i] = 0;
+    shm->leafsrcoff[i]  = shm->bufinstart+inpos[j++];
+  }
+  ierr = PetscInfo6(sf,"Shared memory rank %d of %d, %D of %D ranks accessing my roots and %D of %D ranks owning my roots are on other nodes\n",shm->shmrank,shm->shmsize,nout,nroot,nin,nleaf);CHKERRQ(ierr);
+  ierr = PetscFree4(out,outpos,in,inpos);CHKERRQ(ierr);
+  ierr = PetscFree4(sendroot,recvroot,sendleaf,recvleaf);CHKERRQ(ierr);
+  ierr = PetscFree(reqs);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFSetFromOptions_Shm(PetscOptionItems *PetscOptionsObject,PetscSF sf)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+
+  PetscFunctionBegin;
+  ierr = PetscSFSetFromOptions_Basic(PetscOptionsObject,sf);CHKERRQ(ierr);
+  ierr = PetscOptionsHead(PetscOptionsObject,"PetscSF Shm options");CHKERRQ(ierr);
+  ierr = PetscOptionsInt("-sf_shm_ranks_per_node","Treat groups of this many ranks of a node as separate nodes","PetscSFSetFromOptions",shm->ranks_per_node,&shm->ranks_per_node,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsTail();CHKERRQ(ierr);
+  /* The receives of the leaders can not be started ahead, bufout and bufin are also send buffers */
+  if (shm->prepost) SETERRQ(PetscObjectComm((PetscObject)sf),PETSC_ERR_SUP,"PETSCSFSHM does not support -sf_basic_prepost");
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFReset_Shm(PetscSF sf)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm = (PetscSF_Shm*)sf->data;
+  PetscSFShmWin  w,next;
+
+  PetscFunctionBegin;
+  if (shm->inuse) SETERRQ(PetscObjectComm((PetscObject)sf),PETSC_ERR_ARG_WRONGSTATE,"Outstanding operation has not been completed");
+  /* The buffers in the windows are not freed with the links */
+  for (w=shm->wins; w; w=w->next) {
+    w->link->rootbuf[PETSC_MEMTYPE_HOST] = NULL;
+    w->link->leafbuf[PETSC_MEMTYPE_HOST] = NULL;
+  }
+  ierr = PetscSFReset_Basic(sf);CHKERRQ(ierr); /* Common part */
+  for (w=shm->wins; w; w=next) {
+    next = w->next;
+    ierr = MPI_Win_unlock_all(w->win);CHKERRQ(ierr);
+    ierr = MPI_Win_free(&w->win);CHKERRQ(ierr);
+    ierr = PetscFree2(w->base,w->reqs);CHKERRQ(ierr);
+    ierr = PetscFree(w);CHKERRQ(ierr);
+  }
+  shm->wins = NULL;
+  ierr = PetscFree2(shm->leafsrcrank,shm->leafsrcoff);CHKERRQ(ierr);
+  ierr = PetscFree2(shm->rootsrcrank,shm->rootsrcoff);CHKERRQ(ierr);
+  ierr = PetscFree2(shm->outleaders,shm->outoffset);CHKERRQ(ierr);
+  ierr = PetscFree2(shm->inleaders,shm->inoffset);CHKERRQ(ierr);
+  ierr = PetscFree(shm->outedges);CHKERRQ(ierr);
+  ierr = PetscFree(shm->inedges);CHKERRQ(ierr);
+  shm->noutleaders = shm->ninleaders = 0;
+  shm->noutedges   = shm->ninedges   = 0;
+  shm->shmcomm     = MPI_COMM_NULL; /* Cached on the communicator of the node, see PetscSFShmGetSplitComm_Private() */
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFDestroy_Shm(PetscSF sf)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscSFReset_Shm(sf);CHKERRQ(ierr);
+  ierr = PetscFree(sf->data);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFDuplicate_Shm(PetscSF sf,PetscSFDuplicateOption opt,PetscSF newsf)
+{
+  PetscSF_Shm *shm = (PetscSF_Shm*)sf->data,*newshm = (PetscSF_Shm*)newsf->data;
+
+  PetscFunctionBegin;
+  newshm->ranks_per_node = shm->ranks_per_node;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFBcastAndOpBegin_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType rootmtype,const void *rootdata,PetscMemType leafmtype,void *leafdata,MPI_Op op)
+{
+  PetscErrorCode ierr;
+  PetscSFPack    link;
+  PetscSFShmWin  w;
+  const PetscInt *rootloc = NULL;
+
+  PetscFunctionBegin;
+  ierr = PetscSFPackGet_Shm(sf,unit,rootmtype,rootdata,leafmtype,leafdata,&link,&w);CHKERRQ(ierr);
+  ierr = PetscSFGetRootIndicesWithMemType_Basic(sf,rootmtype,&rootloc);CHKERRQ(ierr);
+  ierr = PetscSFPackRootData(sf,link,rootloc,rootdata,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFShmBcastStart(sf,link,w);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFBcastAndOpEnd_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType rootmtype,const void *rootdata,PetscMemType leafmtype,void *leafdata,MPI_Op op)
+{
+  PetscErrorCode ierr;
+  PetscSFPack    link;
+  PetscSFShmWin  w;
+  const PetscInt *leafloc = NULL;
+
+  PetscFunctionBegin;
+  ierr = PetscSFPackGetInUse(sf,unit,rootdata,leafdata,PETSC_OWN_POINTER,&link);CHKERRQ(ierr);
+  ierr = PetscSFShmGetWin(sf,link,&w);CHKERRQ(ierr);
+  ierr = PetscSFShmBcastFinish(sf,link,w);CHKERRQ(ierr);
+  ierr = PetscSFGetLeafIndicesWithMemType_Basic(sf,leafmtype,&leafloc);CHKERRQ(ierr);
+  ierr = PetscSFUnpackAndOpLeafData(sf,link,leafloc,leafdata,op,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFPackReclaim(sf,&link);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFReduceBegin_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType leafmtype,const void *leafdata,PetscMemType rootmtype,void *rootdata,MPI_Op op)
+{
+  PetscErrorCode ierr;
+  PetscSFPack    link;
+  PetscSFShmWin  w;
+  const PetscInt *leafloc = NULL;
+
+  PetscFunctionBegin;
+  ierr = PetscSFPackGet_Shm(sf,unit,rootmtype,rootdata,leafmtype,leafdata,&link,&w);CHKERRQ(ierr);
+  ierr = PetscSFGetLeafIndicesWithMemType_Basic(sf,leafmtype,&leafloc);CHKERRQ(ierr);
+  ierr = PetscSFPackLeafData(sf,link,leafloc,leafdata,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFShmReduceStart(sf,link,w);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFReduceEnd_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType leafmtype,const void *leafdata,PetscMemType rootmtype,void *rootdata,MPI_Op op)
+{
+  PetscErrorCode ierr;
+  PetscSFPack    link;
+  PetscSFShmWin  w;
+  const PetscInt *rootloc = NULL;
+
+  PetscFunctionBegin;
+  ierr = PetscSFPackGetInUse(sf,unit,rootdata,leafdata,PETSC_OWN_POINTER,&link);CHKERRQ(ierr);
+  ierr = PetscSFShmGetWin(sf,link,&w);CHKERRQ(ierr);
+  ierr = PetscSFShmReduceFinish(sf,link,w);CHKERRQ(ierr);
+  ierr = PetscSFGetRootIndicesWithMemType_Basic(sf,rootmtype,&rootloc);CHKERRQ(ierr);
+  ierr = PetscSFUnpackAndOpRootData(sf,link,rootloc,rootdata,op,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFPackReclaim(sf,&link);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFFetchAndOpBegin_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType rootmtype,void *rootdata,PetscMemType leafmtype,const void *leafdata,void *leafupdate,MPI_Op op)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscSFReduceBegin_Shm(sf,unit,leafmtype,leafdata,rootmtype,rootdata,op);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFFetchAndOpEnd_Shm(PetscSF sf,MPI_Datatype unit,PetscMemType rootmtype,void *rootdata,PetscMemType leafmtype,const void *leafdata,void *leafupdate,MPI_Op op)
+{
+  PetscErrorCode ierr;
+  PetscSFPack    link;
+  PetscSFShmWin  w;
+  const PetscInt *rootloc = NULL,*leafloc = NULL;
+
+  PetscFunctionBegin;
+  ierr = PetscSFPackGetInUse(sf,unit,rootdata,leafdata,PETSC_OWN_POINTER,&link);CHKERRQ(ierr);
+  ierr = PetscSFShmGetWin(sf,link,&w);CHKERRQ(ierr);
+  ierr = PetscSFShmReduceFinish(sf,link,w);CHKERRQ(ierr);
+  ierr = PetscSFGetRootIndicesWithMemType_Basic(sf,rootmtype,&rootloc);CHKERRQ(ierr);
+  ierr = PetscSFGetLeafIndicesWithMemType_Basic(sf,leafmtype,&leafloc);CHKERRQ(ierr);
+  /* Process local fetch-and-op, then bcast the fetched values in rootbuf back to leaves */
+  ierr = PetscSFFetchAndOpRootData(sf,link,rootloc,rootdata,op,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFShmBcastStart(sf,link,w);CHKERRQ(ierr);
+  ierr = PetscSFShmBcastFinish(sf,link,w);CHKERRQ(ierr);
+  ierr = PetscSFUnpackAndOpLeafData(sf,link,leafloc,leafupdate,MPIU_REPLACE,PETSC_TRUE);CHKERRQ(ierr);
+  ierr = PetscSFPackReclaim(sf,&link);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+PETSC_INTERN PetscErrorCode PetscSFCreate_Shm(PetscSF sf)
+{
+  PetscErrorCode ierr;
+  PetscSF_Shm    *shm;
+
+  PetscFunctionBegin;
+  sf->ops->CreateEmbeddedSF     = PetscSFCreateEmbeddedSF_Basic;
+  sf->ops->CreateEmbeddedLeafSF = PetscSFCreateEmbeddedLeafSF_Basic;
+  sf->ops->GetLeafRanks         = PetscSFGetLeafRanks_Basic;
+  sf->ops->View                 = PetscSFView_Basic;
+
+  sf->ops->SetUp                = PetscSFSetUp_Shm;
+  sf->ops->SetFromOptions       = PetscSFSetFromOptions_Shm;
+  sf->ops->Reset                = PetscSFReset_Shm;
+  sf->ops->Destroy              = PetscSFDestroy_Shm;
+  sf->ops->Duplicate            = PetscSFDuplicate_Shm;
+  sf->ops->BcastAndOpBegin      = PetscSFBcastAndOpBegin_Shm;
+  sf->ops->BcastAndOpEnd        = PetscSFBcastAndOpEnd_Shm;
+  sf->ops->ReduceBegin          = PetscSFReduceBegin_Shm;
+  sf->ops->ReduceEnd            = PetscSFReduceEnd_Shm;
+  sf->ops->FetchAndOpBegin      = PetscSFFetchAndOpBegin_Shm;
+  sf->ops->FetchAndOpEnd        = PetscSFFetchAndOpEnd_Shm;
+
+  ierr = PetscNewLog(sf,&shm);CHKERRQ(ierr);
+  shm->shmcomm = MPI_COMM_NULL;
+  sf->data     = (void*)shm;
+  PetscFunctionReturn(0);
+}
+#endif
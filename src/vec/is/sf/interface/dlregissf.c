@@ -18,6 +18,9 @@ PetscLogEvent PETSCSF_EmbedSF;
 PetscLogEvent PETSCSF_DistSect;
 PetscLogEvent PETSCSF_SectSF;
 PetscLogEvent PETSCSF_RemoteOff;
+PetscLogEvent PETSCSF_ReqsInit;
+PetscLogEvent PETSCSF_BatchBegin;
+PetscLogEvent PETSCSF_BatchEnd;
 
 /*@C
    PetscSFInitializePackage - Initialize SF package
@@ -56,6 +59,9 @@ PetscErrorCode PetscSFInitializePackage(void)
   ierr = PetscLogEventRegister("SFDistSection"  , PETSCSF_CLASSID, &PETSCSF_DistSect);CHKERRQ(ierr);
   ierr = PetscLogEventRegister("SFSectionSF"    , PETSCSF_CLASSID, &PETSCSF_SectSF);CHKERRQ(ierr);
   ierr = PetscLogEventRegister("SFRemoteOff"    , PETSCSF_CLASSID, &PETSCSF_RemoteOff);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("SFReqsInit"     , PETSCSF_CLASSID, &PETSCSF_ReqsInit);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("SFBatchBegin"   , PETSCSF_CLASSID, &PETSCSF_BatchBegin);CHKERRQ(ierr);
+  ierr = PetscLogEventRegister("SFBatchEnd"     , PETSCSF_CLASSID, &PETSCSF_BatchEnd);CHKERRQ(ierr);
   /* Process info exclusions */
   ierr = PetscOptionsGetString(NULL,NULL,"-info_exclude",logList,sizeof(logList),&opt);CHKERRQ(ierr);
   if (opt) {
@@ -27,7 +27,8 @@ const char *const PetscSFDuplicateOptions[] = {"CONFONLY","RANKS","GRAPH","Petsc
    Options Database Keys:
 +  -sf_type basic     -Use MPI persistent Isend/Irecv for communication (Default)
 .  -sf_type window    -Use MPI-3 one-sided window for communication
--  -sf_type neighbor  -Use MPI-3 neighborhood collectives for communication
+.  -sf_type neighbor  -Use MPI-3 neighborhood collectives for communication
+-  -sf_type shm       -Use MPI-3 shared memory windows within a node and one message per pair of nodes for communication
 
    Level: intermediate
 
@@ -58,6 +59,7 @@ PetscErrorCode PetscSFCreate(MPI_Comm comm,PetscSF *sf)
   b->ingroup   = MPI_GROUP_NULL;
   b->outgroup  = MPI_GROUP_NULL;
   b->graphset  = PETSC_FALSE;
+  b->nthreads  = 1;
 
   *sf = b;
   PetscFunctionReturn(0);
@@ -122,6 +124,7 @@ PetscErrorCode PetscSFReset(PetscSF sf)
    Notes:
    See "include/petscsf.h" for available methods (for instance)
 +    PETSCSFWINDOW - MPI-2/3 one-sided
+.    PETSCSFSHM - MPI-3 shared memory within a node, with the messages between nodes aggregated by one rank per node
 -    PETSCSFBASIC - basic implementation using MPI-1 two-sided
 
   Level: intermediate
@@ -268,8 +271,11 @@ PetscErrorCode PetscSFSetUp(PetscSF sf)
    Options Database Keys:
 +  -sf_type              - implementation type, see PetscSFSetType()
 .  -sf_rank_order        - sort composite points for gathers and scatters in rank order, gathers are non-deterministic otherwise
--  -sf_use_pinned_buffer - use pinned (nonpagable) memory for send/recv buffers on host when communicating GPU data but GPU-aware MPI is not used.
+.  -sf_use_pinned_buffer - use pinned (nonpagable) memory for send/recv buffers on host when communicating GPU data but GPU-aware MPI is not used.
                            Only available for SF types of basic and neighbor.
+-  -sf_num_threads <n>   - number of OpenMP threads packing and unpacking host data, 0 for the OpenMP default. Only available for SF types of
+                           basic, neighbor and shm. A pack or unpack is only threaded when it moves enough data; unpacking into leaves or roots
+                           with duplicate indices then gives each thread its own subset of the entries, so the result does not depend on the threads.
 
    Level: intermediate
 @*/
@@ -0,0 +1,455 @@
+#include <petsc/private/sfimpl.h> /*I "petscsf.h" I*/
+#include <../src/vec/is/sf/impls/basic/sfpack.h>
+
+/* An operation queued in a PetscSFBatch, together with its part of the communication plan of the batch */
+typedef struct {
+  PetscSF          sf;
+  PetscObjectState state;        /* State of sf when the plan was built */
+  MPI_Datatype     unit;
+  PetscSFDirection direction;
+  MPI_Op           op;
+  const void       *src;         /* rootdata of a broadcast, leafdata of a reduction */
+  void             *dst;         /* leafdata of a broadcast, rootdata of a reduction */
+  PetscBool        batched;      /* Is the operation part of the aggregated messages? Otherwise it is done with the regular SF operations */
+  PetscSFPack      link;         /* Only provides the routines to (un)pack <unit> */
+  PetscInt         nsend,nrecv;  /* Number of ranks the operation sends to and receives from */
+  const PetscMPIInt *sendranks,*recvranks;
+  const PetscInt   *sendoffset,*recvoffset; /* [nsend+1],[nrecv+1] Borrowed from sf */
+  const PetscInt   *sendidx,*recvidx;       /* Indices of the entries sent to and received from each rank, borrowed from sf */
+  PetscInt         *sendpos,*recvpos;       /* [nsend],[nrecv] Positions in bytes of the part of each rank in the send and receive buffers */
+} PetscSFBatchItem;
+
+struct _n_PetscSFBatch {
+  MPI_Comm         comm;
+  PetscMPIInt      tag,rank;
+  PetscInt         n,maxn;        /* Number of queued operations and length of items[] */
+  PetscSFBatchItem *items;
+  PetscInt         nplanned;      /* Number of operations the plan below was built for, -1 if there is no plan */
+  PetscBool        inuse;         /* Between PetscSFBatchBegin() and PetscSFBatchEnd() */
+  PetscBool        individual;    /* This time the operations are done one by one, since some data is on the device */
+  PetscMPIInt      nsend,nrecv;   /* Number of ranks, self included, we exchange messages with */
+  PetscMPIInt      *sendranks,*recvranks;
+  PetscInt         *sendoffset,*recvoffset; /* [nsend+1],[nrecv+1] Offsets in bytes of the messages in the buffers */
+  char             *sendbuf,*recvbuf;
+  MPI_Request      *reqs;
+};
+
+static PetscErrorCode PetscSFBatchItemReset(PetscSFBatchItem *item)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  if (item->link) {
+    if (!item->link->isbuiltin) {ierr = MPI_Type_free(&item->link->unit);CHKERRQ(ierr);}
+    ierr = PetscFree(item->link);CHKERRQ(ierr);
+  }
+  ierr = PetscFree2(item->sendpos,item->recvpos);CHKERRQ(ierr);
+  item->batched = PETSC_FALSE;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFBatchResetPlan(PetscSFBatch batch)
+{
+  PetscErrorCode ierr;
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  if (batch->nplanned < 0) PetscFunctionReturn(0);
+  for (i=0; i<batch->nplanned; i++) {ierr = PetscSFBatchItemReset(&batch->items[i]);CHKERRQ(ierr);}
+  ierr = PetscFree2(batch->sendranks,batch->sendoffset);CHKERRQ(ierr);
+  ierr = PetscFree2(batch->recvranks,batch->recvoffset);CHKERRQ(ierr);
+  ierr = PetscFree3(batch->sendbuf,batch->recvbuf,batch->reqs);CHKERRQ(ierr);
+  batch->nplanned = -1;
+  PetscFunctionReturn(0);
+}
+
+/* Sorted ranks, self included, the batched operations send to (or receive from), with the number of bytes of each message */
+static PetscErrorCode PetscSFBatchSetUpMessages(PetscSFBatch batch,PetscBool send,PetscMPIInt *nranks,PetscMPIInt **ranks,PetscInt **offset)
+{
+  PetscErrorCode   ierr;
+  PetscSFBatchItem *item;
+  PetscInt         i,j,k,n = 0,nitem,*pos;
+  const PetscInt   *off;
+  const PetscMPIInt *iranks;
+
+  PetscFunctionBegin;
+  for (i=0; i<batch->n; i++) if (batch->items[i].batched) n += send ? batch->items[i].nsend : batch->items[i].nrecv;
+  ierr = PetscMalloc2(n,ranks,n+1,offset);CHKERRQ(ierr);
+  for (i=0,n=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    if (!item->batched) continue;
+    nitem  = send ? item->nsend : item->nrecv;
+    iranks = send ? item->sendranks : item->recvranks;
+    for (j=0; j<nitem; j++) (*ranks)[n++] = iranks[j];
+  }
+  ierr = PetscSortRemoveDupsMPIInt(&n,*ranks);CHKERRQ(ierr);
+  ierr = PetscArrayzero(*offset,n+1);CHKERRQ(ierr);
+  /* Within a message, the parts of the operations are in the order the operations were added to the batch */
+  for (i=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    if (!item->batched) continue;
+    nitem  = send ? item->nsend : item->nrecv;
+    iranks = send ? item->sendranks : item->recvranks;
+    off    = send ? item->sendoffset : item->recvoffset;
+    pos    = send ? item->sendpos : item->recvpos;
+    for (j=0; j<nitem; j++) {
+      ierr       = PetscFindMPIInt(iranks[j],n,*ranks,&k);CHKERRQ(ierr);
+      pos[j]     = (*offset)[k+1];
+      (*offset)[k+1] += (off[j+1]-off[j])*item->link->unitbytes;
+    }
+  }
+  for (k=0; k<n; k++) (*offset)[k+1] += (*offset)[k];
+  for (i=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    if (!item->batched) continue;
+    nitem  = send ? item->nsend : item->nrecv;
+    iranks = send ? item->sendranks : item->recvranks;
+    pos    = send ? item->sendpos : item->recvpos;
+    for (j=0; j<nitem; j++) {
+      ierr    = PetscFindMPIInt(iranks[j],n,*ranks,&k);CHKERRQ(ierr);
+      pos[j] += (*offset)[k];
+    }
+  }
+  *nranks = (PetscMPIInt)n;
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFBatchSetUpPlan(PetscSFBatch batch)
+{
+  PetscErrorCode   ierr;
+  PetscSFBatchItem *item;
+  PetscInt         i,nranks,niranks;
+  const PetscMPIInt *ranks,*iranks;
+  const PetscInt   *roffset,*rmine,*ioffset,*irootloc;
+  PetscBool        isbasic;
+
+  PetscFunctionBegin;
+  ierr = PetscSFBatchResetPlan(batch);CHKERRQ(ierr);
+  for (i=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    ierr = PetscSFSetUp(item->sf);CHKERRQ(ierr);
+    ierr = PetscObjectStateGet((PetscObject)item->sf,&item->state);CHKERRQ(ierr);
+    /* Only the types that communicate with point to point messages along the edges of the graph are worth batching */
+    ierr = PetscObjectTypeCompareAny((PetscObject)item->sf,&isbasic,PETSCSFBASIC,PETSCSFNEIGHBOR,PETSCSFSHM,"");CHKERRQ(ierr);
+    if (!isbasic) continue;
+    ierr = PetscNew(&item->link);CHKERRQ(ierr);
+    ierr = PetscSFPackSetUp_Host(item->sf,item->link,item->unit);CHKERRQ(ierr);
+    ierr = PetscSFGetRootRanks(item->sf,&nranks,&ranks,&roffset,&rmine,NULL);CHKERRQ(ierr);
+    ierr = PetscSFGetLeafRanks(item->sf,&niranks,&iranks,&ioffset,&irootloc);CHKERRQ(ierr);
+    if (item->direction == PETSCSF_ROOT2LEAF_BCAST) { /* Roots are sent to the ranks of the leaves */
+      item->nsend = niranks; item->sendranks = iranks; item->sendoffset = ioffset; item->sendidx = irootloc;
+      item->nrecv = nranks;  item->recvranks = ranks;  item->recvoffset = roffset; item->recvidx = rmine;
+    } else {
+      item->nsend = nranks;  item->sendranks = ranks;  item->sendoffset = roffset; item->sendidx = rmine;
+      item->nrecv = niranks; item->recvranks = iranks; item->recvoffset = ioffset; item->recvidx = irootloc;
+    }
+    ierr = PetscMalloc2(item->nsend,&item->sendpos,item->nrecv,&item->recvpos);CHKERRQ(ierr);
+    item->batched = PETSC_TRUE;
+  }
+  ierr = PetscSFBatchSetUpMessages(batch,PETSC_TRUE,&batch->nsend,&batch->sendranks,&batch->sendoffset);CHKERRQ(ierr);
+  ierr = PetscSFBatchSetUpMessages(batch,PETSC_FALSE,&batch->nrecv,&batch->recvranks,&batch->recvoffset);CHKERRQ(ierr);
+  ierr = PetscMalloc3(batch->sendoffset[batch->nsend],&batch->sendbuf,batch->recvoffset[batch->nrecv],&batch->recvbuf,batch->nsend+batch->nrecv,&batch->reqs);CHKERRQ(ierr);
+  batch->nplanned = batch->n;
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscSFBatchCreate - Create a batch, which groups several PetscSF broadcasts and reductions into one exchange with one message per pair of neighbors
+
+   Collective
+
+   Input Arguments:
+.  comm - communicator of the star forests of the operations
+
+   Output Arguments:
+.  batch - the new batch
+
+   Notes:
+   Operations are queued with PetscSFBatchAddBcastAndOp() and PetscSFBatchAddReduce(), started together with
+   PetscSFBatchBegin() and completed together with PetscSFBatchEnd(). The star forests of the operations may have
+   different graphs and the operations different units, and the queue may mix broadcasts and reductions.
+
+   The communication plan is kept as long as the same sequence of star forests, units and directions is queued,
+   so a batch is meant to be created once and used for every exchange of a multi-field code.
+
+   Level: advanced
+
+.seealso: PetscSFBatchDestroy(), PetscSFBatchAddBcastAndOp(), PetscSFBatchAddReduce(), PetscSFBatchBegin(), PetscSFBatchEnd()
+@*/
+PetscErrorCode PetscSFBatchCreate(MPI_Comm comm,PetscSFBatch *batch)
+{
+  PetscErrorCode ierr;
+  PetscSFBatch   b;
+
+  PetscFunctionBegin;
+  PetscValidPointer(batch,2);
+  ierr = PetscSFInitializePackage();CHKERRQ(ierr);
+  ierr = PetscNew(&b);CHKERRQ(ierr);
+  ierr = PetscCommDuplicate(comm,&b->comm,&b->tag);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(b->comm,&b->rank);CHKERRQ(ierr);
+  b->nplanned = -1;
+  *batch      = b;
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscSFBatchDestroy - Destroy a batch created with PetscSFBatchCreate()
+
+   Collective
+
+   Input Arguments:
+.  batch - the batch
+
+   Level: advanced
+
+.seealso: PetscSFBatchCreate()
+@*/
+PetscErrorCode PetscSFBatchDestroy(PetscSFBatch *batch)
+{
+  PetscErrorCode ierr;
+  PetscSFBatch   b;
+  PetscInt       i;
+
+  PetscFunctionBegin;
+  if (!batch || !*batch) PetscFunctionReturn(0);
+  b = *batch;
+  if (b->inuse) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"Must call PetscSFBatchEnd() before destroying the batch");
+  ierr = PetscSFBatchResetPlan(b);CHKERRQ(ierr);
+  for (i=0; i<b->maxn; i++) {ierr = PetscSFDestroy(&b->items[i].sf);CHKERRQ(ierr);}
+  ierr = PetscFree(b->items);CHKERRQ(ierr);
+  ierr = PetscCommDestroy(&b->comm);CHKERRQ(ierr);
+  ierr = PetscFree(*batch);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+static PetscErrorCode PetscSFBatchAdd_Private(PetscSFBatch batch,PetscSF sf,MPI_Datatype unit,PetscSFDirection direction,const void *src,void *dst,MPI_Op op)
+{
+  PetscErrorCode   ierr;
+  PetscSFBatchItem *item,*items;
+  PetscMPIInt      flag;
+  PetscObjectState state;
+
+  PetscFunctionBegin;
+  PetscValidPointer(batch,1);
+  PetscValidHeaderSpecific(sf,PETSCSF_CLASSID,2);
+  if (batch->inuse) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"Cannot add operations to a batch between PetscSFBatchBegin() and PetscSFBatchEnd()");
+  ierr = MPI_Comm_compare(batch->comm,PetscObjectComm((PetscObject)sf),&flag);CHKERRQ(ierr);
+  if (flag != MPI_IDENT && flag != MPI_CONGRUENT) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_NOTSAMECOMM,"The star forest must be on the communicator of the batch");
+  if (batch->n == batch->maxn) {
+    ierr = PetscCalloc1(2*batch->maxn+4,&items);CHKERRQ(ierr);
+    ierr = PetscArraycpy(items,batch->items,batch->maxn);CHKERRQ(ierr);
+    ierr = PetscFree(batch->items);CHKERRQ(ierr);
+    batch->items = items;
+    batch->maxn  = 2*batch->maxn+4;
+  }
+  item = &batch->items[batch->n];
+  /* The plan can be reused if the n-th operation matches the n-th operation it was built for */
+  if (batch->nplanned > batch->n) {
+    ierr = PetscObjectStateGet((PetscObject)sf,&state);CHKERRQ(ierr);
+    if (item->sf != sf || item->unit != unit || item->direction != direction || item->state != state) {ierr = PetscSFBatchResetPlan(batch);CHKERRQ(ierr);}
+  } else if (batch->nplanned >= 0) {ierr = PetscSFBatchResetPlan(batch);CHKERRQ(ierr);}
+  ierr = PetscObjectReference((PetscObject)sf);CHKERRQ(ierr);
+  ierr = PetscSFDestroy(&item->sf);CHKERRQ(ierr);
+  item->sf        = sf;
+  item->unit      = unit;
+  item->direction = direction;
+  item->op        = op;
+  item->src       = src;
+  item->dst       = dst;
+  batch->n++;
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscSFBatchAddBcastAndOp - Queue in a batch a broadcast of root values reduced to leaf values, see PetscSFBcastAndOpBegin()
+
+   Logically Collective
+
+   Input Arguments:
++  batch - the batch
+.  sf - star forest on which to communicate
+.  unit - data type associated with each node
+.  rootdata - buffer to broadcast
+.  leafdata - buffer to be reduced with values from each leaf's respective root
+-  op - operation to use for reduction
+
+   Notes:
+   The operation is only started by PetscSFBatchBegin() and completed by PetscSFBatchEnd(), so the buffers must stay
+   valid until then. The operations of a batch must be independent, i.e., no operation may write to data another one
+   of the batch reads, and all processes must queue the same sequence of operations.
+
+   Level: advanced
+
+.seealso: PetscSFBatchCreate(), PetscSFBatchAddReduce(), PetscSFBatchBegin(), PetscSFBatchEnd(), PetscSFBcastAndOpBegin()
+@*/
+PetscErrorCode PetscSFBatchAddBcastAndOp(PetscSFBatch batch,PetscSF sf,MPI_Datatype unit,const void *rootdata,void *leafdata,MPI_Op op)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscSFBatchAdd_Private(batch,sf,unit,PETSCSF_ROOT2LEAF_BCAST,rootdata,leafdata,op);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscSFBatchAddReduce - Queue in a batch a reduction of leaf values into root values, see PetscSFReduceBegin()
+
+   Logically Collective
+
+   Input Arguments:
++  batch - the batch
+.  sf - star forest on which to communicate
+.  unit - data type associated with each node
+.  leafdata - values to reduce
+.  rootdata - result of the reduction of the values of all leaves of each root
+-  op - reduction operation
+
+   Notes:
+   See PetscSFBatchAddBcastAndOp() about the lifetime of the buffers and the operations allowed in a batch.
+
+   Level: advanced
+
+.seealso: PetscSFBatchCreate(), PetscSFBatchAddBcastAndOp(), PetscSFBatchBegin(), PetscSFBatchEnd(), PetscSFReduceBegin()
+@*/
+PetscErrorCode PetscSFBatchAddReduce(PetscSFBatch batch,PetscSF sf,MPI_Datatype unit,const void *leafdata,void *rootdata,MPI_Op op)
+{
+  PetscErrorCode ierr;
+
+  PetscFunctionBegin;
+  ierr = PetscSFBatchAdd_Private(batch,sf,unit,PETSCSF_LEAF2ROOT_REDUCE,leafdata,rootdata,op);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscSFBatchBegin - Begin all operations queued in a batch, with one message per pair of neighbors
+
+   Collective
+
+   Input Arguments:
+.  batch - the batch
+
+   Notes:
+   Operations on star forests that do not communicate along the edges of their graph (such as PETSCSFWINDOW or
+   PETSCSFALLGATHERV), and all operations of a batch whose data is on the device, are done with the regular
+   PetscSF operations instead.
+
+   Level: advanced
+
+.seealso: PetscSFBatchCreate(), PetscSFBatchEnd()
+@*/
+PetscErrorCode PetscSFBatchBegin(PetscSFBatch batch)
+{
+  PetscErrorCode   ierr;
+  PetscSFBatchItem *item;
+  PetscInt         i,j,self = -1;
+  PetscMPIInt      n = 0,count;
+  PetscMemType     srcmtype,dstmtype;
+  PetscObjectState state;
+
+  PetscFunctionBegin;
+  PetscValidPointer(batch,1);
+  if (batch->inuse) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"PetscSFBatchBegin() was already called");
+  ierr = PetscLogEventBegin(PETSCSF_BatchBegin,0,0,0,0);CHKERRQ(ierr);
+  batch->inuse      = PETSC_TRUE;
+  batch->individual = PETSC_FALSE;
+  for (i=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    ierr = PetscGetMemType(item->src,&srcmtype);CHKERRQ(ierr);
+    ierr = PetscGetMemType(item->dst,&dstmtype);CHKERRQ(ierr);
+    if (srcmtype != PETSC_MEMTYPE_HOST || dstmtype != PETSC_MEMTYPE_HOST) batch->individual = PETSC_TRUE;
+  }
+  if (!batch->individual) {
+    for (i=0; i<batch->nplanned; i++) {
+      ierr = PetscObjectStateGet((PetscObject)batch->items[i].sf,&state);CHKERRQ(ierr);
+      if (state != batch->items[i].state) break;
+    }
+    if (batch->nplanned != batch->n || i < batch->nplanned) {ierr = PetscSFBatchSetUpPlan(batch);CHKERRQ(ierr);}
+
+    /* Pack all batched operations, the part of each rank at its place in the message to that rank */
+    for (i=0; i<batch->n; i++) {
+      item = &batch->items[i];
+      if (!item->batched) continue;
+      for (j=0; j<item->nsend; j++) {
+        ierr = (*item->link->h_Pack)(item->sendoffset[j+1]-item->sendoffset[j],item->sendidx+item->sendoffset[j],item->link,NULL,item->src,batch->sendbuf+item->sendpos[j]);CHKERRQ(ierr);
+      }
+    }
+    for (i=0; i<batch->nrecv; i++) {
+      if (batch->recvranks[i] == batch->rank) continue;
+      ierr = PetscMPIIntCast(batch->recvoffset[i+1]-batch->recvoffset[i],&count);CHKERRQ(ierr);
+      ierr = MPI_Irecv(batch->recvbuf+batch->recvoffset[i],count,MPI_BYTE,batch->recvranks[i],batch->tag,batch->comm,&batch->reqs[n++]);CHKERRQ(ierr);
+    }
+    for (i=0; i<batch->nsend; i++) {
+      if (batch->sendranks[i] == batch->rank) {self = i; continue;}
+      ierr = PetscMPIIntCast(batch->sendoffset[i+1]-batch->sendoffset[i],&count);CHKERRQ(ierr);
+      ierr = MPI_Isend(batch->sendbuf+batch->sendoffset[i],count,MPI_BYTE,batch->sendranks[i],batch->tag,batch->comm,&batch->reqs[n++]);CHKERRQ(ierr);
+    }
+    /* The message to self is just copied */
+    if (self >= 0) {
+      ierr = PetscFindMPIInt(batch->rank,batch->nrecv,batch->recvranks,&j);CHKERRQ(ierr);
+      if (j < 0 || batch->recvoffset[j+1]-batch->recvoffset[j] != batch->sendoffset[self+1]-batch->sendoffset[self]) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_PLIB,"Inconsistent sizes of the message to self");
+      ierr = PetscMemcpy(batch->recvbuf+batch->recvoffset[j],batch->sendbuf+batch->sendoffset[self],batch->sendoffset[self+1]-batch->sendoffset[self]);CHKERRQ(ierr);
+    }
+  }
+  for (i=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    if (item->batched && !batch->individual) continue;
+    if (item->direction == PETSCSF_ROOT2LEAF_BCAST) {ierr = PetscSFBcastAndOpBegin(item->sf,item->unit,item->src,item->dst,item->op);CHKERRQ(ierr);}
+    else                                            {ierr = PetscSFReduceBegin(item->sf,item->unit,item->src,item->dst,item->op);CHKERRQ(ierr);}
+  }
+  ierr = PetscLogEventEnd(PETSCSF_BatchBegin,0,0,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@C
+   PetscSFBatchEnd - Complete all operations of a batch started with PetscSFBatchBegin() and empty its queue
+
+   Collective
+
+   Input Arguments:
+.  batch - the batch
+
+   Notes:
+   The communication plan is kept for the next sequence of operations queued in the batch.
+
+   Level: advanced
+
+.seealso: PetscSFBatchCreate(), PetscSFBatchBegin()
+@*/
+PetscErrorCode PetscSFBatchEnd(PetscSFBatch batch)
+{
+  PetscErrorCode   ierr;
+  PetscSFBatchItem *item;
+  PetscInt         i,j,nreqs;
+  PetscErrorCode   (*UnpackAndOp)(PetscInt,const PetscInt*,PetscSFPack,PetscSFPackOpt,void*,const void*);
+
+  PetscFunctionBegin;
+  PetscValidPointer(batch,1);
+  if (!batch->inuse) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_ARG_WRONGSTATE,"Must call PetscSFBatchBegin() first");
+  ierr = PetscLogEventBegin(PETSCSF_BatchEnd,0,0,0,0);CHKERRQ(ierr);
+  if (!batch->individual) {
+    nreqs = 0;
+    for (i=0; i<batch->nrecv; i++) if (batch->recvranks[i] != batch->rank) nreqs++;
+    for (i=0; i<batch->nsend; i++) if (batch->sendranks[i] != batch->rank) nreqs++;
+    ierr = MPI_Waitall((PetscMPIInt)nreqs,batch->reqs,MPI_STATUSES_IGNORE);CHKERRQ(ierr);
+    for (i=0; i<batch->n; i++) {
+      item = &batch->items[i];
+      if (!item->batched) continue;
+      /* Leaves are distinct but several leaves may reduce to one root, which threads must not update concurrently */
+      ierr = PetscSFPackGetUnpackAndOp(item->link,PETSC_MEMTYPE_HOST,item->op,item->direction == PETSCSF_LEAF2ROOT_REDUCE ? PETSC_TRUE : PETSC_FALSE,&UnpackAndOp);CHKERRQ(ierr);
+      if (!UnpackAndOp) SETERRQ(PETSC_COMM_SELF,PETSC_ERR_SUP,"No support for this MPI_Op in a PetscSFBatch");
+      for (j=0; j<item->nrecv; j++) {
+        ierr = (*UnpackAndOp)(item->recvoffset[j+1]-item->recvoffset[j],item->recvidx+item->recvoffset[j],item->link,NULL,item->dst,batch->recvbuf+item->recvpos[j]);CHKERRQ(ierr);
+      }
+    }
+  }
+  for (i=0; i<batch->n; i++) {
+    item = &batch->items[i];
+    if (item->batched && !batch->individual) continue;
+    if (item->direction == PETSCSF_ROOT2LEAF_BCAST) {ierr = PetscSFBcastAndOpEnd(item->sf,item->unit,item->src,item->dst,item->op);CHKERRQ(ierr);}
+    else                                            {ierr = PetscSFReduceEnd(item->sf,item->unit,item->src,item->dst,item->op);CHKERRQ(ierr);}
+  }
+  batch->n     = 0;
+  batch->inuse = PETSC_FALSE;
+  ierr = PetscLogEventEnd(PETSCSF_BatchEnd,0,0,0,0);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
@@ -12,6 +12,9 @@ PETSC_INTERN PetscErrorCode PetscSFCreate_Alltoall(PetscSF);
 #if defined(PETSC_HAVE_MPI_NEIGHBORHOOD_COLLECTIVES)
 PETSC_INTERN PetscErrorCode PetscSFCreate_Neighbor(PetscSF);
 #endif
+#if defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY)
+PETSC_INTERN PetscErrorCode PetscSFCreate_Shm(PetscSF);
+#endif
 
 PetscFunctionList PetscSFList;
 PetscBool         PetscSFRegisterAllCalled;
@@ -43,6 +46,9 @@ PetscErrorCode  PetscSFRegisterAll(void)
   ierr = PetscSFRegister(PETSCSFALLTOALL,  PetscSFCreate_Alltoall);CHKERRQ(ierr);
 #if defined(PETSC_HAVE_MPI_NEIGHBORHOOD_COLLECTIVES)
   ierr = PetscSFRegister(PETSCSFNEIGHBOR,  PetscSFCreate_Neighbor);CHKERRQ(ierr);
+#endif
+#if defined(PETSC_HAVE_MPI_PROCESS_SHARED_MEMORY)
+  ierr = PetscSFRegister(PETSCSFSHM,       PetscSFCreate_Shm);CHKERRQ(ierr);
 #endif
   PetscFunctionReturn(0);
 }
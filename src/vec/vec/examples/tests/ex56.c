@@ -0,0 +1,80 @@
+static char help[] = "Tests VecTSQR() on a set of badly conditioned vectors.\n\n\
+  -n <n> : global length of the vectors\n\
+  -k <k> : number of vectors\n\n";
+
+#include <petscvec.h>
+
+int main(int argc,char **argv)
+{
+  Vec            u,*X,*Y;
+  PetscInt       n = 100,k = 6,i,j,rstart,rend;
+  PetscScalar    *R,*dots,*x;
+  PetscReal      t,nrm,orth = 0.0,err = 0.0;
+  PetscErrorCode ierr;
+
+  ierr = PetscInitialize(&argc,&argv,(char*)0,help);if (ierr) return ierr;
+  ierr = PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL);CHKERRQ(ierr);
+  ierr = PetscOptionsGetInt(NULL,NULL,"-k",&k,NULL);CHKERRQ(ierr);
+  ierr = PetscMalloc2(k*k,&R,k,&dots);CHKERRQ(ierr);
+  ierr = VecCreate(PETSC_COMM_WORLD,&u);CHKERRQ(ierr);
+  ierr = VecSetSizes(u,PETSC_DECIDE,n);CHKERRQ(ierr);
+  ierr = VecSetFromOptions(u);CHKERRQ(ierr);
+  ierr = VecDuplicateVecs(u,k,&X);CHKERRQ(ierr);
+  ierr = VecDuplicateVecs(u,k,&Y);CHKERRQ(ierr);
+  ierr = VecGetOwnershipRange(u,&rstart,&rend);CHKERRQ(ierr);
+
+  /* monomials 1, t, t^2, ... sampled on [0,1], the columns of a Vandermonde matrix */
+  for (j=0; j<k; j++) {
+    ierr = VecGetArray(X[j],&x);CHKERRQ(ierr);
+    for (i=rstart; i<rend; i++) {
+      t           = (PetscReal)i/(PetscReal)(n-1);
+      x[i-rstart] = PetscPowReal(t,(PetscReal)j) + (j%2 ? 0.0 : 1.e-3*PetscSinReal((PetscReal)(i+j)));
+    }
+    ierr = VecRestoreArray(X[j],&x);CHKERRQ(ierr);
+    ierr = VecCopy(X[j],Y[j]);CHKERRQ(ierr);
+  }
+
+  ierr = VecTSQR(k,X,R);CHKERRQ(ierr);
+
+  /* Q^H Q = I */
+  for (j=0; j<k; j++) {
+    ierr = VecMDot(X[j],k,X,dots);CHKERRQ(ierr);
+    for (i=0; i<k; i++) orth = PetscMax(orth,PetscAbsScalar(dots[i] - (i == j ? 1.0 : 0.0)));
+  }
+  /* Q R = X, R upper triangular with a nonnegative diagonal */
+  for (j=0; j<k; j++) {
+    ierr = VecNorm(Y[j],NORM_2,&nrm);CHKERRQ(ierr);
+    for (i=0; i<=j; i++) dots[i] = -R[i+j*k];
+    ierr = VecMAXPY(Y[j],j+1,dots,X);CHKERRQ(ierr);
+    ierr = VecNorm(Y[j],NORM_2,&t);CHKERRQ(ierr);
+    err  = PetscMax(err,t/nrm);
+    for (i=j+1; i<k; i++) if (R[i+j*k] != 0.0) SETERRQ2(PETSC_COMM_WORLD,PETSC_ERR_PLIB,"R(%D,%D) is not zero",i,j);
+    if (PetscRealPart(R[j+j*k]) < 0.0 || PetscImaginaryPart(R[j+j*k]) != 0.0) SETERRQ2(PETSC_COMM_WORLD,PETSC_ERR_PLIB,"R(%D,%D) is not real nonnegative",j,j);
+  }
+  if (orth > 100.0*PETSC_SMALL || err > 100.0*PETSC_SMALL) {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"Loss of orthogonality %g, relative error in QR %g\n",(double)orth,(double)err);CHKERRQ(ierr);
+  } else {
+    ierr = PetscPrintf(PETSC_COMM_WORLD,"TSQR of %D vectors of length %D is correct\n",k,n);CHKERRQ(ierr);
+  }
+
+  ierr = VecDestroyVecs(k,&X);CHKERRQ(ierr);
+  ierr = VecDestroyVecs(k,&Y);CHKERRQ(ierr);
+  ierr = VecDestroy(&u);CHKERRQ(ierr);
+  ierr = PetscFree2(R,dots);CHKERRQ(ierr);
+  ierr = PetscFinalize();
+  return ierr;
+}
+
+/*TEST
+
+   test:
+      nsize: {{1 2 3 4}}
+      output_file: output/ex56_1.out
+
+   test:
+      suffix: 2
+      nsize: {{3 4}}
+      args: -n 10 -k 6
+      output_file: output/ex56_2.out
+
+TEST*/
@@ -0,0 +1,189 @@
+/*
+   Tall-skinny QR factorization of a block of vectors distributed by rows
+*/
+#include <petsc/private/vecimpl.h>    /*I   "petscvec.h"  I*/
+#include <petscblaslapack.h>
+
+/*
+   VecTSQR_Private - computes the QR factorization of the N by n matrix whose local m by n rows are stored
+   column major with leading dimension lda in A. Each process factors its rows with Householder QR, then
+   the small n by n R factors are combined along a binary reduction tree, so there is only one round of
+   messages of size n*n per level of the tree. The tree is traversed back down to form the local rows of
+   Q explicitly, which overwrite A. R is upper triangular with a real nonnegative diagonal, it is stored
+   column major with leading dimension n and is the same on all processes.
+
+   comm must be a communicator obtained from a PETSc object, it is used for point-to-point messages
+*/
+PetscErrorCode VecTSQR_Private(MPI_Comm comm,PetscInt m,PetscInt n,PetscScalar *A,PetscInt lda,PetscScalar *R)
+{
+  PetscErrorCode ierr;
+  PetscMPIInt    rank,size,tag,nn;
+  PetscInt       N,k = PetscMin(m,n),mw = PetscMax(1,m),i,j,l,levels,step,lev;
+  PetscScalar    *W,*tau,*V,*vtau,*S,*T,*work,d;
+  PetscReal      a;
+  PetscBLASInt   bm,bn,bk,bmw,blda,b2n,lwork,info;
+
+  PetscFunctionBegin;
+  if (!n) PetscFunctionReturn(0);
+  ierr = MPIU_Allreduce(&m,&N,1,MPIU_INT,MPI_SUM,comm);CHKERRQ(ierr);
+  if (N < n) SETERRQ2(comm,PETSC_ERR_ARG_SIZ,"TSQR needs at least as many rows %D as columns %D",N,n);
+  ierr = MPI_Comm_size(comm,&size);CHKERRQ(ierr);
+  ierr = MPI_Comm_rank(comm,&rank);CHKERRQ(ierr);
+  ierr = PetscCommGetNewTag(comm,&tag);CHKERRQ(ierr);
+  for (levels=0,step=1; step<size; step*=2) levels++;
+  ierr = PetscMPIIntCast(n*n,&nn);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(m,&bm);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(n,&bn);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(k,&bk);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(mw,&bmw);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(PetscMax(1,lda),&blda);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(2*n,&b2n);CHKERRQ(ierr);
+  ierr = PetscBLASIntCast(64*n,&lwork);CHKERRQ(ierr);
+  /* W and tau hold the local reflectors, V and vtau the reflectors of each level of the tree where this process combines two R factors */
+  ierr = PetscMalloc7(mw*n,&W,n,&tau,levels*2*n*n,&V,levels*n,&vtau,n*n,&S,2*n*n,&T,64*n,&work);CHKERRQ(ierr);
+
+  /* local Householder QR, S is the n by n R factor of the local rows padded with zeros when m < n */
+  for (j=0; j<n; j++) {ierr = PetscMemcpy(W+j*mw,A+j*lda,m*sizeof(PetscScalar));CHKERRQ(ierr);}
+  if (k) {
+    ierr = PetscFPTrapPush(PETSC_FP_TRAP_OFF);CHKERRQ(ierr);
+    PetscStackCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&bm,&bn,W,&bmw,tau,work,&lwork,&info));
+    ierr = PetscFPTrapPop();CHKERRQ(ierr);
+    if (info) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in xGEQRF %d",(int)info);
+  }
+  ierr = PetscMemzero(S,n*n*sizeof(PetscScalar));CHKERRQ(ierr);
+  for (j=0; j<n; j++) for (i=0; i<=PetscMin(j,k-1); i++) S[i+j*n] = W[i+j*mw];
+
+  /* up the tree: at level l the process rank+2^l sends its R factor to the process rank, which factors the two stacked triangles */
+  for (l=0,step=1; l<levels; l++,step*=2) {
+    if (rank % (2*step)) {
+      ierr = MPI_Send(S,nn,MPIU_SCALAR,rank-step,tag,comm);CHKERRQ(ierr);
+      break;
+    } else if (rank+step < size) {
+      PetscScalar *Vl = V+l*2*n*n;
+
+      ierr = MPI_Recv(T,nn,MPIU_SCALAR,rank+step,tag,comm,MPI_STATUS_IGNORE);CHKERRQ(ierr);
+      for (j=0; j<n; j++) {
+        ierr = PetscMemcpy(Vl+j*2*n,S+j*n,n*sizeof(PetscScalar));CHKERRQ(ierr);
+        ierr = PetscMemcpy(Vl+j*2*n+n,T+j*n,n*sizeof(PetscScalar));CHKERRQ(ierr);
+      }
+      ierr = PetscFPTrapPush(PETSC_FP_TRAP_OFF);CHKERRQ(ierr);
+      PetscStackCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&b2n,&bn,Vl,&b2n,vtau+l*n,work,&lwork,&info));
+      ierr = PetscFPTrapPop();CHKERRQ(ierr);
+      if (info) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in xGEQRF %d",(int)info);
+      ierr = PetscMemzero(S,n*n*sizeof(PetscScalar));CHKERRQ(ierr);
+      for (j=0; j<n; j++) for (i=0; i<=j; i++) S[i+j*n] = Vl[i+j*2*n];
+    }
+  }
+
+  /* the root scales the rows of R to get a nonnegative diagonal, the inverse scaling of the columns of Q starts the way down */
+  if (!rank) {
+    ierr = PetscMemcpy(R,S,n*n*sizeof(PetscScalar));CHKERRQ(ierr);
+    ierr = PetscMemzero(S,n*n*sizeof(PetscScalar));CHKERRQ(ierr);
+    for (i=0; i<n; i++) {
+      a = PetscAbsScalar(R[i+i*n]);
+      d = a > 0.0 ? R[i+i*n]/a : 1.0;
+      for (j=i; j<n; j++) R[i+j*n] *= PetscConj(d);
+      S[i+i*n] = d;
+    }
+  }
+  ierr = MPI_Bcast(R,nn,MPIU_SCALAR,0,comm);CHKERRQ(ierr);
+
+  /* down the tree: apply the reflectors of each level to [S; 0], keep the top half and send the bottom half to the partner */
+  for (lev=levels-1; lev>=0; lev--) {
+    step = ((PetscInt)1) << lev;
+    if (!(rank % (2*step)) && rank+step < size) {
+      for (j=0; j<n; j++) {
+        ierr = PetscMemcpy(T+j*2*n,S+j*n,n*sizeof(PetscScalar));CHKERRQ(ierr);
+        ierr = PetscMemzero(T+j*2*n+n,n*sizeof(PetscScalar));CHKERRQ(ierr);
+      }
+      ierr = PetscFPTrapPush(PETSC_FP_TRAP_OFF);CHKERRQ(ierr);
+      PetscStackCallBLAS("LAPACKormqr",LAPACKormqr_("L","N",&b2n,&bn,&bn,V+lev*2*n*n,&b2n,vtau+lev*n,T,&b2n,work,&lwork,&info));
+      ierr = PetscFPTrapPop();CHKERRQ(ierr);
+      if (info) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in xORMQR %d",(int)info);
+      for (j=0; j<n; j++) {
+        ierr = PetscMemcpy(S+j*n,T+j*2*n,n*sizeof(PetscScalar));CHKERRQ(ierr);
+        ierr = PetscMemcpy(T+j*n,T+j*2*n+n,n*sizeof(PetscScalar));CHKERRQ(ierr);
+      }
+      ierr = MPI_Send(T,nn,MPIU_SCALAR,rank+step,tag,comm);CHKERRQ(ierr);
+    } else if (rank % (2*step) == step) {
+      ierr = MPI_Recv(S,nn,MPIU_SCALAR,rank-step,tag,comm,MPI_STATUS_IGNORE);CHKERRQ(ierr);
+    }
+  }
+
+  /* the local rows of Q are the local reflectors applied to the first k rows of S */
+  if (m) {
+    for (j=0; j<n; j++) {
+      ierr = PetscMemcpy(A+j*lda,S+j*n,k*sizeof(PetscScalar));CHKERRQ(ierr);
+      ierr = PetscMemzero(A+j*lda+k,(m-k)*sizeof(PetscScalar));CHKERRQ(ierr);
+    }
+    ierr = PetscFPTrapPush(PETSC_FP_TRAP_OFF);CHKERRQ(ierr);
+    PetscStackCallBLAS("LAPACKormqr",LAPACKormqr_("L","N",&bm,&bn,&bk,W,&bmw,tau,A,&blda,work,&lwork,&info));
+    ierr = PetscFPTrapPop();CHKERRQ(ierr);
+    if (info) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in xORMQR %d",(int)info);
+  }
+  ierr = PetscFree7(W,tau,V,vtau,S,T,work);CHKERRQ(ierr);
+  ierr = PetscLogFlops(4.0*m*n*n + levels*(20.0/3.0)*n*n*n);CHKERRQ(ierr);
+  PetscFunctionReturn(0);
+}
+
+/*@
+   VecTSQR - Computes the QR factorization of a set of vectors with the tall-skinny QR (TSQR) algorithm,
+   the vectors are replaced with orthonormal vectors spanning the same space
+
+   Collective on Vec
+
+   Input Parameters:
++  n - number of vectors
+-  X - the vectors, all with the same layout
+
+   Output Parameters:
++  X - the orthonormal vectors Q, with X_in = Q R
+-  R - the n by n upper triangular factor, stored by columns, with a real nonnegative diagonal (may be NULL)
+
+   Notes:
+   Each process computes the Householder QR factorization of its rows, then the n by n triangular factors are
+   combined along a binary tree, so the communication cost is log2(size) messages of n*n scalars instead of
+   the O(n) reductions of Gram-Schmidt. The result is orthonormal to machine precision regardless of the
+   conditioning of the vectors. R is the same on all processes.
+
+   The global length of the vectors must be at least n.
+
+   Level: advanced
+
+.seealso: MatDenseTSQR(), VecMDot(), VecMAXPY()
+@*/
+PetscErrorCode VecTSQR(PetscInt n,Vec X[],PetscScalar R[])
+{
+  PetscErrorCode    ierr;
+  PetscInt          m,i;
+  PetscScalar       *A,*r = R,*x;
+  const PetscScalar *xx;
+
+  PetscFunctionBegin;
+  if (n < 0) SETERRQ1(PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of vectors cannot be negative %D",n);
+  if (!n) PetscFunctionReturn(0);
+  PetscValidPointer(X,2);
+  PetscValidHeaderSpecific(X[0],VEC_CLASSID,2);
+  ierr = VecGetLocalSize(X[0],&m);CHKERRQ(ierr);
+  for (i=1; i<n; i++) {
+    PetscValidHeaderSpecific(X[i],VEC_CLASSID,2);
+    PetscCheckSameComm(X[0],2,X[i],2);
+    VecCheckSameSize(X[0],2,X[i],2);
+  }
+  ierr = PetscMalloc1(m*n,&A);CHKERRQ(ierr);
+  if (!R) {ierr = PetscMalloc1(n*n,&r);CHKERRQ(ierr);}
+  for (i=0; i<n; i++) {
+    ierr = VecGetArrayRead(X[i],&xx);CHKERRQ(ierr);
+    ierr = PetscMemcpy(A+i*m,xx,m*sizeof(PetscScalar));CHKERRQ(ierr);
+    ierr = VecRestoreArrayRead(X[i],&xx);CHKERRQ(ierr);
+  }
+  ierr = VecTSQR_Private(PetscObjectComm((PetscObject)X[0]),m,n,A,m,r);CHKERRQ(ierr);
+  for (i=0; i<n; i++) {
+    ierr = VecGetArray(X[i],&x);CHKERRQ(ierr);
+    ierr = PetscMemcpy(x,A+i*m,m*sizeof(PetscScalar));CHKERRQ(ierr);
+    ierr = VecRestoreArray(X[i],&x);CHKERRQ(ierr);
+  }
+  ierr = PetscFree(A);CHKERRQ(ierr);
+  if (!R) {ierr = PetscFree(r);CHKERRQ(ierr);}
+  PetscFunctionReturn(0);
+}
@@ -761,6 +761,40 @@ functionend:
   PetscFunctionReturn(0);
 }
 
+/*
+   VecScatterGetSF_Private - Gets the star forest of a VECSCATTERSF scatter, whose roots are in x and leaves in y,
+   so that its forward scatters can be done by other PetscSF users, such as PetscSFBatch.
+
+   Not Collective
+
+   Input Parameter:
+.  vscat - the scatter context
+
+   Output Parameters:
++  sf   - the star forest, or NULL if vscat is not a set up VECSCATTERSF
+-  unit - the MPI datatype of a node of sf
+
+   Notes:
+   The star forest is owned by vscat and must not be destroyed.
+*/
+PetscErrorCode VecScatterGetSF_Private(VecScatter vscat,PetscSF *sf,MPI_Datatype *unit)
+{
+  PetscErrorCode ierr;
+  PetscBool      issf;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(vscat,VEC_SCATTER_CLASSID,1);
+  *sf   = NULL;
+  *unit = MPI_DATATYPE_NULL;
+  ierr  = PetscObjectTypeCompare((PetscObject)vscat,VECSCATTERSF,&issf);CHKERRQ(ierr);
+  if (issf && vscat->data) {
+    VecScatter_SF *data = (VecScatter_SF*)vscat->data;
+    *sf   = data->sf;
+    *unit = data->unit;
+  }
+  PetscFunctionReturn(0);
+}
+
 PetscErrorCode VecScatterCreate_SF(VecScatter ctx)
 {
   PetscErrorCode ierr;